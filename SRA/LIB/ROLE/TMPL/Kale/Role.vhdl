@@ -162,7 +162,7 @@ entity Role_Kale is
     ------------------------------------------------------
     -- FPGA Receive Path (SHELL-->ROLE) ----------
     ---- Stream TCP Listen Request -----
-    soSHL_Nts_Tcp_LsnReq_tdata          : out   std_ulogic_vector( 15 downto 0);  
+    soSHL_Nts_Tcp_LsnReq_tdata          : out   std_ulogic_vector( 23 downto 0);  
     soSHL_Nts_Tcp_LsnReq_tvalid         : out   std_ulogic;
     soSHL_Nts_Tcp_LsnReq_tready         : in    std_ulogic;
     ---- Stream TCP Listen Acknnoledge -
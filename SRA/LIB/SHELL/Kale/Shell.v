@@ -229,6 +229,14 @@ module Shell_Kale # (
   output [ 55:0]  soROL_Nts_Tcp_SndRep_tdata,
   output          soROL_Nts_Tcp_SndRep_tvalid,
   input           soROL_Nts_Tcp_SndRep_tready,
+  //---- Axi4-Stream TCP Send Descriptor (zero-copy)
+  input  [ 63:0]  siROL_Nts_Tcp_SndDsc_tdata,
+  input           siROL_Nts_Tcp_SndDsc_tvalid,
+  output          siROL_Nts_Tcp_SndDsc_tready,
+  //---- Axi4-Stream TCP Send Completion (zero-copy)
+  output [ 55:0]  soROL_Nts_Tcp_SndCpl_tdata,
+  output          soROL_Nts_Tcp_SndCpl_tvalid,
+  input           soROL_Nts_Tcp_SndCpl_tready,
   //------------------------------------------------------
   //-- ROLE / Nts / Tcp / Rx Data Interfaces  (.i.e SHELL-->ROLE)
   //------------------------------------------------------
@@ -250,6 +258,18 @@ module Shell_Kale # (
   input  [ 31:0]  siROL_Nts_Tcp_DReq_tdata,
   input           siROL_Nts_Tcp_DReq_tvalid,
   output          siROL_Nts_Tcp_DReq_tready,
+  //----  Axi4-Stream TCP Read Descriptor Request (zero-copy)
+  input  [ 31:0]  siROL_Nts_Tcp_DscReq_tdata,
+  input           siROL_Nts_Tcp_DscReq_tvalid,
+  output          siROL_Nts_Tcp_DscReq_tready,
+  //----  Axi4-Stream TCP Read Descriptor (zero-copy)
+  output [ 71:0]  soROL_Nts_Tcp_RdDsc_tdata,
+  output          soROL_Nts_Tcp_RdDsc_tvalid,
+  input           soROL_Nts_Tcp_RdDsc_tready,
+  //----  Axi4-Stream TCP Rx Buffer Credit (zero-copy)
+  input  [ 31:0]  siROL_Nts_Tcp_RxCrd_tdata,
+  input           siROL_Nts_Tcp_RxCrd_tvalid,
+  output          siROL_Nts_Tcp_RxCrd_tready,
   //------------------------------------------------------
   //-- ROLE / Nts / Tcp / TxP Ctlr Interfaces (.i.e ROLE-->SHELL)
   //------------------------------------------------------
@@ -269,7 +289,7 @@ module Shell_Kale # (
   //-- ROLE / Nts / Tcp / Rx Ctlr Interfaces (.i.e SHELL-->ROLE)
   //------------------------------------------------------
   //----  Axi4-Stream TCP Listen Request ----
-  input [ 15:0]  siROL_Nts_Tcp_LsnReq_tdata,   
+  input [ 23:0]  siROL_Nts_Tcp_LsnReq_tdata,   
   input          siROL_Nts_Tcp_LsnReq_tvalid,
   output         siROL_Nts_Tcp_LsnReq_tready,
   //----  Axi4-Stream TCP Listen Rep --------
@@ -544,6 +564,14 @@ module Shell_Kale # (
   wire  [ 55:0] ssNTS0_TARS_Tcp_SndRep_tdata ;
   wire          ssNTS0_TARS_Tcp_SndRep_tvalid;
   wire          ssNTS0_TARS_Tcp_SndRep_tready;
+  //--
+  wire  [ 63:0] ssTARS_NTS0_Tcp_SndDsc_tdata ;
+  wire          ssTARS_NTS0_Tcp_SndDsc_tvalid;
+  wire          ssTARS_NTS0_Tcp_SndDsc_tready;
+  //--
+  wire  [ 55:0] ssNTS0_TARS_Tcp_SndCpl_tdata ;
+  wire          ssNTS0_TARS_Tcp_SndCpl_tvalid;
+  wire          ssNTS0_TARS_Tcp_SndCpl_tready;
       
   //------------------------------------------------------
   //-- NTS / Tcp / Rx Data Interfaces (.i.e NTS<-->TARS)
@@ -565,6 +593,18 @@ module Shell_Kale # (
   wire  [ 31:0] ssTARS_NTS0_Tcp_DReq_tdata  ;
   wire          ssTARS_NTS0_Tcp_DReq_tvalid ;
   wire          ssTARS_NTS0_Tcp_DReq_tready ;
+  //--
+  wire  [ 31:0] ssTARS_NTS0_Tcp_DscReq_tdata ;
+  wire          ssTARS_NTS0_Tcp_DscReq_tvalid;
+  wire          ssTARS_NTS0_Tcp_DscReq_tready;
+  //--
+  wire  [ 71:0] ssNTS0_TARS_Tcp_RdDsc_tdata ;
+  wire          ssNTS0_TARS_Tcp_RdDsc_tvalid;
+  wire          ssNTS0_TARS_Tcp_RdDsc_tready;
+  //--
+  wire  [ 31:0] ssTARS_NTS0_Tcp_RxCrd_tdata ;
+  wire          ssTARS_NTS0_Tcp_RxCrd_tvalid;
+  wire          ssTARS_NTS0_Tcp_RxCrd_tready;
     
   //------------------------------------------------------
   //-- NTS / Tcp / Tx Ctlr Interfaces (.i.e NTS<-->TARS)
@@ -584,7 +624,7 @@ module Shell_Kale # (
   //------------------------------------------------------
   //-- NTS / Tcp / Rx Ctlr Interfaces (.i.e NTS<-->TARS)
   //------------------------------------------------------
-  wire  [ 15:0] ssTARS_NTS0_Tcp_LsnReq_tdata ;   
+  wire  [ 23:0] ssTARS_NTS0_Tcp_LsnReq_tdata ;   
   wire          ssTARS_NTS0_Tcp_LsnReq_tvalid;
   wire          ssTARS_NTS0_Tcp_LsnReq_tready;
   //--
@@ -1118,6 +1158,14 @@ module Shell_Kale # (
     .soAPP_Tcp_SndRep_tdata           (ssNTS0_TARS_Tcp_SndRep_tdata),
     .soAPP_Tcp_SndRep_tvalid          (ssNTS0_TARS_Tcp_SndRep_tvalid),
     .soAPP_Tcp_SndRep_tready          (ssNTS0_TARS_Tcp_SndRep_tready),      
+    //---- Axi4-Stream TCP SndDsc (zero-copy) --
+    .siAPP_Tcp_SndDsc_tdata           (ssTARS_NTS0_Tcp_SndDsc_tdata),
+    .siAPP_Tcp_SndDsc_tvalid          (ssTARS_NTS0_Tcp_SndDsc_tvalid),
+    .siAPP_Tcp_SndDsc_tready          (ssTARS_NTS0_Tcp_SndDsc_tready),
+    //---- Axi4-Stream TCP SndCpl (zero-copy) --
+    .soAPP_Tcp_SndCpl_tdata           (ssNTS0_TARS_Tcp_SndCpl_tdata),
+    .soAPP_Tcp_SndCpl_tvalid          (ssNTS0_TARS_Tcp_SndCpl_tvalid),
+    .soAPP_Tcp_SndCpl_tready          (ssNTS0_TARS_Tcp_SndCpl_tready),
     //---------------------------------------------------
     //-- TAIF / Rx Data Interfaces (.i.e NTS-->APP)
     //---------------------------------------------------
@@ -1139,6 +1187,18 @@ module Shell_Kale # (
     .siAPP_Tcp_DReq_tdata             (ssTARS_NTS0_Tcp_DReq_tdata),    
     .siAPP_Tcp_DReq_tvalid            (ssTARS_NTS0_Tcp_DReq_tvalid),
     .siAPP_Tcp_DReq_tready            (ssTARS_NTS0_Tcp_DReq_tready),
+    //---- Axi4-Stream APP Read Descriptor Request (zero-copy)
+    .siAPP_Tcp_DscReq_tdata           (ssTARS_NTS0_Tcp_DscReq_tdata),
+    .siAPP_Tcp_DscReq_tvalid          (ssTARS_NTS0_Tcp_DscReq_tvalid),
+    .siAPP_Tcp_DscReq_tready          (ssTARS_NTS0_Tcp_DscReq_tready),
+    //---- Axi4-Stream APP Read Descriptor (zero-copy)
+    .soAPP_Tcp_RdDsc_tdata            (ssNTS0_TARS_Tcp_RdDsc_tdata),
+    .soAPP_Tcp_RdDsc_tvalid           (ssNTS0_TARS_Tcp_RdDsc_tvalid),
+    .soAPP_Tcp_RdDsc_tready           (ssNTS0_TARS_Tcp_RdDsc_tready),
+    //---- Axi4-Stream APP Rx Buffer Credit (zero-copy)
+    .siAPP_Tcp_RxCrd_tdata            (ssTARS_NTS0_Tcp_RxCrd_tdata),
+    .siAPP_Tcp_RxCrd_tvalid           (ssTARS_NTS0_Tcp_RxCrd_tvalid),
+    .siAPP_Tcp_RxCrd_tready           (ssTARS_NTS0_Tcp_RxCrd_tready),
     //------------------------------------------------------
     //-- TAIF / Tx Ctlr Interfaces (.i.e APP-->NTS)
     //------------------------------------------------------
@@ -1213,6 +1273,14 @@ module Shell_Kale # (
     .soAPP_Tcp_SndRep_tdata     (soROL_Nts_Tcp_SndRep_tdata ),
     .soAPP_Tcp_SndRep_tvalid    (soROL_Nts_Tcp_SndRep_tvalid),
     .soAPP_Tcp_SndRep_tready    (soROL_Nts_Tcp_SndRep_tready),
+    //---- Axi4-Stream APP Send Descriptor (zero-copy)
+    .siAPP_Tcp_SndDsc_tdata     (siROL_Nts_Tcp_SndDsc_tdata ),
+    .siAPP_Tcp_SndDsc_tvalid    (siROL_Nts_Tcp_SndDsc_tvalid),
+    .siAPP_Tcp_SndDsc_tready    (siROL_Nts_Tcp_SndDsc_tready),
+    //---- Axi4-Stream APP Send Completion (zero-copy)
+    .soAPP_Tcp_SndCpl_tdata     (soROL_Nts_Tcp_SndCpl_tdata ),
+    .soAPP_Tcp_SndCpl_tvalid    (soROL_Nts_Tcp_SndCpl_tvalid),
+    .soAPP_Tcp_SndCpl_tready    (soROL_Nts_Tcp_SndCpl_tready),
     //------------------------------------------------------
     //-- APP / Tcp / Rx Data Interfaces (.i.e THIS<-->APP)
     //------------------------------------------------------
@@ -1234,6 +1302,18 @@ module Shell_Kale # (
     .siAPP_Tcp_DReq_tdata       (siROL_Nts_Tcp_DReq_tdata ),
     .siAPP_Tcp_DReq_tvalid      (siROL_Nts_Tcp_DReq_tvalid),
     .siAPP_Tcp_DReq_tready      (siROL_Nts_Tcp_DReq_tready),
+    //--  Axi4-Stream TCP Read Descriptor Request (zero-copy)
+    .siAPP_Tcp_DscReq_tdata     (siROL_Nts_Tcp_DscReq_tdata),
+    .siAPP_Tcp_DscReq_tvalid    (siROL_Nts_Tcp_DscReq_tvalid),
+    .siAPP_Tcp_DscReq_tready    (siROL_Nts_Tcp_DscReq_tready),
+    //--  Axi4-Stream TCP Read Descriptor (zero-copy)
+    .soAPP_Tcp_RdDsc_tdata      (soROL_Nts_Tcp_RdDsc_tdata),
+    .soAPP_Tcp_RdDsc_tvalid     (soROL_Nts_Tcp_RdDsc_tvalid),
+    .soAPP_Tcp_RdDsc_tready     (soROL_Nts_Tcp_RdDsc_tready),
+    //--  Axi4-Stream TCP Rx Buffer Credit (zero-copy)
+    .siAPP_Tcp_RxCrd_tdata      (siROL_Nts_Tcp_RxCrd_tdata),
+    .siAPP_Tcp_RxCrd_tvalid     (siROL_Nts_Tcp_RxCrd_tvalid),
+    .siAPP_Tcp_RxCrd_tready     (siROL_Nts_Tcp_RxCrd_tready),
     //------------------------------------------------------
     //-- APP / Tcp / Tx Ctlr Interfaces (.i.e THIS<-->APP)
     //------------------------------------------------------
@@ -1277,6 +1357,14 @@ module Shell_Kale # (
     .siNTS_Tcp_SndRep_tdata     (ssNTS0_TARS_Tcp_SndRep_tdata  ),
     .siNTS_Tcp_SndRep_tvalid    (ssNTS0_TARS_Tcp_SndRep_tvalid ),
     .siNTS_Tcp_SndRep_tready    (ssNTS0_TARS_Tcp_SndRep_tready ),
+    //---- Axi4-Stream TCP Send Descriptor (zero-copy)
+    .soNTS_Tcp_SndDsc_tdata     (ssTARS_NTS0_Tcp_SndDsc_tdata ),
+    .soNTS_Tcp_SndDsc_tvalid    (ssTARS_NTS0_Tcp_SndDsc_tvalid),
+    .soNTS_Tcp_SndDsc_tready    (ssTARS_NTS0_Tcp_SndDsc_tready),
+    //---- Axi4-Stream TCP Send Completion (zero-copy)
+    .siNTS_Tcp_SndCpl_tdata     (ssNTS0_TARS_Tcp_SndCpl_tdata  ),
+    .siNTS_Tcp_SndCpl_tvalid    (ssNTS0_TARS_Tcp_SndCpl_tvalid ),
+    .siNTS_Tcp_SndCpl_tready    (ssNTS0_TARS_Tcp_SndCpl_tready ),
     //------------------------------------------------------
     //-- NTS / Tcp / Rx Data Interfaces (.i.e NTS<-->THIS)
     //------------------------------------------------------
@@ -1298,6 +1386,18 @@ module Shell_Kale # (
     .soNTS_Tcp_DReq_tdata       (ssTARS_NTS0_Tcp_DReq_tdata ),
     .soNTS_Tcp_DReq_tvalid      (ssTARS_NTS0_Tcp_DReq_tvalid),
     .soNTS_Tcp_DReq_tready      (ssTARS_NTS0_Tcp_DReq_tready),
+    //--  Axi4-Stream TCP Read Descriptor Request (zero-copy)
+    .soNTS_Tcp_DscReq_tdata     (ssTARS_NTS0_Tcp_DscReq_tdata),
+    .soNTS_Tcp_DscReq_tvalid    (ssTARS_NTS0_Tcp_DscReq_tvalid),
+    .soNTS_Tcp_DscReq_tready    (ssTARS_NTS0_Tcp_DscReq_tready),
+    //--  Axi4-Stream TCP Read Descriptor (zero-copy)
+    .siNTS_Tcp_RdDsc_tdata      (ssNTS0_TARS_Tcp_RdDsc_tdata),
+    .siNTS_Tcp_RdDsc_tvalid     (ssNTS0_TARS_Tcp_RdDsc_tvalid),
+    .siNTS_Tcp_RdDsc_tready     (ssNTS0_TARS_Tcp_RdDsc_tready),
+    //--  Axi4-Stream TCP Rx Buffer Credit (zero-copy)
+    .soNTS_Tcp_RxCrd_tdata      (ssTARS_NTS0_Tcp_RxCrd_tdata),
+    .soNTS_Tcp_RxCrd_tvalid     (ssTARS_NTS0_Tcp_RxCrd_tvalid),
+    .soNTS_Tcp_RxCrd_tready     (ssTARS_NTS0_Tcp_RxCrd_tready),
     //------------------------------------------------------
     //-- NTS / Tcp / Tx Ctlr Interfaces (.i.e NTS<-->THIS)
     //------------------------------------------------------
@@ -77,6 +77,14 @@ module TcpApplicationRegisterSlice
   output [ 55:0]  soAPP_Tcp_SndRep_tdata,
   output          soAPP_Tcp_SndRep_tvalid,
   input           soAPP_Tcp_SndRep_tready,
+  //---- Axis4-Stream TCP Send Descriptor (zero-copy)
+  input  [ 63:0]  siAPP_Tcp_SndDsc_tdata,
+  input           siAPP_Tcp_SndDsc_tvalid,
+  output          siAPP_Tcp_SndDsc_tready,
+  //---- Axis4-Stream TCP Send Completion (zero-copy)
+  output [ 55:0]  soAPP_Tcp_SndCpl_tdata,
+  output          soAPP_Tcp_SndCpl_tvalid,
+  input           soAPP_Tcp_SndCpl_tready,
   
   //------------------------------------------------------
   //-- APP / Tcp / Rx Data Interfaces (.i.e TARS<-->APP)
@@ -99,6 +107,18 @@ module TcpApplicationRegisterSlice
   input  [ 31:0]  siAPP_Tcp_DReq_tdata,
   input           siAPP_Tcp_DReq_tvalid,
   output          siAPP_Tcp_DReq_tready,
+  //--  Axis4-Stream TCP Read Descriptor Request (zero-copy)
+  input  [ 31:0]  siAPP_Tcp_DscReq_tdata,
+  input           siAPP_Tcp_DscReq_tvalid,
+  output          siAPP_Tcp_DscReq_tready,
+  //--  Axis4-Stream TCP Read Descriptor (zero-copy)
+  output [ 71:0]  soAPP_Tcp_RdDsc_tdata,
+  output          soAPP_Tcp_RdDsc_tvalid,
+  input           soAPP_Tcp_RdDsc_tready,
+  //--  Axis4-Stream TCP Rx Buffer Credit (zero-copy)
+  input  [ 31:0]  siAPP_Tcp_RxCrd_tdata,
+  input           siAPP_Tcp_RxCrd_tvalid,
+  output          siAPP_Tcp_RxCrd_tready,
 
   //------------------------------------------------------
   //-- APP / Tcp / Tx Ctlr Interfaces (.i.e TARS<-->APP)
@@ -120,7 +140,7 @@ module TcpApplicationRegisterSlice
   //-- APP / Tcp / Rx Ctlr Interfaces (.i.e TARS<-->APP)
   //------------------------------------------------------
   //----  Axis4-Stream TCP Listen Request ----
-  input [ 15:0]  siAPP_Tcp_LsnReq_tdata,   
+  input [ 23:0]  siAPP_Tcp_LsnReq_tdata,   
   input          siAPP_Tcp_LsnReq_tvalid,
   output         siAPP_Tcp_LsnReq_tready,
   //----  Axis4-Stream TCP Listen Rep --------
@@ -145,6 +165,14 @@ module TcpApplicationRegisterSlice
   input  [ 55:0]  siNTS_Tcp_SndRep_tdata,
   input           siNTS_Tcp_SndRep_tvalid,
   output          siNTS_Tcp_SndRep_tready,
+  //---- Axis4-Stream TCP Send Descriptor (zero-copy)
+  output [ 63:0]  soNTS_Tcp_SndDsc_tdata,
+  output          soNTS_Tcp_SndDsc_tvalid,
+  input           soNTS_Tcp_SndDsc_tready,
+  //---- Axis4-Stream TCP Send Completion (zero-copy)
+  input  [ 55:0]  siNTS_Tcp_SndCpl_tdata,
+  input           siNTS_Tcp_SndCpl_tvalid,
+  output          siNTS_Tcp_SndCpl_tready,
     
   //------------------------------------------------------
   //-- NTS / Tcp / Rx Data Interfaces (.i.e NTS<-->TARS)
@@ -167,6 +195,18 @@ module TcpApplicationRegisterSlice
   output [ 31:0]  soNTS_Tcp_DReq_tdata,
   output          soNTS_Tcp_DReq_tvalid,
   input           soNTS_Tcp_DReq_tready,
+  //--  Axis4-Stream TCP Read Descriptor Request (zero-copy)
+  output [ 31:0]  soNTS_Tcp_DscReq_tdata,
+  output          soNTS_Tcp_DscReq_tvalid,
+  input           soNTS_Tcp_DscReq_tready,
+  //--  Axis4-Stream TCP Read Descriptor (zero-copy)
+  input  [ 71:0]  siNTS_Tcp_RdDsc_tdata,
+  input           siNTS_Tcp_RdDsc_tvalid,
+  output          siNTS_Tcp_RdDsc_tready,
+  //--  Axis4-Stream TCP Rx Buffer Credit (zero-copy)
+  output [ 31:0]  soNTS_Tcp_RxCrd_tdata,
+  output          soNTS_Tcp_RxCrd_tvalid,
+  input           soNTS_Tcp_RxCrd_tready,
   
   //------------------------------------------------------
   //-- NTS / Tcp / Tx Ctlr Interfaces (.i.e NTS<-->TARS)
@@ -188,7 +228,7 @@ module TcpApplicationRegisterSlice
   //-- NTS / Tcp / Rx Ctlr Interfaces (.i.e NTS<-->TARS)
   //------------------------------------------------------
   //----  Axis4-Stream TCP Listen Request ----
-  output[ 15:0]  soNTS_Tcp_LsnReq_tdata,   
+  output[ 23:0]  soNTS_Tcp_LsnReq_tdata,   
   output         soNTS_Tcp_LsnReq_tvalid,
   input          soNTS_Tcp_LsnReq_tready,
   //----  Axis4-Stream TCP Listen Rep --------
@@ -248,6 +288,37 @@ module TcpApplicationRegisterSlice
     .m_axis_tvalid  (soAPP_Tcp_SndRep_tvalid),
     .m_axis_tready  (soAPP_Tcp_SndRep_tready)
   );
+
+  // [INFO] A send descriptor does not use 'tkeep' and 'tlast'.
+  AxisRegisterSlice_64 APP_NTS_Tcp_SndDsc (
+    .aclk           (piClk),
+    .aresetn        (~piRst),
+    //-- From APP ----------------------
+    .s_axis_tdata   (siAPP_Tcp_SndDsc_tdata),
+    .s_axis_tvalid  (siAPP_Tcp_SndDsc_tvalid),
+    .s_axis_tkeep   (8'hFF),
+    .s_axis_tlast   (1'b0),
+    .s_axis_tready  (siAPP_Tcp_SndDsc_tready),
+    //-- To NTS ------------------------
+    .m_axis_tdata   (soNTS_Tcp_SndDsc_tdata),
+    .m_axis_tkeep   (),
+    .m_axis_tlast   (),
+    .m_axis_tvalid  (soNTS_Tcp_SndDsc_tvalid),
+    .m_axis_tready  (soNTS_Tcp_SndDsc_tready)
+  );
+
+  AxisRegisterSlice_56 NTS_APP_Tcp_SndCpl (
+    .aclk           (piClk),
+    .aresetn        (~piRst),
+    //-- From NTS ----------------------
+    .s_axis_tdata   (siNTS_Tcp_SndCpl_tdata),
+    .s_axis_tvalid  (siNTS_Tcp_SndCpl_tvalid),
+    .s_axis_tready  (siNTS_Tcp_SndCpl_tready),
+    //-- To APP ------------------------
+    .m_axis_tdata   (soAPP_Tcp_SndCpl_tdata),
+    .m_axis_tvalid  (soAPP_Tcp_SndCpl_tvalid),
+    .m_axis_tready  (soAPP_Tcp_SndCpl_tready)
+  );
     
   //------------------------------------------------------
   //-- TAIF / Rx Data Interfaces 
@@ -307,6 +378,45 @@ module TcpApplicationRegisterSlice
     .m_axis_tvalid  (soNTS_Tcp_DReq_tvalid),
     .m_axis_tready  (soNTS_Tcp_DReq_tready)
   );
+
+  AxisRegisterSlice_32 APP_NTS_Tcp_DscReq (
+    .aclk           (piClk),
+    .aresetn        (~piRst),
+    //-- From APP ----------------------
+    .s_axis_tdata   (siAPP_Tcp_DscReq_tdata),
+    .s_axis_tvalid  (siAPP_Tcp_DscReq_tvalid),
+    .s_axis_tready  (siAPP_Tcp_DscReq_tready),
+    //-- To NTS ------------------------
+    .m_axis_tdata   (soNTS_Tcp_DscReq_tdata),
+    .m_axis_tvalid  (soNTS_Tcp_DscReq_tvalid),
+    .m_axis_tready  (soNTS_Tcp_DscReq_tready)
+  );
+
+  AxisRegisterSlice_72 NTS_APP_Tcp_RdDsc (
+    .aclk           (piClk),
+    .aresetn        (~piRst),
+    //-- From NTS ----------------------
+    .s_axis_tdata   (siNTS_Tcp_RdDsc_tdata),
+    .s_axis_tvalid  (siNTS_Tcp_RdDsc_tvalid),
+    .s_axis_tready  (siNTS_Tcp_RdDsc_tready),
+    //-- To APP ------------------------
+    .m_axis_tdata   (soAPP_Tcp_RdDsc_tdata),
+    .m_axis_tvalid  (soAPP_Tcp_RdDsc_tvalid),
+    .m_axis_tready  (soAPP_Tcp_RdDsc_tready)
+  );
+
+  AxisRegisterSlice_32 APP_NTS_Tcp_RxCrd (
+    .aclk           (piClk),
+    .aresetn        (~piRst),
+    //-- From APP ----------------------
+    .s_axis_tdata   (siAPP_Tcp_RxCrd_tdata),
+    .s_axis_tvalid  (siAPP_Tcp_RxCrd_tvalid),
+    .s_axis_tready  (siAPP_Tcp_RxCrd_tready),
+    //-- To NTS ------------------------
+    .m_axis_tdata   (soNTS_Tcp_RxCrd_tdata),
+    .m_axis_tvalid  (soNTS_Tcp_RxCrd_tvalid),
+    .m_axis_tready  (soNTS_Tcp_RxCrd_tready)
+  );
   
   //------------------------------------------------------
   //-- TAIF / Tx Ctlr Interfaces
@@ -353,7 +463,7 @@ module TcpApplicationRegisterSlice
   //------------------------------------------------------
   //-- TAIF / Rx Ctlr Interfaces 
   //------------------------------------------------------
-  AxisRegisterSlice_16 APP_NTS_Tcp_LsnReq (
+  AxisRegisterSlice_24 APP_NTS_Tcp_LsnReq (
    .aclk           (piClk),
    .aresetn        (~piRst),
    //-- From APP ----------------------
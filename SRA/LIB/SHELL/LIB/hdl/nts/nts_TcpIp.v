@@ -207,6 +207,14 @@ module NetworkTransportStack_TcpIp (
   output [ 55:0] soAPP_Tcp_SndRep_tdata,
   output         soAPP_Tcp_SndRep_tvalid,
   input          soAPP_Tcp_SndRep_tready,
+  //---- Axi4-Stream APP Send Descriptor (zero-copy)
+  input [ 63:0]  siAPP_Tcp_SndDsc_tdata,
+  input          siAPP_Tcp_SndDsc_tvalid,
+  output         siAPP_Tcp_SndDsc_tready,
+  //---- Axi4-Stream APP Send Completion (zero-copy)
+  output [ 55:0] soAPP_Tcp_SndCpl_tdata,
+  output         soAPP_Tcp_SndCpl_tvalid,
+  input          soAPP_Tcp_SndCpl_tready,
 
   //------------------------------------------------------
   //-- TAIF / Rx Data Interfaces (.i.e NTS-->APP)
@@ -229,6 +237,18 @@ module NetworkTransportStack_TcpIp (
   input  [ 31:0] siAPP_Tcp_DReq_tdata,
   input          siAPP_Tcp_DReq_tvalid,
   output         siAPP_Tcp_DReq_tready,
+  //--  Axi4-Stream TCP Read Descriptor Request (zero-copy)
+  input  [ 31:0] siAPP_Tcp_DscReq_tdata,
+  input          siAPP_Tcp_DscReq_tvalid,
+  output         siAPP_Tcp_DscReq_tready,
+  //--  Axi4-Stream TCP Read Descriptor (zero-copy)
+  output [ 71:0] soAPP_Tcp_RdDsc_tdata,
+  output         soAPP_Tcp_RdDsc_tvalid,
+  input          soAPP_Tcp_RdDsc_tready,
+  //--  Axi4-Stream TCP Rx Buffer Credit (zero-copy)
+  input  [ 31:0] siAPP_Tcp_RxCrd_tdata,
+  input          siAPP_Tcp_RxCrd_tvalid,
+  output         siAPP_Tcp_RxCrd_tready,
   
   //------------------------------------------------------
   //-- TAIF / Tx Ctlr Interfaces (.i.e APP-->NTS)
@@ -250,7 +270,7 @@ module NetworkTransportStack_TcpIp (
   //-- TAIF / Rx Ctlr Interfaces (.i.e NTS-->APP)
   //------------------------------------------------------
   //----  Axi4-Stream TCP Listen Request ----
-  input [ 15:0]  siAPP_Tcp_LsnReq_tdata,
+  input [ 23:0]  siAPP_Tcp_LsnReq_tdata,
   input          siAPP_Tcp_LsnReq_tvalid,
   output         siAPP_Tcp_LsnReq_tready,
   //----  Axi4-Stream TCP Listen Ack --------
@@ -441,7 +461,7 @@ module NetworkTransportStack_TcpIp (
   wire          ssTOE_ARS13_SssRelCnt_tvalid;
   wire          ssTOE_ARS13_SssRelCnt_tready;
   //-- TOE ==>[ARS14]==> MMIO / SessRegCnt
-  wire  [15:0]  ssTOE_ARS14_SssRegCnt_tdata;
+  wire  [31:0]  ssTOE_ARS14_SssRegCnt_tdata;
   wire          ssTOE_ARS14_SssRegCnt_tvalid;
   wire          ssTOE_ARS14_SssRegCnt_tready;
  
@@ -453,7 +473,7 @@ module NetworkTransportStack_TcpIp (
   wire          ssCAM_TOE_LkpRep_tvalid;
   wire          ssCAM_TOE_LkpRep_tready;
   //-- CAM ==> TOE / UpdateReply
-  wire  [15:0]  ssCAM_TOE_UpdRpl_tdata;
+  wire  [23:0]  ssCAM_TOE_UpdRpl_tdata;
   wire          ssCAM_TOE_UpdRpl_tvalid;
   wire          ssCAM_TOE_UpdRpl_tready;
 
@@ -846,6 +866,18 @@ module NetworkTransportStack_TcpIp (
     .soTAIF_Meta_TDATA         (soAPP_Tcp_Meta_tdata),
     .soTAIF_Meta_TVALID        (soAPP_Tcp_Meta_tvalid),
     .soTAIF_Meta_TREADY        (soAPP_Tcp_Meta_tready),
+    //-- From APP / Read Descriptor Request (zero-copy)
+    .siTAIF_DscReq_TDATA       (siAPP_Tcp_DscReq_tdata),
+    .siTAIF_DscReq_TVALID      (siAPP_Tcp_DscReq_tvalid),
+    .siTAIF_DscReq_TREADY      (siAPP_Tcp_DscReq_tready),
+    //-- To   APP / Read Descriptor (zero-copy)
+    .soTAIF_RdDsc_TDATA        (soAPP_Tcp_RdDsc_tdata),
+    .soTAIF_RdDsc_TVALID       (soAPP_Tcp_RdDsc_tvalid),
+    .soTAIF_RdDsc_TREADY       (soAPP_Tcp_RdDsc_tready),
+    //-- From APP / Rx Buffer Credit (zero-copy)
+    .siTAIF_RxCrd_TDATA        (siAPP_Tcp_RxCrd_tdata),
+    .siTAIF_RxCrd_TVALID       (siAPP_Tcp_RxCrd_tvalid),
+    .siTAIF_RxCrd_TREADY       (siAPP_Tcp_RxCrd_tready),
     //------------------------------------------------------
     //-- TAIF / APP Rx Ctrl Interfaces
     //------------------------------------------------------
@@ -874,6 +906,14 @@ module NetworkTransportStack_TcpIp (
     .soTAIF_SndRep_TDATA       (soAPP_Tcp_SndRep_tdata),
     .soTAIF_SndRep_TVALID      (soAPP_Tcp_SndRep_tvalid),
     .soTAIF_SndRep_TREADY      (soAPP_Tcp_SndRep_tready),
+    //-- From APP / Send Descriptor (zero-copy)
+    .siTAIF_SndDsc_TDATA       (siAPP_Tcp_SndDsc_tdata),
+    .siTAIF_SndDsc_TVALID      (siAPP_Tcp_SndDsc_tvalid),
+    .siTAIF_SndDsc_TREADY      (siAPP_Tcp_SndDsc_tready),
+    //-- To  APP / Send Completion (zero-copy)
+    .soTAIF_SndCpl_TDATA       (soAPP_Tcp_SndCpl_tdata),
+    .soTAIF_SndCpl_TVALID      (soAPP_Tcp_SndCpl_tvalid),
+    .soTAIF_SndCpl_TREADY      (soAPP_Tcp_SndCpl_tready),
     //------------------------------------------------------
     //-- TAIF / APP Tx Ctrl Flow Interfaces
     //------------------------------------------------------
@@ -1075,13 +1115,25 @@ module NetworkTransportStack_TcpIp (
     .soTAIF_Meta_V_V_TDATA     (soAPP_Tcp_Meta_tdata),
     .soTAIF_Meta_V_V_TVALID    (soAPP_Tcp_Meta_tvalid),
     .soTAIF_Meta_V_V_TREADY    (soAPP_Tcp_Meta_tready),
+    //-- From APP / Read Descriptor Request (zero-copy)
+    .siTAIF_DscReq_V_TDATA     (siAPP_Tcp_DscReq_tdata),
+    .siTAIF_DscReq_V_TVALID    (siAPP_Tcp_DscReq_tvalid),
+    .siTAIF_DscReq_V_TREADY    (siAPP_Tcp_DscReq_tready),
+    //-- To   APP / Read Descriptor (zero-copy)
+    .soTAIF_RdDsc_V_TDATA      (soAPP_Tcp_RdDsc_tdata),
+    .soTAIF_RdDsc_V_TVALID     (soAPP_Tcp_RdDsc_tvalid),
+    .soTAIF_RdDsc_V_TREADY     (soAPP_Tcp_RdDsc_tready),
+    //-- From APP / Rx Buffer Credit (zero-copy)
+    .siTAIF_RxCrd_V_TDATA      (siAPP_Tcp_RxCrd_tdata),
+    .siTAIF_RxCrd_V_TVALID     (siAPP_Tcp_RxCrd_tvalid),
+    .siTAIF_RxCrd_V_TREADY     (siAPP_Tcp_RxCrd_tready),
     //------------------------------------------------------
     //-- TAIF / APP Rx Ctrl Interfaces
     //------------------------------------------------------
     //-- From APP / Listen Port Request
-    .siTAIF_LsnReq_V_V_TDATA   (siAPP_Tcp_LsnReq_tdata),
-    .siTAIF_LsnReq_V_V_TVALID  (siAPP_Tcp_LsnReq_tvalid),
-    .siTAIF_LsnReq_V_V_TREADY  (siAPP_Tcp_LsnReq_tready),
+    .siTAIF_LsnReq_V_TDATA     (siAPP_Tcp_LsnReq_tdata),
+    .siTAIF_LsnReq_V_TVALID    (siAPP_Tcp_LsnReq_tvalid),
+    .siTAIF_LsnReq_V_TREADY    (siAPP_Tcp_LsnReq_tready),
     //-- To   APP / Listen Port Reply
     .soTAIF_LsnRep_V_TDATA     (soAPP_Tcp_LsnRep_tdata),
     .soTAIF_LsnRep_V_TVALID    (soAPP_Tcp_LsnRep_tvalid),
@@ -1103,6 +1155,14 @@ module NetworkTransportStack_TcpIp (
     .soTAIF_SndRep_V_TDATA     (soAPP_Tcp_SndRep_tdata),
     .soTAIF_SndRep_V_TVALID    (soAPP_Tcp_SndRep_tvalid),
     .soTAIF_SndRep_V_TREADY    (soAPP_Tcp_SndRep_tready),
+    //-- From APP / Send Descriptor (zero-copy)
+    .siTAIF_SndDsc_V_TDATA     (siAPP_Tcp_SndDsc_tdata),
+    .siTAIF_SndDsc_V_TVALID    (siAPP_Tcp_SndDsc_tvalid),
+    .siTAIF_SndDsc_V_TREADY    (siAPP_Tcp_SndDsc_tready),
+    //-- To  APP / Send Completion (zero-copy)
+    .soTAIF_SndCpl_V_TDATA     (soAPP_Tcp_SndCpl_tdata),
+    .soTAIF_SndCpl_V_TVALID    (soAPP_Tcp_SndCpl_tvalid),
+    .soTAIF_SndCpl_V_TREADY    (soAPP_Tcp_SndCpl_tready),
     //------------------------------------------------------
     //-- TAIF / APP Tx Ctrl Flow Interfaces
     //------------------------------------------------------
@@ -1295,7 +1355,7 @@ module NetworkTransportStack_TcpIp (
   //============================================================================
   //  INST: AXI4-STREAM-REGISTER-SLICE (TOE ==>[ARS14]==> MMIO)
   //============================================================================
-  AxisRegisterSlice_16 ARS14 (
+  AxisRegisterSlice_32 ARS14 (
     .aclk           (piShlClk),
     .aresetn        (~piMMIO_Layer3Rst),
     //-- From TOE / Notif --------------
@@ -569,6 +569,7 @@ void nal_main(
 #pragma HLS INTERFACE axis register both port=siTOE_SessId
 
 #pragma HLS INTERFACE axis register both port=soTOE_LsnReq
+#pragma HLS DATA_PACK                variable=soTOE_LsnReq
 #pragma HLS INTERFACE axis register both port=siTOE_LsnRep
 
 #pragma HLS INTERFACE axis register both port=soTOE_Data
@@ -866,7 +866,7 @@ void pTOE(
         if (!siTRIF_LsnReq.empty()) {
             siTRIF_LsnReq.read(appLsnPortReq);
             printInfo(myLsnName, "Received a listen port request #%d from [TRIF].\n",
-                      appLsnPortReq.to_int());
+                      appLsnPortReq.port.to_int());
             lsnState = LSN_SEND_ACK;
         }
         //else {
@@ -876,7 +876,7 @@ void pTOE(
     case LSN_SEND_ACK: // SEND ACK BACK TO [TRIF]
         if (!soTRIF_LsnAck.full()) {
             soTRIF_LsnAck.write(true);
-            //fpgaLsnPort = appLsnPortReq.to_int();
+            //fpgaLsnPort = appLsnPortReq.port.to_int();
             lsnState = LSN_WAIT_REQ;
         }
         else {
@@ -265,6 +265,10 @@ class AxisIp4: public AxisRaw {
     TcpCtrlBit  getTcpCtrlAck()                 {           return tdata.bit(12);                         }
     void setTcpCtrlUrg(TcpCtrlBit bit)          {                  tdata.bit(13) = bit;                   }
     TcpCtrlBit  getTcpCtrlUrg()                 {           return tdata.bit(13);                         }
+    void setTcpCtrlEce(TcpCtrlBit bit)          {                  tdata.bit(14) = bit;                   }
+    TcpCtrlBit  getTcpCtrlEce()                 {           return tdata.bit(14);                         }
+    void setTcpCtrlCwr(TcpCtrlBit bit)          {                  tdata.bit(15) = bit;                   }
+    TcpCtrlBit  getTcpCtrlCwr()                 {           return tdata.bit(15);                         }
     // Set-Get the TCP Window
     void        setTcpWindow(TcpWindow win)     {                  tdata.range(31, 16) = swapWord(win);   }
     TcpWindow   getTcpWindow()                  { return swapWord (tdata.range(31, 16));                  }
@@ -275,10 +279,31 @@ class AxisIp4: public AxisRaw {
     void        setTcpUrgPtr(TcpUrgPtr ptr)     {                  tdata.range(63, 48) = swapWord(ptr);   }
     TcpUrgPtr   getTcpUrgPtr()                  { return swapWord (tdata.range(63, 48));                  }
     // Set-Get the TCP Options
-    void        setTcpOptKind(TcpOptKind val)   {                  tdata.range( 7,  0);                   }
+    void        setTcpOptKind(TcpOptKind val)   {                  tdata.range( 7,  0) = val;             }
     TcpOptKind  getTcpOptKind()                 { return           tdata.range( 7,  0);                   }
-    void        setTcpOptMss(TcpOptMss val)     {                  tdata.range(31, 16);                   }
+    void        setTcpOptLen(TcpOptLen len)     {                  tdata.range(15,  8) = len;             }
+    TcpOptLen   getTcpOptLen()                  { return           tdata.range(15,  8);                   }
+    void        setTcpOptMss(TcpOptMss val)     {                  tdata.range(31, 16) = swapWord(val);   }
     TcpOptMss   getTcpOptMss()                  { return swapWord (tdata.range(31, 16));                  }
+    // Set-Get a Window Scale option preceded by a NOP (.i.e, [ Shift | Len=3 | Kind=3 | NOP ])
+    void        setTcpOptWss(TcpOptWss val)     {                  tdata.range(39, 32) = TCP_OPT_KIND_NOP;
+                                                                   tdata.range(47, 40) = TCP_OPT_KIND_WSS;
+                                                                   tdata.range(55, 48) = 3;
+                                                                   tdata.range(63, 56) = val;             }
+    TcpOptWss   getTcpOptWss()                  { return           tdata.range(59, 56);                   }
+    // Set a SACK-Permitted option preceded by two NOPs (.i.e, [ Len=2 | Kind=4 | NOP | NOP ])
+    void        setTcpOptSackOk(int Lo=32)      {                  tdata.range(Lo+ 7, Lo   ) = TCP_OPT_KIND_NOP;
+                                                                   tdata.range(Lo+15, Lo+ 8) = TCP_OPT_KIND_NOP;
+                                                                   tdata.range(Lo+23, Lo+16) = TCP_OPT_KIND_SACK;
+                                                                   tdata.range(Lo+31, Lo+24) = 2;         }
+    // Set the header of a SACK option preceded by two NOPs (.i.e, [ Len | Kind=5 | NOP | NOP ])
+    void        setTcpOptSackHdr(int nBlocks, int Lo=0) {          tdata.range(Lo+ 7, Lo   ) = TCP_OPT_KIND_NOP;
+                                                                   tdata.range(Lo+15, Lo+ 8) = TCP_OPT_KIND_NOP;
+                                                                   tdata.range(Lo+23, Lo+16) = TCP_OPT_KIND_SBLK;
+                                                                   tdata.range(Lo+31, Lo+24) = 2 + 8*nBlocks; }
+    // Set-Get the left or right edge of a SACK block
+    void        setTcpOptSackEdge(TcpSeqNum num, int Lo) {         tdata.range(Lo+31, Lo) = swapDWord(num);   }
+    TcpSeqNum   getTcpOptSackEdge(int Lo)       { return swapDWord(tdata.range(Lo+31, Lo));               }
 
     LE_TcpPort  getLE_TcpSrcPort()              {           return tdata.range(47, 32) ;                  }
     LE_TcpPort  getLE_TcpDstPort()              {           return tdata.range(63, 48);                   }
@@ -109,8 +109,18 @@
 
 /***********************************************
  * AXIS RAW - DEFINITIONS
+ *  [WARNING] 'ARW' must remain 64. The protocol
+ *   classes (AxisEth, AxisIp4, AxisTcp, ...) and
+ *   the IPRX, RXe, TXe and UOE engines still
+ *   hard-code the field positions of a 64-bit
+ *   chunk. The wider widths are only used by the
+ *   AxisRawT<W> helpers, by iptx<W>() and by the
+ *   'csimWidth' benchmarks.
  ***********************************************/
-#define AXIS_RAW_WIDTH_AT_10GE  64
+#define AXIS_RAW_WIDTH_AT_10GE   64
+#define AXIS_RAW_WIDTH_AT_25GE  128
+#define AXIS_RAW_WIDTH_AT_40GE  256
+#define AXIS_RAW_WIDTH_AT_100GE 512
 #define ARW                     AXIS_RAW_WIDTH_AT_10GE
 
 #define TLAST       1
@@ -159,24 +169,35 @@ void pAxisRawCast(
 
 /*******************************************************************************
  * AXIS_RAW - RAW AXIS-4 STREAMING INTERFACE
- *  An AxisRaw is logically divided into 'ARW/8' bytes. The validity of a given
+ *  An AxisRaw is logically divided into 'W/8' bytes. The validity of a given
  *  byte is qualified by the 'tkeep' field, while the assertion of the 'tlast'
  *  bit indicates the end of a stream.
  *
+ *  The class is templated on the width 'W' of the datapath so that the same
+ *  byte-lane, swap and alignment logic can be generated for a 10GE (64-bit),
+ *  25GE (128-bit), 40GE (256-bit) or 100GE (512-bit) interface. The NTS stack
+ *  itself uses the 'AxisRaw' instantiation at 'ARW' (see below), from which the
+ *  protocol-specific classes (e.g. AxisEth, AxisIp4, AxisTcp) are derived.
+ *  So far, only the IP Transmitter Handler is templated end to end on 'W' (see
+ *  iptx()), while the protocol-specific classes and the other engines of the
+ *  NTS (IPRX, RXe, TXe, UOE) are still written for a 64-bit 'ARW'. Therefore,
+ *  the NTS cannot be built for 25GE, 40GE or 100GE yet.
+ *
  * @Warning: Members of this class are kept public for compatibility issues with
  *  the legacy code.
  *
  *******************************************************************************/
-class AxisRaw {
+template<int W>
+class AxisRawT {
 
   protected:
-    LE_tData    tdata;
-    LE_tKeep    tkeep;
-    LE_tLast    tlast;
+    ap_uint<W>      tdata;
+    ap_uint<W/8>    tkeep;
+    ap_uint<1>      tlast;
 
   public:
-    AxisRaw()       {}
-    AxisRaw(LE_tData tdata, LE_tKeep tkeep, LE_tLast tlast) :
+    AxisRawT()      {}
+    AxisRawT(ap_uint<W> tdata, ap_uint<W/8> tkeep, ap_uint<1> tlast) :
             tdata(tdata), tkeep(tkeep), tlast(tlast) {}
 
     /******************************************************
@@ -185,65 +206,46 @@ class AxisRaw {
 
     /* Get a range of the 'tdata' member in Big-Endian (BE) order
      *       +---------------+---------------+---------------+---------------+
-     * tdata |ARW-1                   (Little-Endian)                       0|
+     * tdata |W-1                     (Little-Endian)                       0|
      *       +---------------+---------------+---------------+---------------+
      */
-    tData getTData(int leHi=ARW-1, int leLo=0) const {
-        switch (leHi-leLo) {
-            case 64-1 : return byteSwap64(tdata.range(leHi, leLo)); break;
-            case 32-1 : return byteSwap32(tdata.range(leHi, leLo)); break;
-            case 16-1 : return byteSwap16(tdata.range(leHi, leLo)); break;
-            case  8-1 : return           (tdata.range(leHi, leLo)); break;
-            default : break;
+    ap_uint<W> getTData(int leHi=W-1, int leLo=0) const {
+        if (((leHi-leLo+1) % 8) != 0) {
+            std::cout << "ASSERT - AxisRaw::getTData() - Unsupported range.\n"; assert(false);
         }
-        std::cout << "ASSERT - AxisRaw::getTData() - Unsupported range.\n"; assert(false);
-        return tdata;
+        return byteSwap<W>(tdata.range(leHi, leLo), (leHi-leLo+1)/8);
     }
     /* Get a range of the 'tkeep' member in Big-Endian (BE) order
      *       +---------------+---------------+
-     * tkeep |ARW/8-1      (LE)             0|
+     * tkeep |W/8-1        (LE)             0|
      *       +---------------+---------------+
      */
-    tKeep getTKeep(int leHi=ARW/8-1, int leLo=0) const {
-        switch (leHi-leLo) {
-            case 8-1 : return bitSwap8(tkeep.range(leHi, leLo)); break;
-            case 4-1 : return bitSwap4(tkeep.range(leHi, leLo)); break;
-            case 2-1 : return bitSwap2(tkeep.range(leHi, leLo)); break;
-            case 1-1 : return         (tkeep[leLo]); break;
-            default : break;
-        }
-        std::cout << "ASSERT - AxisRaw::getTKeep() - Unsupported range.\n"; assert(false);
-        return tkeep;
+    ap_uint<W/8> getTKeep(int leHi=W/8-1, int leLo=0) const {
+        return bitSwap<W/8>(tkeep.range(leHi, leLo), (leHi-leLo+1));
     }
     // Get the 'tlast' member
-    tLast getTLast() const {
+    ap_uint<1> getTLast() const {
         return tlast;
     }
 
     /* Set the 'tdata' member from a parameter encoded in Big-Endian (BE) order
      *       +---------------+---------------+---------------+---------------+
-     * tdata |ARW-1                   (Little-Endian)                       0|
+     * tdata |W-1                     (Little-Endian)                       0|
      *       +---------------+---------------+---------------+---------------+
      */
-    void setTData(tData data) {
-        switch (ARW) {
-            case 64 : tdata = byteSwap64(data); break;
-            default : std::cout << "ASSERT - AxisRaw::setTData() - Unsupported Axis raw width.\n"; break;
-        }
+    void setTData(ap_uint<W> data) {
+        tdata = byteSwap<W>(data, W/8);
     }
     /* Set the 'tkeep' member from a parameter encoded in Big-Endian (BE) order
      *       +---------------+---------------+
-     * tkeep |ARW/8-1      (LE)             0|
+     * tkeep |W/8-1        (LE)             0|
      *       +---------------+---------------+
      */
-    void setTKeep(tKeep keep) {
-        switch (ARW) {
-            case 64 : tkeep = bitSwap8(keep); break;
-            default : std::cout << "ASSERT - AxisRaw::setTKeep() - Unsupported Axis raw width.\n"; break;
-        }
+    void setTKeep(ap_uint<W/8> keep) {
+        tkeep = bitSwap<W/8>(keep, W/8);
     }
     // Set the 'tlast' member
-    void setTLast(tLast last) {
+    void setTLast(ap_uint<1> last) {
         tlast = last;
         if (last) {  // [FIXME-Remove and create a 'setTLastAndClear()]
             // Always zero the bytes which have their tkeep-bit cleared.
@@ -257,27 +259,27 @@ class AxisRaw {
      * LITTLE-ENDIAN SETTERS AND GETTERS
      ******************************************************/
     // Return the 'tdata' field in Little-Endian order
-    LE_tData getLE_TData(int leHi=ARW-1, int leLo=0) const {
+    ap_uint<W> getLE_TData(int leHi=W-1, int leLo=0) const {
         return tdata.range(leHi, leLo);
     }
     // Get the 'tkeep' field with respect to the 'tdata' field encoded in Little-Endian order
-    LE_tKeep getLE_TKeep(int leHi=ARW/8-1, int leLo=0) const {
+    ap_uint<W/8> getLE_TKeep(int leHi=W/8-1, int leLo=0) const {
         return tkeep.range(leHi, leLo);
     }
     // Get the tlast bit
-    LE_tLast getLE_TLast() const {
+    ap_uint<1> getLE_TLast() const {
         return tlast;
     }
     // Set the 'tdata' field with a 'data' encoded in Little-Endian order
-    void setLE_TData(LE_tData data, int leHi=ARW-1, int leLo=0) {
+    void setLE_TData(ap_uint<W> data, int leHi=W-1, int leLo=0) {
         tdata.range(leHi, leLo) = data.range(leHi-leLo, 0);
     }
     // Set the 'tkeep' field with respect to the 'tdata' field encoded in Little-Endian order
-    void setLE_TKeep(LE_tKeep keep, int leHi=ARW/8-1, int leLo=0) {
+    void setLE_TKeep(ap_uint<W/8> keep, int leHi=W/8-1, int leLo=0) {
         tkeep.range(leHi, leLo) = keep;
     }
     // Set the tlast field
-    void setLE_TLast(LE_tLast last) {
+    void setLE_TLast(ap_uint<1> last) {
         tlast = last;
     }
 
@@ -287,101 +289,89 @@ class AxisRaw {
 
     /* Get higher-half part of member 'tdata' and return it in BE order
      *       +---------------+---------------+---------------+---------------+
-     * tdata |ARW-1     Lower-Half         (LE)        Higher-Half          0|
+     * tdata |W-1       Lower-Half         (LE)        Higher-Half          0|
      *       +---------------+---------------+---------------+---------------+
      */
-    tDataHalf getTDataHi() const {
-        return getTData(ARW/2-1, 0);
+    ap_uint<W/2> getTDataHi() const {
+        return getTData(W/2-1, 0);
     }
     /* Get lower-half part of member 'tdata' and return it in BE order
      *       +---------------+---------------+---------------+---------------+
-     * tdata |ARW-1     Lower-Half         (LE)        Higher-Half          0|
+     * tdata |W-1       Lower-Half         (LE)        Higher-Half          0|
      *       +---------------+---------------+---------------+---------------+
      */
-    tDataHalf getTDataLo() const {
-        return getTData(ARW-1, ARW/2);
+    ap_uint<W/2> getTDataLo() const {
+        return getTData(W-1, W/2);
     }
     /* Get higher-half part of member 'tkeep' and return it in BE order
      *       +----------------------+-------------------+
-     * tkeep |ARW/8-1  Lower-Half  (LE)   Higher-Half  0|
+     * tkeep |W/8-1    Lower-Half  (LE)   Higher-Half  0|
      *       +----------------------+-------------------+
      */
-    tKeepHalf getTKeepHi() const {
-        return getTKeep(ARW/8/2-1, 0);
+    ap_uint<W/16> getTKeepHi() const {
+        return getTKeep(W/8/2-1, 0);
     }
     /* Get lower-half part of member 'tkeep' and return it in BE order
       *       +----------------------+-------------------+
-      * tkeep |ARW/8-1  Lower-Half  (LE)   Higher-Half  0|
+      * tkeep |W/8-1    Lower-Half  (LE)   Higher-Half  0|
       *       +----------------------+-------------------+
       */
-    tKeepHalf getTKeepLo() const {
-        return getTKeep(ARW/8-1, ARW/8/2);
+    ap_uint<W/16> getTKeepLo() const {
+        return getTKeep(W/8-1, W/8/2);
     }
 
     /* Set higher-half part of 'tdata' from a parameter encoded in BE order
      *       +---------------+---------------+---------------+---------------+
-     * tdata |ARW-1     Lower-Half         (LE)        Higher-Half          0|
+     * tdata |W-1       Lower-Half         (LE)        Higher-Half          0|
      *       +---------------+---------------+---------------+---------------+
      */
-    void setTDataHi(tDataHalf halfData) {
-        switch (ARW) {
-            case 64 : tdata.range(ARW/2-1, 0) = byteSwap32(halfData); break;
-            default : std::cout << "ASSERT - AxisRaw::setTDataHi() - Unsupported Axis raw width.\n"; break;
-        }
+    void setTDataHi(ap_uint<W/2> halfData) {
+        tdata.range(W/2-1, 0) = byteSwap<W/2>(halfData, W/16);
     }
     /* Set lower-half part of 'tdata' from a parameter encoded in BE order
      *       +---------------+---------------+---------------+---------------+
-     * tdata |ARW-1     Lower-Half         (LE)        Higher-Half          0|
+     * tdata |W-1       Lower-Half         (LE)        Higher-Half          0|
      *       +---------------+---------------+---------------+---------------+
      */
-    void setTDataLo(tDataHalf halfData) {
-        switch (ARW) {
-            case 64 : tdata.range(ARW-1, ARW/2) = byteSwap32(halfData); break;
-            default : std::cout << "ASSERT - AxisRaw::setTDataLo() - Unsupported Axis raw width.\n"; break;
-        }
+    void setTDataLo(ap_uint<W/2> halfData) {
+        tdata.range(W-1, W/2) = byteSwap<W/2>(halfData, W/16);
     }
     /* Set higher-half part of 'tkeep' from a parameter encoded in BE order
      *       +----------------------+-------------------+
-     * tkeep |ARW/8-1  Lower-Half  (LE)   Higher-Half  0|
+     * tkeep |W/8-1    Lower-Half  (LE)   Higher-Half  0|
      *       +----------------------+-------------------+
      */
-    void setTKeepHi(tKeepHalf halfKeep) {
-        switch (ARW) {
-            case 64 : tkeep(ARW/8/2-1, 0) = bitSwap4(halfKeep); break;
-            default : std::cout << "ASSERT - AxisRaw::setTKeepHi() - Unsupported Axis raw width.\n"; break;
-        }
+    void setTKeepHi(ap_uint<W/16> halfKeep) {
+        tkeep(W/8/2-1, 0) = bitSwap<W/16>(halfKeep, W/16);
     }
     /* Set lower-half part of 'tkeep' from a parameter encoded in BE order
      *       +----------------------+-------------------+
-     * tkeep |ARW/8-1  Lower-Half  (LE)   Higher-Half  0|
+     * tkeep |W/8-1    Lower-Half  (LE)   Higher-Half  0|
      *       +----------------------+-------------------+
      */
-    void setTKeepLo(tKeepHalf halfKeep) {
-        switch (ARW) {
-            case 64 : tkeep(ARW/8-1, ARW/8/2) = bitSwap4(halfKeep); break;
-            default : std::cout << "ASSERT - AxisRaw::setTKeepLo() - Unsupported Axis raw width.\n"; break;
-        }
+    void setTKeepLo(ap_uint<W/16> halfKeep) {
+        tkeep(W/8-1, W/8/2) = bitSwap<W/16>(halfKeep, W/16);
     }
 
     /******************************************************
      * LITTLE-ENDIAN HELPERS
      ******************************************************/
-    // Get the 'tdata' field in Little-Endian order and return its upper-half part (.i.e data(31,0))
-    LE_tDataHalf getLE_TDataHi() const {
-        return getLE_TData().range(31, 0);  // [TODO]
+    // Get the 'tdata' field in Little-Endian order and return its upper-half part (.i.e data(W/2-1,0))
+    ap_uint<W/2> getLE_TDataHi() const {
+        return getLE_TData().range(W/2-1, 0);
     }
-    // Get the 'tdata' field in Little-Endian order and return its lower-half part (.i.e, data(63,32)
-    LE_tDataHalf getLE_TDataLo() const {
-        return getLE_TData().range(63, 32);  // [TODO]
+    // Get the 'tdata' field in Little-Endian order and return its lower-half part (.i.e, data(W-1,W/2)
+    ap_uint<W/2> getLE_TDataLo() const {
+        return getLE_TData().range(W-1, W/2);
     }
 
-    // Set the 'tdata' field with the upper-half part of a 'data' encoded in Little-Endian order (.i.e, data(31,0))
-    void setLE_TDataHi(LE_tData data) {
-        tdata.range(31, 0) = data.range(31, 0);  // [TODO]
+    // Set the 'tdata' field with the upper-half part of a 'data' encoded in Little-Endian order (.i.e, data(W/2-1,0))
+    void setLE_TDataHi(ap_uint<W> data) {
+        tdata.range(W/2-1, 0) = data.range(W/2-1, 0);
     }
-    // Set the 'tdata' field with the lower-half part of a 'data' encoded in Little-Endian order (.i.e, data(63,32))
-    void setLE_TDataLo(LE_tData data) {
-        tdata.range(63, 32) = data.range(63, 32);  // [TODO]
+    // Set the 'tdata' field with the lower-half part of a 'data' encoded in Little-Endian order (.i.e, data(W-1,W/2))
+    void setLE_TDataLo(ap_uint<W> data) {
+        tdata.range(W-1, W/2) = data.range(W-1, W/2);
     }
 
     /******************************************************
@@ -389,22 +379,11 @@ class AxisRaw {
      ******************************************************/
     // Zero the bytes which have their tkeep-bit cleared
     void clearUnusedBytes() {
-        //for (int i=0, leHi=ARW/8-1, leLo=0; i<ARW/8; i++) {  // ARW/8 = noBytes
-        //    #pragma HLS UNROLL factor=8
-        //    if (tkeep[i] == 0) {
-        //        tdata.range(leHi+8*i, leLo+8*i) = 0x00;
-        //    }
-        int leHi=ARW/8-1;
-        int leLo=0;
-        switch(this->tkeep){
-            case 0x00: tdata.range(leHi+8*0, leLo+8*0) = 0x00; // No break here
-            case 0x01: tdata.range(leHi+8*1, leLo+8*1) = 0x00; // No break here
-            case 0x03: tdata.range(leHi+8*2, leLo+8*2) = 0x00; // No break here
-            case 0x07: tdata.range(leHi+8*3, leLo+8*3) = 0x00; // No break here
-            case 0x0F: tdata.range(leHi+8*4, leLo+8*4) = 0x00; // No break here
-            case 0x1F: tdata.range(leHi+8*5, leLo+8*5) = 0x00; // No break here
-            case 0x3F: tdata.range(leHi+8*6, leLo+8*6) = 0x00; // No break here
-            case 0x7F: tdata.range(leHi+8*7, leLo+8*7) = 0x00; // No break here
+        for (int i=0; i<W/8; i++) {
+            #pragma HLS UNROLL
+            if (tkeep[i] == 0) {
+                tdata.range(8*i+7, 8*i) = 0x00;
+            }
         }
     }
     // Get the length of this chunk (in bytes)
@@ -413,8 +392,8 @@ class AxisRaw {
     }
     // Get the length of the higher-half part of this chunk (in bytes)
     int getLenHi() {
-        if (keepToLen() > ARW/8/2) {
-            return (ARW/8/2);
+        if (keepToLen() > W/8/2) {
+            return (W/8/2);
         }
         else {
             return keepToLen();
@@ -422,8 +401,8 @@ class AxisRaw {
     }
     // Get the length of the lower-half part of this chunk (in bytes)
     int getLenLo() {
-        if (keepToLen() > ARW/8/2) {
-             return (keepToLen()-ARW/8/2);
+        if (keepToLen() > W/8/2) {
+             return (keepToLen()-W/8/2);
          }
          else {
              return 0;
@@ -432,68 +411,115 @@ class AxisRaw {
 
     // Assess the consistency of 'tkeep' and 'tlast'
     bool isValid() const {
-        if (((tlast == 0) and (tkeep != 0xFF)) or
+        if (((tlast == 0) and (keepToLen() != W/8)) or
             ((tlast == 1) and (keepToLen() == 0))) {
             return false;
         }
         return true;
     }
-    // Overload = operator to direct assignment from an AxisRaw
-    // AxisApp& operator= (const AxisRaw& _axisRaw) {
-    //       this->tdata = _axisRaw.getLE_TData();
-    //       this->tkeep = _axisRaw.getLE_TKeep();
-    //       this->tlast = _axisRaw.getLE_TLast();
-    //       return *this;
-    // }
 
   protected:
-    // Return the number of valid bytes
+    // Return the number of valid bytes (or 0 if the 'tkeep' bits are not contiguous)
     int keepToLen() const {
-        switch(this->tkeep){
-            case 0x01: return 1; break;
-            case 0x03: return 2; break;
-            case 0x07: return 3; break;
-            case 0x0F: return 4; break;
-            case 0x1F: return 5; break;
-            case 0x3F: return 6; break;
-            case 0x7F: return 7; break;
-            case 0xFF: return 8; break;
+        int  len = 0;
+        bool gap = false;
+        for (int i=0; i<W/8; i++) {
+            #pragma HLS UNROLL
+            if (tkeep[i] == 1) {
+                if (len != i) {
+                    gap = true;
+                }
+                len = i+1;
+            }
         }
-        return 0;
+        return (gap) ? 0 : len;
     }
 
   private:
-    // Reverse the bits within a pair.
-    ap_uint<2> bitSwap2(ap_uint<2> inputVector) const {
-        return (inputVector.range(0,1));
-    }
-    // Reverse the bits within a nibble.
-    ap_uint<4> bitSwap4(ap_uint<4> inputVector) const {
-        return (inputVector.range(0,3));
-    }
-    // Reverse the bits within a byte.
-    ap_uint<8> bitSwap8(ap_uint<8> inputVector) const {
-        return (inputVector.range(0,7));
-    }
-    // Swap the two bytes of a word (.i.e, 16 bits).
-    ap_uint<16> byteSwap16(ap_uint<16> inputVector) const {
-        return (inputVector.range(7,0), inputVector(15, 8));
-    }
-    // Swap the four bytes of a double-word (.i.e, 32 bits).
-    ap_uint<32> byteSwap32(ap_uint<32> inpDWord) const {
-        return (inpDWord.range( 7, 0), inpDWord.range(15,  8),
-                inpDWord.range(23,16), inpDWord.range(31, 24));
-    }
-    // Swap the eight bytes of a quad-word (.i.e, 64 bits).
-    ap_uint<64> byteSwap64(ap_uint<64> inpQWord) const {
-        return (inpQWord.range( 7, 0), inpQWord(15,  8),
-                inpQWord.range(23,16), inpQWord(31, 24),
-                inpQWord.range(39,32), inpQWord(47, 40),
-                inpQWord.range(55,48), inpQWord(63, 56));
+    // Reverse the order of the 'noBits' lower bits of a vector.
+    template<int N>
+    static ap_uint<N> bitSwap(ap_uint<N> inpVec, int noBits) {
+        ap_uint<N> outVec = 0;
+        for (int i=0; i<N; i++) {
+            #pragma HLS UNROLL
+            if (i < noBits) {
+                outVec[i] = inpVec[noBits-1-i];
+            }
+        }
+        return outVec;
+    }
+    // Reverse the order of the 'noBytes' lower bytes of a vector.
+    template<int N>
+    static ap_uint<N> byteSwap(ap_uint<N> inpVec, int noBytes) {
+        ap_uint<N> outVec = 0;
+        for (int i=0; i<N/8; i++) {
+            #pragma HLS UNROLL
+            if (i < noBytes) {
+                outVec.range(8*i+7, 8*i) = inpVec.range(8*(noBytes-1-i)+7, 8*(noBytes-1-i));
+            }
+        }
+        return outVec;
     }
 
 };
 
+/*******************************************************************************
+ * AXIS_RAW - THE NTS DATAPATH
+ *  The NTS is currently instantiated for the 10GE datapath width (.i.e ARW).
+ *******************************************************************************/
+typedef AxisRawT<ARW>   AxisRaw;
+
+/*******************************************************************************
+ * AXIS_RAW - WIDTH-GENERIC ALIGNMENT HELPERS
+ *  These functions implement the byte-lane realignment that is required when
+ *  a header of 'OFF' bytes is stripped from (or prepended to) a stream whose
+ *  length is not a multiple of the datapath width. Because the offset is a
+ *  template parameter, the resulting shifter is a set of fixed wires for any
+ *  datapath width.
+ *******************************************************************************/
+
+/*******************************************************************************
+ * @brief Join the upper bytes of a previous chunk with the lower bytes of the
+ *   current chunk.
+ *
+ * @param[in] prevChunk  The previous chunk (its bytes [OFF:W/8-1] are forwarded).
+ * @param[in] currChunk  The current chunk (its bytes [0:OFF-1] are appended).
+ *
+ * @return a chunk made of 'prevChunk[OFF:W/8-1]' followed by 'currChunk[0:OFF-1]'.
+ *   The 'tlast' bit is set when 'currChunk' is the last chunk of a stream and
+ *   does not have any byte left above 'OFF'.
+ *******************************************************************************/
+template<int OFF, int W>
+AxisRawT<W> axisRawJoin(const AxisRawT<W> &prevChunk, const AxisRawT<W> &currChunk)
+{
+    #pragma HLS INLINE
+    AxisRawT<W> joinChunk;
+    joinChunk.setLE_TData(prevChunk.getLE_TData(W-1, 8*OFF), W-8*OFF-1, 0);
+    joinChunk.setLE_TKeep(prevChunk.getLE_TKeep(W/8-1, OFF), W/8-OFF-1, 0);
+    joinChunk.setLE_TData(currChunk.getLE_TData(8*OFF-1, 0), W-1, W-8*OFF);
+    joinChunk.setLE_TKeep(currChunk.getLE_TKeep(OFF-1,   0), W/8-1, W/8-OFF);
+    joinChunk.setLE_TLast(currChunk.getLE_TLast() and (currChunk.getLE_TKeep()[OFF] == 0));
+    return joinChunk;
+}
+
+/*******************************************************************************
+ * @brief Flush the upper bytes of a last chunk which did not fit into the
+ *   previous joined chunk (see axisRawJoin).
+ *
+ * @param[in] prevChunk  The last chunk of a stream.
+ *
+ * @return a last chunk made of 'prevChunk[OFF:W/8-1]'.
+ *******************************************************************************/
+template<int OFF, int W>
+AxisRawT<W> axisRawTail(const AxisRawT<W> &prevChunk)
+{
+    #pragma HLS INLINE
+    AxisRawT<W> tailChunk(0, 0, TLAST);
+    tailChunk.setLE_TData(prevChunk.getLE_TData(W-1, 8*OFF), W-8*OFF-1, 0);
+    tailChunk.setLE_TKeep(prevChunk.getLE_TKeep(W/8-1, OFF), W/8-OFF-1, 0);
+    return tailChunk;
+}
+
 #endif
 
 /*! \} */
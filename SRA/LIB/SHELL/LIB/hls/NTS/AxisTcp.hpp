@@ -117,6 +117,7 @@ typedef ap_uint<16> TcpUrgPtr;      // TCP Urgent Pointer
 typedef ap_uint< 8> TcpOptKind;     // TCP Option Kind
 typedef ap_uint< 8> TcpOptLen ;     // TCP Option Length
 typedef ap_uint<16> TcpOptMss;      // TCP Option Maximum Segment Size
+typedef ap_uint< 4> TcpOptWss;      // TCP Option Window Size Shift (max. is 14)
 
 typedef ap_uint<16> TcpSegLen;      // TCP Segment Length in octets (Header+Data)
 typedef ap_uint< 8> TcpHdrLen;      // TCP Header  Length in octets
@@ -129,6 +130,7 @@ typedef ap_uint<16> TcpDatLen;      // TCP Data    Length in octets (same as Tcp
 #define TCP_OPT_KIND_MSS    2      // Maximum Segment Size
 #define TCP_OPT_KIND_WSS    3      // Window Size Shift
 #define TCP_OPT_KIND_SACK   4      // Selective ACKnowledgment permitted
+#define TCP_OPT_KIND_SBLK   5      // Selective ACKnowledgment blocks
 
 /*********************************************************
  * TCP Data over AXI4-STREAM
@@ -393,6 +393,8 @@ class SimIp4Packet {
     TcpCtrlBit getTcpControlAck()                    { return pktQ[4].getTcpCtrlAck();       }
     void       setTcpControlUrg(int bit)             {        pktQ[4].setTcpCtrlUrg(bit);    }
     TcpCtrlBit getTcpControlUrg()                    { return pktQ[4].getTcpCtrlUrg();       }
+    void       setTcpControlEce(int bit)             {        pktQ[4].setTcpCtrlEce(bit);    }
+    TcpCtrlBit getTcpControlEce()                    { return pktQ[4].getTcpCtrlEce();       }
     // Set-Get the TCP Window field
     void setTcpWindow(int win)                       {        pktQ[4].setTcpWindow(win);     }
     int  getTcpWindow()                              { return pktQ[4].getTcpWindow();        }
@@ -405,8 +407,20 @@ class SimIp4Packet {
     // Set-Get the TCP Option fields
     void setTcpOptionKind(int val)                   {        pktQ[5].setTcpOptKind(val);    }
     int  getTcpOptionKind()                          { return pktQ[5].getTcpOptKind();       }
+    void setTcpOptionLen(int val)                    {        pktQ[5].setTcpOptLen(val);     }
+    int  getTcpOptionLen()                           { return pktQ[5].getTcpOptLen();        }
     void setTcpOptionMss(int val)                    {        pktQ[5].setTcpOptMss(val);     }
     int  getTcpOptionMss()                           { return pktQ[5].getTcpOptMss();        }
+    void setTcpOptionWss(int val)                    {        pktQ[5].setTcpOptWss(val);     }
+    int  getTcpOptionWss()                           { return pktQ[5].getTcpOptWss();        }
+    // Set a SACK option with 'nBlocks' {left, right} edges (.i.e, [ NOP | NOP | 5 | Len | L0 | R0 | ... ])
+    void setTcpOptionSack(int nBlocks, const TcpSeqNum left[], const TcpSeqNum right[]) {
+        pktQ[5].setTcpOptSackHdr(nBlocks);
+        for (int i=0; i<nBlocks; i++) {
+            pktQ[5+i].setTcpOptSackEdge(left[i],  32);
+            pktQ[6+i].setTcpOptSackEdge(right[i],  0);
+        }
+    }
     // Additional Debug and Utilities Procedures
 
     //*********************************************************
@@ -1052,6 +1066,18 @@ class SimIp4Packet {
     // [TODO]-Return the IP4 data payload as a TcpSegment
     //  [TODO] TcpSegment getTcpSegment() {}
 
+    /**************************************************************************
+     * @brief Set a byte of the TCP data of the current IPv4 packet.
+     * @param[in] off   The offset of the byte within the TCP data.
+     * @param[in] byte  The value of the byte.
+     **************************************************************************/
+    void setTcpDataByte(int off, ap_uint<8> byte) {
+        int bytCnt = (4 * this->getIpInternetHeaderLength()) +
+                     (4 * this->getTcpDataOffset()) + off;
+        int bytNum = bytCnt % 8;
+        this->pktQ[bytCnt/8].setLE_TData(byte, (bytNum*8)+7, (bytNum*8)+0);
+    }
+
     /**************************************************************************
      * @brief Get TCP data from the current IPv4 packet.
      * @returns a string.
@@ -1082,6 +1108,39 @@ class SimIp4Packet {
         return tcpDataStr;
     }
 
+    /**************************************************************************
+     * @brief Search the TCP options of the current IPv4 packet.
+     * @param[in] kind  The kind of the option to look for.
+     * @returns the byte offset of the option within the packet, or -1 if the
+     *  option is not present.
+     **************************************************************************/
+    int getTcpOptionOffset(int kind) {
+        int ip4DataOffset = (4 * this->getIpInternetHeaderLength());
+        int optOffset     = ip4DataOffset + TCP_HEADER_LEN;
+        int optEnd        = ip4DataOffset + (4 * this->getTcpDataOffset());
+        while (optOffset < optEnd) {
+            int optKind = this->pktQ[optOffset/8].getLE_TData().range((optOffset%8)*8+7, (optOffset%8)*8);
+            if (optKind == kind) {
+                return optOffset;
+            }
+            else if (optKind == TCP_OPT_KIND_EOL) {
+                break;
+            }
+            else if (optKind == TCP_OPT_KIND_NOP) {
+                optOffset += 1;
+            }
+            else {
+                int lenOffset = optOffset + 1;
+                int optLen    = this->pktQ[lenOffset/8].getLE_TData().range((lenOffset%8)*8+7, (lenOffset%8)*8);
+                if (optLen < 2) {
+                    break;
+                }
+                optOffset += optLen;
+            }
+        }
+        return -1;
+    }
+
     /**************************************************************************
      * @brief Returns true if packet is a FIN.
      **************************************************************************/
@@ -1290,7 +1349,7 @@ class SimIp4Packet {
                 this->getTcpChecksum(),      leTcpCSum.to_uint());
         printInfo(callerName, "TCP Urgent Pointer      = %15u (0x%4.4X) \n",
                 this->getTcpUrgentPointer(), leTcpUrgPtr.to_uint());
-        if (this->getTcpDataOffset() == 6) {
+        if (this->getTcpDataOffset() >= 6) {
             printInfo(callerName, "TCP Option:\n");
             switch (this->getTcpOptionKind()) {
             case 0x02:
@@ -1298,6 +1357,13 @@ class SimIp4Packet {
                           this->getTcpOptionMss());
             }
         }
+        if (this->getTcpOptionOffset(TCP_OPT_KIND_WSS) != -1) {
+            printInfo(callerName, "   Window Scale Shift   = %15u \n",
+                      this->getTcpOptionWss());
+        }
+        if (this->getTcpOptionOffset(TCP_OPT_KIND_SACK) != -1) {
+            printInfo(callerName, "   SACK Permitted \n");
+        }
         printInfo(callerName, "TCP Data Length         = %15u \n",
                   this->sizeOfTcpData());
     }
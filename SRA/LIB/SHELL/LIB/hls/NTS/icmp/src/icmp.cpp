@@ -164,8 +164,7 @@ void pIcmpChecksumChecker(
             icc_subSums[0] = (icc_subSums[0] + (icc_subSums[0] >> 16)) & 0xFFFF;
             icc_subSums[1] += icc_subSums[3];
             icc_subSums[1] = (icc_subSums[1] + (icc_subSums[1] >> 16)) & 0xFFFF;
-            //-- [RFC-1624] -->  HC' = ~(~HC + ~m + m')
-            icc_newHCsum = ~icc_oldHCsum & 0xFFFF;
+            icc_newHCsum = icc_oldHCsum;
             icc_csumState = S1;
             break;
         case S1:
@@ -173,16 +172,13 @@ void pIcmpChecksumChecker(
             icc_subSums[0] = (icc_subSums[0] + (icc_subSums[0] >> 16)) & 0xFFFF;
             if ((icc_icmpType == ICMP_ECHO_REQUEST) && (icc_icmpCode == 0)) {
                 // Message is a PING -> Perform incremental update of chechsum
-                //-- [RFC-1624] -->  HC' = ~(~HC + ~m + m')
-                icc_newHCsum = icc_newHCsum + (~0x0800 & 0xFFFF) + 0x0000;
-                icc_newHCsum = (icc_newHCsum + (icc_newHCsum >> 16)) & 0xFFFF;
+                //  (the Type/Code word goes from ECHO-REQUEST to ECHO-REPLY)
+                icc_newHCsum = csumIncrUpdate(icc_oldHCsum, 0x0800, 0x0000);
             }
             icc_csumState = S2;
             break;
         case S2:
             icc_subSums[0] = ~icc_subSums[0];
-            //-- [RFC-1624] -->  HC' = ~(~HC + ~m + m')
-            icc_newHCsum = ~icc_newHCsum & 0xFFFF;
             icc_csumState = S3;
             break;
         case S3:
@@ -53,6 +53,14 @@ set hlsCSynth    $::env(hlsCSynth)
 set hlsCoSim     $::env(hlsCoSim)
 set hlsRtl       $::env(hlsRtl)
 
+# Retrieve the testbench of an optional benchmark from ENV (defaults to none)
+#-------------------------------------------------
+if { [info exists ::env(iptxBench)] } {
+    set iptxBench $::env(iptxBench)
+} else {
+    set iptxBench ""
+}
+
 # Set Project Environment Variables  
 #-------------------------------------------------
 set currDir      [pwd]
@@ -81,7 +89,11 @@ open_project  ${projectName}_prj
 add_files     ${srcDir}/${projectName}.cpp -cflags "-DHLS_VERSION=${HLS_VERSION}"
 add_files     ${currDir}/../../NTS/nts_utils.cpp
 
-add_files -tb ${testDir}/test_${projectName}.cpp -cflags "-DHLS_VERSION=${HLS_VERSION}"
+if { ${iptxBench} != "" } {
+    add_files -tb ${currDir}/${iptxBench} -cflags "-DHLS_VERSION=${HLS_VERSION}"
+} else {
+    add_files -tb ${testDir}/test_${projectName}.cpp -cflags "-DHLS_VERSION=${HLS_VERSION}"
+}
 add_files -tb ${currDir}/../../NTS/SimNtsUtils.cpp
 
 # Set toplevel
@@ -155,6 +167,15 @@ if { $hlsCSim} {
     puts "####          SUCCESSFUL END OF COMPILATION              ####"
     puts "####                                                     ####"
     puts "#############################################################"
+    if { ${iptxBench} != "" } {
+        csim_design
+        puts "#############################################################"
+        puts "####                                                     ####"
+        puts "####          SUCCESSFUL END OF C SIMULATION             ####"
+        puts "####                                                     ####"
+        puts "#############################################################"
+        exit
+    }
     csim_design -argv "../../../../test/testVectors/siTOE_OnePkt.dat"
     csim_design -argv "../../../../test/testVectors/siTOE_ThreePkt.dat"
     csim_design -argv "../../../../test/testVectors/siTOE_TwentySixPkt.dat"
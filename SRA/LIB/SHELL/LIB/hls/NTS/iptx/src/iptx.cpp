@@ -87,11 +87,16 @@ using namespace hls;
  * @details
  *  This process computes the IPv4 header checksum and forwards it to the
  *  next process which will insert it into the header of the incoming packet.
+ *  The process is templated on the width 'W' of the datapath. Every chunk is
+ *  masked down to the bytes of the IPv4 header (minus the checksum field) and
+ *  summed with the adder tree of 'csumChunk()'. The checksum is forwarded with
+ *  the chunk which holds the last byte of the header (i.e. IHL*4 bytes).
  *
  * @Warning
- *  The IP header is formatted for transmission over a 64-bits interface which
- *  is logically divided into 8 lanes, with lane[0]=bits(7:0) and
- *  lane[7]=bits(63:56). The format of the incoming IPv4 header is then:
+ *  The IP header is formatted for transmission over a 'W'-bits interface which
+ *  is logically divided into W/8 lanes, with lane[0]=bits(7:0). Byte 'n' of
+ *  the packet is therefore found in lane[n%(W/8)] of chunk[n/(W/8)]. Over a
+ *  64-bits interface, the format of the incoming IPv4 header is:
  *
  *         6                   5                   4                   3                   2                   1                   0
  *   3 2 1 0 9 8 7 6 5 4 3 2 1 0 9 8 7 6 5 4 3 2 1 0 9 8 7 6 5 4 3 2 1 0 9 8 7 6 5 4 3 2 1 0 9 8 7 6 5 4 3 2 1 0 9 8 7 6 5 4 3 2 1 0
@@ -104,10 +109,11 @@ using namespace hls;
  *  +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
  *
  *******************************************************************************/
+template<int W>
 void pHeaderChecksumAccumulator(
-        stream<AxisIp4>     &siL3MUX_Data,
-        stream<AxisIp4>     &soICi_Data,
-        stream<Ip4HdrCsum>  &soICi_Csum)
+        stream<AxisRawT<W> > &siL3MUX_Data,
+        stream<AxisRawT<W> > &soICi_Data,
+        stream<Ip4HdrCsum>   &soICi_Csum)
 {
     //-- DIRECTIVES FOR THIS PROCESS ------------------------------------------
     #pragma HLS INLINE off
@@ -116,127 +122,52 @@ void pHeaderChecksumAccumulator(
     const char *myName  = concat3(THIS_NAME, "/", "HCa");
 
     //-- STATIC CONTROL VARIABLES (with RESET) --------------------------------
-    static bool                             hca_csumWritten=true;
-    #pragma HLS RESET              variable=hca_csumWritten
-    static enum FsmState {S0=0, S1, S2, S3} hca_fsmState=S0;
-    #pragma HLS RESET              variable=hca_fsmState
-    static ap_uint<17>                      hca_ipHdrCsum[4]={0, 0, 0, 0};
-    #pragma HLS RESET              variable=hca_ipHdrCsum
-    #pragma HLS ARRAY_PARTITION    variable=hca_ipHdrCsum complete dim=1
-    static ap_uint<3>                       hca_chunkCount=0;
+    static ap_uint<4>                       hca_chunkCount=0;
     #pragma HLS RESET              variable=hca_chunkCount
+    static CsumAcc                          hca_csumAcc=0;
+    #pragma HLS RESET              variable=hca_csumAcc
 
     //-- STATIC DATAFLOW VARIABLES --------------------------------------------
-    static ap_uint<4>                       hca_ipHdrLen;
+    static ap_uint<6>                       hca_ipHdrBytes;
 
     //-- DYNAMIC VARIABLES ----------------------------------------------------
-    AxisIp4     currChunk;
-    Ip4HdrCsum  tempHdrCsum;
-
-    currChunk.setLE_TLast(0);
-    if(!hca_csumWritten) {
-        switch (hca_fsmState) {
-        case S0:
-            hca_ipHdrCsum[0] += hca_ipHdrCsum[2];
-            hca_ipHdrCsum[1] += hca_ipHdrCsum[3];
-            hca_ipHdrCsum[0] = (hca_ipHdrCsum[0] + (hca_ipHdrCsum[0] >> 16)) & 0xFFFF;
-            hca_ipHdrCsum[1] = (hca_ipHdrCsum[1] + (hca_ipHdrCsum[1] >> 16)) & 0xFFFF;
-            hca_fsmState = S1;
-            break;
-        case S1:
-            hca_ipHdrCsum[0] += hca_ipHdrCsum[1];
-            hca_ipHdrCsum[0] = (hca_ipHdrCsum[0] + (hca_ipHdrCsum[0] >> 16)) & 0xFFFF;
-            hca_fsmState = S2;
-            break;
-        case S2:
-            hca_ipHdrCsum[0] = ~hca_ipHdrCsum[0];
-            soICi_Csum.write(hca_ipHdrCsum[0](15, 0));
-            hca_fsmState = S3;
-            break;
-        case S3:
-            hca_ipHdrCsum[0] = 0;
-            hca_ipHdrCsum[1] = 0;
-            hca_ipHdrCsum[2] = 0;
-            hca_ipHdrCsum[3] = 0;
-            hca_csumWritten = true;
-            hca_fsmState = S0;
-            break;
-        }
-    }
-    else if (!siL3MUX_Data.empty() and !soICi_Data.full() and hca_csumWritten) {
+    AxisRawT<W>  currChunk;
+    AxisRawT<W>  hdrChunk;
+    ap_uint<6>   ipHdrBytes;
+    int          chunkOff;
+
+    if (!siL3MUX_Data.empty() and !soICi_Data.full()) {
         siL3MUX_Data.read(currChunk);
-        // Process the IPv4 header.
-        //  Remember that the Internet Header Length (IHL) field contains the
+        // Remember that the Internet Header Length (IHL) field contains the
         //  size of the IPv4 header specified in number of 32-bit words, and
         //  its default minimum value is 5.
-        switch (hca_chunkCount) {
-        case 0:
-            hca_ipHdrLen = currChunk.getIp4HdrLen();
-            //-- Accumulate 1st IPv4 header qword [Frag|Ident|TotLen|ToS|IHL]
-            for (int i=0; i<4; i++) {
-              #pragma HLS UNROLL
-                tempHdrCsum( 7, 0) = currChunk.getLE_TData().range(i*16+15, i*16+8);
-                tempHdrCsum(15, 8) = currChunk.getLE_TData().range(i*16+7,  i*16);
-                hca_ipHdrCsum[i]  += tempHdrCsum;
-                hca_ipHdrCsum[i]   = (hca_ipHdrCsum[i] + (hca_ipHdrCsum[i] >> 16)) & 0xFFFF;
-            }
-            hca_chunkCount++;
-            hca_ipHdrLen -= 2;
-            break;
-        case 1:
-            //-- Accumulate 2nd IPv4 header qword [SA|HdCsum|Prot|TTL]
-            for (int i=0; i<4; i++) {
-              #pragma HLS UNROLL
-                if (i != 1) {
-                    // Skip 3rd and 4th bytes. They contain the IP header checksum.
-                    tempHdrCsum( 7, 0) = currChunk.getLE_TData().range(i*16+15, i*16+8);
-                    tempHdrCsum(15, 8) = currChunk.getLE_TData().range(i*16+7,  i*16);
-                    hca_ipHdrCsum[i]  += tempHdrCsum;
-                    hca_ipHdrCsum[i]  = (hca_ipHdrCsum[i] + (hca_ipHdrCsum[i] >> 16)) & 0xFFFF;
-                }
+        ipHdrBytes = (hca_chunkCount == 0) ? (ap_uint<6>)(currChunk.getLE_TData(3, 0) << 2) : hca_ipHdrBytes;
+        chunkOff   = hca_chunkCount * (W/8);
+        //-- Keep the bytes of the IPv4 header, except for its checksum field
+        hdrChunk = currChunk;
+        for (int lane=0; lane<W/8; lane++) {
+          #pragma HLS UNROLL
+            int byteOff = chunkOff + lane;
+            if ((byteOff >= ipHdrBytes) or (byteOff == 10) or (byteOff == 11)) {
+                hdrChunk.setLE_TKeep(0, lane, lane);
             }
-            hca_chunkCount++;
-            hca_ipHdrLen -= 2;
-            break;
-        default:
-            switch (hca_ipHdrLen) {
-            case 0:
-                //-- We are done with the checksum header processing
-                break;
-            case 1:
-                //-- Accumulate half of the 3rd IPv4 header qword [DA] or
-                //-- Accumulate the last IPv4 option dword
-                for (int i = 0; i < 2; i++) {
-                  #pragma HLS UNROLL
-                    tempHdrCsum( 7, 0) = currChunk.getLE_TData().range(i*16+15, i*16+8);
-                    tempHdrCsum(15, 8) = currChunk.getLE_TData().range(i*16+7,  i*16);
-                    hca_ipHdrCsum[i]  += tempHdrCsum;
-                    hca_ipHdrCsum[i]   = (hca_ipHdrCsum[i] + (hca_ipHdrCsum[i] >> 16)) & 0xFFFF;
-                }
-                hca_ipHdrLen = 0;
-                hca_csumWritten = false;
-                break;
-            default:
-                // Sum up everything
-                for (int i = 0; i < 4; i++) {
-                  #pragma HLS UNROLL
-                    tempHdrCsum( 7, 0) = currChunk.getLE_TData().range(i*16+15, i*16+8);
-                    tempHdrCsum(15, 8) = currChunk.getLE_TData().range(i*16+7,  i*16);
-                    hca_ipHdrCsum[i] += tempHdrCsum;
-                    hca_ipHdrCsum[i] = (hca_ipHdrCsum[i] + (hca_ipHdrCsum[i] >> 16)) & 0xFFFF;
-                }
-                hca_ipHdrLen -= 2;
-                if (hca_ipHdrLen == 0) {
-                    hca_csumWritten = false;
-                }
-                break;
-            } // End-of: switch ipHeaderLen
-            break;
-        } // End-of: switch(hca_chunkCount)
+        }
+        CsumAcc csumAcc = hca_csumAcc + csumChunk(hdrChunk);
+        if ((chunkOff < ipHdrBytes) and (chunkOff + W/8 >= ipHdrBytes)) {
+            //-- This chunk holds the last byte of the header
+            soICi_Csum.write(~csumFold(csumAcc));
+            csumAcc = 0;
+        }
         soICi_Data.write(currChunk);
         if (currChunk.getLE_TLast()) {
             hca_chunkCount = 0;
+            csumAcc = 0;
+        }
+        else if (hca_chunkCount != 15) {
+            hca_chunkCount++;
         }
+        hca_csumAcc    = csumAcc;
+        hca_ipHdrBytes = ipHdrBytes;
     }
 }
 
@@ -249,13 +180,15 @@ void pHeaderChecksumAccumulator(
  *
  * @details
  *  This process inserts the computed IP header checksum in the IPv4 packet
- *  being streamed on the data interface.
+ *  being streamed on the data interface. The checksum field (i.e. bytes 10
+ *  and 11 of the header) always fits into a single chunk of the datapath.
  *
  *******************************************************************************/
+template<int W>
 void pIpChecksumInsert(
-        stream<AxisIp4>     &siHCa_Data,
-        stream<Ip4HdrCsum>  &siHCa_Csum,
-        stream<AxisIp4>     &soIAe_Data)
+        stream<AxisRawT<W> > &siHCa_Data,
+        stream<Ip4HdrCsum>   &siHCa_Csum,
+        stream<AxisRawT<W> > &soIAe_Data)
 {
     //-- DIRECTIVES FOR THIS PROCESS -------------------------------------------
     #pragma HLS INLINE off
@@ -263,43 +196,34 @@ void pIpChecksumInsert(
 
     const char *myName  = concat3(THIS_NAME, "/", "ICi");
 
+    //-- LOCAL CONSTANTS -------------------------------------------------------
+    const int cCsumChunk = 10 / (W/8);
+    const int cCsumLane  = 10 % (W/8);
+
     //-- STATIC CONTROL VARIABLES (with RESET) ---------------------------------
-    static enum FsmStates { S0=0, S1, S2 } ici_fsmState=S0;
-    #pragma HLS RESET             variable=ici_fsmState
+    static ap_uint<2>          ici_chunkCount=0;
+    #pragma HLS RESET variable=ici_chunkCount
 
     //-- DYNAMIC VARIABLES -----------------------------------------------------
-    AxisIp4     currChunk;
+    AxisRawT<W> currChunk;
     Ip4HdrCsum  ipHdrChecksum;
 
-    currChunk.setLE_TLast(0);
-    switch (ici_fsmState) {
-    case S0:
-        if (!siHCa_Data.empty() and !soIAe_Data.full()) {
-            siHCa_Data.read(currChunk);
-            soIAe_Data.write(currChunk);
-            ici_fsmState = S1;
-        }
-        break;
-    case S1:
-        if (!siHCa_Data.empty() and !siHCa_Csum.empty() and !soIAe_Data.full()) {
-            siHCa_Data.read(currChunk);
-            siHCa_Csum.read(ipHdrChecksum);
+    if (!siHCa_Data.empty() and !soIAe_Data.full() and
+        ((ici_chunkCount != cCsumChunk) or !siHCa_Csum.empty())) {
+        siHCa_Data.read(currChunk);
+        if (ici_chunkCount == cCsumChunk) {
             // Insert the computed ipHeaderChecksum in the incoming stream
-            currChunk.setIp4HdrCsum(ipHdrChecksum);
-            soIAe_Data.write(currChunk);
-            ici_fsmState = S2;
+            siHCa_Csum.read(ipHdrChecksum);
+            currChunk.setLE_TData(ipHdrChecksum(15, 8), 8*cCsumLane+ 7, 8*cCsumLane  );
+            currChunk.setLE_TData(ipHdrChecksum( 7, 0), 8*cCsumLane+15, 8*cCsumLane+8);
         }
-        break;
-    default:
-        if (!siHCa_Data.empty() and !soIAe_Data.full()) {
-            siHCa_Data.read(currChunk);
-            soIAe_Data.write(currChunk);
+        soIAe_Data.write(currChunk);
+        if (currChunk.getLE_TLast()) {
+            ici_chunkCount = 0;
+        }
+        else if (ici_chunkCount <= cCsumChunk) {
+            ici_chunkCount++;
         }
-        break;
-    } // End-of: switch()
-
-    if (currChunk.getLE_TLast()) {
-        ici_fsmState = S0;
     }
 }
 
@@ -315,14 +239,16 @@ void pIpChecksumInsert(
  * @details
  *  This process extracts the IP destination address from the incoming stream
  *  and forwards it to the Address Resolution Protocol server (ARP) in order to
- *  look up the corresponding MAC address.
+ *  look up the corresponding MAC address. The destination address (i.e. bytes
+ *  16 to 19 of the header) always fits into a single chunk of the datapath.
  *******************************************************************************/
+template<int W>
 void pIp4AddressExtractor(
-        Ip4Addr              piMMIO_SubNetMask,
-        Ip4Addr              piMMIO_GatewayAddr,
-        stream<AxisIp4>     &siICi_Data,
-        stream<AxisIp4>     &soMAi_Data,
-        stream<Ip4Addr>     &soARP_LookupReq)
+        Ip4Addr               piMMIO_SubNetMask,
+        Ip4Addr               piMMIO_GatewayAddr,
+        stream<AxisRawT<W> > &siICi_Data,
+        stream<AxisRawT<W> > &soMAi_Data,
+        stream<Ip4Addr>      &soARP_LookupReq)
 {
     //-- DIRECTIVES FOR THIS PROCESS -------------------------------------------
     #pragma HLS INLINE off
@@ -330,6 +256,10 @@ void pIp4AddressExtractor(
 
     const char *myName  = concat3(THIS_NAME, "/", "IAe");
 
+    //-- LOCAL CONSTANTS -------------------------------------------------------
+    const int cDaChunk = 16 / (W/8);
+    const int cDaLane  = 16 % (W/8);
+
     //-- STATIC CONTROL VARIABLES (with RESET) ---------------------------------
     static ap_uint<2>          iae_chunkCount=0;
     #pragma HLS RESET variable=iae_chunkCount
@@ -338,10 +268,10 @@ void pIp4AddressExtractor(
     Ip4Addr ipDestAddr;
 
     if (!siICi_Data.empty() and !soMAi_Data.full()) {
-        AxisIp4 currChunk = siICi_Data.read();
-        switch (iae_chunkCount) {
-        case 2:  // Extract destination IP address
-            ipDestAddr = currChunk.getIp4DstAddr();
+        AxisRawT<W> currChunk = siICi_Data.read();
+        if (iae_chunkCount == cDaChunk) {
+            // Extract destination IP address
+            ipDestAddr = byteSwap32(currChunk.getLE_TData(8*cDaLane+31, 8*cDaLane));
             if ((ipDestAddr & piMMIO_SubNetMask) == (piMMIO_GatewayAddr & piMMIO_SubNetMask)
               || (ipDestAddr == 0xFFFFFFFF)) {
                 soARP_LookupReq.write(ipDestAddr);
@@ -349,17 +279,13 @@ void pIp4AddressExtractor(
             else {
                 soARP_LookupReq.write(piMMIO_GatewayAddr);
             }
+        }
+        if (currChunk.getLE_TLast()) {
+            iae_chunkCount = 0;
+        }
+        else if (iae_chunkCount <= cDaChunk) {
             iae_chunkCount++;
-            break;
-        default:
-            if (currChunk.getLE_TLast()) {
-                iae_chunkCount = 0;
-            }
-            else if (iae_chunkCount < 3) {
-                iae_chunkCount++;
-            }
-            break;
-        } // End-of: switch()
+        }
         soMAi_Data.write(currChunk);
     }
 }
@@ -374,13 +300,17 @@ void pIp4AddressExtractor(
  *
  * @details
  *  This process prepends the appropriate Ethernet header to the outgoing IPv4
- *  packet.
+ *  packet. The 14 bytes of the header are followed by the bytes of the packet,
+ *  which are realigned with 'axisRawJoin()' for the width 'W' of the datapath.
+ *  Over a 64-bits interface, the first 8 bytes of the header make a chunk of
+ *  their own.
  *******************************************************************************/
+template<int W>
 void pMacAddressInserter(
         EthAddr                  piMMIO_MacAddress,
-        stream<AxisIp4>         &siIAe_Data,
+        stream<AxisRawT<W> >    &siIAe_Data,
         stream<ArpLkpReply>     &siARP_LookupRsp,
-        stream<AxisEth>         &soL2MUX_Data)
+        stream<AxisRawT<W> >    &soL2MUX_Data)
 {
     //-- DIRECTIVES FOR THIS PROCESS -------------------------------------------
     #pragma HLS INLINE off
@@ -388,6 +318,11 @@ void pMacAddressInserter(
 
     const char *myName  = concat3(THIS_NAME, "/", "MAi");
 
+    //-- LOCAL CONSTANTS -------------------------------------------------------
+    const int cEthHdrLen = 14;                               // Ethernet header length
+    const int cHdrChunks = cEthHdrLen / (W/8);          // Chunks made of header only
+    const int cOff       = (W/8) - (cEthHdrLen % (W/8)); // Packet bytes in the first joined chunk
+
     //-- STATIC CONTROL VARIABLES (with RESET) ---------------------------------
     static enum FsmStates {FSM_MAI_WAIT_LOOKUP=0, FSM_MAI_DROP, FSM_MAI_WRITE,
                            FSM_MAI_WRITE_FIRST,   FSM_MAI_WRITE_LAST} \
@@ -395,31 +330,42 @@ void pMacAddressInserter(
     #pragma HLS RESET variable=mai_fsmState
 
     //-- STATIC DATAFLOW VARIABLES ---------------------------------------------
-    static AxisIp4  mai_prevChunk;
+    static AxisRawT<W>  mai_prevChunk;
+    static EthAddr      mai_macDstAddr;
 
     //-- DYNAMIC VARIABLES -----------------------------------------------------
-    AxisEth     sendChunk;
-    AxisIp4     currChunk;
+    AxisRawT<W> sendChunk(0, 0, 0);
+    AxisRawT<W> currChunk;
     ArpLkpReply arpResponse;
-    EthAddr     macDstAddr;
+    // The Ethernet header in network order (.i.e, [DA|SA|Type])
+    ap_uint<8*cEthHdrLen> ethHeader = (mai_macDstAddr, piMMIO_MacAddress, (EtherType)0x0800);
 
-    currChunk.setLE_TLast(0);
     switch (mai_fsmState) {
     case FSM_MAI_WAIT_LOOKUP:
         if (!siARP_LookupRsp.empty() and !soL2MUX_Data.full()) {
             siARP_LookupRsp.read(arpResponse);
-            macDstAddr = arpResponse.macAddress;
+            mai_macDstAddr = arpResponse.macAddress;
+            ethHeader(8*cEthHdrLen-1, 8*cEthHdrLen-48) = arpResponse.macAddress;
             if (arpResponse.hit) {
-                sendChunk.setEthDstAddr(macDstAddr);
-                sendChunk.setEthSrcAddrHi(piMMIO_MacAddress);
-                sendChunk.setLE_TKeep(0xff);
-                sendChunk.setLE_TLast(0);
-                soL2MUX_Data.write(sendChunk);
+                if (cHdrChunks != 0) {
+                    //-- Forward the first bytes of the Ethernet header
+                    for (int lane=0; lane<W/8; lane++) {
+                      #pragma HLS UNROLL
+                        if (lane < cEthHdrLen) {
+                            sendChunk.setLE_TData(ethHeader(8*(cEthHdrLen-lane)-1, 8*(cEthHdrLen-lane)-8),
+                                                  8*lane+7, 8*lane);
+                            sendChunk.setLE_TKeep(1, lane, lane);
+                        }
+                    }
+                    soL2MUX_Data.write(sendChunk);
+                    if (DEBUG_LEVEL & TRACE_MAI) {
+                        printInfo(myName, "Forwarding AxisChunk to [L2MUX] (TLAST=%d).\n", sendChunk.getLE_TLast().to_int());
+                    }
+                }
                 mai_fsmState = FSM_MAI_WRITE_FIRST;
                 if (DEBUG_LEVEL & TRACE_MAI) {
                     printInfo(myName, "FSM_MAI_WAIT_LOOKUP - Lookup=HIT - Received MAC = 0x%12.12lX\n",
                               arpResponse.macAddress.to_ulong());
-                    printAxisRaw(myName, "Forwarding AxisChunk to [L2MUX]: ", sendChunk);
                 }
             }
             else {  // Drop it all, wait for RT
@@ -431,64 +377,46 @@ void pMacAddressInserter(
         }
         break;
     case FSM_MAI_WRITE_FIRST:
-        if (DEBUG_LEVEL & TRACE_MAI) { printInfo(myName, "FSM_MAI_WRITE_FIRST - \n"); }
-        if (!siIAe_Data.empty() and !soL2MUX_Data.full()) {
-            siIAe_Data.read(currChunk);
-            sendChunk.setEthSrcAddrLo(piMMIO_MacAddress);
-            sendChunk.setEthTypeLen(0x0800);
-            sendChunk.setIp4HdrLen(currChunk.getIp4HdrLen());
-            sendChunk.setIp4Version(currChunk.getIp4Version());
-            sendChunk.setIp4ToS(currChunk.getIp4ToS());
-            sendChunk.setLE_TKeep(0xff);
-            sendChunk.setLE_TLast(0);
-            soL2MUX_Data.write(sendChunk);
-            mai_prevChunk = currChunk;
-            mai_fsmState = FSM_MAI_WRITE;
-        }
-        break;
     case FSM_MAI_WRITE:
         if (DEBUG_LEVEL & TRACE_MAI) { printInfo(myName, "FSM_MAI_WRITE - \n"); }
         if (!siIAe_Data.empty() and !soL2MUX_Data.full()) {
             siIAe_Data.read(currChunk);
-            sendChunk.setLE_TData(mai_prevChunk.getLE_TData(63, 16), 47,  0);
-            sendChunk.setLE_TData(    currChunk.getLE_TData(15,  0), 63, 48);
-            sendChunk.setLE_TKeep(mai_prevChunk.getLE_TKeep( 7,  2),  5,  0);
-            sendChunk.setLE_TKeep(    currChunk.getLE_TKeep( 1,  0),  7,  6);
-            if (currChunk.getLE_TKeep()[2] == 0) {
-                sendChunk.setLE_TLast(TLAST);
-            }
-            else {
-                 sendChunk.setLE_TLast(0);
+            if (mai_fsmState == FSM_MAI_WRITE_FIRST) {
+                //-- The remaining bytes of the Ethernet header go into the upper lanes
+                for (int lane=cOff; lane<W/8; lane++) {
+                  #pragma HLS UNROLL
+                    int byteOff = cHdrChunks*(W/8) + lane - cOff;
+                    mai_prevChunk.setLE_TData(ethHeader(8*(cEthHdrLen-byteOff)-1, 8*(cEthHdrLen-byteOff)-8),
+                                              8*lane+7, 8*lane);
+                    mai_prevChunk.setLE_TKeep(1, lane, lane);
+                }
             }
+            sendChunk = axisRawJoin<cOff>(mai_prevChunk, currChunk);
             soL2MUX_Data.write(sendChunk);
             if (DEBUG_LEVEL & TRACE_MAI) {
-                printAxisRaw(myName, "Forwarding AxisChunk to [L2MUX]: ", sendChunk);
+                printInfo(myName, "Forwarding AxisChunk to [L2MUX] (TLAST=%d).\n", sendChunk.getLE_TLast().to_int());
             }
             mai_prevChunk = currChunk;
             if (currChunk.getLE_TLast()) {
-                if (currChunk.getLE_TKeep()[2] == 0) {
+                if (sendChunk.getLE_TLast()) {
                     mai_fsmState = FSM_MAI_WAIT_LOOKUP;
                 }
                 else {
-                   mai_fsmState = FSM_MAI_WRITE_LAST;
+                    mai_fsmState = FSM_MAI_WRITE_LAST;
                 }
             }
             else {
-                    mai_fsmState = FSM_MAI_WRITE;
-                }
+                mai_fsmState = FSM_MAI_WRITE;
+            }
         }
         break;
     case FSM_MAI_WRITE_LAST:
         if (DEBUG_LEVEL & TRACE_MAI) { printInfo(myName, "FSM_MAI_WRITE_LAST - \n"); }
         if (!soL2MUX_Data.full()) {
-            sendChunk.setLE_TData(mai_prevChunk.getLE_TData(63, 16), 47,  0);
-            sendChunk.setLE_TData(                                0, 63, 48);
-            sendChunk.setLE_TKeep(mai_prevChunk.getLE_TKeep( 7,  2),  5,  0);
-            sendChunk.setLE_TKeep(                                0,  7,  6);
-            sendChunk.setLE_TLast(TLAST);
+            sendChunk = axisRawTail<cOff>(mai_prevChunk);
             soL2MUX_Data.write(sendChunk);
             if (DEBUG_LEVEL & TRACE_MAI) {
-                printAxisRaw(myName, "Forwarding AxisChunk to [L2MUX]: ", sendChunk);
+                printInfo(myName, "Forwarding AxisChunk to [L2MUX] (TLAST=%d).\n", sendChunk.getLE_TLast().to_int());
             }
             mai_fsmState = FSM_MAI_WAIT_LOOKUP;
         }
@@ -525,8 +453,12 @@ void pMacAddressInserter(
  *  forwards it to the Address Resolution Protocol server (ARP) in order to
  *  look up the corresponding MAC address. Final, an Ethernet header is created
  *  and is prepended to the outgoing IPv4 packet.
+ *  The whole handler is templated on the width 'W' of its datapath. The NTS
+ *  instantiates it at 'ARW' (see iptx_top), while the wider instances are used
+ *  by the throughput benchmark of the IPTX (see test_iptx_width.cpp).
  *
  *******************************************************************************/
+template<int W>
 void iptx(
         //------------------------------------------------------
         //-- MMIO Interfaces
@@ -537,11 +469,11 @@ void iptx(
         //------------------------------------------------------
         //-- L3MUX Interface
         //------------------------------------------------------
-        stream<AxisIp4>         &siL3MUX_Data,
+        stream<AxisRawT<W> >    &siL3MUX_Data,
         //------------------------------------------------------
         //-- L2MUX Interface
         //------------------------------------------------------
-        stream<AxisEth>         &soL2MUX_Data,
+        stream<AxisRawT<W> >    &soL2MUX_Data,
         //------------------------------------------------------
         //-- ARP Interface
         //------------------------------------------------------
@@ -558,7 +490,7 @@ void iptx(
     //--------------------------------------------------------------------------
 
     //-- Header Checksum Accumulator (HCa)
-    static stream<AxisIp4>         ssHCaToICi_Data    ("ssHCaToICi_Data");
+    static stream<AxisRawT<W> >    ssHCaToICi_Data    ("ssHCaToICi_Data");
     #pragma HLS STREAM    variable=ssHCaToICi_Data    depth=1024 // Must hold one IP header for checksum computation
     #pragma HLS DATA_PACK variable=ssHCaToICi_Data               // [FIXME -We only need to store 20 to 24+ bytes]
 
@@ -566,35 +498,35 @@ void iptx(
     #pragma HLS STREAM    variable=ssHCaToICi_Csum    depth=16
 
     //-- IP Checksum Inserter (ICi)
-    static stream<AxisIp4>         ssICiToIAe_Data    ("ssICiToIAe_Data");
+    static stream<AxisRawT<W> >    ssICiToIAe_Data    ("ssICiToIAe_Data");
     #pragma HLS STREAM    variable=ssICiToIAe_Data    depth=16
     #pragma HLS DATA_PACK variable=ssICiToIAe_Data
 
     //-- IP Address Extractor (IAe)
-    static stream<AxisIp4>         ssIAeToMAi_Data    ("ssIAeToMAi_Data");
+    static stream<AxisRawT<W> >    ssIAeToMAi_Data    ("ssIAeToMAi_Data");
     #pragma HLS STREAM    variable=ssIAeToMAi_Data    depth=16
     #pragma HLS DATA_PACK variable=ssIAeToMAi_Data
 
     //-- PROCESS FUNCTIONS -----------------------------------------------------
 
-    pHeaderChecksumAccumulator(
+    pHeaderChecksumAccumulator<W>(
             siL3MUX_Data,
             ssHCaToICi_Data,
             ssHCaToICi_Csum);
 
-    pIpChecksumInsert(
+    pIpChecksumInsert<W>(
             ssHCaToICi_Data,
             ssHCaToICi_Csum,
             ssICiToIAe_Data);
 
-    pIp4AddressExtractor(
+    pIp4AddressExtractor<W>(
             piMMIO_SubNetMask,
             piMMIO_GatewayAddr,
             ssICiToIAe_Data,
             ssIAeToMAi_Data,
             soARP_LookupReq);
 
-    pMacAddressInserter(
+    pMacAddressInserter<W>(
             piMMIO_MacAddress,
             ssIAeToMAi_Data,
             siARP_LookupRep,
@@ -657,20 +589,33 @@ void iptx(
     //-- DIRECTIVES FOR THIS PROCESS -------------------------------------------
     #pragma HLS DATAFLOW
 
+    //-- LOCAL INPUT and OUTPUT STREAMS ----------------------------------------
+    static stream<AxisRaw>          ssiL3MUX_Data ("ssiL3MUX_Data");
+    #pragma HLS STREAM     variable=ssiL3MUX_Data depth=8
+    #pragma HLS DATA_PACK  variable=ssiL3MUX_Data
+    static stream<AxisRaw>          ssoL2MUX_Data ("ssoL2MUX_Data");
+    #pragma HLS DATA_PACK  variable=ssoL2MUX_Data
+
+    //-- INPUT STREAM CASTING --------------------------------------------------
+    pAxisRawCast(siL3MUX_Data, ssiL3MUX_Data);
+
     //-- MAIN IPTX PROCESS -----------------------------------------------------
-    iptx(
+    iptx<ARW>(
         //-- MMIO Interfaces
         piMMIO_MacAddress,
         piMMIO_SubNetMask,
         piMMIO_GatewayAddr,
         //-- L3MUX Interface
-        siL3MUX_Data,
+        ssiL3MUX_Data,
         //-- L2MUX Interface
-        soL2MUX_Data,
+        ssoL2MUX_Data,
         //-- ARP Interface
         soARP_LookupReq,
         siARP_LookupRep);
 
+    //-- OUTPUT STREAM CASTING -------------------------------------------------
+    pAxisRawCast(ssoL2MUX_Data, soL2MUX_Data);
+
 }
 #else
     void iptx_top(
@@ -711,32 +656,38 @@ void iptx(
     //-- DIRECTIVES FOR THIS PROCESS -------------------------------------------
     #pragma HLS DATAFLOW disable_start_propagation
 
-    //-- LOCAL INPUT and OUTPUT STREAMS ----------------------------------------
-    static stream<AxisIp4>          ssiL3MUX_Data ("ssiL3MUX_Data");
-    #pragma HLS STREAM     variable=ssiL3MUX_Data depth=8
-    static stream<AxisEth>          ssoL2MUX_Data ("ssoL2MUX_Data");
-
-    //-- INPUT STREAM CASTING --------------------------------------------------
-    pAxisRawCast(siL3MUX_Data, ssiL3MUX_Data);
-
     //-- MAIN IPTX PROCESS -----------------------------------------------------
-    iptx(
+    iptx<ARW>(
         //-- MMIO Interfaces
         piMMIO_MacAddress,
         piMMIO_SubNetMask,
         piMMIO_GatewayAddr,
         //-- L3MUX Interface
-        ssiL3MUX_Data,
+        siL3MUX_Data,
         //-- L2MUX Interface
-        ssoL2MUX_Data,
+        soL2MUX_Data,
         //-- ARP Interface
         soARP_LookupReq,
         siARP_LookupRep);
 
-    //-- OUTPUT STREAM CASTING -------------------------------------------------
-    pAxisRawCast(ssoL2MUX_Data, soL2MUX_Data);
-
 }
 #endif  // HLS_VERSION
 
+#ifndef __SYNTHESIS__
+/*******************************************************************************
+ * EXPLICIT INSTANTIATIONS
+ *  The NTS uses the 'ARW' instance (see iptx_top). The wider instances are
+ *  only exercised by the throughput benchmark of the IPTX.
+ *******************************************************************************/
+template void iptx<AXIS_RAW_WIDTH_AT_25GE>(EthAddr, Ip4Addr, Ip4Addr,
+        stream<AxisRawT<AXIS_RAW_WIDTH_AT_25GE> >&, stream<AxisRawT<AXIS_RAW_WIDTH_AT_25GE> >&,
+        stream<Ip4Addr>&, stream<ArpLkpReply>&);
+template void iptx<AXIS_RAW_WIDTH_AT_40GE>(EthAddr, Ip4Addr, Ip4Addr,
+        stream<AxisRawT<AXIS_RAW_WIDTH_AT_40GE> >&, stream<AxisRawT<AXIS_RAW_WIDTH_AT_40GE> >&,
+        stream<Ip4Addr>&, stream<ArpLkpReply>&);
+template void iptx<AXIS_RAW_WIDTH_AT_100GE>(EthAddr, Ip4Addr, Ip4Addr,
+        stream<AxisRawT<AXIS_RAW_WIDTH_AT_100GE> >&, stream<AxisRawT<AXIS_RAW_WIDTH_AT_100GE> >&,
+        stream<Ip4Addr>&, stream<ArpLkpReply>&);
+#endif
+
 /*! \} */
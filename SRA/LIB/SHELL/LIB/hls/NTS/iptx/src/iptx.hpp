@@ -68,6 +68,32 @@ EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  * ENTITY - IP TX HANDLER (IPTX)
  *
  *******************************************************************************/
+template<int W>
+    void iptx(
+        //------------------------------------------------------
+        //-- MMIO Interfaces
+        //------------------------------------------------------
+        EthAddr                  piMMIO_MacAddress,
+        Ip4Addr                  piMMIO_SubNetMask,
+        Ip4Addr                  piMMIO_GatewayAddr,
+
+        //------------------------------------------------------
+        //-- L3MUX Interface
+        //------------------------------------------------------
+        stream<AxisRawT<W> >    &siL3MUX_Data,
+
+        //------------------------------------------------------
+        //-- L2MUX Interface
+        //------------------------------------------------------
+        stream<AxisRawT<W> >    &soL2MUX_Data,
+
+        //------------------------------------------------------
+        //-- ARP Interface
+        //------------------------------------------------------
+        stream<Ip4Addr>         &soARP_LookupReq,
+        stream<ArpLkpReply>     &siARP_LookupRep
+    );
+
 #if HLS_VERSION == 2017
 
     void iptx_top(
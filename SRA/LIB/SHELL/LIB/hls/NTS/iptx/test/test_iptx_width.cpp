@@ -0,0 +1,255 @@
+/*
+ * Copyright 2016 -- 2021 IBM Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*******************************************************************************
+ * @file       : test_iptx_width.cpp
+ * @brief      : Throughput benchmark of the IPTX at various datapath widths.
+ *
+ * System:     : cloudFPGA
+ * Component   : Shell, Network Transport Stack (NTS)
+ * Language    : Vivado HLS
+ *
+ * @details
+ *  This testbench instantiates the whole IP Transmitter Handler (@see iptx())
+ *  for the datapath widths of 10GE (64-bit), 25GE (128-bit), 40GE (256-bit)
+ *  and 100GE (512-bit). It streams a set of IPv4 packets (with and without
+ *  options) through each instance, and checks the outgoing Ethernet frames
+ *  byte per byte, i.e. the MAC header, the IPv4 header checksum and the
+ *  payload. It then reports the number of frame bytes forwarded per cycle.
+ *
+ *  Usage: 'make csimWidth' from the 'iptx' directory.
+ *
+ * \ingroup NTS_IPTX
+ * \addtogroup NTS_IPTX_TEST
+ * \{
+ *******************************************************************************/
+
+#include <cstdlib>
+#include <vector>
+
+#include "../src/iptx.hpp"
+
+using namespace hls;
+using namespace std;
+
+#define THIS_NAME "TB"
+
+//---------------------------------------------------------
+//-- TESTBENCH GLOBAL VARIABLES
+//---------------------------------------------------------
+bool            gTraceEvent   = false;
+bool            gFatalError   = false;
+unsigned int    gSimCycCnt    = 0;
+
+//---------------------------------------------------------
+//-- TESTBENCH DEFINES
+//---------------------------------------------------------
+const int     cNrPackets   = 64;            // The number of packets per run
+const EthAddr cMyMacAddr   = 0x0A0B0C0D0E0F;
+const Ip4Addr cMyIp4Addr   = 0x0A0CC807;
+const Ip4Addr cSubNetMask  = 0xFFFFFF00;
+const Ip4Addr cGatewayAddr = 0x0A0CC801;
+
+/*******************************************************************************
+ * @brief The MAC address returned by the emulated [ARP] for an IPv4 address.
+ *******************************************************************************/
+EthAddr arpMacAddr(Ip4Addr ip4Addr) {
+    return 0xFECA00000000 | ip4Addr;
+}
+
+/*******************************************************************************
+ * @brief Build an IPv4 packet and the Ethernet frame expected from the IPTX.
+ *
+ * @param[in]  pktLen   The length of the IPv4 packet (in bytes).
+ * @param[in]  ihl      The Internet Header Length (in 32-bit words).
+ * @param[in]  dstAddr  The IPv4 destination address.
+ * @param[out] ip4Pkt   The bytes of the IPv4 packet (with a wrong checksum).
+ * @param[out] ethFrm   The bytes of the expected Ethernet frame.
+ *******************************************************************************/
+void buildPacket(int pktLen, int ihl, Ip4Addr dstAddr,
+                 vector<ap_uint<8> > &ip4Pkt, vector<ap_uint<8> > &ethFrm)
+{
+    ip4Pkt.assign(pktLen, 0);
+    ip4Pkt[ 0] = 0x40 | ihl;
+    ip4Pkt[ 2] = pktLen >> 8;
+    ip4Pkt[ 3] = pktLen & 0xFF;
+    ip4Pkt[ 8] = 0x40;              // TTL
+    ip4Pkt[ 9] = IP4_PROT_UDP;
+    ip4Pkt[10] = 0xDE;              // A wrong checksum to be overwritten
+    ip4Pkt[11] = 0xAD;
+    for (int i=0; i<4; i++) {
+        ip4Pkt[12+i] = cMyIp4Addr(31-8*i, 24-8*i);
+        ip4Pkt[16+i] =    dstAddr(31-8*i, 24-8*i);
+    }
+    for (int i=20; i<pktLen; i++) {
+        ip4Pkt[i] = rand() & 0xFF;
+    }
+
+    //-- Compute the reference header checksum
+    uint32_t refSum = 0;
+    for (int i=0; i<4*ihl; i+=2) {
+        if (i != 10) {
+            refSum += (ip4Pkt[i].to_uint() << 8) + ip4Pkt[i+1].to_uint();
+        }
+    }
+    while (refSum >> 16) {
+        refSum = (refSum & 0xFFFF) + (refSum >> 16);
+    }
+    refSum = ~refSum & 0xFFFF;
+
+    //-- Build the expected Ethernet frame
+    EthAddr macDstAddr = arpMacAddr(dstAddr);
+    ethFrm.clear();
+    for (int i=0; i<6; i++) {
+        ethFrm.push_back(macDstAddr(47-8*i, 40-8*i));
+    }
+    for (int i=0; i<6; i++) {
+        ethFrm.push_back(cMyMacAddr(47-8*i, 40-8*i));
+    }
+    ethFrm.push_back(0x08);
+    ethFrm.push_back(0x00);
+    for (int i=0; i<pktLen; i++) {
+        if      (i == 10) { ethFrm.push_back(refSum >> 8);   }
+        else if (i == 11) { ethFrm.push_back(refSum & 0xFF); }
+        else              { ethFrm.push_back(ip4Pkt[i]);     }
+    }
+}
+
+/*******************************************************************************
+ * @brief Run the benchmark for a given datapath width and packet length.
+ *
+ * @param[in]  pktLen  The length of the IPv4 packets (in bytes).
+ *
+ * @return the number of errors.
+ *******************************************************************************/
+template<int W>
+int runBenchmark(int pktLen)
+{
+    const char *myName = concat3(THIS_NAME, "/", "Bench");
+
+    stream<AxisRawT<W> >  ssData("ssData");
+    stream<AxisRawT<W> >  ssFrame("ssFrame");
+    stream<Ip4Addr>       ssLookupReq("ssLookupReq");
+    stream<ArpLkpReply>   ssLookupRep("ssLookupRep");
+    vector<ap_uint<8> >   expected;
+    vector<size_t>        lastBytes;
+    int                   nrErr = 0;
+
+    //-- Generate the packets (every fourth packet carries an IPv4 option)
+    for (int pkt=0; pkt<cNrPackets; pkt++) {
+        vector<ap_uint<8> > ip4Pkt, ethFrm;
+        buildPacket(pktLen, (pkt % 4) ? 5 : 6, (cGatewayAddr & cSubNetMask) | (2 + pkt),
+                    ip4Pkt, ethFrm);
+        AxisRawT<W> chunk(0, 0, 0);
+        for (int i=0; i<pktLen; i++) {
+            int lane = i % (W/8);
+            chunk.setLE_TData(ip4Pkt[i], 8*lane+7, 8*lane);
+            chunk.setLE_TKeep(1, lane, lane);
+            if (i == pktLen-1) {
+                chunk.setLE_TLast(TLAST);
+            }
+            if ((lane == W/8-1) or (i == pktLen-1)) {
+                ssData.write(chunk);
+                chunk = AxisRawT<W>(0, 0, 0);
+            }
+        }
+        expected.insert(expected.end(), ethFrm.begin(), ethFrm.end());
+        lastBytes.push_back(expected.size()-1);
+    }
+
+    //-- Run the DUT and count the cycles up to the last outgoing chunk
+    unsigned int cycle=0, lastCycle=0, idle=0, nrFrames=0;
+    size_t       byteCnt=0;
+    while (idle < 16) {
+        iptx<W>(cMyMacAddr, cSubNetMask, cGatewayAddr,
+                ssData, ssFrame, ssLookupReq, ssLookupRep);
+        cycle++;
+        //-- Emulate the [ARP]
+        if (!ssLookupReq.empty()) {
+            Ip4Addr ip4Addr = ssLookupReq.read();
+            ssLookupRep.write(ArpLkpReply(arpMacAddr(ip4Addr), true));
+        }
+        if (ssFrame.empty()) {
+            idle++;
+            continue;
+        }
+        idle = 0;
+        lastCycle = cycle;
+        AxisRawT<W> chunk = ssFrame.read();
+        for (int lane=0; lane<W/8; lane++) {
+            if (chunk.getLE_TKeep()[lane]) {
+                ap_uint<8> byte = chunk.getLE_TData(8*lane+7, 8*lane);
+                if ((byteCnt >= expected.size()) or (byte != expected[byteCnt])) {
+                    nrErr++;
+                }
+                byteCnt++;
+            }
+        }
+        if (chunk.getLE_TLast()) {
+            if ((nrFrames >= lastBytes.size()) or (byteCnt-1 != lastBytes[nrFrames])) {
+                printError(myName, "W=%3d - Frame #%d ends at byte %zu.\n", W, nrFrames, byteCnt-1);
+                nrErr++;
+            }
+            nrFrames++;
+        }
+    }
+    if ((byteCnt != expected.size()) or (nrFrames != cNrPackets)) {
+        printError(myName, "W=%3d - Received %d frames and %zu bytes instead of %d and %zu.\n",
+                   W, nrFrames, byteCnt, cNrPackets, expected.size());
+        nrErr++;
+    }
+
+    double bytesPerCycle = (double)byteCnt / lastCycle;
+    printInfo(myName, "W=%3d - PktLen=%4d - %6zu bytes in %5d cycles = %6.2f bytes/cycle (%5.1f%% of %d) - %d error(s).\n",
+              W, pktLen, byteCnt, lastCycle, bytesPerCycle, 100.0*bytesPerCycle/(W/8), W/8, nrErr);
+    return nrErr;
+}
+
+/*******************************************************************************
+ * @brief Main function.
+ *******************************************************************************/
+int main(int argc, char* argv[]) {
+
+    const int cPktLen[] = { 64, 256, 576, 1500 };
+    int nrErr = 0;
+
+    printInfo(THIS_NAME, "############################################################################\n");
+    printInfo(THIS_NAME, "## TESTBENCH 'test_iptx_width' STARTS HERE                                ##\n");
+    printInfo(THIS_NAME, "############################################################################\n");
+
+    srand(0xCF);
+    for (int i=0; i<4; i++) {
+        nrErr += runBenchmark<AXIS_RAW_WIDTH_AT_10GE> (cPktLen[i]);
+        nrErr += runBenchmark<AXIS_RAW_WIDTH_AT_25GE> (cPktLen[i]);
+        nrErr += runBenchmark<AXIS_RAW_WIDTH_AT_40GE> (cPktLen[i]);
+        nrErr += runBenchmark<AXIS_RAW_WIDTH_AT_100GE>(cPktLen[i]);
+    }
+
+    if (nrErr) {
+        printError(THIS_NAME, "###########################################################\n");
+        printError(THIS_NAME, "#### TEST BENCH FAILED : TOTAL NUMBER OF ERROR(S) = %2d ####\n", nrErr);
+        printError(THIS_NAME, "###########################################################\n");
+    }
+    else {
+        printInfo(THIS_NAME, "#############################################################\n");
+        printInfo(THIS_NAME, "####               SUCCESSFUL END OF TEST                ####\n");
+        printInfo(THIS_NAME, "#############################################################\n");
+    }
+
+    return nrErr;
+}
+
+/*! \} */
@@ -148,6 +148,74 @@ public:
         sessId(sessId), length(datLen), spaceLeft(space), error(rc) {}
 };
 
+//---------------------------------------------------------
+//-- TCP APP - DATA SEND DESCRIPTOR
+//--  Used by the application to request the transmission of
+//--  data which already sits in the DRAM of the TOE (i.e.
+//--  zero-copy send). The request is acknowledged with a
+//--  'TcpAppSndRep' and the data must be kept unchanged until
+//--  its completion is returned with a 'TcpAppSndCpl'.
+//---------------------------------------------------------
+typedef ap_uint<32> TcpAppMemAdr;  // A byte address in the DRAM of the TOE
+
+class TcpAppSndDsc {
+  public:
+    SessionId    sessId;
+    TcpAppMemAdr addr;
+    TcpDatLen    length;
+    TcpAppSndDsc() {}
+    TcpAppSndDsc(SessionId id, TcpAppMemAdr addr, TcpDatLen len) :
+        sessId(id), addr(addr), length(len) {}
+};
+
+//---------------------------------------------------------
+//-- TCP APP - DATA SEND COMPLETION
+//--  Returned by NTS when zero-copy data gets acknowledged.
+//--  All the bytes located below 'addr' can be reused by the
+//--  application. 'done' is set when all the descriptors of
+//--  the session were acknowledged.
+//---------------------------------------------------------
+class TcpAppSndCpl {
+  public:
+    SessionId    sessId;
+    TcpAppMemAdr addr;
+    FlagBool     done;
+    TcpAppSndCpl() {}
+    TcpAppSndCpl(SessionId id, TcpAppMemAdr addr, FlagBool done) :
+        sessId(id), addr(addr), done(done) {}
+};
+
+//---------------------------------------------------------
+//-- TCP APP - DATA READ DESCRIPTOR
+//--  Returned by NTS upon a descriptor request (i.e. a
+//--  'TcpAppRdReq' issued on the descriptor interface). It
+//--  locates the requested bytes in the TCP Rx buffer of the
+//--  session (i.e. zero-copy receive). If 'wrap' is set, the
+//--  bytes continue at the beginning of that Rx buffer.
+//--  The bytes are released with a 'TcpAppRxCrd'.
+//--  When the TOE uses a buffer pool or spill regions, a
+//--  descriptor stops where its bytes are no longer contiguous
+//--  in memory and may therefore be shorter than requested.
+//---------------------------------------------------------
+class TcpAppRdDsc {
+  public:
+    SessionId    sessId;
+    TcpAppMemAdr addr;
+    TcpDatLen    length;
+    FlagBool     wrap;
+    TcpAppRdDsc() {}
+    TcpAppRdDsc(SessionId id, TcpAppMemAdr addr, TcpDatLen len, FlagBool wrap) :
+        sessId(id), addr(addr), length(len), wrap(wrap) {}
+};
+
+//---------------------------------------------------------
+//-- TCP APP - DATA READ CREDIT
+//--  Returned by the application to release the next 'length'
+//--  bytes of the TCP Rx buffer which were handed over with
+//--  one or several 'TcpAppRdDsc'.
+//---------------------------------------------------------
+typedef TcpAppRdReq TcpAppRxCrd;
+
 //=========================================================
 //== TAIF / OPEN & CLOSE CONNECTION INTERFACES
 //=========================================================
@@ -184,10 +252,25 @@ typedef SessionId       TcpAppClsReq;
 
 //---------------------------------------------------------
 //-- TCP APP - LISTEN REQUEST
-//--  The TCP port to open for listening.
-//--  [FIXME-What about creating a class 'AppLsnReq' with a member 'start/stop']
+//--  The TCP port to open for listening (i.e. [0x0000..0x7FFF]) and the
+//--  options of the sessions accepted on that port. A request for a port
+//--  outside of that range, or with an unknown keepalive profile, is refused.
+//--  [FIXME-What about adding a member 'start/stop']
 //---------------------------------------------------------
-typedef TcpPort     TcpAppLsnReq;
+typedef ap_uint<2>  TcpAckPolicy;  // An ACK policy (see TOE_ACK_POLICY_CFG)
+typedef ap_uint<2>  TcpKaProfile;  // A keepalive profile (see TOE_KEEPALIVE_IDLE_S_CFG)
+
+class TcpAppLsnReq {
+  public:
+    TcpPort      port;       // The port to open for listening
+    FlagBit      twShort;    // Use a short TIME-WAIT (see TOE_TIME_WAIT_SHORT_MS_CFG)
+    TcpAckPolicy ackPolicy;  // The ACK policy of the sessions (TOE_ACK_DEFAULT if none)
+    TcpKaProfile kaProfile;  // The keepalive profile of the sessions (TOE_KEEPALIVE_DEFAULT if none)
+    TcpAppLsnReq() {}
+    TcpAppLsnReq(TcpPort port, FlagBit twShort=0, TcpAckPolicy ackPolicy=TOE_ACK_DEFAULT,
+                 TcpKaProfile kaProfile=TOE_KEEPALIVE_DEFAULT) :
+        port(port), twShort(twShort), ackPolicy(ackPolicy), kaProfile(kaProfile) {}
+};
 
 //---------------------------------------------------------
 //-- TCP APP - LISTEN REPLY
@@ -285,6 +368,9 @@ void nts(
         stream<TcpAppRdReq>     &siTAIF_DReq,
         stream<TcpAppData>      &soTAIF_Data,
         stream<TcpAppMeta>      &soTAIF_Meta,
+        stream<TcpAppRdReq>     &siTAIF_DscReq,
+        stream<TcpAppRdDsc>     &soTAIF_RdDsc,
+        stream<TcpAppRxCrd>     &siTAIF_RxCrd,
 
         //------------------------------------------------------
         //-- TAIF / Listen Port Interfaces
@@ -298,6 +384,8 @@ void nts(
         stream<TcpAppData>      &siTAIF_Data,
         stream<TcpAppSndReq>    &siTAIF_SndReq,
         stream<TcpAppSndRep>    &soTAIF_SndRep,
+        stream<TcpAppSndDsc>    &siTAIF_SndDsc,
+        stream<TcpAppSndCpl>    &soTAIF_SndCpl,
 
         //------------------------------------------------------
         //-- TAIF / Open Connection Interfaces
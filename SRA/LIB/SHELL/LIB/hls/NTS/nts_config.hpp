@@ -51,8 +51,16 @@ static unsigned long log2ceil(unsigned long val) {
 
 //--------------------------------------------------------------------
 //-- ETHERNET - MAXIMUM TRANSMISSION UNIT
+//--  The MTU defaults to 1500 bytes but can be overridden at build time
+//--  for jumbo frames (e.g. '-DNTS_MTU_CFG=9000'). The max. is 9000.
 //--------------------------------------------------------------------
-static const uint16_t MTU = 1500;
+#ifndef NTS_MTU_CFG
+  #define NTS_MTU_CFG  1500
+#endif
+#if (NTS_MTU_CFG < 576) || (NTS_MTU_CFG > 9000)
+  #error "NTS_MTU_CFG must be in the range [576:9000]"
+#endif
+static const uint16_t MTU = NTS_MTU_CFG;
 
 //--------------------------------------------------------------------
 //-- ETHERNET - MTU in ZYC2
@@ -72,9 +80,9 @@ static const uint16_t MTU_ZYC2 = 1450;
 
 //------------------------------------------------------------------
 //-- TCP - MAXIMUM SEGMENT SIZE (modulo 8 for efficiency)
-//--  FYI: A specific MSS might be advertised by every connection
-//--   during the 3-way handshake process. For the time being, we
-//--   assume and use a single ZYC2_MSS value for all connections.
+//--  FYI: The TOE uses the MSS advertised by every connection during
+//--   the 3-way handshake process (@see toe.hpp). This ZYC2_MSS is the
+//--   segment size that fits into the VXLAN overlay of ZYC2.
 //--   This MSS is rounded modulo 8 bytes for better efficiency.
 //------------------------------------------------------------------
 static const uint16_t ZYC2_MSS  = (MTU_ZYC2-92) & ~0x7; // 1358 & ~0x7 = 1352
@@ -82,13 +90,44 @@ static const uint16_t ZYC2_MSS  = (MTU_ZYC2-92) & ~0x7; // 1358 & ~0x7 = 1352
 //------------------------------------------------------------------
 //-- TCP OFFLOAD ENGINE - CONFIGURATION PARAMETERS
 //------------------------------------------------------------------
-static const uint16_t TOE_MAX_SESSIONS    = 8; // The number of session you want to support (Max. is 10.000)
+//-- The number of sessions defaults to 8 but can be overridden at build time
+//--  (e.g. '-DTOE_MAX_SESSIONS_CFG=4096'). The max. is 16K because the session
+//--  ID is used as the upper 14 bits of the Rx/Tx buffer memory addresses
+//--  (fewer when the per-session buffers are larger than 64KB, see below).
+#ifndef TOE_MAX_SESSIONS_CFG
+  #define TOE_MAX_SESSIONS_CFG  8
+#endif
+static const uint16_t TOE_MAX_SESSIONS    = TOE_MAX_SESSIONS_CFG; // The number of session you want to support (Max. is 16K)
 
-static const uint16_t TOE_WINDOW_BITS     = 16;
+//-- The per-session tables of the TOE are mapped to BRAM by default. Set this
+//--  flag (e.g. '-DTOE_USE_URAM=1') to map them to UltraRAM instead when the
+//--  target device provides it (e.g. UltraScale+).
+#ifndef TOE_USE_URAM
+  #define TOE_USE_URAM          0
+#endif
+
+//-- The size of the per-session Rx and Tx buffers is 2^TOE_WINDOW_BITS bytes.
+//--  It defaults to 64KB but can be overridden at build time (e.g.
+//--  '-DTOE_WINDOW_BITS_CFG=20' for 1MB buffers). Buffers larger than 64KB
+//--  require the TCP window scale option [RFC-7323] which is then negotiated
+//--  with a shift count of 'TOE_WINDOW_SCALE'. Since each session owns a slice
+//--  of 2^TOE_WINDOW_BITS bytes in the 1GB Rx and Tx memories, the product of
+//--  the number of sessions and the buffer size may not exceed 1GB.
+#ifndef TOE_WINDOW_BITS_CFG
+  #define TOE_WINDOW_BITS_CFG   16
+#endif
+#if (TOE_WINDOW_BITS_CFG < 16) || (TOE_WINDOW_BITS_CFG > 24)
+  #error "TOE_WINDOW_BITS_CFG must be in the range [16:24]."
+#endif
+#if (TOE_MAX_SESSIONS_CFG > (1 << (30 - TOE_WINDOW_BITS_CFG)))
+  #error "TOE_MAX_SESSIONS_CFG x 2^TOE_WINDOW_BITS_CFG exceeds the 1GB Rx/Tx memories."
+#endif
+static const uint16_t TOE_WINDOW_BITS     = TOE_WINDOW_BITS_CFG;
+static const uint16_t TOE_WINDOW_SCALE    = TOE_WINDOW_BITS - 16; // Our window shift count
 
-static const uint32_t TOE_BUFFER_SIZE     = (1 << TOE_WINDOW_BITS); // 65536
-static const uint32_t TOE_RX_BUFFER_SIZE  = TOE_BUFFER_SIZE; // 65536
-static const uint32_t TOE_TX_BUFFER_SIZE  = TOE_BUFFER_SIZE; // 65536
+static const uint32_t TOE_BUFFER_SIZE     = (1 << TOE_WINDOW_BITS); // 65536 by default
+static const uint32_t TOE_RX_BUFFER_SIZE  = TOE_BUFFER_SIZE; // 65536 by default
+static const uint32_t TOE_TX_BUFFER_SIZE  = TOE_BUFFER_SIZE; // 65536 by default
 
 #define               TOE_MEMORY_SIZE       0x80000000 // 2GB
 #define               TOE_MEMORY_BASE       0x00000000 // Base address
@@ -101,7 +140,214 @@ static const uint64_t TOE_TX_MEMORY_BASE = (TOE_MEMORY_SIZE+TOE_RX_MEMORY_SIZE);
 static const uint16_t TOE_RX_MEMORY_BITS  = log2ceil(TOE_RX_MEMORY_SIZE); // 1GB = 2^30
 static const uint16_t TOE_TX_MEMORY_BITS  = log2ceil(TOE_TX_MEMORY_SIZE); // 1GB = 2^30
 
-static const unsigned TOE_MAX_CONGESTION_WINDOW = (TOE_BUFFER_SIZE - 2048); // 0xF7FF
+//-- The Rx and Tx buffers of the sessions are statically carved out of the
+//--  Rx and Tx memories by default. Set this flag (e.g. '-DTOE_BUF_POOL_CFG=1')
+//--  to back them with pages of 2^TOE_PAGE_BITS_CFG bytes instead. The pages
+//--  are allocated on demand from a pool of TOE_BUF_POOL_PAGES_CFG pages per
+//--  direction, which is shared by all the sessions. The per-session buffers
+//--  then become virtual and a buffer only holds the pages of the bytes that
+//--  are in flight or not yet consumed. A page must be able to hold the
+//--  largest memory access (i.e. 64KB) and a buffer must hold at least two
+//--  pages (e.g. '-DTOE_WINDOW_BITS_CFG=20' for 1MB windows of 16 pages).
+#ifndef TOE_BUF_POOL_CFG
+  #define TOE_BUF_POOL_CFG      0
+#endif
+#ifndef TOE_PAGE_BITS_CFG
+  #define TOE_PAGE_BITS_CFG     16
+#endif
+#ifndef TOE_BUF_POOL_PAGES_CFG
+  #define TOE_BUF_POOL_PAGES_CFG  (TOE_MAX_SESSIONS_CFG << (TOE_WINDOW_BITS_CFG - TOE_PAGE_BITS_CFG))
+#endif
+#if TOE_BUF_POOL_CFG
+  #if (TOE_PAGE_BITS_CFG < 16) || (TOE_PAGE_BITS_CFG >= TOE_WINDOW_BITS_CFG)
+    #error "TOE_PAGE_BITS_CFG must be in the range [16:TOE_WINDOW_BITS_CFG-1]."
+  #endif
+  #if (TOE_BUF_POOL_PAGES_CFG < 2) || (TOE_BUF_POOL_PAGES_CFG >= (1 << (30 - TOE_PAGE_BITS_CFG)))
+    #error "TOE_BUF_POOL_PAGES_CFG must be in the range [2:2^(30-TOE_PAGE_BITS_CFG)-1]."
+  #endif
+#endif
+//-- Without the pool, a whole buffer is considered as a single page
+static const uint16_t TOE_PAGE_BITS       = TOE_BUF_POOL_CFG ? TOE_PAGE_BITS_CFG : TOE_WINDOW_BITS;
+static const uint32_t TOE_PAGE_SIZE       = (1 << TOE_PAGE_BITS);  // 65536 by default
+static const uint32_t TOE_BUF_POOL_PAGES  = TOE_BUF_POOL_PAGES_CFG;
+
+//-- A memory access which runs past the end of a Rx or Tx buffer is split in
+//--  two accesses, unless every buffer is followed by a spill region of the
+//--  same size. The access then continues into that region and the SAR tables
+//--  keep track of the first bytes of the next lap which spilled over. This
+//--  doubles the slice of memory of every session, and it is therefore only
+//--  enabled by default when the slices still fit in the 1GB Rx and Tx
+//--  memories. The buffer pool does not use it (e.g. '-DTOE_SPILL_CFG=0').
+#ifndef TOE_SPILL_CFG
+  #define TOE_SPILL_CFG  ((!TOE_BUF_POOL_CFG) && (TOE_MAX_SESSIONS_CFG <= (1 << (29 - TOE_WINDOW_BITS_CFG))))
+#endif
+#if TOE_SPILL_CFG && TOE_BUF_POOL_CFG
+  #error "TOE_SPILL_CFG cannot be combined with TOE_BUF_POOL_CFG."
+#endif
+#if TOE_SPILL_CFG && (TOE_MAX_SESSIONS_CFG > (1 << (29 - TOE_WINDOW_BITS_CFG)))
+  #error "TOE_MAX_SESSIONS_CFG x 2^(TOE_WINDOW_BITS_CFG+1) exceeds the 1GB Rx/Tx memories."
+#endif
+//-- The slice of memory of a session holds its buffer (and its spill region)
+static const uint16_t TOE_SLICE_BITS      = TOE_WINDOW_BITS + (TOE_SPILL_CFG ? 1 : 0);
+
+//-- The congestion window can grow up to the number of bytes that a Tx buffer
+//--  can hold in flight (i.e. 64KB-1 by default).
+static const unsigned TOE_MAX_CONGESTION_WINDOW = (TOE_TX_BUFFER_SIZE - 1); // 0xFFFF by default
+
+//-- The congestion control algorithm of the TOE is selected at build time
+//--  (e.g. '-DTOE_CC_ALGO_CFG=TOE_CC_CUBIC'). It defaults to Reno. DCTCP expects
+//--  the network to mark the IP packets with Congestion Experienced (CE).
+#define TOE_CC_RENO             0  // NewReno AIMD [RFC-5681, RFC-6582]
+#define TOE_CC_CUBIC            1  // CUBIC [RFC-8312]
+#define TOE_CC_DCTCP            2  // Data Center TCP [RFC-8257]
+#ifndef TOE_CC_ALGO_CFG
+  #define TOE_CC_ALGO_CFG       TOE_CC_RENO
+#endif
+
+//-- The default ACK policy of the TOE is selected at build time (e.g.
+//--  '-DTOE_ACK_POLICY_CFG=TOE_ACK_QUICK'). It defaults to delayed ACKs, where
+//--  an ACK is returned after every TOE_ACK_EVERY_N_CFG in-order segments or
+//--  at the latest TOE_ACK_DELAY_US_CFG microseconds after the first segment
+//--  it acknowledges [RFC-1122, RFC-5681]. A listening port can select another
+//--  policy for the sessions it accepts with the 'ackPolicy' field of its listen
+//--  request (see 'TcpAppLsnReq'), where TOE_ACK_DEFAULT stands for this one.
+#define TOE_ACK_DEFAULT         0  // The build-time policy (listen request only)
+#define TOE_ACK_DELAYED         1  // ACK every N segments or after the delay
+#define TOE_ACK_QUICK           2  // ACK every segment right away
+#define TOE_ACK_COALESCE        3  // One ACK per delay, regardless of the number of segments
+#ifndef TOE_ACK_POLICY_CFG
+  #define TOE_ACK_POLICY_CFG    TOE_ACK_DELAYED
+#endif
+#ifndef TOE_ACK_EVERY_N_CFG
+  #define TOE_ACK_EVERY_N_CFG   2
+#endif
+#ifndef TOE_ACK_DELAY_US_CFG
+  #define TOE_ACK_DELAY_US_CFG  64
+#endif
+#if (TOE_ACK_POLICY_CFG < TOE_ACK_DELAYED) || (TOE_ACK_POLICY_CFG > TOE_ACK_COALESCE)
+  #error "TOE_ACK_POLICY_CFG must be one of TOE_ACK_DELAYED, TOE_ACK_QUICK or TOE_ACK_COALESCE."
+#endif
+#if (TOE_ACK_EVERY_N_CFG < 2) || (TOE_ACK_EVERY_N_CFG > 15)
+  #error "TOE_ACK_EVERY_N_CFG must be in the range [2:15]."
+#endif
+#if (TOE_ACK_DELAY_US_CFG < 1) || (TOE_ACK_DELAY_US_CFG > 1000)
+  #error "TOE_ACK_DELAY_US_CFG must be in the range [1:1000]."
+#endif
+
+//-- The Rx notifications of the TOE can be coalesced at build time (e.g.
+//--  '-DTOE_RX_NOTIF_COALESCE_CFG=1'). The consecutive in-order segments of a
+//--  session are then merged into a single notification to [APP], which is
+//--  released once it covers TOE_RX_NOTIF_BYTES_CFG bytes or at the latest
+//--  TOE_RX_NOTIF_DELAY_US_CFG microseconds after its first segment.
+#ifndef TOE_RX_NOTIF_COALESCE_CFG
+  #define TOE_RX_NOTIF_COALESCE_CFG  0
+#endif
+#ifndef TOE_RX_NOTIF_BYTES_CFG
+  #define TOE_RX_NOTIF_BYTES_CFG     16384
+#endif
+#ifndef TOE_RX_NOTIF_DELAY_US_CFG
+  #define TOE_RX_NOTIF_DELAY_US_CFG  16
+#endif
+#if (TOE_RX_NOTIF_BYTES_CFG < 1) || (TOE_RX_NOTIF_BYTES_CFG > 65535)
+  #error "TOE_RX_NOTIF_BYTES_CFG must be in the range [1:65535]."
+#endif
+#if (TOE_RX_NOTIF_DELAY_US_CFG < 1) || (TOE_RX_NOTIF_DELAY_US_CFG > 1000)
+  #error "TOE_RX_NOTIF_DELAY_US_CFG must be in the range [1:1000]."
+#endif
+
+//-- The Rx path of the TOE can be switched to cut-through at build time (e.g.
+//--  '-DTOE_RX_CUT_THROUGH_CFG=1'). The payload of a data segment is then
+//--  written into the Rx buffer as soon as its header is parsed, while the
+//--  'rcvd' pointer and [APP] are only updated after the checksum verdict. A
+//--  segment with a bad checksum is an overwrite of the unacknowledged part
+//--  of the buffer, which is invisible to [APP].
+#ifndef TOE_RX_CUT_THROUGH_CFG
+  #define TOE_RX_CUT_THROUGH_CFG     0
+#endif
+
+//-- The sessions of the TOE are probed with keepalives [RFC-1122]. A session
+//--  which did not receive any segment for TOE_KEEPALIVE_IDLE_S_CFG seconds
+//--  is probed every TOE_KEEPALIVE_INTVL_S_CFG seconds, and it is aborted after
+//--  TOE_KEEPALIVE_PROBES_CFG unanswered probes. This reclaims the sessions of
+//--  the peers which vanished without closing their connection. The defaults
+//--  are the ones of RFC-1122 and Linux; smaller values reclaim the sessions
+//--  sooner (e.g. '-DTOE_KEEPALIVE_IDLE_S_CFG=60'), and an idle time of 0
+//--  disables the keepalive. A listening port can select another keepalive
+//--  profile for the sessions it accepts with the 'kaProfile' field of its
+//--  listen request (see 'TcpAppLsnReq'): no keepalive at all, or the fast
+//--  profile set by TOE_KEEPALIVE_FAST_{IDLE_S,INTVL_S,PROBES}_CFG.
+#define TOE_KEEPALIVE_DEFAULT      0  // The timings above
+#define TOE_KEEPALIVE_OFF          1  // No keepalive
+#define TOE_KEEPALIVE_FAST         2  // The fast timings below
+#ifndef TOE_KEEPALIVE_IDLE_S_CFG
+  #define TOE_KEEPALIVE_IDLE_S_CFG   7200
+#endif
+#ifndef TOE_KEEPALIVE_INTVL_S_CFG
+  #define TOE_KEEPALIVE_INTVL_S_CFG  75
+#endif
+#ifndef TOE_KEEPALIVE_PROBES_CFG
+  #define TOE_KEEPALIVE_PROBES_CFG   9
+#endif
+#if (TOE_KEEPALIVE_IDLE_S_CFG < 0) || (TOE_KEEPALIVE_IDLE_S_CFG > 86400)
+  #error "TOE_KEEPALIVE_IDLE_S_CFG must be in the range [0:86400]."
+#endif
+#if (TOE_KEEPALIVE_INTVL_S_CFG < 1) || (TOE_KEEPALIVE_INTVL_S_CFG > 3600)
+  #error "TOE_KEEPALIVE_INTVL_S_CFG must be in the range [1:3600]."
+#endif
+#if (TOE_KEEPALIVE_PROBES_CFG < 1) || (TOE_KEEPALIVE_PROBES_CFG > 15)
+  #error "TOE_KEEPALIVE_PROBES_CFG must be in the range [1:15]."
+#endif
+#ifndef TOE_KEEPALIVE_FAST_IDLE_S_CFG
+  #define TOE_KEEPALIVE_FAST_IDLE_S_CFG   60
+#endif
+#ifndef TOE_KEEPALIVE_FAST_INTVL_S_CFG
+  #define TOE_KEEPALIVE_FAST_INTVL_S_CFG  10
+#endif
+#ifndef TOE_KEEPALIVE_FAST_PROBES_CFG
+  #define TOE_KEEPALIVE_FAST_PROBES_CFG   3
+#endif
+#if (TOE_KEEPALIVE_FAST_IDLE_S_CFG < 1) || (TOE_KEEPALIVE_FAST_IDLE_S_CFG > 86400)
+  #error "TOE_KEEPALIVE_FAST_IDLE_S_CFG must be in the range [1:86400]."
+#endif
+#if (TOE_KEEPALIVE_FAST_INTVL_S_CFG < 1) || (TOE_KEEPALIVE_FAST_INTVL_S_CFG > 3600)
+  #error "TOE_KEEPALIVE_FAST_INTVL_S_CFG must be in the range [1:3600]."
+#endif
+#if (TOE_KEEPALIVE_FAST_PROBES_CFG < 1) || (TOE_KEEPALIVE_FAST_PROBES_CFG > 15)
+  #error "TOE_KEEPALIVE_FAST_PROBES_CFG must be in the range [1:15]."
+#endif
+
+//-- The passive opens of the TOE can be protected against SYN floods with SYN
+//--  cookies at build time (e.g. '-DTOE_SYN_COOKIE_CFG=1'). A SYN is then
+//--  answered with a stateless SYN-ACK whose sequence number encodes the
+//--  connection, and a session is only created when the ACK of that cookie
+//--  returns. The cookies are keyed with TOE_SYN_COOKIE_SECRET_CFG, which
+//--  should be changed for every deployment (e.g. '-DTOE_SYN_COOKIE_SECRET_CFG=
+//--  0x1234ABCD'), and they expire after 1 to 2 minutes.
+#ifndef TOE_SYN_COOKIE_CFG
+  #define TOE_SYN_COOKIE_CFG         0
+#endif
+#ifndef TOE_SYN_COOKIE_SECRET_CFG
+  #define TOE_SYN_COOKIE_SECRET_CFG  0x9E3779B9
+#endif
+
+//-- A session closed by the TOE is held in TIME-WAIT for TOE_TIME_WAIT_S_CFG
+//--  seconds (i.e. 2*MSL) before it gets released. A listening port can be
+//--  opened with a short TIME-WAIT of TOE_TIME_WAIT_SHORT_MS_CFG milliseconds
+//--  instead, by setting the 'twShort' flag of its listen request (see 'TcpAppLsnReq').
+//--  Whatever its duration, a TIME-WAIT session is reused in place by a new
+//--  SYN of the same socket pair with a higher sequence number [RFC-6191].
+#ifndef TOE_TIME_WAIT_S_CFG
+  #define TOE_TIME_WAIT_S_CFG        60
+#endif
+#ifndef TOE_TIME_WAIT_SHORT_MS_CFG
+  #define TOE_TIME_WAIT_SHORT_MS_CFG 100
+#endif
+#if (TOE_TIME_WAIT_S_CFG < 1) || (TOE_TIME_WAIT_S_CFG > 240)
+  #error "TOE_TIME_WAIT_S_CFG must be in the range [1:240]."
+#endif
+#if (TOE_TIME_WAIT_SHORT_MS_CFG < 1) || (TOE_TIME_WAIT_SHORT_MS_CFG > (1000*TOE_TIME_WAIT_S_CFG))
+  #error "TOE_TIME_WAIT_SHORT_MS_CFG must be in the range [1:1000*TOE_TIME_WAIT_S_CFG]."
+#endif
 
 /*******************************************************************************
  * CONFIGURATION - TRANSPORT LAYER-4 - UDP
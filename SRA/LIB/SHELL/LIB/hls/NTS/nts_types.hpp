@@ -480,12 +480,15 @@ class CamSessionUpdateReply {
     RtlSessId        sessionID; // 14 bits
     LkpSrcBit        source;    //  1 bit : '0' is [RXe],  '1' is [TAi]
     LkpOpBit         op;        //  1 bit : '0' is INSERT, '1' is DELETE
+    StsBit           status;    //  1 bit : '0' is KO (e.g. CAM is full), '1' is OK
 
     CamSessionUpdateReply() {}
     CamSessionUpdateReply(LkpOpBit op, LkpSrcBit src) :
-        op(op), source(src) {}
+        op(op), source(src), status(STS_OK) {}
     CamSessionUpdateReply(RtlSessId id, LkpOpBit op, LkpSrcBit src) :
-        sessionID(id), op(op), source(src) {}
+        sessionID(id), op(op), source(src), status(STS_OK) {}
+    CamSessionUpdateReply(RtlSessId id, LkpOpBit op, LkpSrcBit src, StsBit sts) :
+        sessionID(id), op(op), source(src), status(sts) {}
 };
 
 #endif
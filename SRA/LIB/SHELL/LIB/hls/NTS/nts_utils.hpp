@@ -122,6 +122,136 @@ ap_uint<32>    byteSwap32(ap_uint<32> inputValue);
 ap_uint<48>    byteSwap48(ap_uint<48> inputValue);
 ap_uint<64>    byteSwap64(ap_uint<64> inputValue);
 
+/*******************************************************************************
+ * ONE'S COMPLEMENT CHECKSUM - WIDTH-GENERIC HELPERS
+ *  The Internet checksum [RFC-1071] of a stream of 'W'-bit chunks is computed
+ *  in two steps:
+ *   1) 'csumChunk()' sums the 'W/16' words of a chunk with a balanced adder
+ *      tree. The tree does not depend on the previous chunks and can therefore
+ *      be pipelined at will by the tool.
+ *   2) The chunk sums are added to a carry-save accumulator ('CsumAcc') whose
+ *      upper bits save the end-around carries instead of folding them back
+ *      after every chunk. The carries are folded once per packet by 'csumFold()'.
+ *  A 32-bit accumulator absorbs 2^16 words, i.e. the largest IPv4 packet.
+ *******************************************************************************/
+typedef ap_uint<32>    CsumAcc;
+
+/*******************************************************************************
+ * @brief Sums the 16-bit words of a chunk in network order.
+ *
+ * @param[in] chunk  A chunk of 'W' bits. Its bytes are ignored unless their
+ *                    'tkeep' bit is set.
+ *
+ * @return the sum of the 'W/16' words (without end-around carry).
+ *******************************************************************************/
+template<int W>
+ap_uint<16+log2Ceil<W/16>::val> csumChunk(const AxisRawT<W> &chunk)
+{
+    #pragma HLS INLINE
+    ap_uint<16+log2Ceil<W/16>::val> sums[W/16];
+    #pragma HLS ARRAY_PARTITION variable=sums complete dim=1
+    for (int i=0; i<W/16; i++) {
+        #pragma HLS UNROLL
+        ap_uint<8> msb = chunk.getLE_TData(16*i+ 7, 16*i  );
+        ap_uint<8> lsb = chunk.getLE_TData(16*i+15, 16*i+8);
+        if (chunk.getLE_TKeep()[2*i  ] == 0) { msb = 0; }
+        if (chunk.getLE_TKeep()[2*i+1] == 0) { lsb = 0; }
+        sums[i] = (msb, lsb);
+    }
+    for (int n=W/32; n>0; n/=2) {
+        #pragma HLS UNROLL
+        for (int i=0; i<n; i++) {
+            #pragma HLS UNROLL
+            sums[i] = sums[2*i] + sums[2*i+1];
+        }
+    }
+    return sums[0];
+}
+
+/*******************************************************************************
+ * @brief Folds the saved carries of a checksum accumulator.
+ *
+ * @param[in] acc  A carry-save accumulator.
+ *
+ * @return the 16-bit one's complement sum (i.e. the checksum before its final
+ *   inversion). A packet with a valid checksum sums up to 0xFFFF.
+ *******************************************************************************/
+inline ap_uint<16> csumFold(CsumAcc acc)
+{
+    #pragma HLS INLINE
+    ap_uint<17> sum = acc(15, 0) + acc(31, 16);
+    return sum(15, 0) + sum[16];
+}
+
+/*******************************************************************************
+ * @brief Incrementally updates a checksum after a 16-bit word of its header
+ *   was rewritten [RFC-1624]: HC' = ~(~HC + ~m + m').
+ *
+ * @param[in] oldCsum  The checksum before the rewrite (HC).
+ * @param[in] oldWord  The old value of the rewritten word (m).
+ * @param[in] newWord  The new value of the rewritten word (m').
+ *
+ * @return the new checksum (HC').
+ *******************************************************************************/
+inline ap_uint<16> csumIncrUpdate(ap_uint<16> oldCsum, ap_uint<16> oldWord, ap_uint<16> newWord)
+{
+    #pragma HLS INLINE
+    CsumAcc acc = (CsumAcc)((ap_uint<16>)~oldCsum) + (ap_uint<16>)~oldWord + newWord;
+    return ~csumFold(acc);
+}
+
+/*******************************************************************************
+ * FAST-CLEAR TABLE
+ *  A table of 'D' words of type 'T' that is cleared in one clock cycle instead
+ *  of being walked entry by entry after a reset. Every word of the table has a
+ *  valid bit, and these valid bits are kept in a two-level bitmap:
+ *   - 'vldWords' holds the valid bits of the table words, 32 per bitmap word,
+ *   - 'vldSummary' is a register with one bit per word of 'vldWords'.
+ *  'clear()' only resets the summary register. A table word that has not been
+ *  written since then reads as the default value passed to 'clear()'. Writing
+ *  a word sets its valid bit, as well as the summary bit of its bitmap word,
+ *  while the other bits of a stale bitmap word are cleared at the same time.
+ *  'D' must be a multiple of 32.
+ *
+ * Usage:
+ *   static FastClrTable<ap_uint<32>, 1024> TABLE;
+ *   if (!isInit) { TABLE.clear(0); isInit = true; }
+ *   else         { word = TABLE.read(idx); ... TABLE.write(idx, word); }
+ *******************************************************************************/
+template<typename T, int D>
+class FastClrTable {
+  public:
+    typedef ap_uint<log2Ceil<D>::val>       Index;
+    T                   words[D];           // The table words (never cleared)
+    ap_uint<32>         vldWords[D/32];     // One valid bit per table word
+    ap_uint<D/32>       vldSummary;         // One valid bit per word of 'vldWords'
+    T                   dfltWord;           // The value of a cleared table word
+    //-- Clears the whole table
+    void clear(T dflt) {
+        #pragma HLS INLINE
+        vldSummary = 0;
+        dfltWord   = dflt;
+    }
+    //-- Returns a table word, or the default value if it was not written since the last clear
+    T read(Index idx) {
+        #pragma HLS INLINE
+        ap_uint<log2Ceil<D/32>::val+1> vldIdx = idx >> 5;
+        ap_uint<32> vldWord = (vldSummary[vldIdx] == 1) ? vldWords[vldIdx] : (ap_uint<32>)0;
+        T           word    = words[idx];
+        return (vldWord[idx & 31] == 1) ? word : dfltWord;
+    }
+    //-- Writes a table word and marks it as valid
+    void write(Index idx, T word) {
+        #pragma HLS INLINE
+        ap_uint<log2Ceil<D/32>::val+1> vldIdx = idx >> 5;
+        ap_uint<32> vldWord = (vldSummary[vldIdx] == 1) ? vldWords[vldIdx] : (ap_uint<32>)0;
+        vldWord[idx & 31]   = 1;
+        vldWords[vldIdx]    = vldWord;
+        vldSummary[vldIdx]  = 1;
+        words[idx]          = word;
+    }
+};
+
 /*******************************************************************************
  * ENUM TO STRING HELPERS - PROTOTYPE DEFINITIONS
  *******************************************************************************/
@@ -53,6 +53,90 @@ set hlsCSynth    $::env(hlsCSynth)
 set hlsCoSim     $::env(hlsCoSim)
 set hlsRtl       $::env(hlsRtl)
 
+# Retrieve the max. number of TCP sessions from ENV (defaults to 8)
+#-------------------------------------------------
+if { [info exists ::env(toeMaxSessions)] } {
+    set toeMaxSessions $::env(toeMaxSessions)
+} else {
+    set toeMaxSessions 8
+}
+
+# Retreive the congestion control algorithm from ENV (0=Reno, 1=CUBIC, 2=DCTCP)
+#-------------------------------------------------
+if { [info exists ::env(toeCcAlgo)] } {
+    set toeCcAlgo $::env(toeCcAlgo)
+} else {
+    set toeCcAlgo 0
+}
+
+# Retrieve the log2 of the per-session Rx/Tx buffer size from ENV (defaults to 16, i.e. 64KB)
+#-------------------------------------------------
+if { [info exists ::env(toeWindowBits)] } {
+    set toeWindowBits $::env(toeWindowBits)
+} else {
+    set toeWindowBits 16
+}
+
+# Retrieve the number of pages of the optional Rx/Tx buffer pool from ENV (defaults to 0, i.e. no pool)
+#-------------------------------------------------
+if { [info exists ::env(toeBufPoolPages)] } {
+    set toeBufPoolPages $::env(toeBufPoolPages)
+} else {
+    set toeBufPoolPages 0
+}
+
+# Retrieve the optional override of the spill regions of the Rx/Tx buffers from ENV (defaults to none)
+#-------------------------------------------------
+if { [info exists ::env(toeSpill)] } {
+    set toeSpill $::env(toeSpill)
+} else {
+    set toeSpill ""
+}
+
+# Retrieve the optional enabling of the cut-through Rx path from ENV (defaults to none)
+#-------------------------------------------------
+if { [info exists ::env(toeCutThrough)] } {
+    set toeCutThrough $::env(toeCutThrough)
+} else {
+    set toeCutThrough ""
+}
+
+# Retrieve the optional enabling of the SYN cookies from ENV (defaults to none)
+#-------------------------------------------------
+if { [info exists ::env(toeSynCookie)] } {
+    set toeSynCookie $::env(toeSynCookie)
+} else {
+    set toeSynCookie ""
+}
+
+# Retrieve the testbench of an optional benchmark from ENV (defaults to none)
+#-------------------------------------------------
+if { [info exists ::env(toeBench)] } {
+    set toeBench $::env(toeBench)
+} else {
+    set toeBench ""
+}
+# Retrieve the arguments of an optional single test vector of the TOE testbench from ENV (defaults to none)
+#-------------------------------------------------
+if { [info exists ::env(toeVector)] } {
+    set toeVector $::env(toeVector)
+} else {
+    set toeVector ""
+}
+set toeCFlags    "-DTOE_MAX_SESSIONS_CFG=${toeMaxSessions} -DTOE_CC_ALGO_CFG=${toeCcAlgo} -DTOE_WINDOW_BITS_CFG=${toeWindowBits}"
+if { ${toeBufPoolPages} > 0 } {
+    append toeCFlags " -DTOE_BUF_POOL_CFG=1 -DTOE_BUF_POOL_PAGES_CFG=${toeBufPoolPages}"
+}
+if { ${toeSpill} != "" } {
+    append toeCFlags " -DTOE_SPILL_CFG=${toeSpill}"
+}
+if { ${toeCutThrough} != "" } {
+    append toeCFlags " -DTOE_RX_CUT_THROUGH_CFG=${toeCutThrough}"
+}
+if { ${toeSynCookie} != "" } {
+    append toeCFlags " -DTOE_SYN_COOKIE_CFG=${toeSynCookie}"
+}
+
 # Set Project Environment Variables  
 #-------------------------------------------------
 set currDir      [pwd]
@@ -78,26 +162,34 @@ open_project  ${projectName}_prj
 
 # Add files
 #-------------------------------------------------
-add_files     ${srcDir}/${projectName}.cpp -cflags "-DHLS_VERSION=${HLS_VERSION}"
-add_files     ${srcDir}/toe_utils.cpp
-add_files     ${currDir}/../../NTS/nts_utils.cpp
+add_files     ${srcDir}/${projectName}.cpp -cflags "-DHLS_VERSION=${HLS_VERSION} ${toeCFlags}"
+add_files     ${srcDir}/toe_utils.cpp -cflags "${toeCFlags}"
+add_files     ${currDir}/../../NTS/nts_utils.cpp -cflags "${toeCFlags}"
 #
-add_files     ${srcDir}/ack_delay/src/ack_delay.cpp
-add_files     ${srcDir}/event_engine/event_engine.cpp
-add_files     ${srcDir}/port_table/port_table.cpp
-add_files     ${srcDir}/rx_app_interface/rx_app_interface.cpp
-add_files     ${srcDir}/rx_engine/src/rx_engine.cpp
-add_files     ${srcDir}/rx_sar_table/rx_sar_table.cpp
-add_files     ${srcDir}/session_lookup_controller/session_lookup_controller.cpp
-add_files     ${srcDir}/state_table/state_table.cpp
-add_files     ${srcDir}/timers/timers.cpp
-add_files     ${srcDir}/tx_app_interface/tx_app_interface.cpp
-add_files     ${srcDir}/tx_engine/src/tx_engine.cpp
-add_files     ${srcDir}/tx_sar_table/tx_sar_table.cpp
-
-add_files -tb ${testDir}/test_${projectName}.cpp -cflags "-DHLS_VERSION=${HLS_VERSION} -fstack-check"
-add_files -tb ${currDir}/../../NTS/SimNtsUtils.cpp
-add_files -tb ${currDir}/test/dummy_memory/dummy_memory.cpp
+add_files     ${srcDir}/ack_delay/src/ack_delay.cpp -cflags "${toeCFlags}"
+add_files     ${srcDir}/buffer_pool/buffer_pool.cpp -cflags "${toeCFlags}"
+add_files     ${srcDir}/congestion_control/congestion_control.cpp -cflags "${toeCFlags}"
+add_files     ${srcDir}/event_engine/event_engine.cpp -cflags "${toeCFlags}"
+add_files     ${srcDir}/port_table/port_table.cpp -cflags "${toeCFlags}"
+add_files     ${srcDir}/rx_app_interface/rx_app_interface.cpp -cflags "${toeCFlags}"
+add_files     ${srcDir}/rx_engine/src/rx_engine.cpp -cflags "${toeCFlags}"
+add_files     ${srcDir}/rx_sar_table/rx_sar_table.cpp -cflags "${toeCFlags}"
+add_files     ${srcDir}/session_lookup_controller/session_lookup_controller.cpp -cflags "${toeCFlags}"
+add_files     ${srcDir}/state_table/state_table.cpp -cflags "${toeCFlags}"
+add_files     ${srcDir}/timers/timers.cpp -cflags "${toeCFlags}"
+add_files     ${srcDir}/tx_app_interface/tx_app_interface.cpp -cflags "${toeCFlags}"
+add_files     ${srcDir}/tx_engine/src/tx_engine.cpp -cflags "${toeCFlags}"
+add_files     ${srcDir}/tx_sar_table/tx_sar_table.cpp -cflags "${toeCFlags}"
+
+if { ${toeBench} != "" } {
+    add_files -tb ${currDir}/${toeBench} -cflags "-DHLS_VERSION=${HLS_VERSION} ${toeCFlags}"
+    add_files -tb ${currDir}/../../NTS/SimNtsUtils.cpp -cflags "${toeCFlags}"
+    add_files -tb ${currDir}/test/dummy_memory/dummy_memory.cpp -cflags "${toeCFlags}"
+} else {
+    add_files -tb ${testDir}/test_${projectName}.cpp -cflags "-DHLS_VERSION=${HLS_VERSION} ${toeCFlags} -fstack-check"
+    add_files -tb ${currDir}/../../NTS/SimNtsUtils.cpp -cflags "${toeCFlags}"
+    add_files -tb ${currDir}/test/dummy_memory/dummy_memory.cpp -cflags "${toeCFlags}"
+}
 
 # Set toplevel
 #-------------------------------------------------
@@ -170,6 +262,24 @@ if { $hlsCSim} {
     puts "####          SUCCESSFUL END OF COMPILATION              ####"
     puts "####                                                     ####"
     puts "#############################################################"
+    if { ${toeBench} != "" } {
+        csim_design
+        puts "#############################################################"
+        puts "####                                                     ####"
+        puts "####          SUCCESSFUL END OF C SIMULATION             ####"
+        puts "####                                                     ####"
+        puts "#############################################################"
+        exit
+    }
+    if { ${toeVector} != "" } {
+        csim_design -argv "${toeVector}"
+        puts "#############################################################"
+        puts "####                                                     ####"
+        puts "####          SUCCESSFUL END OF C SIMULATION             ####"
+        puts "####                                                     ####"
+        puts "#############################################################"
+        exit
+    }
     csim_design -argv "0 ../../../../test/testVectors/siIPRX_OneSynPkt.dat"
     csim_design -argv "0 ../../../../test/testVectors/siIPRX_OneSynMssPkt.dat"
     csim_design -argv "0 ../../../../test/testVectors/siIPRX_OnePkt.dat"
@@ -204,6 +314,15 @@ if { $hlsCSim} {
     csim_design -argv "1 ../../../../test/testVectors/siTAIF_8SegIn8Sess.dat"
     csim_design -argv "1 ../../../../test/testVectors/siTAIF_SixtyFourSeg.dat"
     csim_design -argv "1 ../../../../test/testVectors/siTAIF_Ramp.dat"
+    csim_design -argv "1 ../../../../test/testVectors/siTAIF_DelayLoss.dat"
+    csim_design -argv "1 ../../../../test/testVectors/siTAIF_TcpLoss1.dat"
+    csim_design -argv "1 ../../../../test/testVectors/siTAIF_TcpLoss2.dat"
+    if { ${toeMaxSessions} >= 1024 } {
+        csim_design -argv "1 ../../../../test/testVectors/siTAIF_1KSess.dat"
+    }
+    if { ${toeCcAlgo} == 2 } {
+        csim_design -argv "1 ../../../../test/testVectors/siTAIF_TcpEcn.dat"
+    }
    
     csim_design -argv "3 ../../../../test/testVectors/siIPRX_OneSynPkt.dat"
     csim_design -argv "3 ../../../../test/testVectors/siIPRX_OneSynMssPkt.dat"
@@ -84,13 +84,22 @@ using namespace hls;
  * @param[out] soTXe_Event      Event to Tx Engine (TXe).
  *
  * @details
- *  This process manages the transmission delay of the ACKs. Upon reception
- *   of an ACK, the counter associated to the corresponding session is
- *   initialized to (64us/MAX_SESSIONS). Next, this counter is decremented
- *   every (MAX_SESSIONS) until it reaches zero. At that time, a request to
- *   generate an ACK for that session is forwarded to the TxEngine (Txe).
- *  If the pace of incoming segments increases, the rate of returned ACKs is
- *   also increased.
+ *  This process manages the transmission delay of the ACKs according to the
+ *   ACK policy of each session, which the RxEngine (RXe) conveys with the type
+ *   of its ACK events (see TOE_ACK_POLICY_CFG):
+ *   - ACK_NODELAY_EVENT  : the ACK is forwarded to the TxEngine (TXe) at once.
+ *   - ACK_EVENT          : an ACK is forwarded after 'TOE_ACK_EVERY_N_CFG'
+ *                          segments or when the delay of the first one expires.
+ *   - ACK_COALESCE_EVENT : a single ACK is forwarded when the delay expires.
+ *  Upon the first unacknowledged segment of a session, a deadline of
+ *   'ACKD_TIMEOUT' cycles is pushed into the ACK queue. The queue is ordered
+ *   by construction, and only its head is compared with the current time.
+ *   Therefore, the latency of a delayed ACK does not depend on the number of
+ *   sessions anymore. An expired deadline has priority over the incoming
+ *   events, which are buffered by the FiFo from [EVe] in the meantime.
+ *  Any other event forwarded to [TXe] carries the latest acknowledgment number
+ *   and therefore clears the pending ACK of the session. A SYN cookie event has
+ *   no session and is forwarded as is.
  *******************************************************************************/
 void ack_delay(
         stream<ExtendedEvent>   &siEVe_Event,
@@ -105,137 +114,102 @@ void ack_delay(
 
     //-- STATIC ARRAYS ---------------------------------------------------------
     static AckEntry                 ACK_TABLE[TOE_MAX_SESSIONS];
+  #if TOE_USE_URAM
+    #pragma HLS RESOURCE   variable=ACK_TABLE core=XPM_MEMORY uram
+  #else
     #pragma HLS RESOURCE   variable=ACK_TABLE core=RAM_T2P_BRAM
+  #endif
+    #pragma HLS DATA_PACK  variable=ACK_TABLE
     #pragma HLS DEPENDENCE variable=ACK_TABLE inter false
 
+    static AckTimer                 ACK_QUEUE[TOE_MAX_SESSIONS];
+  #if TOE_USE_URAM
+    #pragma HLS RESOURCE   variable=ACK_QUEUE core=XPM_MEMORY uram
+  #else
+    #pragma HLS RESOURCE   variable=ACK_QUEUE core=RAM_T2P_BRAM
+  #endif
+    #pragma HLS DATA_PACK  variable=ACK_QUEUE
+    #pragma HLS DEPENDENCE variable=ACK_QUEUE inter false
+
     //-- STATIC CONTROL VARIABLES (with RESET) ---------------------------------
-    // [TODO - The type of 'akd_Ptr' could be configured as a functions of 'MAX_SESSIONS']
-    // [ E.g. - static const int NR_BITS = ceil(log10(MAX_SESSIONS)/log10(2));
-    static SessionId           akd_Ptr;
-    #pragma HLS RESET variable=akd_Ptr
+    static AckTime             akd_now=0;
+    #pragma HLS RESET variable=akd_now
+    static SessionId           akd_qHead=0;
+    #pragma HLS RESET variable=akd_qHead
+    static SessionId           akd_qTail=0;
+    #pragma HLS RESET variable=akd_qTail
+    static ap_uint<15>         akd_qCnt=0;
+    #pragma HLS RESET variable=akd_qCnt
 
     //-- DYNAMIC VARIABLES -----------------------------------------------------
     ExtendedEvent ev;
-
-    if (!siEVe_Event.empty()) {
+    AckTimer      headTimer = ACK_QUEUE[akd_qHead];
+    bool          headDue   = (akd_qCnt != 0) and
+                              ((ap_int<20>)(akd_now - headTimer.deadline) >= 0);
+
+    if (headDue and !soTXe_Event.full()) {
+        //-- The oldest deadline expired
+        AckEntry entry = ACK_TABLE[headTimer.sessId];
+        if (entry.count != 0) {
+            soTXe_Event.write(Event(ACK_EVENT, headTimer.sessId));
+            // Tell the EventEngine that we just forwarded an event to TXe
+            assessSize(myName, soEVe_TxEventSig, "soEVe_TxEventSig", cDepth_AKdToEVe_Event);
+            soEVe_TxEventSig.write(1);
+            if (DEBUG_LEVEL & TRACE_AKD) {
+                printInfo(myName, "S%d - It's ACK Time (count=%d) - Requesting [TXe] to generate an new ACK\n",
+                          headTimer.sessId.to_int(), entry.count.to_uint());
+            }
+        }
+        ACK_TABLE[headTimer.sessId] = AckEntry(0, 0);
+        akd_qHead = (akd_qHead == TOE_MAX_SESSIONS-1) ? (SessionId)0 : (SessionId)(akd_qHead + 1);
+        akd_qCnt--;
+    }
+    else if (!siEVe_Event.empty()) {
 
         // Read incoming event and inform [EVe] that the FiFo stream was read
         siEVe_Event.read(ev);
         assessSize(myName, soEVe_RxEventSig, "soEVe_RxEventSig", cDepth_AKdToEVe_Event);
         soEVe_RxEventSig.write(1);
 
-        if (ev.type == ACK_EVENT) {
-            /*************************
-            switch (ACK_TABLE[ev.sessionID].count) {
-            case 0: // There is no delayed ACK pending --> Schedule a new one
-                ACK_TABLE[ev.sessionID] = AckEntry(ACKD_64us, 1);
-                break;
-            case 1: // Received a second ACK  --> Decrease the delay
-                if (ACK_TABLE[ev.sessionID].delay > ACKD_32us) {
-                    ACK_TABLE[ev.sessionID].delay = ACKD_32us;
-                }
-                ACK_TABLE[ev.sessionID].count++;
-                break;
-            case 2: // Received a third ACK   --> Decrease the delay
-                if (ACK_TABLE[ev.sessionID].delay > ACKD_16us) {
-                    ACK_TABLE[ev.sessionID].delay = ACKD_16us;
-                }
-                ACK_TABLE[ev.sessionID].count++;
-                break;
-            case 3: // Received a fourth ACK  --> Decrease the delay
-                if (ACK_TABLE[ev.sessionID].delay > ACKD_8us) {
-                    ACK_TABLE[ev.sessionID].delay = ACKD_8us;
-                }
-                ACK_TABLE[ev.sessionID].count++;
-                break;
-            case 4: // Received a fifth ACK   --> Decrease the delay
-                if (ACK_TABLE[ev.sessionID].delay > ACKD_4us) {
-                    ACK_TABLE[ev.sessionID].delay = ACKD_4us;
-                }
-                ACK_TABLE[ev.sessionID].count++;
-                break;
-            case 5: // Received a sixth ACK   --> Decrease the delay
-                if (ACK_TABLE[ev.sessionID].delay > ACKD_2us) {
-                    ACK_TABLE[ev.sessionID].delay = ACKD_2us;
-                }
-                ACK_TABLE[ev.sessionID].count++;
-                break;
-            case 6: // Received a seventh ACK --> Decrease the delay
-                if (ACK_TABLE[ev.sessionID].delay > ACKD_1us) {
-                    ACK_TABLE[ev.sessionID].delay = ACKD_1us;
-                }
-                ACK_TABLE[ev.sessionID].count++;
-                break;
-            default: // Received a eight+ ACK --> Set delay to ONE
-                ACK_TABLE[ev.sessionID].delay = 1;
-                ACK_TABLE[ev.sessionID].count = 8;
-                break;
-            } // End of: switch
-            ***************************/
-
-            if (ACK_TABLE[ev.sessionID].delay == 0) {
-            	// There is no delayed ACK pending --> Schedule a new one
-                ACK_TABLE[ev.sessionID] = AckEntry(ACKD_64us, 1);
+        // Read-modify-write the entire (packed) entry
+        //  A SYN cookie event has no session; its session ID holds the information of the cookie
+        SessionId sessId = (ev.type == SYN_COOKIE_EVENT) ? (SessionId)0 : ev.sessionID;
+        AckEntry  entry  = ACK_TABLE[sessId];
+        if ((ev.type == ACK_EVENT) or (ev.type == ACK_COALESCE_EVENT)) {
+            if (entry.count != 15) {
+                entry.count++;
             }
-            else if (ACK_TABLE[ev.sessionID].count == 1) {
-            	// Received a second ACK  --> Decrease the delay
-                if (ACK_TABLE[ev.sessionID].delay > ACKD_32us) {
-                    ACK_TABLE[ev.sessionID].delay = ACKD_32us;
-                }
-                ACK_TABLE[ev.sessionID].count++;
-            }
-            else if (ACK_TABLE[ev.sessionID].count == 2) {
-            	// Received a third ACK   --> Decrease the delay
-                if (ACK_TABLE[ev.sessionID].delay > ACKD_16us) {
-                    ACK_TABLE[ev.sessionID].delay = ACKD_16us;
-                }
-                ACK_TABLE[ev.sessionID].count++;
-            }
-            else if (ACK_TABLE[ev.sessionID].count == 3) {
-            	// Received a fourth ACK  --> Decrease the delay
-                if (ACK_TABLE[ev.sessionID].delay > ACKD_8us) {
-                    ACK_TABLE[ev.sessionID].delay = ACKD_8us;
-                }
-                ACK_TABLE[ev.sessionID].count++;
-            }
-            else if (ACK_TABLE[ev.sessionID].count == 4) {
-            	// Received a fifth ACK   --> Decrease the delay
-                if (ACK_TABLE[ev.sessionID].delay > ACKD_4us) {
-                    ACK_TABLE[ev.sessionID].delay = ACKD_4us;
-                }
-                ACK_TABLE[ev.sessionID].count++;
-            }
-            else if (ACK_TABLE[ev.sessionID].count == 5) {
-            	// Received a sixth ACK   --> Decrease the delay
-                if (ACK_TABLE[ev.sessionID].delay > ACKD_2us) {
-                    ACK_TABLE[ev.sessionID].delay = ACKD_2us;
-                }
-                ACK_TABLE[ev.sessionID].count++;
-            }
-            else if (ACK_TABLE[ev.sessionID].count == 6) {
-            	// Received a seventh ACK --> Decrease the delay
-                if (ACK_TABLE[ev.sessionID].delay > ACKD_1us) {
-                    ACK_TABLE[ev.sessionID].delay = ACKD_1us;
-                }
-                ACK_TABLE[ev.sessionID].count++;
+            if ((ev.type == ACK_EVENT) and (entry.count >= TOE_ACK_EVERY_N_CFG)) {
+                // Enough segments were received --> Request an ACK right away
+                //  ([EVe] accounts for this event in its Tx credits)
+                assessSize(myName, soTXe_Event, "soTXe_Event", cDepth_AKdToTXe_Event);
+                soTXe_Event.write(ev);
+                assessSize(myName, soEVe_TxEventSig, "soEVe_TxEventSig", cDepth_AKdToEVe_Event);
+                soEVe_TxEventSig.write(1);
+                entry.count = 0;
             }
-            else if (ACK_TABLE[ev.sessionID].count == 7) {
-            	// Received a eight+ ACK --> Set delay to ONE
-                ACK_TABLE[ev.sessionID].delay = 1;
-                ACK_TABLE[ev.sessionID].count = 8;
+            else if (!entry.queued) {
+                // First unacknowledged segment --> Arm a new deadline
+                ACK_QUEUE[akd_qTail] = AckTimer(ev.sessionID, akd_now + ACKD_TIMEOUT);
+                akd_qTail = (akd_qTail == TOE_MAX_SESSIONS-1) ? (SessionId)0 : (SessionId)(akd_qTail + 1);
+                akd_qCnt++;
+                entry.queued = 1;
             }
             // Debug trace
             if (DEBUG_LEVEL & TRACE_AKD) {
-                printInfo(myName, "S%d - Received \'%s\' - Setting  ACK_TABLE[%d]={D=%4.4d,C=%2.2d}\n",
+                printInfo(myName, "S%d - Received \'%s\' - Setting  ACK_TABLE[%d]={C=%2.2d,Q=%d}\n",
                           ev.sessionID.to_int(), getEventName(ev.type),
                           ev.sessionID.to_uint(),
-                          ACK_TABLE[ev.sessionID].delay.to_uint(),
-                          ACK_TABLE[ev.sessionID].count.to_uint());
+                          entry.count.to_uint(),
+                          entry.queued.to_uint());
             }
         }
         else {
-            // Received any other event --> Reset current entry
-            ACK_TABLE[ev.sessionID] = AckEntry(0, 0);
+            // Received any other event --> Clear the pending ACK (a queued
+            //  deadline is left to expire on its own)
+            if (ev.type != SYN_COOKIE_EVENT) {
+                entry.count = 0;
+            }
             // Forward event to TxEngine
             assessSize(myName, soTXe_Event, "soTXe_Event", cDepth_AKdToTXe_Event);
             soTXe_Event.write(ev);
@@ -244,126 +218,14 @@ void ack_delay(
             soEVe_TxEventSig.write(1);
             // Debug trace
             if (DEBUG_LEVEL & TRACE_AKD) {
-                printInfo(myName, "S%d - Received '%s' - Clearing ACK_TABLE[%d]={D=%4.4d,C=%2.2d}\n",
+                printInfo(myName, "S%d - Received '%s' - Clearing ACK_TABLE[%d]\n",
                                   ev.sessionID.to_int(), getEventName(ev.type),
-                                  ev.sessionID.to_uint(),
-                                  ACK_TABLE[ev.sessionID].delay.to_uint(),
-                                  ACK_TABLE[ev.sessionID].count.to_uint());
+                                  ev.sessionID.to_uint());
             }
         }
+        ACK_TABLE[sessId] = entry;
     }
-    else {
-        if (ACK_TABLE[akd_Ptr].delay > 0 and !soTXe_Event.full()) {
-            if (ACK_TABLE[akd_Ptr].delay == 1) {
-                soTXe_Event.write(Event(ACK_EVENT, akd_Ptr));
-                // Tell the EventEngine that we just forwarded an event to TXe
-                assessSize(myName, soEVe_TxEventSig, "soEVe_TxEventSig", cDepth_AKdToEVe_Event);
-                soEVe_TxEventSig.write(1);
-                // Do not clear the received ACK counter here. It will anyhow be
-                //  cleared whenever a new event comes in. Until then, it gives
-                //  us a good indication of its usage in the trace.
-                 if (DEBUG_LEVEL & TRACE_AKD) {
-                    printInfo(myName, "S%d - It's ACK Time (count=%d) - Requesting [TXe] to generate an new ACK\n",
-                              akd_Ptr.to_int(), ACK_TABLE[akd_Ptr].count.to_uint());
-                }
-            }
-            ACK_TABLE[akd_Ptr].delay -= 1;
-        }
-        akd_Ptr++;
-        if (akd_Ptr == TOE_MAX_SESSIONS) {
-            akd_Ptr = 0;
-        }
-    }
-}
-
-
-void ack_delay_OBSO (
-        stream<ExtendedEvent>   &siEVe_Event,
-        stream<SigBit>          &soEVe_RxEventSig,
-        stream<SigBit>          &soEVe_TxEventSig,
-        stream<ExtendedEvent>   &soTXe_Event)
-{
-    //-- DIRECTIVES FOR THIS PROCESS -------------------------------------------
-    #pragma HLS PIPELINE II=1 enable_flush
-
-    const char *myName = THIS_NAME;
 
-    //-- STATIC ARRAYS ---------------------------------------------------------
-    // [TODO - The type of 'ACK_TABLE' can be configured as a functions of 'TIME_XXX' and 'MAX_SESSIONS']
-    // [ E.g. - TIME_64us  = ( 64.000/0.0064/32) + 1 =  313 = 0x139 ( 9-bits)
-    // [ E.g. - TIME_64us  = ( 64.000/0.0064/ 8) + 1 = 1251 = 0x4E3 (11-bits)
-    // [ E.g. - TIME_128us = (128.000/0.0064/32) + 1 =  626 = 0x271 (10-bits)
-    static ap_uint<12>              ACK_TABLE[TOE_MAX_SESSIONS];
-    #pragma HLS RESOURCE   variable=ACK_TABLE core=RAM_T2P_BRAM
-    #pragma HLS DEPENDENCE variable=ACK_TABLE inter false
-    #pragma HLS RESET      variable=ACK_TABLE
-
-    //-- STATIC CONTROL VARIABLES (with RESET) ---------------------------------
-    // [TODO - The type of 'akd_Ptr' could be configured as a functions of 'MAX_SESSIONS']
-    // [ E.g. - static const int NR_BITS = ceil(log10(MAX_SESSIONS)/log10(2));
-    static SessionId           akd_Ptr;
-    #pragma HLS RESET variable=akd_Ptr
-
-    //-- DYNAMIC VARIABLES -----------------------------------------------------
-    ExtendedEvent ev;
-
-    if (!siEVe_Event.empty()) {
-
-        // Read incoming event and inform [EVe] that the FiFo stream was read
-        siEVe_Event.read(ev);
-        assessSize(myName, soEVe_RxEventSig, "soEVe_RxEventSig", cDepth_AKdToEVe_Event);
-        soEVe_RxEventSig.write(1);
-
-        if (ev.type == ACK_EVENT) {
-            if (ACK_TABLE[ev.sessionID] == 0) {
-                // There is no delayed ACK pending --> Schedule a new one
-                ACK_TABLE[ev.sessionID] = ACKD_64us;
-                if (DEBUG_LEVEL & TRACE_AKD) {
-                    printInfo(myName, "S%d - Received \'%s\' - Setting ACK_TABLE[%d]=%d\n",
-                              ev.sessionID.to_int(), getEventName(ev.type), ev.sessionID.to_uint(), ACK_TABLE[ev.sessionID].to_uint());
-                }
-            }
-            else {
-                if (DEBUG_LEVEL & TRACE_AKD) {
-                     printInfo(myName, "S%d - Received \'%s\' - Current ACK_TABLE[%d]=%d\n",
-                              ev.sessionID.to_int(), getEventName(ev.type), ev.sessionID.to_uint(), ACK_TABLE[ev.sessionID].to_uint());
-                }
-            }
-        }
-        else {
-            // Any other event
-            ACK_TABLE[ev.sessionID] = 0;
-            // Forward event to TxEngine
-            assessSize(myName, soTXe_Event, "soTXe_Event", cDepth_AKdToTXe_Event);
-            soTXe_Event.write(ev);
-            // Tell the EventEngine that we just forwarded an mone-ACK event to TXe
-            assessSize(myName, soEVe_TxEventSig, "soEVe_TxEventSig", cDepth_AKdToEVe_Event);
-            soEVe_TxEventSig.write(1);
-            // Debug trace
-            if (DEBUG_LEVEL & TRACE_AKD) {
-                printInfo(myName, "S%d - Received '%s' - Clearing ACK_TABLE[%d]=%d\n",
-                                  ev.sessionID.to_int(), getEventName(ev.type), ev.sessionID.to_uint(), ACK_TABLE[ev.sessionID].to_uint());
-            }
-        }
-    }
-    else {
-        if (ACK_TABLE[akd_Ptr] > 0 and !soTXe_Event.full()) {
-            if (ACK_TABLE[akd_Ptr] == 1) {
-                soTXe_Event.write(Event(ACK_EVENT, akd_Ptr));
-                // Tell the EventEngine that we just forwarded an event to TXe
-                assessSize(myName, soEVe_TxEventSig, "soEVe_TxEventSig", cDepth_AKdToEVe_Event);
-                soEVe_TxEventSig.write(1);
-                if (DEBUG_LEVEL & TRACE_AKD) {
-                    printInfo(myName, "S%d - It's ACK Time - Requesting [TXe] to generate an new ACK\n",
-                              akd_Ptr.to_int());
-                }
-            }
-            ACK_TABLE[akd_Ptr] -= 1;
-        }
-        akd_Ptr++;
-        if (akd_Ptr == TOE_MAX_SESSIONS) {
-            akd_Ptr = 0;
-        }
-    }
+    akd_now++;
 }
 
@@ -62,24 +62,36 @@ EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 using namespace hls;
 
 /*******************************************************************************
- * ACK Table (RSt)
- *  Structure to manage the transmission rate of the ACKs.
- *
- * [TODO - The type of 'AckEntry.delay' can be configured as a functions of 'TIME_XXX' and 'MAX_SESSIONS']
- *   [ E.g. - TIME_64us  = ( 64.000/0.0064/32) + 1 =  313 = 0x139 ( 9-bits)
- *   [ E.g. - TIME_64us  = ( 64.000/0.0064/ 8) + 1 = 1251 = 0x4E3 (11-bits)
- *   [ E.g. - TIME_128us = (128.000/0.0064/32) + 1 =  626 = 0x271 (10-bits)
+ * ACK Table (AKd)
+ *  Structure to keep track of the segments which were not acknowledged yet.
  *******************************************************************************/
 class AckEntry {
   public:
-    ap_uint<12> delay;  // Keeps track of the elapsed time
-    ap_uint<4>  count;  // Counts the number of received ACKs
+    ap_uint<4>  count;   // Number of segments waiting for an ACK
+    ap_uint<1>  queued;  // The session has a deadline in the ACK queue
 
     AckEntry() :
-        delay(0), count(0) {}
-    AckEntry(ap_uint<12> delay, ap_uint<4> count) :
-        delay(delay), count(count) {}
+        count(0), queued(0) {}
+    AckEntry(ap_uint<4> count, ap_uint<1> queued) :
+        count(count), queued(queued) {}
+};
+
+/*******************************************************************************
+ * ACK Queue (AKd)
+ *  The deadlines of the delayed ACKs are queued in the order they were armed.
+ *  Since all deadlines are armed with the same timeout, the head of the queue
+ *  always holds the earliest deadline.
+ *******************************************************************************/
+typedef ap_uint<20> AckTime;  // A time stamp in clock cycles
+
+class AckTimer {
+  public:
+    SessionId   sessId;
+    AckTime     deadline;
 
+    AckTimer() {}
+    AckTimer(SessionId sessId, AckTime deadline) :
+        sessId(sessId), deadline(deadline) {}
 };
 
 /*******************************************************************************
@@ -0,0 +1,357 @@
+/*******************************************************************************
+ * Copyright 2016 -- 2021 IBM Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+/*******************************************************************************
+ * @file       : buffer_pool.cpp
+ * @brief      : Buffer Pool (BPl) of the TCP Offload Engine (TOE)
+ *
+ * System:     : cloudFPGA
+ * Component   : Shell, Network Transport Stack (NTS)
+ * Language    : Vivado HLS
+ *
+ * \ingroup NTS
+ * \addtogroup NTS_TOE
+ * \{
+ *******************************************************************************/
+
+#include "buffer_pool.hpp"
+
+using namespace hls;
+
+/************************************************
+ * HELPERS FOR THE DEBUGGING TRACES
+ *  .e.g: DEBUG_LEVEL = (TRACE_PGM)
+ ************************************************/
+#ifndef __SYNTHESIS__
+  extern bool gTraceEvent;
+#endif
+
+#define THIS_NAME "TOE/BPl"
+
+#define TRACE_OFF  0x0000
+#define TRACE_PGM 1 <<  1
+#define TRACE_ALL  0xFFFF
+
+#define DEBUG_LEVEL (TRACE_OFF)
+
+//-- The number of virtual pages of all the session buffers of one direction
+static const uint32_t cNrVirtPages = (TOE_MAX_SESSIONS << (TOE_WINDOW_BITS - TOE_PAGE_BITS));
+//-- A physical page which is never allocated and which backs the reads of an
+//--  unmapped page. This prevents a stale page of another session from leaking.
+static const uint32_t cNullPage    = TOE_BUF_POOL_PAGES;
+
+
+/*******************************************************************************
+ * @brief Returns the virtual page number of a byte of a session buffer.
+ *
+ * @param[in] sessId  The session ID.
+ * @param[in] bufPtr  The location of the byte within the buffer of the session.
+ *******************************************************************************/
+BufPageNum toBufPageNum(SessionId sessId, TcpBufAdr bufPtr) {
+    #pragma HLS INLINE
+    BufPageNum vpn = sessId;
+    vpn = vpn << (TOE_WINDOW_BITS-TOE_PAGE_BITS);
+    vpn = vpn | (BufPageNum)(bufPtr >> TOE_PAGE_BITS);
+    return vpn;
+}
+
+/*******************************************************************************
+ * @brief Returns true if an address falls into the memory region of a pool.
+ *
+ * @param[in] saddr     The start address of a data mover command.
+ * @param[in] memBase   The base address of the memory region.
+ *
+ * @details
+ *  The addresses outside of the region (e.g. the buffers of the APP used by
+ *   the zero-copy send) are not translated.
+ *******************************************************************************/
+bool isPoolAddr(ap_uint<40> saddr, uint64_t memBase) {
+    #pragma HLS INLINE
+    ap_uint<40> offset = saddr - memBase;
+    return (offset(39, 30) == 0);
+}
+
+/*******************************************************************************
+ * @brief Returns the physical address of a virtual address of a pool.
+ *
+ * @param[in] saddr     The virtual start address of a data mover command.
+ * @param[in] memBase   The base address of the memory region (1GB aligned).
+ * @param[in] ppn       The physical page number backing that address.
+ *******************************************************************************/
+ap_uint<40> toPhysAddr(ap_uint<40> saddr, uint64_t memBase, BufPageNum ppn) {
+    #pragma HLS INLINE
+    ap_uint<40> physAddr = memBase;
+    physAddr(29, TOE_PAGE_BITS) = ppn;
+    physAddr(TOE_PAGE_BITS-1, 0) = saddr(TOE_PAGE_BITS-1, 0);
+    return physAddr;
+}
+
+/*******************************************************************************
+ * @brief Page Mapper (Pgm)
+ *
+ * @param[in]  siWrCmd   Virtual memory write command from [RXe|TAi].
+ * @param[out] soWrCmd   Physical memory write command to [MEM].
+ * @param[in]  siRdCmd   Virtual memory read command from [RAi|TXe].
+ * @param[out] soRdCmd   Physical memory read command to [MEM].
+ * @param[in]  siRdDsc   Virtual read descriptor from [RAi].
+ * @param[out] soRdDsc   Physical read descriptor to [TAIF].
+ * @param[in]  siPageRel Release of virtual pages from [RSt|TSt].
+ *
+ * @details
+ *  Translates the memory commands of one direction (Rx or Tx) from the virtual
+ *   session buffers to the physical pages of the memory. A page is taken from
+ *   the pool upon the first write into an unmapped virtual page. If the pool
+ *   is empty, that write command is held back until a page is released.
+ *  The released pages are queued in a FIFO free-list and the never used pages
+ *   are handed out behind a watermark. The FIFO order maximizes the time
+ *   before a page is reused, and the watermark avoids an initialization loop.
+ *  If 'RD_RELEASE' is set, a read command which ends on the last byte of a
+ *   page also releases that page (i.e. the Rx buffer read by the APP).
+ *
+ *  The requests are served by order of priority: the release of a range of
+ *   pages (one page per cycle), the read descriptors, the read commands, and
+ *   finally the write commands.
+ *******************************************************************************/
+template<uint64_t MEM_BASE, bool RD_RELEASE>
+void pPageMapper(
+        stream<DmCmd>           &siWrCmd,
+        stream<DmCmd>           &soWrCmd,
+        stream<DmCmd>           &siRdCmd,
+        stream<DmCmd>           &soRdCmd,
+        stream<TcpAppRdDsc>     &siRdDsc,
+        stream<TcpAppRdDsc>     &soRdDsc,
+        stream<BufPageRel>      &siPageRel)
+{
+    //-- DIRECTIVES FOR THIS PROCESS -------------------------------------------
+    #pragma HLS PIPELINE II=1 enable_flush
+    #pragma HLS INLINE off
+
+    const char *myName = concat3(THIS_NAME, "/", "Pgm");
+
+    //-- STATIC ARRAYS ---------------------------------------------------------
+    static PageTableEntry           PAGE_TABLE[cNrVirtPages];
+  #if TOE_USE_URAM
+    #pragma HLS RESOURCE   variable=PAGE_TABLE core=XPM_MEMORY uram
+  #else
+    #pragma HLS RESOURCE   variable=PAGE_TABLE core=RAM_T2P_BRAM
+  #endif
+    #pragma HLS DATA_PACK  variable=PAGE_TABLE
+    #pragma HLS DEPENDENCE variable=PAGE_TABLE inter false
+    static BufPageNum               FREE_LIST[TOE_BUF_POOL_PAGES];
+  #if TOE_USE_URAM
+    #pragma HLS RESOURCE   variable=FREE_LIST core=XPM_MEMORY uram
+  #else
+    #pragma HLS RESOURCE   variable=FREE_LIST core=RAM_T2P_BRAM
+  #endif
+    #pragma HLS DEPENDENCE variable=FREE_LIST inter false
+
+    //-- STATIC CONTROL VARIABLES (with RESET) ---------------------------------
+    static BufPageNum   pgm_freeHead=0;
+    #pragma HLS RESET variable=pgm_freeHead
+    static BufPageNum   pgm_freeTail=0;
+    #pragma HLS RESET variable=pgm_freeTail
+    static BufPageNum   pgm_freeCnt=0;
+    #pragma HLS RESET variable=pgm_freeCnt
+    static BufPageNum   pgm_freshPpn=0;
+    #pragma HLS RESET variable=pgm_freshPpn
+    static bool         pgm_relBusy=false;
+    #pragma HLS RESET variable=pgm_relBusy
+    static bool         pgm_wrPending=false;
+    #pragma HLS RESET variable=pgm_wrPending
+
+    //-- STATIC DATAFLOW VARIABLES ---------------------------------------------
+    static BufPageNum   pgm_relVpn;
+    static BufPageCnt   pgm_relCnt;
+    static DmCmd        pgm_wrCmd;
+
+    if (pgm_relBusy) {
+        //-- Release one page of the ongoing range
+        PageTableEntry entry = PAGE_TABLE[pgm_relVpn];
+        if (entry.valid) {
+            FREE_LIST[pgm_freeTail] = entry.ppn;
+            pgm_freeTail = (pgm_freeTail == TOE_BUF_POOL_PAGES-1) ? (BufPageNum)0 : (BufPageNum)(pgm_freeTail+1);
+            pgm_freeCnt++;
+            PAGE_TABLE[pgm_relVpn] = PageTableEntry(0, false);
+            if (DEBUG_LEVEL & TRACE_PGM) {
+                printInfo(myName, "Released VPN=0x%5.5x (PPN=0x%5.5x) - Free=%d\n",
+                          pgm_relVpn.to_uint(), entry.ppn.to_uint(), pgm_freeCnt.to_uint());
+            }
+        }
+        //-- Stay within the buffer of the session
+        pgm_relVpn(TOE_WINDOW_BITS-TOE_PAGE_BITS-1, 0) = pgm_relVpn(TOE_WINDOW_BITS-TOE_PAGE_BITS-1, 0) + 1;
+        pgm_relCnt--;
+        if (pgm_relCnt == 0) {
+            pgm_relBusy = false;
+        }
+    }
+    else if (!siPageRel.empty()) {
+        BufPageRel pageRel = siPageRel.read();
+        if (pageRel.cnt != 0) {
+            pgm_relVpn  = pageRel.vpn;
+            pgm_relCnt  = pageRel.cnt;
+            pgm_relBusy = true;
+        }
+    }
+    else if (!siRdDsc.empty() and !soRdDsc.full()) {
+        //-- Translate a descriptor (it never spans two pages)
+        TcpAppRdDsc rdDsc = siRdDsc.read();
+        if ((rdDsc.length != 0) and isPoolAddr(rdDsc.addr, MEM_BASE)) {
+            ap_uint<40> offset = rdDsc.addr - MEM_BASE;
+            PageTableEntry entry = PAGE_TABLE[offset(29, TOE_PAGE_BITS)];
+            rdDsc.addr = toPhysAddr(rdDsc.addr, MEM_BASE, entry.valid ? entry.ppn : (BufPageNum)cNullPage);
+        }
+        soRdDsc.write(rdDsc);
+    }
+    else if (!siRdCmd.empty() and !soRdCmd.full()) {
+        //-- Translate a read command
+        DmCmd rdCmd = siRdCmd.read();
+        if (isPoolAddr(rdCmd.saddr, MEM_BASE)) {
+            ap_uint<40> offset = rdCmd.saddr - MEM_BASE;
+            BufPageNum  vpn    = offset(29, TOE_PAGE_BITS);
+            PageTableEntry entry = PAGE_TABLE[vpn];
+            rdCmd.saddr = toPhysAddr(rdCmd.saddr, MEM_BASE, entry.valid ? entry.ppn : (BufPageNum)cNullPage);
+            if (RD_RELEASE and entry.valid and
+               ((offset(TOE_PAGE_BITS-1, 0) + rdCmd.btt) == TOE_PAGE_SIZE)) {
+                //-- This was the last byte of the page
+                FREE_LIST[pgm_freeTail] = entry.ppn;
+                pgm_freeTail = (pgm_freeTail == TOE_BUF_POOL_PAGES-1) ? (BufPageNum)0 : (BufPageNum)(pgm_freeTail+1);
+                pgm_freeCnt++;
+                PAGE_TABLE[vpn] = PageTableEntry(0, false);
+            }
+            if (DEBUG_LEVEL & TRACE_PGM) {
+                printInfo(myName, "Read  VPN=0x%5.5x --> 0x%9.9lx (%s)\n", vpn.to_uint(),
+                          rdCmd.saddr.to_ulong(), entry.valid ? "mapped" : "unmapped");
+            }
+        }
+        soRdCmd.write(rdCmd);
+    }
+    else if (pgm_wrPending) {
+        if (!soWrCmd.full()) {
+            ap_uint<40> offset = pgm_wrCmd.saddr - MEM_BASE;
+            BufPageNum  vpn    = offset(29, TOE_PAGE_BITS);
+            PageTableEntry entry = PAGE_TABLE[vpn];
+            if (not isPoolAddr(pgm_wrCmd.saddr, MEM_BASE)) {
+                soWrCmd.write(pgm_wrCmd);
+                pgm_wrPending = false;
+            }
+            else if (entry.valid) {
+                soWrCmd.write(DmCmd(toPhysAddr(pgm_wrCmd.saddr, MEM_BASE, entry.ppn), pgm_wrCmd.btt));
+                pgm_wrPending = false;
+            }
+            else if ((pgm_freeCnt != 0) or (pgm_freshPpn != TOE_BUF_POOL_PAGES)) {
+                //-- Map a page from the free-list, or a page which was never used
+                BufPageNum ppn;
+                if (pgm_freeCnt != 0) {
+                    ppn = FREE_LIST[pgm_freeHead];
+                    pgm_freeHead = (pgm_freeHead == TOE_BUF_POOL_PAGES-1) ? (BufPageNum)0 : (BufPageNum)(pgm_freeHead+1);
+                    pgm_freeCnt--;
+                }
+                else {
+                    ppn = pgm_freshPpn;
+                    pgm_freshPpn++;
+                }
+                PAGE_TABLE[vpn] = PageTableEntry(ppn, true);
+                soWrCmd.write(DmCmd(toPhysAddr(pgm_wrCmd.saddr, MEM_BASE, ppn), pgm_wrCmd.btt));
+                pgm_wrPending = false;
+                if (DEBUG_LEVEL & TRACE_PGM) {
+                    printInfo(myName, "Mapped   VPN=0x%5.5x --> PPN=0x%5.5x - Free=%d\n",
+                              vpn.to_uint(), ppn.to_uint(), pgm_freeCnt.to_uint());
+                }
+            }
+            // else: The pool is exhausted. Wait for a page to be released.
+        }
+    }
+    else if (!siWrCmd.empty()) {
+        siWrCmd.read(pgm_wrCmd);
+        pgm_wrPending = true;
+    }
+}
+
+/*******************************************************************************
+ * @brief Buffer Pool (BPl)
+ *
+ * @param[in]  siRXe_MemWrCmd  Virtual Rx memory write command from RxEngine (RXe).
+ * @param[out] soMEM_RxP_WrCmd Rx memory write command to [MEM].
+ * @param[in]  siRAi_MemRdCmd  Virtual Rx memory read command from RxAppInterface (RAi).
+ * @param[out] soMEM_RxP_RdCmd Rx memory read command to [MEM].
+ * @param[in]  siRAi_RdDsc     Virtual read descriptor from [RAi].
+ * @param[out] soTAIF_RdDsc    Read descriptor to [TAIF].
+ * @param[in]  siRSt_PageRel   Release of Rx pages from RxSarTable (RSt).
+ * @param[in]  siTAi_MemWrCmd  Virtual Tx memory write command from TxAppInterface (TAi).
+ * @param[out] soMEM_TxP_WrCmd Tx memory write command to [MEM].
+ * @param[in]  siTXe_MemRdCmd  Virtual Tx memory read command from TxEngine (TXe).
+ * @param[out] soMEM_TxP_RdCmd Tx memory read command to [MEM].
+ * @param[in]  siTSt_PageRel   Release of Tx pages from TxSarTable (TSt).
+ *
+ * @details
+ *  Backs the Rx and Tx session buffers with pages which are allocated on
+ *   demand from two pools of TOE_BUF_POOL_PAGES pages.
+ *******************************************************************************/
+void buffer_pool(
+        //-- Rx Memory Interfaces
+        stream<DmCmd>           &siRXe_MemWrCmd,
+        stream<DmCmd>           &soMEM_RxP_WrCmd,
+        stream<DmCmd>           &siRAi_MemRdCmd,
+        stream<DmCmd>           &soMEM_RxP_RdCmd,
+        stream<TcpAppRdDsc>     &siRAi_RdDsc,
+        stream<TcpAppRdDsc>     &soTAIF_RdDsc,
+        stream<BufPageRel>      &siRSt_PageRel,
+        //-- Tx Memory Interfaces
+        stream<DmCmd>           &siTAi_MemWrCmd,
+        stream<DmCmd>           &soMEM_TxP_WrCmd,
+        stream<DmCmd>           &siTXe_MemRdCmd,
+        stream<DmCmd>           &soMEM_TxP_RdCmd,
+        stream<BufPageRel>      &siTSt_PageRel)
+{
+    //-- DIRECTIVES FOR THIS PROCESS -------------------------------------------
+    #pragma HLS INLINE
+
+    //--------------------------------------------------------------------------
+    //-- LOCAL SIGNALS AND STREAMS
+    //--------------------------------------------------------------------------
+
+    //-- The Tx side does not hand out any read descriptor
+    static stream<TcpAppRdDsc>  ssTxNoDscReq ("ssTxNoDscReq");
+    #pragma HLS STREAM variable=ssTxNoDscReq depth=1
+    static stream<TcpAppRdDsc>  ssTxNoDscRep ("ssTxNoDscRep");
+    #pragma HLS STREAM variable=ssTxNoDscRep depth=1
+
+    //--------------------------------------------------------------------------
+    //-- PROCESS FUNCTIONS
+    //--------------------------------------------------------------------------
+
+    //-- Rx pages are released by the reads of the APP and by [RSt]
+    pPageMapper<TOE_RX_MEMORY_BASE, true>(
+            siRXe_MemWrCmd,
+            soMEM_RxP_WrCmd,
+            siRAi_MemRdCmd,
+            soMEM_RxP_RdCmd,
+            siRAi_RdDsc,
+            soTAIF_RdDsc,
+            siRSt_PageRel);
+
+    //-- Tx pages are released by [TSt] only (the data may be retransmitted)
+    pPageMapper<TOE_TX_MEMORY_BASE, false>(
+            siTAi_MemWrCmd,
+            soMEM_TxP_WrCmd,
+            siTXe_MemRdCmd,
+            soMEM_TxP_RdCmd,
+            ssTxNoDscReq,
+            ssTxNoDscRep,
+            siTSt_PageRel);
+}
+
+/*! \} */
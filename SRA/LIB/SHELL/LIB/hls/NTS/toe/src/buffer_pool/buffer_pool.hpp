@@ -0,0 +1,97 @@
+/*******************************************************************************
+ * Copyright 2016 -- 2021 IBM Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+/*******************************************************************************
+ * @file       : buffer_pool.hpp
+ * @brief      : Buffer Pool (BPl) of the TCP Offload Engine (TOE)
+ *
+ * System:     : cloudFPGA
+ * Component   : Shell, Network Transport Stack (NTS)
+ * Language    : Vivado HLS
+ *
+ * \ingroup NTS
+ * \addtogroup NTS_TOE
+ * \{
+ *******************************************************************************
+ * The buffer pool is only instantiated when 'TOE_BUF_POOL_CFG' is set. The Rx
+ *  and Tx buffers of the sessions then become virtual: the engines keep on
+ *  addressing a session buffer of 2^TOE_WINDOW_BITS bytes, but the [BPl] maps
+ *  every page of 2^TOE_PAGE_BITS bytes of that buffer onto a physical page of
+ *  the Rx or Tx memory when it is written for the first time.
+ *
+ * A page returns to the pool when it holds no more live bytes:
+ *  - Rx: when the APP read the last byte of the page, or when the APP returned
+ *        the credit of that byte (zero-copy receive) [RSt].
+ *  - Tx: when the peer acknowledged the last byte of the page [TSt].
+ *  - Rx and Tx: when the session is (re)initialized [RSt, TSt].
+ *
+ * The engines never issue a memory access which spans two pages and they never
+ *  write into the page which is still being consumed (see the clamping of the
+ *  window in [RSt] and [TAi]).
+ *******************************************************************************/
+
+#ifndef _TOE_BPL_H_
+#define _TOE_BPL_H_
+
+#include "../../../../NTS/nts_utils.hpp"
+#include "../../../../NTS/toe/src/toe.hpp"
+
+using namespace hls;
+
+/*******************************************************************************
+ * Page Table (BPl)
+ *  Maps a virtual page of a session buffer onto a physical page of memory.
+ *******************************************************************************/
+class PageTableEntry {
+  public:
+    BufPageNum  ppn;    // The physical page number
+    ValBool     valid;  // The virtual page is mapped
+
+    PageTableEntry() {}
+    PageTableEntry(BufPageNum ppn, ValBool valid) :
+        ppn(ppn), valid(valid) {}
+};
+
+/*******************************************************************************
+ * HELPERS
+ *******************************************************************************/
+BufPageNum toBufPageNum(SessionId sessId, TcpBufAdr bufPtr);
+
+/*******************************************************************************
+ *
+ * @brief ENTITY - Buffer Pool (BPl)
+ *
+ *******************************************************************************/
+void buffer_pool(
+        //-- Rx Memory Interfaces
+        stream<DmCmd>           &siRXe_MemWrCmd,
+        stream<DmCmd>           &soMEM_RxP_WrCmd,
+        stream<DmCmd>           &siRAi_MemRdCmd,
+        stream<DmCmd>           &soMEM_RxP_RdCmd,
+        stream<TcpAppRdDsc>     &siRAi_RdDsc,
+        stream<TcpAppRdDsc>     &soTAIF_RdDsc,
+        stream<BufPageRel>      &siRSt_PageRel,
+        //-- Tx Memory Interfaces
+        stream<DmCmd>           &siTAi_MemWrCmd,
+        stream<DmCmd>           &soMEM_TxP_WrCmd,
+        stream<DmCmd>           &siTXe_MemRdCmd,
+        stream<DmCmd>           &soMEM_TxP_RdCmd,
+        stream<BufPageRel>      &siTSt_PageRel
+);
+
+#endif
+
+/*! \} */
@@ -0,0 +1,398 @@
+/*******************************************************************************
+ * Copyright 2016 -- 2021 IBM Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+/*******************************************************************************
+ * @file       : congestion_control.cpp
+ * @brief      : Congestion Control (CC) of the TCP Offload Engine (TOE)
+ *
+ * System:     : cloudFPGA
+ * Component   : Shell, Network Transport Stack (NTS)
+ * Language    : Vivado HLS
+ *
+ * \ingroup NTS
+ * \addtogroup NTS_TOE
+ * \{
+ *******************************************************************************/
+
+#include "congestion_control.hpp"
+
+using namespace hls;
+
+
+/*******************************************************************************
+ * CONSTANTS OF THE CUBIC ALGORITHM
+ *******************************************************************************
+ * The cubic function is W(t) = C*(t-K)^3 + Wmax, with C = 0.4 [MSS/s^3]. It is
+ *  computed in bytes and in timer ticks, i.e. C = (cCubicCoef >> cCubicShift)
+ *  [bytes/tick^3]. The coefficient is a constant based on the default MSS
+ *  rather than on the MSS of every session, which saves a divider.
+ *******************************************************************************/
+static const int         cCubicShift   = 40;
+static const ap_uint<64> cCubicCoef    = (((ap_uint<64>)(4*THEIR_MSS)) << cCubicShift) /
+                                         ((ap_uint<64>)10*TIME_1s*TIME_1s*TIME_1s);
+static const ap_uint<32> cCubicMaxTime = 8*TIME_1s;  // Saturates |t-K|
+static const int         cCubicBeta    = 717;        // 0.7  (x1024)
+static const int         cCubicFastCnv = 870;        // 0.85 (x1024) = (1+beta)/2
+
+/*******************************************************************************
+ * CONSTANTS OF THE DCTCP ALGORITHM
+ *******************************************************************************/
+static const int         cDctcpShiftG  = 4;          // Estimation gain g = 1/16
+static const int         cDctcpAlphaMax= 1024;       // 1.0 (x1024)
+
+
+/*******************************************************************************
+ * @brief Adds a number of bytes to a congestion window and saturates the result.
+ *
+ * @param[in] cwnd  The congestion window.
+ * @param[in] incr  The increment.
+ * @returns min(cwnd+incr, TOE_MAX_CONGESTION_WINDOW).
+ *******************************************************************************/
+LocalWinSize ccSatAdd(LocalWinSize cwnd, CcByteCnt incr)
+{
+    #pragma HLS INLINE
+
+    CcByteCnt sum = cwnd + incr;
+    if (sum > TOE_MAX_CONGESTION_WINDOW) {
+        return TOE_MAX_CONGESTION_WINDOW;
+    }
+    return sum;
+}
+
+/*******************************************************************************
+ * @brief Returns the slow start threshold after a loss.
+ *
+ * @param[in] flightSize  The amount of outstanding data in the network.
+ * @param[in] mss         The maximum segment size of the session.
+ *
+ * @details
+ *  Reno and DCTCP use max(FlightSize/2, 2*MSS) [RFC-5681] while CUBIC only
+ *   reduces the window by a factor of 'beta' [RFC-8312].
+ *******************************************************************************/
+LocalWinSize ccLossThreshold(LocalWinSize flightSize, TcpSegLen mss)
+{
+    #pragma HLS INLINE
+
+    LocalWinSize threshold;
+  #if (TOE_CC_ALGO_CFG == TOE_CC_CUBIC)
+    threshold = (flightSize * cCubicBeta) >> 10;
+  #else
+    threshold = flightSize >> 1;
+  #endif
+    if (threshold < (2*mss)) {
+        threshold = (2*mss);
+    }
+    return threshold;
+}
+
+/*******************************************************************************
+ * @brief Returns the integer cube root of a value smaller than 2^57.
+ *
+ * @details
+ *  Bitwise (i.e. digit-by-digit) method. The loop is fully unrolled.
+ *******************************************************************************/
+RttTime ccCubeRoot(ap_uint<64> x)
+{
+    #pragma HLS INLINE
+
+    ap_uint<64> y = 0;
+    ap_uint<64> r = x;
+    for (int s=54; s>=0; s-=3) {
+        #pragma HLS UNROLL
+        y = y << 1;
+        ap_uint<64> b = 3*y*(y+1) + 1;
+        if ((r >> s) >= b) {
+            r -= (b << s);
+            y += 1;
+        }
+    }
+    return y;
+}
+
+/*******************************************************************************
+ * @brief Returns the fraction 'num/den' in 1/1024 units (with num <= den).
+ *
+ * @details
+ *  Restoring division of 11 quotient bits. The loop is fully unrolled.
+ *******************************************************************************/
+ap_uint<11> ccFraction(CcByteCnt num, CcByteCnt den)
+{
+    #pragma HLS INLINE
+
+    ap_uint<11> quo = 0;
+    ap_uint<TOE_WINDOW_BITS+11> rem = ((ap_uint<TOE_WINDOW_BITS+11>)num) << 10;
+    if (den == 0) {
+        return 0;
+    }
+    for (int i=10; i>=0; i--) {
+        #pragma HLS UNROLL
+        ap_uint<TOE_WINDOW_BITS+11> sub = ((ap_uint<TOE_WINDOW_BITS+11>)den) << i;
+        if (rem >= sub) {
+            rem -= sub;
+            quo[i] = 1;
+        }
+    }
+    return quo;
+}
+
+/*******************************************************************************
+ * @brief Returns the initial window of a session.
+ *
+ * @param[in] mss  The maximum segment size of the session.
+ * @returns min(10*MSS, max(2*MSS, 14600)) [RFC-6928].
+ *******************************************************************************/
+LocalWinSize ccInitWindow(TcpSegLen mss)
+{
+    #pragma HLS INLINE
+
+    CcByteCnt upper = 10*mss;
+    CcByteCnt lower = (2*mss > 14600) ? (CcByteCnt)(2*mss) : (CcByteCnt)14600;
+    return (upper < lower) ? upper : lower;
+}
+
+/*******************************************************************************
+ * @brief Initializes the congestion control of a new session.
+ *
+ * @param[out] cwnd      The congestion window.
+ * @param[out] ssthresh  The slow start threshold.
+ * @param[out] cc        The state of the congestion control algorithm.
+ * @param[in]  sndNxt    The initial send sequence number.
+ * @param[in]  mss       The maximum segment size of the session.
+ *******************************************************************************/
+void ccInit(
+        LocalWinSize &cwnd,
+        LocalWinSize &ssthresh,
+        CcState      &cc,
+        TxAckNum      sndNxt,
+        TcpSegLen     mss)
+{
+    #pragma HLS INLINE
+
+    cwnd          = ccInitWindow(mss);
+    ssthresh      = TOE_MAX_CONGESTION_WINDOW;
+    cc.bytesAcked = 0;
+  #if (TOE_CC_ALGO_CFG == TOE_CC_CUBIC)
+    cc.wMax         = 0;
+    cc.origin       = 0;
+    cc.k            = 0;
+    cc.epochTick    = 0;
+    cc.epochStarted = false;
+  #elif (TOE_CC_ALGO_CFG == TOE_CC_DCTCP)
+    cc.alpha        = cDctcpAlphaMax;
+    cc.windowEnd    = sndNxt;
+    cc.bytesTotal   = 0;
+    cc.bytesMarked  = 0;
+    cc.reduced      = false;
+  #endif
+}
+
+/*******************************************************************************
+ * @brief Updates the congestion window upon the receipt of a new ACK.
+ *
+ * @param[in/out] cwnd       The congestion window.
+ * @param[in/out] ssthresh   The slow start threshold.
+ * @param[in/out] cc         The state of the congestion control algorithm.
+ * @param[in]     ackedSize  The number of bytes newly acknowledged.
+ * @param[in]     sndUna     The acknowledgment number of this ACK.
+ * @param[in]     sndNxt     The next sequence number to be sent.
+ * @param[in]     ece        The ECN-Echo flag of this ACK.
+ * @param[in]     now        The current time (in timer ticks).
+ * @param[in]     mss        The maximum segment size of the session.
+ *
+ * @details
+ *  This function is not called during a fast recovery. Below 'ssthresh', the
+ *   window grows by up to one MSS per ACK (slow start). Above, the ACK'ed
+ *   bytes are accumulated in 'cc.bytesAcked' and the window grows once per
+ *   window worth of ACK'ed bytes (i.e. once per round-trip), which replaces
+ *   the division of MSS*MSS/cwnd by a comparison. Reno then adds one MSS per
+ *   round-trip while CUBIC adds the distance to its cubic target.
+ *******************************************************************************/
+void ccOnAck(
+        LocalWinSize &cwnd,
+        LocalWinSize &ssthresh,
+        CcState      &cc,
+        LocalWinSize  ackedSize,
+        TxAckNum      sndUna,
+        TxAckNum      sndNxt,
+        TcpCtrlBit    ece,
+        TimeTick      now,
+        TcpSegLen     mss)
+{
+    #pragma HLS INLINE
+
+  #if (TOE_CC_ALGO_CFG == TOE_CC_DCTCP)
+    //-- Estimate the fraction of marked bytes once per observation window
+    cc.bytesTotal += ackedSize;
+    if (ece) {
+        cc.bytesMarked += ackedSize;
+    }
+    if ((ap_int<32>)(sndUna - cc.windowEnd) > 0) {
+        // alpha = (1-g)*alpha + g*F
+        ap_uint<11> frac = ccFraction(cc.bytesMarked, cc.bytesTotal);
+        cc.alpha = cc.alpha - (cc.alpha >> cDctcpShiftG) + (frac >> cDctcpShiftG);
+        cc.windowEnd   = sndNxt;
+        cc.bytesTotal  = 0;
+        cc.bytesMarked = 0;
+        cc.reduced     = false;
+    }
+    //-- React to the congestion once per observation window: cwnd = cwnd*(1-alpha/2)
+    if (ece and not cc.reduced) {
+        LocalWinSize decr = (cwnd * cc.alpha) >> 11;
+        if ((cwnd - decr) > (2*mss)) {
+            cwnd = cwnd - decr;
+        }
+        else {
+            cwnd = (2*mss);
+        }
+        ssthresh      = cwnd;
+        cc.bytesAcked = 0;
+        cc.reduced    = true;
+        return;
+    }
+  #endif
+
+    if (cwnd < ssthresh) {
+        //-- SLOW START
+        if (ackedSize > mss) {
+            cwnd = ccSatAdd(cwnd, mss);
+        }
+        else {
+            cwnd = ccSatAdd(cwnd, ackedSize);
+        }
+        return;
+    }
+
+    //-- CONGESTION AVOIDANCE
+  #if (TOE_CC_ALGO_CFG == TOE_CC_CUBIC)
+    if (not cc.epochStarted) {
+        cc.epochStarted = true;
+        cc.epochTick    = now;
+        cc.bytesAcked   = 0;
+        if (cwnd < cc.wMax) {
+            // K = cubic_root((Wmax-cwnd)/C)
+            cc.k      = ccCubeRoot((((ap_uint<64>)(cc.wMax - cwnd)) << cCubicShift) / cCubicCoef);
+            cc.origin = cc.wMax;
+        }
+        else {
+            cc.k      = 0;
+            cc.origin = cwnd;
+        }
+    }
+    ap_uint<32> elapsed = now - cc.epochTick;
+    bool        concave = (elapsed < cc.k);
+    ap_uint<32> offset  = concave ? (ap_uint<32>)(cc.k - elapsed) : (ap_uint<32>)(elapsed - cc.k);
+    if (offset > cCubicMaxTime) {
+        offset = cCubicMaxTime;
+    }
+    ap_uint<64> delta = ((ap_uint<64>)offset * offset * offset * cCubicCoef) >> cCubicShift;
+    CcByteCnt   target;
+    if (concave) {
+        target = (delta < cc.origin) ? (CcByteCnt)(cc.origin - delta) : (CcByteCnt)0;
+    }
+    else {
+        target = (delta < TOE_MAX_CONGESTION_WINDOW) ? (CcByteCnt)(cc.origin + delta) : (CcByteCnt)TOE_MAX_CONGESTION_WINDOW;
+    }
+    cc.bytesAcked += ackedSize;
+    if (cc.bytesAcked >= cwnd) {
+        cc.bytesAcked -= cwnd;
+        //-- Grow at least as fast as Reno and at most by half a window per round-trip
+        CcByteCnt incr = mss;
+        if (target > (cwnd + mss)) {
+            incr = target - cwnd;
+            if (incr > (cwnd >> 1)) {
+                incr = (cwnd >> 1);
+            }
+        }
+        cwnd = ccSatAdd(cwnd, incr);
+    }
+  #else
+    //-- cwnd += MSS*MSS/cwnd is approximated with one MSS per window of ACK'ed bytes
+    cc.bytesAcked += ackedSize;
+    if (cc.bytesAcked >= cwnd) {
+        cc.bytesAcked -= cwnd;
+        cwnd = ccSatAdd(cwnd, mss);
+    }
+  #endif
+}
+
+/*******************************************************************************
+ * @brief Reduces the congestion window upon a fast retransmit.
+ *
+ * @param[in/out] cwnd        The congestion window.
+ * @param[out]    ssthresh    The slow start threshold.
+ * @param[in/out] cc          The state of the congestion control algorithm.
+ * @param[in]     flightSize  The amount of outstanding data in the network.
+ * @param[in]     mss         The maximum segment size of the session.
+ *
+ * @details
+ *  The window is inflated by the three segments that left the network as
+ *   signaled by the duplicate ACKs [RFC-5681].
+ *******************************************************************************/
+void ccOnFastRetransmit(
+        LocalWinSize &cwnd,
+        LocalWinSize &ssthresh,
+        CcState      &cc,
+        LocalWinSize  flightSize,
+        TcpSegLen     mss)
+{
+    #pragma HLS INLINE
+
+  #if (TOE_CC_ALGO_CFG == TOE_CC_CUBIC)
+    //-- Fast convergence: release some bandwidth to the new flows
+    if (cwnd < cc.wMax) {
+        cc.wMax = (cwnd * cCubicFastCnv) >> 10;
+    }
+    else {
+        cc.wMax = cwnd;
+    }
+    cc.epochStarted = false;
+  #endif
+    ssthresh = ccLossThreshold(flightSize, mss);
+    cwnd     = ccSatAdd(ssthresh, TOE_DUP_ACK_THRESHOLD*mss);
+    cc.bytesAcked = 0;
+}
+
+/*******************************************************************************
+ * @brief Reduces the congestion window upon a retransmission timeout.
+ *
+ * @param[out]    cwnd        The congestion window.
+ * @param[out]    ssthresh    The slow start threshold.
+ * @param[in/out] cc          The state of the congestion control algorithm.
+ * @param[in]     flightSize  The amount of outstanding data in the network.
+ * @param[in]     mss         The maximum segment size of the session.
+ *
+ * @details
+ *  The window restarts from the loss window of one segment [RFC-5681].
+ *******************************************************************************/
+void ccOnTimeout(
+        LocalWinSize &cwnd,
+        LocalWinSize &ssthresh,
+        CcState      &cc,
+        LocalWinSize  flightSize,
+        TcpSegLen     mss)
+{
+    #pragma HLS INLINE
+
+  #if (TOE_CC_ALGO_CFG == TOE_CC_CUBIC)
+    cc.wMax         = cwnd;
+    cc.epochStarted = false;
+  #endif
+    ssthresh = ccLossThreshold(flightSize, mss);
+    cwnd     = mss;
+    cc.bytesAcked = 0;
+}
+
+/*! \} */
@@ -0,0 +1,101 @@
+/*******************************************************************************
+ * Copyright 2016 -- 2021 IBM Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+/*******************************************************************************
+ * @file       : congestion_control.hpp
+ * @brief      : Congestion Control (CC) of the TCP Offload Engine (TOE)
+ *
+ * System:     : cloudFPGA
+ * Component   : Shell, Network Transport Stack (NTS)
+ * Language    : Vivado HLS
+ *
+ * \ingroup NTS
+ * \addtogroup NTS_TOE
+ * \{
+ *******************************************************************************
+ * The congestion control is not a process of its own. It is a set of functions
+ *  which are inlined into the processes that own the congestion window of a
+ *  session, i.e. the RxEngine (RXe) upon the receipt of an ACK and the Tx SAR
+ *  Table (TSt) upon a retransmission timeout. The per-session state of the
+ *  algorithm ('CcState') is stored in the Tx SAR table next to 'cong_window'
+ *  and 'slowstart_threshold'.
+ *
+ * The algorithm is selected at build time with 'TOE_CC_ALGO_CFG':
+ *  - TOE_CC_RENO  : Slow start and congestion avoidance with appropriate byte
+ *                   counting [RFC-5681, RFC-3465].
+ *  - TOE_CC_CUBIC : The window grows as a cubic function of the time elapsed
+ *                   since the last reduction [RFC-8312].
+ *  - TOE_CC_DCTCP : The window is reduced in proportion to the fraction of
+ *                   bytes that were marked with CE by the network [RFC-8257].
+ *                   The TxEngine (TXe) sends the data segments as ECN-capable
+ *                   (ECT(0)) and echoes the CE marks with the ECE flag.
+ *******************************************************************************/
+
+#ifndef _TOE_CC_H_
+#define _TOE_CC_H_
+
+#include "../toe.hpp"
+
+using namespace hls;
+
+/*******************************************************************************
+ * CONSTANTS OF THE CONGESTION CONTROL
+ *******************************************************************************/
+//-- The TXe sends ECN-capable segments and echoes the CE marks
+static const bool      cCcUseEcn      = (TOE_CC_ALGO_CFG == TOE_CC_DCTCP);
+
+
+/*******************************************************************************
+ * INTERFACE OF THE CONGESTION CONTROL
+ *******************************************************************************/
+LocalWinSize ccInitWindow(
+        TcpSegLen     mss);
+
+void ccInit(
+        LocalWinSize &cwnd,
+        LocalWinSize &ssthresh,
+        CcState      &cc,
+        TxAckNum      sndNxt,
+        TcpSegLen     mss);
+
+void ccOnAck(
+        LocalWinSize &cwnd,
+        LocalWinSize &ssthresh,
+        CcState      &cc,
+        LocalWinSize  ackedSize,
+        TxAckNum      sndUna,
+        TxAckNum      sndNxt,
+        TcpCtrlBit    ece,
+        TimeTick      now,
+        TcpSegLen     mss);
+
+void ccOnFastRetransmit(
+        LocalWinSize &cwnd,
+        LocalWinSize &ssthresh,
+        CcState      &cc,
+        LocalWinSize  flightSize,
+        TcpSegLen     mss);
+
+void ccOnTimeout(
+        LocalWinSize &cwnd,
+        LocalWinSize &ssthresh,
+        CcState      &cc,
+        LocalWinSize  flightSize,
+        TcpSegLen     mss);
+
+#endif
+
+/*! \} */
@@ -86,6 +86,18 @@ using namespace hls;
  * @param[in]  siAKd_RxEventSig The AckDelayer just received an event.
  * @param[in]  siAKd_TxEventSig The AckDelayer just forwarded an event.
  * @param[in]  siTXe_RxEventSig The TxEngine (TXe) just received an event.
+ *
+ * @details
+ *  The three event sources are served by a weighted round-robin arbiter. Every
+ *  source is granted 'cEVe_<Src>Weight' events per round, and a new round
+ *  starts as soon as none of the pending sources has any grant left. Within a
+ *  round, the sources are served in the order [RXe], [TIm], [TAi].
+ *  The events of all sources are further subject to a credit-based flow
+ *  control: they are only admitted as long as the number of events in flight
+ *  between [EVe] and [TXe] is below 'cEVe_TxCredits'. The ACK events of [RXe]
+ *  are counted as well, because [AKd] forwards an ACK right away once a session
+ *  has received enough segments. The remainder of the FiFo space between [AKd]
+ *  and [TXe] is left for the delayed ACKs which [AKd] issues on its own.
  *******************************************************************************/
 void event_engine(
         stream<Event>           &siTAi_Event,
@@ -111,51 +123,91 @@ void event_engine(
     #pragma HLS RESET variable = eve_akd2txe_WrCnt
     static ap_uint<8>            eve_akd2txe_RdCnt; // #events received  by [TXe] from [Akd]
     #pragma HLS RESET variable = eve_akd2txe_RdCnt
+    //---- Remaining grants of the current arbitration round
+    static ap_uint<4>            eve_rxeGrants=cEVe_RxeWeight;
+    #pragma HLS RESET variable = eve_rxeGrants
+    static ap_uint<4>            eve_timGrants=cEVe_TimWeight;
+    #pragma HLS RESET variable = eve_timGrants
+    static ap_uint<4>            eve_taiGrants=cEVe_TaiWeight;
+    #pragma HLS RESET variable = eve_taiGrants
+    //---- Number of events forwarded per source
+    static ap_uint<32>           eve_rxeEvtCnt=0;
+    #pragma HLS RESET variable = eve_rxeEvtCnt
+    static ap_uint<32>           eve_timEvtCnt=0;
+    #pragma HLS RESET variable = eve_timEvtCnt
+    static ap_uint<32>           eve_taiEvtCnt=0;
+    #pragma HLS RESET variable = eve_taiEvtCnt
 
     //-- DYNAMIC VARIABLES -----------------------------------------------------
     ExtendedEvent ev;
+    ap_uint<8>    eve2akdCnt = eve_eve2akd_WrCnt - eve_eve2akd_RdCnt;
+    ap_uint<8>    akd2txeCnt = eve_akd2txe_WrCnt - eve_akd2txe_RdCnt;
+    bool          txCredit   = (eve2akdCnt + akd2txeCnt) < cEVe_TxCredits;
+
+    bool rxeReq = !siRXe_Event.empty() and txCredit;
+    bool timReq = !siTIm_Event.empty() and txCredit;
+    bool taiReq = !siTAi_Event.empty() and txCredit;
+
+    ap_uint<4> rxeGrants = eve_rxeGrants;
+    ap_uint<4> timGrants = eve_timGrants;
+    ap_uint<4> taiGrants = eve_taiGrants;
+    if (!(rxeReq and rxeGrants != 0) and
+        !(timReq and timGrants != 0) and
+        !(taiReq and taiGrants != 0)) {
+        // None of the pending sources has a grant left --> Start a new round
+        rxeGrants = cEVe_RxeWeight;
+        timGrants = cEVe_TimWeight;
+        taiGrants = cEVe_TaiWeight;
+    }
 
-    //------------------------------------------
-    // Handle input from [RxEngine]
-    //------------------------------------------
-    if (!siRXe_Event.empty() and !soAKd_Event.full()) {
-        siRXe_Event.read(ev);
-        soAKd_Event.write(ev);
-        if (DEBUG_LEVEL & TRACE_EVE) {
-            printInfo(myName, "S%d - Received '%s' from [RXe] (WrCnt=%3d|RdCnt=%3d).\n",
-                      ev.sessionID.to_int(), getEventName(ev.type), eve_eve2akd_WrCnt.to_uint(), eve_eve2akd_RdCnt.to_uint());
+    if (!soAKd_Event.full()) {
+        //------------------------------------------
+        // Handle input from [RxEngine]
+        //------------------------------------------
+        if (rxeReq and rxeGrants != 0) {
+            siRXe_Event.read(ev);
+            soAKd_Event.write(ev);
+            if (DEBUG_LEVEL & TRACE_EVE) {
+                printInfo(myName, "S%d - Received '%s' from [RXe] (WrCnt=%3d|RdCnt=%3d|EvtCnt=%d).\n",
+                          ev.sessionID.to_int(), getEventName(ev.type), eve_eve2akd_WrCnt.to_uint(), eve_eve2akd_RdCnt.to_uint(), eve_rxeEvtCnt.to_uint());
+            }
+            eve_eve2akd_WrCnt++;
+            eve_rxeEvtCnt++;
+            rxeGrants--;
         }
-        eve_eve2akd_WrCnt++;
-    }
-    else if (eve_eve2akd_WrCnt == eve_eve2akd_RdCnt and
-             eve_akd2txe_WrCnt == eve_akd2txe_RdCnt) {
         //------------------------------------------
         // Handle input from [Timers]
-        //   RetransmitTimer and ProbeTimer events have priority
         //------------------------------------------
-        if (!siTIm_Event.empty()) {
+        else if (timReq and timGrants != 0) {
             siTIm_Event.read(ev);
             soAKd_Event.write(ev);
             if (DEBUG_LEVEL & TRACE_EVE) {
-                printInfo(myName, "S%d - Received '%s' from [TIm] (WrCnt=%3d|RdCnt=%3d).\n",
-                        ev.sessionID.to_int(), getEventName(ev.type), eve_eve2akd_WrCnt.to_uint(), eve_eve2akd_RdCnt.to_uint());
+                printInfo(myName, "S%d - Received '%s' from [TIm] (WrCnt=%3d|RdCnt=%3d|EvtCnt=%d).\n",
+                        ev.sessionID.to_int(), getEventName(ev.type), eve_eve2akd_WrCnt.to_uint(), eve_eve2akd_RdCnt.to_uint(), eve_timEvtCnt.to_uint());
             }
             eve_eve2akd_WrCnt++;
+            eve_timEvtCnt++;
+            timGrants--;
         }
         //--------------------------------------------
         // Handle input from [TcpApplicationInterface]
         //--------------------------------------------
-        else if (!siTAi_Event.empty()) {
+        else if (taiReq and taiGrants != 0) {
             siTAi_Event.read(ev);
             assessSize(myName, soAKd_Event, "soAKd_Event", cDepth_EVeToAKd_Event);
             soAKd_Event.write(ev);
             if (DEBUG_LEVEL & TRACE_EVE) {
-                printInfo(myName, "S%d - Received '%s' from [TAi] (WrCnt=%3d|RdCnt=%3d).\n",
-                        ev.sessionID.to_int(), getEventName(ev.type), eve_eve2akd_WrCnt.to_uint(), eve_eve2akd_RdCnt.to_uint());
+                printInfo(myName, "S%d - Received '%s' from [TAi] (WrCnt=%3d|RdCnt=%3d|EvtCnt=%d).\n",
+                        ev.sessionID.to_int(), getEventName(ev.type), eve_eve2akd_WrCnt.to_uint(), eve_eve2akd_RdCnt.to_uint(), eve_taiEvtCnt.to_uint());
             }
             eve_eve2akd_WrCnt++;
+            eve_taiEvtCnt++;
+            taiGrants--;
         }
     }
+    eve_rxeGrants = rxeGrants;
+    eve_timGrants = timGrants;
+    eve_taiGrants = taiGrants;
 
     //------------------------------------------
     // Handle inputs from [AckDelayer]
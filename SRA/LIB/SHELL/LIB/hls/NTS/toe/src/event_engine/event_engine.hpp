@@ -62,6 +62,17 @@ EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 using namespace hls;
 
+/*******************************************************************************
+ * CONSTANTS FOR THE EVENT ARBITRATION
+ *  - The weights give the number of events granted to each source per round.
+ *  - The credits bound the number of events in flight between [EVe] and [TXe]
+ *    before the events of all sources get throttled.
+ *******************************************************************************/
+const int cEVe_RxeWeight = 4;
+const int cEVe_TimWeight = 2;
+const int cEVe_TaiWeight = 2;
+const int cEVe_TxCredits = cDepth_AKdToTXe_Event - cDepth_EVeToAKd_Event;
+
 
 /*******************************************************************************
  *
@@ -24,44 +24,211 @@ EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 ************************************************/
 
 
+/*******************************************************************************
+ * @file       : test_event_engine.cpp
+ * @brief      : Testbench and throughput benchmark of the Event Engine (EVe).
+ *
+ * System:     : cloudFPGA
+ * Component   : Shell, Network Transport Stack (NTS)
+ * Language    : Vivado HLS
+ *
+ * @details
+ *  The [EVe] and the [AKd] are driven with a random mix of events from [RXe],
+ *  [TIm] and [TAi], while a model of [TXe] consumes one event every
+ *  'cTXeCycPerEvent' cycles. For every load profile, the testbench reports the
+ *  number of events forwarded per source and per cycle, and checks that none
+ *  of the sources was starved.
+ *
+ *  Usage: 'make csimEvent' from the 'toe' directory.
+ *
+ * \ingroup NTS_TOE
+ * \addtogroup NTS_TOE_TEST
+ * \{
+ *******************************************************************************/
+
+#include <cstdlib>
+
 #include "event_engine.hpp"
-#include <iostream>
+#include "../ack_delay/src/ack_delay.hpp"
 
 using namespace hls;
+using namespace std;
+
+#define THIS_NAME "TB"
+
+//---------------------------------------------------------
+//-- TESTBENCH GLOBAL VARIABLES
+//---------------------------------------------------------
+bool            gTraceEvent   = false;
+bool            gFatalError   = false;
+unsigned int    gSimCycCnt    = 0;
+
+//---------------------------------------------------------
+//-- TESTBENCH DEFINES
+//---------------------------------------------------------
+const int cSimCycles      = 20000;  // Number of loaded cycles per profile
+const int cTXeCycPerEvent = 3;      // Service time of an event by [TXe]
 
-int main()
+/*******************************************************************************
+ * @brief A load profile given as the probabilities (in percent) that a source
+ *  issues a new event during a cycle.
+ *******************************************************************************/
+struct LoadProfile {
+    const char *name;
+    int         rxePct;
+    int         timPct;
+    int         taiPct;
+};
+
+/*******************************************************************************
+ * @brief Run one load profile through [EVe] and [AKd].
+ *
+ * @param[in]  prof  The load profile.
+ *
+ * @return the number of errors.
+ *******************************************************************************/
+int runProfile(const LoadProfile &prof)
 {
-    stream<event>               txApp2eventEng_setEvent;
-    stream<extendedEvent>       rxEng2eventEng_setEvent;
-    stream<event>               timer2eventEng_setEvent;
-    stream<extendedEvent>       eventEng2txEng_event;
-
-    extendedEvent ev;
-    int count=0;
-    while (count < 50)
-    {
-        event_engine(   txApp2eventEng_setEvent,
-                        rxEng2eventEng_setEvent,
-                        timer2eventEng_setEvent,
-                        eventEng2txEng_event);
-
-        if (count == 20)
-        {
-            fourTuple tuple;
-            tuple.srcIp = 0x0101010a;
-            tuple.srcPort = 12;
-            tuple.dstIp = 0x0101010b;
-            tuple.dstPort = 788789;
-            txApp2eventEng_setEvent.write(event(TX, 23));
-            rxEng2eventEng_setEvent.write(extendedEvent(rstEvent(0x8293479023), tuple));
-            timer2eventEng_setEvent.write(event(RT, 22));
+    const char *myName = concat3(THIS_NAME, "/", "Bench");
+
+    stream<Event>           ssTAiToEVe_Event     ("ssTAiToEVe_Event");
+    stream<ExtendedEvent>   ssRXeToEVe_Event     ("ssRXeToEVe_Event");
+    stream<Event>           ssTImToEVe_Event     ("ssTImToEVe_Event");
+    stream<ExtendedEvent>   ssEVeToAKd_Event     ("ssEVeToAKd_Event");
+    stream<SigBit>          ssAKdToEVe_RxEventSig("ssAKdToEVe_RxEventSig");
+    stream<SigBit>          ssAKdToEVe_TxEventSig("ssAKdToEVe_TxEventSig");
+    stream<ExtendedEvent>   ssAKdToTXe_Event     ("ssAKdToTXe_Event");
+    stream<SigBit>          ssTXeToEVe_RxEventSig("ssTXeToEVe_RxEventSig");
+
+    unsigned int rxeCnt=0, timCnt=0, taiCnt=0, txeCnt=0;
+    unsigned int rxeRd=0,  timRd=0,  taiRd=0;
+    int          txeBusy=0;
+    int          nrErr=0;
+
+    for (int cyc=0; cyc<cSimCycles; cyc++) {
+        //-- Sources: only issue an event if the producer's FiFo is not full
+        if ((rand()%100 < prof.rxePct) and (ssRXeToEVe_Event.size() < cDepth_RXeToEVe_Event)) {
+            // Mostly ACKs, with the occasional retransmit from a duplicate ACK
+            EventType type = (rand()%16 == 0) ? RT_EVENT : ACK_EVENT;
+            ssRXeToEVe_Event.write(ExtendedEvent(Event(type, rand()%TOE_MAX_SESSIONS)));
+            rxeCnt++;
         }
-        if (!eventEng2txEng_event.empty())
-        {
-            eventEng2txEng_event.read(ev);
-            std::cout << ev.type << std::endl;
+        if ((rand()%100 < prof.timPct) and (ssTImToEVe_Event.size() < cDepth_TImToEVe_Event)) {
+            ssTImToEVe_Event.write(Event(RT_EVENT, rand()%TOE_MAX_SESSIONS));
+            timCnt++;
         }
-        count++;
+        if ((rand()%100 < prof.taiPct) and (ssTAiToEVe_Event.size() < cDepth_TAiToEVe_Event)) {
+            ssTAiToEVe_Event.write(Event(TX_EVENT, rand()%TOE_MAX_SESSIONS));
+            taiCnt++;
+        }
+        unsigned int rxeSize = ssRXeToEVe_Event.size();
+        unsigned int timSize = ssTImToEVe_Event.size();
+        unsigned int taiSize = ssTAiToEVe_Event.size();
+
+        //-- DUT
+        event_engine(
+            ssTAiToEVe_Event,
+            ssRXeToEVe_Event,
+            ssTImToEVe_Event,
+            ssEVeToAKd_Event,
+            ssAKdToEVe_RxEventSig,
+            ssAKdToEVe_TxEventSig,
+            ssTXeToEVe_RxEventSig);
+        ack_delay(
+            ssEVeToAKd_Event,
+            ssAKdToEVe_RxEventSig,
+            ssAKdToEVe_TxEventSig,
+            ssAKdToTXe_Event);
+
+        rxeRd += rxeSize - ssRXeToEVe_Event.size();
+        timRd += timSize - ssTImToEVe_Event.size();
+        taiRd += taiSize - ssTAiToEVe_Event.size();
+
+        //-- Model of [TXe]
+        if (txeBusy > 0) {
+            txeBusy--;
+        }
+        else if (!ssAKdToTXe_Event.empty()) {
+            ssAKdToTXe_Event.read();
+            ssTXeToEVe_RxEventSig.write(1);
+            txeBusy = cTXeCycPerEvent-1;
+            txeCnt++;
+        }
+        gSimCycCnt++;
     }
-    return 0;
+
+    printInfo(myName, "%-10s - RXe=%5d/%5d  TIm=%5d/%5d  TAi=%5d/%5d  -->  %4.2f events/cycle into [EVe] - %4.2f events/cycle into [TXe]\n",
+              prof.name, rxeRd, rxeCnt, timRd, timCnt, taiRd, taiCnt,
+              (double)(rxeRd+timRd+taiRd)/cSimCycles, (double)txeCnt/cSimCycles);
+
+    // A source with pending events must have been served
+    if ((rxeCnt and !rxeRd) or (timCnt and !timRd) or (taiCnt and !taiRd)) {
+        printError(myName, "%s - At least one source was starved.\n", prof.name);
+        nrErr++;
+    }
+
+    //-- Drain the pipeline before running the next profile
+    for (int cyc=0; cyc<10*cDepth_RXeToEVe_Event*cTXeCycPerEvent+2*TOE_MAX_SESSIONS; cyc++) {
+        event_engine(
+            ssTAiToEVe_Event,
+            ssRXeToEVe_Event,
+            ssTImToEVe_Event,
+            ssEVeToAKd_Event,
+            ssAKdToEVe_RxEventSig,
+            ssAKdToEVe_TxEventSig,
+            ssTXeToEVe_RxEventSig);
+        ack_delay(
+            ssEVeToAKd_Event,
+            ssAKdToEVe_RxEventSig,
+            ssAKdToEVe_TxEventSig,
+            ssAKdToTXe_Event);
+        if (!ssAKdToTXe_Event.empty()) {
+            ssAKdToTXe_Event.read();
+            ssTXeToEVe_RxEventSig.write(1);
+        }
+        gSimCycCnt++;
+    }
+    if (!ssRXeToEVe_Event.empty() or !ssTImToEVe_Event.empty() or !ssTAiToEVe_Event.empty()) {
+        printError(myName, "%s - The event pipeline did not drain.\n", prof.name);
+        nrErr++;
+    }
+    return nrErr;
+}
+
+/*******************************************************************************
+ * @brief Main function.
+ *******************************************************************************/
+int main(int argc, char* argv[]) {
+
+    const LoadProfile cProfiles[] = {
+        { "RX-heavy",  100,  5,  20 },
+        { "TX-heavy",   20,  5, 100 },
+        { "Mixed",      60, 10,  60 },
+        { "Saturated", 100, 50, 100 },
+    };
+    int nrErr = 0;
+
+    printInfo(THIS_NAME, "############################################################################\n");
+    printInfo(THIS_NAME, "## TESTBENCH 'test_event_engine' STARTS HERE                              ##\n");
+    printInfo(THIS_NAME, "############################################################################\n");
+
+    srand(0xCF);
+    for (int i=0; i<4; i++) {
+        nrErr += runProfile(cProfiles[i]);
+    }
+
+    if (nrErr) {
+        printError(THIS_NAME, "###########################################################\n");
+        printError(THIS_NAME, "#### TEST BENCH FAILED : TOTAL NUMBER OF ERROR(S) = %2d ####\n", nrErr);
+        printError(THIS_NAME, "###########################################################\n");
+    }
+    else {
+        printInfo(THIS_NAME, "#############################################################\n");
+        printInfo(THIS_NAME, "####               SUCCESSFUL END OF TEST                ####\n");
+        printInfo(THIS_NAME, "#############################################################\n");
+    }
+
+    return nrErr;
 }
+
+/*! \} */
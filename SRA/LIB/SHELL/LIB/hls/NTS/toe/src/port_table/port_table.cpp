@@ -129,21 +129,27 @@ void pReady(
  *
  * @details
  *  This process keeps track of the port opened in listening mode. It consists
- *   of a port table which is accessed by two remote processes:
+ *   of a port table, plus the tables of the options which the listen request
+ *   sets for the sessions of a port (i.e. the short TIME-WAIT duration, the
+ *   ACK policy and the keepalive profile). The options of a closed port are
+ *   not relevant.
+ *   These tables are accessed by two remote processes:
  *   1) the RxAppInterface (TAi) when the application (APP) is requesting to
  *      open a port in listening mode.
  *   2) the RxEngine (RXe) via the local InputRequestRouter (Irr) process, when
  *      the [RXe] is requesting the status of a destination port.
  *
- *  If a read and a write operation occur at the same time, the write operation
- *   (.i.e the opening of the port) takes precedence over the read operation.
+ *  A request to listen on a port outside of the static range [0..32,767], or
+ *   with an unknown keepalive profile, is refused. If a read and a write operation occur at the same time, the write
+ *   operation (.i.e the opening of the port) takes precedence over the read
+ *   operation.
  *******************************************************************************/
 void pListeningPortTable(
         StsBool              &poRdy_Ready,
-        stream<TcpPort>      &siRAi_OpenLsnPortReq,
+        stream<TcpAppLsnReq> &siRAi_OpenLsnPortReq,
         stream<RepBit>       &soRAi_OpenLsnPortRep,
         stream<TcpStaPort>   &siIrr_GetPortStateCmd,
-        stream<RspBit>       &soOrm_GetPortStateRsp)
+        stream<PortStsRep>   &soOrm_GetPortStateRsp)
 {
     //-- DIRECTIVES FOR THIS PROCESS -------------------------------------------
     #pragma HLS PIPELINE II=1 enable_flush
@@ -152,51 +158,78 @@ void pListeningPortTable(
     const char *myName = concat3(THIS_NAME, "/", "Lpt");
 
     //-- STATIC ARRAYS ---------------------------------------------------------
-    static PortState                LISTEN_PORT_TABLE[0x8000];
-    #pragma HLS RESOURCE   variable=LISTEN_PORT_TABLE core=RAM_T2P_BRAM
+    static FastClrTable<ap_uint<32>, 1024> LISTEN_PORT_TABLE;
     #pragma HLS DEPENDENCE variable=LISTEN_PORT_TABLE inter false
+    static FastClrTable<ap_uint<32>, 1024> SHORT_TIME_WAIT_TABLE;
+    #pragma HLS DEPENDENCE variable=SHORT_TIME_WAIT_TABLE inter false
+    static FastClrTable<ap_uint<64>, 1024> ACK_POLICY_TABLE;
+    #pragma HLS DEPENDENCE variable=ACK_POLICY_TABLE inter false
+    static FastClrTable<ap_uint<64>, 1024> KEEPALIVE_TABLE;
+    #pragma HLS DEPENDENCE variable=KEEPALIVE_TABLE inter false
 
     //-- STATIC CONTROL VARIABLES (with RESET) ---------------------------------
     static bool                lpt_isLPtInit=false;
     #pragma HLS reset variable=lpt_isLPtInit
-    static TcpPort             lpt_lsnPortNum=0;
-    #pragma HLS reset variable=lpt_lsnPortNum
 
-    // This table must be cleared upon reset
+    //-- STATIC DATAFLOW VARIABLES ---------------------------------------------
+    static TcpAppLsnReq        lpt_lsnPortReq;
+
+    // This table must be cleared upon reset (i.e. all ports are closed)
     if (!lpt_isLPtInit) {
-        LISTEN_PORT_TABLE[lpt_lsnPortNum(14, 0)] = STS_CLOSED;
-        lpt_lsnPortNum += 1;
-        if (lpt_lsnPortNum == 0x8000) {
-          lpt_isLPtInit = true;
-          if (DEBUG_LEVEL & TRACE_LPT) {
-              printInfo(myName, "Done with initialization of LISTEN_PORT_TABLE.\n");
-          }
+        LISTEN_PORT_TABLE.clear(0);
+        SHORT_TIME_WAIT_TABLE.clear(0);
+        ACK_POLICY_TABLE.clear(0);
+        KEEPALIVE_TABLE.clear(0);
+        lpt_isLPtInit = true;
+        if (DEBUG_LEVEL & TRACE_LPT) {
+            printInfo(myName, "Done with initialization of LISTEN_PORT_TABLE.\n");
         }
     }
     else {
         if (!siRAi_OpenLsnPortReq.empty() and !soRAi_OpenLsnPortRep.full()) {
-            siRAi_OpenLsnPortReq.read(lpt_lsnPortNum);
+            siRAi_OpenLsnPortReq.read(lpt_lsnPortReq);
             // [TODO] Let's add a specific bit to specifically open/close a port.
-            if (lpt_lsnPortNum < 0x8000) {
+            if ((lpt_lsnPortReq.port < 0x8000) and
+                (lpt_lsnPortReq.kaProfile <= TOE_KEEPALIVE_FAST)) {
                 // Listening port number falls in the range [0..32,767]
                 // We can set the listening port table entry to true
-                LISTEN_PORT_TABLE[lpt_lsnPortNum] = STS_OPENED;
+                TcpStaPort  staPort = lpt_lsnPortReq.port(14, 0);
+                ap_uint<32> lsnWord = LISTEN_PORT_TABLE.read(staPort(14, 5));
+                ap_uint<32> twsWord = SHORT_TIME_WAIT_TABLE.read(staPort(14, 5));
+                ap_uint<64> apsWord = ACK_POLICY_TABLE.read(staPort(14, 5));
+                ap_uint<64> kapWord = KEEPALIVE_TABLE.read(staPort(14, 5));
+                lsnWord[staPort(4, 0)] = STS_OPENED;
+                twsWord[staPort(4, 0)] = lpt_lsnPortReq.twShort;
+                apsWord(2*staPort(4, 0)+1, 2*staPort(4, 0)) = lpt_lsnPortReq.ackPolicy;
+                kapWord(2*staPort(4, 0)+1, 2*staPort(4, 0)) = lpt_lsnPortReq.kaProfile;
+                LISTEN_PORT_TABLE.write(staPort(14, 5), lsnWord);
+                SHORT_TIME_WAIT_TABLE.write(staPort(14, 5), twsWord);
+                ACK_POLICY_TABLE.write(staPort(14, 5), apsWord);
+                KEEPALIVE_TABLE.write(staPort(14, 5), kapWord);
                 // Sent reply to RAi
                 soRAi_OpenLsnPortRep.write(STS_OPENED);
                 if (DEBUG_LEVEL & TRACE_LPT)
-                printInfo(myName, "[RAi] is requesting to open port #%d in listen mode.\n",
-                          lpt_lsnPortNum.to_uint());
+                    printInfo(myName, "[RAi] is requesting to open port #%d in listen mode (short TIME-WAIT=%d, ACK policy=%d, keepalive=%d).\n",
+                              staPort.to_uint(), lpt_lsnPortReq.twShort.to_uint(),
+                              lpt_lsnPortReq.ackPolicy.to_uint(), lpt_lsnPortReq.kaProfile.to_uint());
             }
             else {
                 soRAi_OpenLsnPortRep.write(STS_CLOSED);
-            } 
+            }
         }
         else if (!siIrr_GetPortStateCmd.empty()) {
             // Warning: Cannot add "and !soOrm_GetPortStateRsp.full()" here because
             //  it increases the task interval from 1 to 2!
             TcpStaPort staticPortNum = siIrr_GetPortStateCmd.read();
             // Sent status of that portNum to Orm
-            soOrm_GetPortStateRsp.write(LISTEN_PORT_TABLE[staticPortNum]);
+            ap_uint<32> lsnWord = LISTEN_PORT_TABLE.read(staticPortNum(14, 5));
+            ap_uint<32> twsWord = SHORT_TIME_WAIT_TABLE.read(staticPortNum(14, 5));
+            ap_uint<64> apsWord = ACK_POLICY_TABLE.read(staticPortNum(14, 5));
+            ap_uint<64> kapWord = KEEPALIVE_TABLE.read(staticPortNum(14, 5));
+            soOrm_GetPortStateRsp.write(PortStsRep(lsnWord[staticPortNum(4, 0)],
+                                                   twsWord[staticPortNum(4, 0)],
+                                                   apsWord(2*staticPortNum(4, 0)+1, 2*staticPortNum(4, 0)),
+                                                   kapWord(2*staticPortNum(4, 0)+1, 2*staticPortNum(4, 0))));
             if (DEBUG_LEVEL & TRACE_LPT)
                 printInfo(myName, "[RXe] is querying the state of listen port #%d \n",
                           staticPortNum.to_uint());
@@ -206,6 +239,25 @@ void pListeningPortTable(
     poRdy_Ready = lpt_isLPtInit;
 }
 
+/*******************************************************************************
+ * @brief Returns the index of the lowest bit set in a bitmap word.
+ *
+ * @param[in] word  A non-null word of the bitmap.
+ *******************************************************************************/
+FptBitIdx lowestSetBit(
+        FptWord  word)
+{
+    #pragma HLS INLINE
+    FptBitIdx idx = 0;
+    for (int i=31; i>=0; i--) {
+        #pragma HLS UNROLL
+        if (word[i]) {
+            idx = i;
+        }
+    }
+    return idx;
+}
+
 /*******************************************************************************
  * @brief Free Port Table (Fpt)
  *
@@ -218,16 +270,17 @@ void pListeningPortTable(
  *
  * @details
  *  This process keeps track of the opened source ports used in by active
- *   connections. It consists of a  table containing a free list of ephemeral
- *   ports (also referred as dynamic ports) that the TOE uses as local source
- *   ports when it opens new active connections.
+ *   connections. It consists of a bitmap of the free ephemeral ports (also
+ *   referred as dynamic ports) that the TOE uses as local source ports when it
+ *   opens new active connections.
  *  A dynamic source port is implicitly assigned in the range (32,768 to 65,535)
  *   and there is no way (or reason) to explicitly specify such a port number.
  *  This table is accessed by one local [Irr] and 2 remote [SLc][TAi] processes.
- *
- * @Warning
- *  The initial design point assumed a maximum of 10K sessions, which is much
- *  less than the possible 32K active ports.
+ *  The bitmap has three levels (see FREE PORT BITMAP). A free port is found by
+ *   walking down the lowest bit set of the summary word, of a group word and of
+ *   a leaf word. A port request is therefore served within 3 clock cycles,
+ *   whatever the number of ports in use. When no port is left, the request is
+ *   held until a port gets released.
  *******************************************************************************/
 void pFreePortTable(
         StsBool              &poRdy_Ready,
@@ -245,73 +298,64 @@ void pFreePortTable(
     const char *myName = concat3(THIS_NAME, "/", "Fpt");
 
     //-- STATIC ARRAYS ---------------------------------------------------------
-    static PortRange                ACTIVE_PORT_TABLE[0x8000];
-    #pragma HLS RESOURCE   variable=ACTIVE_PORT_TABLE core=RAM_T2P_BRAM
-    #pragma HLS DEPENDENCE variable=ACTIVE_PORT_TABLE inter false
+    static FastClrTable<FptWord, 1024> FREE_PORT_LEAVES;
+    #pragma HLS DEPENDENCE variable=FREE_PORT_LEAVES inter false
+    static FastClrTable<FptWord,   32> FREE_PORT_GROUPS;
+    #pragma HLS DEPENDENCE variable=FREE_PORT_GROUPS inter false
 
     //-- STATIC CONTROL VARIABLES (with RESET) ---------------------------------
-    static bool                     fpt_isFPtInit=false;
-    #pragma HLS reset      variable=fpt_isFPtInit
-    static bool                     fpt_searching=false;
-    #pragma HLS reset      variable=fpt_searching
-    static bool                     fpt_eval=false;
-    #pragma HLS reset      variable=fpt_eval
-    static TcpDynPort               fpt_dynPortNum=0x7FFF;
-    #pragma HLS reset      variable=fpt_dynPortNum
+    static FptFsmState              fpt_fsmState=FPT_INIT;
+    #pragma HLS reset      variable=fpt_fsmState
+    static FptWord                  fpt_summary=0;
+    #pragma HLS reset      variable=fpt_summary
 
     //-- STATIC DATAFLOW VARIABLES ---------------------------------------------
-    static bool          portState = ACT_USED_PORT;
-    #pragma HLS DEPENDENCE variable=portState inter false
-
-    // The table is a free list that must be initialized upon reset
-    if (!fpt_isFPtInit) {
-        ACTIVE_PORT_TABLE[fpt_dynPortNum] = ACT_FREE_PORT;
-        fpt_dynPortNum -= 1;
-        if (fpt_dynPortNum == 0) {
-            fpt_isFPtInit = true;
-            if (DEBUG_LEVEL & TRACE_FPT) {
-                printInfo(myName, "Done with initialization of ACTIVE_PORT_TABLE.\n");
-            }
-        }
-    }
-    else {
-        if (fpt_searching) {
-            portState = ACTIVE_PORT_TABLE[fpt_dynPortNum];
-            fpt_searching = false;
-            fpt_eval      = true;
+    static FptLeafIdx               fpt_leafIdx;
+    static FptWord                  fpt_grpWord;
+    static FptWord                  fpt_leafWord;
+    static FptBitIdx                fpt_portBit;
+
+    //-- DYNAMIC VARIABLES -----------------------------------------------------
+    FptBitIdx                       grpIdx = fpt_leafIdx(9, 5);
+    FptBitIdx                       grpBit = fpt_leafIdx(4, 0);
+
+    switch (fpt_fsmState) {
+    case FPT_INIT:
+        // The bitmap must be cleared upon reset (i.e. all ports are free)
+        FREE_PORT_LEAVES.clear(~((FptWord)0));
+        FREE_PORT_GROUPS.clear(~((FptWord)0));
+        fpt_summary  = ~((FptWord)0);
+        fpt_fsmState = FPT_IDLE;
+        if (DEBUG_LEVEL & TRACE_FPT) {
+            printInfo(myName, "Done with initialization of FREE_PORT_LEAVES.\n");
         }
-        else if (fpt_eval) {
-            if (portState == ACT_FREE_PORT) {
-                // Found a free entry port in the table
-                if (!soTAi_GetFreePortRep.full()) {
-                    // Stop evaluating. Set port number to USED and forward to [TAi]
-                    fpt_eval = false;
-                    ACTIVE_PORT_TABLE[fpt_dynPortNum] = ACT_USED_PORT;
-                    // Add 0x8000 before sending back
-                    soTAi_GetFreePortRep.write(0x8000 + fpt_dynPortNum);
-                }
-            }
-            else {
-                // Continue searching
-            	fpt_searching = true;
-            }
-            fpt_dynPortNum++;
-        }
-        else if (!siIrr_GetPortStateCmd.empty()) {
+        break;
+    case FPT_IDLE:
+        if (!siIrr_GetPortStateCmd.empty()) {
             // Warning: Cannot add "and !soOrm_GetPortStateRsp.full()" here because
             //  it increases the task interval from 1 to 2!
             TcpDynPort portNum = siIrr_GetPortStateCmd.read();
-            soOrm_GetPortStateRsp.write(ACTIVE_PORT_TABLE[portNum]);
+            FptWord    leaf    = FREE_PORT_LEAVES.read(portNum(14, 5));
+            soOrm_GetPortStateRsp.write((leaf[portNum(4, 0)] == 1) ? ACT_FREE_PORT : ACT_USED_PORT);
         }
-        else if (!siTAi_GetFreePortReq.empty()) {
+        else if (!siTAi_GetFreePortReq.empty() and (fpt_summary != 0)) {
             siTAi_GetFreePortReq.read();
-            fpt_searching = true;
+            //-- Select the lowest group with a free port
+            grpIdx = lowestSetBit(fpt_summary);
+            fpt_leafIdx  = grpIdx;
+            fpt_leafIdx  = fpt_leafIdx << 5;
+            fpt_grpWord  = FREE_PORT_GROUPS.read(grpIdx);
+            fpt_fsmState = FPT_ALLOC_GRP;
         }
         else if (!siSLc_CloseActPortCmd.empty()) {
             TcpPort tcpPort = siSLc_CloseActPortCmd.read();
             if (tcpPort.bit(15) == 1) {
                 // Assess that port number >= 0x8000
-                ACTIVE_PORT_TABLE[tcpPort.range(14, 0)] = ACT_FREE_PORT;
+                fpt_leafIdx  = tcpPort(14, 5);
+                fpt_portBit  = tcpPort( 4, 0);
+                fpt_leafWord = FREE_PORT_LEAVES.read(tcpPort(14, 5));
+                fpt_grpWord  = FREE_PORT_GROUPS.read(tcpPort(14,10));
+                fpt_fsmState = FPT_RELEASE;
             }
           #ifndef __SYNTHESIS__
             else {
@@ -320,9 +364,52 @@ void pFreePortTable(
             }
           #endif
         }
+        break;
+    case FPT_ALLOC_GRP:
+        //-- Select the lowest leaf of this group with a free port
+        fpt_leafIdx(4, 0) = lowestSetBit(fpt_grpWord);
+        fpt_leafWord = FREE_PORT_LEAVES.read(fpt_leafIdx);
+        fpt_fsmState = FPT_ALLOC_LEAF;
+        break;
+    case FPT_ALLOC_LEAF:
+        if (!soTAi_GetFreePortRep.full()) {
+            //-- Select the lowest free port of this leaf and mark it as used
+            FptBitIdx portBit  = lowestSetBit(fpt_leafWord);
+            FptWord   leafWord = fpt_leafWord;
+            leafWord[portBit]  = 0;
+            FREE_PORT_LEAVES.write(fpt_leafIdx, leafWord);
+            if (leafWord == 0) {
+                //-- This leaf is full. So might be its group
+                FptWord grpWord = fpt_grpWord;
+                grpWord[grpBit] = 0;
+                FREE_PORT_GROUPS.write(grpIdx, grpWord);
+                if (grpWord == 0) {
+                    fpt_summary[grpIdx] = 0;
+                }
+            }
+            TcpPort freePort = 0x8000;
+            freePort(14, 5)  = fpt_leafIdx;
+            freePort( 4, 0)  = portBit;
+            soTAi_GetFreePortRep.write(freePort);
+            if (DEBUG_LEVEL & TRACE_FPT) {
+                printInfo(myName, "Assigning free port #%d.\n", freePort.to_uint());
+            }
+            fpt_fsmState = FPT_IDLE;
+        }
+        break;
+    case FPT_RELEASE:
+        //-- Mark the port as free, as well as its leaf and its group
+        fpt_leafWord[fpt_portBit] = 1;
+        fpt_grpWord[grpBit]       = 1;
+        FREE_PORT_LEAVES.write(fpt_leafIdx, fpt_leafWord);
+        FREE_PORT_GROUPS.write(grpIdx,      fpt_grpWord);
+        fpt_summary[grpIdx]           = 1;
+        fpt_fsmState = FPT_IDLE;
+        break;
     }
+
     // ALWAYS
-    poRdy_Ready = fpt_isFPtInit;
+    poRdy_Ready = (fpt_fsmState != FPT_INIT);
 }
 
 /*******************************************************************************
@@ -382,13 +469,14 @@ void pInputRequestRouter(
  *
  * @details
  *  This process orders the lookup replies before sending them back to the
- *   RxEngine (RXe).
+ *   RxEngine (RXe). An active port uses none of the options of a listening
+ *   port (i.e. the default TIME-WAIT duration and ACK policy).
  *******************************************************************************/
 void pOutputReplyMultiplexer(
         stream<PortRange> &siIrr_QueryRange,
-        stream<RspBit>    &siLpt_GetLsnPortStateRsp,
-        stream<RspBit>    &siFpt_GetActPortStateRsp,
-        stream<RspBit>    &soRXe_GetPortStateRsp)
+        stream<PortStsRep> &siLpt_GetLsnPortStateRsp,
+        stream<RspBit>     &siFpt_GetActPortStateRsp,
+        stream<PortStsRep> &soRXe_GetPortStateRsp)
 {
     //-- DIRECTIVES FOR THIS PROCESS -------------------------------------------
     #pragma HLS PIPELINE II=1 enable_flush
@@ -418,7 +506,7 @@ void pOutputReplyMultiplexer(
         break;
     case ORM_FORWARD_ACT_PORT_STATE_RSP:
         if (!siFpt_GetActPortStateRsp.empty() and !soRXe_GetPortStateRsp.full()) {
-            soRXe_GetPortStateRsp.write(siFpt_GetActPortStateRsp.read());
+            soRXe_GetPortStateRsp.write(PortStsRep(siFpt_GetActPortStateRsp.read()));
             orm_fsmState = ORM_WAIT_FOR_QUERY_FROM_Irr;
         }
         break;
@@ -430,7 +518,7 @@ void pOutputReplyMultiplexer(
  *
  * @param[out] poTOE_Ready            The ready logic signal of this process to [TOE].
  * @param[in]  siRXe_GetPortStateReq  Port state request from RxEngine (RXe).
- * @param[out] soRXe_GetPortStateRep  Port state reply to [RXe].
+ * @param[out] soRXe_GetPortStateRep  Port state reply to [RXe] (see PortStsRep).
  * @param[in]  siRAi_OpenLsnPortReq   Open port request from RxAppInterface (RAi).
  * @param[out] soRAi_OpenLsnPortRep   Open port reply to [RAi].
  * @param[in]  siTAi_GetFreePortReq   Free port request from TxAppInterface (TAi).
@@ -439,8 +527,7 @@ void pOutputReplyMultiplexer(
  *
  * @details
  *  This process keeps track of the TCP port numbers which are in use and
- *   therefore opened. It maintains two port ranges based on two tables of
- *   32768 x 1-bit:
+ *   therefore opened. It maintains two port ranges of 32768 ports each:
  *   - One for static ports (0 to 32,767) which are used for listening ports,
  *   - One for dynamically assigned or ephemeral ports (32,768 to 65,535)
  *     which are used for active connections open by [TOE].
@@ -453,8 +540,8 @@ void pOutputReplyMultiplexer(
 void port_table(
         StsBool                 &poTOE_Ready,
         stream<TcpPort>         &siRXe_GetPortStateReq,
-        stream<RepBit>          &soRXe_GetPortStateRep,
-        stream<TcpPort>         &siRAi_OpenLsnPortReq,
+        stream<PortStsRep>      &soRXe_GetPortStateRep,
+        stream<TcpAppLsnReq>    &siRAi_OpenLsnPortReq,
         stream<AckBit>          &soRAi_OpenLsnPortAck,
         stream<ReqBit>          &siTAi_GetFreePortReq,
         stream<TcpPort>         &soTAi_GetFreePortRep,
@@ -481,8 +568,9 @@ void port_table(
 
     //-- Listening Port Table (Lpt)
     StsBool                      sLptToAnd2_Ready;
-    static stream<RspBit>       ssLptToOrm_GetLsnPortStateRsp ("ssLptToOrm_GetLsnPortStateRsp");
+    static stream<PortStsRep>   ssLptToOrm_GetLsnPortStateRsp ("ssLptToOrm_GetLsnPortStateRsp");
     #pragma HLS STREAM variable=ssLptToOrm_GetLsnPortStateRsp depth=2
+    #pragma HLS DATA_PACK variable=ssLptToOrm_GetLsnPortStateRsp
 
     //-- Free Port Table (Fpt)
     StsBool                      sFptToAnd2_Ready;
@@ -71,6 +71,21 @@ typedef AckBit PortState;
 
 #define PortRange     bool
 
+/*******************************************************************************
+ * FREE PORT BITMAP
+ *******************************************************************************
+ * The 32K ephemeral ports are kept in a three-level bitmap of 32-bit words,
+ *  where a set bit stands for a free port (or for a word with a free port).
+ *  - The summary word has one bit per group of 1024 ports.
+ *  - The 32 group words have one bit per leaf word of their group.
+ *  - The 1024 leaf words have one bit per port.
+ *******************************************************************************/
+typedef ap_uint<32>   FptWord;
+typedef ap_uint<5>    FptBitIdx;
+typedef ap_uint<10>   FptLeafIdx;
+
+enum FptFsmState { FPT_INIT=0, FPT_IDLE, FPT_ALLOC_GRP, FPT_ALLOC_LEAF, FPT_RELEASE };
+
 
 /*******************************************************************************
  *
@@ -82,9 +97,9 @@ void port_table(
         StsBool                 &poTOE_Ready,
         //-- RXe / Rx Engine Interface
         stream<TcpPort>         &siRXe_GetPortStateReq,
-        stream<RepBit>          &soRXe_GetPortStateRep,
+        stream<PortStsRep>      &soRXe_GetPortStateRep,
         //-- RAi / Rx Application Interface
-        stream<TcpPort>         &siRAi_OpenLsnPortReq,
+        stream<TcpAppLsnReq>    &siRAi_OpenLsnPortReq,
         stream<AckBit>          &soRAi_OpenLsnPortAck,
         //-- TAi / Tx Application Interface
         stream<ReqBit>          &siTAi_GetFreePortReq,
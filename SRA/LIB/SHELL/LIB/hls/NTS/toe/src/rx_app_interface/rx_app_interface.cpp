@@ -154,6 +154,9 @@ void pNotificationMux(
  *
  * @param[in]  siTAIF_DataReq  Data request from TcpApplicationInterface (TAIF).
  * @param[out] soTAIF_Meta     Metadata to [TAIF].
+ * @param[in]  siTAIF_DscReq   Descriptor request from [TAIF].
+ * @param[out] soTAIF_RdDsc    Read descriptor to [TAIF].
+ * @param[in]  siTAIF_RxCrd    Rx buffer credit from [TAIF].
  * @param[out] soRSt_RxSarQry  Query to RxSarTable (RSt).
  * @param[in]  siRSt_RxSarRep  Reply from [RSt].
  * @param[out] soMrd_MemRdCmd  Rx memory read command to Rx MemoryReader (Mrd).
@@ -166,6 +169,14 @@ void pNotificationMux(
  *   RxApp pointer of the session is forwarded to the RxSarTable (RSt) and a
  *   meta-data (.i.e the current session-id) is sent back to [TAIF] to signal
  *   that the request has been processed.
+ *  A descriptor request is processed the same way, except that the data are
+ *   not read. Instead, the location of the requested bytes in the TCP Rx buffer
+ *   is returned to [TAIF] and only the descriptor pointer ('dscd') of the
+ *   session is advanced. The application reads the data from the DRAM by itself
+ *   and returns a credit once it is done with them. That credit advances the
+ *   RxApp pointer ('appd') which in turn re-opens the receive window. A session
+ *   must not issue a data request while some of its descriptors are not yet
+ *   credited.
  *
  * @warning
  *  To avoid any blocking of [RAi], the current metadata to be sent on the
@@ -178,9 +189,12 @@ void pNotificationMux(
 void pRxAppStream(
     stream<TcpAppRdReq>         &siTAIF_DataReq,
     stream<TcpAppMeta>          &soTAIF_Meta,
+    stream<TcpAppRdReq>         &siTAIF_DscReq,
+    stream<TcpAppRdDsc>         &soTAIF_RdDsc,
+    stream<TcpAppRxCrd>         &siTAIF_RxCrd,
     stream<RAiRxSarQuery>       &soRSt_RxSarQry,
     stream<RAiRxSarReply>       &siRSt_RxSarRep,
-    stream<DmCmd>               &soMrd_MemRdCmd,
+    stream<RxBufRdCmd>          &soMrd_MemRdCmd,
     stream<ap_uint<8> >         &soMMIO_MetaDropCnt)
 {
     //-- DIRECTIVES FOR THIS PROCESS -------------------------------------------
@@ -198,15 +212,39 @@ void pRxAppStream(
 
     //-- STATIC DATAFLOW VARIABLES ---------------------------------------------
     static TcpSegLen    ras_readLength;
+    static FlagBool     ras_isDsc;
 
     switch (ras_fsmState) {
     case S0:
-        if (!siTAIF_DataReq.empty() and !soRSt_RxSarQry.full()) {
+        if (!siTAIF_RxCrd.empty() and !soRSt_RxSarQry.full()) {
+            //-- Release the bytes which the APP is done with
+            TcpAppRxCrd appCredit = siTAIF_RxCrd.read();
+            soRSt_RxSarQry.write(RAiRxSarQuery(appCredit.sessionID, appCredit.length, RAI_QRY_CRED));
+            if (DEBUG_LEVEL & TRACE_RAS) {
+                printInfo(myName, "S%d - Received a credit of %d bytes.\n",
+                          appCredit.sessionID.to_int(), appCredit.length.to_int());
+            }
+        }
+        else if (!siTAIF_DscReq.empty() and !soRSt_RxSarQry.full()) {
+            TcpAppRdReq  appDscRequest = siTAIF_DscReq.read();
+            if (appDscRequest.length != 0) {
+                soRSt_RxSarQry.write(RAiRxSarQuery(appDscRequest.sessionID));
+                ras_readLength = appDscRequest.length;
+                ras_isDsc = true;
+                ras_fsmState = S1;
+            }
+            else if (!soTAIF_RdDsc.full()) {
+                // Return an empty descriptor to avoid blocking the APP
+                soTAIF_RdDsc.write(TcpAppRdDsc(appDscRequest.sessionID, 0, 0, false));
+            }
+        }
+        else if (!siTAIF_DataReq.empty() and !soRSt_RxSarQry.full()) {
             TcpAppRdReq  appReadRequest = siTAIF_DataReq.read();
             if (appReadRequest.length != 0) {
                 // Make sure length is not 0, otherwise Data Mover will hang
                 soRSt_RxSarQry.write(RAiRxSarQuery(appReadRequest.sessionID));
                 ras_readLength = appReadRequest.length;
+                ras_isDsc = false;
                 ras_fsmState = S1;
             }
             else {
@@ -223,7 +261,33 @@ void pRxAppStream(
         }
         break;
     case S1:
-        if (!siRSt_RxSarRep.empty() and
+        if (ras_isDsc) {
+            if (!siRSt_RxSarRep.empty() and
+                !soTAIF_RdDsc.full() and !soRSt_RxSarQry.full()) {
+                RAiRxSarReply rxSarRep = siRSt_RxSarRep.read();
+                // Locate the requested bytes in the Rx buffer of the session
+                TcpSegLen contLen;
+                RxMemPtr memSegAddr = TOE_RX_MEMORY_BASE;
+                memSegAddr(TOE_RX_MEMORY_BITS-1, TOE_SLICE_BITS) = rxSarRep.sessionID(TOE_RX_MEMORY_BITS-TOE_SLICE_BITS-1, 0);
+                memSegAddr(TOE_SLICE_BITS-1, 0) = locateInBuffer(rxSarRep.appd, rxSarRep.spillCur, rxSarRep.spillNext,
+                                                                 rxSarRep.dscd, ras_readLength, contLen);
+                TcpSegLen dscLength = ras_readLength;
+              #if TOE_BUF_POOL_CFG || TOE_SPILL_CFG
+                // The next page (or the start of the spilled bytes) is not contiguous in memory
+                dscLength = contLen;
+              #endif
+                soTAIF_RdDsc.write(TcpAppRdDsc(rxSarRep.sessionID, memSegAddr, dscLength,
+                                               (dscLength > contLen)));
+                // Update the descriptor pointer
+                soRSt_RxSarQry.write(RAiRxSarQuery(rxSarRep.sessionID, rxSarRep.dscd+dscLength, RAI_QRY_DSCD));
+                if (DEBUG_LEVEL & TRACE_RAS) {
+                    printInfo(myName, "S%d - Handing over %d bytes at 0x%8.8x.\n",
+                              rxSarRep.sessionID.to_int(), dscLength.to_int(), memSegAddr.to_uint());
+                }
+                ras_fsmState = S0;
+            }
+        }
+        else if (!siRSt_RxSarRep.empty() and
             !soMrd_MemRdCmd.full() and !soRSt_RxSarQry.full()) {
             RAiRxSarReply rxSarRep = siRSt_RxSarRep.read();
             // Signal that the data request has been processed by sending the SessId back to [TAIF]
@@ -236,10 +300,12 @@ void pRxAppStream(
                 printFatal(myName, "Cannot write 'soTAIF_Meta()'. Stream is full!");
             }
             // Generate a memory buffer read command
+            TcpSegLen contLen;
             RxMemPtr memSegAddr = TOE_RX_MEMORY_BASE;
-            memSegAddr(29, 16) = rxSarRep.sessionID(13, 0);
-            memSegAddr(15,  0) = rxSarRep.appd;
-            soMrd_MemRdCmd.write(DmCmd(memSegAddr, ras_readLength));
+            memSegAddr(TOE_RX_MEMORY_BITS-1, TOE_SLICE_BITS) = rxSarRep.sessionID(TOE_RX_MEMORY_BITS-TOE_SLICE_BITS-1, 0);
+            memSegAddr(TOE_SLICE_BITS-1, 0) = locateInBuffer(rxSarRep.appd, rxSarRep.spillCur, rxSarRep.spillNext,
+                                                             rxSarRep.appd, ras_readLength, contLen);
+            soMrd_MemRdCmd.write(RxBufRdCmd(DmCmd(memSegAddr, ras_readLength), contLen));
             // Update the APP read pointer
             soRSt_RxSarQry.write(RAiRxSarQuery(rxSarRep.sessionID, rxSarRep.appd+ras_readLength));
             ras_fsmState = S0;
@@ -266,14 +332,16 @@ void pRxAppStream(
  * @details
  *  This process takes the memory read command assembled by RxAppStream (Ras)
  *   an forwards it to the memory sub-system (MEM). While doing so, it checks if
- *   the TCP Rx memory buffer wraps around and accordingly generates two memory
- *   read commands out of the initial command received from [Ras].
+ *   the requested bytes are contiguous in memory and otherwise generates two
+ *   memory read commands out of the initial command received from [Ras]. The
+ *   2nd command starts at the beginning of the Rx buffer (or of the next page,
+ *   or right after the bytes which spilled over into the spill region).
  *  Because the AppSegmetStitcher (Ass) process needs to be aware of this split,
  *   a signal is sent to [Ass] telling whether a data segment was broken in two
  *   Rx memory buffers or is provided as a single buffer.
  *******************************************************************************/
 void pRxMemoryReader(
-        stream<DmCmd>     &siRas_MemRdCmd,
+        stream<RxBufRdCmd> &siRas_MemRdCmd,
         stream<DmCmd>     &soMEM_RxpRdCmd,
         stream<FlagBool>  &soAss_SplitSeg)
 {
@@ -290,17 +358,19 @@ void pRxMemoryReader(
 
     //-- STATIC DATAFLOW VARIABLES ---------------------------------------------
     static DmCmd    mrd_memRdCmd;
-    static RxBufPtr mrd_firstAccLen;
+    static TcpSegLen mrd_firstAccLen;
     static uint16_t mrd_debugCounter=1;
 
     switch (mrd_fsmState) {
     case MRD_1ST_ACCESS:
         if (!siRas_MemRdCmd.empty() and !soAss_SplitSeg.full() and !soMEM_RxpRdCmd.full() ) {
-            siRas_MemRdCmd.read(mrd_memRdCmd);
+            RxBufRdCmd rxBufRdCmd = siRas_MemRdCmd.read();
+            mrd_memRdCmd = rxBufRdCmd.dmCmd;
 
-            if ((mrd_memRdCmd.saddr.range(TOE_WINDOW_BITS-1, 0) + mrd_memRdCmd.btt) > TOE_RX_BUFFER_SIZE) {
+            if (mrd_memRdCmd.btt > rxBufRdCmd.contLen) {
                 // This segment was broken in two memory accesses because TCP Rx memory buffer wrapped around
-                mrd_firstAccLen = TOE_RX_BUFFER_SIZE - mrd_memRdCmd.saddr;
+                //  (or because it crossed a buffer page when the buffer pool is enabled)
+                mrd_firstAccLen = rxBufRdCmd.contLen;
                 mrd_fsmState = MRD_2ND_ACCESS;
 
                 soMEM_RxpRdCmd.write(DmCmd(mrd_memRdCmd.saddr, mrd_firstAccLen));
@@ -326,8 +396,11 @@ void pRxMemoryReader(
         break;
     case MRD_2ND_ACCESS:
         if (!soMEM_RxpRdCmd.full()) {
-            // Update the command to account for the Rx buffer wrap around
-            mrd_memRdCmd.saddr(TOE_WINDOW_BITS-1, 0) = 0;
+            // Update the command to account for the Rx buffer wrap around (or page crossing)
+            mrd_memRdCmd.saddr(TOE_WINDOW_BITS-1, 0) = mrd_memRdCmd.saddr(TOE_WINDOW_BITS-1, 0) + mrd_firstAccLen;
+          #if TOE_SPILL_CFG
+            mrd_memRdCmd.saddr[TOE_WINDOW_BITS] = 0;
+          #endif
             soMEM_RxpRdCmd.write(DmCmd(mrd_memRdCmd.saddr, mrd_memRdCmd.btt - mrd_firstAccLen));
 
             mrd_fsmState = MRD_1ST_ACCESS;
@@ -647,7 +720,7 @@ void pAppSegmentStitcher(
 void pLsnAppInterface(
         stream<TcpAppLsnReq>    &siTAIF_LsnReq,
         stream<TcpAppLsnRep>    &soTAIF_LsnRep,
-        stream<TcpPort>         &soPRt_LsnReq,
+        stream<TcpAppLsnReq>    &soPRt_LsnReq,
         stream<RepBit>          &siPRt_LsnRep)
         //stream<TcpPort>       &siTAIF_StopLsnReq,
         //stream<TcpPort>       &soPRt_CloseReq,)
@@ -663,8 +736,8 @@ void pLsnAppInterface(
     #pragma HLS reset variable=lai_waitForPRtRep
 
     //-- DYNAMIC VARIABLES -----------------------------------------------------
-    TcpPort     listenPort;
-    RepBit      listenRep;
+    TcpAppLsnReq listenPort;
+    RepBit       listenRep;
 
     if (!siTAIF_LsnReq.empty() and !lai_waitForPRtRep) {
         siTAIF_LsnReq.read(listenPort);
@@ -696,6 +769,9 @@ void pLsnAppInterface(
  * @param[in]  siTAIF_DataReq  Request to retrieve data from [TAIF].
  * @param[out] soTAIF_Data     TCP data stream to [TAIF].
  * @param[out] soTAIF_Meta     Metadata to [TAIF].
+ * @param[in]  siTAIF_DscReq   Request to retrieve a read descriptor from [TAIF].
+ * @param[out] soTAIF_RdDsc    Read descriptor to [TAIF].
+ * @param[in]  siTAIF_RxCrd    Rx buffer credit from [TAIF].
  * @param[in]  siTAIF_LsnReq   TCP listen port request from [TAIF].
  * @param[out] soTAIF_LsnRep   TCP listen port reply to [TAIF].
  * @param[out] soPRt_LsnReq    TCP listen port request to PortTable (PRt).
@@ -733,11 +809,15 @@ void rx_app_interface(
         //-- TAIF / Data Stream Interfaces
         stream<TcpAppData>          &soTAIF_Data,
         stream<TcpAppMeta>          &soTAIF_Meta,
+        //-- TAIF / Zero-copy Interfaces
+        stream<TcpAppRdReq>         &siTAIF_DscReq,
+        stream<TcpAppRdDsc>         &soTAIF_RdDsc,
+        stream<TcpAppRxCrd>         &siTAIF_RxCrd,
         //-- TAIF / Listen Interfaces
         stream<TcpAppLsnReq>        &siTAIF_LsnReq,
         stream<TcpAppLsnRep>        &soTAIF_LsnRep,
         //-- PRt / Port Table Interfaces
-        stream<TcpPort>             &soPRt_LsnReq,
+        stream<TcpAppLsnReq>        &soPRt_LsnReq,
         stream<AckBit>              &siPRt_LsnAck,
         //-- RXe / Rx Engine Notification Interface
         stream<TcpAppNotif>         &siRXe_Notif,
@@ -762,7 +842,7 @@ void rx_app_interface(
     //--------------------------------------------------------------------------
 
     //-- Rx Application Stream (Ras) -------------------------------------------
-	static stream<DmCmd>        ssRasToMrd_MemRdCmd ("ssRasToMrd_MemRdCmd");
+	static stream<RxBufRdCmd>   ssRasToMrd_MemRdCmd ("ssRasToMrd_MemRdCmd");
     #pragma HLS stream variable=ssRasToMrd_MemRdCmd depth=16
 
     //-- Rx Memory Reader (Mrd) ------------------------------------------------
@@ -772,6 +852,9 @@ void rx_app_interface(
     pRxAppStream(
             siTAIF_DataReq,
             soTAIF_Meta,
+            siTAIF_DscReq,
+            soTAIF_RdDsc,
+            siTAIF_RxCrd,
             soRSt_RxSarReq,
             siRSt_RxSarRep,
             ssRasToMrd_MemRdCmd,
@@ -58,9 +58,26 @@ EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "../../../../NTS/nts_utils.hpp"
 #include "../../../../NTS/toe/src/toe.hpp"
+#include "../../../../NTS/toe/src/toe_utils.hpp"
 
 using namespace hls;
 
+/********************************************
+ * RAi - Rx Buffer Read Command
+ *  A memory read command along with the
+ *  number of bytes which are contiguous in
+ *  memory (the rest continues at the start
+ *  of the Rx buffer or of the next page).
+ ********************************************/
+class RxBufRdCmd {
+  public:
+    DmCmd       dmCmd;
+    TcpSegLen   contLen;
+    RxBufRdCmd() {}
+    RxBufRdCmd(DmCmd dmCmd, TcpSegLen contLen) :
+        dmCmd(dmCmd), contLen(contLen) {}
+};
+
 /*******************************************************************************
  *
  * @brief ENTITY - Rx Application Interface (RAi)
@@ -72,11 +89,15 @@ void rx_app_interface(
         stream<TcpAppRdReq>         &siTAIF_DataReq,
         stream<TcpAppData>          &soTAIF_Data,
         stream<TcpAppMeta>          &soTAIF_Meta,
+        //-- TAIF / Zero-copy Interfaces
+        stream<TcpAppRdReq>         &siTAIF_DscReq,
+        stream<TcpAppRdDsc>         &soTAIF_RdDsc,
+        stream<TcpAppRxCrd>         &siTAIF_RxCrd,
         //-- TAIF / Listen Interfaces
         stream<TcpAppLsnReq>        &siTAIF_LsnReq,
         stream<TcpAppLsnRep>        &soTAIF_LsnRep,
         //-- PRt / Port Table Interfaces
-        stream<TcpPort>             &soPRt_LsnReq,
+        stream<TcpAppLsnReq>        &soPRt_LsnReq,
         stream<AckBit>              &siPRt_LsnAck,
         //-- RXe / Rx Engine Notification Interface
         stream<TcpAppNotif>         &siRXe_Notif,
@@ -81,6 +81,7 @@ open_project  ${projectName}_prj
 #-------------------------------------------------
 add_files     ${currDir}/src/${projectName}.cpp
 add_files     ${currDir}/../../../../NTS/nts_utils.cpp
+add_files     ${currDir}/../../../toe/src/congestion_control/congestion_control.cpp
 add_files     ${currDir}/../../../../NTS/SimNtsUtils.cpp
 
 # Add test bench files
@@ -78,6 +78,7 @@ using namespace hls;
 #define TRACE_FSM 1 <<  8
 #define TRACE_MWR 1 <<  9
 #define TRACE_RAN 1 << 10
+#define TRACE_RNC 1 << 11
 #define TRACE_ALL  0xFFFF
 
 #define DEBUG_LEVEL (TRACE_OFF)
@@ -89,6 +90,7 @@ using namespace hls;
  * @param[in]  siIPRX_Data     IP4 packet stream from IpRxHandler (IPRX).
  * @param[out] soIph_Data      A custom-made pseudo packet to InsertPseudoHeader (Iph).
  * @param[out] soIph_TcpSegLen The length of the incoming TCP segment to [Iph].
+ * @param[out] soCsa_CeMark    The ECN Congestion Experienced mark to CheckSumAccumulator (Csa).
  *
  * @details
  *   This process receives the incoming IPv4 data stream from IpRxHandler (IPRX).
@@ -98,6 +100,9 @@ using namespace hls;
  *   populate the rest of the TCP pseudo header.
  *   The length of the IPv4 data (.i.e. the TCP segment length) is computed from
  *   the IPv4 total length and the IPv4 header length.
+ *   The ECN field of the IPv4 header is not part of the pseudo header. Its
+ *   Congestion Experienced (CE) codepoint is therefore forwarded on a side
+ *   channel to be used by the congestion control.
  *
  *   The data received from [IPRX] are logically divided into lane #0 (7:0) to
  *   lane #7 (63:56). The format of an incoming IPv4 packet is defined in
@@ -145,7 +150,8 @@ using namespace hls;
 void pTcpLengthExtractor(
         stream<AxisIp4>      &siIPRX_Data,
         stream<AxisRaw>      &soIph_Data,
-        stream<TcpSegLen>    &soIph_TcpSegLen)
+        stream<TcpSegLen>    &soIph_TcpSegLen,
+        stream<FlagBit>      &soCsa_CeMark)
 {
     //-- DIRECTIVES FOR THIS PROCESS -------------------------------------------
     #pragma HLS PIPELINE II=1 enable_flush
@@ -164,6 +170,7 @@ void pTcpLengthExtractor(
     static Ip4HdrLen    tle_ip4HdrLen;
     static Ip4TotalLen  tle_ip4TotLen;
     static Ip4DatLen    tle_ipDataLen;
+    static FlagBit      tle_ceMark;
     static AxisIp4      tle_prevChunk;
 
     //-- DYNAMIC VARIABLES -----------------------------------------------------
@@ -178,23 +185,22 @@ void pTcpLengthExtractor(
             tle_ip4TotLen = currChunk.getIp4TotalLen();
             // Compute length of IPv4 data (.i.e. the TCP segment length)
             tle_ipDataLen  = tle_ip4TotLen - (tle_ip4HdrLen * 4);
+            // ECN field = ToS[1:0] and CE = 0b11 [RFC-3168]
+            tle_ceMark = (currChunk.getIp4ToS()(1, 0) == 0x3) ? 1 : 0;
             tle_ip4HdrLen -= 2; // We just processed 8 bytes
             tle_chunkCount++;
             break;
         case CHUNK_1:
             // Forward length of IPv4 data (.i.e. the TCP segment length)
             soIph_TcpSegLen.write(tle_ipDataLen);
+            soCsa_CeMark.write(tle_ceMark);
             tle_ip4HdrLen -= 2; // We just processed 8 bytes
             tle_chunkCount++;
             break;
         case CHUNK_2:
             // Forward destination IP address
             // Warning, half of this address is now in 'prevChunk'
-            sendChunk.setLE_TData(tle_prevChunk.getLE_TData(63, 32), 31,  0);
-            sendChunk.setLE_TKeep(tle_prevChunk.getLE_TKeep( 7,  4),  3,  0);
-            sendChunk.setLE_TData(    currChunk.getLE_TData(31,  0), 63, 32);
-            sendChunk.setLE_TKeep(    currChunk.getLE_TKeep( 3,  0),  7,  4);
-            sendChunk.setLE_TLast(    currChunk.getLE_TKeep()[4] == 0);
+            sendChunk = axisRawJoin<4>(tle_prevChunk, currChunk);
             soIph_Data.write(sendChunk);
             tle_ip4HdrLen -= 1;  // We just processed the last 4 bytes of a standard IP4 header
             tle_chunkCount++;
@@ -203,11 +209,7 @@ void pTcpLengthExtractor(
         case CHUNK_3:
             switch (tle_ip4HdrLen) {
             case 0: // No or end of IP option(s) - Forward half of 'prevChunk' and half of 'currChunk'.
-                sendChunk.setLE_TData(tle_prevChunk.getLE_TData(63, 32), 31,  0);
-                sendChunk.setLE_TKeep(tle_prevChunk.getLE_TKeep( 7,  4),  3,  0);
-                sendChunk.setLE_TData(    currChunk.getLE_TData(31,  0), 63, 32);
-                sendChunk.setLE_TKeep(    currChunk.getLE_TKeep( 3,  0),  7,  4);
-                sendChunk.setLE_TLast(    currChunk.getLE_TKeep()[4] == 0);
+                sendChunk = axisRawJoin<4>(tle_prevChunk, currChunk);
                 soIph_Data.write(sendChunk);
                 tle_shift = true;
                 tle_chunkCount++;
@@ -229,11 +231,7 @@ void pTcpLengthExtractor(
         default:
             if (tle_shift) {
                 // The 'currChunk' is not aligned with the outgoing 'sendChunk'
-                sendChunk.setLE_TData(tle_prevChunk.getLE_TData(63, 32), 31,  0);
-                sendChunk.setLE_TKeep(tle_prevChunk.getLE_TKeep( 7,  4),  3,  0);
-                sendChunk.setLE_TData(    currChunk.getLE_TData(31,  0), 63, 32);
-                sendChunk.setLE_TKeep(    currChunk.getLE_TKeep( 3,  0),  7,  4);
-                sendChunk.setLE_TLast(    currChunk.getLE_TKeep()[4] == 0);
+                sendChunk = axisRawJoin<4>(tle_prevChunk, currChunk);
                 soIph_Data.write(sendChunk);
                 if (DEBUG_LEVEL & TRACE_TLE) { printAxisRaw(myName, "soIph_Data =", sendChunk); }
                 if (currChunk.getTLast()) {
@@ -257,9 +255,7 @@ void pTcpLengthExtractor(
     }
     else if (tle_residue) {
         // Send remaining data
-        AxisRaw sendChunk = AxisRaw(0, 0, TLAST);
-        sendChunk.setLE_TData(tle_prevChunk.getLE_TData(63, 32), 31, 0);
-        sendChunk.setLE_TKeep(tle_prevChunk.getLE_TKeep( 7,  4),  3, 0);
+        AxisRaw sendChunk = axisRawTail<4>(tle_prevChunk);
         soIph_Data.write(sendChunk);
         tle_residue = false;
         if (DEBUG_LEVEL & TRACE_TLE) { printAxisRaw(myName, "soIph_Data =", sendChunk); }
@@ -407,11 +403,14 @@ void pInsertPseudoHeader(
  * @brief TCP checksum accumulator (Csa)
  *
  * @param[in]  siIph_PseudoPkt A pseudo TCP packet from InsertPseudoHeader (Iph).
+ * @param[in]  siTle_CeMark    The ECN Congestion Experienced mark from TcpLengthExtractor (Tle).
  * @param[out] soTid_Data      TCP data stream to TcpInvalidDropper (Tid).
  * @param[out] soTid_DataVal   TCP data valid to [Tid].
  * @param[out] soMdh_Meta      TCP metadata to MetaDataHandler (Mdh).
  * @param[out] soMdh_SockPair  TCP socket pair to [Mdh].
  * @param[out] soPRt_GetState  Req state of the TCP DestPort to PortTable (PRt).
+ * @param[out] soMdh_Verdict   Late checksum verdict of a cut-through segment to [Mdh].
+ * @param[out] soTid_LateVal   Late checksum verdict of a cut-through segment to [Tid].
  *
  * @details
  *  This process extracts the data section from the incoming pseudo IP packet
@@ -421,6 +420,12 @@ void pInsertPseudoHeader(
  *   from the TCP segment and forwards them to the MetaDataHandler (Mdh).
  *  Next, the TCP destination port number is extracted and forwarded to the
  *   PortTable (PRt) process to check if the port is open.
+ *  The checksum is accumulated on the fly with the carry-save helpers of
+ *   'nts_utils' and is verified in the cycle following the end-of-segment.
+ *  When TOE_RX_CUT_THROUGH_CFG is set, the metadata of a segment carrying data
+ *   and a plain ACK are forwarded as soon as its header is parsed, and [Tid] is
+ *   told to let its payload go. Such a segment is marked as RX_PHASE_SPEC and
+ *   its checksum verdict is only forwarded to [Mdh] at the end-of-segment.
  *
  *  The format of the incoming pseudo TCP segment is as follows (@see AxisPsd4.hpp):
  *
@@ -443,11 +448,14 @@ void pInsertPseudoHeader(
  *******************************************************************************/
 void pCheckSumAccumulator(
         stream<AxisPsd4>          &siIph_PseudoPkt,
+        stream<FlagBit>           &siTle_CeMark,
         stream<AxisApp>           &soTid_Data,
         stream<ValBit>            &soTid_DataVal,
         stream<RXeMeta>           &soMdh_Meta,
         stream<SocketPair>        &soMdh_SockPair,
-        stream<TcpPort>           &soPRt_GetState)
+        stream<TcpPort>           &soPRt_GetState,
+        stream<ValBit>            &soMdh_Verdict,
+        stream<ValBit>            &soTid_LateVal)
 {
     //-- DIRECTIVES FOR THIS PROCESS -------------------------------------------
     #pragma HLS PIPELINE II=1 enable_flush
@@ -462,12 +470,8 @@ void pCheckSumAccumulator(
     #pragma HLS RESET  variable=csa_doCSumVerif
     static bool                 csa_residue=false;
     #pragma HLS RESET  variable=csa_residue
-    static ap_uint<3>           csa_cc_state=0;
-    #pragma HLS RESET  variable=csa_cc_state
-    static ap_uint<17>          csa_tcp_sums[4]={0, 0, 0, 0};
-    #pragma HLS RESET  variable=csa_tcp_sums
-    #pragma HLS ARRAY_PARTITION \
-                       variable=csa_tcp_sums complete dim=1
+    static CsumAcc              csa_csumAcc=0;
+    #pragma HLS RESET  variable=csa_csumAcc
 
     //-- STATIC DATAFLOW VARIABLES ---------------------------------------------
     static TcpDataOff       csa_dataOffset;
@@ -478,6 +482,12 @@ void pCheckSumAccumulator(
     static TcpChecksum      csa_tcpCSum;
     static ap_uint<32>      csa_half_tdata;
     static ap_uint<4>       csa_half_tkeep;
+    static TcpOptKind       csa_optKind;  // Kind of the TCP option being parsed
+    static TcpOptLen        csa_optLen;   // Length of the TCP option being parsed
+    static TcpOptLen        csa_optIdx;   // Index of the next byte within that option
+    static bool             csa_optEol;   // End of the option list was reached
+    static TcpOptMss        csa_optMss;
+    static TcpSeqNum        csa_sackEdge; // Edge of the SACK block being parsed
 
     //-- DYNAMIC VARIABLES -----------------------------------------------------
     AxisPsd4                currChunk(0,0,0);
@@ -498,6 +508,8 @@ void pCheckSumAccumulator(
         case CHUNK_1:
             // Get Segment length
             csa_meta.length = currChunk.getPsd4Len();
+            // Get the ECN mark of the IP packet (always forwarded along with the length)
+            csa_meta.ce = siTle_CeMark.read();
             // Get TCP-SP & TCP-DP
             csa_socketPair.src.port = currChunk.getTcpSrcPort();
             csa_socketPair.dst.port = currChunk.getTcpDstPort();
@@ -516,13 +528,24 @@ void pCheckSumAccumulator(
             // Get Data Offset
             csa_dataOffset   = currChunk.getTcpDataOff();
             csa_meta.length -= (csa_dataOffset * 4);
+            // Reset the TCP option parser
+            csa_optIdx  = 0;
+            csa_optEol  = false;
+            csa_meta.wsOpt    = 0;
+            csa_meta.winScale = 0;
+            csa_meta.sackOk   = 0;
+            csa_meta.sackBlk  = 0;
+            csa_meta.mss      = 0;
+            csa_meta.phase    = RX_PHASE_FULL;
             // Get Control Bits
             //  [ 8] == FIN | [ 9] == SYN | [10] == RST
             //  [11] == PSH | [12] == ACK | [13] == URG
+            //  [14] == ECE | [15] == CWR
             csa_meta.ack = currChunk.getTcpCtrlAck();
             csa_meta.rst = currChunk.getTcpCtrlRst();
             csa_meta.syn = currChunk.getTcpCtrlSyn();
             csa_meta.fin = currChunk.getTcpCtrlFin();
+            csa_meta.ece = currChunk.getTcpCtrlEce();
             // Get Window Size
             csa_meta.winSize = currChunk.getTcpWindow();
             // Get the checksum of the pseudo-header (only for debug purposes)
@@ -533,21 +556,83 @@ void pCheckSumAccumulator(
         default:
             if (csa_dataOffset >= 6) {
                 // Handle TCP options.
-                //  Warning: At this point, we only support one TCP option and
-                //   we further assume that this option is always 32-bit aligned.
-                //  [TODO] Must add support for Window Scaling and unaligned options.
-                TcpOptKind optionKind = currChunk.getTcpOptKind();
-                if (optionKind == TCP_OPT_KIND_MSS) {
-                    // Extract the MSS value
-                    TcpOptMss theirMSS = currChunk.getTcpOptMss();
-                    if (DEBUG_LEVEL & TRACE_CSA) {
-                        printInfo(myName, "TCP segment includes 4 option bytes (OptKind=2, OptLen=4, MSS=%d)\n",
-                                  theirMSS.to_uint());
+                //  The option bytes are parsed one by one as a list of [Kind|Len|Data]
+                //   triplets which may span several chunks and are not necessarily
+                //   aligned. Only the MSS, Window Scale and SACK options are recognized.
+                //  Of all the SACK blocks, only the lowest left edge above the ACK number
+                //   is kept (.i.e, the end of the first hole at the receiver).
+                //  If DataOffset==6, the upper 4 bytes of this chunk are already data.
+                for (int i=0; i<8; i++) {
+                    #pragma HLS UNROLL
+                    ap_uint<8> optByte = currChunk.getLE_TData(8*i+7, 8*i);
+                    if ((i < 4 or csa_dataOffset != 6) and !csa_optEol) {
+                        if (csa_optIdx == 0) {
+                            // Option-Kind
+                            if (optByte == TCP_OPT_KIND_EOL) {
+                                csa_optEol = true;
+                            }
+                            else if (optByte != TCP_OPT_KIND_NOP) {
+                                csa_optKind = optByte;
+                                csa_optIdx  = 1;
+                            }
+                        }
+                        else if (csa_optIdx == 1) {
+                            // Option-Length
+                            csa_optLen = optByte;
+                            csa_optIdx = 2;
+                            if (optByte < 2) {
+                                // Malformed option. Stop parsing.
+                                csa_optEol = true;
+                            }
+                            else if (optByte == 2) {
+                                csa_optIdx = 0;
+                            }
+                            if (csa_optKind == TCP_OPT_KIND_SACK) {
+                                csa_meta.sackOk = 1;
+                            }
+                            else if (csa_optKind != TCP_OPT_KIND_MSS  and csa_optKind != TCP_OPT_KIND_WSS and
+                                     csa_optKind != TCP_OPT_KIND_SBLK) {
+                                printWarn(myName, "The TCP option %d is not yet supported and will be dropped.\n", csa_optKind.to_uchar());
+                            }
+                        }
+                        else {
+                            // Option-Data
+                            if (csa_optKind == TCP_OPT_KIND_WSS) {
+                                // [RFC-7323] A shift count greater than 14 must be treated as 14
+                                csa_meta.wsOpt    = 1;
+                                csa_meta.winScale = (optByte > 14) ? (TcpOptWss)14 : (TcpOptWss)optByte;
+                            }
+                            else if (csa_optKind == TCP_OPT_KIND_SBLK) {
+                                // Each block is made of a 4-byte left edge and a 4-byte right edge
+                                TcpOptLen blkIdx  = csa_optIdx - 2;
+                                TcpSeqNum sackEdge = (csa_sackEdge(23, 0), optByte);
+                                csa_sackEdge = sackEdge;
+                                if (blkIdx(2, 0) == 3) {
+                                    ap_uint<32> edgeOff = sackEdge - csa_meta.ackNumb;
+                                    if ((edgeOff != 0) and (edgeOff[31] == 0) and
+                                        (!csa_meta.sackBlk or (edgeOff < (ap_uint<32>)(csa_meta.sackLeft - csa_meta.ackNumb)))) {
+                                        csa_meta.sackBlk  = 1;
+                                        csa_meta.sackLeft = sackEdge;
+                                    }
+                                }
+                            }
+                            else if (csa_optKind == TCP_OPT_KIND_MSS) {
+                                csa_optMss = (csa_optMss(7, 0), optByte);
+                                if (csa_optIdx == 3) {
+                                    csa_meta.mss = csa_optMss;
+                                    if (DEBUG_LEVEL & TRACE_CSA) {
+                                        printInfo(myName, "TCP segment includes the option (OptKind=2, OptLen=4, MSS=%d)\n",
+                                                  csa_optMss.to_uint());
+                                    }
+                                }
+                            }
+                            csa_optIdx++;
+                            if (csa_optIdx == csa_optLen) {
+                                csa_optIdx = 0;
+                            }
+                        }
                     }
                 }
-                else {
-                    printWarn(myName, "The TCP option %d is not yet supported and will be dropped.\n", optionKind.to_uchar());
-                }
                 if (csa_dataOffset == 6) {
                     csa_dataOffset -= 1;
                      csa_doShift = true;
@@ -560,6 +645,17 @@ void pCheckSumAccumulator(
             }
             else {
                 // The DataOffset == 5 (or less)
+                if (TOE_RX_CUT_THROUGH_CFG and (csa_meta.phase == RX_PHASE_FULL) and
+                    (csa_meta.length != 0) and csa_meta.ack and
+                    !csa_meta.syn and !csa_meta.rst and !csa_meta.fin) {
+                    // Cut-through: the header is parsed --> Forward the metadata
+                    //  and let the payload go before the checksum is known
+                    csa_meta.phase = RX_PHASE_SPEC;
+                    soMdh_Meta.write(csa_meta);
+                    soMdh_SockPair.write(csa_socketPair);
+                    soPRt_GetState.write(csa_tcpDstPort);
+                    soTid_DataVal.write(OK);
+                }
                 if (!csa_doShift) {
                     sendChunk = currChunk;
                     soTid_Data.write(sendChunk);
@@ -580,22 +676,7 @@ void pCheckSumAccumulator(
         } // End of: switch
 
         // Accumulate TCP checksum
-        for (int i = 0; i < 4; i++) {
-            #pragma HLS UNROLL
-            TcpCsum temp;
-            if (currChunk.getLE_TKeep(i*2+1, i*2) == 0x3) {
-                temp( 7, 0) = currChunk.getLE_TData(i*16+15, i*16+8);
-                temp(15, 8) = currChunk.getLE_TData(i*16+ 7, i*16);
-                csa_tcp_sums[i] += temp;
-                csa_tcp_sums[i] = (csa_tcp_sums[i] + (csa_tcp_sums[i] >> 16)) & 0xFFFF;
-            }
-            else if (currChunk.getLE_TKeep()[i*2] == 0x1) {
-                temp( 7, 0) = 0;
-                temp(15, 8) = currChunk.getLE_TData(i*16+7, i*16);
-                csa_tcp_sums[i] += temp;
-                csa_tcp_sums[i] = (csa_tcp_sums[i] + (csa_tcp_sums[i] >> 16)) & 0xFFFF;
-            }
-        }
+        csa_csumAcc += csumChunk(currChunk);
 
         // Handle last chunk
         if(currChunk.getTLast()) {
@@ -617,65 +698,47 @@ void pCheckSumAccumulator(
         csa_residue = false;
     }
     else if (csa_doCSumVerif) {
-        switch (csa_cc_state) {
-            case 0:
-                csa_tcp_sums[0] = (csa_tcp_sums[0] + (csa_tcp_sums[0] >> 16)) & 0xFFFF;
-                csa_tcp_sums[1] = (csa_tcp_sums[1] + (csa_tcp_sums[1] >> 16)) & 0xFFFF;
-                csa_tcp_sums[2] = (csa_tcp_sums[2] + (csa_tcp_sums[2] >> 16)) & 0xFFFF;
-                csa_tcp_sums[3] = (csa_tcp_sums[3] + (csa_tcp_sums[3] >> 16)) & 0xFFFF;
-                csa_cc_state++;
-                break;
-            case 1:
-                csa_tcp_sums[0] += csa_tcp_sums[2];
-                csa_tcp_sums[1] += csa_tcp_sums[3];
-                csa_tcp_sums[0] = (csa_tcp_sums[0] + (csa_tcp_sums[0] >> 16)) & 0xFFFF;
-                csa_tcp_sums[1] = (csa_tcp_sums[1] + (csa_tcp_sums[1] >> 16)) & 0xFFFF;
-                csa_cc_state++;
-                break;
-            case 2:
-                csa_tcp_sums[0] += csa_tcp_sums[1];
-                csa_tcp_sums[0] = (csa_tcp_sums[0] + (csa_tcp_sums[0] >> 16)) & 0xFFFF;
-                csa_cc_state++;
-                break;
-            case 3:
-                csa_tcp_sums[0] = ~csa_tcp_sums[0];
-                csa_cc_state++;
-                break;
-            case 4:
-                if (csa_tcp_sums[0](15, 0) == 0) {
-                    // The checksum is correct. TCP segment is valid.
-                    // Forward to metadata to MetaDataHandler
-                    soMdh_Meta.write(csa_meta);
-                    soMdh_SockPair.write(csa_socketPair);
-                    if (csa_meta.length != 0) {
-                        // Forward valid checksum info to TcpInvalidDropper
-                        soTid_DataVal.write(OK);
-                        if (DEBUG_LEVEL & TRACE_CSA) {
-                            printInfo(myName, "Received end-of-packet. Checksum is correct.\n");
-                        }
-                    }
-                    // Request state of TCP_DP
-                    soPRt_GetState.write(csa_tcpDstPort);
-                }
-                else {
-                    printWarn(myName, "RECEIVED BAD CHECKSUM (0x%4.4X - Delta= 0x%4.4X).\n",
-                                csa_tcpCSum.to_uint(), (~csa_tcp_sums[0](15, 0).to_uint() & 0xFFFF));
-                    if(csa_meta.length != 0) {
-                        // Packet has some TCP payload
-                        soTid_DataVal.write(KO);
-                    }
-                    if (DEBUG_LEVEL & TRACE_CSA) {
-                        printSockPair(myName, csa_socketPair);
-                    }
+        if (csa_meta.phase == RX_PHASE_SPEC) {
+            // The metadata and the payload were already forwarded. Only the verdict is left.
+            if (csumFold(csa_csumAcc) == 0xFFFF) {
+                soMdh_Verdict.write(OK);
+                soTid_LateVal.write(OK);
+            }
+            else {
+                printWarn(myName, "RECEIVED BAD CHECKSUM (0x%4.4X - Delta= 0x%4.4X) for a cut-through segment.\n",
+                            csa_tcpCSum.to_uint(), (~csumFold(csa_csumAcc)).to_uint() & 0xFFFF);
+                soMdh_Verdict.write(KO);
+                soTid_LateVal.write(KO);
+            }
+        }
+        else if (csumFold(csa_csumAcc) == 0xFFFF) {
+            // The checksum is correct. TCP segment is valid.
+            // Forward to metadata to MetaDataHandler
+            soMdh_Meta.write(csa_meta);
+            soMdh_SockPair.write(csa_socketPair);
+            if (csa_meta.length != 0) {
+                // Forward valid checksum info to TcpInvalidDropper
+                soTid_DataVal.write(OK);
+                if (DEBUG_LEVEL & TRACE_CSA) {
+                    printInfo(myName, "Received end-of-packet. Checksum is correct.\n");
                 }
-                csa_doCSumVerif = false;
-                csa_tcp_sums[0] = 0;
-                csa_tcp_sums[1] = 0;
-                csa_tcp_sums[2] = 0;
-                csa_tcp_sums[3] = 0;
-                csa_cc_state = 0;
-                break;
-        } // End of: switch
+            }
+            // Request state of TCP_DP
+            soPRt_GetState.write(csa_tcpDstPort);
+        }
+        else {
+            printWarn(myName, "RECEIVED BAD CHECKSUM (0x%4.4X - Delta= 0x%4.4X).\n",
+                        csa_tcpCSum.to_uint(), (~csumFold(csa_csumAcc)).to_uint() & 0xFFFF);
+            if(csa_meta.length != 0) {
+                // Packet has some TCP payload
+                soTid_DataVal.write(KO);
+            }
+            if (DEBUG_LEVEL & TRACE_CSA) {
+                printSockPair(myName, csa_socketPair);
+            }
+        }
+        csa_doCSumVerif = false;
+        csa_csumAcc = 0;
     }
 } // End of: pCheckSumAccumulator
 
@@ -684,17 +747,21 @@ void pCheckSumAccumulator(
  *
  * @param[in]  siCsa_Data    TCP data stream from CheckSumAccumulator (Csa).
  * @param[in]  siCsa_DataVal TCP data segment valid.
+ * @param[in]  siCsa_LateVal Late checksum verdict of a cut-through segment from [Csa].
  * @param[out] soTsd_Data    TCP data stream to TcpSegmentDropper (Tsd).
  * @param[out] soMMIO_CrcDropCnt The value of the CRC drop counter.
  *
  * @details
  *  This process drops the incoming TCP segment when it is flagged with an
  *   invalid checksum. Otherwise, the TCP segment is passed on.
+ *  A cut-through segment is always passed on. If its checksum turns out to be
+ *   invalid, it is only accounted for by the CRC drop counter.
  *
  *******************************************************************************/
 void pTcpInvalidDropper(
         stream<AxisApp>     &siCsa_Data,
         stream<ValBit>      &siCsa_DataVal,
+        stream<ValBit>      &siCsa_LateVal,
         stream<AxisApp>     &soTsd_Data,
         stream<ap_uint<8> > &soMMIO_CrcDropCnt)
 {
@@ -750,6 +817,12 @@ void pTcpInvalidDropper(
         break;
     } // End of: switch
 
+    if (!siCsa_LateVal.empty()) {
+        if (siCsa_LateVal.read() == KO) {
+            tid_crcDropCounter++;
+        }
+    }
+
     //-- ALWAYS
     if (!soMMIO_CrcDropCnt.full()) {
         soMMIO_CrcDropCnt.write(tid_crcDropCounter);
@@ -854,7 +927,10 @@ void pTcpSegmentDropper(
  *   space because the memory pointer needs to wrap around. In such a case, the
  *   incoming segment is broken down and written into physical DRAM as two
  *   memory buffers, and the follow-on RxAppNotifier (Ran) process is notified
- *   about this splitted segment
+ *   about this splitted segment.
+ *  When the Rx buffers are followed by a spill region (TOE_SPILL_CFG), such a
+ *   segment is written with a single memory access which continues into the
+ *   spill region, and the [RSt] is told about the spilled bytes by [Fsm].
  *******************************************************************************/
 void pRxMemoryWriter(
         stream<AxisApp>     &siTsd_Data,
@@ -892,8 +968,9 @@ void pRxMemoryWriter(
     case MWR_IDLE:
         if (!siFsm_MemWrCmd.empty() and !soRan_SplitSeg.full() and !soMEM_WrCmd.full()) {
             siFsm_MemWrCmd.read(mwr_memWrCmd);
-            if ((mwr_memWrCmd.saddr.range(TOE_WINDOW_BITS-1, 0) + mwr_memWrCmd.btt) > TOE_RX_BUFFER_SIZE) {
+            if (!TOE_SPILL_CFG and ((mwr_memWrCmd.saddr.range(TOE_PAGE_BITS-1, 0) + mwr_memWrCmd.btt) > TOE_PAGE_SIZE)) {
                 //-- Break this segment in two memory accesses because TCP Rx memory buffer wraps around
+                //--  (or because it crosses a buffer page when the buffer pool is enabled)
                 soRan_SplitSeg.write(true);
 
                 if (DEBUG_LEVEL & TRACE_MWR) {
@@ -917,7 +994,7 @@ void pRxMemoryWriter(
         break;
     case MWR_SPLIT_1ST_CMD:
         if (!soMEM_WrCmd.full()) {
-            mwr_firstAccLen   = TOE_RX_BUFFER_SIZE - mwr_memWrCmd.saddr;
+            mwr_firstAccLen   = TOE_PAGE_SIZE - mwr_memWrCmd.saddr(TOE_PAGE_BITS-1, 0);
             mwr_nrBytesToWr   = mwr_firstAccLen;
             soMEM_WrCmd.write(DmCmd(mwr_memWrCmd.saddr, mwr_firstAccLen));
 
@@ -955,7 +1032,7 @@ void pRxMemoryWriter(
                     memChunk.setLE_TLast(TLAST);
 
                     //-- Prepare and issue 2nd command
-                    mwr_memWrCmd.saddr(TOE_WINDOW_BITS-1, 0) = 0;
+                    mwr_memWrCmd.saddr(TOE_WINDOW_BITS-1, 0) = mwr_memWrCmd.saddr(TOE_WINDOW_BITS-1, 0) + mwr_firstAccLen;
                     mwr_memWrCmd.btt -= mwr_firstAccLen;
                     soMEM_WrCmd.write(mwr_memWrCmd);
 
@@ -975,7 +1052,7 @@ void pRxMemoryWriter(
                     #endif
 
                     //-- Prepare and issue 2nd command
-                    mwr_memWrCmd.saddr(TOE_WINDOW_BITS-1, 0) = 0;
+                    mwr_memWrCmd.saddr(TOE_WINDOW_BITS-1, 0) = mwr_memWrCmd.saddr(TOE_WINDOW_BITS-1, 0) + mwr_firstAccLen;
                     mwr_memWrCmd.btt -= mwr_firstAccLen;
                     soMEM_WrCmd.write(mwr_memWrCmd);
 
@@ -1069,6 +1146,11 @@ void pRxMemoryWriter(
  *  If the segment was split in two memory accesses, the current process will
  *   wait until both segments are written into memory before issuing the
  *   notification to the application.
+ *  A notification of zero bytes which is not CLOSED stands for a segment that
+ *   was written into memory but must not be notified to the application (e.g.
+ *   an out-of-order segment). It still consumes the status of its memory
+ *   write(s), such that every other notification remains paired with the
+ *   write of its own segment.
  *  Any error reported by the AXI data mover (MEM) is forwarded to MIMO and
  *   remains set until [TOE] is reset.
  *******************************************************************************/
@@ -1106,7 +1188,9 @@ void pRxAppNotifier(
         if(!siMEM_WrSts.empty()) {
             siMEM_WrSts.read(ran_dmStatus2);
             if (ran_dmStatus1.okay and ran_dmStatus2.okay) {
-                soRAi_RxNotif.write(ran_appNotification);
+                if (ran_appNotification.tcpDatLen != 0) {
+                    soRAi_RxNotif.write(ran_appNotification);
+                }
                 if (DEBUG_LEVEL & TRACE_RAN) {
                     printInfo(myName, "Sending APP notification to [RAi]. This was a double access.\n");
                 }
@@ -1131,7 +1215,9 @@ void pRxAppNotifier(
                 // This segment consists of a single memory access
                 if (ran_dmStatus1.okay) {
                     // Output the notification now
-                    soRAi_RxNotif.write(ran_appNotification);
+                    if (ran_appNotification.tcpDatLen != 0) {
+                        soRAi_RxNotif.write(ran_appNotification);
+                    }
                     if (DEBUG_LEVEL & TRACE_RAN) {
                         printInfo(myName, "Sending APP notification to [RAi].\n");
                     }
@@ -1151,7 +1237,9 @@ void pRxAppNotifier(
         }
         else if (!siFsm_Notif.empty() and !ssRxNotifFifo.full()) {
             siFsm_Notif.read(ran_appNotification);
-            if (ran_appNotification.tcpDatLen != 0) {
+            if ((ran_appNotification.tcpDatLen != 0) or
+                (ran_appNotification.tcpState  != CLOSED)) {
+                // This notification goes along with a memory write
                 ssRxNotifFifo.write(ran_appNotification);
             }
             else {
@@ -1170,6 +1258,127 @@ void pRxAppNotifier(
     }
 }
 
+/*******************************************************************************
+ * @brief Rx Notification Coalescer (Rnc)
+ *
+ * @param[in]  siRan_RxNotif  Rx data notification from RxAppNotifier (Ran).
+ * @param[out] soRAi_RxNotif  Rx data notification to RxAppInterface (RAi).
+ *
+ * @details
+ *  This process is only instantiated when TOE_RX_NOTIF_COALESCE_CFG is set.
+ *  The notifications forwarded by [Ran] cover consecutive in-order bytes of
+ *   the Rx buffer of their session. They are therefore merged into a single
+ *   notification per session, which lets the application retrieve them with a
+ *   single read request (and a single data mover command).
+ *  A merged notification is released as soon as it covers at least
+ *   TOE_RX_NOTIF_BYTES_CFG bytes, or when the deadline armed upon its first
+ *   segment expires (see RXNOTIF_TIMEOUT). The deadlines are handled the same
+ *   way as the ones of the delayed ACKs (@see ack_delay.cpp). An expired
+ *   deadline has priority over the incoming notifications.
+ *  If a new notification would overflow the length of the merged one, the
+ *   pending notification is released and the new one takes its place.
+ *******************************************************************************/
+void pRxNotifCoalescer(
+        stream<TcpAppNotif>   &siRan_RxNotif,
+        stream<TcpAppNotif>   &soRAi_RxNotif)
+{
+    //-- DIRECTIVES FOR THIS PROCESS -------------------------------------------
+    #pragma HLS PIPELINE II=1 enable_flush
+    #pragma HLS INLINE off
+
+    const char *myName = concat3(THIS_NAME, "/", "Rnc");
+
+    //-- STATIC ARRAYS ---------------------------------------------------------
+    static RxNotifEntry             NOTIF_TABLE[TOE_MAX_SESSIONS];
+  #if TOE_USE_URAM
+    #pragma HLS RESOURCE   variable=NOTIF_TABLE core=XPM_MEMORY uram
+  #else
+    #pragma HLS RESOURCE   variable=NOTIF_TABLE core=RAM_T2P_BRAM
+  #endif
+    #pragma HLS DATA_PACK  variable=NOTIF_TABLE
+    #pragma HLS DEPENDENCE variable=NOTIF_TABLE inter false
+
+    static RxNotifTimer             NOTIF_QUEUE[TOE_MAX_SESSIONS];
+  #if TOE_USE_URAM
+    #pragma HLS RESOURCE   variable=NOTIF_QUEUE core=XPM_MEMORY uram
+  #else
+    #pragma HLS RESOURCE   variable=NOTIF_QUEUE core=RAM_T2P_BRAM
+  #endif
+    #pragma HLS DATA_PACK  variable=NOTIF_QUEUE
+    #pragma HLS DEPENDENCE variable=NOTIF_QUEUE inter false
+
+    //-- STATIC CONTROL VARIABLES (with RESET) ---------------------------------
+    static RxNotifTime         rnc_now=0;
+    #pragma HLS RESET variable=rnc_now
+    static SessionId           rnc_qHead=0;
+    #pragma HLS RESET variable=rnc_qHead
+    static SessionId           rnc_qTail=0;
+    #pragma HLS RESET variable=rnc_qTail
+    static ap_uint<15>         rnc_qCnt=0;
+    #pragma HLS RESET variable=rnc_qCnt
+
+    //-- DYNAMIC VARIABLES -----------------------------------------------------
+    TcpAppNotif   notif;
+    RxNotifTimer  headTimer = NOTIF_QUEUE[rnc_qHead];
+    bool          headDue   = (rnc_qCnt != 0) and
+                              ((ap_int<21>)(rnc_now - headTimer.deadline) >= 0);
+
+    if (headDue and !soRAi_RxNotif.full()) {
+        //-- The oldest deadline expired
+        RxNotifEntry entry = NOTIF_TABLE[headTimer.sessId];
+        if (entry.notif.tcpDatLen != 0) {
+            soRAi_RxNotif.write(entry.notif);
+            if (DEBUG_LEVEL & TRACE_RNC) {
+                printInfo(myName, "S%d - Deadline expired - Sending a notification of %d bytes to [RAi].\n",
+                          headTimer.sessId.to_int(), entry.notif.tcpDatLen.to_int());
+            }
+        }
+        entry.notif.tcpDatLen = 0;
+        entry.queued = 0;
+        NOTIF_TABLE[headTimer.sessId] = entry;
+        rnc_qHead = (rnc_qHead == TOE_MAX_SESSIONS-1) ? (SessionId)0 : (SessionId)(rnc_qHead + 1);
+        rnc_qCnt--;
+    }
+    else if (!siRan_RxNotif.empty() and !soRAi_RxNotif.full()) {
+        siRan_RxNotif.read(notif);
+        // Read-modify-write the entire (packed) entry
+        RxNotifEntry entry  = NOTIF_TABLE[notif.sessionID];
+        ap_uint<17>  newLen = entry.notif.tcpDatLen + notif.tcpDatLen;
+        if (entry.notif.tcpDatLen == 0) {
+            entry.notif = notif;
+        }
+        else if (newLen > 0xFFFF) {
+            // Release the pending notification and keep the new one
+            soRAi_RxNotif.write(entry.notif);
+            entry.notif = notif;
+            newLen = 0;
+        }
+        else {
+            entry.notif.tcpDatLen = newLen;
+        }
+        if (newLen >= TOE_RX_NOTIF_BYTES_CFG) {
+            // Enough bytes were merged --> Release the notification right away
+            // (a queued deadline is left to expire on its own)
+            soRAi_RxNotif.write(entry.notif);
+            entry.notif.tcpDatLen = 0;
+        }
+        else if (!entry.queued) {
+            // First segment --> Arm a new deadline
+            NOTIF_QUEUE[rnc_qTail] = RxNotifTimer(notif.sessionID, rnc_now + RXNOTIF_TIMEOUT);
+            rnc_qTail = (rnc_qTail == TOE_MAX_SESSIONS-1) ? (SessionId)0 : (SessionId)(rnc_qTail + 1);
+            rnc_qCnt++;
+            entry.queued = 1;
+        }
+        if (DEBUG_LEVEL & TRACE_RNC) {
+            printInfo(myName, "S%d - Received a notification of %d bytes - %d bytes are pending.\n",
+                      notif.sessionID.to_int(), notif.tcpDatLen.to_int(), entry.notif.tcpDatLen.to_int());
+        }
+        NOTIF_TABLE[notif.sessionID] = entry;
+    }
+
+    rnc_now++;
+}
+
 /*******************************************************************************
  * @brief MetaData Handler (Mdh)
  *
@@ -1177,7 +1386,8 @@ void pRxAppNotifier(
  * @param[in]  siCsa_SockPair   TCP socket pair from [Csa].
  * @param[out] soSLc_SessLkpReq Session lookup request to Session Lookup Controller (SLc).
  * @param[in]  siSLc_SessLkpRep Session Lookup reply from [SLc].
- * @param[in]  siPRt_PortSts    Port state (opened/closed) from PortTable (PRt).
+ * @param[in]  siPRt_PortSts    Port state (opened/closed, short TIME-WAIT) from PortTable (PRt).
+ * @param[in]  siCsa_Verdict    Late checksum verdict of a cut-through segment from [Csa].
  * @param[out] soEVe_Event      Event to EventEngine (EVe).
  * @param[out] soTsd_DropCmd    Drop command to Tcp Segment Dropper (Tsd).
  * @param[out] soFsm_Meta       Metadata to RXe's Finite State Machine (Fsm).
@@ -1193,13 +1403,24 @@ void pRxAppNotifier(
  *   FiniteStateMachine (FSm) of the RxEngine (RXe).
  *  If the target destination port is not opened, the process creates an event
  *   requesting a 'RST+ACK' TCP segment to be sent back to the initiating host.
+ *  The metadata of a cut-through segment (RX_PHASE_SPEC) are handled the same
+ *   way, but the process then waits for the checksum verdict of that segment.
+ *   It forwards the metadata a second time as RX_PHASE_COMMIT or RX_PHASE_ABORT
+ *   and only requests a 'RST+ACK' if the checksum is valid.
+ *  With SYN cookies (TOE_SYN_COOKIE_CFG), a session lookup never creates a new
+ *   entry. A SYN which misses the lookup is answered with a stateless SYN-ACK
+ *   whose cookie is computed by [TXe]. An ACK which misses the lookup is checked
+ *   against the cookie it acknowledges and, if this cookie is valid and was
+ *   issued during the current or the previous time slot, a second lookup
+ *   creates the session and the ACK is forwarded to [Fsm] as a 'synCookie'.
  *******************************************************************************/
 void pMetaDataHandler(
         stream<RXeMeta>             &siCsa_Meta,
         stream<SocketPair>          &siCsa_SockPair,
         stream<SessionLookupQuery>  &soSLc_SessLkpReq,
         stream<SessionLookupReply>  &siSLc_SessLkpRep,
-        stream<StsBit>              &siPRt_PortSts,
+        stream<PortStsRep>          &siPRt_PortSts,
+        stream<ValBit>              &siCsa_Verdict,
         stream<ExtendedEvent>       &soEVe_Event,
         stream<CmdBit>              &soTsd_DropCmd,
         stream<RXeFsmMeta>          &soFsm_Meta,
@@ -1213,10 +1434,20 @@ void pMetaDataHandler(
 
     //-- STATIC CONTROL VARIABLES (with RESET) ---------------------------------
     static enum FsmStates { MDH_META=0, \
-                            MDH_LOOKUP } mdh_fsmState;
+                            MDH_LOOKUP, \
+                            MDH_VERDICT, \
+                            MDH_COOKIE } mdh_fsmState;
     #pragma HLS RESET           variable=mdh_fsmState
     static ap_uint<8 >                   mdh_SessDropCounter=0;
     #pragma HLS reset           variable=mdh_SessDropCounter
+  #if TOE_SYN_COOKIE_CFG
+    static ap_uint<32>                   mdh_cycCnt=0;
+    #pragma HLS reset           variable=mdh_cycCnt
+    static ap_uint<32>                   mdh_tickCnt=0;
+    #pragma HLS reset           variable=mdh_tickCnt
+    static SynCookieSlot                 mdh_cookieSlot=0;
+    #pragma HLS reset           variable=mdh_cookieSlot
+  #endif
 
     //-- STATIC DATAFLOW VARIABLES ---------------------------------------------
     static RXeMeta              mdh_meta;
@@ -1224,10 +1455,16 @@ void pMetaDataHandler(
     static Ip4Address           mdh_ip4SrcAddr;
     static TcpPort              mdh_tcpSrcPort;
     static TcpPort              mdh_tcpDstPort;
+    static PortStsRep           mdh_dstPortStatus;
+    static LE_SocketPair        mdh_switchedTuple;
+    static LE_SocketPair        mdh_leSocketPair;
 
     //-- DYNAMIC VARIABLES -----------------------------------------------------
     SocketPair                  socketPair;
-    StsBit                      dstPortStatus;
+    ValBit                      verdict;
+    TcpSeqNum                   cookie;
+    SynCookieSlot               cookieSlot;
+    bool                        isCookieAck = false;
 
     switch (mdh_fsmState) {
     case MDH_META:
@@ -1235,32 +1472,37 @@ void pMetaDataHandler(
         if (!siPRt_PortSts.empty()) {
             //  Read metadata and socket pair
             if (!siCsa_Meta.empty() && !siCsa_SockPair.empty()) {
-                siPRt_PortSts.read(dstPortStatus);
+                siPRt_PortSts.read(mdh_dstPortStatus);
                 siCsa_Meta.read(mdh_meta);
                 siCsa_SockPair.read(socketPair);
                 mdh_ip4SrcAddr = socketPair.src.addr;
                 mdh_tcpSrcPort = socketPair.src.port;
                 mdh_tcpDstPort = socketPair.dst.port;
-                if (dstPortStatus == STS_CLOSED) {
+                // Build the socket-pair of a stateless reply (i.e. 'RST+ACK' or SYN cookie)
+                mdh_switchedTuple.src.addr = byteSwap32(socketPair.dst.addr); // [FIXME]
+                mdh_switchedTuple.dst.addr = byteSwap32(socketPair.src.addr);
+                mdh_switchedTuple.src.port = byteSwap16(socketPair.dst.port);
+                mdh_switchedTuple.dst.port = byteSwap16(socketPair.src.port);
+                if (mdh_dstPortStatus.opened == STS_CLOSED) {
                     // The destination port is closed
                     if (DEBUG_LEVEL & TRACE_MDH) {
                         printWarn(myName, "Port 0x%4.4X (%d) is not open.\n",
                                   mdh_tcpDstPort.to_uint(), mdh_tcpDstPort.to_uint());
                     }
-                    if (!mdh_meta.rst) {
+                    if (mdh_meta.phase == RX_PHASE_SPEC) {
+                        // Cut-through segment. The reply must wait for the checksum verdict
+                        mdh_sessLookupReply.hit = false;
+                        mdh_fsmState = MDH_VERDICT;
+                    }
+                    else if (!mdh_meta.rst) {
                         // Reply with 'RST+ACK' and send necessary socket-pair through event
-                        LE_SocketPair  switchedTuple; // [FIXME]
-                        switchedTuple.src.addr = byteSwap32(socketPair.dst.addr);
-                        switchedTuple.dst.addr = byteSwap32(socketPair.src.addr);
-                        switchedTuple.src.port = byteSwap16(socketPair.dst.port);
-                        switchedTuple.dst.port = byteSwap16(socketPair.src.port);
                         if (mdh_meta.syn || mdh_meta.fin) {
                             soEVe_Event.write(ExtendedEvent(rstEvent(mdh_meta.seqNumb+mdh_meta.length+1),
-                                                           switchedTuple)); //always 0
+                                                           mdh_switchedTuple)); //always 0
                         }
                         else {
                             soEVe_Event.write(ExtendedEvent(rstEvent(mdh_meta.seqNumb+mdh_meta.length),
-                                                           switchedTuple));
+                                                           mdh_switchedTuple));
                         }
                     }
                     else {
@@ -1278,10 +1520,11 @@ void pMetaDataHandler(
                                   mdh_tcpDstPort.to_uint(), mdh_tcpDstPort.to_uint());
                     }
                     // Query a session lookup. Only allow creation of a new entry when SYN or SYN_ACK
-                    LE_SocketPair  leSocketPair(LE_SockAddr(byteSwap32(socketPair.src.addr),byteSwap16(socketPair.src.port)),
-                                                LE_SockAddr(byteSwap32(socketPair.dst.addr),byteSwap16(socketPair.dst.port)));
-                    soSLc_SessLkpReq.write(SessionLookupQuery(leSocketPair,
-                                          (mdh_meta.syn && !mdh_meta.rst && !mdh_meta.fin))); // [FIXME - Endianess
+                    //  (never with SYN cookies, where the entry is created upon the ACK of the cookie)
+                    mdh_leSocketPair = LE_SocketPair(LE_SockAddr(byteSwap32(socketPair.src.addr),byteSwap16(socketPair.src.port)),
+                                                     LE_SockAddr(byteSwap32(socketPair.dst.addr),byteSwap16(socketPair.dst.port)));
+                    soSLc_SessLkpReq.write(SessionLookupQuery(mdh_leSocketPair,
+                                          (!TOE_SYN_COOKIE_CFG && mdh_meta.syn && !mdh_meta.rst && !mdh_meta.fin))); // [FIXME - Endianess
                     if (DEBUG_LEVEL & TRACE_MDH) {
                         printInfo(myName, "Request the SLc to lookup the following session:\n");
                         printSockPair(myName, socketPair);
@@ -1300,15 +1543,93 @@ void pMetaDataHandler(
                 // Forward metadata to the TCP FiniteStateMachine (Fsm)
                 soFsm_Meta.write(RXeFsmMeta(mdh_sessLookupReply.sessionID,
                                             mdh_ip4SrcAddr,  mdh_tcpSrcPort,
-                                            mdh_tcpDstPort,  mdh_meta));
+                                            mdh_tcpDstPort,  mdh_meta,
+                                            false,           mdh_dstPortStatus));
                 if (DEBUG_LEVEL & TRACE_MDH)
                     printInfo(myName, "Successful session lookup. \n");
             }
+          #if TOE_SYN_COOKIE_CFG
+            else if (mdh_meta.syn and !mdh_meta.ack and !mdh_meta.rst and !mdh_meta.fin) {
+                // Reply with a stateless SYN-ACK. Its cookie is computed by [TXe]
+                soEVe_Event.write(ExtendedEvent(synCookieEvent(mdh_meta.seqNumb+1,
+                                                synCookieInfo(mdh_cookieSlot, mdh_meta.mss, mdh_meta.sackOk,
+                                                              mdh_meta.wsOpt, mdh_meta.winScale)),
+                                                mdh_switchedTuple));
+                if (DEBUG_LEVEL & TRACE_MDH)
+                    printInfo(myName, "No session for this SYN. Replying with a SYN cookie.\n");
+            }
+            else if (mdh_meta.ack and !mdh_meta.syn and !mdh_meta.rst and !mdh_meta.fin and
+                     (mdh_meta.phase != RX_PHASE_SPEC)) {
+                // Check if this ACK acknowledges one of our SYN cookies
+                cookie     = mdh_meta.ackNumb - 1;
+                cookieSlot = cookie(31, 29);
+                isCookieAck = ((cookieSlot == mdh_cookieSlot) or (cookieSlot == (SynCookieSlot)(mdh_cookieSlot-1))) and
+                              (cookie == synCookie(mdh_leSocketPair.src, mdh_leSocketPair.dst,
+                                                   mdh_meta.seqNumb-1, cookie(31, 22)));
+                if (isCookieAck) {
+                    // Create the session
+                    soSLc_SessLkpReq.write(SessionLookupQuery(mdh_leSocketPair, true));
+                    if (DEBUG_LEVEL & TRACE_MDH)
+                        printInfo(myName, "Received the ACK of a valid SYN cookie. Creating the session.\n");
+                }
+                else if (DEBUG_LEVEL & TRACE_MDH) {
+                    printWarn(myName, "Session lookup failed! \n");
+                }
+            }
+          #endif
             else {
                 // [TODO - Port is Open, but we have no sessionID for it]
                 if (DEBUG_LEVEL & TRACE_MDH)
                     printWarn(myName, "Session lookup failed! \n");
             }
+            if ((mdh_meta.length != 0) and !isCookieAck) {
+                soTsd_DropCmd.write(!mdh_sessLookupReply.hit);
+                if (!mdh_sessLookupReply.hit) {
+                    mdh_SessDropCounter++;
+                }
+            }
+            if (isCookieAck) {
+                mdh_fsmState = MDH_COOKIE;
+            }
+            else {
+                mdh_fsmState = (mdh_meta.phase == RX_PHASE_SPEC) ? MDH_VERDICT : MDH_META;
+            }
+        }
+        break;
+    case MDH_VERDICT:
+        // Wait until we get the checksum verdict of the cut-through segment
+        if (!siCsa_Verdict.empty()) {
+            siCsa_Verdict.read(verdict);
+            if (mdh_sessLookupReply.hit) {
+                // Tell [Fsm] to commit or to abort what it started upon the header of the segment
+                mdh_meta.phase = (verdict == OK) ? RX_PHASE_COMMIT : RX_PHASE_ABORT;
+                soFsm_Meta.write(RXeFsmMeta(mdh_sessLookupReply.sessionID,
+                                            mdh_ip4SrcAddr,  mdh_tcpSrcPort,
+                                            mdh_tcpDstPort,  mdh_meta,
+                                            false,           mdh_dstPortStatus));
+            }
+            else if ((mdh_dstPortStatus.opened == STS_CLOSED) and (verdict == OK)) {
+                // Reply with 'RST+ACK' (a cut-through segment has neither SYN, FIN nor RST)
+                soEVe_Event.write(ExtendedEvent(rstEvent(mdh_meta.seqNumb+mdh_meta.length),
+                                                mdh_switchedTuple));
+            }
+            mdh_fsmState = MDH_META;
+        }
+        break;
+    case MDH_COOKIE:
+        // Wait until the SessionLookupController (SLc) created the session of a SYN cookie
+        if (!siSLc_SessLkpRep.empty()) {
+            siSLc_SessLkpRep.read(mdh_sessLookupReply);
+            if (mdh_sessLookupReply.hit) {
+                // Tell [Fsm] to restore the session from the cookie
+                soFsm_Meta.write(RXeFsmMeta(mdh_sessLookupReply.sessionID,
+                                            mdh_ip4SrcAddr,  mdh_tcpSrcPort,
+                                            mdh_tcpDstPort,  mdh_meta,
+                                            true,            mdh_dstPortStatus));
+            }
+            else if (DEBUG_LEVEL & TRACE_MDH) {
+                printWarn(myName, "Cannot create the session of a SYN cookie (no session left).\n");
+            }
             if (mdh_meta.length != 0) {
                 soTsd_DropCmd.write(!mdh_sessLookupReply.hit);
                 if (!mdh_sessLookupReply.hit) {
@@ -1321,6 +1642,22 @@ void pMetaDataHandler(
     } // End of: switch
 
     //-- ALWAYS
+  #if TOE_SYN_COOKIE_CFG
+    //-- Advance the time slot of the SYN cookies
+    if (mdh_cycCnt == TOE_TIMER_TICK-1) {
+        mdh_cycCnt = 0;
+        if (mdh_tickCnt == TOE_SYN_COOKIE_SLOT-1) {
+            mdh_tickCnt = 0;
+            mdh_cookieSlot++;
+        }
+        else {
+            mdh_tickCnt++;
+        }
+    }
+    else {
+        mdh_cycCnt++;
+    }
+  #endif
     if (!soMMIO_SessDropCnt.full()) {
         soMMIO_SessDropCnt.write(mdh_SessDropCounter);
     }
@@ -1329,6 +1666,113 @@ void pMetaDataHandler(
     }
 } // End of: pMetaDataHandler
 
+/*******************************************************************************
+ * @brief Round-Trip Time Estimator - Computes a new retransmission timeout
+ *         according to RFC-6298.
+ *
+ * @param[in]     rtt     The new round-trip time measurement (in timer ticks).
+ * @param[in,out] srtt    The smoothed round-trip time (scaled by 8).
+ * @param[in,out] rttvar  The round-trip time variation (scaled by 4).
+ *
+ * @return the new retransmission timeout (in timer ticks).
+ *
+ * @details
+ *  The scaled integer arithmetic of Jacobson and Karels is used with alpha=1/8,
+ *   beta=1/4 and K=4. A null 'srtt' means that no measurement was made yet.
+ *   The clock granularity (G) is one timer tick.
+ *******************************************************************************/
+RttTime rttEstimator(RttTime rtt, RttTime &srtt, RttTime &rttvar)
+{
+    #pragma HLS INLINE
+
+    if (rtt == 0) {
+        rtt = 1;  // Less than a tick
+    }
+    if (srtt == 0) {
+        //-- First measurement: SRTT <- R and RTTVAR <- R/2
+        srtt   = rtt << 3;
+        rttvar = rtt << 1;
+    }
+    else {
+        //-- SRTT <- 7/8*SRTT + 1/8*R and RTTVAR <- 3/4*RTTVAR + 1/4*|SRTT-R|
+        ap_int<26> err = (ap_int<26>)rtt - (ap_int<26>)(srtt >> 3);
+        srtt = (ap_int<26>)srtt + err;
+        if (err < 0) {
+            err = -err;
+        }
+        rttvar = (ap_int<26>)rttvar - (ap_int<26>)(rttvar >> 2) + err;
+    }
+    //-- RTO <- SRTT + max(G, K*RTTVAR)
+    ap_uint<26> rto = (srtt >> 3) + ((rttvar > 1) ? rttvar : (RttTime)1);
+    if (rto < TOE_RTO_MIN) {
+        rto = TOE_RTO_MIN;
+    }
+    else if (rto > TOE_RTO_MAX) {
+        rto = TOE_RTO_MAX;
+    }
+    return rto;
+}
+
+/*******************************************************************************
+ * @brief Checks if the payload of a cut-through segment can be written into the
+ *         Rx buffer before its checksum is known.
+ *
+ * @param[in] meta   The metadata of the segment.
+ * @param[in] rxSar  The RxSar entry of its session.
+ *
+ * @return true if the segment fits in the receive space without overlapping
+ *          any of the out-of-order blocks already stored.
+ *
+ * @details
+ *  Such a segment only overwrites bytes that were neither received nor made
+ *   visible to [APP] yet. If its checksum turns out to be invalid, these bytes
+ *   are simply written again by the retransmission of the segment.
+ *******************************************************************************/
+bool isCutThroughSafe(RXeMeta meta, RxSarReply rxSar)
+{
+    #pragma HLS INLINE
+
+    ap_uint<32> begOff   = meta.seqNumb - rxSar.rcvd;
+    ap_uint<32> endOff   = (meta.seqNumb + meta.length) - rxSar.rcvd;
+    RxBufPtr    rcvSpace = (rxSar.appd - (RxBufPtr)rxSar.rcvd(TOE_WINDOW_BITS-1, 0)) - 1;
+    bool        isSafe   = (begOff < endOff) and (endOff < rcvSpace) and
+                           ((begOff == 0) or (rxSar.oooCnt < TOE_MAX_OOO_BLOCKS));
+    for (int i=0; i<TOE_MAX_OOO_BLOCKS; i++) {
+        #pragma HLS UNROLL
+        if (i < rxSar.oooCnt) {
+            ap_uint<32> blkLeftOff  = rxSar.oooBlk[i].left  - rxSar.rcvd;
+            ap_uint<32> blkRightOff = rxSar.oooBlk[i].right - rxSar.rcvd;
+            if ((blkLeftOff < endOff) and (blkRightOff > begOff)) {
+                isSafe = false;
+            }
+        }
+    }
+    return isSafe;
+}
+
+/*******************************************************************************
+ * @brief Returns the type of the event which acknowledges a received segment.
+ *
+ * @param[in] ackPolicy  The ACK policy of the listening port of the session.
+ *
+ * @return ACK_NODELAY_EVENT, ACK_COALESCE_EVENT or ACK_EVENT.
+ *
+ * @details
+ *  The ACK policy of a session comes from the listen request of its port. A
+ *   session which falls back to TOE_ACK_DEFAULT uses TOE_ACK_POLICY_CFG. The
+ *   AckDelayer (AKd) forwards a quick ACK right away, delays a regular ACK for
+ *   at most 'TOE_ACK_EVERY_N_CFG' segments, and coalesces all the ACKs of a
+ *   session until its delay expires.
+ *******************************************************************************/
+EventType getAckEventType(TcpAckPolicy ackPolicy)
+{
+    #pragma HLS INLINE
+
+    TcpAckPolicy policy = (ackPolicy == TOE_ACK_DEFAULT) ? (TcpAckPolicy)TOE_ACK_POLICY_CFG : ackPolicy;
+    return (policy == TOE_ACK_QUICK)    ? ACK_NODELAY_EVENT :
+           (policy == TOE_ACK_COALESCE) ? ACK_COALESCE_EVENT : ACK_EVENT;
+}
+
 /*******************************************************************************
  * @brief Finite State machine (Fsm)
  *
@@ -1340,8 +1784,8 @@ void pMetaDataHandler(
  * @param[out] soTSt_TxSarQry    Query to TxSarTable (TSt).
  * @param[in]  siTSt_TxSarRep    Reply from [TSt].
  * @param[out] soTIm_ReTxTimerCmd Command for a retransmit timer to Timers (TIm).
- * @param[out] soTIm_ClearProbeTimer Clear the probing timer to [TIm].
- * @param[out] soTIm_CloseTimer  Close session timer to [TIm].
+ * @param[out] soTIm_ProbeTimerCmd Command for a keepalive timer to [TIm].
+ * @param[out] soTIm_CloseTimerCmd Close session timer command to [TIm].
  * @param[out] soTAi_SessOpnSts  Open status of the session to TxAppInterface (TAi).
  * @param[out] soEVe_Event       Event to EventEngine (EVe).
  * @param[out] soTsd_DropCmd     Drop command to TcpSegmentDropper (Tsd).
@@ -1354,6 +1798,34 @@ void pMetaDataHandler(
  *   contains all the logic that updates the metadata and keeps track of the
  *   events related to the reception of segments and their handshaking. This is
  *   the key central part of the Rx engine.
+ *  Upon an ACK which covers the segment being timed by [TSt], a round-trip time
+ *   measurement is taken and the retransmission timeout of the session is
+ *   updated before being loaded into the retransmit timer.
+ *  The third duplicate ACK triggers a fast retransmit of the first unacknowledged
+ *   segment and enters the NewReno fast recovery of RFC-6582. Every partial ACK
+ *   received during the recovery retransmits the next missing segment, while a
+ *   full ACK terminates the recovery and deflates the congestion window.
+ *   Whenever an ACK moves or inflates the window while some APP data is still
+ *   waiting in the Tx buffer, a TX event is issued to clock that data out.
+ *  Every segment received in a synchronized state re-loads the keepalive timer
+ *   of its session, and this timer is stopped once the session gets closed.
+ *  A cut-through segment is processed twice. Upon its header (RX_PHASE_SPEC),
+ *   only its payload is sent to memory, provided that it cannot overwrite any
+ *   received byte (otherwise it is held in [Tsd] until the verdict). Upon its
+ *   valid checksum (RX_PHASE_COMMIT), the segment goes through the regular ACK
+ *   processing without re-issuing the memory write. Upon an invalid checksum
+ *   (RX_PHASE_ABORT), neither 'rcvd' nor [APP] are updated.
+ *  The ACK of a SYN cookie comes with a session which was just created. Its
+ *   RxSar and TxSar entries are initialized from the information encoded in
+ *   the cookie, and the session goes straight to ESTABLISHED. An ACK which
+ *   carries data is then processed a second time as a regular segment.
+ *  A session enters TIME_WAIT with the default or the short duration of its
+ *   listening port. A SYN whose sequence number is higher than the last one
+ *   received re-opens such a session right away [RFC-6191], and its close
+ *   timer is stopped.
+ *  The segments of a session are acknowledged with the ACK policy of its
+ *   listening port (see getAckEventType()), and its keepalive timer is loaded
+ *   with the keepalive profile of that port.
  *****************************************************************************/
 void pFiniteStateMachine(
         stream<RXeFsmMeta>          &siMdh_FsmMeta,
@@ -1364,8 +1836,8 @@ void pFiniteStateMachine(
         stream<RXeTxSarQuery>       &soTSt_TxSarQry,
         stream<RXeTxSarReply>       &siTSt_TxSarRep,
         stream<RXeReTransTimerCmd>  &soTIm_ReTxTimerCmd,
-        stream<SessionId>           &soTIm_ClearProbeTimer,
-        stream<SessionId>           &soTIm_CloseTimer,
+        stream<RXeProbeTimerCmd>    &soTIm_ProbeTimerCmd,
+        stream<RXeCloseTimerCmd>    &soTIm_CloseTimerCmd,
         stream<SessState>           &soTAi_SessOpnSts, // [TODO -Merge with eventEngine]
         stream<Event>               &soEVe_Event,
         stream<CmdBit>              &soTsd_DropCmd,
@@ -1396,6 +1868,10 @@ void pFiniteStateMachine(
     #pragma HLS RESET   variable=fsm_rxByteCounter
     static ap_uint<8 >           fsm_oooDebugState=0;
     #pragma HLS RESET   variable=fsm_oooDebugState
+    static bool                  fsm_cutThru=false;  // The payload of the current segment is already written
+    #pragma HLS RESET   variable=fsm_cutThru
+    static bool                  fsm_replay=false;   // The payload of a SYN cookie ACK is still to be processed
+    #pragma HLS RESET   variable=fsm_replay
 
     //-- STATIC DATAFLOW VARIABLES ---------------------------------------------
     static RXeFsmMeta   fsm_Meta;
@@ -1410,19 +1886,41 @@ void pFiniteStateMachine(
 
     switch(fsm_fsmState) {
     case FSM_LOAD:
-        if (!siMdh_FsmMeta.empty()) {
-            siMdh_FsmMeta.read(fsm_Meta);
-            // Request the current state of this session
-            soSTt_StateQry.write(StateQuery(fsm_Meta.sessionId, QUERY_RD));
-            // Always request the RxSarTable, even though not required for SYN-ACK
-            soRSt_RxSarQry.write(RXeRxSarQuery(fsm_Meta.sessionId, QUERY_RD));
-            if (fsm_Meta.meta.ack) {
-                // Only request the txSar when (ACK+ANYTHING); not for SYN
-                soTSt_TxSarQry.write(RXeTxSarQuery(fsm_Meta.sessionId, QUERY_RD));
-                fsm_txSarRequest = true;
+        if ((TOE_SYN_COOKIE_CFG and fsm_replay) or !siMdh_FsmMeta.empty()) {
+            if (TOE_SYN_COOKIE_CFG and fsm_replay) {
+                // Process the ACK of a SYN cookie a second time, now that its session is established
+                fsm_Meta.synCookie = false;
+                fsm_replay = false;
+            }
+            else {
+                siMdh_FsmMeta.read(fsm_Meta);
+            }
+            if (fsm_Meta.meta.phase == RX_PHASE_ABORT) {
+                // The cut-through segment has an invalid checksum. Nothing gets committed.
+                if (fsm_cutThru) {
+                    // Its payload was written. Pair its memory write with an empty notification.
+                    soRan_RxNotif.write(TcpAppNotif(fsm_Meta.sessionId,  0,
+                                                    fsm_Meta.ip4SrcAddr, fsm_Meta.tcpSrcPort,
+                                                    fsm_Meta.tcpDstPort, ESTABLISHED));
+                }
+                else {
+                    soTsd_DropCmd.write(CMD_DROP);
+                }
+                fsm_cutThru = false;
+            }
+            else {
+                // Request the current state of this session
+                soSTt_StateQry.write(StateQuery(fsm_Meta.sessionId, QUERY_RD));
+                // Always request the RxSarTable, even though not required for SYN-ACK
+                soRSt_RxSarQry.write(RXeRxSarQuery(fsm_Meta.sessionId, QUERY_RD));
+                if (fsm_Meta.meta.ack and (fsm_Meta.meta.phase != RX_PHASE_SPEC)) {
+                    // Only request the txSar when (ACK+ANYTHING); not for SYN
+                    soTSt_TxSarQry.write(RXeTxSarQuery(fsm_Meta.sessionId, QUERY_RD));
+                    fsm_txSarRequest = true;
+                }
+                fsm_fsmState = FSM_TRANSITION;
+                fsm_oooDebugState = 1;
             }
-            fsm_fsmState = FSM_TRANSITION;
-            fsm_oooDebugState = 1;
         }
         break;
     case FSM_TRANSITION:
@@ -1441,7 +1939,50 @@ void pFiniteStateMachine(
             //--------------------------------------
             //-- ACK
             //--------------------------------------
-            if (fsm_fsmState == FSM_LOAD) {
+            if ((fsm_Meta.meta.phase == RX_PHASE_SPEC) and (fsm_fsmState == FSM_LOAD)) {
+                // Cut-through segment. Only write its payload for now, if it is safe to do so.
+                siSTt_StateRep.read(tcpState);
+                siRSt_RxSarRep.read(rxSar);
+                fsm_cutThru = ( (tcpState == ESTABLISHED) || (tcpState == SYN_RECEIVED) ||
+                                (tcpState == FIN_WAIT_1)  || (tcpState == CLOSING)      ||
+                                (tcpState == LAST_ACK) ) and isCutThroughSafe(fsm_Meta.meta, rxSar);
+                if (fsm_cutThru) {
+                    RxMemPtr memSegAddr = TOE_RX_MEMORY_BASE;
+                    memSegAddr(TOE_RX_MEMORY_BITS-1, TOE_SLICE_BITS) = fsm_Meta.sessionId(TOE_RX_MEMORY_BITS-TOE_SLICE_BITS-1, 0);
+                    memSegAddr(TOE_WINDOW_BITS-1, 0) = fsm_Meta.meta.seqNumb.range(TOE_WINDOW_BITS-1, 0);
+                    soMwr_WrCmd.write(DmCmd(memSegAddr, fsm_Meta.meta.length));
+                    soTsd_DropCmd.write(CMD_KEEP);
+                }
+                // Release the session lock of the StateTable
+                soSTt_StateQry.write(StateQuery(fsm_Meta.sessionId, tcpState, QUERY_WR));
+            }
+            else if (fsm_Meta.synCookie and (fsm_fsmState == FSM_LOAD)) {
+                // The ACK of a SYN cookie. Restore the session from the information of the cookie
+                siSTt_StateRep.read(tcpState);
+                siRSt_RxSarRep.read(rxSar);
+                siTSt_TxSarRep.read(txSar);
+                TcpSeqNum     cookie    = fsm_Meta.meta.ackNumb - 1;
+                SynCookieInfo info      = cookie(31, 22);
+                bool          wsEnabled = (TOE_WINDOW_SCALE != 0) and (info(3, 0) != 0);
+                TcpSegLen     sndMss    = (synCookieMss(info) > MY_MSS) ? MY_MSS : synCookieMss(info);
+                // Initialize RxSar with the received SeqNum, the shift count of our window and SACK-permitted
+                soRSt_RxSarQry.write(RXeRxSarQuery(fsm_Meta.sessionId, fsm_Meta.meta.seqNumb,
+                                                   wsEnabled ? TOE_WINDOW_SCALE : 0,
+                                                   (FlagBool)info[4],
+                                                   QUERY_WR, QUERY_INIT));
+                // Initialize TxSar as if our SYN-ACK had been sent and acknowledged
+                soTSt_TxSarQry.write(RXeTxSarQuery(fsm_Meta.sessionId, fsm_Meta.meta.ackNumb,
+                                                   fsm_Meta.meta.winSize, ccInitWindow(sndMss),
+                                                   wsEnabled ? (TcpOptWss)(info(3, 0) - 1) : (TcpOptWss)0,
+                                                   sndMss, QUERY_INIT));
+                soSTt_StateQry.write(StateQuery(fsm_Meta.sessionId, ESTABLISHED, QUERY_WR));
+                if (DEBUG_LEVEL & TRACE_FSM) { printInfo(myName, "Session[%d] - TCP State = ESTABISHED (SYN cookie).\n", fsm_Meta.sessionId.to_uint()); }
+                // Start the keepalive timer of the session
+                soTIm_ProbeTimerCmd.write(RXeProbeTimerCmd(fsm_Meta.sessionId, LOAD_TIMER, fsm_Meta.portSts.kaProfile));
+                // Its payload goes through the regular ACK processing
+                fsm_replay = (fsm_Meta.meta.length != 0);
+            }
+            else if (fsm_fsmState == FSM_LOAD) {
                 siSTt_StateRep.read(tcpState);
                 siRSt_RxSarRep.read(rxSar);
                 siTSt_TxSarRep.read(txSar);
@@ -1455,14 +1996,29 @@ void pFiniteStateMachine(
                               \t\t Meta.seqNum  =0x%8.8x \n \
                               \t\t RxSar.appd   =0x%8.8x \n \
                               \t\t RxSar.oooHead=0x%8.8x \n \
-                              \t\t RxSar.oooTail=0x%8.8x \n \
+                              \t\t RxSar.oooCnt =  %8d \n \
                               \t\t FreeSpace    =  %8d\n",
                               fsm_Meta.meta.seqNumb.to_uint(),
+                              rxSar.appd.to_uint(),
                               rxSar.oooHead.to_uint(),
-                              rxSar.oooTail.to_uint(),
+                              rxSar.oooCnt.to_uint(),
                               fsm_freeSpace.to_uint());
                 }
 
+                //-- Take a round-trip time measurement if the timed segment got ACK'ed
+                bool rttSample = false;
+                if (txSar.rttPending and (fsm_Meta.meta.ackNumb != txSar.prevAckd) and
+                    ((ap_int<32>)(fsm_Meta.meta.ackNumb - txSar.rttSeq) >= 0)) {
+                    txSar.rto = rttEstimator(txSar.rttElapsed, txSar.srtt, txSar.rttvar);
+                    rttSample = true;
+                    if (DEBUG_LEVEL & TRACE_FSM) {
+                        printInfo(myName, "Session #%d - RTT=%d ticks -> SRTT=%d, RTTVAR=%d, RTO=%d ticks.\n",
+                                  fsm_Meta.sessionId.to_int(), txSar.rttElapsed.to_uint(),
+                                  (txSar.srtt >> 3).to_uint(), (txSar.rttvar >> 2).to_uint(),
+                                  txSar.rto.to_uint());
+                    }
+                }
+
                 TimerCmd timerCmd;
                 if (fsm_Meta.meta.ackNumb == txSar.prevUnak) {
                     timerCmd = STOP_TIMER;
@@ -1470,30 +2026,72 @@ void pFiniteStateMachine(
                 else {
                     timerCmd = LOAD_TIMER;
                 }
-                soTIm_ReTxTimerCmd.write(RXeReTransTimerCmd(fsm_Meta.sessionId, timerCmd));
+                soTIm_ReTxTimerCmd.write(RXeReTransTimerCmd(fsm_Meta.sessionId, timerCmd, txSar.rto));
                 if ( (tcpState == ESTABLISHED) || (tcpState == SYN_RECEIVED) ||
                      (tcpState == FIN_WAIT_1)  || (tcpState == CLOSING)      ||
                      (tcpState == LAST_ACK) ) {
                     // Check if new ACK arrived
+                    bool fastRetransmit = false;
+                    bool windowOpened   = false;
                     if ( (fsm_Meta.meta.ackNumb == txSar.prevAckd) and
                          (txSar.prevAckd != txSar.prevUnak) ) {
                         // Not new ACK; increase counter but only if it does not contain data
                         if (fsm_Meta.meta.length == 0) {
-                            txSar.count++;
+                            if (txSar.fastRetransmitted) {
+                                //-- FAST RECOVERY: Another segment left the network --> Inflate
+                                if (txSar.cong_window <= (TOE_MAX_CONGESTION_WINDOW-txSar.mss)) {
+                                    txSar.cong_window += txSar.mss;
+                                }
+                                windowOpened = true;
+                            }
+                            else {
+                                txSar.count++;
+                                if (txSar.count == TOE_DUP_ACK_THRESHOLD) {
+                                    //-- FAST RETRANSMIT: Reduce the window as specified by the congestion control
+                                    LocalWinSize flightSize = (LocalWinSize)(txSar.prevUnak - txSar.prevAckd);
+                                    ccOnFastRetransmit(txSar.cong_window, txSar.slowstart_threshold,
+                                                       txSar.cc, flightSize, txSar.mss);
+                                    txSar.recover     = txSar.prevUnak;
+                                    txSar.fastRetransmitted = true;
+                                    fastRetransmit = true;
+                                    if (DEBUG_LEVEL & TRACE_FSM) {
+                                        printInfo(myName, "Session #%d - Fast retransmit of SeqNum=0x%8.8x (ssthresh=%d).\n",
+                                                  fsm_Meta.sessionId.to_int(), txSar.prevAckd.to_uint(),
+                                                  txSar.slowstart_threshold.to_uint());
+                                    }
+                                }
+                            }
                         }
                     }
                     else {
-                        // Notify probeTimer about new ACK
-                        soTIm_ClearProbeTimer.write(fsm_Meta.sessionId);
-                        // Check for SlowStart & Increase Congestion Window
-                        if (txSar.cong_window <= (txSar.slowstart_threshold-ZYC2_MSS)) {
-                            txSar.cong_window += ZYC2_MSS;
+                        windowOpened = true;
+                        if (txSar.fastRetransmitted) {
+                            if ((ap_int<32>)(fsm_Meta.meta.ackNumb - txSar.recover) >= 0) {
+                                //-- FULL ACK: Exit fast recovery and deflate the window [RFC-6582]
+                                txSar.cong_window = txSar.slowstart_threshold;
+                                txSar.fastRetransmitted = false;
+                            }
+                            else {
+                                //-- PARTIAL ACK: Retransmit the next hole and partially deflate the window
+                                LocalWinSize ackedSize = (LocalWinSize)(fsm_Meta.meta.ackNumb - txSar.prevAckd);
+                                if (txSar.cong_window > ackedSize) {
+                                    txSar.cong_window -= ackedSize;
+                                }
+                                else {
+                                    txSar.cong_window = 0;
+                                }
+                                txSar.cong_window += txSar.mss;
+                                fastRetransmit = true;
+                            }
                         }
-                        else if (txSar.cong_window <= TOE_MAX_CONGESTION_WINDOW) { // 0xF7FF
-                            txSar.cong_window += 365; //TODO replace by approx. of (MSS x MSS) / cong_window
+                        else {
+                            //-- Slow start or congestion avoidance
+                            ccOnAck(txSar.cong_window, txSar.slowstart_threshold, txSar.cc,
+                                    (LocalWinSize)(fsm_Meta.meta.ackNumb - txSar.prevAckd),
+                                    fsm_Meta.meta.ackNumb, txSar.prevUnak,
+                                    fsm_Meta.meta.ece, txSar.nowTick, txSar.mss);
                         }
                         txSar.count = 0;
-                        txSar.fastRetransmitted = false;
                     }
                     // Update TxSarTable (only if count or retransmit)
                     if ( (  (fsm_Meta.meta.ackNumb >= txSar.prevAckd) and (fsm_Meta.meta.ackNumb <= txSar.prevUnak)) or
@@ -1503,156 +2101,181 @@ void pFiniteStateMachine(
                                                             fsm_Meta.meta.winSize,
                                                             txSar.cong_window,
                                                             txSar.count,
-                                                          ((txSar.count == 3) || txSar.fastRetransmitted))));
+                                                            txSar.fastRetransmitted,
+                                                            txSar.slowstart_threshold,
+                                                            txSar.recover,
+                                                            txSar.cc,
+                                                            rttSample,
+                                                            txSar.srtt,
+                                                            txSar.rttvar,
+                                                            txSar.rto,
+                                                            fsm_Meta.meta.sackBlk,
+                                                            fsm_Meta.meta.sackLeft)));
                     }
 
                     // If packet contains payload
                     //  We must handle Out-Of-Order delivered segments
+                    bool isDelayedAck = false;
                     if (fsm_Meta.meta.length != 0) {
 
                         // Build a DDR memory address for this segment
-                        //  FYI - The TCP Rx buffers use up to 1GB (16Kx64KB).
+                        //  FYI - The TCP Rx buffers use up to 1GB (e.g. 16Kx64KB).
                         RxMemPtr memSegAddr = TOE_RX_MEMORY_BASE;
-                        memSegAddr(29, TOE_WINDOW_BITS) = fsm_Meta.sessionId(13, 0);
+                        memSegAddr(TOE_RX_MEMORY_BITS-1, TOE_SLICE_BITS) = fsm_Meta.sessionId(TOE_RX_MEMORY_BITS-TOE_SLICE_BITS-1, 0);
                         memSegAddr(TOE_WINDOW_BITS-1, 0) = fsm_Meta.meta.seqNumb.range(TOE_WINDOW_BITS-1, 0);
+                        // Bytes written past the end of the Rx buffer (if it has a spill region)
+                        RxBufPtr segSpill = getSpill(fsm_Meta.meta.seqNumb(TOE_WINDOW_BITS-1, 0), fsm_Meta.meta.length);
 
                         // Increment the Rx byte counter
                         fsm_rxByteCounter += fsm_Meta.meta.length;
 
-                        RxSeqNum    newRcvd    = 0;
-                        RxSeqNum    newOooHead = 0;
-                        RxSeqNum    newOooTail = 0;
+                        //-- Locate the segment with respect to the 'rcvd' pointer
+                        //--  FYI - All offsets are relative to 'rcvd' to handle the wrap around.
+                        RxSeqNum    segEnd   = fsm_Meta.meta.seqNumb + fsm_Meta.meta.length;
+                        ap_uint<32> begOff   = fsm_Meta.meta.seqNumb - rxSar.rcvd;
+                        ap_uint<32> endOff   = segEnd - rxSar.rcvd;
+                        RxBufPtr    rcvSpace = (rxSar.appd - (RxBufPtr)rxSar.rcvd(TOE_WINDOW_BITS-1, 0)) - 1;
+                        bool        isInSpace = (begOff < endOff) and (endOff < rcvSpace);
+
+                        //-- Merge the segment with the out-of-order blocks it overlaps or
+                        //--  touches, and keep the other blocks in their current order.
+                        RxSeqNum    mrgLeft     = fsm_Meta.meta.seqNumb;
+                        RxSeqNum    mrgRight    = segEnd;
+                        ap_uint<32> mrgLeftOff  = begOff;
+                        ap_uint<32> mrgRightOff = endOff;
+                        ap_uint<32> headOff     = endOff;
+                        bool        isMerged    = false;
+                        bool        isDuplicate = false;
+                        OooBlock    keptBlk[TOE_MAX_OOO_BLOCKS];
+                        OooCnt      keptCnt = 0;
+                        for (int i=0; i<TOE_MAX_OOO_BLOCKS; i++) {
+                            #pragma HLS UNROLL
+                            if (i < rxSar.oooCnt) {
+                                ap_uint<32> blkLeftOff  = rxSar.oooBlk[i].left  - rxSar.rcvd;
+                                ap_uint<32> blkRightOff = rxSar.oooBlk[i].right - rxSar.rcvd;
+                                if ((blkLeftOff <= endOff) and (blkRightOff >= begOff)) {
+                                    isMerged = true;
+                                    if ((blkLeftOff <= begOff) and (blkRightOff >= endOff)) {
+                                        isDuplicate = true;
+                                    }
+                                    if (blkLeftOff < mrgLeftOff) {
+                                        mrgLeftOff  = blkLeftOff;
+                                        mrgLeft     = rxSar.oooBlk[i].left;
+                                    }
+                                    if (blkRightOff > mrgRightOff) {
+                                        mrgRightOff = blkRightOff;
+                                        mrgRight    = rxSar.oooBlk[i].right;
+                                    }
+                                }
+                                else {
+                                    keptBlk[keptCnt] = rxSar.oooBlk[i];
+                                    keptCnt++;
+                                }
+                                if (blkRightOff > headOff) {
+                                    headOff = blkRightOff;
+                                }
+                            }
+                        }
+                        RxSeqNum    newOooHead = rxSar.rcvd + headOff;
 
-                        //-- DEFAULT : No OOO and Rx segment is in expected sequence order
-                        if (!rxSar.ooo and (fsm_Meta.meta.seqNumb == rxSar.rcvd) and
-                                           (fsm_freeSpace > fsm_Meta.meta.length)) {
-                            if (DEBUG_LEVEL & TRACE_FSM) { printInfo(myName, "OOO-DEFAULT : Rx segment is in-order.\n"); }
-                            // Generate new received pointer
-                            newRcvd = fsm_Meta.meta.seqNumb + fsm_Meta.meta.length;
+                        //-- IN-ORDER : Rx segment is in sequence (and may fill the first hole)
+                        if ((begOff == 0) and isInSpace) {
+                            if (DEBUG_LEVEL & TRACE_FSM) { printInfo(myName, "OOO-IN-ORDER: Rx segment is in-order.\n"); }
+                            // The merged block (if any) becomes in-order as well
+                            RxSeqNum newRcvd = mrgRight;
                             // Update RxSar pointers
-                            soRSt_RxSarQry.write(RXeRxSarQuery(fsm_Meta.sessionId, newRcvd, QUERY_WR));
-                            // Send memory write command
-                            assessSize(myName, soMwr_WrCmd, "soMwr_WrCmd", cDepth_FsmToMwr_WrCmd);
-                            soMwr_WrCmd.write(DmCmd(memSegAddr, fsm_Meta.meta.length));
+                            RXeRxSarQuery rxSarQry(fsm_Meta.sessionId, newRcvd, (keptCnt != 0),
+                                                   newOooHead, keptCnt, keptBlk, fsm_Meta.meta.ce, QUERY_WR);
+                            rxSarQry.spill = segSpill;
+                            soRSt_RxSarQry.write(rxSarQry);
+                            // Send memory write command (unless already sent by a cut-through)
+                            if (!fsm_cutThru) {
+                                assessSize(myName, soMwr_WrCmd, "soMwr_WrCmd", cDepth_FsmToMwr_WrCmd);
+                                soMwr_WrCmd.write(DmCmd(memSegAddr, fsm_Meta.meta.length));
+                            }
                             // Send Rx data notify to [APP]
-                            soRan_RxNotif.write(TcpAppNotif(fsm_Meta.sessionId,  fsm_Meta.meta.length,
+                            soRan_RxNotif.write(TcpAppNotif(fsm_Meta.sessionId,  (TcpSegLen)mrgRightOff,
                                                             fsm_Meta.ip4SrcAddr, fsm_Meta.tcpSrcPort,
                                                             fsm_Meta.tcpDstPort));
                             // Send keep command
-                            soTsd_DropCmd.write(CMD_KEEP);
-                            fsm_oooDebugState = 2;
-                        }
-                        //-- START   : No OOO but Rx segment arrived out-of-order
-                        else if (!rxSar.ooo and (fsm_Meta.meta.seqNumb > rxSar.rcvd) and
-                                                (fsm_freeSpace > (fsm_Meta.meta.seqNumb+fsm_Meta.meta.length-rxSar.oooHead)(TOE_WINDOW_BITS-1, 0))) {
-                            if (DEBUG_LEVEL & TRACE_FSM) { printInfo(myName, "OOO-START   : Rx segment is out-of-order.\n"); }
-                            // Generate new oooHead and oooTail pointers
-                            newOooHead = fsm_Meta.meta.seqNumb + fsm_Meta.meta.length;
-                            newOooTail = fsm_Meta.meta.seqNumb;
-                            // Update RxSar pointers
-                            soRSt_RxSarQry.write(RXeRxSarQuery(fsm_Meta.sessionId, rxSar.rcvd, FLAG_OOO, newOooHead, newOooTail, QUERY_WR));
-                            // Send memory write command
-                            soMwr_WrCmd.write(DmCmd(memSegAddr, fsm_Meta.meta.length));
-                            // Prevent [Ran] to send Rx data notify to [APP] by setting LENGTH=0 !!!
-                            soRan_RxNotif.write(TcpAppNotif(fsm_Meta.sessionId,  0,
-                                                            fsm_Meta.ip4SrcAddr, fsm_Meta.tcpSrcPort,
-                                                            fsm_Meta.tcpDstPort));
-                            // Send keep command
-                            soTsd_DropCmd.write(CMD_KEEP);
-                            fsm_oooDebugState = 3;
+                            if (!fsm_cutThru) {
+                                soTsd_DropCmd.write(CMD_KEEP);
+                            }
+                            // Delay the ACK unless a hole is being filled [RFC-5681]
+                            isDelayedAck = (rxSar.oooCnt == 0);
+                            fsm_oooDebugState = isMerged ? 6 : 2;
                         }
-                        //-- CONTINUE: OOO exists and Rx segment is in-order with respect to 'oooHead' pointer
-                        else if (rxSar.ooo and (fsm_Meta.meta.seqNumb == rxSar.oooHead) and
-                                               (fsm_freeSpace > fsm_Meta.meta.length)) {
-                            if (DEBUG_LEVEL & TRACE_FSM) { printInfo(myName, "OOO-CONTINUE: Rx segment is in-order with respect to 'oooHead'.\n"); }
-                            // Generate new oooHead pointer
-                            newOooHead = fsm_Meta.meta.seqNumb + fsm_Meta.meta.length;
+                        //-- OUT-OF-ORDER : Rx segment is ahead of 'rcvd' and is not yet stored
+                        else if ((begOff != 0) and isInSpace and !isDuplicate and
+                                 (isMerged or (keptCnt < TOE_MAX_OOO_BLOCKS))) {
+                            if (DEBUG_LEVEL & TRACE_FSM) { printInfo(myName, "OOO-BLOCK   : Rx segment is out-of-order.\n"); }
+                            // Move the updated block to the front of the list [RFC-2018]
+                            OooBlock newBlk[TOE_MAX_OOO_BLOCKS];
+                            newBlk[0] = OooBlock(mrgLeft, mrgRight);
+                            for (int i=1; i<TOE_MAX_OOO_BLOCKS; i++) {
+                                #pragma HLS UNROLL
+                                newBlk[i] = keptBlk[i-1];
+                            }
                             // Update RxSar pointers
-                            soRSt_RxSarQry.write(RXeRxSarQuery(fsm_Meta.sessionId, rxSar.rcvd, FLAG_OOO, newOooHead, rxSar.oooTail, QUERY_WR));
-                            // Send memory write command
-                            soMwr_WrCmd.write(DmCmd(memSegAddr, fsm_Meta.meta.length));
+                            RXeRxSarQuery rxSarQry(fsm_Meta.sessionId, rxSar.rcvd, FLAG_OOO,
+                                                   newOooHead, keptCnt+1, newBlk, fsm_Meta.meta.ce, QUERY_WR);
+                            rxSarQry.spill = segSpill;
+                            soRSt_RxSarQry.write(rxSarQry);
+                            // Send memory write command (unless already sent by a cut-through)
+                            if (!fsm_cutThru) {
+                                soMwr_WrCmd.write(DmCmd(memSegAddr, fsm_Meta.meta.length));
+                            }
                             // Prevent [Ran] to send Rx data notify to [APP] by setting LENGTH=0 !!!
                             soRan_RxNotif.write(TcpAppNotif(fsm_Meta.sessionId,  0,
                                                             fsm_Meta.ip4SrcAddr, fsm_Meta.tcpSrcPort,
-                                                            fsm_Meta.tcpDstPort));
+                                                            fsm_Meta.tcpDstPort, ESTABLISHED));
                             // Send keep command
-                            soTsd_DropCmd.write(CMD_KEEP);
-                            fsm_oooDebugState = 4;
-                        }
-                        //-- CONTINUE: OOO exists, Rx segment is in-order with respect to 'rcvd' pointer but it does not fill the gap
-                        else if (rxSar.ooo and (fsm_Meta.meta.seqNumb == rxSar.rcvd) and
-                                               ((fsm_Meta.meta.seqNumb + fsm_Meta.meta.length) < rxSar.oooTail)) {
-                            if (DEBUG_LEVEL & TRACE_FSM) { printInfo(myName, "OOO-CONTINUE: Rx segment is in-order with respect to 'rcvd' but it does not fill the gap.\n"); }
-                            // Generate new received pointer
-                            newRcvd = fsm_Meta.meta.seqNumb + fsm_Meta.meta.length;
-                            // Update RxSar pointers
-                            soRSt_RxSarQry.write(RXeRxSarQuery(fsm_Meta.sessionId, newRcvd, FLAG_OOO, rxSar.oooHead, rxSar.oooTail, QUERY_WR));
-                            // Send memory write command
-                            soMwr_WrCmd.write(DmCmd(memSegAddr, fsm_Meta.meta.length));
-                            // Send Rx data notify to [APP]
-                            soRan_RxNotif.write(TcpAppNotif(fsm_Meta.sessionId, fsm_Meta.meta.length,
-                                                            fsm_Meta.ip4SrcAddr, fsm_Meta.tcpSrcPort,
-                                                            fsm_Meta.tcpDstPort));
-                            // Send keep command
-                            soTsd_DropCmd.write(CMD_KEEP);
-                            fsm_oooDebugState = 5;
-                        }
-                        //-- END       : OOO exists, Rx segment is in-order with respect to 'rcvd' pointer and it fills the gap
-                        else if (rxSar.ooo and (fsm_Meta.meta.seqNumb == rxSar.rcvd) and
-                                               ((fsm_Meta.meta.seqNumb + fsm_Meta.meta.length) == rxSar.oooTail)) {
-                            if (DEBUG_LEVEL & TRACE_FSM) { printInfo(myName, "OOO-END     : Rx segment is in-order with respect to 'rcvd' and it fills the gap.\n"); }
-                            // Generate new received pointer
-                            newRcvd = rxSar.oooHead;
-                            // Update RxSar pointers
-                            soRSt_RxSarQry.write(RXeRxSarQuery(fsm_Meta.sessionId, newRcvd, FLAG_INO, rxSar.oooHead, rxSar.oooTail, QUERY_WR));
-                            // Send memory write command
-                            soMwr_WrCmd.write(DmCmd(memSegAddr, fsm_Meta.meta.length));
-                            // Send Rx data notify to [APP]
-                            soRan_RxNotif.write(TcpAppNotif(fsm_Meta.sessionId, (rxSar.oooHead - rxSar.rcvd),
-                                                            fsm_Meta.ip4SrcAddr, fsm_Meta.tcpSrcPort,
-                                                            fsm_Meta.tcpDstPort));
-                            // Send keep command
-                            soTsd_DropCmd.write(CMD_KEEP);
-                            fsm_oooDebugState = 6;
+                            if (!fsm_cutThru) {
+                                soTsd_DropCmd.write(CMD_KEEP);
+                            }
+                            fsm_oooDebugState = isMerged ? 4 : 3;
                         }
                         //-- OOO-DROP  : Always drop segment in all other cases
                         else {
-                            soTsd_DropCmd.write(CMD_DROP);
+                            if (fsm_cutThru) {
+                                // Already written. Pair its memory write with an empty notification
+                                soRan_RxNotif.write(TcpAppNotif(fsm_Meta.sessionId,  0,
+                                                                fsm_Meta.ip4SrcAddr, fsm_Meta.tcpSrcPort,
+                                                                fsm_Meta.tcpDstPort, ESTABLISHED));
+                            }
+                            else {
+                                soTsd_DropCmd.write(CMD_DROP);
+                            }
                             fsm_oooDropCounter++;
                             fsm_oooDebugState = 10;
-                            if ( (fsm_Meta.meta.seqNumb < rxSar.rcvd)) {
+                            if ((ap_int<32>)begOff < 0) {
                                 printInfo(myName, "OOO-Dropping Rx segment (Frame is a retransmission because of a lost or delayed ACK). \n");
                                 fsm_oooDebugState = 11;
                             }
-                            else if ( (!rxSar.ooo and (fsm_Meta.meta.seqNumb == rxSar.rcvd) and (fsm_freeSpace <  fsm_Meta.meta.length)) or
-                                      (!rxSar.ooo and (fsm_Meta.meta.seqNumb >  rxSar.rcvd) and (fsm_freeSpace > (fsm_Meta.meta.seqNumb+fsm_Meta.meta.length-rxSar.rcvd)(TOE_WINDOW_BITS-1, 0))) ) {
+                            else if (!isInSpace) {
                                 printInfo(myName, "OOO-Dropping Rx segment (Not enough space left in the Rx ring buffer).\n");
                                 fsm_oooDebugState = 12;
                             }
-                            else if (fsm_Meta.meta.seqNumb+fsm_Meta.meta.length == rxSar.rcvd) {
+                            else if (isDuplicate) {
                                 printInfo(myName, "OOO-Dropping Rx segment (Segment is a duplicate).\n");
                                 fsm_oooDebugState = 13;
                             }
                             else {
-                                printFatal(myName, "OOO-Dropping Rx segment (Reason is unknown).\n");
-                                fsm_oooDebugState = 14;
+                                printInfo(myName, "OOO-Dropping Rx segment (No out-of-order block left).\n");
+                                fsm_oooDebugState = 15;
                             }
                         }
                     }
 
                    //-- Generate ACK Event -------------------------------------
-# if FAST_RETRANSMIT
-                    if (txSar.count == 3 && !txSar.fastRetransmitted) {  // [FIXME - Use a constant here]
-                        soEVe_Event.write(event(RT, fsm_Meta.sessionId));
+                    if (fastRetransmit) {
+                        // A retransmission event with 'rt_count=0' resends the first unacknowledged segment only
+                        soEVe_Event.write(Event(RT_EVENT, fsm_Meta.sessionId, 0));
                     }
-                    else if (fsm_meta.meta.length != 0) {
-#else
-                    if (fsm_Meta.meta.length != 0) {
-#endif
-                        if (!rxSar.ooo and (fsm_Meta.meta.seqNumb == rxSar.rcvd) and
-                                           (fsm_freeSpace > fsm_Meta.meta.length)) {
+                    else if (fsm_Meta.meta.length != 0) {
+                        if (isDelayedAck) {
                             // No OOO and Rx segment is in expected sequence order
-                            soEVe_Event.write(Event(ACK_EVENT, fsm_Meta.sessionId));
+                            soEVe_Event.write(Event(getAckEventType(fsm_Meta.portSts.ackPolicy), fsm_Meta.sessionId));
                         }
                         else {
                             // TCP retransmission frame
@@ -1660,8 +2283,13 @@ void pFiniteStateMachine(
                             fsm_oooDebugState += 100;
                         }
                     }
+                    else if (windowOpened and (txSar.appw != (TxBufPtr)txSar.prevUnak)) {
+                        // The window moved while APP data is pending --> Clock it out
+                        soEVe_Event.write(Event(TX_EVENT, fsm_Meta.sessionId));
+                    }
 
                     //-- Reset Retransmit Timer --------------------------------
+                    TimerCmd probeCmd = LOAD_TIMER;
                     if (fsm_Meta.meta.ackNumb == txSar.prevUnak) {
                         switch (tcpState) {
                         case SYN_RECEIVED:
@@ -1670,10 +2298,12 @@ void pFiniteStateMachine(
                             break;
                         case CLOSING:
                             soSTt_StateQry.write(StateQuery(fsm_Meta.sessionId, TIME_WAIT, QUERY_WR));
-                            soTIm_CloseTimer.write(fsm_Meta.sessionId); // [TDOD - rename]
+                            soTIm_CloseTimerCmd.write(RXeCloseTimerCmd(fsm_Meta.sessionId, LOAD_TIMER, fsm_Meta.portSts.twShort));
+                            probeCmd = STOP_TIMER;
                             break;
                         case LAST_ACK:
                             soSTt_StateQry.write(StateQuery(fsm_Meta.sessionId, CLOSED, QUERY_WR));
+                            probeCmd = STOP_TIMER;
                             break;
                         default:
                             soSTt_StateQry.write(StateQuery(fsm_Meta.sessionId, tcpState, QUERY_WR));
@@ -1684,17 +2314,27 @@ void pFiniteStateMachine(
                         // Reset rtTimer
                         soSTt_StateQry.write(StateQuery(fsm_Meta.sessionId, tcpState, QUERY_WR)); // or ESTABLISHED
                     }
+                    //-- Re-load the keepalive timer (the peer is alive) or stop it once closed
+                    soTIm_ProbeTimerCmd.write(RXeProbeTimerCmd(fsm_Meta.sessionId, probeCmd,
+                                              fsm_Meta.portSts.kaProfile));
                 } // End of : if ( (tcpState == ...
                 // TODO if timewait just send ACK, can it be time wait??
                 else { // state == (CLOSED || SYN_SENT || CLOSE_WAIT || FIN_WAIT_2 || TIME_WAIT)
                     // SENT RST, RFC 793: fig.11
                     soEVe_Event.write(rstEvent(fsm_Meta.sessionId, fsm_Meta.meta.seqNumb+fsm_Meta.meta.length)); // noACK ?
                     // if data is in the pipe it needs to be droppped
-                    if (fsm_Meta.meta.length != 0) {
+                    if (fsm_cutThru) {
+                        // Already written. Pair its memory write with an empty notification
+                        soRan_RxNotif.write(TcpAppNotif(fsm_Meta.sessionId,  0,
+                                                        fsm_Meta.ip4SrcAddr, fsm_Meta.tcpSrcPort,
+                                                        fsm_Meta.tcpDstPort, ESTABLISHED));
+                    }
+                    else if (fsm_Meta.meta.length != 0) {
                         soTsd_DropCmd.write(CMD_DROP);
                     }
                     soSTt_StateQry.write(StateQuery(fsm_Meta.sessionId, tcpState, QUERY_WR));
                 }
+                fsm_cutThru = false;
             } // End of: ACK processing
             break;
         case 2:
@@ -1705,14 +2345,31 @@ void pFiniteStateMachine(
             if (fsm_fsmState == FSM_LOAD) {
                 siSTt_StateRep.read(tcpState);
                 siRSt_RxSarRep.read(rxSar);
-                if (tcpState == CLOSED or tcpState == SYN_SENT) {
-                    // Initialize RxSar with received SeqNum
+                // A new SYN with a higher sequence number re-opens a session in TIME_WAIT [RFC-6191]
+                bool twReuse = (tcpState == TIME_WAIT) and
+                               ((ap_int<32>)(fsm_Meta.meta.seqNumb - rxSar.rcvd) > 0);
+                if (tcpState == CLOSED or tcpState == SYN_SENT or twReuse) {
+                    if (twReuse) {
+                        // Assassinate the TIME_WAIT session
+                        soTIm_CloseTimerCmd.write(RXeCloseTimerCmd(fsm_Meta.sessionId, STOP_TIMER));
+                        if (DEBUG_LEVEL & TRACE_FSM) printInfo(myName, "Re-opening SessId %d from TIME_WAIT.\n", fsm_Meta.sessionId.to_uint());
+                    }
+                    // Window scaling is only enabled if we need it and if the peer offered it [RFC-7323]
+                    bool wsEnabled = (TOE_WINDOW_SCALE != 0) and fsm_Meta.meta.wsOpt;
+                    // Initialize RxSar with received SeqNum, the shift count of our window and SACK-permitted
                     soRSt_RxSarQry.write(RXeRxSarQuery(fsm_Meta.sessionId, fsm_Meta.meta.seqNumb+1,
+                                                       wsEnabled ? TOE_WINDOW_SCALE : 0,
+                                                       (FlagBool)fsm_Meta.meta.sackOk,
                                                        QUERY_WR, QUERY_INIT));
-                    // Initialize TxSar with received WindowSize
+                    // Use the MSS of the peer but never exceed our own MTU (default MSS if none) [RFC-9293]
+                    TcpSegLen sndMss = (fsm_Meta.meta.mss == 0)    ? THEIR_MSS :
+                                       (fsm_Meta.meta.mss > MY_MSS) ? MY_MSS    : fsm_Meta.meta.mss;
+                    // Initialize TxSar with received WindowSize (never scaled in a SYN), shift count and MSS
                     //  All other parameters are zero or false; they will be initialized by [TXe]
                     soTSt_TxSarQry.write((RXeTxSarQuery(fsm_Meta.sessionId, 0, fsm_Meta.meta.winSize,
-                                                        0, 0, false)));
+                                                        0, 0, false,
+                                                        wsEnabled ? fsm_Meta.meta.winScale : (TcpOptWss)0,
+                                                        sndMss)));
                     // Post a SYN_ACK event request
                     soEVe_Event.write(Event(SYN_ACK_EVENT, fsm_Meta.sessionId));
                     if (DEBUG_LEVEL & TRACE_FSM) printInfo(myName, "Requesting [TXe] to send a [SYN,ACK] for SessId %d.\n", fsm_Meta.sessionId.to_uint());
@@ -1730,6 +2387,7 @@ void pFiniteStateMachine(
                     else { // Sent RST, RFC 793: fig.9 (old) duplicate SYN(+ACK)
                         soEVe_Event.write(rstEvent(fsm_Meta.sessionId, fsm_Meta.meta.seqNumb+1)); //length == 0
                         soSTt_StateQry.write(StateQuery(fsm_Meta.sessionId, CLOSED, QUERY_WR));
+                        soTIm_ProbeTimerCmd.write(RXeProbeTimerCmd(fsm_Meta.sessionId, STOP_TIMER));
                     }
                 }
                 else { // Any synchronized state
@@ -1752,21 +2410,33 @@ void pFiniteStateMachine(
                 siRSt_RxSarRep.read(rxSar);
                 siTSt_TxSarRep.read(txSar);
                 TimerCmd timerCmd = (fsm_Meta.meta.ackNumb == txSar.prevUnak) ? STOP_TIMER : LOAD_TIMER;
-                soTIm_ReTxTimerCmd.write(RXeReTransTimerCmd(fsm_Meta.sessionId, timerCmd));
+                soTIm_ReTxTimerCmd.write(RXeReTransTimerCmd(fsm_Meta.sessionId, timerCmd, txSar.rto));
                 if ( (tcpState == SYN_SENT) and (fsm_Meta.meta.ackNumb == txSar.prevUnak) ) { // && !mh_lup.created)
-                    // Initialize RxSar with received SeqNum
+                    // Our SYN offered a window scale; it is enabled if the peer replied with one [RFC-7323]
+                    bool wsEnabled = (TOE_WINDOW_SCALE != 0) and fsm_Meta.meta.wsOpt;
+                    // Initialize RxSar with received SeqNum, the shift count of our window and SACK-permitted
                     soRSt_RxSarQry.write(RXeRxSarQuery(fsm_Meta.sessionId, fsm_Meta.meta.seqNumb+1,
+                                                       wsEnabled ? TOE_WINDOW_SCALE : 0,
+                                                       (FlagBool)fsm_Meta.meta.sackOk,
                                                        QUERY_WR, QUERY_INIT));
-                    // Update TxSar with received AckNum and WindowSize
+                    // Use the MSS of the peer but never exceed our own MTU (default MSS if none) [RFC-9293]
+                    TcpSegLen sndMss = (fsm_Meta.meta.mss == 0)    ? THEIR_MSS :
+                                       (fsm_Meta.meta.mss > MY_MSS) ? MY_MSS    : fsm_Meta.meta.mss;
+                    // Update TxSar with received AckNum, WindowSize (never scaled in a SYN), shift count and MSS
+                    //  The initial window is re-computed because it depends on the MSS [RFC-6928]
                     soTSt_TxSarQry.write(RXeTxSarQuery(fsm_Meta.sessionId,
                                                        fsm_Meta.meta.ackNumb,
                                                        fsm_Meta.meta.winSize,
-                                                       txSar.cong_window, 0, false)); // [TODO - maybe include count check]
+                                                       ccInitWindow(sndMss), 0, false,
+                                                       wsEnabled ? fsm_Meta.meta.winScale : (TcpOptWss)0,
+                                                       sndMss)); // [TODO - maybe include count check]
                     // Set ACK event
                     soEVe_Event.write(Event(ACK_NODELAY_EVENT, fsm_Meta.sessionId));
                     soSTt_StateQry.write(StateQuery(fsm_Meta.sessionId, ESTABLISHED, QUERY_WR));
                     // Signal [TAi] that the active connection was successfully established
                     soTAi_SessOpnSts.write(SessState(fsm_Meta.sessionId, ESTABLISHED));
+                    // Start the keepalive timer of the session
+                    soTIm_ProbeTimerCmd.write(RXeProbeTimerCmd(fsm_Meta.sessionId, LOAD_TIMER, fsm_Meta.portSts.kaProfile));
                 }
                 else if (tcpState == SYN_SENT) { //TODO correct answer?
                     // Sent RST, RFC 793: fig.9 (old) duplicate SYN(+ACK)
@@ -1791,7 +2461,7 @@ void pFiniteStateMachine(
                 siRSt_RxSarRep.read(rxSar);
                 siTSt_TxSarRep.read(txSar);
                 TimerCmd timerCmd = (fsm_Meta.meta.ackNumb == txSar.prevUnak) ? STOP_TIMER : LOAD_TIMER;
-                soTIm_ReTxTimerCmd.write(RXeReTransTimerCmd(fsm_Meta.sessionId, timerCmd));
+                soTIm_ReTxTimerCmd.write(RXeReTransTimerCmd(fsm_Meta.sessionId, timerCmd, txSar.rto));
                 // Check state and if FIN in order, Current out of order FINs are not accepted
                 if ( (tcpState == ESTABLISHED or  tcpState == FIN_WAIT_1 or tcpState == FIN_WAIT_2) and (rxSar.rcvd == fsm_Meta.meta.seqNumb) ) {
                     soTSt_TxSarQry.write((RXeTxSarQuery(fsm_Meta.sessionId,
@@ -1799,16 +2469,21 @@ void pFiniteStateMachine(
                                           txSar.cong_window, txSar.count,
                                           ~QUERY_FAST_RETRANSMIT))); //TODO include count check
                     // +1 for phantom byte, there might be data too
-                    soRSt_RxSarQry.write(RXeRxSarQuery(fsm_Meta.sessionId, fsm_Meta.meta.seqNumb+fsm_Meta.meta.length+1,
-                                         QUERY_WR)); // diff to ACK
-                    // Clear the probe timer
-                    soTIm_ClearProbeTimer.write(fsm_Meta.sessionId);
+                    RXeRxSarQuery rxSarQry(fsm_Meta.sessionId, fsm_Meta.meta.seqNumb+fsm_Meta.meta.length+1,
+                                           QUERY_WR); // diff to ACK
+                    rxSarQry.spill = getSpill(fsm_Meta.meta.seqNumb(TOE_WINDOW_BITS-1, 0), fsm_Meta.meta.length);
+                    soRSt_RxSarQry.write(rxSarQry);
+                    // Re-load the keepalive timer, or stop it when entering TIME_WAIT
+                    bool toTimeWait = (tcpState != ESTABLISHED) and (fsm_Meta.meta.ackNumb == txSar.prevUnak);
+                    soTIm_ProbeTimerCmd.write(RXeProbeTimerCmd(fsm_Meta.sessionId,
+                                              toTimeWait ? STOP_TIMER : LOAD_TIMER,
+                                              fsm_Meta.portSts.kaProfile));
                     // Check if there is payload
                     if (fsm_Meta.meta.length != 0) {
                         // Build a DDR memory address for this segment
                         RxMemPtr memSegAddr = TOE_RX_MEMORY_BASE;
-                        memSegAddr(29, 16) = fsm_Meta.sessionId(13, 0);
-                        memSegAddr(15,  0) = fsm_Meta.meta.seqNumb(15, 0);
+                        memSegAddr(TOE_RX_MEMORY_BITS-1, TOE_SLICE_BITS) = fsm_Meta.sessionId(TOE_RX_MEMORY_BITS-TOE_SLICE_BITS-1, 0);
+                        memSegAddr(TOE_WINDOW_BITS-1, 0) = fsm_Meta.meta.seqNumb(TOE_WINDOW_BITS-1, 0);
 #if !(RX_DDR_BYPASS)
                         soMwr_WrCmd.write(DmCmd(memSegAddr, fsm_Meta.meta.length));
 #endif
@@ -1831,16 +2506,16 @@ void pFiniteStateMachine(
                         if (fsm_Meta.meta.ackNumb == txSar.prevUnak) {
                             // Check if final FIN is ACK'd -> LAST_ACK
                             soSTt_StateQry.write(StateQuery(fsm_Meta.sessionId, TIME_WAIT, QUERY_WR));
-                            soTIm_CloseTimer.write(fsm_Meta.sessionId);
+                            soTIm_CloseTimerCmd.write(RXeCloseTimerCmd(fsm_Meta.sessionId, LOAD_TIMER, fsm_Meta.portSts.twShort));
                         }
                         else {
                             soSTt_StateQry.write(StateQuery(fsm_Meta.sessionId, CLOSING, QUERY_WR));
                         }
-                        soEVe_Event.write(Event(ACK_EVENT, fsm_Meta.sessionId));
+                        soEVe_Event.write(Event(getAckEventType(fsm_Meta.portSts.ackPolicy), fsm_Meta.sessionId));
                     }
                 }
                 else { // NOT (ESTABLISHED || FIN_WAIT_1 || FIN_WAIT_2)
-                    soEVe_Event.write(Event(ACK_EVENT, fsm_Meta.sessionId));
+                    soEVe_Event.write(Event(getAckEventType(fsm_Meta.portSts.ackPolicy), fsm_Meta.sessionId));
                     soSTt_StateQry.write(StateQuery(fsm_Meta.sessionId, tcpState, QUERY_WR));
                     // If there is payload we need to drop it
                     if (fsm_Meta.meta.length != 0) {
@@ -1884,6 +2559,7 @@ void pFiniteStateMachine(
                                                          fsm_Meta.tcpSrcPort,   fsm_Meta.tcpDstPort, CLOSED)); // RESET-CLOSED
                             soSTt_StateQry.write(StateQuery(fsm_Meta.sessionId, CLOSED, QUERY_WR)); //TODO maybe some TIME_WAIT state
                             soTIm_ReTxTimerCmd.write(RXeReTransTimerCmd(fsm_Meta.sessionId, STOP_TIMER));
+                            soTIm_ProbeTimerCmd.write(RXeProbeTimerCmd(fsm_Meta.sessionId, STOP_TIMER));
                         }
                         else {
                             // Ignore since not matching window
@@ -1975,8 +2651,8 @@ void pEventMultiplexer(
  * @param[out] soTSt_TxSarQry      Query to TxSarTable (TSt).
  * @param[in]  siTSt_TxSarRep      Reply from [TSt].
  * @param[out] soTIm_ReTxTimerCmd  Command for a retransmit timer to Timers (TIm).
- * @param[out] soTIm_ClearProbeTimer Clear the probe timer command to [TIm]..
- * @param[out] soTIm_CloseTimer    Close session timer command to [TIm].
+ * @param[out] soTIm_ProbeTimerCmd Command for a keepalive timer to [TIm].
+ * @param[out] soTIm_CloseTimerCmd Close session timer command to [TIm].
  * @param[out] soEVe_SetEvent      Event forward to EventEngine (EVe).
  * @param[out] soTAi_SessOpnSts    Open status of the session to TxAppInterface (TAi).
  * @param[out] soRAi_RxNotif       Rx data notification to RxAppInterface (RAi).
@@ -1996,6 +2672,11 @@ void pEventMultiplexer(
  *   data structures according to the type of received packet. Finally, if the
  *   packet contains a valid data payload, the TCP segment is stored in external
  *   DDR4 memory and the application is notified about the arrival of new data.
+ *  When TOE_RX_NOTIF_COALESCE_CFG is set, the notifications of consecutive
+ *   in-order segments are merged by the RxNotifCoalescer (Rnc).
+ *  When TOE_RX_CUT_THROUGH_CFG is set, the payload of a data segment is written
+ *   into memory while it is still being received, and the segment is only
+ *   committed (or aborted) once its checksum is known.
  *******************************************************************************/
 void rx_engine(
         // IP Rx Interface
@@ -2008,7 +2689,7 @@ void rx_engine(
         stream<TcpState>                &siSTt_StateRep,
         //-- Port Table Interface
         stream<TcpPort>                 &soPRt_PortStateReq,
-        stream<RepBit>                  &siPRt_PortStateRep,
+        stream<PortStsRep>              &siPRt_PortStateRep,
         //-- Rx SAR Table Interface
         stream<RXeRxSarQuery>           &soRSt_RxSarQry,
         stream<RxSarReply>              &siRSt_RxSarRep,
@@ -2017,8 +2698,8 @@ void rx_engine(
         stream<RXeTxSarReply>           &siTSt_TxSarRep,
             //-- Timers Interface
         stream<RXeReTransTimerCmd>      &soTIm_ReTxTimerCmd,
-        stream<SessionId>               &soTIm_ClearProbeTimer,
-        stream<SessionId>               &soTIm_CloseTimer,
+        stream<RXeProbeTimerCmd>        &soTIm_ProbeTimerCmd,
+        stream<RXeCloseTimerCmd>        &soTIm_CloseTimerCmd,
         //-- Event Engine Interface
         stream<ExtendedEvent>           &soEVe_SetEvent,
         //-- Tx Application Interface
@@ -2055,6 +2736,9 @@ void rx_engine(
     static stream<TcpSegLen>        ssTleToIph_TcpSegLen    ("ssTleToIph_TcpSegLen");
     #pragma HLS stream     variable=ssTleToIph_TcpSegLen    depth=2
 
+    static stream<FlagBit>          ssTleToCsa_CeMark       ("ssTleToCsa_CeMark");
+    #pragma HLS stream     variable=ssTleToCsa_CeMark       depth=4
+
     //-- Insert Pseudo Header (Iph) -------------------------------------------
     static stream<AxisPsd4>         ssIphToCsa_PseudoPkt    ("ssIphToCsa_PseudoPkt");
     #pragma    HLS stream  variable=ssIphToCsa_PseudoPkt    depth=8
@@ -2062,7 +2746,7 @@ void rx_engine(
 
     //-- CheckSum Accumulator (Csa) -------------------------------------------
     static stream<AxisApp>          ssCsaToTid_Data         ("ssCsaToTid_Data");
-    #pragma HLS stream     variable=ssCsaToTid_Data         depth=256 //critical, tcp checksum computation
+    #pragma HLS stream     variable=ssCsaToTid_Data         depth=cDepth_FullSegment //critical, tcp checksum computation
     #pragma HLS DATA_PACK  variable=ssCsaToTid_Data
 
     static stream<ValBit>           ssCsaToTid_DataValid    ("ssCsaToTid_DataValid");
@@ -2076,6 +2760,12 @@ void rx_engine(
     #pragma HLS stream     variable=ssCsaToMdh_SockPair     depth=2
     #pragma HLS DATA_PACK  variable=ssCsaToMdh_SockPair
 
+    static stream<ValBit>           ssCsaToMdh_Verdict      ("ssCsaToMdh_Verdict");
+    #pragma HLS stream     variable=ssCsaToMdh_Verdict      depth=2
+
+    static stream<ValBit>           ssCsaToTid_LateVal      ("ssCsaToTid_LateVal");
+    #pragma HLS stream     variable=ssCsaToTid_LateVal      depth=2
+
     //-- Tcp Invalid dropper (Tid) --------------------------------------------
     static stream<AxisApp>          ssTidToTsd_Data         ("ssTidToTsd_Data");
     #pragma HLS stream     variable=ssTidToTsd_Data         depth=8
@@ -2118,6 +2808,13 @@ void rx_engine(
     static stream<FlagBool>         ssMwrToRan_SplitSeg     ("ssMwrToRan_SplitSeg");
     #pragma HLS stream     variable=ssMwrToRan_SplitSeg     depth=cDepth_MwrToRan_SplitSeg
 
+  #if TOE_RX_NOTIF_COALESCE_CFG
+    //-- Rx Application Notifier (Ran) ----------------------------------------
+    static stream<TcpAppNotif>      ssRanToRnc_Notif        ("ssRanToRnc_Notif");
+    #pragma HLS stream     variable=ssRanToRnc_Notif        depth=cDepth_RanToRnc_Notif
+    #pragma HLS DATA_PACK  variable=ssRanToRnc_Notif
+  #endif
+
     //-------------------------------------------------------------------------
     //-- PROCESS FUNCTIONS
     //-------------------------------------------------------------------------
@@ -2125,7 +2822,8 @@ void rx_engine(
     pTcpLengthExtractor(
             siIPRX_Data,
             ssTleToIph_Data,
-            ssTleToIph_TcpSegLen);
+            ssTleToIph_TcpSegLen,
+            ssTleToCsa_CeMark);
 
 
     pInsertPseudoHeader(
@@ -2135,15 +2833,19 @@ void rx_engine(
 
     pCheckSumAccumulator(
             ssIphToCsa_PseudoPkt,
+            ssTleToCsa_CeMark,
             ssCsaToTid_Data,
             ssCsaToTid_DataValid,
             ssCsaToMdh_Meta,
             ssCsaToMdh_SockPair,
-            soPRt_PortStateReq);
+            soPRt_PortStateReq,
+            ssCsaToMdh_Verdict,
+            ssCsaToTid_LateVal);
 
     pTcpInvalidDropper(
             ssCsaToTid_Data,
             ssCsaToTid_DataValid,
+            ssCsaToTid_LateVal,
             ssTidToTsd_Data,
             soMMIO_CrcDropCnt);
 
@@ -2153,6 +2855,7 @@ void rx_engine(
             soSLc_SessLkReq,
             siSLc_SessLkRep,
             siPRt_PortStateRep,
+            ssCsaToMdh_Verdict,
             ssMdhToEvm_Event,
             ssMdhToTsd_DropCmd,
             ssMdhToFsm_Meta,
@@ -2167,8 +2870,8 @@ void rx_engine(
             soTSt_TxSarQry,
             siTSt_TxSarRep,
             soTIm_ReTxTimerCmd,
-            soTIm_ClearProbeTimer,
-            soTIm_CloseTimer,
+            soTIm_ProbeTimerCmd,
+            soTIm_CloseTimerCmd,
             soTAi_SessOpnSts,
             ssFsmToEvm_Event,
             ssFsmToTsd_DropCmd,
@@ -2192,12 +2895,25 @@ void rx_engine(
             soMEM_WrData,
             ssMwrToRan_SplitSeg);
 
+  #if TOE_RX_NOTIF_COALESCE_CFG
+    pRxAppNotifier(
+            siMEM_WrSts,
+            ssFsmToRan_Notif,
+            ssRanToRnc_Notif,
+            ssMwrToRan_SplitSeg,
+            soMMIO_RxMemWrErr);
+
+    pRxNotifCoalescer(
+            ssRanToRnc_Notif,
+            soRAi_RxNotif);
+  #else
     pRxAppNotifier(
             siMEM_WrSts,
             ssFsmToRan_Notif,
             soRAi_RxNotif,
             ssMwrToRan_SplitSeg,
             soMMIO_RxMemWrErr);
+  #endif
 
     pEventMultiplexer(
             ssMdhToEvm_Event,
@@ -60,12 +60,26 @@ EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "../../../../../NTS/nts_utils.hpp"
 #include "../../../../../NTS/SimNtsUtils.hpp"
 #include "../../../../../NTS/toe/src/toe.hpp"
+#include "../../../../../NTS/toe/src/toe_utils.hpp"
+#include "../../../../../NTS/toe/src/congestion_control/congestion_control.hpp"
 #include "../../../../../NTS/AxisIp4.hpp"
 #include "../../../../../NTS/AxisTcp.hpp"
 #include "../../../../../NTS/AxisPsd4.hpp"
 
 using namespace hls;
 
+/********************************************
+ * RXe - Segment Processing Phase
+ *  A segment is either processed once after
+ *  its checksum verdict (FULL), or twice when
+ *  the Rx path is cut-through: first after
+ *  its header (SPEC), then after its verdict
+ *  (COMMIT or ABORT).
+ ********************************************/
+typedef ap_uint<2> RxPhase;
+
+enum RxPhases { RX_PHASE_FULL=0, RX_PHASE_SPEC, RX_PHASE_COMMIT, RX_PHASE_ABORT };
+
 /********************************************
  * RXe - MetaData Interface
  ********************************************/
@@ -79,6 +93,15 @@ class RXeMeta {
     TcpCtrlBit  rst;
     TcpCtrlBit  syn;
     TcpCtrlBit  fin;
+    TcpCtrlBit  ece;        // ECN-Echo
+    FlagBit     ce;         // The IP packet was marked Congestion Experienced
+    FlagBit     wsOpt;      // The segment carries a Window Scale option
+    TcpOptWss   winScale;   // The shift count of that Window Scale option
+    FlagBit     sackOk;     // The segment carries a SACK-Permitted option
+    FlagBit     sackBlk;    // The segment carries at least one SACK block above 'ackNumb'
+    TcpSeqNum   sackLeft;   // The lowest left edge of these SACK blocks
+    TcpSegLen   mss;        // The MSS option of the segment (0 if none)
+    RxPhase     phase;      // The processing phase of the segment (see RxPhases)
     RXeMeta() {}
 };
 
@@ -92,9 +115,45 @@ class RXeFsmMeta {
     TcpSrcPort          tcpSrcPort;
     TcpDstPort          tcpDstPort;
     RXeMeta             meta;
+    FlagBool            synCookie;  // The ACK of a valid SYN cookie (the session was just created)
+    PortStsRep          portSts;    // The state and the session options of the destination port
     RXeFsmMeta() {}
     RXeFsmMeta(SessionId sessId,  Ip4SrcAddr ipSA,  TcpSrcPort tcpSP,  TcpDstPort tcpDP,  RXeMeta rxeMeta) :
-               sessionId(sessId), ip4SrcAddr(ipSA), tcpSrcPort(tcpSP), tcpDstPort(tcpDP),    meta(rxeMeta) {}
+               sessionId(sessId), ip4SrcAddr(ipSA), tcpSrcPort(tcpSP), tcpDstPort(tcpDP),    meta(rxeMeta), synCookie(false), portSts(STS_OPENED) {}
+    RXeFsmMeta(SessionId sessId,  Ip4SrcAddr ipSA,  TcpSrcPort tcpSP,  TcpDstPort tcpDP,  RXeMeta rxeMeta, FlagBool synCookie, PortStsRep portSts) :
+               sessionId(sessId), ip4SrcAddr(ipSA), tcpSrcPort(tcpSP), tcpDstPort(tcpDP),    meta(rxeMeta), synCookie(synCookie), portSts(portSts) {}
+};
+
+/********************************************
+ * RXe - Rx Notification Table (Rnc)
+ *  The notification which is being coalesced
+ *  for a session.
+ ********************************************/
+class RxNotifEntry {
+  public:
+    TcpAppNotif notif;   // A 'tcpDatLen' of zero means nothing is pending
+    ap_uint<1>  queued;  // The session has a deadline in the notification queue
+    RxNotifEntry() {}
+    RxNotifEntry(TcpAppNotif notif, ap_uint<1> queued) :
+                 notif(notif), queued(queued) {}
+};
+
+/********************************************
+ * RXe - Rx Notification Queue (Rnc)
+ *  The deadlines are queued in the order they
+ *  were armed. Since they all use the same
+ *  timeout, the head of the queue is always
+ *  the earliest one.
+ ********************************************/
+typedef ap_uint<20> RxNotifTime;  // A time stamp in clock cycles
+
+class RxNotifTimer {
+  public:
+    SessionId   sessId;
+    RxNotifTime deadline;
+    RxNotifTimer() {}
+    RxNotifTimer(SessionId sessId, RxNotifTime deadline) :
+                 sessId(sessId), deadline(deadline) {}
 };
 
 /*******************************************************************************
@@ -110,6 +169,8 @@ const int cDepth_MdhToTsd_DropCmd  = 16;
 
 const int cDepth_MwrToRan_SplitSeg = 16;
 
+const int cDepth_RanToRnc_Notif    =  4;
+
 /*******************************************************************************
  *
  * @brief ENTITY - Rx Engine (RXe)
@@ -126,7 +187,7 @@ void rx_engine(
         stream<TcpState>                &siSTt_StateRep,
         //-- Port Table Interface
         stream<TcpPort>                 &soPRt_PortStateReq,
-        stream<RepBit>                  &siPRt_PortStateRep,
+        stream<PortStsRep>              &siPRt_PortStateRep,
         //-- Rx SAR Table Interface
         stream<RXeRxSarQuery>           &soRSt_RxSarQry,
         stream<RxSarReply>              &siRSt_RxSarRep,
@@ -135,8 +196,8 @@ void rx_engine(
         stream<RXeTxSarReply>           &siTSt_TxSarRep,
         	//-- Timers Interface
         stream<RXeReTransTimerCmd>      &soTIm_ReTxTimerCmd,
-        stream<SessionId>               &soTIm_ClearProbeTimer,
-        stream<SessionId>               &soTIm_CloseTimer,
+        stream<RXeProbeTimerCmd>        &soTIm_ProbeTimerCmd,
+        stream<RXeCloseTimerCmd>        &soTIm_CloseTimerCmd,
         //-- Event Engine Interface
         stream<ExtendedEvent>           &soEVe_SetEvent,
         //-- Tx Application Interface
@@ -2427,7 +2427,7 @@ void pTAIF(
  * @param[out] soCAM_SssUpdReq   Session update request to [CAM].
  * @param[in]  siCAM_SssUpdRep   Session update reply from [CAM].
  * @param[out] soDBG_SssRelCnt   Session release count (for DEBUG).
- * @param[out] soDBG_SssRegCnt   Session register count (foe DEBUG).
+ * @param[out] soDBG_SssRegCnt   Session counts {peak(31:16), live(15:0)} (for DEBUG).
  *
  * @details
  *  This process is a wrapper for the 'toe_top' entity. It instantiates such an
@@ -2490,7 +2490,7 @@ void pTAIF(
         //-- DEBUG / Interfaces
         //-- DEBUG / Session Statistics Interfaces
         stream<ap_uint<16> >                    &soDBG_SssRelCnt,
-        stream<ap_uint<16> >                    &soDBG_SssRegCnt,
+        stream<ap_uint<32> >                    &soDBG_SssRegCnt,
         //-- DEBUG / Internal Counters Interfaces
         stream<RxBufPtr>                        &soDBG_RxFreeSpace,
         stream<ap_uint<32> >                    &soDBG_TcpIpRxByteCnt,
@@ -2620,10 +2620,15 @@ int main(int argc, char *argv[]) {
     stream<TcpAppData>              ssTAIF_TOE_Data      ("ssTAIF_TOE_Data");
     stream<TcpAppSndReq>            ssTAIF_TOE_SndReq    ("ssTAIF_TOE_SndReq");
     stream<TcpAppSndRep>            ssTOE_TAIF_SndRep    ("ssTOE_TAIF_SndRep");
+    stream<TcpAppSndDsc>            ssTAIF_TOE_SndDsc    ("ssTAIF_TOE_SndDsc");
+    stream<TcpAppSndCpl>            ssTOE_TAIF_SndCpl    ("ssTOE_TAIF_SndCpl");
 
     stream<TcpAppRdReq>             ssTAIF_TOE_DReq      ("ssTAIF_TOE_DReq");
     stream<TcpAppData>              ssTOE_TAIF_Data      ("ssTOE_TAIF_Data");
     stream<TcpAppMeta>              ssTOE_TAIF_Meta      ("ssTOE_TAIF_Meta");
+    stream<TcpAppRdReq>             ssTAIF_TOE_DscReq    ("ssTAIF_TOE_DscReq");
+    stream<TcpAppRdDsc>             ssTOE_TAIF_RdDsc     ("ssTOE_TAIF_RdDsc");
+    stream<TcpAppRxCrd>             ssTAIF_TOE_RxCrd     ("ssTAIF_TOE_RxCrd");
 
     stream<TcpAppLsnReq>            ssTAIF_TOE_LsnReq    ("ssTAIF_TOE_LsnReq");
     stream<TcpAppLsnRep>            ssTOE_TAIF_LsnRep    ("ssTOE_TAIF_LsnRep");
@@ -2660,7 +2665,7 @@ int main(int argc, char *argv[]) {
     stream<ap_uint<8> >             ssTOE_MMIO_SessDropCnt  ("ssTOE_MMIO_SessDropCnt");
     stream<ap_uint<8> >             ssTOE_MMIO_OooDropCnt   ("ssTOE_MMIO_OooDropCnt");
 
-    stream<ap_uint<16> >            ssTOE_OpnSessCount   ("ssTOE_OpnSessCount");
+    stream<ap_uint<32> >            ssTOE_OpnSessCount   ("ssTOE_OpnSessCount");
     stream<ap_uint<16> >            ssTOE_ClsSessCount   ("ssTOE_ClsSessCount");
     stream<RxBufPtr>                ssTOE_RxFreeSpace    ("ssTOE_RxFreeSpace");
     stream<ap_uint<32> >            ssTOE_TcpIprxByteCnt ("ssTOE_TcpIprxByteCnt");
@@ -2884,6 +2889,9 @@ int main(int argc, char *argv[]) {
             ssTAIF_TOE_DReq,
             ssTOE_TAIF_Data,
             ssTOE_TAIF_Meta,
+            ssTAIF_TOE_DscReq,
+            ssTOE_TAIF_RdDsc,
+            ssTAIF_TOE_RxCrd,
             //-- TAIF / Listen Port Interfaces
             ssTAIF_TOE_LsnReq,
             ssTOE_TAIF_LsnRep,
@@ -2891,6 +2899,8 @@ int main(int argc, char *argv[]) {
             ssTAIF_TOE_Data,
             ssTAIF_TOE_SndReq,
             ssTOE_TAIF_SndRep,
+            ssTAIF_TOE_SndDsc,
+            ssTOE_TAIF_SndCpl,
             //-- TAIF / Open Connection Interfaces
             ssTAIF_TOE_OpnReq,
             ssTOE_TAIF_OpnRep,
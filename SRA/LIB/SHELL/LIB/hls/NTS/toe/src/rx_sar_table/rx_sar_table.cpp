@@ -54,6 +54,7 @@ EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  *******************************************************************************/
 
 #include "rx_sar_table.hpp"
+#include "../buffer_pool/buffer_pool.hpp"
 
 using namespace hls;
 
@@ -73,6 +74,48 @@ using namespace hls;
 
 #define DEBUG_LEVEL (TRACE_OFF)
 
+/*******************************************************************************
+ * @brief Returns the end of the Rx window of a session.
+ *
+ * @param[in] entry  The Rx SAR entry of the session.
+ *
+ * @details
+ *  With the buffer pool, the window stops at the beginning of the page which
+ *   holds 'appd'. Otherwise, it stops at 'appd', unless 'appd' still lies in
+ *   the bytes of its lap which spilled over. The window then stops at the end
+ *   of the buffer, such that a read never needs more than two accesses.
+ *******************************************************************************/
+RxBufPtr windowEnd(RxSarEntry &entry) {
+    #pragma HLS INLINE
+    RxBufPtr winEnd = entry.appd;
+  #if TOE_BUF_POOL_CFG
+    winEnd(TOE_PAGE_BITS-1, 0) = 0;
+  #endif
+    if (entry.appd < entry.spillCur) {
+        winEnd = 0;
+    }
+    return winEnd;
+}
+
+/*******************************************************************************
+ * @brief Moves the 'appd' pointer of a session forward.
+ *
+ * @param[in/out] entry    The Rx SAR entry of the session.
+ * @param[in]     newAppd  The new value of 'appd'.
+ *
+ * @details
+ *  When 'appd' wraps around, the bytes of the next lap which spilled over
+ *   become those of the lap of 'appd'.
+ *******************************************************************************/
+void advanceAppd(RxSarEntry &entry, RxBufPtr newAppd) {
+    #pragma HLS INLINE
+    if (newAppd < entry.appd) {
+        entry.spillCur  = entry.spillNext;
+        entry.spillNext = 0;
+    }
+    entry.appd = newAppd;
+}
+
 /*******************************************************************************
  * @brief Rx SAR Table (RSt)
  *
@@ -82,25 +125,46 @@ using namespace hls;
  * @param[out] soRAi_RxSarRep  Reply to [RAi].
  * @param[in]  siTXe_RxSarReq  Read request from TxEngine (TXe).
  * @param[out] soTxe_RxSarRep  Read reply to [TXe].
+ * @param[out] soBPl_PageRel   Release of Rx buffer pages to BufferPool (BPl).
  *
  * @details
  *  This process stores the structures for managing the received data stream in
- *  the TCP Rx buffer memory. An Rx buffer of 64KB is allocated to every session
+ *  the TCP Rx buffer memory. An Rx buffer of 64KB (by default) is allocated to every session
  *  and the stream of bytes within every session is managed with two pointers:
  *   - 'rcvd' holds the sequence number of the last received and acknowledged
  *             byte from the network layer,
  *   - 'appd' holds a pointer to the next byte ready to be read (.i.e, consumed)
  *            by the application layer.
+ *   - 'dscd' holds a pointer to the next byte to be handed over to the
+ *            application with a read descriptor (i.e. zero-copy receive). It
+ *            lies between 'appd' and 'rcvd', and the bytes below it are only
+ *            released (i.e. 'appd' advances) when the application returns
+ *            the corresponding credits.
  *
- *            appd        rcvd           oooTail             oooHead
- *             |           |               |                   |
- *            \|/         \|/             \|/                 \|/
+ *            appd        rcvd       oooBlk[1]       oooBlk[0]    oooHead
+ *             |           |         left  right     left  right     |
+ *            \|/         \|/        \|/   \|/       \|/   \|/      \|/
  *     --+---+---+---+---+---+---+---+---+---+---+---+---+---+---+---+---+--
  *       |269|270|271|272|273|274|275|276|277|278|279|280|281|282|283|284|
  *     --+---+---+---+---+---+---+---+---+---+---+---+---+---+---+---+---+--
  *
+ *  The out-of-order blocks are merged and re-ordered by [RXe]; this process
+ *   only stores them.
  *  This process is concurrently accessed by the RxEngine (RXe), the TxEngine
  *   (TXe) and the RxApplicationInterface (RAi), but TXe access is read-only.
+ *  It also keeps the ECN Congestion Experienced mark of the last received
+ *   segment, which [TXe] echoes to the sender with the ECE flag, the shift
+ *   count that [TXe] applies to the window it advertises [RFC-7323], and
+ *   whether [TXe] may report the out-of-order blocks as SACK blocks [RFC-2018].
+ *  When the Rx buffers are backed by the buffer pool (TOE_BUF_POOL_CFG), the
+ *   pages which were credited back by the application and the pages of a
+ *   session which is (re)initialized are released to [BPl]. The window given
+ *   to [RXe] and [TXe] then ends at the beginning of the page holding 'appd',
+ *   because the rest of that page is still in use.
+ *  When the Rx buffers are followed by a spill region (TOE_SPILL_CFG), the
+ *   number of bytes which [RXe] wrote past the end of a buffer is kept for the
+ *   lap of 'appd' ('spillCur') and for the next one ('spillNext'), such that
+ *   [RAi] can locate these bytes in the spill region.
  *******************************************************************************/
 void rx_sar_table(
         stream<RXeRxSarQuery>      &siRXe_RxSarQry,
@@ -108,7 +172,8 @@ void rx_sar_table(
         stream<RAiRxSarQuery>      &siRAi_RxSarQry,
         stream<RAiRxSarReply>      &soRAi_RxSarRep,
         stream<SessionId>          &siTXe_RxSarReq,
-        stream<RxSarReply>         &soTxe_RxSarRep)
+        stream<RxSarReply>         &soTxe_RxSarRep,
+        stream<BufPageRel>         &soBPl_PageRel)
 {
     //-- DIRECTIVES FOR THIS PROCESS -------------------------------------------
     #pragma HLS PIPELINE II=1 enable_flush
@@ -117,7 +182,12 @@ void rx_sar_table(
 
     //-- STATIC ARRAYS ---------------------------------------------------------
     static RxSarEntry               RX_SAR_TABLE[TOE_MAX_SESSIONS];
-    #pragma HLS RESOURCE   variable=RX_SAR_TABLE core=RAM_2P
+  #if TOE_USE_URAM
+    #pragma HLS RESOURCE   variable=RX_SAR_TABLE core=XPM_MEMORY uram
+  #else
+    #pragma HLS RESOURCE   variable=RX_SAR_TABLE core=RAM_T2P_BRAM
+  #endif
+    #pragma HLS DATA_PACK  variable=RX_SAR_TABLE
     #pragma HLS DEPENDENCE variable=RX_SAR_TABLE inter false
 
     if(!siTXe_RxSarReq.empty()) {
@@ -126,11 +196,16 @@ void rx_sar_table(
         // [TXe] - Read only access
         //---------------------------------------
         siTXe_RxSarReq.read(sessId);
-        soTxe_RxSarRep.write(RxSarReply(RX_SAR_TABLE[sessId].appd,
-                                        RX_SAR_TABLE[sessId].rcvd,
-                                        RX_SAR_TABLE[sessId].ooo,
-                                        RX_SAR_TABLE[sessId].oooHead,
-                                        RX_SAR_TABLE[sessId].oooTail));
+        RxSarEntry entry = RX_SAR_TABLE[sessId];
+        soTxe_RxSarRep.write(RxSarReply(windowEnd(entry),
+                                        entry.rcvd,
+                                        entry.ooo,
+                                        entry.oooHead,
+                                        entry.oooCnt,
+                                        entry.oooBlk,
+                                        entry.ce,
+                                        entry.winScale,
+                                        entry.sackOk));
         if (DEBUG_LEVEL & TRACE_RST) {
             RxBufPtr free_space = ((RX_SAR_TABLE[sessId].appd -
                           (RxBufPtr)RX_SAR_TABLE[sessId].oooHead(TOE_WINDOW_BITS-1, 0)) - 1);
@@ -145,7 +220,33 @@ void rx_sar_table(
         //----------------------------------------------------------------
         siRAi_RxSarQry.read(raiQry);
         if(raiQry.write) {
-            RX_SAR_TABLE[raiQry.sessionID].appd = raiQry.appd;
+            // Read-modify-write the entire (packed) entry
+            RxSarEntry entry = RX_SAR_TABLE[raiQry.sessionID];
+            switch (raiQry.type) {
+            case RAI_QRY_DSCD:
+                entry.dscd  = raiQry.appd;
+                break;
+            case RAI_QRY_CRED:
+              #if TOE_BUF_POOL_CFG
+                {
+                    //-- Release the pages which were entirely credited back
+                    RxBufPtr   newAppd = entry.appd + raiQry.appd;
+                    BufPageCnt nrPages = (newAppd(TOE_WINDOW_BITS-1, TOE_PAGE_BITS) -
+                                          entry.appd(TOE_WINDOW_BITS-1, TOE_PAGE_BITS)) &
+                                         ((1 << (TOE_WINDOW_BITS-TOE_PAGE_BITS)) - 1);
+                    if (nrPages != 0) {
+                        soBPl_PageRel.write(BufPageRel(toBufPageNum(raiQry.sessionID, entry.appd), nrPages));
+                    }
+                }
+              #endif
+                advanceAppd(entry, entry.appd + raiQry.appd);
+                break;
+            default:
+                advanceAppd(entry, raiQry.appd);
+                entry.dscd  = raiQry.appd;
+                break;
+            }
+            RX_SAR_TABLE[raiQry.sessionID] = entry;
             if (DEBUG_LEVEL & TRACE_RST) {
                 RxBufPtr free_space = ((RX_SAR_TABLE[raiQry.sessionID].appd -
                               (RxBufPtr)RX_SAR_TABLE[raiQry.sessionID].oooHead(TOE_WINDOW_BITS-1, 0)) - 1);
@@ -154,8 +255,12 @@ void rx_sar_table(
             }
         }
         else {
+            RxSarEntry entry = RX_SAR_TABLE[raiQry.sessionID];
             soRAi_RxSarRep.write(RAiRxSarReply(raiQry.sessionID,
-                                               RX_SAR_TABLE[raiQry.sessionID].appd));
+                                               entry.appd,
+                                               entry.dscd,
+                                               entry.spillCur,
+                                               entry.spillNext));
             if (DEBUG_LEVEL & TRACE_RST) {
                 RxBufPtr free_space = ((RX_SAR_TABLE[raiQry.sessionID].appd -
                               (RxBufPtr)RX_SAR_TABLE[raiQry.sessionID].oooHead(TOE_WINDOW_BITS-1, 0)) - 1);
@@ -170,20 +275,42 @@ void rx_sar_table(
         // [RXe] - Write access
         //---------------------------------------
         if (rxeQry.write) {
-            RX_SAR_TABLE[rxeQry.sessionID].rcvd = rxeQry.rcvd;
+            // Read-modify-write the entire (packed) entry
+            RxSarEntry entry = RX_SAR_TABLE[rxeQry.sessionID];
+            entry.rcvd = rxeQry.rcvd;
+            entry.ce   = rxeQry.ce;
             if (rxeQry.init) {
-                RX_SAR_TABLE[rxeQry.sessionID].appd    = rxeQry.rcvd;
+              #if TOE_BUF_POOL_CFG
+                //-- Flush the pages left over by a previous session
+                soBPl_PageRel.write(BufPageRel(toBufPageNum(rxeQry.sessionID, 0),
+                                               (1 << (TOE_WINDOW_BITS-TOE_PAGE_BITS))));
+              #endif
+                entry.appd      = rxeQry.rcvd;
+                entry.dscd      = rxeQry.rcvd;
+                entry.spillCur  = 0;
+                entry.spillNext = 0;
+                entry.winScale  = rxeQry.winScale;
+                entry.sackOk    = rxeQry.sackOk;
+            }
+            else if (rxeQry.spill > entry.spillNext) {
+                //-- A segment was written past the end of the buffer
+                entry.spillNext = rxeQry.spill;
             }
             if (rxeQry.ooo) {
-                RX_SAR_TABLE[rxeQry.sessionID].ooo     = true;
-                RX_SAR_TABLE[rxeQry.sessionID].oooHead = rxeQry.oooHead;
-                RX_SAR_TABLE[rxeQry.sessionID].oooTail = rxeQry.oooTail;
+                entry.ooo     = true;
+                entry.oooHead = rxeQry.oooHead;
+                entry.oooCnt  = rxeQry.oooCnt;
+                for (int i=0; i<TOE_MAX_OOO_BLOCKS; i++) {
+                    #pragma HLS UNROLL
+                    entry.oooBlk[i] = rxeQry.oooBlk[i];
+                }
             }
             else {
-                RX_SAR_TABLE[rxeQry.sessionID].ooo     = false;
-                RX_SAR_TABLE[rxeQry.sessionID].oooHead = rxeQry.rcvd;
-                RX_SAR_TABLE[rxeQry.sessionID].oooTail = rxeQry.rcvd;
+                entry.ooo     = false;
+                entry.oooHead = rxeQry.rcvd;
+                entry.oooCnt  = 0;
             }
+            RX_SAR_TABLE[rxeQry.sessionID] = entry;
             if (DEBUG_LEVEL & TRACE_RST) {
                 RxBufPtr free_space = ((RX_SAR_TABLE[rxeQry.sessionID].appd -
                               (RxBufPtr)RX_SAR_TABLE[rxeQry.sessionID].oooHead(TOE_WINDOW_BITS-1, 0)) - 1);
@@ -193,11 +320,16 @@ void rx_sar_table(
         }
         else {
             // Read access from [RXe]
-            soRXe_RxSarRep.write(RxSarReply(RX_SAR_TABLE[rxeQry.sessionID].appd,
-                                            RX_SAR_TABLE[rxeQry.sessionID].rcvd,
-                                            RX_SAR_TABLE[rxeQry.sessionID].ooo,
-                                            RX_SAR_TABLE[rxeQry.sessionID].oooHead,
-                                            RX_SAR_TABLE[rxeQry.sessionID].oooTail));
+            RxSarEntry entry = RX_SAR_TABLE[rxeQry.sessionID];
+            soRXe_RxSarRep.write(RxSarReply(windowEnd(entry),
+                                            entry.rcvd,
+                                            entry.ooo,
+                                            entry.oooHead,
+                                            entry.oooCnt,
+                                            entry.oooBlk,
+                                            entry.ce,
+                                            entry.winScale,
+                                            entry.sackOk));
             if (DEBUG_LEVEL & TRACE_RST) {
                 RxBufPtr free_space = ((RX_SAR_TABLE[rxeQry.sessionID].appd -
                               (RxBufPtr)RX_SAR_TABLE[rxeQry.sessionID].oooHead(TOE_WINDOW_BITS-1, 0)) - 1);
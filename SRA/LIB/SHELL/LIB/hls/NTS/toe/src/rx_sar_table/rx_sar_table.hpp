@@ -63,7 +63,7 @@ using namespace hls;
 /*******************************************************************************
  * Rx SAR Table (RSt)
  *  Structure to manage the received data stream in the TCP Rx buffer memory.
- *  Every session is allocated with a static Rx buffer of 64KB to store the
+ *  Every session is allocated with a static Rx buffer of 64KB (by default) to store the
  *  stream of bytes received from the network layer, until the application layer
  *  consumes (.i.e read) them out. The Rx buffer is managed as a circular buffer
  *  with an insertion and an extraction pointer.
@@ -71,10 +71,12 @@ using namespace hls;
  *            byte from the network layer,
  *   - 'appd' holds a pointer to the next byte ready to be read (.i.e, consumed)
  *            by the application layer.
+ *  The bytes received above 'rcvd' are tracked as up to TOE_MAX_OOO_BLOCKS
+ *   disjoint blocks, which are also reported to the peer as SACK blocks.
  *
- *               appd        rcvd           oooTail             oooHead
- *                |           |               |                   |
- *               \|/         \|/             \|/                 \|/
+ *               appd        rcvd       oooBlk[1]       oooBlk[0]    oooHead
+ *                |           |         left  right     left  right     |
+ *               \|/         \|/        \|/   \|/       \|/   \|/      \|/
  *        --+---+---+---+---+---+---+---+---+---+---+---+---+---+---+---+---+--
  *          |269|270|271|272|273|274|275|276|277|278|279|280|281|282|283|284|
  *        --+---+---+---+---+---+---+---+---+---+---+---+---+---+---+---+---+--
@@ -83,10 +85,17 @@ using namespace hls;
 class RxSarEntry {
   public:
     RxBufPtr    appd;    // Bytes READ (.i.e consumed) by the application
+    RxBufPtr    dscd;    // Bytes handed over to the application with a descriptor
+    RxBufPtr    spillCur;  // Bytes of the lap of 'appd' held by the spill region
+    RxBufPtr    spillNext; // Bytes of the next lap held by the spill region
     RxSeqNum    rcvd;    // Bytes RCV'ed and ACK'ed (same as Receive Next)
     FlagBool    ooo;     // A flag indicator for out-of-order segments
-    RxSeqNum    oooHead; // Head of the out-of-order received bytes
-    RxSeqNum    oooTail; // Tail of the out-of-order received bytes
+    RxSeqNum    oooHead; // Right edge of the highest out-of-order block
+    OooCnt      oooCnt;  // Number of out-of-order blocks
+    OooBlock    oooBlk[TOE_MAX_OOO_BLOCKS]; // Out-of-order blocks (most recently updated first)
+    FlagBit     ce;      // Last received segment was marked Congestion Experienced
+    TcpOptWss   winScale; // Shift count applied to the window we advertise
+    FlagBool    sackOk;  // The peer accepts SACK options [RFC-2018]
     RxSarEntry() {}
 };
 
@@ -104,7 +113,9 @@ void rx_sar_table(
         stream<RAiRxSarReply>      &soRAi_RxSarRep,
         //-- Tx Engine Interfaces
         stream<SessionId>          &siTXe_RxSarReq,
-        stream<RxSarReply>         &soTxe_RxSarRep
+        stream<RxSarReply>         &soTxe_RxSarRep,
+        //-- Buffer Pool Interface
+        stream<BufPageRel>         &soBPl_PageRel
 );
 
 #endif
@@ -80,15 +80,23 @@ using namespace hls;
 /*******************************************************************************
  * @brief Session Id Manager (Sim)
  *
- * @param[in]  siUrs_FreeId   The session ID to recycle from the UpdateRequestSender (Urs).
- * @param[out] soLrh_FreeList The free list of session IDs to LookupReplyHandler (Lrh).
+ * @param[in]  siLrh_FreeIdReq Request for a free session ID from LookupReplyHandler (Lrh).
+ * @param[out] soLrh_FreeIdRep The free session ID to [Lrh].
+ * @param[in]  siUrs_FreeId    The session ID to recycle from the UpdateRequestSender (Urs).
  *
  * @details
- *  Implements the free list of session IDs as a FiFo stream.
+ *  Implements the free list of session IDs as a stack of the recycled IDs and
+ *   a counter of the IDs that were never used since the last reset. The list
+ *   is therefore ready right after a reset, and the most recently freed ID is
+ *   handed out first. This keeps the active sessions packed at the lower end
+ *   of the ID space instead of spreading them over the whole range.
+ *  A recycled ID is pushed before a pending request is served, such that it
+ *   can be reused right away.
  *******************************************************************************/
 void pSessionIdManager(
-        stream<RtlSessId>    &siUrs_FreeId,
-        stream<RtlSessId>    &soLrh_FreeList)
+        stream<ReqBit>       &siLrh_FreeIdReq,
+        stream<SLcFreeId>    &soLrh_FreeIdRep,
+        stream<RtlSessId>    &siUrs_FreeId)
 {
     //-- DIRECTIVES FOR THIS PROCESS -------------------------------------------
     #pragma HLS PIPELINE II=1 enable_flush
@@ -96,20 +104,41 @@ void pSessionIdManager(
 
     const char *myName  = concat3(THIS_NAME, "/", "Sim");
 
-    //-- STATIC CONTROL VARIABLES (with RESET) ---------------------------------
-    static RtlSessId           sim_counter=0;
-    #pragma HLS reset variable=sim_counter
+    //-- STATIC ARRAYS ---------------------------------------------------------
+    static RtlSessId           FREE_ID_STACK[TOE_MAX_SESSIONS];
 
-    if (sim_counter < TOE_MAX_SESSIONS) {
-        // Initialize the free list after a reset
-        soLrh_FreeList.write(sim_counter);
-        sim_counter++;
+    //-- STATIC CONTROL VARIABLES (with RESET) ---------------------------------
+    static ap_uint<log2Ceil<TOE_MAX_SESSIONS>::val+1> \
+                               sim_freshCnt=0;
+    #pragma HLS reset variable=sim_freshCnt
+    static ap_uint<log2Ceil<TOE_MAX_SESSIONS>::val+1> \
+                               sim_stackTop=0;
+    #pragma HLS reset variable=sim_stackTop
+
+    if (!siUrs_FreeId.empty()) {
+        // Push the recycled session ID onto the stack
+        FREE_ID_STACK[sim_stackTop] = siUrs_FreeId.read();
+        sim_stackTop++;
     }
-    else if (!siUrs_FreeId.empty()) {
-        // Recycle the incoming session ID
-        RtlSessId rtlSessId;
-        siUrs_FreeId.read(rtlSessId);
-        soLrh_FreeList.write(rtlSessId);
+    else if (!siLrh_FreeIdReq.empty() and !soLrh_FreeIdRep.full()) {
+        siLrh_FreeIdReq.read();
+        if (sim_stackTop != 0) {
+            // Pop the most recently recycled session ID
+            sim_stackTop--;
+            soLrh_FreeIdRep.write(SLcFreeId(FREE_ID_STACK[sim_stackTop], true));
+        }
+        else if (sim_freshCnt < TOE_MAX_SESSIONS) {
+            // Hand out a session ID which was not used since the last reset
+            soLrh_FreeIdRep.write(SLcFreeId(sim_freshCnt, true));
+            sim_freshCnt++;
+        }
+        else {
+            // All the session IDs are in use
+            soLrh_FreeIdRep.write(SLcFreeId(0, false));
+            if (DEBUG_LEVEL & TRACE_SIM) {
+                printWarn(myName, "All the session IDs are in use.\n");
+            }
+        }
     }
 }
 
@@ -123,8 +152,10 @@ void pSessionIdManager(
  * @param[out] soRXe_SessLookupRep Reply from CAM to RXe.
  * @param[in]  siTAi_SessLookupReq Request from Tx App. I/F (TAi).
  * @param[out] soTAi_SessLookupRep Reply from CAM to TAi.
- * @param[in]  siSim_FreeList      Free liste from Session Id Manager (Sid).
+ * @param[out] soSim_FreeIdReq     Request for a free session ID to Session Id Manager (Sim).
+ * @param[in]  siSim_FreeIdRep     Free session ID from [Sim].
  * @param[out] soUrs_InsertSessReq Request to insert session to Update Request Sender (Urs).
+ * @param[out] soUrs_ReleaseIdReq  Request to release the ID of a failed insert to [Urs].
  * @param[out] soRlt_ReverseLkpRsp Reverse lookup response to Reverse Lookup Table (Rlt).
  *
  * @details
@@ -133,8 +164,11 @@ void pSessionIdManager(
  *    and [TAi]. The process prioritizes [TAi] over [RXe] when forwarding the
  *    lookup request to the ternary content addressable memory.
  *  If there was no hit and the request is allowed to create a new session
- *   entry in the CAM, such a new entry is created. Otherwise, the session ID
+ *   entry in the CAM, such a new entry is created with a session ID requested
+ *   from the SessionIdManager (Sim). Otherwise, the session ID
  *   corresponding to the matching lookup is sent back to lookup requester.
+ *  If the CAM fails to insert the new entry (e.g. because it is full), the
+ *   requester gets a miss and the session ID is released via [Urs].
  *  [TODO-FIXME - This process does not yet handle the deletion of a session].
  *******************************************************************************/
 void pLookupReplyHandler(
@@ -145,8 +179,10 @@ void pLookupReplyHandler(
         stream<SessionLookupReply>          &soRXe_SessLookupRep,
         stream<SocketPair>                  &siTAi_SessLookupReq,
         stream<SessionLookupReply>          &soTAi_SessLookupRep,
-        stream<RtlSessId>                   &siSim_FreeList,
+        stream<ReqBit>                      &soSim_FreeIdReq,
+        stream<SLcFreeId>                   &siSim_FreeIdRep,
         stream<CamSessionUpdateRequest>     &soUrs_InsertSessReq,
+        stream<RtlSessId>                   &soUrs_ReleaseIdReq,
         stream<SLcReverseLkp>               &soRlt_ReverseLkpRsp)
 {
     //-- DIRECTIVES FOR THIS PROCESS -------------------------------------------
@@ -163,10 +199,15 @@ void pLookupReplyHandler(
     #pragma HLS STREAM               variable=ssLookupPipe depth=8
 
     //-- STATIC CONTROL VARIABLES (with RESET) ---------------------------------
-    static enum FsmStates { WAIT_FOR_SESS_LKP_REQ=0, WAIT_FOR_CAM_LKP_REP, WAIT_FOR_CAM_UPD_REP } \
+    static enum FsmStates { WAIT_FOR_SESS_LKP_REQ=0, WAIT_FOR_CAM_LKP_REP, WAIT_FOR_FREE_ID,
+                            WAIT_FOR_CAM_UPD_REP } \
                                  lrh_fsmState=WAIT_FOR_SESS_LKP_REQ;
     #pragma HLS RESET	variable=lrh_fsmState
 
+    //-- STATIC DATAFLOW VARIABLES ---------------------------------------------
+    static CamSessionLookupReply lrh_lupReply;
+    static SLcFourTuple          lrh_tuple;
+
     switch (lrh_fsmState) {
     case WAIT_FOR_SESS_LKP_REQ:
         if (!siTAi_SessLookupReq.empty()) {
@@ -197,12 +238,12 @@ void pLookupReplyHandler(
         if(!siCAM_SessLookupRep.empty() && !ssLookupPipe.empty()) {
             CamSessionLookupReply lupReply = siCAM_SessLookupRep.read();
             SLcQuery              slcQuery = ssLookupPipe.read();
-            if (!lupReply.hit && slcQuery.allowCreation && !siSim_FreeList.empty()) {
-                RtlSessId freeID = siSim_FreeList.read();
-                // Request to insert a new session into the CAM
-                soUrs_InsertSessReq.write(CamSessionUpdateRequest(slcQuery.tuple, freeID, INSERT, lupReply.source));
-                ssInsertPipe.write(slcQuery.tuple);
-                lrh_fsmState = WAIT_FOR_CAM_UPD_REP;
+            if (!lupReply.hit && slcQuery.allowCreation) {
+                // Request a free session ID for the new session
+                soSim_FreeIdReq.write(1);
+                lrh_lupReply = lupReply;
+                lrh_tuple    = slcQuery.tuple;
+                lrh_fsmState = WAIT_FOR_FREE_ID;
             }
             else {
                 // We have a HIT
@@ -216,17 +257,49 @@ void pLookupReplyHandler(
             }
         }
         break;
+    case WAIT_FOR_FREE_ID:
+        if (!siSim_FreeIdRep.empty()) {
+            SLcFreeId freeId = siSim_FreeIdRep.read();
+            if (freeId.valid) {
+                // Request to insert a new session into the CAM
+                soUrs_InsertSessReq.write(CamSessionUpdateRequest(lrh_tuple, freeId.sessId, INSERT, lrh_lupReply.source));
+                ssInsertPipe.write(lrh_tuple);
+                lrh_fsmState = WAIT_FOR_CAM_UPD_REP;
+            }
+            else {
+                // No session ID left. Forward the miss to the requester
+                if (lrh_lupReply.source == FROM_RXe) {
+                    soRXe_SessLookupRep.write(SessionLookupReply(lrh_lupReply.sessionID, false));
+                }
+                else {
+                    soTAi_SessLookupRep.write(SessionLookupReply(lrh_lupReply.sessionID, false));
+                }
+                lrh_fsmState = WAIT_FOR_SESS_LKP_REQ;
+            }
+        }
+        break;
     case WAIT_FOR_CAM_UPD_REP:
         if (!siUrh_SessUpdateRsp.empty() && !ssInsertPipe.empty()) {
             CamSessionUpdateReply insertReply = siUrh_SessUpdateRsp.read();
             SLcFourTuple tuple = ssInsertPipe.read();
+            bool         inserted = (insertReply.status == STS_OK);
             if (insertReply.source == FROM_RXe) {
-                soRXe_SessLookupRep.write(SessionLookupReply(insertReply.sessionID, true));
+                soRXe_SessLookupRep.write(SessionLookupReply(insertReply.sessionID, inserted));
             }
             else {
-                soTAi_SessLookupRep.write(SessionLookupReply(insertReply.sessionID, true));
+                soTAi_SessLookupRep.write(SessionLookupReply(insertReply.sessionID, inserted));
+            }
+            if (inserted) {
+                soRlt_ReverseLkpRsp.write(SLcReverseLkp(insertReply.sessionID, tuple));
+            }
+            else {
+                // The CAM is full. Give the session ID back to [Sim]
+                soUrs_ReleaseIdReq.write(insertReply.sessionID);
+                if (DEBUG_LEVEL & TRACE_LRH) {
+                    printWarn(myName, "Failed to insert session #%d into [CAM].\n",
+                              insertReply.sessionID.to_int());
+                }
             }
-            soRlt_ReverseLkpRsp.write(SLcReverseLkp(insertReply.sessionID, tuple));
             lrh_fsmState = WAIT_FOR_SESS_LKP_REQ;
         }
         break;
@@ -238,25 +311,31 @@ void pLookupReplyHandler(
  *
  * @param[in]  siLrh_InsertSessReq Request to insert session from LookupReplyHandler (Lrh).
  * @param[in]  siRlt_SessDeleteReq Request to delete session from Reverse Lookup Table (Rlt).
+ * @param[in]  siLrh_ReleaseIdReq  Request to release the ID of a failed insert from [Lrh].
  * @param[out] soCAM_SessUpdateReq Update request to [CAM].
  * @param[out] soSim_FreeId        The SessId to recycle to the [SessionIdManager].
  * @param[out] soSssRelCnt         Session release count to DEBUG.
- * @param[out] soSssRegCnt         Session register count to DEBUG.
+ * @param[out] soSssRegCnt         Session counts to DEBUG {peak(31:16), live(15:0)}.
  *
  * @details
  *  This process sends the insertion or deletion requests to the ternary content
  *   addressable memory (TCAM or CAM for short).
  *  If a session deletion is requested, the corresponding sessionId is collected
  *   from the request and is forwarded to the SessionIdManager for re-cycling.
+ *  The same applies to the sessionId of an insertion which failed in the CAM,
+ *   except that no request is sent to the CAM.
+ *  It also maintains the number of live sessions (i.e. inserted but not yet
+ *   deleted) and the highest number of live sessions since the last reset.
  *
  *******************************************************************************/
 void pUpdateRequestSender(
         stream<CamSessionUpdateRequest>     &siLrh_InsertSessReq,
         stream<CamSessionUpdateRequest>     &siRlt_SessDeleteReq,
+        stream<RtlSessId>                   &siLrh_ReleaseIdReq,
         stream<CamSessionUpdateRequest>     &soCAM_SessUpdateReq,
         stream<RtlSessId>                   &soSim_FreeId,
         stream<ap_uint<16> >                &soSssRelCnt,
-        stream<ap_uint<16> >                &soSssRegCnt)
+        stream<ap_uint<32> >                &soSssRegCnt)
 {
     //-- DIRECTIVES FOR THIS PROCESS -------------------------------------------
     #pragma HLS PIPELINE II=1 enable_flush
@@ -265,25 +344,35 @@ void pUpdateRequestSender(
     const char *myName  = concat3(THIS_NAME, "/", "Urs");
 
     //-- STATIC CONTROL VARIABLES (with RESET) ---------------------------------
-    static ap_uint<16>         urs_insertedSessions=0;
-    #pragma HLS RESET variable=urs_insertedSessions
+    static ap_uint<16>         urs_liveSessions=0;
+    #pragma HLS RESET variable=urs_liveSessions
+    static ap_uint<16>         urs_peakSessions=0;
+    #pragma HLS RESET variable=urs_peakSessions
     static ap_uint<16>         urs_releasedSessions=0;
     #pragma HLS RESET variable=urs_releasedSessions
 
     if (!siLrh_InsertSessReq.empty()) {
         soCAM_SessUpdateReq.write(siLrh_InsertSessReq.read());
-        urs_insertedSessions++;
+        urs_liveSessions++;
+        if (urs_liveSessions > urs_peakSessions) {
+            urs_peakSessions = urs_liveSessions;
+        }
     }
     else if (!siRlt_SessDeleteReq.empty()) {
         CamSessionUpdateRequest request;
         siRlt_SessDeleteReq.read(request);
         soCAM_SessUpdateReq.write(request);
         soSim_FreeId.write(request.value);
+        urs_liveSessions--;
         urs_releasedSessions++;
     }
+    else if (!siLrh_ReleaseIdReq.empty()) {
+        soSim_FreeId.write(siLrh_ReleaseIdReq.read());
+        urs_liveSessions--;
+    }
     // Always
     if (!soSssRegCnt.full()) {
-        soSssRegCnt.write(urs_insertedSessions);
+        soSssRegCnt.write((urs_peakSessions, urs_liveSessions));
     }
     if (!soSssRelCnt.full()) {
         soSssRelCnt.write(urs_releasedSessions);
@@ -318,6 +407,7 @@ void pUpdateReplyHandler(
 /*******************************************************************************
  * @brief Reverse Lookup Table (Rlt)
  *
+ *  @param[out] poTOE_Ready          The ready signal of this process to [TOE].
  *  @param[in]  sLrh_ReverseLkpRsp   Reverse lookup response from LookupReplyHandler (Lrh).
  *  @param[in]  siSTt_SessReleaseCmd Session release command from StateTable (STt).
  *  @param[in[  siTXe_ReverseLkpReq  Reverse lookup request from TxEngine (TXe).
@@ -330,8 +420,13 @@ void pUpdateReplyHandler(
  *   address indexed by the 'SessionId' of that 4-tuple. This table is used
  *   to retrieve the 4-tuple information corresponding to a SessionId upon
  *   request from [TXe].
+ *  The TUPLE_VALID_TABLE is cleared one entry per clock cycle after a reset,
+ *   and the process is not ready before the whole table is cleared.
+ *  When a session is released, its local port is returned to the PortTable
+ *   (PRt) if it is an active (i.e. ephemeral) port.
  *******************************************************************************/
 void pReverseLookupTable(
+        StsBool                 &poTOE_Ready,
         stream<SLcReverseLkp>   &siLrh_ReverseLkpRsp,
         stream<SessionId>       &siSTt_SessReleaseCmd,
         stream<SessionId>       &siTXe_ReverseLkpReq,
@@ -347,9 +442,15 @@ void pReverseLookupTable(
 
     //-- STATIC ARRAYS --------------------------------------------------------
     static SLcFourTuple             REVERSE_LOOKUP_TABLE[TOE_MAX_SESSIONS];
+  #if TOE_USE_URAM
+    #pragma HLS RESOURCE   variable=REVERSE_LOOKUP_TABLE core=XPM_MEMORY uram
+  #else
     #pragma HLS RESOURCE   variable=REVERSE_LOOKUP_TABLE core=RAM_T2P_BRAM
+  #endif
+    #pragma HLS DATA_PACK  variable=REVERSE_LOOKUP_TABLE
     #pragma HLS DEPENDENCE variable=REVERSE_LOOKUP_TABLE inter false
     static ValBool                  TUPLE_VALID_TABLE[TOE_MAX_SESSIONS];
+    #pragma HLS RESOURCE   variable=TUPLE_VALID_TABLE core=RAM_T2P_BRAM
     #pragma HLS DEPENDENCE variable=TUPLE_VALID_TABLE inter false
 
     //-- STATIC CONTROL VARIABLES (with RESET) --------------------------------
@@ -361,11 +462,11 @@ void pReverseLookupTable(
     if (!rlt_isInit) {
         // The two tables must be cleared upon reset
         TUPLE_VALID_TABLE[rlt_counter] = false;
-        if (rlt_counter < TOE_MAX_SESSIONS) {
-            rlt_counter++;
+        if (rlt_counter == TOE_MAX_SESSIONS-1) {
+            rlt_isInit = true;
         }
         else {
-            rlt_isInit = true;
+            rlt_counter++;
         }
     }
     else {
@@ -381,7 +482,11 @@ void pReverseLookupTable(
             SessionId sessionId = siSTt_SessReleaseCmd.read();
             SLcFourTuple releaseTuple = REVERSE_LOOKUP_TABLE[sessionId];
             if (TUPLE_VALID_TABLE[sessionId]) { // if valid
-                soPRt_ClosePortCmd.write(releaseTuple.myPort);
+                // Only an active port gets freed (a listening port remains open)
+                TcpPort myPort = byteSwap16(releaseTuple.myPort);
+                if (myPort.bit(15) == 1) {
+                    soPRt_ClosePortCmd.write(myPort);
+                }
                 soUrs_SessDeleteReq.write(CamSessionUpdateRequest(releaseTuple, sessionId, DELETE, FROM_RXe));
             }
             TUPLE_VALID_TABLE[sessionId] = false;
@@ -389,18 +494,19 @@ void pReverseLookupTable(
         else if (!siTXe_ReverseLkpReq.empty()) {
             // Return 4-tuple corresponding to a given session Id
             SessionId sessionId = siTXe_ReverseLkpReq.read();
-            soTXe_ReverseLkpRep.write(fourTuple(
-                    REVERSE_LOOKUP_TABLE[sessionId].myIp,
-                    REVERSE_LOOKUP_TABLE[sessionId].theirIp,
-                    REVERSE_LOOKUP_TABLE[sessionId].myPort,
-                    REVERSE_LOOKUP_TABLE[sessionId].theirPort));
+            SLcFourTuple tuple = REVERSE_LOOKUP_TABLE[sessionId];
+            soTXe_ReverseLkpRep.write(fourTuple(tuple.myIp, tuple.theirIp,
+                                                tuple.myPort, tuple.theirPort));
         }
     }
+    //-- ALWAYS
+    poTOE_Ready = rlt_isInit;
 }
 
 /*****************************************************************************
  * @brief Session Lookup Controller (SLc)
  *
+ * @param[out] poTOE_Ready          The ready signal of this process to [TOE].
  * @param[in]  siRXe_SessLookupReq  Session lookup request from Rx Engine (RXe).
  * @param[out] soRXe_SessLookupRep  Session lookup reply to [RXe].
  * @param[in]  siSTt_SessReleaseCmd Session release command from State Table (STt).
@@ -414,7 +520,7 @@ void pReverseLookupTable(
  * @param[out] soCAM_SessUpdateReq  Update request to [CAM].
  * @param[in]  siCAM_SessUpdateRep  Update reply from [CAM].
  * @param[out] soSssRelCnt          Session release count.
- * @param[out] soSssRegCnt          Session register count.
+ * @param[out] soSssRegCnt          Session counts {peak(31:16), live(15:0)}.
  *
  * @details
  *  The SLc maps a four-tuple information {{IP4_SA,TCP_SA},{IP4_DA,TCP_DP}} of
@@ -428,6 +534,7 @@ void pReverseLookupTable(
  *
  *****************************************************************************/
 void session_lookup_controller(
+        StsBool                            &poTOE_Ready,
         stream<SessionLookupQuery>         &siRXe_SessLookupReq,
         stream<SessionLookupReply>         &soRXe_SessLookupRep,
         stream<SessionId>                  &siSTt_SessReleaseCmd,
@@ -441,7 +548,7 @@ void session_lookup_controller(
         stream<CamSessionUpdateRequest>    &soCAM_SessUpdateReq,
         stream<CamSessionUpdateReply>      &siCAM_SessUpdateRep,
         stream<ap_uint<16> >               &soSssRelCnt,
-        stream<ap_uint<16> >               &soSssRegCnt)
+        stream<ap_uint<32> >               &soSssRegCnt)
 {
     //-- DIRECTIVES FOR THIS PROCESS -------------------------------------------
     #pragma HLS INLINE
@@ -452,16 +559,22 @@ void session_lookup_controller(
     //--------------------------------------------------------------------------
 
     // Session Id Manager (Sim) ------------------------------------------------
-    static stream<RtlSessId>               ssSimToLrh_FreeList      ("ssSimToLrh_FreeList");
-    #pragma HLS stream            variable=ssSimToLrh_FreeList      depth=16384  // 0x4000 [FIXME - Can we replace 16384 with MAX_SESSIONS]
+    static stream<SLcFreeId>               ssSimToLrh_FreeIdRep     ("ssSimToLrh_FreeIdRep");
+    #pragma HLS stream            variable=ssSimToLrh_FreeIdRep     depth=2
 
     // Lookup Reply Handler (Lrh) ----------------------------------------------
+    static stream<ReqBit>                  ssLrhToSim_FreeIdReq     ("ssLrhToSim_FreeIdReq");
+    #pragma HLS stream            variable=ssLrhToSim_FreeIdReq     depth=2
+
     static stream<RtlSessId>               ssUrsToSim_FreeId        ("ssUrsToSim_FreeId");
     #pragma HLS stream            variable=ssUrsToSim_FreeId        depth=2
 
     static stream<CamSessionUpdateRequest> ssLrhToUrs_InsertSessReq ("ssLrhToUrs_InsertSessReq");
     #pragma HLS STREAM            variable=ssLrhToUrs_InsertSessReq depth=4
 
+    static stream<RtlSessId>               ssLrhToUrs_ReleaseIdReq  ("ssLrhToUrs_ReleaseIdReq");
+    #pragma HLS STREAM            variable=ssLrhToUrs_ReleaseIdReq  depth=2
+
     static stream<SLcReverseLkp>           ssLrhToRlt_ReverseLkpRsp ("ssLrhToRlt_ReverseLkpRsp");
     #pragma HLS STREAM            variable=ssLrhToRlt_ReverseLkpRsp depth=4
 
@@ -478,8 +591,9 @@ void session_lookup_controller(
     //--------------------------------------------------------------------------
 
     pSessionIdManager(
-            ssUrsToSim_FreeId,
-            ssSimToLrh_FreeList);
+            ssLrhToSim_FreeIdReq,
+            ssSimToLrh_FreeIdRep,
+            ssUrsToSim_FreeId);
 
     pLookupReplyHandler(
             soCAM_SessLookupReq,
@@ -489,13 +603,16 @@ void session_lookup_controller(
             soRXe_SessLookupRep,
             siTAi_SessLookupReq,
             soTAi_SessLookupRep,
-            ssSimToLrh_FreeList,
+            ssLrhToSim_FreeIdReq,
+            ssSimToLrh_FreeIdRep,
             ssLrhToUrs_InsertSessReq,
+            ssLrhToUrs_ReleaseIdReq,
             ssLrhToRlt_ReverseLkpRsp);
 
     pUpdateRequestSender(
             ssLrhToUrs_InsertSessReq,
             ssRltToUrs_SessDeleteReq,
+            ssLrhToUrs_ReleaseIdReq,
             soCAM_SessUpdateReq,
             ssUrsToSim_FreeId,
             soSssRelCnt,
@@ -506,6 +623,7 @@ void session_lookup_controller(
             ssUrhToLrh_SessUpdateRsp);
 
     pReverseLookupTable(
+            poTOE_Ready,
             ssLrhToRlt_ReverseLkpRsp,
             siSTt_SessReleaseCmd,
             siTXe_ReverseLkpReq,
@@ -96,6 +96,19 @@ class SLcReverseLkp
         key(key), value(value) {}
 };
 
+//=========================================================
+//== SLc - Free Session ID
+//=========================================================
+class SLcFreeId
+{
+  public:
+    RtlSessId           sessId;
+    bool                valid;  // False when all the session IDs are in use
+    SLcFreeId() {}
+    SLcFreeId(RtlSessId sessId, bool valid) :
+        sessId(sessId), valid(valid) {}
+};
+
 
 /*******************************************************************************
  *
@@ -103,6 +116,7 @@ class SLcReverseLkp
  *
  *******************************************************************************/
 void session_lookup_controller(
+        StsBool                            &poTOE_Ready,
         stream<SessionLookupQuery>         &siRXe_SessLookupReq,
         stream<SessionLookupReply>         &soRXe_SessLookupRep,
         stream<SessionId>                  &siSTt_SessReleaseCmd,
@@ -116,7 +130,7 @@ void session_lookup_controller(
         stream<CamSessionUpdateRequest>    &soCAM_SessUpdateReq,
         stream<CamSessionUpdateReply>      &siCAM_SessUpdateRep,
         stream<ap_uint<16> >               &soSssRelCnt,
-        stream<ap_uint<16> >               &soSssRegCnt
+        stream<ap_uint<32> >               &soSssRegCnt
 );
 
 #endif
@@ -140,6 +140,7 @@ int main()
     //stream<sessionLookupQueryInternal> lookups("lookups");
 
     ap_uint<16> regSessionCount;
+    StsBool     sSLcReady;
 
     int count = 0;
     fourTuple tuple;
@@ -171,6 +172,7 @@ int main()
             txApp2sLookup_req.write(tuple);
         }
         session_lookup_controller(  //lookups,
+                                    sSLcReady,
                                     rxEng2sLookup_req,
                                     sLookup2rxEng_rsp,
                                     stateTable2sLookup_releaseSession,
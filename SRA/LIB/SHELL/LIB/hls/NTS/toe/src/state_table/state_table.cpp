@@ -112,7 +112,11 @@ void state_table(
 
     //-- STATIC ARRAYS ---------------------------------------------------------
     static TcpState                 SESS_STATE_TABLE[TOE_MAX_SESSIONS];
+  #if TOE_USE_URAM
+    #pragma HLS RESOURCE   variable=SESS_STATE_TABLE core=XPM_MEMORY uram
+  #else
     #pragma HLS RESOURCE   variable=SESS_STATE_TABLE core=RAM_2P_BRAM
+  #endif
     #pragma HLS DEPENDENCE variable=SESS_STATE_TABLE inter false
 
     //-- STATIC CONTROL VARIABLES (with RESET) ---------------------------------
@@ -102,6 +102,293 @@ template<typename T> void pStreamMux(
         so.write(si2.read());
 }
 
+/*******************************************************************************
+ * @brief Returns true if tick 'a' comes before tick 'b' (wrap-around safe).
+ *******************************************************************************/
+bool tickIsBefore(
+        TimerTick   a,
+        TimerTick   b)
+{
+    #pragma HLS INLINE
+    ap_int<32> delta = a - b;
+    return (delta < 0);
+}
+
+/*******************************************************************************
+ * @brief Advances the time base of a timing wheel.
+ *
+ *  @param[in,out] cycCnt   A counter of clock cycles.
+ *  @param[in,out] nowTick  The current tick of the wheel.
+ *
+ * @details
+ *  The current tick is incremented every 'TOE_TIMER_TICK' clock cycles.
+ *******************************************************************************/
+void wheelClock(
+        ap_uint<32>  &cycCnt,
+        TimerTick    &nowTick)
+{
+    #pragma HLS INLINE
+    if (cycCnt == TOE_TIMER_TICK-1) {
+        cycCnt = 0;
+        nowTick++;
+    }
+    else {
+        cycCnt++;
+    }
+}
+
+/*******************************************************************************
+ * @brief Computes the slot of the wheel where a timer must be linked.
+ *
+ *  @param[in] expiry   The tick at which the timer expires.
+ *  @param[in] procTick The tick currently processed by the wheel.
+ *
+ * @return the placement of the timer (i.e. level, slot and due tick).
+ *
+ * @details
+ *  A timer expiring within the next 'cWheelL0Slots' ticks goes into level-0
+ *   and gets visited exactly at its expiry tick. Any other timer goes into the
+ *   level-1 slot of the wheel rotation which contains its expiry tick. A timer
+ *   expiring beyond the last rotation of level-1 is parked into that slot.
+ *******************************************************************************/
+WheelPlace wheelPlace(
+        TimerTick   expiry,
+        TimerTick   procTick)
+{
+    #pragma HLS INLINE
+    WheelPlace  place;
+    ap_int<32>  delta = expiry - procTick;
+
+    if (delta < cWheelL0Slots) {
+        place.isL1 = false;
+        place.due  = (delta > 0) ? expiry : procTick;
+    }
+    else {
+        TimerTick currRot = procTick >> cWheelL0Bits;
+        TimerTick nodeRot = expiry   >> cWheelL0Bits;
+        if ((TimerTick)(nodeRot - currRot) >= cWheelL1Slots) {
+            nodeRot = currRot + cWheelL1Slots - 1;
+        }
+        place.isL1 = true;
+        place.due  = nodeRot << cWheelL0Bits;
+    }
+    place.l0Slot = place.due(cWheelL0Bits-1, 0);
+    place.l1Slot = place.due(cWheelL0Bits+cWheelL1Bits-1, cWheelL0Bits);
+    return place;
+}
+
+/*******************************************************************************
+ * @brief Links a node at the head of a slot list of the wheel.
+ *
+ *  @param[in,out] WHEEL_L0   The list heads of the level-0 slots.
+ *  @param[in,out] WHEEL_L1   The list heads of the level-1 slots.
+ *  @param[out]    WHEEL_NEXT The list links of the nodes.
+ *  @param[in]     node       The node to link.
+ *  @param[in]     place      The placement of the node.
+ *******************************************************************************/
+void wheelLink(
+        WheelPtr     WHEEL_L0[cWheelL0Slots],
+        WheelPtr     WHEEL_L1[cWheelL1Slots],
+        WheelPtr     WHEEL_NEXT[cWheelNodes],
+        WheelNodeId  node,
+        WheelPlace   place)
+{
+    #pragma HLS INLINE
+    WheelPtr ptr = node;
+    ptr[cWheelNodeBits] = 1;
+    if (place.isL1) {
+        WHEEL_NEXT[node] = WHEEL_L1[place.l1Slot];
+        WHEEL_L1[place.l1Slot] = ptr;
+    }
+    else {
+        WHEEL_NEXT[node] = WHEEL_L0[place.l0Slot];
+        WHEEL_L0[place.l0Slot] = ptr;
+    }
+}
+
+/*******************************************************************************
+ * @brief Arms (or re-arms) the wheel timer of a session.
+ *
+ *  @param[in,out] wt       The wheel timer of the session.
+ *  @param[in]     sessId   The session identifier.
+ *  @param[in]     expiry   The tick at which the timer must expire.
+ *  @param[in]     procTick The tick currently processed by the wheel.
+ *  @param[out]    linkNode The node to link into the wheel (if any).
+ *  @param[out]    place    The placement of the node to link.
+ *
+ * @return true if 'linkNode' must be linked into the wheel.
+ *
+ * @details
+ *  If the current node is already linked into a slot which is visited before
+ *   the new expiry, the timer is updated in place and the node is lazily moved
+ *   when visited. Otherwise, the other node of the session is linked instead.
+ *   If both nodes are already linked, the one visited first is selected.
+ *******************************************************************************/
+bool wheelArm(
+        WheelTimer  &wt,
+        SessionId    sessId,
+        TimerTick    expiry,
+        TimerTick    procTick,
+        WheelNodeId &linkNode,
+        WheelPlace  &place)
+{
+    #pragma HLS INLINE
+    ap_uint<1> currNode = wt.node;
+    ap_uint<1> othrNode = ~wt.node;
+    TimerTick  currDue  = (currNode == 0) ? wt.due0 : wt.due1;
+    TimerTick  othrDue  = (othrNode == 0) ? wt.due0 : wt.due1;
+    ap_uint<1> selNode  = currNode;
+    bool       doLink   = false;
+
+    wt.expiry = expiry;
+    wt.active = true;
+    if (wt.linked[currNode] == 0) {
+        doLink  = true;
+    }
+    else if (not tickIsBefore(expiry, currDue)) {
+        // Current node gets visited before expiry. Nothing to do.
+    }
+    else if (wt.linked[othrNode] == 0) {
+        selNode = othrNode;
+        doLink  = true;
+    }
+    else if ((not tickIsBefore(expiry, othrDue)) or tickIsBefore(othrDue, currDue)) {
+        selNode = othrNode;
+    }
+    wt.node = selNode;
+
+    if (doLink) {
+        place = wheelPlace(expiry, procTick);
+        wt.linked[selNode] = 1;
+        if (selNode == 0) {
+            wt.due0 = place.due;
+        }
+        else {
+            wt.due1 = place.due;
+        }
+        linkNode = sessId;
+        linkNode = (linkNode << 1) | selNode;
+    }
+    return doLink;
+}
+
+/*******************************************************************************
+ * @brief Processes a node popped from the wheel.
+ *
+ *  @param[in,out] wt        The wheel timer of the session owning the node.
+ *  @param[in]     nodeBit   The node of the session which was popped.
+ *  @param[in]     procTick  The tick currently processed by the wheel.
+ *  @param[in]     isCascade Tells if the node was popped from level-1.
+ *  @param[out]    place     The placement of the node to re-link.
+ *
+ * @return the action to perform (i.e. DROP, FIRE or RELINK).
+ *******************************************************************************/
+WheelAction wheelVisit(
+        WheelTimer  &wt,
+        ap_uint<1>   nodeBit,
+        TimerTick    procTick,
+        bool         isCascade,
+        WheelPlace  &place)
+{
+    #pragma HLS INLINE
+    wt.linked[nodeBit] = 0;
+    if ((nodeBit != wt.node) or (not wt.active)) {
+        // Stale node or stopped timer
+        return WHEEL_DROP;
+    }
+    if ((not isCascade) and (not tickIsBefore(procTick, wt.expiry))) {
+        wt.active = false;
+        return WHEEL_FIRE;
+    }
+    place = wheelPlace(wt.expiry, procTick);
+    wt.linked[nodeBit] = 1;
+    if (nodeBit == 0) {
+        wt.due0 = place.due;
+    }
+    else {
+        wt.due1 = place.due;
+    }
+    return WHEEL_RELINK;
+}
+
+/*******************************************************************************
+ * @brief Walks the slots of the wheel.
+ *
+ *  @param[in,out] fsmState  The state of the wheel walker.
+ *  @param[in,out] procTick  The tick currently processed by the wheel.
+ *  @param[in]     nowTick   The current tick.
+ *  @param[in,out] cursor    The next node of the slot list being walked.
+ *  @param[in,out] WHEEL_L0  The list heads of the level-0 slots.
+ *  @param[in,out] WHEEL_L1  The list heads of the level-1 slots.
+ *  @param[in]     WHEEL_NEXT The list links of the nodes.
+ *  @param[in]     canPop    Tells if the caller can accept a node.
+ *  @param[out]    node      The node popped from the wheel.
+ *
+ * @return true if a node was popped and must be visited by the caller.
+ *
+ * @details
+ *  Every tick, the walker detaches the list of the current slot and pops its
+ *   nodes one per clock cycle. When level-0 wraps around, the current level-1
+ *   slot is cascaded first. Only the sessions linked in the current slot are
+ *   visited, whatever the number of sessions. If the walker gets behind the
+ *   current tick, it catches up one tick after the other.
+ *******************************************************************************/
+bool wheelWalk(
+        WheelFsmState &fsmState,
+        TimerTick     &procTick,
+        TimerTick      nowTick,
+        WheelPtr      &cursor,
+        WheelPtr       WHEEL_L0[cWheelL0Slots],
+        WheelPtr       WHEEL_L1[cWheelL1Slots],
+        WheelPtr       WHEEL_NEXT[cWheelNodes],
+        bool           canPop,
+        WheelNodeId   &node)
+{
+    #pragma HLS INLINE
+    bool popped = false;
+
+    switch (fsmState) {
+    case WHEEL_IDLE:
+        if (procTick != nowTick) {
+            TimerTick nextTick = procTick + 1;
+            WheelL0Slot l0Slot = nextTick(cWheelL0Bits-1, 0);
+            WheelL1Slot l1Slot = nextTick(cWheelL0Bits+cWheelL1Bits-1, cWheelL0Bits);
+            if (l0Slot == 0) {
+                cursor = WHEEL_L1[l1Slot];
+                WHEEL_L1[l1Slot] = 0;
+                fsmState = WHEEL_CASCADE;
+            }
+            else {
+                cursor = WHEEL_L0[l0Slot];
+                WHEEL_L0[l0Slot] = 0;
+                fsmState = WHEEL_WALK;
+            }
+            procTick = nextTick;
+        }
+        break;
+    case WHEEL_CASCADE:
+    case WHEEL_WALK:
+        if (cursor[cWheelNodeBits] == 0) {
+            if (fsmState == WHEEL_CASCADE) {
+                WheelL0Slot l0Slot = procTick(cWheelL0Bits-1, 0);
+                cursor = WHEEL_L0[l0Slot];
+                WHEEL_L0[l0Slot] = 0;
+                fsmState = WHEEL_WALK;
+            }
+            else {
+                fsmState = WHEEL_IDLE;
+            }
+        }
+        else if (canPop) {
+            node   = cursor(cWheelNodeBits-1, 0);
+            cursor = WHEEL_NEXT[node];
+            popped = true;
+        }
+        break;
+    }
+    return popped;
+}
+
 /*******************************************************************************
  * @brief ReTransmit Timer (Rtt) process
  *
@@ -111,6 +398,8 @@ template<typename T> void pStreamMux(
  * @param[out] soSmx_SessCloseCmd   Close command to StateTableMux (Smx).
  * @param[out] soTAi_Notif          Notification to TxApplicationInterface (TAi).
  * @param[out] soRAi_Notif          Notification to RxApplicationInterface (RAi).
+ * @param[in]  siPbt_SessAbortCmd   Abort command from ProbeTimer (Pbt).
+ * @param[out] soPbt_ClrProbeTimer  Clear probe timer command to [Pbt].
  *
  * @details
  *  This process implements the retransmission timers at the session level. This
@@ -118,19 +407,26 @@ template<typename T> void pStreamMux(
  *   and for retransmitting them. Instead of managing a retransmission timer per
  *   segment, the current implementation only keeps track of a single timer per
  *   session. Such a session timer is managed as follows:
- *    [START] The retransmit timer of a session is re-started with an initial
- *     retransmission timeout value (RTO) whenever the timer is not active and a
- *     new segment is transmitted by [TXe]. The RTO value is set between 3 and
- *     24 seconds, depending on how often the session already timed-out in the
- *     recent past.
+ *    [START] The retransmit timer of a session is re-started whenever the
+ *     timer is not active and a new segment is transmitted by [TXe]. The timer
+ *     is loaded with the retransmission timeout (RTO) of the session, doubled
+ *     for every time the session already timed-out in a row (back-off).
  *    [STOP] The retransmit timer of a session is stopped and deactivated
  *     whenever an ACK is received by [RXe] and its received AckNum equals to
  *     the previously transmitted bytes but not yet acknowledged.
- *    [LOAD] Otherwise, the retransmit timer of a session is loaded with a RTO
- *     value of 1 second.
+ *    [LOAD] Otherwise, the retransmit timer of a session is re-loaded with the
+ *     RTO of the session.
+ *  The RTO of a session is computed by [RXe] from the measured round-trip time
+ *   as specified in RFC-6298 and is carried by the commands. A null RTO stands
+ *   for the initial value 'TOE_RTO_INIT' (i.e. no measurement yet).
  *    [TIMEOUT] Upon a time-out, an event is fired to [TXe].
  *  If a session times-out more than 4 times in a row, it is aborted. A release
  *   command is sent to the StateTable (STt) and the application is notified.
+ *   A session which did not answer its keepalive probes is aborted the same
+ *   way upon a command from [Pbt].
+ *  The timers are kept in a timing wheel. The commands from [RXe] and [TXe] are
+ *   handled in a single cycle and only the timers expiring in the current tick
+ *   get visited.
  *******************************************************************************/
 void pRetransmitTimer(
         stream<RXeReTransTimerCmd>       &siRXe_ReTxTimerCmd,
@@ -138,7 +434,9 @@ void pRetransmitTimer(
         stream<Event>                    &soEmx_Event,
         stream<SessionId>                &soSmx_SessCloseCmd,
         stream<SessState>                &soTAi_Notif,
-        stream<TcpAppNotif>              &soRAi_Notif)
+        stream<TcpAppNotif>              &soRAi_Notif,
+        stream<SessionId>                &siPbt_SessAbortCmd,
+        stream<SessionId>                &soPbt_ClrProbeTimer)
 {
     //-- DIRECTIVES FOR THIS PROCESS -------------------------------------------
     #pragma HLS PIPELINE II=1 enable_flush
@@ -148,186 +446,224 @@ void pRetransmitTimer(
 
     //-- STATIC ARRAYs ---------------------------------------------------------
     static ReTxTimerEntry           RETRANSMIT_TIMER_TABLE[TOE_MAX_SESSIONS];
+  #if TOE_USE_URAM
+    #pragma HLS RESOURCE   variable=RETRANSMIT_TIMER_TABLE core=XPM_MEMORY uram
+  #else
     #pragma HLS RESOURCE   variable=RETRANSMIT_TIMER_TABLE core=RAM_T2P_BRAM
+  #endif
+    #pragma HLS DATA_PACK  variable=RETRANSMIT_TIMER_TABLE
     #pragma HLS DEPENDENCE variable=RETRANSMIT_TIMER_TABLE inter false
     #pragma HLS RESET      variable=RETRANSMIT_TIMER_TABLE
+    static WheelPtr                 RTT_WHEEL_L0[cWheelL0Slots];
+    #pragma HLS ARRAY_PARTITION variable=RTT_WHEEL_L0 complete dim=1
+    #pragma HLS RESET      variable=RTT_WHEEL_L0
+    static WheelPtr                 RTT_WHEEL_L1[cWheelL1Slots];
+    #pragma HLS ARRAY_PARTITION variable=RTT_WHEEL_L1 complete dim=1
+    #pragma HLS RESET      variable=RTT_WHEEL_L1
+    static WheelPtr                 RTT_WHEEL_NEXT[cWheelNodes];
+    #pragma HLS RESOURCE   variable=RTT_WHEEL_NEXT core=RAM_T2P_BRAM
 
     //-- STATIC CONTROL VARIABLES (with RESET) ---------------------------------
-    static bool                rtt_waitForWrite=false;
-    #pragma HLS RESET variable=rtt_waitForWrite
-    static SessionId           rtt_prevPosition=0;
-    #pragma HLS RESET variable=rtt_prevPosition
-    static SessionId           rtt_position=0;
-    #pragma HLS RESET variable=rtt_position
-
-    //-- STATIC DATAFLOW VARIABLES --------------------------------------------
-    static RXeReTransTimerCmd  rtt_rxeCmd;
+    static WheelFsmState       rtt_wheelFsm=WHEEL_IDLE;
+    #pragma HLS RESET variable=rtt_wheelFsm
+    static WheelPtr            rtt_cursor=0;
+    #pragma HLS RESET variable=rtt_cursor
+    static TimerTick           rtt_nowTick=0;
+    #pragma HLS RESET variable=rtt_nowTick
+    static TimerTick           rtt_procTick=0;
+    #pragma HLS RESET variable=rtt_procTick
+    static ap_uint<32>         rtt_cycCnt=0;
+    #pragma HLS RESET variable=rtt_cycCnt
+    static SessionId           rtt_prevSessId=0;
+    #pragma HLS RESET variable=rtt_prevSessId
+    static ReTxTimerEntry      rtt_prevEntry;
+    #pragma HLS RESET variable=rtt_prevEntry
 
-    //-- DYNAMIC VARIABLES ----------------------------------------------------
+    //-- DYNAMIC VARIABLES -----------------------------------------------------
     ReTxTimerEntry     currEntry;
-    TXeReTransTimerCmd txeCmd;
-    ValBool            txeCmdVal;
     SessionId          currID;
+    WheelNodeId        node;
+    WheelPlace         place;
+    bool               doWrite = false;
+    bool               doLink  = false;
+
+    wheelClock(rtt_cycCnt, rtt_nowTick);
 
-    if (rtt_waitForWrite and (rtt_rxeCmd.sessionID != rtt_prevPosition)) {
-        //-------------------------------------------------------------
-        // Handle previously read command from [RXe] (i.e. RELOAD|STOP)
-        //-------------------------------------------------------------
-        if (rtt_rxeCmd.command == LOAD_TIMER) {
-            RETRANSMIT_TIMER_TABLE[rtt_rxeCmd.sessionID].time = TIME_1s;
+    if (!siRXe_ReTxTimerCmd.empty()) {
+        //------------------------------------------------
+        // Handle input command from [RXe] (i.e. LOAD|STOP)
+        //   INFO: Rx path has priority over Tx path
+        //------------------------------------------------
+        RXeReTransTimerCmd rxeCmd = siRXe_ReTxTimerCmd.read();
+        currID    = rxeCmd.sessionID;
+        currEntry = (currID == rtt_prevSessId) ? rtt_prevEntry : RETRANSMIT_TIMER_TABLE[currID];
+        if (rxeCmd.command == LOAD_TIMER) {
+            TimerTick rto = (rxeCmd.rto == 0) ? TOE_RTO_INIT : (TimerTick)rxeCmd.rto;
+            if (currEntry.wt.active) {
+                doLink = wheelArm(currEntry.wt, currID, rtt_nowTick + rto,
+                                  rtt_procTick, node, place);
+            }
             if (DEBUG_LEVEL & TRACE_RTT) {
                  printInfo(myName, "Session #%d - Reloading RTO timer (value=%d i.e. %d clock cycles).\n",
-                           rtt_rxeCmd.sessionID.to_int(), RETRANSMIT_TIMER_TABLE[rtt_rxeCmd.sessionID].time.to_uint(),
-                                       TOE_MAX_SESSIONS * RETRANSMIT_TIMER_TABLE[rtt_rxeCmd.sessionID].time.to_uint());
-             }
+                           currID.to_int(), rto.to_uint(),
+                                       TOE_TIMER_TICK.to_uint() * rto.to_uint());
+            }
         }
         else {  //-- STOP the timer
-            RETRANSMIT_TIMER_TABLE[rtt_rxeCmd.sessionID].time   = 0;
-            RETRANSMIT_TIMER_TABLE[rtt_rxeCmd.sessionID].active = false;
+            currEntry.wt.active = false;
             if (DEBUG_LEVEL & TRACE_RTT) {
                  printInfo(myName, "Session #%d - Stopping  RTO timer.\n",
-                           rtt_rxeCmd.sessionID.to_int());
-             }
+                           currID.to_int());
+            }
         }
-        RETRANSMIT_TIMER_TABLE[rtt_rxeCmd.sessionID].retries = 0;
-        rtt_waitForWrite = false;
+        currEntry.retries = 0;
+        doWrite = true;
     }
-    else if (!siRXe_ReTxTimerCmd.empty() and !rtt_waitForWrite) {
+    else if (!siTXe_ReTxTimerCmd.empty()) {
         //------------------------------------------------
-        // Read input command from [RXe]
-        //   INFO: Rx path has priority over Tx path
+        // Handle input command from [TXe]
         //------------------------------------------------
-        siRXe_ReTxTimerCmd.read(rtt_rxeCmd);
-        rtt_waitForWrite = true;
-    }
-    else {
-        if (!siTXe_ReTxTimerCmd.empty()) {
-            //------------------------------------------------
-            // Read input command from [TXe]
-            //------------------------------------------------
-            txeCmd    = siTXe_ReTxTimerCmd.read();
-            txeCmdVal = true;
-            currID    = txeCmd.sessionID;
-            if ( (txeCmd.sessionID-3 <  rtt_position) and
-                 (rtt_position <= txeCmd.sessionID) ) {
-                rtt_position += 5;  // [FIXME - Why is this?]
+        TXeReTransTimerCmd txeCmd = siTXe_ReTxTimerCmd.read();
+        currID    = txeCmd.sessionID;
+        currEntry = (currID == rtt_prevSessId) ? rtt_prevEntry : RETRANSMIT_TIMER_TABLE[currID];
+        currEntry.type = txeCmd.type;
+        if (not currEntry.wt.active) {
+            //-- Exponential back-off of the session's RTO [RFC-6298]
+            TimerTick rto = (txeCmd.rto == 0) ? TOE_RTO_INIT : (TimerTick)txeCmd.rto;
+            rto = rto << currEntry.retries.to_uint();
+            if (rto > TOE_RTO_MAX) {
+                rto = TOE_RTO_MAX;
+            }
+            doLink = wheelArm(currEntry.wt, currID, rtt_nowTick + rto,
+                              rtt_procTick, node, place);
+            if (DEBUG_LEVEL & TRACE_RTT) {
+                printInfo(myName, "Session #%d - Starting  RTO timer (value=%d i.e. %d clock cycles).\n",
+                          currID.to_int(), rto.to_uint(),
+                                           rto.to_uint()*TOE_TIMER_TICK.to_uint());
             }
         }
         else {
-            txeCmdVal = false;
-            currID = rtt_position;
-            // Increment position to be used in next loop
-            rtt_position++;
-            if (rtt_position >= TOE_MAX_SESSIONS) {
-                rtt_position = 0;
+            if (DEBUG_LEVEL & TRACE_RTT) {
+                printInfo(myName, "Session #%d - Current   RTO timer (expiry=%d i.e. in %d ticks).\n",
+                          currID.to_int(), currEntry.wt.expiry.to_uint(),
+                          (currEntry.wt.expiry - rtt_nowTick).to_uint());
             }
         }
-
-        // Get current entry from table
-        currEntry = RETRANSMIT_TIMER_TABLE[currID];
-
-        if (txeCmdVal) {
-            // There is a pending set command from [TXe]. Go and process it.
-            currEntry.type = txeCmd.type;
-            if (not currEntry.active) {
-                switch(currEntry.retries) {
-                case 0:
-                    currEntry.time = TIME_3s;
-                    break;
-                case 1:
-                    currEntry.time = TIME_6s;
-                    break;
-                case 2:
-                    currEntry.time = TIME_12s;
-                    break;
-                default:
-                    currEntry.time = TIME_30s;
-                    break;
-                }
-                currEntry.active = true;
-                if (DEBUG_LEVEL & TRACE_RTT) {
-                    printInfo(myName, "Session #%d - Starting  RTO timer (value=%d i.e. %d clock cycles).\n",
-                              currID.to_int(), currEntry.time.to_uint(),
-                                               currEntry.time.to_uint()*TOE_MAX_SESSIONS);
-                }
+        doWrite = true;
+    }
+    else if (!siPbt_SessAbortCmd.empty()) {
+        //------------------------------------------------
+        // Abort a session which is not alive anymore
+        //------------------------------------------------
+        siPbt_SessAbortCmd.read(currID);
+        currEntry = (currID == rtt_prevSessId) ? rtt_prevEntry : RETRANSMIT_TIMER_TABLE[currID];
+        currEntry.wt.active = false;
+        currEntry.retries   = 0;
+        soSmx_SessCloseCmd.write(currID);
+        soRAi_Notif.write(TcpAppNotif(currID, CLOSED));
+        printWarn(myName, "Session #%d - Keepalive timeout. Aborting the session.\n",
+                  currID.to_int());
+        doWrite = true;
+    }
+    // We need to check if we can generate another event, otherwise we might
+    // end up in a Deadlock since the [TXe] will not be able to set new
+    // retransmit timers.
+    else if (wheelWalk(rtt_wheelFsm, rtt_procTick, rtt_nowTick, rtt_cursor,
+                       RTT_WHEEL_L0, RTT_WHEEL_L1, RTT_WHEEL_NEXT,
+                       !soEmx_Event.full(), node)) {
+        //------------------------------------------------
+        // Visit a timer of the current tick
+        //------------------------------------------------
+        currID    = node >> 1;
+        currEntry = (currID == rtt_prevSessId) ? rtt_prevEntry : RETRANSMIT_TIMER_TABLE[currID];
+        switch (wheelVisit(currEntry.wt, node[0], rtt_procTick,
+                           (rtt_wheelFsm == WHEEL_CASCADE), place)) {
+        case WHEEL_FIRE:
+            if (currEntry.retries < 4) {
+                currEntry.retries++;
+                //-- Send timeout event to [TXe]
+                soEmx_Event.write(Event((EventType)currEntry.type,
+                                  currID,
+                                  currEntry.retries));
+                printWarn(myName, "Session #%d - RTO Timeout (retries=%d).\n",
+                          currID.to_int(), currEntry.retries.to_uint());
             }
             else {
-                if (DEBUG_LEVEL & TRACE_RTT) {
-                    printInfo(myName, "Session #%d - Current   RTO timer (value=%d i.e. %d clock cycles).\n",
-                              currID.to_int(), currEntry.time.to_uint(),
-                                               currEntry.time.to_uint()*TOE_MAX_SESSIONS);
-                }
-            }
-        }
-        else {
-            // No [TXe] command. Manage RETRANSMIT_TIMER_TABLE entries
-            if (currEntry.active) {
-                if (currEntry.time > 0) {
-                    currEntry.time--;
-                }
-                // We need to check if we can generate another event, otherwise we might
-                // end up in a Deadlock since the [TXe] will not be able to set new
-                // retransmit timers.
-                else if (!soEmx_Event.full()) {
-                    currEntry.time   = 0;
-                    currEntry.active = false;
-                    if (currEntry.retries < 4) {
-                        currEntry.retries++;
-                        //-- Send timeout event to [TXe]
-                        soEmx_Event.write(Event((EventType)currEntry.type,
-                                          currID,
-                                          currEntry.retries));
-                        printWarn(myName, "Session #%d - RTO Timeout (retries=%d).\n",
-                                  currID.to_int(), currEntry.retries.to_uint());
+                currEntry.retries = 0;
+                soSmx_SessCloseCmd.write(currID);
+                soPbt_ClrProbeTimer.write(currID);
+                if (currEntry.type == SYN_EVENT) {
+                    soTAi_Notif.write(SessState(currID, CLOSED));
+                    if (DEBUG_LEVEL & TRACE_RTT) {
+                        printWarn(myName, "Notifying [TAi] - Failed to open session %d (event=\'%s\').\n",
+                                  currID.to_int(), getEventName(currEntry.type));
                     }
-                    else {
-                        currEntry.retries = 0;
-                        soSmx_SessCloseCmd.write(currID);
-                        if (currEntry.type == SYN_EVENT) {
-                            soTAi_Notif.write(SessState(currID, CLOSED));
-                            if (DEBUG_LEVEL & TRACE_RTT) {
-                                printWarn(myName, "Notifying [TAi] - Failed to open session %d (event=\'%s\').\n",
-                                          currID.to_int(), getEventName(currEntry.type));
-                            }
-                        }
-                        else {
-                            soRAi_Notif.write(TcpAppNotif(currID, CLOSED));
-                            if (DEBUG_LEVEL & TRACE_RTT) {
-                                printWarn(myName, "Notifying [RAi] - Session %d timeout (event=\'%s\').\n",
-                                          currID.to_int(), getEventName(currEntry.type));
-                            }
-                        }
+                }
+                else {
+                    soRAi_Notif.write(TcpAppNotif(currID, CLOSED));
+                    if (DEBUG_LEVEL & TRACE_RTT) {
+                        printWarn(myName, "Notifying [RAi] - Session %d timeout (event=\'%s\').\n",
+                                  currID.to_int(), getEventName(currEntry.type));
                     }
                 }
             }
-        } // End of: txeCmdVal
+            break;
+        case WHEEL_RELINK:
+            doLink = true;
+            break;
+        default:
+            break;
+        }
+        doWrite = true;
+    }
 
-        // Write the entry back into the table
+    if (doLink) {
+        wheelLink(RTT_WHEEL_L0, RTT_WHEEL_L1, RTT_WHEEL_NEXT, node, place);
+    }
+    if (doWrite) {
+        // Write the entry back into the table and keep a copy for forwarding
         RETRANSMIT_TIMER_TABLE[currID] = currEntry;
-        rtt_prevPosition = currID;
+        rtt_prevSessId = currID;
+        rtt_prevEntry  = currEntry;
     }
 }
 
 /*******************************************************************************
  * @brief Probe Timer (Prb) process.
  *
- * @param[in]  siRXe_ClrProbeTimer Clear probe timer command from RxEngine (RXe).
+ * @param[in]  siRXe_ProbeTimerCmd Probe timer command from RxEngine (RXe).
  * @param[in]  siTXe_SetProbeTimer Set probe timer from TxEngine (TXe).
+ * @param[in]  siRtt_ClrProbeTimer Clear probe timer from RetransmitTimer (Rtt).
  * @param[out] soEmx_Event         Event to EventMultiplexer (Emx).
+ * @param[out] soRtt_SessAbortCmd  Abort command to [Rtt].
  *
  * @details
- *   This process reads in 'set-probe-timer' commands from [TXe] and
- *    'clear-probe-timer' commands from [RXe]. Upon a set request, a timer is
- *    initialized with an interval of 10s. When the timer expires, an 'RT_EVENT'
- *    is fired to the TxEngine via the [Emx] and the EventEngine.
- *   In case of a zero-window (or too small window) an 'RT_EVENT' will generate
- *    a packet without payload which is the same as a probing packet.
- *
+ *  This process implements the keepalive timers of the sessions [RFC-1122].
+ *    [LOAD] Every segment received by [RXe] in a synchronized state re-loads
+ *     the timer of its session with the idle time of its keepalive profile
+ *     and clears its count of unanswered probes. The profile comes with the
+ *     command and is the one of the listening port which accepted the
+ *     session: 'TOE_KEEPALIVE_IDLE', 'TOE_KEEPALIVE_FAST_IDLE' or none.
+ *    [STOP] The timer is stopped when the session gets closed by [RXe] or
+ *     aborted by [Rtt].
+ *    [SET] A 'set-probe-timer' command from [TXe] (e.g. zero-window) arms the
+ *     timer for a probe in 10s.
+ *    [TIMEOUT] Upon a time-out, a 'KEEPALIVE_EVENT' is fired to the TxEngine
+ *     via the [Emx] and the EventEngine, and the timer is re-armed with the
+ *     interval of the profile (e.g. 'TOE_KEEPALIVE_INTVL'). The peer answers
+ *     such a probe with an ACK, which re-loads the timer. After the number of
+ *     unanswered probes of the profile (e.g. 'TOE_KEEPALIVE_PROBES_CFG'), the
+ *     session is aborted by [Rtt].
+ *  The timers are kept in a timing wheel (see pRetransmitTimer). A re-load
+ *   which postpones the expiry only updates the timer entry, so that the idle
+ *   sessions cost a single visit per expiry, whatever the traffic.
  *******************************************************************************/
 void pProbeTimer(
-        stream<SessionId>    &siRXe_ClrProbeTimer,
-        stream<SessionId>    &siTXe_SetProbeTimer,
-        stream<Event>        &soEmx_Event)
+        stream<RXeProbeTimerCmd>  &siRXe_ProbeTimerCmd,
+        stream<SessionId>         &siTXe_SetProbeTimer,
+        stream<SessionId>         &siRtt_ClrProbeTimer,
+        stream<Event>             &soEmx_Event,
+        stream<SessionId>         &soRtt_SessAbortCmd)
 {
     //-- DIRECTIVES FOR THIS PROCESS -------------------------------------------
     #pragma HLS INLINE off
@@ -337,152 +673,244 @@ void pProbeTimer(
 
     //-- STATIC ARRAYS ---------------------------------------------------------
     static ProbeTimerEntry          PROBE_TIMER_TABLE[TOE_MAX_SESSIONS];
+  #if TOE_USE_URAM
+    #pragma HLS RESOURCE   variable=PROBE_TIMER_TABLE core=XPM_MEMORY uram
+  #else
     #pragma HLS RESOURCE   variable=PROBE_TIMER_TABLE core=RAM_T2P_BRAM
+  #endif
     #pragma HLS DATA_PACK  variable=PROBE_TIMER_TABLE
     #pragma HLS DEPENDENCE variable=PROBE_TIMER_TABLE inter false
     #pragma HLS RESET      variable=PROBE_TIMER_TABLE
+    static WheelPtr                 PBT_WHEEL_L0[cWheelL0Slots];
+    #pragma HLS ARRAY_PARTITION variable=PBT_WHEEL_L0 complete dim=1
+    #pragma HLS RESET      variable=PBT_WHEEL_L0
+    static WheelPtr                 PBT_WHEEL_L1[cWheelL1Slots];
+    #pragma HLS ARRAY_PARTITION variable=PBT_WHEEL_L1 complete dim=1
+    #pragma HLS RESET      variable=PBT_WHEEL_L1
+    static WheelPtr                 PBT_WHEEL_NEXT[cWheelNodes];
+    #pragma HLS RESOURCE   variable=PBT_WHEEL_NEXT core=RAM_T2P_BRAM
 
     //-- STATIC CONTROL VARIABLES (with RESET) ---------------------------------
-    static bool                pbt_WaitForWrite=false;
-    #pragma HLS RESET variable=pbt_WaitForWrite
-    static SessionId           pbt_currSessId=0;
-    #pragma HLS RESET variable=pbt_currSessId
-    static SessionId           pbt_updtSessId=0;
-    #pragma HLS RESET variable=pbt_updtSessId
+    static WheelFsmState       pbt_wheelFsm=WHEEL_IDLE;
+    #pragma HLS RESET variable=pbt_wheelFsm
+    static WheelPtr            pbt_cursor=0;
+    #pragma HLS RESET variable=pbt_cursor
+    static TimerTick           pbt_nowTick=0;
+    #pragma HLS RESET variable=pbt_nowTick
+    static TimerTick           pbt_procTick=0;
+    #pragma HLS RESET variable=pbt_procTick
+    static ap_uint<32>         pbt_cycCnt=0;
+    #pragma HLS RESET variable=pbt_cycCnt
     static SessionId           pbt_prevSessId=0;
     #pragma HLS RESET variable=pbt_prevSessId
+    static ProbeTimerEntry     pbt_prevEntry;
+    #pragma HLS RESET variable=pbt_prevEntry
 
     //-- DYNAMIC VARIABLES -----------------------------------------------------
-    bool      fastResume = false;
-
-    if (pbt_WaitForWrite) {
-        //-- Update the table
-        if (pbt_updtSessId != pbt_prevSessId) {
-            PROBE_TIMER_TABLE[pbt_updtSessId].time = TIME_10s;
-            //****************************************************************
-            //** [FIXME - Disabling the KeepAlive process for the time being]
-            //****************************************************************
-            PROBE_TIMER_TABLE[pbt_updtSessId].active = false;
-            pbt_WaitForWrite = false;
-        }
-        pbt_prevSessId--;
-    }
-    else if (!siTXe_SetProbeTimer.empty()) {
+    ProbeTimerEntry  entry;
+    SessionId        sessId;
+    WheelNodeId      node;
+    WheelPlace       place;
+    bool             doWrite = false;
+    bool             doLink  = false;
+
+    wheelClock(pbt_cycCnt, pbt_nowTick);
+
+    if (!siTXe_SetProbeTimer.empty()) {
         //-- Read the Session-Id to set
-        siTXe_SetProbeTimer.read(pbt_updtSessId);
-        pbt_WaitForWrite = true;
+        siTXe_SetProbeTimer.read(sessId);
+        entry  = (sessId == pbt_prevSessId) ? pbt_prevEntry : PROBE_TIMER_TABLE[sessId];
+        doLink = wheelArm(entry.wt, sessId, pbt_nowTick + TIME_10s,
+                          pbt_procTick, node, place);
+        doWrite = true;
     }
-    else { // if (!soEmx_Event.full()) this leads to II=2
-        SessionId sessIdToProcess;
-
-        if (!siRXe_ClrProbeTimer.empty()) {
-            //-- Read the Session-Id to clear
-            sessIdToProcess = siRXe_ClrProbeTimer.read();
-            fastResume = true;
+    else if (!siRXe_ProbeTimerCmd.empty()) {
+        RXeProbeTimerCmd rxeCmd = siRXe_ProbeTimerCmd.read();
+        sessId = rxeCmd.sessionID;
+        entry  = (sessId == pbt_prevSessId) ? pbt_prevEntry : PROBE_TIMER_TABLE[sessId];
+        ap_uint<32> idle = (rxeCmd.kaProfile == TOE_KEEPALIVE_FAST) ? TOE_KEEPALIVE_FAST_IDLE :
+                           (rxeCmd.kaProfile == TOE_KEEPALIVE_OFF)  ? (ap_uint<32>)0 : TOE_KEEPALIVE_IDLE;
+        if ((rxeCmd.command == LOAD_TIMER) and (idle != 0)) {
+            //-- The peer is alive. Re-load the idle time of the session
+            doLink = wheelArm(entry.wt, sessId, pbt_nowTick + idle,
+                              pbt_procTick, node, place);
+            entry.profile = rxeCmd.kaProfile;
         }
         else {
-            sessIdToProcess = pbt_currSessId;
-            pbt_currSessId++;
-            if (pbt_currSessId == TOE_MAX_SESSIONS) {
-                pbt_currSessId = 0;
-            }
+            //-- Clear (de-activate) the keepalive process for the current session-ID
+            entry.wt.active = false;
         }
-
-        if (PROBE_TIMER_TABLE[sessIdToProcess].active) {
-            if (fastResume) {
-                //-- Clear (de-activate) the keepalive process for the current session-ID
-                PROBE_TIMER_TABLE[sessIdToProcess].time = 0;
-                PROBE_TIMER_TABLE[sessIdToProcess].active = false;
-                fastResume = false;
-            }
-            else if (PROBE_TIMER_TABLE[sessIdToProcess].time == 0 and !soEmx_Event.full()) {
-                //-- Request to send a keepalive probe
-                PROBE_TIMER_TABLE[sessIdToProcess].time = 0;
-                PROBE_TIMER_TABLE[sessIdToProcess].active = false;
-                #if !(TCP_NODELAY)
-                    soEmx_Event.write(Event(TX_EVENT, sessIdToProcess));
-                #else
-                    soEmx_Event.write(Event(RT_EVENT, sessIdToProcess));
-                #endif
+        entry.probes = 0;
+        doWrite = true;
+    }
+    else if (!siRtt_ClrProbeTimer.empty()) {
+        siRtt_ClrProbeTimer.read(sessId);
+        entry = (sessId == pbt_prevSessId) ? pbt_prevEntry : PROBE_TIMER_TABLE[sessId];
+        entry.wt.active = false;
+        entry.probes    = 0;
+        doWrite = true;
+    }
+    else if (wheelWalk(pbt_wheelFsm, pbt_procTick, pbt_nowTick, pbt_cursor,
+                       PBT_WHEEL_L0, PBT_WHEEL_L1, PBT_WHEEL_NEXT,
+                       !soEmx_Event.full() and !soRtt_SessAbortCmd.full(), node)) {
+        sessId = node >> 1;
+        entry  = (sessId == pbt_prevSessId) ? pbt_prevEntry : PROBE_TIMER_TABLE[sessId];
+        switch (wheelVisit(entry.wt, node[0], pbt_procTick,
+                           (pbt_wheelFsm == WHEEL_CASCADE), place)) {
+        case WHEEL_FIRE:
+            if (entry.probes < ((entry.profile == TOE_KEEPALIVE_FAST) ? TOE_KEEPALIVE_FAST_PROBES_CFG :
+                                                                        TOE_KEEPALIVE_PROBES_CFG)) {
+                //-- Request to send a keepalive probe and wait for its answer
+                entry.probes++;
+                soEmx_Event.write(Event(KEEPALIVE_EVENT, sessId));
+                doLink = wheelArm(entry.wt, sessId, pbt_nowTick +
+                                  ((entry.profile == TOE_KEEPALIVE_FAST) ? TOE_KEEPALIVE_FAST_INTVL :
+                                                                           TOE_KEEPALIVE_INTVL),
+                                  pbt_procTick, node, place);
+                if (DEBUG_LEVEL & TRACE_PBT) {
+                    printInfo(myName, "Session #%d - Probe timer expired (probes=%d).\n",
+                              sessId.to_int(), entry.probes.to_uint());
+                }
             }
             else {
-                PROBE_TIMER_TABLE[sessIdToProcess].time -= 1;
+                //-- The peer is gone. Request [Rtt] to abort the session
+                entry.probes = 0;
+                soRtt_SessAbortCmd.write(sessId);
             }
+            break;
+        case WHEEL_RELINK:
+            doLink = true;
+            break;
+        default:
+            break;
         }
-        pbt_prevSessId = sessIdToProcess;
+        doWrite = true;
+    }
+
+    if (doLink) {
+        wheelLink(PBT_WHEEL_L0, PBT_WHEEL_L1, PBT_WHEEL_NEXT, node, place);
+    }
+    if (doWrite) {
+        PROBE_TIMER_TABLE[sessId] = entry;
+        pbt_prevSessId = sessId;
+        pbt_prevEntry  = entry;
     }
 }
 
 /*******************************************************************************
  * @brief Close Timer (Clt) process
  *
- * @param[in]  siRXe_CloseTimer    The session-id that is closing from [RXe].
+ * @param[in]  siRXe_CloseTimerCmd The close timer command from [RXe].
  * @param[out] soSmx_SessCloseCmd  Close command to StateTableMux (Smx).
  *
  * @details
  *  This process reads in the session-id that is currently closing. This sessId
- *   is kept in the 'TIME-WAIT' state for an additional 60s before it gets closed.
+ *   is kept in the 'TIME-WAIT' state for TOE_TIME_WAIT ticks before it gets
+ *   closed, or for TOE_TIME_WAIT_SHORT ticks if its listening port was opened
+ *   with a short TIME-WAIT. The timer is stopped when [RXe] reuses the session
+ *   for a new incarnation of its connection [RFC-6191].
+ *   The timers are kept in a timing wheel (see pRetransmitTimer).
  ******************************************************************************/
 void pCloseTimer(
-        stream<SessionId>    &siRXe_CloseTimer,
-        stream<SessionId>    &soSmx_SessCloseCmd)
+        stream<RXeCloseTimerCmd> &siRXe_CloseTimerCmd,
+        stream<SessionId>        &soSmx_SessCloseCmd)
 {
     //-- DIRECTIVES FOR THIS PROCESS -------------------------------------------
     #pragma HLS PIPELINE II=1 enable_flush
     #pragma HLS INLINE off
 
+    const char *myName  = concat3(THIS_NAME, "/", "Clt");
+
     //-- STATIC ARRAYS ---------------------------------------------------------
     static CloseTimerEntry          CLOSE_TIMER_TABLE[TOE_MAX_SESSIONS];
+  #if TOE_USE_URAM
+    #pragma HLS RESOURCE   variable=CLOSE_TIMER_TABLE core=XPM_MEMORY uram
+  #else
     #pragma HLS RESOURCE   variable=CLOSE_TIMER_TABLE core=RAM_T2P_BRAM
+  #endif
     #pragma HLS DATA_PACK  variable=CLOSE_TIMER_TABLE
     #pragma HLS DEPENDENCE variable=CLOSE_TIMER_TABLE inter false
     #pragma HLS RESET      variable=CLOSE_TIMER_TABLE
+    static WheelPtr                 CLT_WHEEL_L0[cWheelL0Slots];
+    #pragma HLS ARRAY_PARTITION variable=CLT_WHEEL_L0 complete dim=1
+    #pragma HLS RESET      variable=CLT_WHEEL_L0
+    static WheelPtr                 CLT_WHEEL_L1[cWheelL1Slots];
+    #pragma HLS ARRAY_PARTITION variable=CLT_WHEEL_L1 complete dim=1
+    #pragma HLS RESET      variable=CLT_WHEEL_L1
+    static WheelPtr                 CLT_WHEEL_NEXT[cWheelNodes];
+    #pragma HLS RESOURCE   variable=CLT_WHEEL_NEXT core=RAM_T2P_BRAM
 
     //-- STATIC CONTROL VARIABLES (with RESET) ---------------------------------
-    static bool                clt_waitForWrite=false;
-    #pragma HLS RESET variable=clt_waitForWrite
-    static SessionId           clt_currSessId=0;
-    #pragma HLS RESET variable=clt_currSessId
+    static WheelFsmState       clt_wheelFsm=WHEEL_IDLE;
+    #pragma HLS RESET variable=clt_wheelFsm
+    static WheelPtr            clt_cursor=0;
+    #pragma HLS RESET variable=clt_cursor
+    static TimerTick           clt_nowTick=0;
+    #pragma HLS RESET variable=clt_nowTick
+    static TimerTick           clt_procTick=0;
+    #pragma HLS RESET variable=clt_procTick
+    static ap_uint<32>         clt_cycCnt=0;
+    #pragma HLS RESET variable=clt_cycCnt
     static SessionId           clt_prevSessId=0;
     #pragma HLS RESET variable=clt_prevSessId
+    static CloseTimerEntry     clt_prevEntry;
+    #pragma HLS RESET variable=clt_prevEntry
 
-    //-- STATIC DATAFLOW VARIABLES ---------------------------------------------
-    static SessionId           clt_sessIdToSet;
-
-    if (clt_waitForWrite) {
-        //-- Update the table
-        if (clt_sessIdToSet != clt_prevSessId) {
-            CLOSE_TIMER_TABLE[clt_sessIdToSet].time = TIME_60s;
-            CLOSE_TIMER_TABLE[clt_sessIdToSet].active = true;
-            clt_waitForWrite = false;
+    //-- DYNAMIC VARIABLES -----------------------------------------------------
+    CloseTimerEntry  entry;
+    SessionId        sessId;
+    WheelNodeId      node;
+    WheelPlace       place;
+    bool             doWrite = false;
+    bool             doLink  = false;
+
+    wheelClock(clt_cycCnt, clt_nowTick);
+
+    if (!siRXe_CloseTimerCmd.empty()) {
+        RXeCloseTimerCmd rxeCmd = siRXe_CloseTimerCmd.read();
+        sessId = rxeCmd.sessionID;
+        entry  = (sessId == clt_prevSessId) ? clt_prevEntry : CLOSE_TIMER_TABLE[sessId];
+        if (rxeCmd.command == LOAD_TIMER) {
+            //-- The session enters TIME-WAIT
+            doLink = wheelArm(entry.wt, sessId,
+                              clt_nowTick + (rxeCmd.twShort ? TOE_TIME_WAIT_SHORT : TOE_TIME_WAIT),
+                              clt_procTick, node, place);
         }
-        clt_prevSessId--;
-    }
-    else if (!siRXe_CloseTimer.empty()) {
-        //-- Read the Session-Id to set
-        siRXe_CloseTimer.read(clt_sessIdToSet);
-        clt_waitForWrite = true;
+        else {
+            //-- The session was reused by a new SYN
+            entry.wt.active = false;
+        }
+        doWrite = true;
     }
-    else {
-        clt_prevSessId = clt_currSessId;
-        // Check if timer is 0, otherwise decrement
-        if (CLOSE_TIMER_TABLE[clt_currSessId].active) {
-            if (CLOSE_TIMER_TABLE[clt_currSessId].time > 0) {
-                CLOSE_TIMER_TABLE[clt_currSessId].time -= 1;
-            }
-            else {
-                CLOSE_TIMER_TABLE[clt_currSessId].time = 0;
-                CLOSE_TIMER_TABLE[clt_currSessId].active = false;
-                soSmx_SessCloseCmd.write(clt_currSessId);
+    else if (wheelWalk(clt_wheelFsm, clt_procTick, clt_nowTick, clt_cursor,
+                       CLT_WHEEL_L0, CLT_WHEEL_L1, CLT_WHEEL_NEXT,
+                       !soSmx_SessCloseCmd.full(), node)) {
+        sessId = node >> 1;
+        entry  = (sessId == clt_prevSessId) ? clt_prevEntry : CLOSE_TIMER_TABLE[sessId];
+        switch (wheelVisit(entry.wt, node[0], clt_procTick,
+                           (clt_wheelFsm == WHEEL_CASCADE), place)) {
+        case WHEEL_FIRE:
+            soSmx_SessCloseCmd.write(sessId);
+            if (DEBUG_LEVEL & TRACE_CLT) {
+                printInfo(myName, "Session #%d - Close timer expired.\n", sessId.to_int());
             }
+            break;
+        case WHEEL_RELINK:
+            doLink = true;
+            break;
+        default:
+            break;
         }
+        doWrite = true;
+    }
 
-        if (clt_currSessId == TOE_MAX_SESSIONS) {
-            clt_currSessId = 0;
-        }
-        else {
-            clt_currSessId++;
-        }
+    if (doLink) {
+        wheelLink(CLT_WHEEL_L0, CLT_WHEEL_L1, CLT_WHEEL_NEXT, node, place);
+    }
+    if (doWrite) {
+        CLOSE_TIMER_TABLE[sessId] = entry;
+        clt_prevSessId = sessId;
+        clt_prevEntry  = entry;
     }
 }
 
@@ -490,8 +918,8 @@ void pCloseTimer(
  * @brief The Timers (TIm)
  *
  * @param[in]  siRXe_ReTxTimerCmd   Retransmission timer command from Rx Engine (RXe).
- * @param[in]  siRXe_ClrProbeTimer  Clear probe timer from [RXe].
- * @param[in]  siRXe_CloseTimer     Close timer from [RXe].
+ * @param[in]  siRXe_ProbeTimerCmd  Probe timer command from [RXe].
+ * @param[in]  siRXe_CloseTimerCmd  Close timer command from [RXe].
  * @param[in]  siTXe_ReTxTimerCmd   Retransmission timer command from Tx Engine (TXe).
  * @param[in]  siTXe_SetProbeTimer  Set probe timer from [TXe].
  * @param[out] soEVe_Event          Event to EventEngine (EVe).
@@ -504,8 +932,8 @@ void pCloseTimer(
  *******************************************************************************/
 void timers(
         stream<RXeReTransTimerCmd> &siRXe_ReTxTimerCmd,
-        stream<SessionId>          &siRXe_ClrProbeTimer,
-        stream<SessionId>          &siRXe_CloseTimer,
+        stream<RXeProbeTimerCmd>   &siRXe_ProbeTimerCmd,
+        stream<RXeCloseTimerCmd>   &siRXe_CloseTimerCmd,
         stream<TXeReTransTimerCmd> &siTXe_ReTxTimerCmd,
         stream<SessionId>          &siTXe_SetProbeTimer,
         stream<SessionId>          &soSTt_SessCloseCmd,
@@ -533,6 +961,12 @@ void timers(
     #pragma HLS stream    variable=ssPbtToEmx_Event          depth=2
     #pragma HLS DATA_PACK variable=ssPbtToEmx_Event
 
+    static stream<SessionId>       ssPbtToRtt_SessAbortCmd   ("ssPbtToRtt_SessAbortCmd");
+    #pragma HLS stream    variable=ssPbtToRtt_SessAbortCmd   depth=2
+
+    static stream<SessionId>       ssRttToPbt_ClrProbeTimer  ("ssRttToPbt_ClrProbeTimer");
+    #pragma HLS stream    variable=ssRttToPbt_ClrProbeTimer  depth=2
+
     // Event Mux (Emx) based on template stream Mux
     //  Notice order --> RetransmitTimer comes before ProbeTimer
     pStreamMux(
@@ -547,16 +981,20 @@ void timers(
         ssRttToEmx_Event,
         ssRttToSmx_SessCloseCmd,
         soTAi_Notif,
-        soRAi_Notif);
+        soRAi_Notif,
+        ssPbtToRtt_SessAbortCmd,
+        ssRttToPbt_ClrProbeTimer);
 
     // Probe Timer (Pbt)
     pProbeTimer(
-        siRXe_ClrProbeTimer,
+        siRXe_ProbeTimerCmd,
         siTXe_SetProbeTimer,
-        ssPbtToEmx_Event);
+        ssRttToPbt_ClrProbeTimer,
+        ssPbtToEmx_Event,
+        ssPbtToRtt_SessAbortCmd);
 
     pCloseTimer(
-        siRXe_CloseTimer,
+        siRXe_CloseTimerCmd,
         ssClsToSmx_SessCloseCmd);
 
     // State table release Mux (Smx) based on template stream Mux
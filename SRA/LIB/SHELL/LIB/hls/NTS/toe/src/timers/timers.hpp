@@ -66,14 +66,74 @@ using namespace hls;
 enum StateEntry {DISABLED_ENTRY = false,
                  ACTIVE_ENTRY   = true};
 
+/*******************************************************************************
+ * TIMING WHEEL
+ *******************************************************************************
+ * The timers are kept in a two-level hierarchical timing wheel which advances
+ *  by one slot every 'TOE_TIMER_TICK' clock cycles.
+ *  - Level-0 has 'cWheelL0Slots' slots of 1 tick each. A slot holds the list
+ *    of the timers expiring in that very tick.
+ *  - Level-1 has 'cWheelL1Slots' slots of 'cWheelL0Slots' ticks each. Upon
+ *    every wrap of level-0, the current level-1 slot is cascaded into level-0.
+ *    Timers expiring beyond the range of the wheel are parked into the last
+ *    level-1 slot and get re-evaluated when that slot is cascaded.
+ *  Every session owns two list nodes per timer. This allows a running timer to
+ *   be re-armed with an earlier expiry without unlinking it from a singly-linked
+ *   list. The node which is not current anymore is simply dropped when visited.
+ *******************************************************************************/
+const int cWheelL0Bits   = 6;
+const int cWheelL1Bits   = 6;
+const int cWheelL0Slots  = (1 << cWheelL0Bits);
+const int cWheelL1Slots  = (1 << cWheelL1Bits);
+const int cWheelNodeBits = log2Ceil<TOE_MAX_SESSIONS>::val + 1;  // {SessId, NodeBit}
+const int cWheelNodes    = (2 * TOE_MAX_SESSIONS);
+
+typedef ap_uint<32>                    TimerTick;
+typedef ap_uint<cWheelL0Bits>          WheelL0Slot;
+typedef ap_uint<cWheelL1Bits>          WheelL1Slot;
+typedef ap_uint<cWheelNodeBits>        WheelNodeId;
+typedef ap_uint<cWheelNodeBits+1>      WheelPtr;     // MSB is the valid bit (0=NIL)
+
+enum WheelFsmState { WHEEL_IDLE=0, WHEEL_CASCADE, WHEEL_WALK };
+enum WheelAction   { WHEEL_DROP=0, WHEEL_FIRE,    WHEEL_RELINK };
+
+/********************************************
+ * Whl - Timing Wheel Entry
+ *  The per-session part of a wheel timer.
+ ********************************************/
+class WheelTimer
+{
+  public:
+    TimerTick       expiry;  // Absolute tick at which the timer expires
+    bool            active;
+    ap_uint<1>      node;    // The node which currently holds the timer
+    ap_uint<2>      linked;  // One bit per node (1=linked into the wheel)
+    TimerTick       due0;    // Tick at which node #0 will be visited
+    TimerTick       due1;    // Tick at which node #1 will be visited
+    WheelTimer() {}
+};
+
+/********************************************
+ * Whl - Timing Wheel Placement
+ *  Tells where a node must be linked.
+ ********************************************/
+class WheelPlace
+{
+  public:
+    bool            isL1;
+    WheelL0Slot     l0Slot;
+    WheelL1Slot     l1Slot;
+    TimerTick       due;
+    WheelPlace() {}
+};
+
 /********************************************
  * Cls - Close Timer Entry
  ********************************************/
 class CloseTimerEntry
 {
   public:
-    ap_uint<32> time;
-    bool        active;
+    WheelTimer      wt;
     CloseTimerEntry() {}
 };
 
@@ -83,8 +143,9 @@ class CloseTimerEntry
 class ProbeTimerEntry
 {
   public:
-    ap_uint<32>     time;
-    bool            active;
+    WheelTimer      wt;
+    ap_uint<4>      probes;  // Number of unanswered keepalive probes
+    TcpKaProfile    profile; // The keepalive profile of the session
     ProbeTimerEntry() {}
 };
 
@@ -94,9 +155,8 @@ class ProbeTimerEntry
 class ReTxTimerEntry
 {
   public:
-    ap_uint<32>     time;
+    WheelTimer      wt;
     ap_uint<3>      retries;
-    bool            active;
     EventType       type;
     ReTxTimerEntry() {}
 };
@@ -109,8 +169,8 @@ class ReTxTimerEntry
 void timers(
         //-- Rx Engine Interfaces
         stream<RXeReTransTimerCmd> &siRXe_ReTxTimerCmd,
-        stream<ap_uint<16> >       &siRXe_ClrProbeTimer,
-        stream<ap_uint<16> >       &siRXe_CloseTimer,
+        stream<RXeProbeTimerCmd>   &siRXe_ProbeTimerCmd,
+        stream<RXeCloseTimerCmd>   &siRXe_CloseTimerCmd,
         //-- Tx Engine Interfaces
         stream<TXeReTransTimerCmd> &siTXe_ReTxTimerCmd,
         stream<ap_uint<16> >       &siTXe_SetProbeTimer,
@@ -63,6 +63,7 @@ EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "./event_engine/event_engine.hpp"
 #include "./ack_delay/src/ack_delay.hpp"
 #include "./port_table/port_table.hpp"
+#include "./buffer_pool/buffer_pool.hpp"
 #include "./rx_app_interface/rx_app_interface.hpp"
 #include "./tx_app_interface/tx_app_interface.hpp"
 #include "./rx_engine/src/rx_engine.hpp"
@@ -123,7 +124,7 @@ template<typename T> void pStreamMux(
  * @brief Ready (Rdy)
  *
  * @param[in]  piPRt_Ready  The ready signal from PortTable (PRt).
- * @param[in]  piTBD_Ready  The ready signal from TBD.
+ * @param[in]  piSLc_Ready  The ready signal from SessionLookupController (SLc).
  * @param[out] poNTS_Ready  The ready signal of the TOE.
  *
  * @details [FIXME - Turn this IO into a stream]
@@ -132,11 +133,12 @@ template<typename T> void pStreamMux(
  *******************************************************************************/
 void pReady(
     StsBool     &piPRt_Ready,
+    StsBool     &piSLc_Ready,
     StsBit      &poNTS_Ready)
 {
     const char *myName = concat3(THIS_NAME, "/", "Rdy");
 
-    poNTS_Ready = (piPRt_Ready == true) ? 1 : 0;
+    poNTS_Ready = ((piPRt_Ready == true) and (piSLc_Ready == true)) ? 1 : 0;
 
     if (DEBUG_LEVEL & TRACE_RDY) {
         if (poNTS_Ready)
@@ -192,6 +194,9 @@ void pTbSimCount(
  * @param[in]  siTAIF_DReq       APP data request from [TAIF].
  * @param[out] soTAIF_Data       APP data stream to [TAIF].
  * @param[out] soTAIF_Meta       APP metadata stream to [TAIF].
+ * @param[in]  siTAIF_DscReq     APP read descriptor request from [TAIF].
+ * @param[out] soTAIF_RdDsc      APP read descriptor to [TAIF].
+ * @param[in]  siTAIF_RxCrd      APP Rx buffer credit from [TAIF].
  * -- TAIF / Listen Port Interfaces
  * @param[in]  siTAIF_LsnReq     APP listen port request from [TAIF].
  * @param[out] soTAIF_LsnRep     APP listen port reply to [TAIF].
@@ -199,6 +204,8 @@ void pTbSimCount(
  * @param[in]  siTAIF_Data       APP data stream from [TAIF].
  * @param[in]  siTAIF_SndReq     APP request to send from [TAIF].
  * @param[out] soTAIF_SndRep     APP send reply to [TAIF].
+ * @param[in]  siTAIF_SndDsc     APP send descriptor from [TAIF].
+ * @param[out] soTAIF_SndCpl     APP send completion to [TAIF].
  * -- TAIF / Open Interfaces
  * @param[in]  siTAIF_OpnReq     APP open port request from [TAIF].
  * @param[out] soTAIF_OpnRep     APP open port reply to [TAIF].
@@ -226,7 +233,7 @@ void pTbSimCount(
  * @param[out] soCAM_SssUpdReq   Session update request to [CAM].
  * -- DEBUG / Session Statistics Interfaces
  * @param[out] soDBG_SssRelCnt   Session release count to DEBUG.
- * @param[out] soDBG_SssRegCnt   Session register count to DEBUG.
+ * @param[out] soDBG_SssRegCnt   Session counts {peak(31:16), live(15:0)} to DEBUG.
  *******************************************************************************/
 void toe(
 
@@ -264,6 +271,9 @@ void toe(
         stream<TcpAppRdReq>                 &siTAIF_DReq,
         stream<TcpAppData>                  &soTAIF_Data,
         stream<TcpAppMeta>                  &soTAIF_Meta,
+        stream<TcpAppRdReq>                 &siTAIF_DscReq,
+        stream<TcpAppRdDsc>                 &soTAIF_RdDsc,
+        stream<TcpAppRxCrd>                 &siTAIF_RxCrd,
 
         //------------------------------------------------------
         //-- TAIF / Listen Port Interfaces
@@ -277,6 +287,8 @@ void toe(
         stream<TcpAppData>                  &siTAIF_Data,
         stream<TcpAppSndReq>                &siTAIF_SndReq,
         stream<TcpAppSndRep>                &soTAIF_SndRep,
+        stream<TcpAppSndDsc>                &siTAIF_SndDsc,
+        stream<TcpAppSndCpl>                &soTAIF_SndCpl,
 
         //------------------------------------------------------
         //-- TAIF / Open connection Interfaces
@@ -322,7 +334,7 @@ void toe(
         //-- DEBUG Interfaces
         //------------------------------------------------------
         stream<ap_uint<16> >                &soDBG_SssRelCnt,
-        stream<ap_uint<16> >                &soDBG_SssRegCnt,
+        stream<ap_uint<32> >                &soDBG_SssRegCnt,
         stream<RxBufPtr>                    &soDBG_RxFreeSpace,
         stream<ap_uint<32> >                &soDBG_TcpIpRxByteCnt,
         stream<ap_uint< 8> >                &soDBG_OooDebug
@@ -366,8 +378,9 @@ void toe(
     //-------------------------------------------------------------------------
     StsBool                           sPRtToRdy_Ready;
 
-    static stream<RepBit>             ssPRtToRXe_PortStateRep    ("ssPRtToRXe_PortStateRep");
+    static stream<PortStsRep>         ssPRtToRXe_PortStateRep    ("ssPRtToRXe_PortStateRep");
     #pragma HLS stream       variable=ssPRtToRXe_PortStateRep    depth=4
+    #pragma HLS DATA_PACK    variable=ssPRtToRXe_PortStateRep
 
     static stream<AckBit>             ssPRtToRAi_OpnLsnPortRep   ("ssPRtToRAi_OpnLsnPortRep");
     #pragma HLS stream       variable=ssPRtToRAi_OpnLsnPortRep   depth=4
@@ -376,13 +389,24 @@ void toe(
     #pragma HLS stream       variable=ssPRtToTAi_GetFreePortRep  depth=4
 
     //-- Rx Application Interface (RAi) ---------------------------------------
-    static stream<TcpPort>            ssRAiToPRt_OpnLsnPortReq   ("ssRAiToPRt_OpnLsnPortReq");
+    static stream<TcpAppLsnReq>       ssRAiToPRt_OpnLsnPortReq   ("ssRAiToPRt_OpnLsnPortReq");
     #pragma HLS stream       variable=ssRAiToPRt_OpnLsnPortReq   depth=4
+    #pragma HLS DATA_PACK    variable=ssRAiToPRt_OpnLsnPortReq
 
     static stream<RAiRxSarQuery>      ssRAiToRSt_RxSarQry        ("ssRAiToRSt_RxSarQry");
     #pragma HLS stream       variable=ssRAiToRSt_RxSarQry        depth=cDepth_RAiToRSt_Qry
     #pragma HLS DATA_PACK    variable=ssRAiToRSt_RxSarQry
 
+  #if TOE_BUF_POOL_CFG
+    static stream<DmCmd>              ssRAiToBPl_MemRdCmd        ("ssRAiToBPl_MemRdCmd");
+    #pragma HLS stream       variable=ssRAiToBPl_MemRdCmd        depth=cDepth_RAiToBPl_Cmd
+    #pragma HLS DATA_PACK    variable=ssRAiToBPl_MemRdCmd
+
+    static stream<TcpAppRdDsc>        ssRAiToBPl_RdDsc           ("ssRAiToBPl_RdDsc");
+    #pragma HLS stream       variable=ssRAiToBPl_RdDsc           depth=cDepth_RAiToBPl_Cmd
+    #pragma HLS DATA_PACK    variable=ssRAiToBPl_RdDsc
+  #endif
+
     //-------------------------------------------------------------------------
     //-- Rx Engine (RXe)
     //-------------------------------------------------------------------------
@@ -409,11 +433,13 @@ void toe(
     #pragma HLS stream       variable=ssRXeToTIm_ReTxTimerCmd    depth=2
     #pragma HLS DATA_PACK    variable=ssRXeToTIm_ReTxTimerCmd
 
-    static stream<SessionId>          ssRXeToTIm_CloseTimer      ("ssRXeToTIm_CloseTimer");
-    #pragma HLS stream       variable=ssRXeToTIm_CloseTimer      depth=2
+    static stream<RXeCloseTimerCmd>   ssRXeToTIm_CloseTimerCmd   ("ssRXeToTIm_CloseTimerCmd");
+    #pragma HLS stream       variable=ssRXeToTIm_CloseTimerCmd   depth=2
+    #pragma HLS DATA_PACK    variable=ssRXeToTIm_CloseTimerCmd
 
-    static stream<SessionId>          ssRXeToTIm_ClrProbeTimer   ("ssRXeToTIm_ClrProbeTimer");
-    #pragma HLS stream       variable=ssRXeToTIm_ClrProbeTimer   depth=2
+    static stream<RXeProbeTimerCmd>   ssRXeToTIm_ProbeTimerCmd   ("ssRXeToTIm_ProbeTimerCmd");
+    #pragma HLS stream       variable=ssRXeToTIm_ProbeTimerCmd   depth=2
+    #pragma HLS DATA_PACK    variable=ssRXeToTIm_ProbeTimerCmd
 
     static stream<TcpAppNotif>        ssRXeToRAi_Notif           ("ssRXeToRAi_Notif");
     #pragma HLS stream       variable=ssRXeToRAi_Notif           depth=4
@@ -427,6 +453,12 @@ void toe(
     #pragma HLS stream       variable=ssRXeToEVe_Event           depth=cDepth_RXeToEVe_Event
     #pragma HLS DATA_PACK    variable=ssRXeToEVe_Event
 
+  #if TOE_BUF_POOL_CFG
+    static stream<DmCmd>              ssRXeToBPl_MemWrCmd        ("ssRXeToBPl_MemWrCmd");
+    #pragma HLS stream       variable=ssRXeToBPl_MemWrCmd        depth=cDepth_RXeToBPl_Cmd
+    #pragma HLS DATA_PACK    variable=ssRXeToBPl_MemWrCmd
+  #endif
+
     //-- Rx SAR Table (RSt) ---------------------------------------------------
     static stream<RxSarReply>         ssRStToRXe_RxSarRep        ("ssRStToRXe_RxSarRep");
     #pragma HLS stream       variable=ssRStToRXe_RxSarRep        depth=2
@@ -440,9 +472,15 @@ void toe(
     #pragma HLS stream       variable=ssRStToTXe_RxSarRep        depth=2
     #pragma HLS DATA_PACK    variable=ssRStToTXe_RxSarRep
 
+    static stream<BufPageRel>         ssRStToBPl_PageRel         ("ssRStToBPl_PageRel");
+    #pragma HLS stream       variable=ssRStToBPl_PageRel         depth=cDepth_RStToBPl_Rel
+    #pragma HLS DATA_PACK    variable=ssRStToBPl_PageRel
+
     //-------------------------------------------------------------------------
     //-- Session Lookup Controller (SLc)
     //-------------------------------------------------------------------------
+    StsBool                           sSLcToRdy_Ready;
+
     static stream<SessionLookupReply> ssSLcToRXe_SessLkpRep      ("ssSLcToRXe_SessLkpRep");
     #pragma HLS stream       variable=ssSLcToRXe_SessLkpRep      depth=4
     #pragma HLS DATA_PACK    variable=ssSLcToRXe_SessLkpRep
@@ -491,6 +529,12 @@ void toe(
     #pragma HLS stream       variable=ssTAiToTSt_PushCmd         depth=cDepth_TAiToTSt_Cmd
     #pragma HLS DATA_PACK    variable=ssTAiToTSt_PushCmd
 
+  #if TOE_BUF_POOL_CFG
+    static stream<DmCmd>              ssTAiToBPl_MemWrCmd        ("ssTAiToBPl_MemWrCmd");
+    #pragma HLS stream       variable=ssTAiToBPl_MemWrCmd        depth=cDepth_TAiToBPl_Cmd
+    #pragma HLS DATA_PACK    variable=ssTAiToBPl_MemWrCmd
+  #endif
+
     static stream<StateQuery>         ssTAiToSTt_AcceptStateQry  ("ssTAiToSTt_AcceptStateQry");
     #pragma HLS stream       variable=ssTAiToSTt_AcceptStateQry  depth=2
     #pragma HLS DATA_PACK    variable=ssTAiToSTt_AcceptStateQry
@@ -529,6 +573,12 @@ void toe(
     #pragma HLS stream       variable=ssTXeToTSt_TxSarQry        depth=cDepth_TXeToTSt_Qry
     #pragma HLS DATA_PACK    variable=ssTXeToTSt_TxSarQry
 
+  #if TOE_BUF_POOL_CFG
+    static stream<DmCmd>              ssTXeToBPl_MemRdCmd        ("ssTXeToBPl_MemRdCmd");
+    #pragma HLS stream       variable=ssTXeToBPl_MemRdCmd        depth=cDepth_TXeToBPl_Cmd
+    #pragma HLS DATA_PACK    variable=ssTXeToBPl_MemRdCmd
+  #endif
+
     static stream<SessionId>          ssTXeToSLc_ReverseLkpReq   ("ssTXeToSLc_ReverseLkpReq");
     #pragma HLS stream       variable=ssTXeToSLc_ReverseLkpReq   depth=4
 
@@ -554,12 +604,17 @@ void toe(
     #pragma HLS stream       variable=ssTStToTAi_PushCmd         depth=cDepth_TStToTAi_Cmd
     #pragma HLS DATA_PACK    variable=ssTStToTAi_PushCmd
 
+    static stream<BufPageRel>         ssTStToBPl_PageRel         ("ssTStToBPl_PageRel");
+    #pragma HLS stream       variable=ssTStToBPl_PageRel         depth=cDepth_TStToBPl_Rel
+    #pragma HLS DATA_PACK    variable=ssTStToBPl_PageRel
+
     /**********************************************************************
      * PROCESS FUNCTIONS: TCP STATE-KEEPING DATA STRUCTURES
      **********************************************************************/
 
     //-- Session Lookup Controller (SLc) -----------------------------------
     session_lookup_controller(
+            sSLcToRdy_Ready,
             ssRXeToSLc_SessLkpReq,
             ssSLcToRXe_SessLkpRep,
             ssSTtToSLc_SessReleaseCmd,
@@ -593,7 +648,8 @@ void toe(
             ssRAiToRSt_RxSarQry,
             ssRStToRAi_RxSarRep,
             ssTXeToRSt_RxSarReq,
-            ssRStToTXe_RxSarRep);
+            ssRStToTXe_RxSarRep,
+            ssRStToBPl_PageRel);
 
     //-- TX SAR Table (TSt) ------------------------------------------------
     tx_sar_table(
@@ -602,7 +658,25 @@ void toe(
             ssTXeToTSt_TxSarQry,
             ssTStToTXe_TxSarRep,
             ssTAiToTSt_PushCmd,
-            ssTStToTAi_PushCmd);
+            ssTStToTAi_PushCmd,
+            ssTStToBPl_PageRel);
+
+  #if TOE_BUF_POOL_CFG
+    //-- Buffer Pool (BPl) -------------------------------------------------
+    buffer_pool(
+            ssRXeToBPl_MemWrCmd,
+            soMEM_RxP_WrCmd,
+            ssRAiToBPl_MemRdCmd,
+            soMEM_RxP_RdCmd,
+            ssRAiToBPl_RdDsc,
+            soTAIF_RdDsc,
+            ssRStToBPl_PageRel,
+            ssTAiToBPl_MemWrCmd,
+            soMEM_TxP_WrCmd,
+            ssTXeToBPl_MemRdCmd,
+            soMEM_TxP_RdCmd,
+            ssTStToBPl_PageRel);
+  #endif
 
     //-- Port Table (PRt) --------------------------------------------------
     port_table(
@@ -618,8 +692,8 @@ void toe(
     //-- Timers (TIm) ------------------------------------------------------
     timers(
             ssRXeToTIm_ReTxTimerCmd,
-            ssRXeToTIm_ClrProbeTimer,
-            ssRXeToTIm_CloseTimer,
+            ssRXeToTIm_ProbeTimerCmd,
+            ssRXeToTIm_CloseTimerCmd,
             ssTXeToTIm_SetReTxTimer,
             ssTXeToTIm_SetProbeTimer,
             ssTImToSTt_SessCloseCmd,
@@ -663,12 +737,16 @@ void toe(
             ssRXeToTSt_TxSarQry,
             ssTStToRXe_TxSarRep,
             ssRXeToTIm_ReTxTimerCmd,
-            ssRXeToTIm_ClrProbeTimer,
-            ssRXeToTIm_CloseTimer,
+            ssRXeToTIm_ProbeTimerCmd,
+            ssRXeToTIm_CloseTimerCmd,
             ssRXeToEVe_Event,
             ssRXeToTAi_SessOpnSts,
             ssRXeToRAi_Notif,
+          #if TOE_BUF_POOL_CFG
+            ssRXeToBPl_MemWrCmd,
+          #else
             soMEM_RxP_WrCmd,
+          #endif
             soMEM_RxP_Data,
             siMEM_RxP_WrSts,
             soMMIO_RxMemWrErr,
@@ -687,7 +765,11 @@ void toe(
             ssRStToTXe_RxSarRep,
             ssTXeToTSt_TxSarQry,
             ssTStToTXe_TxSarRep,
+          #if TOE_BUF_POOL_CFG
+            ssTXeToBPl_MemRdCmd,
+          #else
             soMEM_TxP_RdCmd,
+          #endif
             siMEM_TxP_Data,
             ssTXeToTIm_SetReTxTimer,
             ssTXeToTIm_SetProbeTimer,
@@ -706,6 +788,13 @@ void toe(
              siTAIF_DReq,
              soTAIF_Data,
              soTAIF_Meta,
+             siTAIF_DscReq,
+           #if TOE_BUF_POOL_CFG
+             ssRAiToBPl_RdDsc,
+           #else
+             soTAIF_RdDsc,
+           #endif
+             siTAIF_RxCrd,
              siTAIF_LsnReq,
              soTAIF_LsnRep,
              ssRAiToPRt_OpnLsnPortReq,
@@ -714,7 +803,11 @@ void toe(
              ssTImToRAi_Notif,
              ssRAiToRSt_RxSarQry,
              ssRStToRAi_RxSarRep,
+           #if TOE_BUF_POOL_CFG
+             ssRAiToBPl_MemRdCmd,
+           #else
              soMEM_RxP_RdCmd,
+           #endif
              siMEM_RxP_Data,
              soMMIO_NotifDropCnt,
              soMMIO_MetaDropCnt,
@@ -728,7 +821,13 @@ void toe(
             siTAIF_Data,
             siTAIF_SndReq,
             soTAIF_SndRep,
+            siTAIF_SndDsc,
+            soTAIF_SndCpl,
+          #if TOE_BUF_POOL_CFG
+            ssTAiToBPl_MemWrCmd,
+          #else
             soMEM_TxP_WrCmd,
+          #endif
             soMEM_TxP_Data,
             siMEM_TxP_WrSts,
             ssTAiToSTt_SessStateReq,
@@ -753,6 +852,7 @@ void toe(
     //-- Ready signal generator -------------------------------------------
     pReady(
             sPRtToRdy_Ready,
+            sSLcToRdy_Ready,
             poNTS_Ready);
 
     #if TOE_FEATURE_USED_FOR_DEBUGGING
@@ -781,11 +881,16 @@ void toe(
  * @param[in]  siTAIF_DReq       APP data request from [TAIF].
  * @param[out] soTAIF_Data       APP data stream to [TAIF].
  * @param[out] soTAIF_Meta       APP metadata stream to [TAIF].
+ * @param[in]  siTAIF_DscReq     APP read descriptor request from [TAIF].
+ * @param[out] soTAIF_RdDsc      APP read descriptor to [TAIF].
+ * @param[in]  siTAIF_RxCrd      APP Rx buffer credit from [TAIF].
  * @param[in]  siTAIF_LsnReq     APP listen port request from [TAIF].
  * @param[out] soTAIF_LsnRep     APP listen port reply to [TAIF].
  * @param[in]  siTAIF_Data       APP data stream from [TAIF].
  * @param[in]  siTAIF_SndReq     APP request to send from [TAIF].
  * @param[out] soTAIF_SndRep     APP send reply to [TAIF].
+ * @param[in]  siTAIF_SndDsc     APP send descriptor from [TAIF].
+ * @param[out] soTAIF_SndCpl     APP send completion to [TAIF].
  * @param[in]  siTAIF_OpnReq     APP open port request from [TAIF].
  * @param[out] soTAIF_OpnRep     APP open port reply to [TAIF].
  * @param[in]  siTAIF_ClsReq     APP close connection request from [TAIF].
@@ -807,7 +912,7 @@ void toe(
  * @param[out] soCAM_SssUpdReq   Session update request to [CAM].
  * @param[in]  siCAM_SssUpdRep   Session update reply from [CAM].
  * @param[out] soDBG_SssRelCnt   Session release count (for DEBUG).
- * @param[out] soDBG_SssRegCnt   Session register count (foe DEBUG).
+ * @param[out] soDBG_SssRegCnt   Session counts {peak(31:16), live(15:0)} (for DEBUG).
  *******************************************************************************/
 #if HLS_VERSION == 2017
     void toe_top(
@@ -841,6 +946,9 @@ void toe(
         stream<TcpAppRdReq>                 &siTAIF_DReq,
         stream<TcpAppData>                  &soTAIF_Data,
         stream<TcpAppMeta>                  &soTAIF_Meta,
+        stream<TcpAppRdReq>                 &siTAIF_DscReq,
+        stream<TcpAppRdDsc>                 &soTAIF_RdDsc,
+        stream<TcpAppRxCrd>                 &siTAIF_RxCrd,
         //------------------------------------------------------
         //-- TAIF / Listen Port Interfaces
         //------------------------------------------------------
@@ -852,6 +960,8 @@ void toe(
         stream<TcpAppData>                  &siTAIF_Data,
         stream<TcpAppSndReq>                &siTAIF_SndReq,
         stream<TcpAppSndRep>                &soTAIF_SndRep,
+        stream<TcpAppSndDsc>                &siTAIF_SndDsc,
+        stream<TcpAppSndCpl>                &soTAIF_SndCpl,
         //------------------------------------------------------
         //-- TAIF / Open connection Interfaces
         //------------------------------------------------------
@@ -891,7 +1001,7 @@ void toe(
         //-- DEBUG Interfaces
         //------------------------------------------------------
         stream<ap_uint<16> >                &soDBG_SssRelCnt,
-        stream<ap_uint<16> >                &soDBG_SssRegCnt,
+        stream<ap_uint<32> >                &soDBG_SssRegCnt,
         stream<RxBufPtr>                    &soDBG_RxFreeSpace,
         stream<ap_uint<32> >                &soDBG_TcpIpRxByteCnt,
         stream<ap_uint< 8> >                &soDBG_OooDebug
@@ -930,8 +1040,15 @@ void toe(
     #pragma HLS DATA_PACK                variable=soTAIF_Notif
     #pragma HLS RESOURCE core=AXI4Stream variable=soTAIF_Data     metadata="-bus_bundle soTAIF_Data"
     #pragma HLS RESOURCE core=AXI4Stream variable=soTAIF_Meta     metadata="-bus_bundle soTAIF_Meta"
+    #pragma HLS RESOURCE core=AXI4Stream variable=siTAIF_DscReq   metadata="-bus_bundle siTAIF_DscReq"
+    #pragma HLS DATA_PACK                variable=siTAIF_DscReq
+    #pragma HLS RESOURCE core=AXI4Stream variable=soTAIF_RdDsc    metadata="-bus_bundle soTAIF_RdDsc"
+    #pragma HLS DATA_PACK                variable=soTAIF_RdDsc
+    #pragma HLS RESOURCE core=AXI4Stream variable=siTAIF_RxCrd    metadata="-bus_bundle siTAIF_RxCrd"
+    #pragma HLS DATA_PACK                variable=siTAIF_RxCrd
      //-- TAIF / ROLE Rx Listen Interface -------------------------------------
     #pragma HLS RESOURCE core=AXI4Stream variable=siTAIF_LsnReq   metadata="-bus_bundle siTAIF_LsnReq"
+    #pragma HLS DATA_PACK                variable=siTAIF_LsnReq
     #pragma HLS RESOURCE core=AXI4Stream variable=soTAIF_LsnRep   metadata="-bus_bundle soTAIF_LsnRep"
     //-- TAIF / ROLE Tx Data Interfaces ---------------------------------------
     #pragma HLS RESOURCE core=AXI4Stream variable=siTAIF_Data     metadata="-bus_bundle siTAIF_Data"
@@ -939,6 +1056,10 @@ void toe(
     #pragma HLS DATA_PACK                variable=siTAIF_SndReq
     #pragma HLS RESOURCE core=AXI4Stream variable=soTAIF_SndRep   metadata="-bus_bundle soTAIF_SndRep"
     #pragma HLS DATA_PACK                variable=soTAIF_SndRep
+    #pragma HLS RESOURCE core=AXI4Stream variable=siTAIF_SndDsc   metadata="-bus_bundle siTAIF_SndDsc"
+    #pragma HLS DATA_PACK                variable=siTAIF_SndDsc
+    #pragma HLS RESOURCE core=AXI4Stream variable=soTAIF_SndCpl   metadata="-bus_bundle soTAIF_SndCpl"
+    #pragma HLS DATA_PACK                variable=soTAIF_SndCpl
     //-- TAIF / ROLE Tx Ctrl Interfaces ---------------------------------------
     #pragma HLS RESOURCE core=AXI4Stream variable=siTAIF_OpnReq   metadata="-bus_bundle siTAIF_OpnReq"
     #pragma HLS DATA_PACK                variable=siTAIF_OpnReq
@@ -1008,6 +1129,9 @@ void toe(
         siTAIF_DReq,
         soTAIF_Data,
         soTAIF_Meta,
+        siTAIF_DscReq,
+        soTAIF_RdDsc,
+        siTAIF_RxCrd,
         //-- TAIF / Listen Port Interfaces
         siTAIF_LsnReq,
         soTAIF_LsnRep,
@@ -1015,6 +1139,8 @@ void toe(
         siTAIF_Data,
         siTAIF_SndReq,
         soTAIF_SndRep,
+        siTAIF_SndDsc,
+        soTAIF_SndCpl,
         //-- TAIF / Open connection Interfaces
         siTAIF_OpnReq,
         soTAIF_OpnRep,
@@ -1084,6 +1210,9 @@ void toe(
         stream<TcpAppRdReq>                 &siTAIF_DReq,
         stream<TcpAppData>                  &soTAIF_Data,
         stream<TcpAppMeta>                  &soTAIF_Meta,
+        stream<TcpAppRdReq>                 &siTAIF_DscReq,
+        stream<TcpAppRdDsc>                 &soTAIF_RdDsc,
+        stream<TcpAppRxCrd>                 &siTAIF_RxCrd,
         //------------------------------------------------------
         //-- TAIF / Listen Port Interfaces
         //------------------------------------------------------
@@ -1095,6 +1224,8 @@ void toe(
         stream<TcpAppData>                  &siTAIF_Data,
         stream<TcpAppSndReq>                &siTAIF_SndReq,
         stream<TcpAppSndRep>                &soTAIF_SndRep,
+        stream<TcpAppSndDsc>                &siTAIF_SndDsc,
+        stream<TcpAppSndCpl>                &soTAIF_SndCpl,
         //------------------------------------------------------
         //-- TAIF / Open connection Interfaces
         //------------------------------------------------------
@@ -1134,7 +1265,7 @@ void toe(
         //-- DEBUG Interfaces
         //------------------------------------------------------
         stream<ap_uint<16> >                &soDBG_SssRelCnt,
-        stream<ap_uint<16> >                &soDBG_SssRegCnt,
+        stream<ap_uint<32> >                &soDBG_SssRegCnt,
         stream<RxBufPtr>                    &soDBG_RxFreeSpace,
         stream<ap_uint<32> >                &soDBG_TcpIpRxByteCnt,
         stream<ap_uint< 8> >                &soDBG_OooDebug
@@ -1169,8 +1300,15 @@ void toe(
     #pragma HLS DATA_PACK                variable=soTAIF_Notif
     #pragma HLS INTERFACE axis off           port=soTAIF_Data     name=soTAIF_Data
     #pragma HLS INTERFACE axis off           port=soTAIF_Meta     name=soTAIF_Meta
+    #pragma HLS INTERFACE axis off           port=siTAIF_DscReq   name=siTAIF_DscReq
+    #pragma HLS DATA_PACK                variable=siTAIF_DscReq
+    #pragma HLS INTERFACE axis off           port=soTAIF_RdDsc    name=soTAIF_RdDsc
+    #pragma HLS DATA_PACK                variable=soTAIF_RdDsc
+    #pragma HLS INTERFACE axis off           port=siTAIF_RxCrd    name=siTAIF_RxCrd
+    #pragma HLS DATA_PACK                variable=siTAIF_RxCrd
     //-- TAIF / ROLE Rx Listen Interface ---------------------------------------
     #pragma HLS INTERFACE axis off           port=siTAIF_LsnReq   name=siTAIF_LsnReq
+    #pragma HLS DATA_PACK                variable=siTAIF_LsnReq
     #pragma HLS INTERFACE axis off           port=soTAIF_LsnRep   name=soTAIF_LsnRep
     //-- TAIF / ROLE Tx Data Interfaces ----------------------------------------
     #pragma HLS INTERFACE axis off           port=siTAIF_Data     name=siTAIF_Data
@@ -1178,6 +1316,10 @@ void toe(
     #pragma HLS DATA_PACK                variable=siTAIF_SndReq
     #pragma HLS INTERFACE axis off           port=soTAIF_SndRep   name=soTAIF_SndRep
     #pragma HLS DATA_PACK                variable=soTAIF_SndRep
+    #pragma HLS INTERFACE axis off           port=siTAIF_SndDsc   name=siTAIF_SndDsc
+    #pragma HLS DATA_PACK                variable=siTAIF_SndDsc
+    #pragma HLS INTERFACE axis off           port=soTAIF_SndCpl   name=soTAIF_SndCpl
+    #pragma HLS DATA_PACK                variable=soTAIF_SndCpl
     //-- TAIF / ROLE Tx Ctrl Interfaces ----------------------------------------
     #pragma HLS INTERFACE axis off           port=siTAIF_OpnReq   name=siTAIF_OpnReq
     #pragma HLS DATA_PACK                variable=siTAIF_OpnReq
@@ -1254,6 +1396,9 @@ void toe(
         siTAIF_DReq,
         soTAIF_Data,
         soTAIF_Meta,
+        siTAIF_DscReq,
+        soTAIF_RdDsc,
+        siTAIF_RxCrd,
         //-- TAIF / Listen Port Interfaces
         siTAIF_LsnReq,
         soTAIF_LsnRep,
@@ -1261,6 +1406,8 @@ void toe(
         siTAIF_Data,
         siTAIF_SndReq,
         soTAIF_SndRep,
+        siTAIF_SndDsc,
+        soTAIF_SndCpl,
         //-- TAIF / Open connection Interfaces
         siTAIF_OpnReq,
         soTAIF_OpnRep,
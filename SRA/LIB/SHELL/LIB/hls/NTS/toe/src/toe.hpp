@@ -88,9 +88,12 @@ EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 //--  FYI: MSS is rounded modulo 8 bytes for better efficiency.
 static const TcpSegLen MY_MSS = (MTU - IP4_HEADER_LEN - TCP_HEADER_LEN) & ~0x7; // 1456
 
-//-- The Maximum Segment Size (MSS) that can be transmitted by TOE
-//--  FYI: This MSS is advertised by the remote host during the 3-may handshake.
-static const TcpSegLen THEIR_MSS = ZYC2_MSS; // 1352
+//-- The default Maximum Segment Size (MSS) that can be transmitted by TOE
+//--  FYI: The actual MSS is advertised by the remote host during the 3-way
+//--   handshake and is kept per session in the TxSarTable, capped to MY_MSS.
+//--   This default applies when the remote host does not advertise any MSS
+//--   [RFC-9293].
+static const TcpSegLen THEIR_MSS = 536;
 
 
 /*******************************************************************************
@@ -99,6 +102,8 @@ static const TcpSegLen THEIR_MSS = ZYC2_MSS; // 1352
 #define TOE_SIZEOF_LISTEN_PORT_TABLE    0x8000
 #define TOE_SIZEOF_ACTIVE_PORT_TABLE    0x8000
 #define TOE_FIRST_EPHEMERAL_PORT_NUM    0x8000 // Dynamic ports are in the range 32768..65535
+#define TOE_DUP_ACK_THRESHOLD           3      // Duplicate ACKs triggering a fast retransmit [RFC-5681]
+#define TOE_MAX_OOO_BLOCKS              4      // Out-of-order blocks kept (and SACK'ed) per session [RFC-2018]
 
 #define TOE_FEATURE_USED_FOR_DEBUGGING  0
 
@@ -107,13 +112,18 @@ extern uint32_t      packetCounter;  // [FIXME] Remove
 extern uint32_t      idleCycCnt;     // [FIXME] Remove
 extern unsigned int  gSimCycCnt;     // [FIXME] Remove
 
+//-- The timers (i.e. RTO, probe and close timers) are expressed in ticks of the
+//--  timing wheel. They do not depend on the number of sessions anymore.
+//-- The delayed-ACK and Rx notification timeouts (ACKD_TIMEOUT, RXNOTIF_TIMEOUT)
+//--  are expressed in clock cycles.
 #ifndef __SYNTHESIS__
   // HowTo - You should adjust the value of 'TIME_1s' such that the testbench
   //   works with your longest segment. In other words, if 'TIME_1s' is too short
   //   and/or your segment is too long, you may experience retransmission events
   //   (RT) which will break the test. You may want to use 'siIPRX_OneSeg.dat' or
   //   'siIPRX_TwoSeg.dat' to tune this parameter.
-  static const ap_uint<32> TIME_1s        =   250;
+  static const ap_uint<32> TOE_TIMER_TICK =     8;  // In clock cycles
+  static const ap_uint<32> TIME_1s        =   250;  // In timer ticks
 
   static const ap_uint<32> TIME_1us       = (((ap_uint<32>)(TIME_1s/1000000) > 1) ? (ap_uint<32>)(TIME_1s/1000000) : (ap_uint<32>)1);
   static const ap_uint<32> TIME_64us      = (((ap_uint<32>)(TIME_1s/  15625) > 1) ? (ap_uint<32>)(TIME_1s/  15625) : (ap_uint<32>)1);
@@ -121,13 +131,8 @@ extern unsigned int  gSimCycCnt;     // [FIXME] Remove
   static const ap_uint<32> TIME_256us     = (((ap_uint<32>)(TIME_1s/  62500) > 1) ? (ap_uint<32>)(TIME_1s/  62500) : (ap_uint<32>)1);
   static const ap_uint<32> TIME_512us     = (((ap_uint<32>)(TIME_1s/ 125000) > 1) ? (ap_uint<32>)(TIME_1s/ 125000) : (ap_uint<32>)1);
 
-  static const ap_uint<32> ACKD_1us       = (  1.0/0.0064/TOE_MAX_SESSIONS/10) + 1;
-  static const ap_uint<32> ACKD_2us       = (  2.0/0.0064/TOE_MAX_SESSIONS/10) + 1;
-  static const ap_uint<32> ACKD_4us       = (  4.0/0.0064/TOE_MAX_SESSIONS/10) + 1;
-  static const ap_uint<32> ACKD_8us       = (  8.0/0.0064/TOE_MAX_SESSIONS/10) + 1;
-  static const ap_uint<32> ACKD_16us      = ( 16.0/0.0064/TOE_MAX_SESSIONS/10) + 1;
-  static const ap_uint<32> ACKD_32us      = ( 32.0/0.0064/TOE_MAX_SESSIONS/10) + 1;
-  static const ap_uint<32> ACKD_64us      = ( 64.0/0.0064/TOE_MAX_SESSIONS/10) + 1;
+  static const ap_uint<32> ACKD_TIMEOUT   = (TOE_ACK_DELAY_US_CFG/0.0064/10) + 1;
+  static const ap_uint<32> RXNOTIF_TIMEOUT= (TOE_RX_NOTIF_DELAY_US_CFG/0.0064/10) + 1;
 
   static const ap_uint<32> TIME_1ms       = (((ap_uint<32>)(TIME_1s/1000) > 1) ? (ap_uint<32>)(TIME_1s/1000) : (ap_uint<32>)1);
   static const ap_uint<32> TIME_5ms       = (((ap_uint<32>)(TIME_1s/ 200) > 1) ? (ap_uint<32>)(TIME_1s/ 200) : (ap_uint<32>)1);
@@ -135,6 +140,23 @@ extern unsigned int  gSimCycCnt;     // [FIXME] Remove
   static const ap_uint<32> TIME_50ms      = (((ap_uint<32>)(TIME_1s/  20) > 1) ? (ap_uint<32>)(TIME_1s/  20) : (ap_uint<32>)1);
   static const ap_uint<32> TIME_100ms     = (((ap_uint<32>)(TIME_1s/  10) > 1) ? (ap_uint<32>)(TIME_1s/  10) : (ap_uint<32>)1);
   static const ap_uint<32> TIME_250ms     = (((ap_uint<32>)(TIME_1s/   4) > 1) ? (ap_uint<32>)(TIME_1s/   4) : (ap_uint<32>)1);
+#else
+  static const ap_uint<32> TOE_TIMER_TICK =  15625; // In clock cycles (i.e. 100us @ 6.4ns)
+  static const ap_uint<32> TIME_1s        =  10000; // In timer ticks
+
+  static const ap_uint<32> ACKD_TIMEOUT   = (TOE_ACK_DELAY_US_CFG/0.0064) + 1;
+  static const ap_uint<32> RXNOTIF_TIMEOUT= (TOE_RX_NOTIF_DELAY_US_CFG/0.0064) + 1;
+  static const ap_uint<32> TIME_128us     =      1;  // Rounded to a tick
+  static const ap_uint<32> TIME_256us     =      3;  // Rounded to a tick
+  static const ap_uint<32> TIME_512us     =      5;  // Rounded to a tick
+
+  static const ap_uint<32> TIME_1ms       =     10;
+  static const ap_uint<32> TIME_5ms       =     50;
+  static const ap_uint<32> TIME_25ms      =    250;
+  static const ap_uint<32> TIME_50ms      =    500;
+  static const ap_uint<32> TIME_100ms     =   1000;
+  static const ap_uint<32> TIME_250ms     =   2500;
+#endif
 
   static const ap_uint<32> TIME_3s        = (  3*TIME_1s);
   static const ap_uint<32> TIME_5s        = (  5*TIME_1s);
@@ -147,38 +169,33 @@ extern unsigned int  gSimCycCnt;     // [FIXME] Remove
   static const ap_uint<32> TIME_30s       = ( 30*TIME_1s);
   static const ap_uint<32> TIME_60s       = ( 60*TIME_1s);
   static const ap_uint<32> TIME_120s      = (120*TIME_1s);
+
+  //-- Retransmission Timeout (RTO) bounds [RFC-6298] - In timer ticks
+  //--  The lower bound is deliberately smaller than the 1s recommended by the
+  //--  RFC because our datacenter round-trip times are in the 10s of us. In
+  //--  simulation, it must cover the latency of the testbench for a full MSS.
+  static const ap_uint<32> TOE_RTO_INIT   = TIME_1s;  // Before any RTT sample
+#ifndef __SYNTHESIS__
+  static const ap_uint<32> TOE_RTO_MIN    = 64;       // i.e. 512 clock cycles
 #else
-  static const ap_uint<32> ACKD_1us       = (  1.0/0.0064/TOE_MAX_SESSIONS) + 1;
-  static const ap_uint<32> ACKD_2us       = (  2.0/0.0064/TOE_MAX_SESSIONS) + 1;
-  static const ap_uint<32> ACKD_4us       = (  4.0/0.0064/TOE_MAX_SESSIONS) + 1;
-  static const ap_uint<32> ACKD_8us       = (  8.0/0.0064/TOE_MAX_SESSIONS) + 1;
-  static const ap_uint<32> ACKD_16us      = ( 16.0/0.0064/TOE_MAX_SESSIONS) + 1;
-  static const ap_uint<32> ACKD_32us      = ( 32.0/0.0064/TOE_MAX_SESSIONS) + 1;
-  static const ap_uint<32> ACKD_64us      = ( 64.0/0.0064/TOE_MAX_SESSIONS) + 1;
-  static const ap_uint<32> TIME_128us     = (128.0/0.0064/TOE_MAX_SESSIONS) + 1;
-  static const ap_uint<32> TIME_256us     = (256.0/0.0064/TOE_MAX_SESSIONS) + 1;
-  static const ap_uint<32> TIME_512us     = (512.0/0.0064/TOE_MAX_SESSIONS) + 1;
-
-  static const ap_uint<32> TIME_1ms       = (  1.0/0.0000064/TOE_MAX_SESSIONS) + 1;
-  static const ap_uint<32> TIME_5ms       = (  5.0/0.0000064/TOE_MAX_SESSIONS) + 1;
-  static const ap_uint<32> TIME_25ms      = ( 25.0/0.0000064/TOE_MAX_SESSIONS) + 1;
-  static const ap_uint<32> TIME_50ms      = ( 50.0/0.0000064/TOE_MAX_SESSIONS) + 1;
-  static const ap_uint<32> TIME_100ms     = (100.0/0.0000064/TOE_MAX_SESSIONS) + 1;
-  static const ap_uint<32> TIME_250ms     = (250.0/0.0000064/TOE_MAX_SESSIONS) + 1;
-
-  static const ap_uint<32> TIME_1s        = (  1.0/0.0000000064/TOE_MAX_SESSIONS) + 1;
-  static const ap_uint<32> TIME_3s        = (  3.0/0.0000000064/TOE_MAX_SESSIONS) + 1;
-  static const ap_uint<32> TIME_5s        = (  5.0/0.0000000064/TOE_MAX_SESSIONS) + 1;
-  static const ap_uint<32> TIME_6s        = (  6.0/0.0000000064/TOE_MAX_SESSIONS) + 1;
-  static const ap_uint<32> TIME_7s        = (  7.0/0.0000000064/TOE_MAX_SESSIONS) + 1;
-  static const ap_uint<32> TIME_10s       = ( 10.0/0.0000000064/TOE_MAX_SESSIONS) + 1;
-  static const ap_uint<32> TIME_12s       = ( 12.0/0.0000000064/TOE_MAX_SESSIONS) + 1;
-  static const ap_uint<32> TIME_15s       = ( 15.0/0.0000000064/TOE_MAX_SESSIONS) + 1;
-  static const ap_uint<32> TIME_20s       = ( 20.0/0.0000000064/TOE_MAX_SESSIONS) + 1;
-  static const ap_uint<32> TIME_30s       = ( 30.0/0.0000000064/TOE_MAX_SESSIONS) + 1;
-  static const ap_uint<32> TIME_60s       = ( 60.0/0.0000000064/TOE_MAX_SESSIONS) + 1;
-  static const ap_uint<32> TIME_120s      = (120.0/0.0000000064/TOE_MAX_SESSIONS) + 1;
+  static const ap_uint<32> TOE_RTO_MIN    = 2;        // i.e. 200us
 #endif
+  static const ap_uint<32> TOE_RTO_MAX    = TIME_60s;
+
+  //-- Keepalive timings [RFC-1122] - In timer ticks
+  static const ap_uint<32> TOE_KEEPALIVE_IDLE  = (TOE_KEEPALIVE_IDLE_S_CFG  * TIME_1s);
+  static const ap_uint<32> TOE_KEEPALIVE_INTVL = (TOE_KEEPALIVE_INTVL_S_CFG * TIME_1s);
+  static const ap_uint<32> TOE_KEEPALIVE_FAST_IDLE  = (TOE_KEEPALIVE_FAST_IDLE_S_CFG  * TIME_1s);
+  static const ap_uint<32> TOE_KEEPALIVE_FAST_INTVL = (TOE_KEEPALIVE_FAST_INTVL_S_CFG * TIME_1s);
+
+  //-- Durations of the TIME-WAIT state (i.e. 2*MSL) - In timer ticks
+  static const ap_uint<32> TOE_TIME_WAIT       = (TOE_TIME_WAIT_S_CFG * TIME_1s);
+  static const ap_uint<32> TOE_TIME_WAIT_SHORT = ((TOE_TIME_WAIT_SHORT_MS_CFG*TIME_1s/1000) > 1) ?
+                                                 (ap_uint<32>)(TOE_TIME_WAIT_SHORT_MS_CFG*TIME_1s/1000) : (ap_uint<32>)1;
+
+  //-- Lifetime of a SYN cookie - In timer ticks
+  //--  A cookie is accepted during the slot it was issued in and the next one.
+  static const ap_uint<32> TOE_SYN_COOKIE_SLOT = TIME_60s;
 
 
 /*******************************************************************************
@@ -209,26 +226,37 @@ const int cDepth_AKdToTXe_Event =  16;
 const int cDepth_EVeToAKd_Event =   8;
 
 const int cDepth_RAiToRSt_Qry   =   4;
+const int cDepth_RAiToBPl_Cmd   =   4;
 
 const int cDepth_RXeToEVe_Event =  64;
 const int cDepth_RXeToRSt_Qry   =   4;
 const int cDepth_RXeToTSt_Qry   =   4;
+const int cDepth_RXeToBPl_Cmd   =   4;
+
+const int cDepth_RStToBPl_Rel   =   4;
 
 const int cDepth_STtToRXe_Rep   =   2;
 const int cDepth_STtToTAi_Rep   =   2;
 
 const int cDepth_TAiToEVe_Event =   8;
 const int cDepth_TAiToTSt_Cmd   =   4;
+const int cDepth_TAiToBPl_Cmd   =   4;
 
 const int cDepth_TStToRXe_Rep   =   2;
 const int cDepth_TStToTAi_Cmd   =   4;
 const int cDepth_TStToTXe_Rep   =   2;
+const int cDepth_TStToBPl_Rel   =   4;
 
 const int cDepth_TImToEVe_Event =   4;
 
 const int cDepth_TXeToEVe_Event =   8;
 const int cDepth_TXeToRSt_Req   =   4;
 const int cDepth_TXeToTSt_Qry   =   4;
+const int cDepth_TXeToBPl_Cmd   =   4;
+
+//-- Streams which must hold an entire segment (e.g. for the checksum computation)
+//--  FYI: 256 chunks of 8 bytes per 2KB of MTU (.i.e, 256 for 1500, 1280 for 9000)
+const int cDepth_FullSegment    = 256 * ((MTU + 2047) / 2048);
 
 /*******************************************************************************
  * GENERAL ENUMERATIONS
@@ -271,7 +299,8 @@ typedef ap_uint< 1> tLast;
 //-- TOE - EVENT TYPES
 //---------------------------------------------------------
 enum EventType { TX_EVENT=0,    RT_EVENT,  ACK_EVENT, SYN_EVENT, \
-                 SYN_ACK_EVENT, FIN_EVENT, RST_EVENT, ACK_NODELAY_EVENT };
+                 SYN_ACK_EVENT, FIN_EVENT, RST_EVENT, ACK_NODELAY_EVENT, \
+                 KEEPALIVE_EVENT, SYN_COOKIE_EVENT, ACK_COALESCE_EVENT };
 
 //---------------------------------------------------------
 //-- TOE - SESSION STATE
@@ -284,19 +313,63 @@ typedef TcpAppOpnRep SessState;  // TCP state according to RFC-793
 typedef ap_uint<15> TcpStaPort;  // TCP Static  Port [0x0000..0x7FFF]
 typedef ap_uint<15> TcpDynPort;  // TCP Dynamic Port [0x8000..0xFFFF]
 
+class PortStsRep {  // The state of a port, plus the options of a listening port
+  public:
+    StsBit       opened;     // The port is opened
+    FlagBit      twShort;    // The sessions use the short TIME-WAIT duration
+    TcpAckPolicy ackPolicy;  // The ACK policy of the sessions (TOE_ACK_DEFAULT if none)
+    TcpKaProfile kaProfile;  // The keepalive profile of the sessions (TOE_KEEPALIVE_DEFAULT if none)
+    PortStsRep() {}
+    PortStsRep(StsBit opened) :
+        opened(opened), twShort(0), ackPolicy(TOE_ACK_DEFAULT), kaProfile(TOE_KEEPALIVE_DEFAULT) {}
+    PortStsRep(StsBit opened, FlagBit twShort, TcpAckPolicy ackPolicy, TcpKaProfile kaProfile) :
+        opened(opened), twShort(twShort), ackPolicy(ackPolicy), kaProfile(kaProfile) {}
+};
+
 //---------------------------------------------------------
 //-- TOE - Some Rx & Tx SAR Types
 //---------------------------------------------------------
 typedef TcpSeqNum   RxSeqNum;     // A sequence number received from the network layer
 typedef TcpAckNum   TxAckNum;     // An acknowledge number transmitted to the network layer
-typedef TcpWindow   RemotWinSize; // A remote window size
-typedef TcpWindow   LocalWinSize; // A local  window size
+typedef ap_uint<TOE_WINDOW_BITS> RemotWinSize; // A remote window size (after scaling)
+typedef ap_uint<TOE_WINDOW_BITS> LocalWinSize; // A local  window size (after scaling)
+typedef ap_uint<24> RttTime;      // A round-trip time or a timeout (in timer ticks)
+typedef ap_uint<32> TimeTick;     // A free running time stamp (in timer ticks)
+typedef ap_uint<TOE_WINDOW_BITS+1> CcByteCnt; // A byte counter of the congestion control
+typedef ap_uint<3>  OooCnt;       // A number of out-of-order blocks [0..TOE_MAX_OOO_BLOCKS]
+
+//---------------------------------------------------------
+//-- TOE - SYN Cookie Types
+//--  A SYN cookie is the initial sequence number of a state-
+//--  less SYN-ACK. Its upper bits hold the information of the
+//--  SYN which is restored with the session, and its lower
+//--  bits hold a keyed hash of the connection.
+//---------------------------------------------------------
+typedef ap_uint<3>  SynCookieSlot; // A time slot of TOE_SYN_COOKIE_SLOT ticks (modulo 8)
+typedef ap_uint<10> SynCookieInfo; // [9:7]=Slot, [6:5]=MSS index, [4]=SACK-Permitted, [3:0]=Window Scale+1 (0 if none)
 
 typedef ap_uint<32>              RxMemPtr;  // A pointer to RxMemBuff ( 4GB)  [FIXME <33>]
 typedef ap_uint<32>              TxMemPtr;  // A pointer to TxMemBuff ( 4GB)  [FIXME <33>]
-typedef ap_uint<TOE_WINDOW_BITS> TcpBufAdr; // A TCP buffer address   (64KB)
-typedef TcpBufAdr                RxBufPtr;  // A pointer to RxSessBuf (64KB)
-typedef TcpBufAdr                TxBufPtr;  // A pointer to TxSessBuf (64KB)
+typedef ap_uint<TOE_WINDOW_BITS> TcpBufAdr; // A TCP buffer address   (64KB by default)
+typedef TcpBufAdr                RxBufPtr;  // A pointer to RxSessBuf (64KB by default)
+typedef TcpBufAdr                TxBufPtr;  // A pointer to TxSessBuf (64KB by default)
+
+//---------------------------------------------------------
+//-- TOE - Buffer Pool Types
+//--  A virtual page number is made of the session ID and of
+//--  the index of a page within the buffer of that session.
+//---------------------------------------------------------
+typedef ap_uint<30-TOE_PAGE_BITS>              BufPageNum; // A page number in a 1GB Rx or Tx memory
+typedef ap_uint<TOE_WINDOW_BITS-TOE_PAGE_BITS+1> BufPageCnt; // A number of pages within a buffer
+
+class BufPageRel {  // A release of pages which hold no more live bytes
+  public:
+    BufPageNum  vpn;    // The first virtual page to release
+    BufPageCnt  cnt;    // The number of consecutive pages (within the same buffer)
+    BufPageRel() {}
+    BufPageRel(BufPageNum vpn, BufPageCnt cnt) :
+        vpn(vpn), cnt(cnt) {}
+};
 
 //---------------------------------------------------------
 //--  SOCKET ADDRESS (alias ipTuple)
@@ -362,6 +435,19 @@ class StateQuery {
         sessionID(id), state(state), write(QUERY_WR) {}
 };
 
+//=========================================================
+//== RSt / Out-of-Order Block
+//==  A contiguous block of bytes received above 'rcvd' [RFC-2018].
+//=========================================================
+class OooBlock {
+  public:
+    RxSeqNum    left;    // SeqNum of the first byte of the block
+    RxSeqNum    right;   // SeqNum immediately following the last byte of the block
+    OooBlock() {}
+    OooBlock(RxSeqNum left, RxSeqNum right) :
+        left(left), right(right) {}
+};
+
 //=========================================================
 //== RSt / Generic Reply (Same as RxSarEntry)
 //=========================================================
@@ -369,12 +455,22 @@ class RxSarReply {
   public:
     RxBufPtr    appd;
     RxSeqNum    rcvd;    // Last received SeqNum
-    RxSeqNum    oooHead;
-    RxSeqNum    oooTail;
+    RxSeqNum    oooHead; // Right edge of the highest out-of-order block
     FlagBool    ooo;
+    OooCnt      oooCnt;  // Number of out-of-order blocks (most recently updated first)
+    OooBlock    oooBlk[TOE_MAX_OOO_BLOCKS];
+    FlagBit     ce;      // Last received segment was marked Congestion Experienced
+    TcpOptWss   winScale; // Shift count applied to the window we advertise
+    FlagBool    sackOk;  // The peer accepts SACK options [RFC-2018]
     RxSarReply() {}
-    RxSarReply(RxBufPtr appd, RxSeqNum rcvd, StsBool ooo, RxSeqNum oooHead, RxSeqNum oooTail) :
-        appd(appd), rcvd(rcvd), ooo(ooo), oooHead(oooHead), oooTail(oooTail) {}
+    RxSarReply(RxBufPtr appd, RxSeqNum rcvd, StsBool ooo, RxSeqNum oooHead, OooCnt oooCnt,
+               const OooBlock oooBlk[TOE_MAX_OOO_BLOCKS], FlagBit ce, TcpOptWss winScale, FlagBool sackOk) :
+        appd(appd), rcvd(rcvd), ooo(ooo), oooHead(oooHead), oooCnt(oooCnt), ce(ce), winScale(winScale), sackOk(sackOk) {
+        for (int i=0; i<TOE_MAX_OOO_BLOCKS; i++) {
+            #pragma HLS UNROLL
+            this->oooBlk[i] = oooBlk[i];
+        }
+    }
 };
 
 //=========================================================
@@ -385,42 +481,62 @@ class RXeRxSarQuery {
     SessionId   sessionID;
     RxSeqNum    rcvd;      // Last received SeqNum
     RxSeqNum    oooHead;
-    RxSeqNum    oooTail;
     FlagBool    ooo;
+    OooCnt      oooCnt;
+    OooBlock    oooBlk[TOE_MAX_OOO_BLOCKS];
+    FlagBit     ce;        // Segment was marked Congestion Experienced
+    TcpOptWss   winScale;  // Shift count applied to the window we advertise (init only)
+    FlagBool    sackOk;    // The peer accepts SACK options (init only)
     RdWrBit     write;
     CmdBit      init;
+    RxBufPtr    spill;     // Bytes written past the end of the buffer (into the spill region)
     RXeRxSarQuery() :
-        ooo(false) {}
+        ooo(false), oooCnt(0), ce(0), winScale(0), sackOk(false), spill(0) {}
     // Read queries
     RXeRxSarQuery(SessionId id) :
-        sessionID(id), rcvd(0),    ooo(false), oooHead(0), oooTail(0), write(QUERY_RD), init(0) {}
+        sessionID(id), rcvd(0),    oooHead(0), ooo(false),    oooCnt(0), ce(0), winScale(0), sackOk(false), write(QUERY_RD), init(0), spill(0) {}
     RXeRxSarQuery(SessionId id, RdWrBit wrBit) :
-        sessionID(id), rcvd(0),    ooo(FLAG_INO), oooHead(0), oooTail(0), write(QUERY_RD), init(0) {}
+        sessionID(id), rcvd(0),    oooHead(0), ooo(FLAG_INO), oooCnt(0), ce(0), winScale(0), sackOk(false), write(QUERY_RD), init(0), spill(0) {}
     // Write query - When in order processing
     RXeRxSarQuery(SessionId id, RxSeqNum rcvd, RdWrBit wrBit) :
-        sessionID(id), rcvd(rcvd), ooo(FLAG_INO), oooHead(0), oooTail(0), write(QUERY_WR), init(0) {}
+        sessionID(id), rcvd(rcvd), oooHead(0), ooo(FLAG_INO), oooCnt(0), ce(0), winScale(0), sackOk(false), write(QUERY_WR), init(0), spill(0) {}
     // Init query
     RXeRxSarQuery(SessionId id, RxSeqNum rcvd, RdWrBit wrBit, CmdBit iniBit) :
-        sessionID(id), rcvd(rcvd), ooo(FLAG_INO), oooHead(0), oooTail(0), write(QUERY_WR), init(CMD_INIT) {}
-    // Write query - When in out-of-order processing
-    RXeRxSarQuery(SessionId id, RxSeqNum rcvd, FlagBool ooo, RxSeqNum oooHead, RxSeqNum oooTail, RdWrBit wrBit) :
-        sessionID(id), rcvd(rcvd), ooo(ooo), oooHead(oooHead), oooTail(oooTail), write(QUERY_WR), init(0) {}
-
+        sessionID(id), rcvd(rcvd), oooHead(0), ooo(FLAG_INO), oooCnt(0), ce(0), winScale(0), sackOk(false), write(QUERY_WR), init(CMD_INIT), spill(0) {}
+    RXeRxSarQuery(SessionId id, RxSeqNum rcvd, TcpOptWss winScale, FlagBool sackOk, RdWrBit wrBit, CmdBit iniBit) :
+        sessionID(id), rcvd(rcvd), oooHead(0), ooo(FLAG_INO), oooCnt(0), ce(0), winScale(winScale), sackOk(sackOk), write(QUERY_WR), init(CMD_INIT), spill(0) {}
+    // Write query - When receiving data (in-order or out-of-order)
+    RXeRxSarQuery(SessionId id, RxSeqNum rcvd, FlagBool ooo, RxSeqNum oooHead, OooCnt oooCnt,
+                  const OooBlock oooBlk[TOE_MAX_OOO_BLOCKS], FlagBit ce, RdWrBit wrBit) :
+        sessionID(id), rcvd(rcvd), oooHead(oooHead), ooo(ooo), oooCnt(oooCnt), ce(ce), winScale(0), sackOk(false), write(QUERY_WR), init(0), spill(0) {
+        for (int i=0; i<TOE_MAX_OOO_BLOCKS; i++) {
+            #pragma HLS UNROLL
+            this->oooBlk[i] = oooBlk[i];
+        }
+    }
 };
 
 //=========================================================
 //== RSt / Query from RAi
 //=========================================================
+#define RAI_QRY_APPD    0  // Set 'appd' and 'dscd' (streamed read)
+#define RAI_QRY_DSCD    1  // Set 'dscd' (bytes handed over with a descriptor)
+#define RAI_QRY_CRED    2  // Advance 'appd' by a credit (zero-copy read)
+typedef ap_uint<2> RAiQryType;
+
 class RAiRxSarQuery {
   public:
     SessionId       sessionID;
-    RxBufPtr        appd;  // Next byte to be consumed by [APP]
+    RxBufPtr        appd;  // Next byte to be consumed by [APP] (or the new 'dscd', or a credit)
     RdWrBit         write;
+    RAiQryType      type;  // The field(s) updated by a write
     RAiRxSarQuery() {}
     RAiRxSarQuery(SessionId id) :
-        sessionID(id), appd(0), write(0) {}
+        sessionID(id), appd(0), write(0), type(RAI_QRY_APPD) {}
     RAiRxSarQuery(SessionId id, RxBufPtr appd) :
-        sessionID(id), appd(appd), write(1) {}
+        sessionID(id), appd(appd), write(1), type(RAI_QRY_APPD) {}
+    RAiRxSarQuery(SessionId id, RxBufPtr val, RAiQryType type) :
+        sessionID(id), appd(val),  write(1), type(type) {}
 };
 
 //=========================================================
@@ -430,15 +546,46 @@ class RAiRxSarReply {
   public:
     SessionId       sessionID;
     RxBufPtr        appd;  // Next byte to be consumed by [APP]
+    RxBufPtr        dscd;  // Next byte to be handed over to [APP] with a descriptor
+    RxBufPtr        spillCur;   // Bytes of the lap of 'appd' held by the spill region
+    RxBufPtr        spillNext;  // Bytes of the next lap held by the spill region
     RAiRxSarReply() {}
     RAiRxSarReply(SessionId id, RxBufPtr appd) :
-        sessionID(id), appd(appd) {}
+        sessionID(id), appd(appd), dscd(appd), spillCur(0), spillNext(0) {}
+    RAiRxSarReply(SessionId id, RxBufPtr appd, RxBufPtr dscd) :
+        sessionID(id), appd(appd), dscd(dscd), spillCur(0), spillNext(0) {}
+    RAiRxSarReply(SessionId id, RxBufPtr appd, RxBufPtr dscd, RxBufPtr spillCur, RxBufPtr spillNext) :
+        sessionID(id), appd(appd), dscd(dscd), spillCur(spillCur), spillNext(spillNext) {}
 };
 
 /*******************************************************************************
  * Tx SAR Table (TSt)
  *******************************************************************************/
 
+//=========================================================
+//== TSt / Congestion Control State
+//==  The per-session state of the algorithm selected with
+//==  'TOE_CC_ALGO_CFG' (@see congestion_control.hpp).
+//=========================================================
+class CcState {
+  public:
+    CcByteCnt       bytesAcked;   // Bytes ACK'ed since the last increase in congestion avoidance
+  #if (TOE_CC_ALGO_CFG == TOE_CC_CUBIC)
+    LocalWinSize    wMax;         // Window size just before the last reduction
+    LocalWinSize    origin;       // Origin point of the cubic function
+    RttTime         k;            // Time to reach 'origin' from the start of the epoch
+    TimeTick        epochTick;    // Start of the current congestion avoidance epoch
+    bool            epochStarted;
+  #elif (TOE_CC_ALGO_CFG == TOE_CC_DCTCP)
+    ap_uint<11>     alpha;        // Estimate of the fraction of marked bytes (x1024)
+    TxAckNum        windowEnd;    // End of the current observation window
+    CcByteCnt       bytesTotal;   // Bytes ACK'ed  within the current observation window
+    CcByteCnt       bytesMarked;  // Bytes ECE'ed  within the current observation window
+    bool            reduced;      // Window was already reduced within the observation window
+  #endif
+    CcState() {}
+};
+
 //=========================================================
 //== TSt / Query from RXe
 //=========================================================
@@ -450,16 +597,47 @@ class RXeTxSarQuery {
     LocalWinSize    cong_window;  // Local receiver's buffer size  (my)
     ap_uint<2>      count;
     CmdBool         fastRetransmitted;
+    CmdBool         wsInit;       // Set the window shift count and the MSS of the remote receiver
+    CmdBit          init;         // Initialize the entry as [TXe] does upon a SYN-ACK (SYN cookie only)
+    TcpOptWss       recv_win_scale; // Shift count to apply to the 'recv_window' of the remote receiver
+    TcpSegLen       mss;          // Maximum segment size to send to the remote receiver (only with 'wsInit')
+    CmdBool         ccUpdate;     // Update the congestion control fields below
+    LocalWinSize    slowstart_threshold;
+    TxAckNum        recover;      // Highest sequence number sent when entering fast recovery [RFC-6582]
+    CcState         cc;           // Congestion control state
+    CmdBool         rttUpdate;    // Update the RTT estimator fields below
+    RttTime         srtt;         // Smoothed round-trip time (x8)
+    RttTime         rttvar;       // Round-trip time variation (x4)
+    RttTime         rto;          // Retransmission timeout
+    FlagBool        sackValid;    // The ACK carries a SACK block (only with 'ccUpdate')
+    TxAckNum        sackLeft;     // Left edge of the lowest block SACK'ed by the peer [RFC-2018]
     RdWrBit         write;
 
     RXeTxSarQuery () :
-        fastRetransmitted(false) {}
+        fastRetransmitted(false), wsInit(false), init(0), recv_win_scale(0), ccUpdate(false), rttUpdate(false), sackValid(false) {}
     // Read Query
     RXeTxSarQuery(SessionId id, RdWrBit wrBit) :
-        sessionID(id), fastRetransmitted(false), write(QUERY_RD) {}
-    // Write Query
+        sessionID(id), fastRetransmitted(false), wsInit(false), init(0), recv_win_scale(0), ccUpdate(false), rttUpdate(false), sackValid(false), write(QUERY_RD) {}
+    // Write Queries
     RXeTxSarQuery(SessionId id, TxAckNum ackd, RemotWinSize recv_win, LocalWinSize cong_win, ap_uint<2> count, CmdBool fastRetransmitted) :
-        sessionID(id), ackd(ackd), recv_window(recv_win), cong_window(cong_win), count(count), fastRetransmitted(fastRetransmitted), write(QUERY_WR) {}
+        sessionID(id), ackd(ackd), recv_window(recv_win), cong_window(cong_win), count(count), fastRetransmitted(fastRetransmitted),
+        wsInit(false), init(0), recv_win_scale(0), ccUpdate(false), rttUpdate(false), sackValid(false), write(QUERY_WR) {}
+    // Write Query - When the window scale and MSS options are negotiated (i.e. SYN or SYN-ACK)
+    RXeTxSarQuery(SessionId id, TxAckNum ackd, RemotWinSize recv_win, LocalWinSize cong_win, ap_uint<2> count, CmdBool fastRetransmitted,
+                  TcpOptWss recv_win_scale, TcpSegLen mss) :
+        sessionID(id), ackd(ackd), recv_window(recv_win), cong_window(cong_win), count(count), fastRetransmitted(fastRetransmitted),
+        wsInit(true), init(0), recv_win_scale(recv_win_scale), mss(mss), ccUpdate(false), rttUpdate(false), sackValid(false), write(QUERY_WR) {}
+    RXeTxSarQuery(SessionId id, TxAckNum ackd, RemotWinSize recv_win, LocalWinSize cong_win, ap_uint<2> count, CmdBool fastRetransmitted,
+                  LocalWinSize sstresh, TxAckNum recover, CcState cc, CmdBool rttUpdate, RttTime srtt, RttTime rttvar, RttTime rto,
+                  FlagBool sackValid, TxAckNum sackLeft) :
+        sessionID(id), ackd(ackd), recv_window(recv_win), cong_window(cong_win), count(count), fastRetransmitted(fastRetransmitted),
+        wsInit(false), init(0), recv_win_scale(0), ccUpdate(true), slowstart_threshold(sstresh), recover(recover), cc(cc),
+        rttUpdate(rttUpdate), srtt(srtt), rttvar(rttvar), rto(rto), sackValid(sackValid), sackLeft(sackLeft), write(QUERY_WR) {}
+    // Write Query - When a session is restored from a SYN cookie (i.e. with the ACK of that cookie)
+    RXeTxSarQuery(SessionId id, TxAckNum ackd, RemotWinSize recv_win, LocalWinSize cong_win,
+                  TcpOptWss recv_win_scale, TcpSegLen mss, CmdBit init) :
+        sessionID(id), ackd(ackd), recv_window(recv_win), cong_window(cong_win), count(0), fastRetransmitted(false),
+        wsInit(true), init(init), recv_win_scale(recv_win_scale), mss(mss), ccUpdate(false), rttUpdate(false), sackValid(false), write(QUERY_WR) {}
 };
 
 //=========================================================
@@ -469,13 +647,32 @@ class RXeTxSarReply {
   public:
     TxAckNum        prevAckd;  // Bytes TX'ed and ACK'ed
     TxAckNum        prevUnak;  // Bytes TX'ed but not ACK'ed
-    TcpWindow       cong_window;
-    TcpWindow       slowstart_threshold;
+    LocalWinSize    cong_window;
+    LocalWinSize    slowstart_threshold;
     ap_uint<2>      count;
     CmdBool         fastRetransmitted;
+    TxAckNum        recover;     // Highest sequence number sent when entering fast recovery
+    TxBufPtr        appw;        // Last byte written by APP
+    CcState         cc;          // Congestion control state
+    TimeTick        nowTick;     // Current time of the TSt clock
+    bool            rttPending;  // A segment is being timed
+    TxAckNum        rttSeq;      // Sequence number which is being timed
+    RttTime         rttElapsed;  // Ticks elapsed since 'rttSeq' was sent
+    RttTime         srtt;        // Smoothed round-trip time (x8)
+    RttTime         rttvar;      // Round-trip time variation (x4)
+    RttTime         rto;         // Current retransmission timeout
+    TcpSegLen       mss;         // Maximum segment size of the session
     RXeTxSarReply() {}
-    RXeTxSarReply(TxAckNum ackd, TxAckNum unak, TcpWindow cong_win, TcpWindow sstresh, ap_uint<2> count, CmdBool fastRetransmitted) :
-        prevAckd(ackd), prevUnak(unak), cong_window(cong_win), slowstart_threshold(sstresh), count(count), fastRetransmitted(fastRetransmitted) {}
+    RXeTxSarReply(TxAckNum ackd, TxAckNum unak, LocalWinSize cong_win, LocalWinSize sstresh, ap_uint<2> count, CmdBool fastRetransmitted) :
+        prevAckd(ackd), prevUnak(unak), cong_window(cong_win), slowstart_threshold(sstresh), count(count), fastRetransmitted(fastRetransmitted),
+        recover(unak), appw(unak), nowTick(0), rttPending(false), rttSeq(0), rttElapsed(0), srtt(0), rttvar(0), rto(TOE_RTO_INIT),
+        mss(THEIR_MSS) {}
+    RXeTxSarReply(TxAckNum ackd, TxAckNum unak, LocalWinSize cong_win, LocalWinSize sstresh, ap_uint<2> count, CmdBool fastRetransmitted,
+                  TxAckNum recover, TxBufPtr appw, CcState cc, TimeTick nowTick,
+                  bool rttPending, TxAckNum rttSeq, RttTime rttElapsed, RttTime srtt, RttTime rttvar, RttTime rto, TcpSegLen mss) :
+        prevAckd(ackd), prevUnak(unak), cong_window(cong_win), slowstart_threshold(sstresh), count(count), fastRetransmitted(fastRetransmitted),
+        recover(recover), appw(appw), cc(cc), nowTick(nowTick),
+        rttPending(rttPending), rttSeq(rttSeq), rttElapsed(rttElapsed), srtt(srtt), rttvar(rttvar), rto(rto), mss(mss) {}
 };
 
 //=========================================================
@@ -514,13 +711,34 @@ class TXeTxSarReply {
   public:
     TxAckNum        ackd;       // TX'ed and ACK'ed
     TxAckNum        not_ackd;   // TX'ed but not ACK'ed
-    TcpWindow       min_window; // Min(cong_window, recv_window)
+    LocalWinSize    min_window; // Min(cong_window, recv_window)
     TxBufPtr        app;        // Written by APP
     bool            finReady;
     bool            finSent;
+    RttTime         rto;        // Retransmission timeout
+    FlagBool        sackValid;  // The peer reported a SACK block
+    TxAckNum        sackLeft;   // Left edge of the lowest block SACK'ed by the peer
+    TcpSegLen       mss;        // Maximum segment size of the session
+    FlagBool        zeroCopy;   // The data are read from the APP buffer at 'zcBase'
+    TxMemPtr        zcBase;     // Address of the byte at 'zcOrg' in the APP buffer
+    TxBufPtr        zcOrg;      // Tx buffer pointer of the first byte at 'zcBase'
+    TxBufPtr        spillCur;   // Bytes of the lap of 'ackd' held by the spill region
+    TxBufPtr        spillNext;  // Bytes of the next lap held by the spill region
     TXeTxSarReply() {}
-    TXeTxSarReply(ap_uint<32> ack, ap_uint<32> nack, ap_uint<16> min_window, ap_uint<16> app, bool finReady, bool finSent) :
-        ackd(ack), not_ackd(nack), min_window(min_window), app(app), finReady(finReady), finSent(finSent) {}
+    TXeTxSarReply(ap_uint<32> ack, ap_uint<32> nack, LocalWinSize min_window, TxBufPtr app, bool finReady, bool finSent) :
+        ackd(ack), not_ackd(nack), min_window(min_window), app(app), finReady(finReady), finSent(finSent), rto(TOE_RTO_INIT),
+        sackValid(false), sackLeft(0), mss(THEIR_MSS), zeroCopy(false), zcBase(0), zcOrg(0), spillCur(0), spillNext(0) {}
+    TXeTxSarReply(ap_uint<32> ack, ap_uint<32> nack, LocalWinSize min_window, TxBufPtr app, bool finReady, bool finSent, RttTime rto) :
+        ackd(ack), not_ackd(nack), min_window(min_window), app(app), finReady(finReady), finSent(finSent), rto(rto),
+        sackValid(false), sackLeft(0), mss(THEIR_MSS), zeroCopy(false), zcBase(0), zcOrg(0), spillCur(0), spillNext(0) {}
+    TXeTxSarReply(ap_uint<32> ack, ap_uint<32> nack, LocalWinSize min_window, TxBufPtr app, bool finReady, bool finSent, RttTime rto,
+                  FlagBool sackValid, TxAckNum sackLeft, TcpSegLen mss) :
+        ackd(ack), not_ackd(nack), min_window(min_window), app(app), finReady(finReady), finSent(finSent), rto(rto),
+        sackValid(sackValid), sackLeft(sackLeft), mss(mss), zeroCopy(false), zcBase(0), zcOrg(0), spillCur(0), spillNext(0) {}
+    TXeTxSarReply(ap_uint<32> ack, ap_uint<32> nack, LocalWinSize min_window, TxBufPtr app, bool finReady, bool finSent, RttTime rto,
+                  FlagBool sackValid, TxAckNum sackLeft, TcpSegLen mss, FlagBool zeroCopy, TxMemPtr zcBase, TxBufPtr zcOrg) :
+        ackd(ack), not_ackd(nack), min_window(min_window), app(app), finReady(finReady), finSent(finSent), rto(rto),
+        sackValid(sackValid), sackLeft(sackLeft), mss(mss), zeroCopy(zeroCopy), zcBase(zcBase), zcOrg(zcOrg), spillCur(0), spillNext(0) {}
 };
 
 //=========================================================
@@ -532,11 +750,8 @@ class TXeTxSarRtQuery : public TXeTxSarQuery
     TXeTxSarRtQuery() {}
     TXeTxSarRtQuery(const TXeTxSarQuery& q) :
         TXeTxSarQuery(q.sessionID, q.not_ackd, q.write, q.init, q.finReady, q.finSent, q.isRtQuery) {}
-    TXeTxSarRtQuery(SessionId id, ap_uint<TOE_WINDOW_BITS> ssthresh) :
-        TXeTxSarQuery(id, ssthresh, 1, 0, false, false, true) {}
-    ap_uint<TOE_WINDOW_BITS> getThreshold() {
-        return not_ackd(TOE_WINDOW_BITS-1, 0);
-    }
+    TXeTxSarRtQuery(SessionId id) :
+        TXeTxSarQuery(id, 0, 1, 0, false, false, true) {}
 };
 
 //=========================================================
@@ -546,9 +761,15 @@ class TAiTxSarPush {
   public:
     SessionId       sessionID;
     TxBufPtr        app;
+    FlagBool        zeroCopy;   // The data were described by the APP (i.e. zero-copy)
+    TxMemPtr        zcBase;
+    TxBufPtr        zcOrg;
+    TxBufPtr        spill;      // Bytes written past the end of the buffer (into the spill region)
     TAiTxSarPush() {}
     TAiTxSarPush(SessionId id, TxBufPtr app) :
-         sessionID(id), app(app) {}
+         sessionID(id), app(app), zeroCopy(false), zcBase(0), zcOrg(0), spill(0) {}
+    TAiTxSarPush(SessionId id, TxBufPtr app, TxMemPtr zcBase, TxBufPtr zcOrg) :
+         sessionID(id), app(app), zeroCopy(true), zcBase(zcBase), zcOrg(zcOrg), spill(0) {}
 };
 
 //=========================================================
@@ -557,21 +778,22 @@ class TAiTxSarPush {
 class TStTxSarPush {
   public:
     SessionId       sessionID;
-    ap_uint<16>     ackd;
+    TxBufPtr        ackd;
+    TxBufPtr        spillCur;   // Bytes of the lap of 'ackd' held by the spill region
 #if (TCP_NODELAY)
     ap_uint<16> min_window;
 #endif
     CmdBit          init;
     TStTxSarPush() {}
 #if !(TCP_NODELAY)
-    TStTxSarPush(SessionId id, ap_uint<16> ackd) :
-        sessionID(id), ackd(ackd), init(0) {}
-    TStTxSarPush(SessionId id, ap_uint<16> ackd, CmdBit init) :
-        sessionID(id), ackd(ackd), init(init) {}
+    TStTxSarPush(SessionId id, TxBufPtr ackd) :
+        sessionID(id), ackd(ackd), spillCur(0), init(0) {}
+    TStTxSarPush(SessionId id, TxBufPtr ackd, CmdBit init) :
+        sessionID(id), ackd(ackd), spillCur(0), init(init) {}
 #else
-    TStTxSarPush(SessionId id, ap_uint<16> ackd, ap_uint<16> min_window) :
+    TStTxSarPush(SessionId id, TxBufPtr ackd, ap_uint<16> min_window) :
         sessionID(id), ackd(ackd), min_window(min_window), init(0) {}
-    TStTxSarPush(SessionId id, ap_uint<16> ackd, ap_uint<16> min_window, CmdBit init) :
+    TStTxSarPush(SessionId id, TxBufPtr ackd, ap_uint<16> min_window, CmdBit init) :
         sessionID(id), ackd(ackd), min_window(min_window), init(init) {}
 #endif
 };
@@ -588,11 +810,16 @@ class TxAppTableQuery {
     SessionId   sessId;
     TxBufPtr    mempt;
     bool        write;
+    FlagBool    zeroCopy;
+    TxMemPtr    zcBase;
+    TxBufPtr    zcOrg;
     TxAppTableQuery() {}
     TxAppTableQuery(SessionId id) :
-        sessId(id), mempt(0), write(false) {}
-    TxAppTableQuery(SessionId id, ap_uint<16> pt) :
-        sessId(id), mempt(pt), write(true) {}
+        sessId(id), mempt(0), write(false), zeroCopy(false), zcBase(0), zcOrg(0) {}
+    TxAppTableQuery(SessionId id, TxBufPtr pt) :
+        sessId(id), mempt(pt), write(true), zeroCopy(false), zcBase(0), zcOrg(0) {}
+    TxAppTableQuery(SessionId id, TxBufPtr pt, TxMemPtr zcBase, TxBufPtr zcOrg) :
+        sessId(id), mempt(pt), write(true), zeroCopy(true), zcBase(zcBase), zcOrg(zcOrg) {}
 };
 
 //=========================================================
@@ -601,17 +828,23 @@ class TxAppTableQuery {
 class TxAppTableReply {
   public:
     SessionId   sessId;
-    ap_uint<16> ackd;
+    TxBufPtr    ackd;
     TxBufPtr    mempt;
+    FlagBool    zeroCopy;   // Zero-copy data are outstanding
+    TxMemPtr    zcBase;
+    TxBufPtr    zcOrg;
+    TxBufPtr    spillCur;   // Bytes of the lap of 'ackd' held by the spill region
     #if (TCP_NODELAY)
       ap_uint<16> min_window;
     #endif
     TxAppTableReply() {}
     #if !(TCP_NODELAY)
-      TxAppTableReply(SessionId id, ap_uint<16> ackd, TxBufPtr pt) :
-           sessId(id), ackd(ackd), mempt(pt) {}
+      TxAppTableReply(SessionId id, TxBufPtr ackd, TxBufPtr pt) :
+           sessId(id), ackd(ackd), mempt(pt), zeroCopy(false), zcBase(0), zcOrg(0), spillCur(0) {}
+      TxAppTableReply(SessionId id, TxBufPtr ackd, TxBufPtr pt, FlagBool zeroCopy, TxMemPtr zcBase, TxBufPtr zcOrg) :
+           sessId(id), ackd(ackd), mempt(pt), zeroCopy(zeroCopy), zcBase(zcBase), zcOrg(zcOrg), spillCur(0) {}
     #else
-      TxAppTableReply(SessionId id, ap_uint<16> ackd, TxBufPtr pt, ap_uint<16> min_window) :
+      TxAppTableReply(SessionId id, TxBufPtr ackd, TxBufPtr pt, ap_uint<16> min_window) :
           sessionID(id), ackd(ackd), mempt(pt), min_window(min_window) {}
     #endif
 };
@@ -629,11 +862,42 @@ class RXeReTransTimerCmd {
   public:
     SessionId   sessionID;
     TimerCmd    command;  // { LOAD=false; STOP=true}
+    RttTime     rto;      // Retransmission timeout to load (0=initial RTO)
     RXeReTransTimerCmd() {}
     RXeReTransTimerCmd(SessionId id) :
-        sessionID(id), command(STOP_TIMER) {}
+        sessionID(id), command(STOP_TIMER), rto(0) {}
     RXeReTransTimerCmd(SessionId id, TimerCmd cmd) :
-        sessionID(id), command(cmd) {}
+        sessionID(id), command(cmd), rto(0) {}
+    RXeReTransTimerCmd(SessionId id, TimerCmd cmd, RttTime rto) :
+        sessionID(id), command(cmd), rto(rto) {}
+};
+
+//=========================================================
+//== TIm / Probe Timer Command from RXe
+//=========================================================
+class RXeProbeTimerCmd {
+  public:
+    SessionId    sessionID;
+    TimerCmd     command;    // { LOAD=false; STOP=true}
+    TcpKaProfile kaProfile;  // The keepalive profile of the session (for a LOAD)
+    RXeProbeTimerCmd() {}
+    RXeProbeTimerCmd(SessionId id, TimerCmd cmd, TcpKaProfile kaProfile=TOE_KEEPALIVE_DEFAULT) :
+        sessionID(id), command(cmd), kaProfile(kaProfile) {}
+};
+
+//=========================================================
+//== TIm / Close Timer Command from RXe
+//=========================================================
+class RXeCloseTimerCmd {
+  public:
+    SessionId   sessionID;
+    TimerCmd    command;  // { LOAD=false; STOP=true}
+    FlagBool    twShort;  // Load the short TIME-WAIT of the listening port
+    RXeCloseTimerCmd() {}
+    RXeCloseTimerCmd(SessionId id, TimerCmd cmd) :
+        sessionID(id), command(cmd), twShort(false) {}
+    RXeCloseTimerCmd(SessionId id, TimerCmd cmd, FlagBool twShort) :
+        sessionID(id), command(cmd), twShort(twShort) {}
 };
 
 //=========================================================
@@ -643,11 +907,14 @@ class TXeReTransTimerCmd {
   public:
     SessionId   sessionID;
     EventType   type;
+    RttTime     rto;      // Retransmission timeout before back-off (0=initial RTO)
     TXeReTransTimerCmd() {}
     TXeReTransTimerCmd(SessionId id) :
-        sessionID(id), type(RT_EVENT) {}
+        sessionID(id), type(RT_EVENT), rto(0) {}
     TXeReTransTimerCmd(SessionId id, EventType type) :
-        sessionID(id), type(type) {}
+        sessionID(id), type(type), rto(0) {}
+    TXeReTransTimerCmd(SessionId id, EventType type, RttTime rto) :
+        sessionID(id), type(type), rto(rto) {}
 };
 
 /*******************************************************************************
@@ -670,9 +937,9 @@ class Event
         type(type), sessionID(id), address(0), length(0), rt_count(0) {}
     Event(EventType type, SessionId id, ap_uint<3> rt_count) :
         type(type), sessionID(id), address(0), length(0), rt_count(rt_count) {}
-    Event(EventType type, SessionId id, ap_uint<16> addr, ap_uint<16> len) :
+    Event(EventType type, SessionId id, TcpBufAdr addr, TcpSegLen len) :
         type(type), sessionID(id), address(addr), length(len), rt_count(0) {}
-    Event(EventType type, SessionId id, ap_uint<16> addr, ap_uint<16> len, ap_uint<3> rt_count) :
+    Event(EventType type, SessionId id, TcpBufAdr addr, TcpSegLen len, ap_uint<3> rt_count) :
         type(type), sessionID(id), address(addr), length(len), rt_count(rt_count) {}
 };
 
@@ -715,6 +982,30 @@ struct rstEvent : public Event  // [FIXME - Class naming convention]
     }
 };
 
+//=========================================================
+//== EVe / SynCookieEvent
+//==  A stateless SYN-ACK. The event carries the ACK number
+//==  of the SYN-ACK and the information to encode in its
+//==  cookie, in place of a session ID.
+//=========================================================
+struct synCookieEvent : public Event
+{
+    synCookieEvent() {}
+    synCookieEvent(const Event& ev) :
+        Event(ev.type, ev.sessionID, ev.address, ev.length, ev.rt_count) {}
+    synCookieEvent(RxSeqNum ackNumb, SynCookieInfo info) :
+        Event(SYN_COOKIE_EVENT, info, ackNumb(31, 16), ackNumb(15, 0), 0) {}
+    TxAckNum getAckNumb() {
+        TxAckNum ackNumb;
+        ackNumb(31, 16) = address;
+        ackNumb(15,  0) = length;
+        return ackNumb;
+    }
+    SynCookieInfo getInfo() {
+        return sessionID(9, 0);
+    }
+};
+
 
 /*******************************************************************************
  * DDR MEMORY SUB-SYSTEM INTERFACES
@@ -724,8 +1015,8 @@ struct rstEvent : public Event  // [FIXME - Class naming convention]
  *  [DRE] stands for Data Realignment Engine.
  *******************************************************************************/
 
-#define RXMEMBUF    65536   // 64KB = 2^16
-#define TXMEMBUF    65536   // 64KB = 2^16
+#define RXMEMBUF    TOE_RX_BUFFER_SIZE   // 64KB = 2^16 by default
+#define TXMEMBUF    TOE_TX_BUFFER_SIZE   // 64KB = 2^16 by default
 
 //=========================================================
 //== MUX / A 2-to-1 Stream multiplexer.
@@ -777,6 +1068,9 @@ template<typename T> void pStreamMux(
         stream<TcpAppRdReq>                     &siTAIF_DReq,
         stream<TcpAppData>                      &soTAIF_Data,
         stream<TcpAppMeta>                      &soTAIF_Meta,
+        stream<TcpAppRdReq>                     &siTAIF_DscReq,
+        stream<TcpAppRdDsc>                     &soTAIF_RdDsc,
+        stream<TcpAppRxCrd>                     &siTAIF_RxCrd,
 
         //------------------------------------------------------
         //-- TAIF / Listen Interfaces
@@ -790,6 +1084,8 @@ template<typename T> void pStreamMux(
         stream<TcpAppData>                      &siTAIF_Data,
         stream<TcpAppSndReq>                    &siTAIF_SndReq,
         stream<TcpAppSndRep>                    &soTAIF_SndRep,
+        stream<TcpAppSndDsc>                    &siTAIF_SndDsc,
+        stream<TcpAppSndCpl>                    &soTAIF_SndCpl,
 
         //------------------------------------------------------
         //-- TAIF / Open Connection Interfaces
@@ -835,7 +1131,7 @@ template<typename T> void pStreamMux(
         //-- DEBUG / Interfaces
         //------------------------------------------------------
         stream<ap_uint<16> >                    &soDBG_SssRelCnt,
-        stream<ap_uint<16> >                    &soDBG_SssRegCnt,
+        stream<ap_uint<32> >                    &soDBG_SssRegCnt,
         stream<RxBufPtr>                        &soDBG_RxFreeSpace,
         stream<ap_uint<32> >                    &soDBG_TcpIpRxByteCnt,
         stream<ap_uint< 8> >                    &soDBG_OooDebug
@@ -882,6 +1178,9 @@ template<typename T> void pStreamMux(
         stream<TcpAppRdReq>                     &siTAIF_DReq,
         stream<TcpAppData>                      &soTAIF_Data,
         stream<TcpAppMeta>                      &soTAIF_Meta,
+        stream<TcpAppRdReq>                     &siTAIF_DscReq,
+        stream<TcpAppRdDsc>                     &soTAIF_RdDsc,
+        stream<TcpAppRxCrd>                     &siTAIF_RxCrd,
 
         //------------------------------------------------------
         //-- TAIF / Listen Interfaces
@@ -895,6 +1194,8 @@ template<typename T> void pStreamMux(
         stream<TcpAppData>                      &siTAIF_Data,
         stream<TcpAppSndReq>                    &siTAIF_SndReq,
         stream<TcpAppSndRep>                    &soTAIF_SndRep,
+        stream<TcpAppSndDsc>                    &siTAIF_SndDsc,
+        stream<TcpAppSndCpl>                    &soTAIF_SndCpl,
 
         //------------------------------------------------------
         //-- TAIF / Open Connection Interfaces
@@ -940,7 +1241,7 @@ template<typename T> void pStreamMux(
         //-- DEBUG / Interfaces
         //------------------------------------------------------
         stream<ap_uint<16> >                    &soDBG_SssRelCnt,
-        stream<ap_uint<16> >                    &soDBG_SssRegCnt,
+        stream<ap_uint<32> >                    &soDBG_SssRegCnt,
         stream<RxBufPtr>                        &soDBG_RxFreeSpace,
         stream<ap_uint<32> >                    &soDBG_TcpIpRxByteCnt,
         stream<ap_uint< 8> >                    &soDBG_OooDebug
@@ -58,6 +58,12 @@ const char *getEventName(EventType evType) {
         return "";
     case ACK_NODELAY_EVENT:
         return "ACK_NODELAY";
+    case KEEPALIVE_EVENT:
+        return "KEEPALIVE";
+    case SYN_COOKIE_EVENT:
+        return "SYN_COOKIE";
+    case ACK_COALESCE_EVENT:
+        return "ACK_COALESCE";
     default:
         return "ERROR: UNKNOWN EVENT!";
     }
@@ -92,4 +98,156 @@ void printFourTuple(const char *callerName, int src, FourTuple fourTuple) {
     printSockPair(callerName, socketPair);
 }
 
+/*******************************************************************************
+ * TCP BUFFER HELPERS
+ *******************************************************************************/
+
+/*******************************************************************************
+ * @brief Returns the number of bytes of a write which spill over the end of a
+ *  TCP buffer.
+ *
+ * @param[in] ptr  The TCP buffer address of the first byte to write.
+ * @param[in] len  The length of the write.
+ * @returns the number of bytes written into the spill region, or 0.
+ *
+ * @details
+ *  Without a spill region, a write which runs past the end of the buffer is
+ *   split in two accesses by the writer and nothing spills over.
+ *******************************************************************************/
+TcpBufAdr getSpill(TcpBufAdr ptr, TcpSegLen len) {
+    #pragma HLS INLINE
+    ap_uint<TOE_WINDOW_BITS+1> endAdr = ptr + len;
+    if (TOE_SPILL_CFG and (endAdr > (1 << TOE_WINDOW_BITS))) {
+        return endAdr(TOE_WINDOW_BITS-1, 0);
+    }
+    return 0;
+}
+
+/*******************************************************************************
+ * @brief Locates a range of bytes of a TCP buffer in the memory slice of its
+ *  session.
+ *
+ * @param[in]  cons      The TCP buffer address of the next byte to be consumed.
+ * @param[in]  spillCur  The bytes of the lap of 'cons' held by the spill region.
+ * @param[in]  spillNext The bytes of the next lap held by the spill region.
+ * @param[in]  ptr       The TCP buffer address of the first byte to read.
+ * @param[in]  len       The number of bytes to read.
+ * @param[out] contLen   The number of bytes which are contiguous in memory.
+ * @returns the offset of the first byte within the memory slice.
+ *
+ * @details
+ *  With a spill region, the first bytes of a lap may still be located in the
+ *   spill region of the previous lap, and a lap continues into the spill
+ *   region as far as the next lap did spill over. A read which is longer than
+ *   'contLen' continues at the beginning of the buffer with 'len - contLen'
+ *   bytes. Without a spill region, a read is contiguous up to the end of its
+ *   buffer (or of its page when the buffer pool is enabled).
+ *******************************************************************************/
+ap_uint<TOE_SLICE_BITS> locateInBuffer(TcpBufAdr cons, TcpBufAdr spillCur, TcpBufAdr spillNext,
+                                       TcpBufAdr ptr,  TcpSegLen len, TcpSegLen &contLen) {
+    #pragma HLS INLINE
+    ap_uint<TOE_SLICE_BITS>    offset = ptr;
+    ap_uint<TOE_WINDOW_BITS+1> room;
+  #if TOE_SPILL_CFG
+    bool      sameLap = (ptr >= cons);
+    TcpBufAdr prefix  = (sameLap) ? spillCur  : spillNext;
+    TcpBufAdr suffix  = (sameLap) ? spillNext : (TcpBufAdr)0;
+    if (ptr < prefix) {
+        //-- The byte spilled over from the previous lap
+        offset[TOE_WINDOW_BITS] = 1;
+        room = prefix - ptr;
+    }
+    else {
+        room = (1 << TOE_WINDOW_BITS) - ptr + suffix;
+    }
+  #else
+    room = TOE_PAGE_SIZE - ptr(TOE_PAGE_BITS-1, 0);
+  #endif
+    contLen = (len > room) ? (TcpSegLen)room : len;
+    return offset;
+}
+
+/*******************************************************************************
+ * SYN COOKIE HELPERS
+ *******************************************************************************/
+
+//-- The MSS values which can be restored from a SYN cookie
+static const TcpSegLen cSynCookieMss[4] = { THEIR_MSS, 1220, 1440, 1460 };
+
+/*******************************************************************************
+ * @brief Encodes the information of a SYN which must be restored from the
+ *  cookie of its SYN-ACK.
+ *
+ * @param[in] slot      The current time slot.
+ * @param[in] mss       The MSS option of the SYN (0 if none).
+ * @param[in] sackOk    The SYN carries a SACK-Permitted option.
+ * @param[in] wsOpt     The SYN carries a Window Scale option.
+ * @param[in] winScale  The shift count of that Window Scale option.
+ * @returns the information to encode in the cookie.
+ *
+ * @details
+ *  The MSS is rounded down to the nearest of 4 values, which costs a few bytes
+ *   per segment to the peers using an MSS in between.
+ *******************************************************************************/
+SynCookieInfo synCookieInfo(SynCookieSlot slot, TcpSegLen mss, FlagBit sackOk,
+                            FlagBit wsOpt, TcpOptWss winScale) {
+    #pragma HLS INLINE
+    SynCookieInfo info;
+    ap_uint<2>    mssIdx = 0;
+    for (int i=1; i<4; i++) {
+        #pragma HLS UNROLL
+        if (mss >= cSynCookieMss[i]) {
+            mssIdx = i;
+        }
+    }
+    info(9, 7) = slot;
+    info(6, 5) = mssIdx;
+    info[4]    = sackOk;
+    info(3, 0) = (wsOpt) ? (ap_uint<4>)(((winScale > 14) ? (TcpOptWss)14 : winScale) + 1) : (ap_uint<4>)0;
+    return info;
+}
+
+/*******************************************************************************
+ * @brief Returns the MSS encoded in the information of a SYN cookie.
+ *******************************************************************************/
+TcpSegLen synCookieMss(SynCookieInfo info) {
+    #pragma HLS INLINE
+    return cSynCookieMss[info(6, 5)];
+}
+
+/*******************************************************************************
+ * @brief Computes the SYN cookie of a connection.
+ *
+ * @param[in] peer     The socket address of the peer (in LITTLE-ENDIAN order).
+ * @param[in] mine     Our socket address (in LITTLE-ENDIAN order).
+ * @param[in] peerIsn  The initial sequence number of the peer.
+ * @param[in] info     The information encoded in the cookie.
+ * @returns the initial sequence number of our SYN-ACK.
+ *
+ * @details
+ *  The lower 22 bits are a one-at-a-time hash of the connection and of 'info'
+ *   keyed with TOE_SYN_COOKIE_SECRET_CFG. It only uses shifts, additions and
+ *   XORs, and is shared by [RXe] to validate the ACK of a cookie and by [TXe]
+ *   to generate it.
+ *******************************************************************************/
+TcpSeqNum synCookie(LE_SockAddr peer, LE_SockAddr mine, TcpSeqNum peerIsn, SynCookieInfo info) {
+    #pragma HLS INLINE
+    ap_uint<32> words[5] = { peer.addr, mine.addr, (peer.port, mine.port),
+                             peerIsn,   (ap_uint<22>(0), info) };
+    ap_uint<32> hash = TOE_SYN_COOKIE_SECRET_CFG;
+    for (int i=0; i<5; i++) {
+        #pragma HLS UNROLL
+        hash += words[i];
+        hash += (hash << 10);
+        hash ^= (hash >>  6);
+    }
+    hash += (hash <<  3);
+    hash ^= (hash >> 11);
+    hash += (hash << 15);
+    TcpSeqNum cookie;
+    cookie(31, 22) = info;
+    cookie(21,  0) = hash(21, 0);
+    return cookie;
+}
+
 /*! \} */
@@ -38,6 +38,21 @@
 const char *getEventName(EventType ev);
 void        printFourTuple(const char *callerName, int src, FourTuple fourTuple);
 
+/*******************************************************************************
+ * TCP BUFFER HELPERS - PROTOTYPE DEFINITIONS
+ *******************************************************************************/
+TcpBufAdr   getSpill(TcpBufAdr ptr, TcpSegLen len);
+ap_uint<TOE_SLICE_BITS> locateInBuffer(TcpBufAdr cons, TcpBufAdr spillCur, TcpBufAdr spillNext,
+                                       TcpBufAdr ptr,  TcpSegLen len, TcpSegLen &contLen);
+
+/*******************************************************************************
+ * SYN COOKIE HELPERS - PROTOTYPE DEFINITIONS
+ *******************************************************************************/
+SynCookieInfo synCookieInfo(SynCookieSlot slot, TcpSegLen mss, FlagBit sackOk,
+                            FlagBit wsOpt, TcpOptWss winScale);
+TcpSegLen   synCookieMss(SynCookieInfo info);
+TcpSeqNum   synCookie(LE_SockAddr peer, LE_SockAddr mine, TcpSeqNum peerIsn, SynCookieInfo info);
+
 #endif
 
 /*! \} */
@@ -271,6 +271,7 @@ void pTxAppConnect(
  *
  * @param[in]  siMEM_TxP_WrSts Tx memory write status from [MEM].
  * @param[in]  siEmx_Event     Event from the EventMultiplexer (Emx).
+ * @param[in]  siSml_ZcPush    Zero-copy push command from StreamMetaLoader (Sml).
  * @param[out] soTSt_PushCmd   Push command to TxSarTable (TSt).
  * @param[out] soEVe_Event     Event to EventEngine (EVe).
  *
@@ -280,10 +281,14 @@ void pTxAppConnect(
  *   from [MEM] and will forward a command to update the 'TxApplicationPointer'
  *   of the [TSt].
  *  Whatever the received event, it is always forwarded to [EVe].
+ *  The data described by the application (i.e. zero-copy) are already in
+ *   memory. Their push command is forwarded to [TSt] as is, along with a
+ *   'TX_EVENT' to [EVe].
  *******************************************************************************/
 void pTxAppStatusHandler(
         stream<DmSts>             &siMEM_TxP_WrSts,
         stream<Event>             &siEmx_Event,
+        stream<TAiTxSarPush>      &siSml_ZcPush,
         stream<TAiTxSarPush>      &soTSt_PushCmd,
         stream<Event>             &soEVe_Event)
 {
@@ -316,19 +321,33 @@ void pTxAppStatusHandler(
                                   getEventName(ev.type));
             }
         }
+        else if (!siSml_ZcPush.empty()) {
+            TAiTxSarPush zcPush = siSml_ZcPush.read();
+            // Update the 'txAppPtr' and the APP buffer of the TX_SAR_TABLE
+            soTSt_PushCmd.write(zcPush);
+            // Signal [TXe] via [EVe]
+            soEVe_Event.write(Event(TX_EVENT, zcPush.sessionID));
+            if (DEBUG_LEVEL & TRACE_TASH) {
+                printInfo(myName, "Received zero-copy push for session #%d.\n",
+                                  zcPush.sessionID.to_int());
+            }
+        }
         break;
     case TASH_RD_MEM_STATUS_1: //-- Read the Memory Write Status #1 (this might also be the last)
         if (!siMEM_TxP_WrSts.empty()) {
             DmSts status = siMEM_TxP_WrSts.read();
             if (status.okay) {
-                ap_uint<TOE_WINDOW_BITS+1> txAppPtr = ev.address + ev.length;
-                if (txAppPtr[TOE_WINDOW_BITS] == 1) {
-                    // The TCP buffer wrapped around
+                TxBufPtr txAppPtr = ev.address + ev.length;
+                if (!TOE_SPILL_CFG and
+                    ((ev.address(TOE_PAGE_BITS-1, 0) + ev.length) > TOE_PAGE_SIZE)) {
+                    // The TCP buffer wrapped around (or the write crossed a buffer page)
                     tash_fsmState = TASH_RD_MEM_STATUS_2;
                 }
                 else {
-                    // Update the 'txAppPtr' of the TX_SAR_TABLE
-                    soTSt_PushCmd.write(TAiTxSarPush(ev.sessionID, txAppPtr.range(TOE_WINDOW_BITS-1, 0)));
+                    // Update the 'txAppPtr' of the TX_SAR_TABLE (and the bytes which spilled over)
+                    TAiTxSarPush appPush(ev.sessionID, txAppPtr);
+                    appPush.spill = getSpill(ev.address, ev.length);
+                    soTSt_PushCmd.write(appPush);
                     // Forward event to [EVe] which will signal [TXe]
                     soEVe_Event.write(ev);
                     if (DEBUG_LEVEL & TRACE_TASH) {
@@ -364,15 +383,19 @@ void pTxAppStatusHandler(
  * @param[in]  siTSt_PushCmd    Push command from TxSarTable (TSt).
  * @param[in]  siTas_AccessQry  Access query from TxAppStream (Tas).
  * @param[out] soTAs_AccessRep  Access reply to [Tas].
+ * @param[out] soTAIF_SndCpl    Zero-copy send completion to [TAIF].
  *
  * @details
  *  This table keeps tack of the Tx ACK numbers and Tx memory pointers.
- *
+ *  It also keeps the location of the outstanding zero-copy data in the APP
+ *   buffer. Every time the ACK number of such a session moves forward, the
+ *   address up to which the APP buffer was acknowledged is returned to [TAIF].
  *******************************************************************************/
 void pTxAppTable(
         stream<TStTxSarPush>      &siTSt_PushCmd,
         stream<TxAppTableQuery>   &siTas_AccessQry,
-        stream<TxAppTableReply>   &siTas_AccessRep)
+        stream<TxAppTableReply>   &siTas_AccessRep,
+        stream<TcpAppSndCpl>      &soTAIF_SndCpl)
 {
     //-- DIRECTIVES FOR THIS PROCESS -------------------------------------------
     #pragma HLS PIPELINE II=1 enable_flush
@@ -381,9 +404,16 @@ void pTxAppTable(
     const char *myName  = concat3(THIS_NAME, "/", "Tat");
 
     //-- STATIC ARRAYS ---------------------------------------------------------
+    //-- [NOTE] This table is not reset because every entry is initialized by
+    //--  [TSt] when its session gets opened (i.e. 'ackPush.init').
     static TxAppTableEntry          TX_APP_TABLE[TOE_MAX_SESSIONS];
     #pragma HLS DEPENDENCE variable=TX_APP_TABLE inter false
-    #pragma HLS reset      variable=TX_APP_TABLE
+  #if TOE_USE_URAM
+    #pragma HLS RESOURCE   variable=TX_APP_TABLE core=XPM_MEMORY uram
+  #else
+    #pragma HLS RESOURCE   variable=TX_APP_TABLE core=RAM_T2P_BRAM
+  #endif
+    #pragma HLS DATA_PACK  variable=TX_APP_TABLE
 
     //-- DYNAMIC VARIABLES -----------------------------------------------------
     TStTxSarPush      ackPush;
@@ -391,24 +421,55 @@ void pTxAppTable(
 
     if (!siTSt_PushCmd.empty()) {
         siTSt_PushCmd.read(ackPush);
+        // Read-modify-write the entire (packed) entry
+        TxAppTableEntry entry = TX_APP_TABLE[ackPush.sessionID];
         if (ackPush.init) {
             // At init this is actually not_ackd
-            TX_APP_TABLE[ackPush.sessionID].ackd = ackPush.ackd-1;
-            TX_APP_TABLE[ackPush.sessionID].mempt = ackPush.ackd;
+            entry.ackd     = ackPush.ackd-1;
+            entry.mempt    = ackPush.ackd;
+            entry.zeroCopy = false;
+            entry.spillCur = 0;
         }
         else {
-            TX_APP_TABLE[ackPush.sessionID].ackd = ackPush.ackd;
+            if (entry.zeroCopy and (ackPush.ackd != (TxBufPtr)entry.ackd)) {
+                //-- Release the acknowledged part of the APP buffer
+                TxBufPtr ackedLen = ackPush.ackd - entry.zcOrg;
+                TxBufPtr totalLen = entry.mempt  - entry.zcOrg;
+                FlagBool done     = (ackedLen >= totalLen);  // A FIN takes one more byte
+                if (done) {
+                    ackedLen       = totalLen;
+                    entry.zeroCopy = false;
+                }
+                soTAIF_SndCpl.write(TcpAppSndCpl(ackPush.sessionID, entry.zcBase + ackedLen, done));
+                if (DEBUG_LEVEL & TRACE_TAT) {
+                    printInfo(myName, "S%d - Releasing the APP buffer up to 0x%8.8x (done=%d).\n",
+                              ackPush.sessionID.to_int(), (entry.zcBase + ackedLen).to_uint(), done);
+                }
+            }
+            entry.ackd     = ackPush.ackd;
+            entry.spillCur = ackPush.spillCur;
         }
+        TX_APP_TABLE[ackPush.sessionID] = entry;
     }
     else if (!siTas_AccessQry.empty()) {
         siTas_AccessQry.read(txAppUpdate);
+        TxAppTableEntry entry = TX_APP_TABLE[txAppUpdate.sessId];
         if(txAppUpdate.write) {
-            TX_APP_TABLE[txAppUpdate.sessId].mempt = txAppUpdate.mempt;
+            entry.mempt    = txAppUpdate.mempt;
+            entry.zeroCopy = txAppUpdate.zeroCopy;
+            entry.zcBase   = txAppUpdate.zcBase;
+            entry.zcOrg    = txAppUpdate.zcOrg;
+            TX_APP_TABLE[txAppUpdate.sessId] = entry;
         }
         else {
-            siTas_AccessRep.write(TxAppTableReply(txAppUpdate.sessId,
-                                  TX_APP_TABLE[txAppUpdate.sessId].ackd,
-                                  TX_APP_TABLE[txAppUpdate.sessId].mempt));
+            TxAppTableReply txAppTableReply(txAppUpdate.sessId,
+                                            entry.ackd,
+                                            entry.mempt,
+                                            entry.zeroCopy,
+                                            entry.zcBase,
+                                            entry.zcOrg);
+            txAppTableReply.spillCur = entry.spillCur;
+            siTas_AccessRep.write(txAppTableReply);
         }
     }
 }
@@ -418,12 +479,14 @@ void pTxAppTable(
  *
  * @param[in]  siTAIF_SndReq      APP request to send from [TAIF].
  * @param[out] soTAIF_SndRep      APP send reply to [TAIF].
+ * @param[in]  siTAIF_SndDsc      APP send descriptor from [TAIF].
  * @param[out] soSTt_SessStateReq Session state request to StateTable (STt).
  * @param[in]  siSTt_SessStateRep Session state reply from StateTable (STt).
  * @param[out] soTat_AccessReq    Access request to TxAppTable (Tat).
  * @param[in]  siTat_AccessRep    Access reply from [Tat]
  * @param[out] soMwr_AppMeta      APP memory metadata to MemoryWriter (Mwr).
  * @param[out] soEmx_Event        Event to EventMultiplexer (Emx).
+ * @param[out] soTash_ZcPush      Zero-copy push command to TxAppStatusHandler (Tash).
  *
  * @details
  *  The FSM of this process decides if the incoming application data is written
@@ -443,6 +506,14 @@ void pTxAppTable(
  *      the transmission.
  *   3) It the connection is not established, the application will be noticed it
  *      should act accordingly (e.g. by first opening the connection).
+ *  A send descriptor (i.e. zero-copy) is checked the same way, but its data is
+ *   not streamed. Instead, the location of the data in the APP buffer is kept
+ *   in the [Tat] and forwarded to the [TSt] via [Tash], and [TXe] will read the
+ *   data from there. Zero-copy and streamed data cannot be outstanding at the
+ *   same time for a session, and a new descriptor must either start where the
+ *   previous one ended in the APP buffer, or wait for the previous ones to be
+ *   acknowledged. Otherwise, the request is replied with 'NO_SPACE' and the
+ *   application is expected to retry later.
  *
  * @warning
  *  The outgoing stream 'soTAIF_SndRep is operated in non-blocking mode to avoid
@@ -456,12 +527,14 @@ void pTxAppTable(
 void pStreamMetaLoader(
         stream<TcpAppSndReq>        &siTAIF_SndReq,
         stream<TcpAppSndRep>        &soTAIF_SndRep,
+        stream<TcpAppSndDsc>        &siTAIF_SndDsc,
         stream<SessionId>           &soSTt_SessStateReq,
         stream<TcpState>            &siSTt_SessStateRep,
         stream<TxAppTableQuery>     &soTat_AccessReq,
         stream<TxAppTableReply>     &siTat_AccessRep,
         stream<AppMemMeta>          &soMwr_AppMeta,
-        stream<Event>               &soEmx_Event)
+        stream<Event>               &soEmx_Event,
+        stream<TAiTxSarPush>        &soTash_ZcPush)
 {
     //-- DIRECTIVES FOR THIS PROCESS -------------------------------------------
     #pragma HLS pipeline II=1 enable_flush
@@ -475,6 +548,8 @@ void pStreamMetaLoader(
 
     //-- STATIC DATAFLOW VARIABLES --------------------------------------------
     static TcpAppSndReq mdl_appSndReq;
+    static TcpAppMemAdr mdl_appSndAdr;
+    static FlagBool     mdl_zeroCopy;
 
     //-- DYNAMIC VARIABLES -----------------------------------------------------
     TxAppTableReply  txAppTableReply;
@@ -482,9 +557,18 @@ void pStreamMetaLoader(
 
     switch(mdl_fsmState) {
     case READ_REQUEST:
-        if (!siTAIF_SndReq.empty()) {
-            // Read the request to send
-            siTAIF_SndReq.read(mdl_appSndReq);
+        if (!siTAIF_SndReq.empty() or !siTAIF_SndDsc.empty()) {
+            // Read the request to send or the send descriptor
+            if (!siTAIF_SndReq.empty()) {
+                siTAIF_SndReq.read(mdl_appSndReq);
+                mdl_zeroCopy = false;
+            }
+            else {
+                TcpAppSndDsc appSndDsc = siTAIF_SndDsc.read();
+                mdl_appSndReq = TcpAppSndReq(appSndDsc.sessId, appSndDsc.length);
+                mdl_appSndAdr = appSndDsc.addr;
+                mdl_zeroCopy  = true;
+            }
             // Request state of the session
             assessSize(myName, soSTt_SessStateReq, "soSTt_SessStateReq", 2);  // [FIXME-Use constant for the length]
             soSTt_SessStateReq.write(mdl_appSndReq.sessId);
@@ -501,7 +585,24 @@ void pStreamMetaLoader(
         if (!siTat_AccessRep.empty() and !siSTt_SessStateRep.empty()) {
             siSTt_SessStateRep.read(sessState);
             siTat_AccessRep.read(txAppTableReply);
-            TcpDatLen maxWriteLength = (txAppTableReply.ackd - txAppTableReply.mempt) - 1;
+            TxBufPtr  bufEnd    = txAppTableReply.ackd;
+          #if TOE_BUF_POOL_CFG
+            // The rest of the page holding 'ackd' is in use until it gets acknowledged
+            bufEnd(TOE_PAGE_BITS-1, 0) = 0;
+          #endif
+            if ((TxBufPtr)txAppTableReply.ackd < txAppTableReply.spillCur) {
+                // The beginning of the buffer is in use as long as bytes which spilled over are not acknowledged
+                bufEnd = 0;
+            }
+            TxBufPtr  freeSpace = (bufEnd - txAppTableReply.mempt) - 1;
+            TxBufPtr  usedSpace = (txAppTableReply.mempt - txAppTableReply.ackd);
+            // A descriptor is appended to the outstanding ones if it is contiguous in the APP buffer
+            TxMemPtr  zcNext    = txAppTableReply.zcBase + (TxBufPtr)(txAppTableReply.mempt - txAppTableReply.zcOrg);
+            bool      isBusy    = (usedSpace != 0) and
+                                  (mdl_zeroCopy != txAppTableReply.zeroCopy or
+                                  (mdl_zeroCopy and (zcNext != mdl_appSndAdr)));
+            // Saturate the free space of a Tx buffer larger than 64KB to the width of the reply
+            TcpDatLen maxWriteLength = (freeSpace > 0xFFFF) ? (TcpDatLen)0xFFFF : (TcpDatLen)freeSpace;
             /*** [TODO - TCP_NODELAY] ******************
             #if (TCP_NODELAY)
                 ap_uint<16> usedLength = ((ap_uint<16>) writeSar.mempt - writeSar.ackd);
@@ -524,6 +625,35 @@ void pStreamMetaLoader(
                     printError(myName, "There is not enough TxBuf memory space available for session %d.\n",
                                mdl_appSndReq.sessId.to_uint());
                 }
+                else if (isBusy) {
+                    // Notify APP that the outstanding data must be acknowledged first
+                    soTAIF_SndRep.write(TcpAppSndRep(mdl_appSndReq.sessId, mdl_appSndReq.length, maxWriteLength, NO_SPACE));
+                    if (DEBUG_LEVEL & TRACE_SML) {
+                        printInfo(myName, "Session %d must first drain its outstanding data.\n",
+                                  mdl_appSndReq.sessId.to_uint());
+                    }
+                }
+                else if (mdl_zeroCopy) { //-- Session is ESTABLISHED and the descriptor can be queued
+                    TxBufPtr newMemPt = txAppTableReply.mempt + mdl_appSndReq.length;
+                    TxMemPtr zcBase   = txAppTableReply.zcBase;
+                    TxBufPtr zcOrg    = txAppTableReply.zcOrg;
+                    if (usedSpace == 0) {
+                        // Nothing is outstanding --> The descriptor starts a new APP buffer
+                        zcBase = mdl_appSndAdr;
+                        zcOrg  = txAppTableReply.mempt;
+                    }
+                    else {
+                        // Rebase the mapping onto 'ackd' to keep its offsets within a Tx buffer
+                        zcBase = zcBase + (TxBufPtr)(txAppTableReply.ackd - zcOrg);
+                        zcOrg  = txAppTableReply.ackd;
+                    }
+                    // Notify APP about acceptance of the transmission
+                    soTAIF_SndRep.write(TcpAppSndRep(mdl_appSndReq.sessId, mdl_appSndReq.length, maxWriteLength, NO_ERROR));
+                    // Push the new 'txAppPtr' to [TSt] and notify [TXe] via [Tash]
+                    soTash_ZcPush.write(TAiTxSarPush(mdl_appSndReq.sessId, newMemPt, zcBase, zcOrg));
+                    // Update the 'txMemPtr' and the APP buffer in TxAppTable
+                    soTat_AccessReq.write(TxAppTableQuery(mdl_appSndReq.sessId, newMemPt, zcBase, zcOrg));
+                }
                 else { //-- Session is ESTABLISHED and data-length <= maxWriteLength
                     // Forward the metadata to the SegmentMemoryWriter (Mwr)
                     soMwr_AppMeta.write(AppMemMeta(mdl_appSndReq.sessId, txAppTableReply.mempt, mdl_appSndReq.length));
@@ -561,7 +691,9 @@ void pStreamMetaLoader(
  *   DRAM and it may happen that the APP data to be transmitted does not fit
  *   into the remaining memory buffer space because the memory pointer needs to
  *   wrap around. In such a case, the incoming APP data is broken down and is
- *   written into the physical DRAM as two memory buffers.
+ *   written into the physical DRAM as two memory buffers, unless the Tx buffer
+ *   is followed by a spill region (TOE_SPILL_CFG) into which the write simply
+ *   continues.
  *******************************************************************************/
 void pTxMemoryWriter(
         stream<TcpAppData>  &siTAIF_Data,
@@ -601,12 +733,13 @@ void pTxMemoryWriter(
             siSml_AppMeta.read(mwr_appMemMeta);
             //-- Build a memory address for this segment
             TxMemPtr memSegAddr = TOE_TX_MEMORY_BASE; // 0x40000000
-            memSegAddr(29, 16) = mwr_appMemMeta.sessId(13, 0);
-            memSegAddr(15,  0) = mwr_appMemMeta.addr;
+            memSegAddr(TOE_TX_MEMORY_BITS-1, TOE_SLICE_BITS) = mwr_appMemMeta.sessId(TOE_TX_MEMORY_BITS-TOE_SLICE_BITS-1, 0);
+            memSegAddr(TOE_WINDOW_BITS-1, 0) = mwr_appMemMeta.addr;
             // Build a data mover command for this segment
             mwr_memWrCmd = DmCmd(memSegAddr, mwr_appMemMeta.len);
-            if ((mwr_memWrCmd.saddr(TOE_WINDOW_BITS-1, 0) + mwr_memWrCmd.btt) > TOE_TX_BUFFER_SIZE) {
+            if (!TOE_SPILL_CFG and ((mwr_memWrCmd.saddr(TOE_PAGE_BITS-1, 0) + mwr_memWrCmd.btt) > TOE_PAGE_SIZE)) {
                 // This segment must be broken in two memory accesses because TCP Tx memory buffer wraps around
+                //  (or because it crosses a buffer page when the buffer pool is enabled)
                 if (DEBUG_LEVEL & TRACE_MWR) {
                     printInfo(myName, "TCP Tx memory buffer wraps around: This segment must be broken in two memory accesses.\n");
                 }
@@ -627,7 +760,7 @@ void pTxMemoryWriter(
         break;
     case MWR_SPLIT_1ST_CMD:
         if (!soMEM_WrCmd.full()) {
-            mwr_firstAccLen   = TOE_TX_BUFFER_SIZE - mwr_memWrCmd.saddr;
+            mwr_firstAccLen   = TOE_PAGE_SIZE - mwr_memWrCmd.saddr(TOE_PAGE_BITS-1, 0);
             mwr_nrBytesToWr   = mwr_firstAccLen;
             soMEM_WrCmd.write(DmCmd(mwr_memWrCmd.saddr, mwr_firstAccLen));
             if (DEBUG_LEVEL & TRACE_MWR) {
@@ -660,7 +793,7 @@ void pTxMemoryWriter(
                 if (mwr_nrBytesToWr == (ARW/8)) {
                     memChunk.setLE_TLast(TLAST);
 
-                    mwr_memWrCmd.saddr(TOE_WINDOW_BITS-1, 0) = 0;
+                    mwr_memWrCmd.saddr(TOE_WINDOW_BITS-1, 0) = mwr_memWrCmd.saddr(TOE_WINDOW_BITS-1, 0) + mwr_firstAccLen;
                     mwr_memWrCmd.btt -= mwr_firstAccLen;
                     soMEM_WrCmd.write(mwr_memWrCmd);
                     if (DEBUG_LEVEL & TRACE_MWR) {
@@ -677,7 +810,7 @@ void pTxMemoryWriter(
                     memChunk.setLE_TData(0, (ARW-1), ((int)mwr_nrBytesToWr*8));
                     #endif
 
-                    mwr_memWrCmd.saddr(TOE_WINDOW_BITS-1, 0) = 0;
+                    mwr_memWrCmd.saddr(TOE_WINDOW_BITS-1, 0) = mwr_memWrCmd.saddr(TOE_WINDOW_BITS-1, 0) + mwr_firstAccLen;
                     mwr_memWrCmd.btt -= mwr_firstAccLen;
                     soMEM_WrCmd.write(mwr_memWrCmd);
                     if (DEBUG_LEVEL & TRACE_MWR) {
@@ -686,7 +819,12 @@ void pTxMemoryWriter(
                         mwr_debugCounter++;
                     }
                     mwr_splitOffset = (ARW/8) - mwr_nrBytesToWr;
-                    mwr_fsmState = MWR_FWD_2ND_BUF;
+                    if (mwr_currChunk.getLE_TLast()) {
+                        mwr_fsmState = MWR_RESIDUE;
+                    }
+                    else {
+                        mwr_fsmState = MWR_FWD_2ND_BUF;
+                    }
                 }
             }
             soMEM_WrData.write(memChunk);
@@ -761,6 +899,8 @@ void pTxMemoryWriter(
  * @param[in]  siTAIF_Data           APP data stream from [TAIF].
  * @param[in]  siTAIF_SndReq         APP request to send from [TAIF].
  * @param[out] soTAIF_SndRep         APP send reply to [TAIF].
+ * @param[in]  siTAIF_SndDsc         APP send descriptor from [TAIF].
+ * @param[out] soTAIF_SndCpl         APP send completion to [TAIF].
  * @param[out] soMEM_TxP_WrCmd       Tx memory write command to MEM.
  * @param[out] soMEM_TxP_Data        Tx memory data to MEM.
  * @param[in]  siMEM_TxP_WrSts       Tx memory write status from MEM.
@@ -797,6 +937,8 @@ void tx_app_interface(
         stream<TcpAppData>             &siTAIF_Data,
         stream<TcpAppSndReq>           &siTAIF_SndReq,
         stream<TcpAppSndRep>           &soTAIF_SndRep,
+        stream<TcpAppSndDsc>           &siTAIF_SndDsc,
+        stream<TcpAppSndCpl>           &soTAIF_SndCpl,
         //-- MEM / Tx PATH Interface
         stream<DmCmd>                  &soMEM_TxP_WrCmd,
         stream<AxisApp>                &soMEM_TxP_Data,
@@ -860,6 +1002,10 @@ void tx_app_interface(
     #pragma HLS stream         variable=ssSmlToEmx_Event     depth=2
     #pragma HLS DATA_PACK      variable=ssSmlToEmx_Event
 
+    static stream<TAiTxSarPush>         ssSmlToTash_ZcPush   ("ssSmlToTash_ZcPush");
+    #pragma HLS stream         variable=ssSmlToTash_ZcPush   depth=2
+    #pragma HLS DATA_PACK      variable=ssSmlToTash_ZcPush
+
     //-------------------------------------------------------------------------
     //-- PROCESS FUNCTIONS
     //-------------------------------------------------------------------------
@@ -874,18 +1020,21 @@ void tx_app_interface(
     pTxAppStatusHandler(
         siMEM_TxP_WrSts,
         ssEmxToTash_Event,
+        ssSmlToTash_ZcPush,
         soTSt_PushCmd,
         soEVe_Event);
 
     pStreamMetaLoader(
             siTAIF_SndReq,
             soTAIF_SndRep,
+            siTAIF_SndDsc,
             soSTt_SessStateReq,
             siSTt_SessStateRep,
             ssSmlToTat_AccessQry,
             ssTatToSml_AccessRep,
             ssSmlToMwr_AppMeta,
-            ssSmlToEmx_Event);
+            ssSmlToEmx_Event,
+            ssSmlToTash_ZcPush);
 
     pTxMemoryWriter(
             siTAIF_Data,
@@ -913,7 +1062,8 @@ void tx_app_interface(
     pTxAppTable(
             siTSt_PushCmd,
             ssSmlToTat_AccessQry,
-            ssTatToSml_AccessRep);
+            ssTatToSml_AccessRep,
+            soTAIF_SndCpl);
 }
 
 /*! \} */
@@ -94,9 +94,13 @@ class TxAppTableEntry {
   public:
     TcpAckNum       ackd;
     TxBufPtr        mempt;
+    FlagBool        zeroCopy;  // Zero-copy data are outstanding
+    TxMemPtr        zcBase;    // Address of the byte at 'zcOrg' in the APP buffer
+    TxBufPtr        zcOrg;     // Tx buffer pointer of the first zero-copy byte
+    TxBufPtr        spillCur;  // Bytes of the lap of 'ackd' held by the spill region
     TxAppTableEntry() {}
-    TxAppTableEntry(TcpAckNum ackd, ap_uint<16> mempt) :
-        ackd(ackd), mempt(mempt) {}
+    TxAppTableEntry(TcpAckNum ackd, TxBufPtr mempt) :
+        ackd(ackd), mempt(mempt), zeroCopy(false), zcBase(0), zcOrg(0), spillCur(0) {}
 };
 
 /************************************************
@@ -126,6 +130,8 @@ void tx_app_interface(
         stream<TcpAppData>             &siTAIF_Data,
         stream<TcpAppSndReq>           &siTAIF_SndReq,
         stream<TcpAppSndRep>           &soTAIF_SndRep,
+        stream<TcpAppSndDsc>           &siTAIF_SndDsc,
+        stream<TcpAppSndCpl>           &soTAIF_SndCpl,
         //-- MEM / Tx PATH Interface
         stream<DmCmd>                  &soMEM_TxP_WrCmd,
         stream<AxisApp>                &soMEM_TxP_Data,
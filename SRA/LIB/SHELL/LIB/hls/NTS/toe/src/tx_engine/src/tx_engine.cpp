@@ -83,6 +83,29 @@ using namespace hls;
 #define DEBUG_LEVEL (TRACE_OFF)
 
 
+/*******************************************************************************
+ * @brief Returns the window to advertise in the header of an outgoing segment.
+ *
+ * @param[in] rxSar  The RxSar entry of the current session.
+ *
+ * @details
+ *  The window is the free space of the Rx buffer, right-shifted by the window
+ *   scale that was negotiated at connection setup [RFC-7323] and saturated to
+ *   the 16 bits of the TCP header.
+ *******************************************************************************/
+TcpWindow getAdvertisedWindow(RxSarReply &rxSar)
+{
+    #pragma HLS INLINE
+
+    //[FIXME-TODO: It is better to compute and maintain the window_size in the [Rst] module]
+    RxBufPtr freeSpace = ((rxSar.appd - (RxBufPtr)rxSar.oooHead(TOE_WINDOW_BITS-1, 0)) - 1); // This works even for wrap around
+    RxBufPtr winSize   = freeSpace >> rxSar.winScale.to_uint();
+    if (winSize > 0xFFFF) {
+        return 0xFFFF;
+    }
+    return winSize(15, 0);
+}
+
 /*******************************************************************************
  * @brief Meta Data Loader (Mdl)
  *
@@ -99,7 +122,7 @@ using namespace hls;
  * @param[out] soSLc_ReverseLkpReq Reverse lookup request to Session Lookup Controller (SLc).
  * @param[out] soSps_IsLookup      Tells the Socket Pair Splitter (Sps) that a reverse lookup is to be expected.
  * @param[out] soTODO_IsDdrBypass  [TODO]
- * @param[out] soSps_RstSockPair   Tells the [Sps] about the socket pair to reset.
+ * @param[out] soSps_RstSockPair   Tells the [Sps] about the socket pair to reset (or of a SYN cookie).
  * @param[out] soEVe_RxEventSig    Signals the reception of an event to EventEngine (EVe).
  *
  * @details
@@ -112,6 +135,16 @@ using namespace hls;
  *  (RXe) and it does not have to be loaded from the SLc. The 'isLookUpFifo'
  *  indicates this special cases.
  * Depending on the Event Type the retransmit or/and probe Timer is set.
+ * A retransmission event issued by the timer (i.e. 'rt_count!=0') resends the
+ *  outstanding data, whereas a fast retransmit event issued by [RXe] (i.e.
+ *  'rt_count==0') resends the first unacknowledged segment only.
+ The data are segmented with the MSS which was advertised by the remote host
+  during the 3-way handshake and which is kept in the TxSarTable.
+ The data of a session described by the application (i.e. zero-copy) are read
+  from the application buffer instead of the Tx buffer of the session.
+ A SYN cookie event (TOE_SYN_COOKIE_CFG) is a SYN-ACK without a session. Its
+  sequence number is the cookie computed from the socket pair of the event, and
+  its options are the ones encoded in this cookie.
  *
  *******************************************************************************/
 void pMetaDataLoader(
@@ -124,7 +157,7 @@ void pMetaDataLoader(
         stream<SessionId>               &soTIm_SetProbeTimer,
         stream<TcpDatLen>               &soIhc_TcpDatLen,
         stream<TXeMeta>                 &soPhc_TxeMeta,
-        stream<DmCmd>                   &soMrd_BufferRdCmd,
+        stream<TxBufRdCmd>              &soMrd_BufferRdCmd,
         stream<SessionId>               &soSLc_ReverseLkpReq,
         stream<StsBool>                 &soSps_IsLookup,
 #if (TCP_NODELAY)
@@ -157,10 +190,13 @@ void pMetaDataLoader(
 
     //-- DYNAMIC VARIABLES -----------------------------------------------------
     TcpWindow             winSize;
-    TcpWindow             usableWindow;
-    TcpDatLen             currDatLen;
-    ap_uint<16>           slowstart_threshold;
+    LocalWinSize          usableWindow;
+    TxBufPtr              currDatLen;
     rstEvent              resetEvent;
+  #if TOE_SYN_COOKIE_CFG
+    synCookieEvent        cookieEvent;
+    SynCookieInfo         cookieInfo;
+  #endif
 
     switch (mdl_fsmState) {
     case MDL_WAIT_EVENT:
@@ -171,6 +207,8 @@ void pMetaDataLoader(
                           getEventName(mdl_curEvent.type), mdl_curEvent.sessionID.to_uint());
             }
             mdl_sarLoaded = false;
+            // SACK blocks are only appended to pure ACKs
+            mdl_txeMeta.sackCnt = 0;
             assessSize(myName, soEVe_RxEventSig, "soEVe_RxEventSig", 2); // [FIXME-Use constant for the length]
             soEVe_RxEventSig.write(1);
 
@@ -182,6 +220,7 @@ void pMetaDataLoader(
             case FIN_EVENT:
             case ACK_EVENT:
             case ACK_NODELAY_EVENT:
+            case KEEPALIVE_EVENT:
                 assessSize(myName, soRSt_RxSarReq, "soRSt_RxSarReq", cDepth_TXeToRSt_Req);
                 soRSt_RxSarReq.write(mdl_curEvent.sessionID);
                 assessSize(myName, soTSt_TxSarQry, "soTSt_TxSarQry", cDepth_TXeToTSt_Qry);
@@ -272,8 +311,7 @@ void pMetaDataLoader(
                     siTSt_TxSarRep.read(mdl_txSar);
                 }
                 // Compute our space, Advertise at least a quarter/half, otherwise 0
-                //[FIXME-TODO: It is better to compute and maintain the window_size in the [Rst] module]
-                winSize = ((mdl_rxSar.appd - (RxBufPtr)mdl_rxSar.oooHead(TOE_WINDOW_BITS-1, 0)) - 1);
+                winSize = getAdvertisedWindow(mdl_rxSar);
                 mdl_txeMeta.ackNumb = mdl_rxSar.rcvd;
                 mdl_txeMeta.seqNumb = mdl_txSar.not_ackd;
                 mdl_txeMeta.winSize = winSize;
@@ -281,6 +319,7 @@ void pMetaDataLoader(
                 mdl_txeMeta.rst = 0;
                 mdl_txeMeta.syn = 0;
                 mdl_txeMeta.fin = 0;
+                mdl_txeMeta.ece = cCcUseEcn ? mdl_rxSar.ce : (FlagBit)0;
                 mdl_txeMeta.length = 0;
                 currDatLen = (mdl_txSar.app - ((TxBufPtr)mdl_txSar.not_ackd));
 
@@ -294,18 +333,25 @@ void pMetaDataLoader(
                 }
 
                 // Construct address before modifying mdl_txSar.not_ackd
-                //  FYI - The TCP Tx buffers use up to 1GB (16Kx64KB). They are located at base@+1GB
+                //  FYI - The TCP Tx buffers use up to 1GB (e.g. 16Kx64KB). They are located at base@+1GB
+                TcpSegLen contLen;
                 TxMemPtr memSegAddr = TOE_TX_MEMORY_BASE;
-                memSegAddr(29, 16) = mdl_curEvent.sessionID(13, 0);
-                memSegAddr(15,  0) = mdl_txSar.not_ackd(15, 0);
+                memSegAddr(TOE_TX_MEMORY_BITS-1, TOE_SLICE_BITS) = mdl_curEvent.sessionID(TOE_TX_MEMORY_BITS-TOE_SLICE_BITS-1, 0);
+                memSegAddr(TOE_SLICE_BITS-1, 0) = locateInBuffer(mdl_txSar.ackd(TOE_WINDOW_BITS-1, 0),
+                                                                 mdl_txSar.spillCur, mdl_txSar.spillNext,
+                                                                 mdl_txSar.not_ackd(TOE_WINDOW_BITS-1, 0),
+                                                                 0xFFFF, contLen);
+                if (mdl_txSar.zeroCopy) {
+                    memSegAddr = mdl_txSar.zcBase + (TxBufPtr)((TxBufPtr)mdl_txSar.not_ackd - mdl_txSar.zcOrg);
+                }
 
                 // Check if length is bigger than Usable Window or MSS
                 if (currDatLen <= usableWindow) {
-                    if (currDatLen+TCP_HEADER_LEN > ZYC2_MSS) {
+                    if (currDatLen > mdl_txSar.mss) {
                         //-- Start IP Fragmentation ----------------------------
                         //--  We stay in this state
-                        mdl_txSar.not_ackd += ZYC2_MSS-TCP_HEADER_LEN;
-                        mdl_txeMeta.length  = ZYC2_MSS-TCP_HEADER_LEN;
+                        mdl_txSar.not_ackd += mdl_txSar.mss;
+                        mdl_txeMeta.length  = mdl_txSar.mss;
                     }
                     else {
                         //-- No IP Fragmentation or End of Fragmentation -------
@@ -325,11 +371,11 @@ void pMetaDataLoader(
                 }
                 else {
                     // Code duplication, but better timing.
-                    if (usableWindow+TCP_HEADER_LEN >= ZYC2_MSS) {
+                    if (usableWindow >= mdl_txSar.mss) {
                         //-- Start IP Fragmentation ----------------------------
                         //--  We stay in this state
-                        mdl_txSar.not_ackd += ZYC2_MSS-TCP_HEADER_LEN;
-                        mdl_txeMeta.length  = ZYC2_MSS-TCP_HEADER_LEN;
+                        mdl_txSar.not_ackd += mdl_txSar.mss;
+                        mdl_txeMeta.length  = mdl_txSar.mss;
                     }
                     else {
                         // Check if we sent >= MSS data
@@ -346,7 +392,7 @@ void pMetaDataLoader(
                 }
 
                 if (mdl_txeMeta.length != 0) {
-                    soMrd_BufferRdCmd.write(DmCmd(memSegAddr, mdl_txeMeta.length));
+                    soMrd_BufferRdCmd.write(TxBufRdCmd(DmCmd(memSegAddr, mdl_txeMeta.length), mdl_txSar.zeroCopy, contLen));
                 }
                 // Send a packet only if there is data or we want to send an empty probing message
                 if (mdl_txeMeta.length != 0) { // || mdl_curEvent.retransmit) //TODO retransmit boolean currently not set, should be removed
@@ -356,7 +402,7 @@ void pMetaDataLoader(
                     soSLc_ReverseLkpReq.write(mdl_curEvent.sessionID);
                     // Only set RT timer if we actually send sth,
                     // [TODO - Only set if we change state and sent sth]
-                    soTIm_ReTxTimerCmd.write(TXeReTransTimerCmd(mdl_curEvent.sessionID));
+                    soTIm_ReTxTimerCmd.write(TXeReTransTimerCmd(mdl_curEvent.sessionID, RT_EVENT, mdl_txSar.rto));
                 } // [TODO - if probe send msg length 1]
                 mdl_sarLoaded = true;
             }
@@ -370,12 +416,18 @@ void pMetaDataLoader(
                     siTSt_TxSarRep.read(mdl_txSar);
                 }
                 // Compute our window size
-                //[FIXME-TODO: It is better to compute and maintain the window_size in the [Rst] module]
-                winSize = ((mdl_rxSar.appd - (RxBufPtr)mdl_rxSar.oooHead(TOE_WINDOW_BITS-1, 0)) - 1); // This works even for wrap around
+                winSize = getAdvertisedWindow(mdl_rxSar);
                 if (!mdl_txSar.finSent) // No FIN sent
                     currDatLen = ((TxBufPtr) mdl_txSar.not_ackd - mdl_txSar.ackd);
                 else // FIN already sent
                     currDatLen = ((TxBufPtr) mdl_txSar.not_ackd - mdl_txSar.ackd)-1;
+                // Only resend the first hole when the peer reported the data above it [RFC-6675]
+                if (mdl_txSar.sackValid and !mdl_txSar.finSent) {
+                    TxBufPtr sackedOff = (TxBufPtr)(mdl_txSar.sackLeft - mdl_txSar.ackd);
+                    if ((sackedOff != 0) and (sackedOff < currDatLen)) {
+                        currDatLen = sackedOff;
+                    }
+                }
                 mdl_txeMeta.ackNumb = mdl_rxSar.rcvd;
                 mdl_txeMeta.seqNumb = mdl_txSar.ackd;
                 mdl_txeMeta.winSize = winSize;
@@ -383,30 +435,39 @@ void pMetaDataLoader(
                 mdl_txeMeta.rst = 0;
                 mdl_txeMeta.syn = 0;
                 mdl_txeMeta.fin = 0;
+                mdl_txeMeta.ece = cCcUseEcn ? mdl_rxSar.ce : (FlagBit)0;
                 // Construct address before modifying 'mdl_txSar.ackd'
-                TxMemPtr memSegAddr;  // 0x40000000
-                memSegAddr(31, 30) = 0x01;
-                memSegAddr(29, 16) = mdl_curEvent.sessionID(13, 0);
-                memSegAddr(15,  0) = mdl_txSar.ackd(15, 0); // mdl_curEvent.address;
-                // Decrease Slow Start Threshold, only on first RT from retransmitTimer
+                //  FYI - The TCP Tx buffers use up to 1GB (e.g. 16Kx64KB). They are located at base@+1GB
+                TcpSegLen contLen;
+                TxMemPtr memSegAddr = TOE_TX_MEMORY_BASE;
+                memSegAddr(TOE_TX_MEMORY_BITS-1, TOE_SLICE_BITS) = mdl_curEvent.sessionID(TOE_TX_MEMORY_BITS-TOE_SLICE_BITS-1, 0);
+                memSegAddr(TOE_SLICE_BITS-1, 0) = locateInBuffer(mdl_txSar.ackd(TOE_WINDOW_BITS-1, 0),
+                                                                 mdl_txSar.spillCur, mdl_txSar.spillNext,
+                                                                 mdl_txSar.ackd(TOE_WINDOW_BITS-1, 0),
+                                                                 0xFFFF, contLen); // mdl_curEvent.address;
+                if (mdl_txSar.zeroCopy) {
+                    memSegAddr = mdl_txSar.zcBase + (TxBufPtr)((TxBufPtr)mdl_txSar.ackd - mdl_txSar.zcOrg);
+                }
+                // Signal the timeout to the congestion control, only on first RT from retransmitTimer
                 if (!mdl_sarLoaded and (mdl_curEvent.rt_count == 1)) {
-                    if (currDatLen > (4*ZYC2_MSS)) { // max(FlightSize/2, 2*MSS) RFC:5681
-                        slowstart_threshold = currDatLen/2;
-                    }
-                    else {
-                        slowstart_threshold = (2 * ZYC2_MSS);
-                    }
-                    soTSt_TxSarQry.write(TXeTxSarRtQuery(mdl_curEvent.sessionID, slowstart_threshold));
+                    soTSt_TxSarQry.write(TXeTxSarRtQuery(mdl_curEvent.sessionID));
                 }
                 // Since we are retransmitting from 'txSar.ackd' to 'txSar.not_ackd',
                 // this data is already inside the usableWindow => No check is required
                 // Only check if length is bigger than MSS
-                if (currDatLen+TCP_HEADER_LEN > ZYC2_MSS) {
+                if (currDatLen > mdl_txSar.mss) {
                     // We stay in this state and sent immediately another packet
-                    mdl_txeMeta.length = ZYC2_MSS-TCP_HEADER_LEN;
-                    mdl_txSar.ackd    += ZYC2_MSS-TCP_HEADER_LEN;
+                    TxBufPtr prevAckd  = mdl_txSar.ackd(TOE_WINDOW_BITS-1, 0);
+                    mdl_txeMeta.length = mdl_txSar.mss;
+                    mdl_txSar.ackd    += mdl_txSar.mss;
+                    if ((TxBufPtr)mdl_txSar.ackd < prevAckd) {
+                        // The next segment starts in the next lap of the Tx buffer
+                        mdl_txSar.spillCur  = mdl_txSar.spillNext;
+                        mdl_txSar.spillNext = 0;
+                    }
+                    // A fast retransmit from [RXe] (i.e. 'rt_count==0') only resends the missing segment
                     // [TODO - replace with dynamic count, remove this]
-                    if (mdl_segmentCount == 3) {
+                    if ((mdl_segmentCount == 3) or (mdl_curEvent.rt_count == 0)) {
                         // Should set a probe or sth??
                         //txEng2txSar_upd_req.write(txTxSarQuery(ml_curEvent.sessionID, mdl_txSar.not_ackd, 1));
                         mdl_fsmState = MDL_WAIT_EVENT;
@@ -425,7 +486,7 @@ void pMetaDataLoader(
 
                 // Only send a packet if there is data
                 if (mdl_txeMeta.length != 0) {
-                    soMrd_BufferRdCmd.write(DmCmd(memSegAddr, mdl_txeMeta.length));
+                    soMrd_BufferRdCmd.write(TxBufRdCmd(DmCmd(memSegAddr, mdl_txeMeta.length), mdl_txSar.zeroCopy, contLen));
                     soIhc_TcpDatLen.write(mdl_txeMeta.length);
                     soPhc_TxeMeta.write(mdl_txeMeta);
                     soSps_IsLookup.write(true);
@@ -434,28 +495,43 @@ void pMetaDataLoader(
 #endif
                     soSLc_ReverseLkpReq.write(mdl_curEvent.sessionID);
                     // Only set RT timer if we actually send sth
-                    soTIm_ReTxTimerCmd.write(TXeReTransTimerCmd(mdl_curEvent.sessionID));
+                    soTIm_ReTxTimerCmd.write(TXeReTransTimerCmd(mdl_curEvent.sessionID, RT_EVENT, mdl_txSar.rto));
                 }
                 mdl_sarLoaded = true;
             }
             break;
         case ACK_EVENT:
         case ACK_NODELAY_EVENT:
+        case KEEPALIVE_EVENT:
             if (DEBUG_LEVEL & TRACE_MDL) { printInfo(myName, "Entering the 'ACK' processing.\n"); }
             if (!siRSt_RxSarRep.empty() and !siTSt_TxSarRep.empty()) {
                 siRSt_RxSarRep.read(mdl_rxSar);
                 siTSt_TxSarRep.read(mdl_txSar);
 
-                //[FIXME-TODO: It is better to compute and maintain the window_size in the [Rst] module]
-                winSize = ((mdl_rxSar.appd - (RxBufPtr)mdl_rxSar.oooHead(TOE_WINDOW_BITS-1, 0)) - 1);
+                winSize = getAdvertisedWindow(mdl_rxSar);
                 mdl_txeMeta.ackNumb = mdl_rxSar.rcvd;
                 mdl_txeMeta.seqNumb = mdl_txSar.not_ackd; //Always send SEQ
+                if (mdl_curEvent.type == KEEPALIVE_EVENT) {
+                    // A keepalive probe carries an old SeqNum to elicit an ACK from the peer [RFC-1122]
+                    mdl_txeMeta.seqNumb = mdl_txSar.ackd - 1;
+                }
                 mdl_txeMeta.winSize = winSize;
                 mdl_txeMeta.length  = 0;
                 mdl_txeMeta.ack = 1;
                 mdl_txeMeta.rst = 0;
                 mdl_txeMeta.syn = 0;
                 mdl_txeMeta.fin = 0;
+                mdl_txeMeta.ece = cCcUseEcn ? mdl_rxSar.ce : (FlagBit)0;
+                // Report the out-of-order blocks held by the receive buffer [RFC-2018]
+                if (mdl_rxSar.sackOk and (mdl_rxSar.oooCnt != 0) and (mdl_curEvent.type != KEEPALIVE_EVENT)) {
+                    mdl_txeMeta.sackCnt = mdl_rxSar.oooCnt;
+                    for (int i=0; i<TOE_MAX_OOO_BLOCKS; i++) {
+                        #pragma HLS UNROLL
+                        mdl_txeMeta.sackBlk[i] = mdl_rxSar.oooBlk[i];
+                    }
+                    // FYI - NOP+NOP+Kind+Len adds 4 option bytes and each block adds 8 more
+                    mdl_txeMeta.length = 4 + 8*mdl_txeMeta.sackCnt;
+                }
                 soIhc_TcpDatLen.write(mdl_txeMeta.length);
                 soPhc_TxeMeta.write(mdl_txeMeta);
                 soSps_IsLookup.write(true);
@@ -479,12 +555,18 @@ void pMetaDataLoader(
                 }
                 mdl_txeMeta.ackNumb = 0;
                 //mdl_txeMeta.seqNumb = mdl_txSar.not_ackd;
-                mdl_txeMeta.winSize = 0xFFFF;
-                mdl_txeMeta.length = 4; // FYI - MSS adds 4 option bytes
+                mdl_txeMeta.winSize = 0xFFFF; // FYI - The window of a SYN is never scaled
+                // Offer our window scale when the Rx buffers are larger than 64KB
+                mdl_txeMeta.wsOpt  = (TOE_WINDOW_SCALE != 0);
+                // Always offer to receive SACK options [RFC-2018]
+                mdl_txeMeta.sackOpt = true;
+                // FYI - MSS adds 4 option bytes, NOP+WS adds 4 more and NOP+NOP+SACK-Permitted adds 4 more
+                mdl_txeMeta.length = 4 + (mdl_txeMeta.wsOpt ? 4 : 0) + 4;
                 mdl_txeMeta.ack = 0;
                 mdl_txeMeta.rst = 0;
                 mdl_txeMeta.syn = 1;
                 mdl_txeMeta.fin = 0;
+                mdl_txeMeta.ece = 0;
                 soIhc_TcpDatLen.write(mdl_txeMeta.length);
                 soPhc_TxeMeta.write(mdl_txeMeta);
                 soSps_IsLookup.write(true);
@@ -503,11 +585,17 @@ void pMetaDataLoader(
                 // Construct SYN_ACK message
                 mdl_txeMeta.ackNumb = mdl_rxSar.rcvd;
                 mdl_txeMeta.winSize = MY_MSS * 12;
-                mdl_txeMeta.length  = 4; // FYI - MSS adds 4 option bytes
+                // Only reply with our window scale if the peer offered one in its SYN
+                mdl_txeMeta.wsOpt   = (mdl_rxSar.winScale != 0);
+                // Only reply with SACK-Permitted if the peer offered it in its SYN
+                mdl_txeMeta.sackOpt = mdl_rxSar.sackOk;
+                // FYI - MSS adds 4 option bytes, NOP+WS adds 4 more and NOP+NOP+SACK-Permitted adds 4 more
+                mdl_txeMeta.length  = 4 + (mdl_txeMeta.wsOpt ? 4 : 0) + (mdl_txeMeta.sackOpt ? 4 : 0);
                 mdl_txeMeta.ack     = 1;
                 mdl_txeMeta.rst     = 0;
                 mdl_txeMeta.syn     = 1;
                 mdl_txeMeta.fin     = 0;
+                mdl_txeMeta.ece     = 0;
                 if (mdl_curEvent.rt_count != 0) {
                     mdl_txeMeta.seqNumb = mdl_txSar.ackd;
                 }
@@ -536,8 +624,7 @@ void pMetaDataLoader(
                     siTSt_TxSarRep.read(mdl_txSar);
                 }
                 // Construct FIN message
-                //[FIXME-TODO: It is better to compute and maintain the window_size in the [Rst] module]
-                winSize = ((mdl_rxSar.appd - (RxBufPtr)mdl_rxSar.oooHead(TOE_WINDOW_BITS-1, 0)) - 1);
+                winSize = getAdvertisedWindow(mdl_rxSar);
                 mdl_txeMeta.ackNumb = mdl_rxSar.rcvd;
                 //meta.seqNumb = mdl_txSar.not_ackd;
                 mdl_txeMeta.winSize = winSize;
@@ -546,6 +633,7 @@ void pMetaDataLoader(
                 mdl_txeMeta.rst = 0;
                 mdl_txeMeta.syn = 0;
                 mdl_txeMeta.fin = 1;
+                mdl_txeMeta.ece = cCcUseEcn ? mdl_rxSar.ce : (FlagBit)0;
 
                 // Check if retransmission, in case of RT, we have to reuse 'not_ackd' number
                 if (mdl_curEvent.rt_count != 0)
@@ -554,7 +642,7 @@ void pMetaDataLoader(
                     mdl_txeMeta.seqNumb = mdl_txSar.not_ackd;
                     // Check if all data is sent, otherwise we have to delay FIN message
                     // Set FIN flag, such that probeTimer is informed
-                    if (mdl_txSar.app == mdl_txSar.not_ackd(15, 0))
+                    if (mdl_txSar.app == mdl_txSar.not_ackd(TOE_WINDOW_BITS-1, 0))
                         soTSt_TxSarQry.write(TXeTxSarQuery(mdl_curEvent.sessionID, mdl_txSar.not_ackd+1,
                                              QUERY_WR, ~QUERY_INIT, true, true));
                     else
@@ -563,13 +651,13 @@ void pMetaDataLoader(
                 }
 
                 // Check if there is a FIN to be sent // [TODO - maybe restrict this]
-                if (mdl_txeMeta.seqNumb(15, 0) == mdl_txSar.app) {
+                if (mdl_txeMeta.seqNumb(TOE_WINDOW_BITS-1, 0) == mdl_txSar.app) {
                     soIhc_TcpDatLen.write(mdl_txeMeta.length);
                     soPhc_TxeMeta.write(mdl_txeMeta);
                     soSps_IsLookup.write(true);
                     soSLc_ReverseLkpReq.write(mdl_curEvent.sessionID);
                     // Set retransmission timer
-                    soTIm_ReTxTimerCmd.write(TXeReTransTimerCmd(mdl_curEvent.sessionID));
+                    soTIm_ReTxTimerCmd.write(TXeReTransTimerCmd(mdl_curEvent.sessionID, RT_EVENT, mdl_txSar.rto));
                 }
                 mdl_fsmState = MDL_WAIT_EVENT;
             }
@@ -595,6 +683,32 @@ void pMetaDataLoader(
                 mdl_fsmState = MDL_WAIT_EVENT;
             }
             break;
+      #if TOE_SYN_COOKIE_CFG
+        case SYN_COOKIE_EVENT:
+            if (DEBUG_LEVEL & TRACE_MDL) { printInfo(myName, "Entering the 'SYN_COOKIE' processing.\n"); }
+            cookieEvent = mdl_curEvent;
+            cookieInfo  = cookieEvent.getInfo();
+            // Construct a stateless SYN_ACK message. The peer is the destination of the event tuple
+            mdl_txeMeta.seqNumb = synCookie(mdl_curEvent.tuple.dst, mdl_curEvent.tuple.src,
+                                            cookieEvent.getAckNumb()-1, cookieInfo);
+            mdl_txeMeta.ackNumb = cookieEvent.getAckNumb();
+            mdl_txeMeta.winSize = MY_MSS * 12;
+            // Only reply with the options which the peer offered in its SYN
+            mdl_txeMeta.wsOpt   = (TOE_WINDOW_SCALE != 0) and (cookieInfo(3, 0) != 0);
+            mdl_txeMeta.sackOpt = cookieInfo[4];
+            mdl_txeMeta.length  = 4 + (mdl_txeMeta.wsOpt ? 4 : 0) + (mdl_txeMeta.sackOpt ? 4 : 0);
+            mdl_txeMeta.ack     = 1;
+            mdl_txeMeta.rst     = 0;
+            mdl_txeMeta.syn     = 1;
+            mdl_txeMeta.fin     = 0;
+            mdl_txeMeta.ece     = 0;
+            soIhc_TcpDatLen.write(mdl_txeMeta.length);
+            soPhc_TxeMeta.write(mdl_txeMeta);
+            soSps_IsLookup.write(false);
+            soSps_RstSockPair.write(mdl_curEvent.tuple);
+            mdl_fsmState = MDL_WAIT_EVENT;
+            break;
+      #endif
         } // End of: switch(mdl_curEvent.type)
         if (DEBUG_LEVEL & TRACE_MDL) {
             printInfo(myName, "Event : [%s]\n", getEventName(mdl_curEvent.type));
@@ -736,7 +850,8 @@ void pIpHeaderConstructor(
             siMdl_TcpDatLen.read(tcpDatLen);
             currIpHdrChunk.setIp4Version(4);
             currIpHdrChunk.setIp4HdrLen(5);
-            currIpHdrChunk.setIp4ToS(0);
+            // Data segments are ECN-capable (ECT(0)) when the congestion control uses ECN
+            currIpHdrChunk.setIp4ToS((cCcUseEcn and (tcpDatLen != 0)) ? 0x02 : 0x00);
             ip4TotLen = IP4_HEADER_LEN + TCP_HEADER_LEN + tcpDatLen;
             currIpHdrChunk.setIp4TotalLen(ip4TotLen);
             currIpHdrChunk.setIp4Ident(0);
@@ -827,7 +942,7 @@ void pPseudoHeaderConstructor(
     const char *myName  = concat3(THIS_NAME, "/", "Phc");
 
     //-- STATIC CONTROL VARIABLES (with RESET) ---------------------------------
-    static ap_uint<3>          phc_chunkCount=0;
+    static ap_uint<4>          phc_chunkCount=0;
     #pragma HLS RESET variable=phc_chunkCount
 
     //-- STATIC DATAFLOW VARIABLES ---------------------------------------------
@@ -837,6 +952,8 @@ void pPseudoHeaderConstructor(
     //-- DYNAMIC VARIABLES -----------------------------------------------------
     AxisPsd4                   currChunk(0, 0xFF, 0);
     TcpSegLen                  pseudoHdrLen = 0;
+    bool                       hasOptions = (phc_meta.syn or (phc_meta.sackCnt != 0));
+    ap_uint<4>                 optChunk   = phc_chunkCount - 4;
 
     switch(phc_chunkCount) {
     case CHUNK_0:
@@ -879,41 +996,84 @@ void pPseudoHeaderConstructor(
         // Build and forward  [ UrgPtr | CSum | Win | Flags | DataOffset & Res & NS ]
         currChunk.setTcpCtrlNs(0);
         currChunk.setTcpResBits(0);
-        currChunk.setTcpDataOff(5 + (int)phc_meta.syn); // 5x32bits (+ 1x32bits for MSS)
+        // 5x32bits (+ 1x32bits per option word; .i.e, MSS, WS and SACK-Permitted, or SACK blocks)
+        currChunk.setTcpDataOff(5 + (hasOptions ? (int)(phc_meta.length/4) : 0));
         currChunk.setTcpCtrlFin(phc_meta.fin);
         currChunk.setTcpCtrlSyn(phc_meta.syn);
         currChunk.setTcpCtrlRst(phc_meta.rst);
         currChunk.setTcpCtrlPsh(0);
         currChunk.setTcpCtrlAck(phc_meta.ack);
         currChunk.setTcpCtrlUrg(0);
-        currChunk.setTcpCtrlEce(0);
+        currChunk.setTcpCtrlEce(phc_meta.ece);
         currChunk.setTcpCtrlCwr(0);
         currChunk.setTcpWindow(phc_meta.winSize);
         currChunk.setTcpChecksum(0);
         currChunk.setTcpUrgPtr(0);
-        currChunk.setTLast((phc_meta.length == 0) and (phc_meta.syn == 0));
+        currChunk.setTLast((phc_meta.length == 0) and !hasOptions);
         assessSize(myName, soTss_PseudoHdr, "soTss_PseudoHdr", 32); // [FIXME-Use constant for the length]
         soTss_PseudoHdr.write(currChunk);
         if (DEBUG_LEVEL & TRACE_PHC) { printAxisRaw(myName, "soTss_PseudoHdr =", currChunk); }
-        if (!phc_meta.syn) {
+        if (!hasOptions) {
             phc_chunkCount = 0;
         }
         else {
             phc_chunkCount++;
         }
         break;
-    case CHUNK_4:
-        // Only used for SYN and MSS negotiation
-        // Build and forward [ Data 3:0 | Opt-Data | Opt-Length | Opt-Kind ]
-        currChunk.setTcpOptKind(0x02);  // Option Kind = Maximum Segment Size
-        currChunk.setTcpOptLen(0x04);   // Option length = 4 bytes
-        currChunk.setTcpOptMss(MY_MSS); // Our Maximum Segment Size (1456)
-        currChunk.setLE_TKeep(0x0F);
-        currChunk.setLE_TLast(TLAST);
+    default:
+        if (phc_meta.syn) {
+            // Only used for SYN and MSS, Window Scale and SACK-Permitted negotiation
+            if (phc_chunkCount == CHUNK_4) {
+                // Build and forward [ Data 3:0 | Opt-Data | Opt-Length | Opt-Kind ]
+                currChunk.setTcpOptKind(0x02);  // Option Kind = Maximum Segment Size
+                currChunk.setTcpOptLen(0x04);   // Option length = 4 bytes
+                currChunk.setTcpOptMss(MY_MSS); // Our Maximum Segment Size (1456)
+                if (phc_meta.wsOpt) {
+                    // Build [ Shift | Len=3 | Kind=3 | NOP ]
+                    currChunk.setTcpOptWss(TOE_WINDOW_SCALE);
+                }
+                else if (phc_meta.sackOpt) {
+                    // Build [ Len=2 | Kind=4 | NOP | NOP ]
+                    currChunk.setTcpOptSackOk();
+                }
+                currChunk.setLE_TKeep((phc_meta.wsOpt or phc_meta.sackOpt) ? 0xFF : 0x0F);
+                currChunk.setLE_TLast((phc_meta.length <= 8) ? TLAST : 0);
+            }
+            else {
+                // Build [ Len=2 | Kind=4 | NOP | NOP ] after the Window Scale option
+                currChunk.setTcpOptSackOk(0);
+                currChunk.setLE_TKeep(0x0F);
+                currChunk.setLE_TLast(TLAST);
+            }
+        }
+        else {
+            // Build the SACK option of a pure ACK [RFC-2018]
+            //  [ L[0] | Len | Kind=5 | NOP | NOP ], [ L[1] | R[0] ], ..., [ R[n-1] ]
+            if (optChunk == 0) {
+                currChunk.setTcpOptSackHdr(phc_meta.sackCnt);
+            }
+            else {
+                currChunk.setTcpOptSackEdge(phc_meta.sackBlk[optChunk-1].right, 0);
+            }
+            if (optChunk < phc_meta.sackCnt) {
+                currChunk.setTcpOptSackEdge(phc_meta.sackBlk[optChunk].left, 32);
+                currChunk.setLE_TKeep(0xFF);
+                currChunk.setLE_TLast(0);
+            }
+            else {
+                currChunk.setLE_TKeep(0x0F);
+                currChunk.setLE_TLast(TLAST);
+            }
+        }
         assessSize(myName, soTss_PseudoHdr, "soTss_PseudoHdr", 32); // [FIXME-Use constant for the length]
         soTss_PseudoHdr.write(currChunk);
         if (DEBUG_LEVEL & TRACE_PHC) { printAxisRaw(myName, "soTss_PseudoHdr =", currChunk); }
-        phc_chunkCount = 0;
+        if (currChunk.getLE_TLast()) {
+            phc_chunkCount = 0;
+        }
+        else {
+            phc_chunkCount++;
+        }
         break;
     } // End of: switch
 
@@ -976,8 +1136,8 @@ void pTcpSegStitcher(
 
             if (DEBUG_LEVEL & TRACE_TSS) { printAxisRaw(myName, "soSca_PseudoPkt =", currHdrChunk); }
             if (tss_psdHdrChunkCount == 3) {
-                if (currHdrChunk.getTcpCtrlSyn()) {
-                    tss_fsmState = TSS_PSD_OPT;  // Segment is a SYN, handle MSS
+                if (currHdrChunk.getTcpDataOff() > 5) {
+                    tss_fsmState = TSS_PSD_OPT;  // Segment has options (.i.e, MSS or SACK)
                 }
                 else {
                     tss_fsmState = TSS_DATA;
@@ -994,16 +1154,15 @@ void pTcpSegStitcher(
         }
         break;
     case TSS_PSD_OPT:
-        //-- Read fifth chunk from [Phc] because segment includes a TCP option (.i.e, MSS)
+        //-- Read and forward the option chunks from [Phc] (.i.e, MSS, WS, SACK-Permitted or SACK)
         if (!siPhc_PseudoHdr.empty() and !soSca_PseudoPkt.full()) {
             AxisPsd4 currHdrChunk = siPhc_PseudoHdr.read();
             soSca_PseudoPkt.write(currHdrChunk);
 
             if (DEBUG_LEVEL & TRACE_TSS) { printAxisRaw(myName, "soSca_PseudoPkt =", currHdrChunk); }
-            if (not currHdrChunk.getTLast()) {
-                printFatal(myName, "Pseudo Header is malformed...\n");
+            if (currHdrChunk.getTLast()) {
+                tss_fsmState = TSS_PSD_HDR;
             }
-            tss_fsmState = TSS_PSD_HDR;
         }
         break;
     case TSS_DATA:
@@ -1023,6 +1182,8 @@ void pTcpSegStitcher(
                  else {
                      // The TCP segment was splitted in two parts
                      tss_memRdOffset = currAppChunk.getLen();
+                     // Always clear the last bit of the last chunk of 1st part
+                     currAppChunk.setTLast(0);
                      if (tss_memRdOffset != 8) {
                          // The last chunk of the 1st memory buffer is not fully populated.
                          // Don't output anything here. Save the current chunk and goto 'TSS_JOIN_2ND'.
@@ -1194,19 +1355,19 @@ void pTcpSegStitcher(
  *
  * @param[in]  siTss_PseudoPkt Incoming data stream from Tc pSegment Stitcher (Tss).
  * @param[out] soIps_PseudoPkt Outgoing data stream to IP Packet Stitcher (Ips).
- * @param[out] soTca_4SubCsums Four sub-checksums to Tcp Checksum Accumulator (Tca).
+ * @param[out] soTca_CsumAcc   The checksum accumulator to Tcp Checksum Accumulator (Tca).
  *
  * @details
  *  This process takes a TCP pseudo packet as input from the TcpSegmentStitcher
- *   (Tss) and forwards it to the IpPacketStitcher (Ips) while accumulating 4
- *    sub-checksums on the fly. When the the end-of-packet is detected, these 4
- *    sub-checksums are forwarded to the TcpChecksumAccumulator (Tca) for final
- *    checksum computation.
+ *   (Tss) and forwards it to the IpPacketStitcher (Ips) while accumulating the
+ *   checksum on the fly (@see csumChunk() in 'nts_utils'). When the end-of-packet
+ *   is detected, the carry-save accumulator is forwarded to the
+ *   TcpChecksumAccumulator (Tca) for final checksum computation.
  *******************************************************************************/
 void pSubChecksumAccumulators(
         stream<AxisPsd4>    &siTss_PseudoPkt,
         stream<AxisPsd4>    &soIps_PseudoPkt,
-        stream<SubCSums>    &soTca_4SubCsums)
+        stream<CsumAcc>     &soTca_CsumAcc)
 {
     //-- DIRECTIVES FOR THIS PROCESS -------------------------------------------
     #pragma HLS INLINE off
@@ -1215,10 +1376,8 @@ void pSubChecksumAccumulators(
     //-- STATIC CONTROL VARIABLES (with RESET) ---------------------------------
     static bool                sca_doForwardChunk=false;
     #pragma HLS RESET variable=sca_doForwardChunk
-    static ap_uint<17>         sca_4CSums[4]={0, 0, 0, 0};
-    #pragma HLS RESET variable=sca_4CSums
-    #pragma HLS ARRAY_PARTITION \
-                      variable=sca_4CSums complete dim=1
+    static CsumAcc             sca_csumAcc=0;
+    #pragma HLS RESET variable=sca_csumAcc
 
     //-- DYNAMIC VARIABLES -----------------------------------------------------
     AxisPsd4 currPktChunk;
@@ -1230,32 +1389,17 @@ void pSubChecksumAccumulators(
             //  [FIXME] Consider forwarding all chunks and drop the 1st in the next process.
             soIps_PseudoPkt.write(currPktChunk);
         }
-        for (int i = 0; i < 4; i++) {
-          #pragma HLS UNROLL
-            TcpCsum temp;
-            if (currPktChunk.getLE_TKeep(i*2+1, i*2) == 0x3) {
-                temp( 7, 0) = currPktChunk.getLE_TData(i*16+15, i*16+8);
-                temp(15, 8) = currPktChunk.getLE_TData(i*16+ 7, i*16);
-                sca_4CSums[i] += temp;
-                sca_4CSums[i] = (sca_4CSums[i] + (sca_4CSums[i] >> 16)) & 0xFFFF;
-            }
-            else if (currPktChunk.getLE_TKeep()[i*2] == 0x1) {
-                temp( 7, 0) = 0;
-                temp(15, 8) = currPktChunk.getLE_TData(i*16+7, i*16);
-                sca_4CSums[i] += temp;
-                sca_4CSums[i] = (sca_4CSums[i] + (sca_4CSums[i] >> 16)) & 0xFFFF;
-            }
-        }
+        CsumAcc csumAcc = sca_csumAcc + csumChunk(currPktChunk);
 
         sca_doForwardChunk = true;
 
         if(currPktChunk.getTLast()) {
-            soTca_4SubCsums.write(sca_4CSums);
+            soTca_CsumAcc.write(csumAcc);
             sca_doForwardChunk = false;
-            sca_4CSums[0] = 0;
-            sca_4CSums[1] = 0;
-            sca_4CSums[2] = 0;
-            sca_4CSums[3] = 0;
+            sca_csumAcc = 0;
+        }
+        else {
+            sca_csumAcc = csumAcc;
         }
     }
 } // End-of: Sca
@@ -1263,16 +1407,16 @@ void pSubChecksumAccumulators(
 /*******************************************************************************
  * @brief TCP Checksum Accumulator (Tca)
  *
- * @param[in]  siSca_FourSubCsums The 4 sub-csums from the Sub-Checksum Accumulator (Sca).
- * @param[out] soIps_TcpCsum      The computed checksum to IP Packet Stitcher (Ips).
+ * @param[in]  siSca_CsumAcc  The checksum accumulator from the Sub-Checksum Accumulator (Sca).
+ * @param[out] soIps_TcpCsum  The computed checksum to IP Packet Stitcher (Ips).
  *
  * @details
- *  Computes the final TCP checksum from the 4 accumulated sub-checksums and
+ *  Folds the carries saved by the accumulator into the final TCP checksum and
  *   forwards the results to the  IP Packet Stitcher (Ips).
  *
  *******************************************************************************/
 void pTcpChecksumAccumulator(
-        stream<SubCSums>       &siSca_FourSubCsums,
+        stream<CsumAcc>        &siSca_CsumAcc,
         stream<TcpChecksum>    &soIps_TcpCsum)
 {
     //-- DIRECTIVES FOR THIS PROCESS -------------------------------------------
@@ -1281,21 +1425,13 @@ void pTcpChecksumAccumulator(
 
     const char *myName  = concat3(THIS_NAME, "/", "Tca");
 
-    if (!siSca_FourSubCsums.empty()) {
-        SubCSums tca_4CSums = siSca_FourSubCsums.read();
-
-        tca_4CSums.sum0 += tca_4CSums.sum2;
-        tca_4CSums.sum1 += tca_4CSums.sum3;
-        tca_4CSums.sum0 = (tca_4CSums.sum0 + (tca_4CSums.sum0 >> 16)) & 0xFFFF;
-        tca_4CSums.sum1 = (tca_4CSums.sum1 + (tca_4CSums.sum1 >> 16)) & 0xFFFF;
-        tca_4CSums.sum0 += tca_4CSums.sum1;
-        tca_4CSums.sum0 = (tca_4CSums.sum0 + (tca_4CSums.sum0 >> 16)) & 0xFFFF;
-        tca_4CSums.sum0 = ~tca_4CSums.sum0;
+    if (!siSca_CsumAcc.empty()) {
+        TcpChecksum tcpCsum = ~csumFold(siSca_CsumAcc.read());
 
         if (DEBUG_LEVEL & TRACE_TCA) {
-            printInfo(myName, "Checksum =0x%4.4X\n", tca_4CSums.sum0.to_uint());
+            printInfo(myName, "Checksum =0x%4.4X\n", tcpCsum.to_uint());
         }
-        soIps_TcpCsum.write(tca_4CSums.sum0);
+        soIps_TcpCsum.write(tcpCsum);
     }
 }
 
@@ -1411,13 +1547,15 @@ void pIpPktStitcher(
  *  Front end memory controller for reading data from the external DRAM.
  *  This process receives a read command from the MetaDataLoader (Mdl) and
  *  forwards it to the AXI4 Data Mover. The incoming memory read command might
- *  end-up being split in two memory accesses if the address of the data buffer
- *  to read from wraps in the external memory. Such a split memory access is
- *  flagged by the signal 'soTss_SplitMemAcc'.
+ *  end-up being split in two memory accesses if the data buffer to read from
+ *  is not contiguous in the external memory (i.e. it wraps around, crosses a
+ *  buffer page, or starts with bytes which spilled over into the spill region). Such a split memory access is
+ *  flagged by the signal 'soTss_SplitMemAcc'. An application buffer (i.e.
+ *  zero-copy) is linear and is always read with a single memory access.
  *
  *******************************************************************************/
 void pTxMemoryReader(
-        stream<DmCmd>       &siMdl_BufferRdCmd,
+        stream<TxBufRdCmd>  &siMdl_BufferRdCmd,
         stream<DmCmd>       &soMEM_TxpRdCmd,
         stream<FlagBool>    &soTss_SplitMemAcc)
 {
@@ -1434,17 +1572,19 @@ void pTxMemoryReader(
 
     //-- STATIC DATAFLOW VARIABLES ---------------------------------------------
     static DmCmd    mrd_memRdCmd;
-    static TxBufPtr mrd_firstAccLen;
+    static TcpSegLen mrd_firstAccLen;
     static uint16_t mrd_debugCounter=1;
 
     switch (mrd_fsmState) {
     case MRD_1ST_ACCESS:
         if (!siMdl_BufferRdCmd.empty() and !soTss_SplitMemAcc.full() and !soMEM_TxpRdCmd.full()) {
-            siMdl_BufferRdCmd.read(mrd_memRdCmd);
+            TxBufRdCmd bufRdCmd = siMdl_BufferRdCmd.read();
+            mrd_memRdCmd = bufRdCmd.dmCmd;
 
-            if ((mrd_memRdCmd.saddr(TOE_WINDOW_BITS-1, 0) + mrd_memRdCmd.btt) > TOE_TX_BUFFER_SIZE) {
+            if (!bufRdCmd.zeroCopy and (mrd_memRdCmd.btt > bufRdCmd.contLen)) {
                 // This segment was broken in two memory accesses because TCP Tx memory buffer wrapped around
-                mrd_firstAccLen = TOE_TX_BUFFER_SIZE - mrd_memRdCmd.saddr;
+                //  (or because it crossed a buffer page when the buffer pool is enabled)
+                mrd_firstAccLen = bufRdCmd.contLen;
                 mrd_fsmState = MRD_2ND_ACCESS;
 
                 soMEM_TxpRdCmd.write(DmCmd(mrd_memRdCmd.saddr, mrd_firstAccLen));
@@ -1471,8 +1611,11 @@ void pTxMemoryReader(
         break;
     case MRD_2ND_ACCESS:
         if (!soMEM_TxpRdCmd.full()) {
-            // Update the command to account for the Tx buffer wrap around
-            mrd_memRdCmd.saddr(TOE_WINDOW_BITS-1, 0) = 0;
+            // Update the command to account for the Tx buffer wrap around (or page crossing)
+            mrd_memRdCmd.saddr(TOE_WINDOW_BITS-1, 0) = mrd_memRdCmd.saddr(TOE_WINDOW_BITS-1, 0) + mrd_firstAccLen;
+          #if TOE_SPILL_CFG
+            mrd_memRdCmd.saddr[TOE_WINDOW_BITS] = 0;
+          #endif
             soMEM_TxpRdCmd.write(DmCmd(mrd_memRdCmd.saddr, mrd_memRdCmd.btt - mrd_firstAccLen));
             mrd_fsmState = MRD_1ST_ACCESS;
 
@@ -1557,7 +1700,7 @@ void tx_engine(
     static stream<bool>                 ssMdlToSpS_IsLookup     ("ssMdlToSpS_IsLookup");
     #pragma HLS stream         variable=ssMdlToSpS_IsLookup     depth=4
 
-    static stream<DmCmd>                ssMdlToMrd_BufferRdCmd  ("ssMdlToMrd_BufferRdCmd");
+    static stream<TxBufRdCmd>           ssMdlToMrd_BufferRdCmd  ("ssMdlToMrd_BufferRdCmd");
     #pragma HLS stream         variable=ssMdlToMrd_BufferRdCmd  depth=32
     #pragma HLS DATA_PACK      variable=ssMdlToMrd_BufferRdCmd
 
@@ -1607,12 +1750,11 @@ void tx_engine(
     //-- Sub-Checksum Accumulator (Sca)
     //-------------------------------------------------------------------------
     static stream<AxisPsd4>             ssScaToIps_PseudoPkt    ("ssScaToIps_PseudoPkt");
-    #pragma HLS stream         variable=ssScaToIps_PseudoPkt    depth=256  // WARNING: Critical; has to keep complete packet for checksum computation
+    #pragma HLS stream         variable=ssScaToIps_PseudoPkt    depth=cDepth_FullSegment  // WARNING: Critical; has to keep complete packet for checksum computation
     #pragma HLS DATA_PACK      variable=ssScaToIps_PseudoPkt
 
-    static stream<SubCSums>             ssScaToTca_FourSubCsums ("ssScaToTca_FourSubCsums");
-    #pragma HLS stream         variable=ssScaToTca_FourSubCsums depth=2
-    #pragma HLS DATA_PACK      variable=ssScaToTca_FourSubCsums
+    static stream<CsumAcc>              ssScaToTca_CsumAcc      ("ssScaToTca_CsumAcc");
+    #pragma HLS stream         variable=ssScaToTca_CsumAcc      depth=2
 
     //------------------------------------------------------------------------
     //-- Memory Reader (Mrd)
@@ -1677,10 +1819,10 @@ void tx_engine(
     pSubChecksumAccumulators(
             ssTssToSca_PseudoPkt,
             ssScaToIps_PseudoPkt,
-            ssScaToTca_FourSubCsums);
+            ssScaToTca_CsumAcc);
 
     pTcpChecksumAccumulator(
-            ssScaToTca_FourSubCsums,
+            ssScaToTca_CsumAcc,
             ssTcaToIps_TcpCsum);
 
 }
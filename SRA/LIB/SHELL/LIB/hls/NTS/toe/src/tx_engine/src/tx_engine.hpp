@@ -61,6 +61,7 @@ EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "../../../../../NTS/nts_utils.hpp"
 #include "../../../../../NTS/toe/src/toe.hpp"
 #include "../../../../../NTS/toe/src/toe_utils.hpp"
+#include "../../../../../NTS/toe/src/congestion_control/congestion_control.hpp"
 #include "../../../../../NTS/SimNtsUtils.hpp"
 #include "../../../../../NTS/AxisIp4.hpp"
 #include "../../../../../NTS/AxisPsd4.hpp"
@@ -80,30 +81,37 @@ class TXeMeta {
     ap_uint<1>  rst;
     ap_uint<1>  syn;
     ap_uint<1>  fin;
-    TXeMeta() {}
+    ap_uint<1>  ece;  // ECN-Echo
+    FlagBool    wsOpt; // Append a Window Scale option (SYN only)
+    FlagBool    sackOpt; // Append a SACK-permitted option (SYN only)
+    OooCnt      sackCnt; // Number of SACK blocks to append (ACK only)
+    OooBlock    sackBlk[TOE_MAX_OOO_BLOCKS];
+    TXeMeta() : wsOpt(false), sackOpt(false), sackCnt(0) {}
     TXeMeta(ap_uint<1> ack, ap_uint<1> rst, ap_uint<1> syn, ap_uint<1> fin)
-        : seqNumb(0), ackNumb(0), winSize(0), length(0), ack(ack), rst(rst), syn(syn), fin(fin) {}
+        : seqNumb(0), ackNumb(0), winSize(0), length(0), ack(ack), rst(rst), syn(syn), fin(fin), ece(0), wsOpt(false), sackOpt(false), sackCnt(0) {}
     TXeMeta(TcpSeqNum seqNumb, TcpAckNum ackNumb, ap_uint<1> ack, ap_uint<1> rst, ap_uint<1> syn, ap_uint<1> fin)
-        : seqNumb(seqNumb), ackNumb(ackNumb), winSize(0), length(0), ack(ack), rst(rst), syn(syn), fin(fin) {}
+        : seqNumb(seqNumb), ackNumb(ackNumb), winSize(0), length(0), ack(ack), rst(rst), syn(syn), fin(fin), ece(0), wsOpt(false), sackOpt(false), sackCnt(0) {}
     TXeMeta(TcpSeqNum seqNumb, TcpAckNum ackNumb, TcpWindow winSize, ap_uint<1> ack, ap_uint<1> rst, ap_uint<1> syn, ap_uint<1> fin)
-        : seqNumb(seqNumb), ackNumb(ackNumb), winSize(winSize), length(0), ack(ack), rst(rst), syn(syn), fin(fin) {}
+        : seqNumb(seqNumb), ackNumb(ackNumb), winSize(winSize), length(0), ack(ack), rst(rst), syn(syn), fin(fin), ece(0), wsOpt(false), sackOpt(false), sackCnt(0) {}
 };
 
 
 /********************************************
- * TXe - A set of 4 TCP Sub-Checksums
+ * TXe - Tx Buffer Read Command
+ *  A memory read command along with a flag
+ *  telling if the buffer to read from is a
+ *  circular Tx buffer which may wrap around,
+ *  and the number of bytes which are then
+ *  contiguous in memory.
  ********************************************/
-struct SubCSums
-{
-    ap_uint<17>     sum0;
-    ap_uint<17>     sum1;
-    ap_uint<17>     sum2;
-    ap_uint<17>     sum3;
-    SubCSums() {}
-    SubCSums(ap_uint<17> sums[4]) :
-        sum0(sums[0]), sum1(sums[1]), sum2(sums[2]), sum3(sums[3]) {}
-    SubCSums(ap_uint<17> s0, ap_uint<17> s1, ap_uint<17> s2, ap_uint<17> s3) :
-        sum0(s0), sum1(s1), sum2(s2), sum3(s3) {}
+class TxBufRdCmd {
+  public:
+    DmCmd       dmCmd;
+    FlagBool    zeroCopy;  // The data sit in a linear APP buffer
+    TcpSegLen   contLen;   // Bytes contiguous in memory (circular Tx buffer only)
+    TxBufRdCmd() {}
+    TxBufRdCmd(DmCmd dmCmd, FlagBool zeroCopy, TcpSegLen contLen) :
+        dmCmd(dmCmd), zeroCopy(zeroCopy), contLen(contLen) {}
 };
 
 
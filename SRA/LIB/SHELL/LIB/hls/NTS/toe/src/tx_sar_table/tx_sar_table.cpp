@@ -53,6 +53,8 @@ EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  *****************************************************************************/
 
 #include "tx_sar_table.hpp"
+#include "../buffer_pool/buffer_pool.hpp"
+#include "../congestion_control/congestion_control.hpp"
 
 using namespace hls;
 
@@ -83,10 +85,37 @@ using namespace hls;
  * @param[out] soTXe_TxSarRep  Tx SAR reply to [TXe].
  * @param[in]  siTAi_PushCmd   Push command from TxAppInterface (TAi).
  * @param[out] soTAi_PushCmd   Push command to [TAi].
+ * @param[out] soBPl_PageRel   Release of Tx buffer pages to BufferPool (BPl).
  *
  * @details
  *  This process is accessed by the RxEngine (RXe), the TxEngine (TXe) and the
  *   TxAppInterface (TAi).
+ *  It also times one segment per round-trip on behalf of the RTT estimator:
+ *   the timing starts when [TXe] advances 'unak' while no segment is being
+ *   timed, and it is cancelled upon a retransmission (Karn's algorithm). The
+ *   elapsed time is returned to [RXe] which updates the estimator.
+ *  The congestion window is updated by [RXe] upon the receipt of an ACK, and
+ *   by this process upon a retransmission timeout signaled by [TXe] (@see
+ *   congestion_control.hpp).
+ *  The window advertised by the peer is scaled by the shift count which was
+ *   negotiated during the SYN exchange [RFC-7323] before it gets stored.
+ *  The left edge of the lowest block SACK'ed by the peer is kept along with
+ *   the ACK number. [TXe] uses it to retransmit the hole only [RFC-2018].
+ *  The MSS of the peer is set by [RXe] during the SYN exchange. [TXe] uses it
+ *   to segment the data and the congestion control to size its windows.
+ *  The data of a session are either located in its Tx buffer or, when they
+ *   were described by the application (i.e. zero-copy), in the application
+ *   buffer given by [TAi]. [TXe] reads them from the location returned here.
+ *  When the Tx buffers are backed by the buffer pool (TOE_BUF_POOL_CFG), the
+ *   pages which were entirely acknowledged by the peer and the pages of a
+ *   session which is (re)initialized are released to [BPl].
+ *  When the Tx buffers are followed by a spill region (TOE_SPILL_CFG), the
+ *   number of bytes which [TAi] wrote past the end of a buffer is kept for the
+ *   lap of 'ackd' ('spillCur') and for the next one ('spillNext'), such that
+ *   [TXe] can locate these bytes and [TAi] does not overwrite them.
+ *  An entry is normally initialized by [TXe] when it sends the SYN or SYN-ACK
+ *   of its session. The session of a SYN cookie never had such a SYN-ACK, so
+ *   its entry is initialized by [RXe] upon the ACK of that cookie instead.
  *******************************************************************************/
 void tx_sar_table(
         stream<RXeTxSarQuery>      &siRXe_TxSarQry,
@@ -94,7 +123,8 @@ void tx_sar_table(
         stream<TXeTxSarQuery>      &siTXe_TxSarQry,
         stream<TXeTxSarReply>      &soTXe_TxSarRep,
         stream<TAiTxSarPush>       &siTAi_PushCmd,
-        stream<TStTxSarPush>       &soTAi_PushCmd)
+        stream<TStTxSarPush>       &soTAi_PushCmd,
+        stream<BufPageRel>         &soBPl_PageRel)
 {
     //-- DIRECTIVES FOR THIS PROCESS -------------------------------------------
     #pragma HLS PIPELINE II=1 enable_flush
@@ -104,7 +134,27 @@ void tx_sar_table(
     //-- STATIC ARRAYS ---------------------------------------------------------
     static TxSarEntry               TX_SAR_TABLE[TOE_MAX_SESSIONS];
     #pragma HLS DEPENDENCE variable=TX_SAR_TABLE inter false
-    #pragma HLS RESOURCE   variable=TX_SAR_TABLE core=RAM_2P
+  #if TOE_USE_URAM
+    #pragma HLS RESOURCE   variable=TX_SAR_TABLE core=XPM_MEMORY uram
+  #else
+    #pragma HLS RESOURCE   variable=TX_SAR_TABLE core=RAM_T2P_BRAM
+  #endif
+    #pragma HLS DATA_PACK  variable=TX_SAR_TABLE
+
+    //-- STATIC CONTROL VARIABLES (with RESET) ---------------------------------
+    static ap_uint<32>              tst_cycCnt;
+    #pragma HLS RESET      variable=tst_cycCnt
+    static TimeTick                 tst_nowTick;
+    #pragma HLS RESET      variable=tst_nowTick
+
+    //-- Free running clock of the RTT estimator (same tick as the timers)
+    if (tst_cycCnt == TOE_TIMER_TICK-1) {
+        tst_cycCnt = 0;
+        tst_nowTick++;
+    }
+    else {
+        tst_cycCnt++;
+    }
 
     if (!siTXe_TxSarQry.empty()) {
         TXeTxSarQuery sTXeQry;
@@ -113,14 +163,30 @@ void tx_sar_table(
         //----------------------------------------
         siTXe_TxSarQry.read(sTXeQry);
         if (sTXeQry.write) {
+            // Read-modify-write the entire (packed) entry
+            TxSarEntry txSarEntry = TX_SAR_TABLE[sTXeQry.sessionID];
             //-- TXe Write Query
             if (not sTXeQry.isRtQuery) {
-                TX_SAR_TABLE[sTXeQry.sessionID].unak = sTXeQry.not_ackd;
                 if (sTXeQry.init) {
-                    TX_SAR_TABLE[sTXeQry.sessionID].appw        = sTXeQry.not_ackd;
-                    TX_SAR_TABLE[sTXeQry.sessionID].ackd        = sTXeQry.not_ackd-1;
-                    TX_SAR_TABLE[sTXeQry.sessionID].cong_window = 0x3908; // 10 x 1460(MSS)
-                    TX_SAR_TABLE[sTXeQry.sessionID].slowstart_threshold = 0xFFFF;
+                  #if TOE_BUF_POOL_CFG
+                    //-- Flush the pages left over by a previous session
+                    soBPl_PageRel.write(BufPageRel(toBufPageNum(sTXeQry.sessionID, 0),
+                                                   (1 << (TOE_WINDOW_BITS-TOE_PAGE_BITS))));
+                  #endif
+                    txSarEntry.appw        = sTXeQry.not_ackd;
+                    txSarEntry.ackd        = sTXeQry.not_ackd-1;
+                    ccInit(txSarEntry.cong_window, txSarEntry.slowstart_threshold,
+                           txSarEntry.cc, sTXeQry.not_ackd, txSarEntry.mss);
+                    txSarEntry.count       = 0;
+                    txSarEntry.fastRetransmitted = false;
+                    txSarEntry.srtt        = 0;
+                    txSarEntry.rttvar      = 0;
+                    txSarEntry.rto         = TOE_RTO_INIT;
+                    txSarEntry.rttPending  = false;
+                    txSarEntry.sackValid   = false;
+                    txSarEntry.zeroCopy    = false;
+                    txSarEntry.spillCur    = 0;
+                    txSarEntry.spillNext   = 0;
                     // Avoid initializing 'finReady' and 'finSent' at two different
                     // places because it will translate into II=2 and DRC message:
                     // 'Unable to schedule store operation on array due to limited memory ports'.
@@ -129,41 +195,64 @@ void tx_sar_table(
                     soTAi_PushCmd.write(TStTxSarPush(sTXeQry.sessionID,
                                                      sTXeQry.not_ackd, CMD_INIT));
                 }
+                else if (not txSarEntry.rttPending and (sTXeQry.not_ackd != txSarEntry.unak)) {
+                    //-- Start timing the last byte of this transmission
+                    txSarEntry.rttSeq      = sTXeQry.not_ackd;
+                    txSarEntry.rttTick     = tst_nowTick;
+                    txSarEntry.rttPending  = true;
+                }
+                txSarEntry.unak = sTXeQry.not_ackd;
                 if (sTXeQry.finReady or sTXeQry.init) {
-                    TX_SAR_TABLE[sTXeQry.sessionID].finReady = sTXeQry.finReady;
+                    txSarEntry.finReady = sTXeQry.finReady;
                 }
                 if (sTXeQry.finSent or sTXeQry.init) {
-                    TX_SAR_TABLE[sTXeQry.sessionID].finSent  = sTXeQry.finSent;
+                    txSarEntry.finSent  = sTXeQry.finSent;
                 }
             }
             else {
                 //-- TXe Write RtQuery
-                TXeTxSarRtQuery sTXeRtQry = sTXeQry;
-                TX_SAR_TABLE[sTXeQry.sessionID].slowstart_threshold = sTXeRtQry.getThreshold();
-                TX_SAR_TABLE[sTXeQry.sessionID].cong_window = 0x3908; // 10 x 1460(MSS) TODO is this correct or less, eg. 1/2 * MSS
+                LocalWinSize flightSize = (LocalWinSize)(txSarEntry.unak - txSarEntry.ackd);
+                ccOnTimeout(txSarEntry.cong_window, txSarEntry.slowstart_threshold,
+                            txSarEntry.cc, flightSize, txSarEntry.mss);
+                //-- A timeout terminates any ongoing fast recovery
+                txSarEntry.count = 0;
+                txSarEntry.fastRetransmitted = false;
+                //-- Karn's algorithm: do not sample a retransmitted segment
+                txSarEntry.rttPending = false;
                 if (DEBUG_LEVEL & TRACE_TST) {
                     printInfo(myName, "Received a Retry-Write query from TXe for session #%d.\n",
                             sTXeQry.sessionID.to_int());
                 }
             }
+            TX_SAR_TABLE[sTXeQry.sessionID] = txSarEntry;
         }
         else {
             //-- TXe Read Query
             TxSarEntry txSarEntry = TX_SAR_TABLE[sTXeQry.sessionID];
 
-            TcpWindow   minWindow;
+            LocalWinSize minWindow;
             if (txSarEntry.cong_window < txSarEntry.recv_window) {
                 minWindow = txSarEntry.cong_window;
             }
             else {
-                minWindow = TX_SAR_TABLE[sTXeQry.sessionID].recv_window;
+                minWindow = txSarEntry.recv_window;
             }
-            soTXe_TxSarRep.write(TXeTxSarReply(TX_SAR_TABLE[sTXeQry.sessionID].ackd,
-                                               TX_SAR_TABLE[sTXeQry.sessionID].unak,
-                                               minWindow,
-                                               TX_SAR_TABLE[sTXeQry.sessionID].appw,
-                                               TX_SAR_TABLE[sTXeQry.sessionID].finReady,
-                                               TX_SAR_TABLE[sTXeQry.sessionID].finSent));
+            TXeTxSarReply txSarReply(txSarEntry.ackd,
+                                     txSarEntry.unak,
+                                     minWindow,
+                                     txSarEntry.appw,
+                                     txSarEntry.finReady,
+                                     txSarEntry.finSent,
+                                     txSarEntry.rto,
+                                     txSarEntry.sackValid,
+                                     txSarEntry.sackLeft,
+                                     txSarEntry.mss,
+                                     txSarEntry.zeroCopy,
+                                     txSarEntry.zcBase,
+                                     txSarEntry.zcOrg);
+            txSarReply.spillCur  = txSarEntry.spillCur;
+            txSarReply.spillNext = txSarEntry.spillNext;
+            soTXe_TxSarRep.write(txSarReply);
         }
     }
     else if (!siTAi_PushCmd.empty()) {
@@ -172,8 +261,17 @@ void tx_sar_table(
         //-- Wr Command from TX APP Interface
         //---------------------------------------
         siTAi_PushCmd.read(sTAiCmd);
-        //--  Update the 'txAppWrPtr'
-        TX_SAR_TABLE[sTAiCmd.sessionID].appw = sTAiCmd.app;
+        //--  Update the 'txAppWrPtr' and the location of the data
+        TxSarEntry txSarEntry = TX_SAR_TABLE[sTAiCmd.sessionID];
+        txSarEntry.appw     = sTAiCmd.app;
+        txSarEntry.zeroCopy = sTAiCmd.zeroCopy;
+        txSarEntry.zcBase   = sTAiCmd.zcBase;
+        txSarEntry.zcOrg    = sTAiCmd.zcOrg;
+        if (sTAiCmd.spill > txSarEntry.spillNext) {
+            //-- The APP data were written past the end of the buffer
+            txSarEntry.spillNext = sTAiCmd.spill;
+        }
+        TX_SAR_TABLE[sTAiCmd.sessionID] = txSarEntry;
     }
     else if (!siRXe_TxSarQry.empty()) {
         RXeTxSarQuery sRXeQry;
@@ -182,22 +280,119 @@ void tx_sar_table(
         //---------------------------------------
         siRXe_TxSarQry.read(sRXeQry);
         if (sRXeQry.write == QUERY_WR) {
-            TX_SAR_TABLE[sRXeQry.sessionID].ackd        = sRXeQry.ackd;
-            TX_SAR_TABLE[sRXeQry.sessionID].recv_window = sRXeQry.recv_window;
-            TX_SAR_TABLE[sRXeQry.sessionID].cong_window = sRXeQry.cong_window;
-            TX_SAR_TABLE[sRXeQry.sessionID].count       = sRXeQry.count;
-            TX_SAR_TABLE[sRXeQry.sessionID].fastRetransmitted = sRXeQry.fastRetransmitted;
+            TxSarEntry txSarEntry = TX_SAR_TABLE[sRXeQry.sessionID];
+          #if TOE_BUF_POOL_CFG
+            if (sRXeQry.init) {
+                //-- Flush the pages left over by a previous session
+                soBPl_PageRel.write(BufPageRel(toBufPageNum(sRXeQry.sessionID, 0),
+                                               (1 << (TOE_WINDOW_BITS-TOE_PAGE_BITS))));
+            }
+            else {
+                //-- Release the pages which were entirely acknowledged
+                BufPageCnt nrPages = (sRXeQry.ackd(TOE_WINDOW_BITS-1, TOE_PAGE_BITS) -
+                                      txSarEntry.ackd(TOE_WINDOW_BITS-1, TOE_PAGE_BITS)) &
+                                     ((1 << (TOE_WINDOW_BITS-TOE_PAGE_BITS)) - 1);
+                if (nrPages != 0) {
+                    soBPl_PageRel.write(BufPageRel(toBufPageNum(sRXeQry.sessionID,
+                                                   txSarEntry.ackd(TOE_WINDOW_BITS-1, 0)), nrPages));
+                }
+            }
+          #endif
+            if ((TxBufPtr)sRXeQry.ackd < (TxBufPtr)txSarEntry.ackd) {
+                //-- 'ackd' wrapped around: The spilled bytes of the next lap become those of its lap
+                txSarEntry.spillCur  = txSarEntry.spillNext;
+                txSarEntry.spillNext = 0;
+            }
+            txSarEntry.ackd        = sRXeQry.ackd;
+            if (sRXeQry.wsInit) {
+                //-- SYN or SYN-ACK: Set the shift count and the MSS; the window itself is never scaled
+                txSarEntry.recv_win_scale = sRXeQry.recv_win_scale;
+                txSarEntry.mss            = sRXeQry.mss;
+            }
+            if (sRXeQry.wsInit and !sRXeQry.init) {
+                txSarEntry.recv_window    = sRXeQry.recv_window;
+            }
+            else {
+                //-- Scale the window advertised by the peer and saturate it to our Tx buffer size
+                ap_uint<TOE_WINDOW_BITS+14> scaledWindow = sRXeQry.recv_window;
+                scaledWindow = scaledWindow << txSarEntry.recv_win_scale.to_uint();
+                if (scaledWindow > (TOE_TX_BUFFER_SIZE-1)) {
+                    txSarEntry.recv_window = TOE_TX_BUFFER_SIZE-1;
+                }
+                else {
+                    txSarEntry.recv_window = scaledWindow;
+                }
+            }
+            txSarEntry.cong_window = sRXeQry.cong_window;
+            txSarEntry.count       = sRXeQry.count;
+            txSarEntry.fastRetransmitted = sRXeQry.fastRetransmitted;
+            if (sRXeQry.ccUpdate) {
+                txSarEntry.slowstart_threshold = sRXeQry.slowstart_threshold;
+                txSarEntry.recover     = sRXeQry.recover;
+                txSarEntry.cc          = sRXeQry.cc;
+                txSarEntry.sackValid   = sRXeQry.sackValid;
+                txSarEntry.sackLeft    = sRXeQry.sackLeft;
+            }
+            if (sRXeQry.rttUpdate) {
+                txSarEntry.srtt        = sRXeQry.srtt;
+                txSarEntry.rttvar      = sRXeQry.rttvar;
+                txSarEntry.rto         = sRXeQry.rto;
+                txSarEntry.rttPending  = false;
+            }
+            if (sRXeQry.init) {
+                //-- A session restored from a SYN cookie. Its SYN-ACK is already acknowledged
+                txSarEntry.appw        = sRXeQry.ackd;
+                txSarEntry.unak        = sRXeQry.ackd;
+                ccInit(txSarEntry.cong_window, txSarEntry.slowstart_threshold,
+                       txSarEntry.cc, sRXeQry.ackd, txSarEntry.mss);
+                txSarEntry.srtt        = 0;
+                txSarEntry.rttvar      = 0;
+                txSarEntry.rto         = TOE_RTO_INIT;
+                txSarEntry.rttPending  = false;
+                txSarEntry.sackValid   = false;
+                txSarEntry.zeroCopy    = false;
+                txSarEntry.spillCur    = 0;
+                txSarEntry.spillNext   = 0;
+                txSarEntry.finReady    = false;
+                txSarEntry.finSent     = false;
+                // Init ACK on the TxAppInterface side
+                soTAi_PushCmd.write(TStTxSarPush(sRXeQry.sessionID,
+                                                 sRXeQry.ackd, CMD_INIT));
+            }
+            TX_SAR_TABLE[sRXeQry.sessionID] = txSarEntry;
             // Push ACK to txAppInterface
-            soTAi_PushCmd.write(TStTxSarPush(sRXeQry.sessionID, sRXeQry.ackd));
+            TStTxSarPush ackPush(sRXeQry.sessionID, sRXeQry.ackd);
+            ackPush.spillCur = txSarEntry.spillCur;
+            soTAi_PushCmd.write(ackPush);
         }
         else {
             //-- Read Query
-            soRXe_TxSarRep.write(RXeTxSarReply(TX_SAR_TABLE[sRXeQry.sessionID].ackd,
-                                               TX_SAR_TABLE[sRXeQry.sessionID].unak,
-                                               TX_SAR_TABLE[sRXeQry.sessionID].cong_window,
-                                               TX_SAR_TABLE[sRXeQry.sessionID].slowstart_threshold,
-                                               TX_SAR_TABLE[sRXeQry.sessionID].count,
-                                               TX_SAR_TABLE[sRXeQry.sessionID].fastRetransmitted));
+            TxSarEntry txSarEntry = TX_SAR_TABLE[sRXeQry.sessionID];
+            ap_uint<32> elapsed = tst_nowTick - txSarEntry.rttTick;
+            RttTime     rttElapsed;
+            if (elapsed > TOE_RTO_MAX) {
+                rttElapsed = TOE_RTO_MAX;  // Saturate
+            }
+            else {
+                rttElapsed = elapsed;
+            }
+            soRXe_TxSarRep.write(RXeTxSarReply(txSarEntry.ackd,
+                                               txSarEntry.unak,
+                                               txSarEntry.cong_window,
+                                               txSarEntry.slowstart_threshold,
+                                               txSarEntry.count,
+                                               txSarEntry.fastRetransmitted,
+                                               txSarEntry.recover,
+                                               txSarEntry.appw,
+                                               txSarEntry.cc,
+                                               tst_nowTick,
+                                               txSarEntry.rttPending,
+                                               txSarEntry.rttSeq,
+                                               rttElapsed,
+                                               txSarEntry.srtt,
+                                               txSarEntry.rttvar,
+                                               txSarEntry.rto,
+                                               txSarEntry.mss));
         }
     }
 }
@@ -63,7 +63,7 @@ using namespace hls;
 /*******************************************************************************
  * Tx SAR Table (TSt)
  *  Structure to manage the transmitted data stream in the TCP Tx buffer memory.
- *  Every session is allocated with a static Tx buffer of 64KB to store the
+ *  Every session is allocated with a static Tx buffer of 64KB (by default) to store the
  *  stream of bytes received from the application layer, until the network
  *  layer consumes (.i.e read) them out and acknowledge them.
  *  The Tx buffer is managed as a circular buffer with three pointers:
@@ -80,6 +80,21 @@ using namespace hls;
  *          |269|270|271|272|273|274|275|276|277|278|279|280|281|282|283|284|
  *        --+---+---+---+---+---+---+---+---+---+---+---+---+---+---+---+---+--
  *
+ * The structure also holds the round-trip time estimator of the session. One
+ *  segment per round-trip is timed ('rttSeq', 'rttTick') and the resulting
+ *  samples are smoothed into 'srtt' and 'rttvar' by [RXe] as specified by
+ *  RFC-6298. The derived 'rto' is used to program the retransmission timer.
+ *
+ * Upon the receipt of 'TOE_DUP_ACK_THRESHOLD' duplicate ACKs, [RXe] enters the
+ *  fast recovery of RFC-6582 (NewReno). The flag 'fastRetransmitted' is then
+ *  set and 'recover' holds the highest sequence number sent at that time.
+ *
+ * The congestion window is managed by the algorithm selected with the build
+ *  option 'TOE_CC_ALGO_CFG' and its per-session state is held in 'cc'.
+ *
+ * The window advertised by the remote receiver is stored after it was scaled
+ *  by 'recv_win_scale', which is negotiated during the SYN exchange.
+ *
  * [TODO - The structure is also used to manage the send window...]
  *******************************************************************************/
 class TxSarEntry {
@@ -88,12 +103,29 @@ class TxSarEntry {
     TxAckNum        unak;        // Bytes TX'ed but not ACK'ed
     TxAckNum        ackd;        // Bytes TX'ed and ACK'ed
     RemotWinSize    recv_window; // Remote receiver's buffer size (their)
+    TcpOptWss       recv_win_scale; // Shift count of the remote receiver's window [RFC-7323]
     LocalWinSize    cong_window; // Local  receiver's buffer size (mine)
-    TcpWindow       slowstart_threshold;
-    ap_uint<2>      count;
-    bool            fastRetransmitted;
+    LocalWinSize    slowstart_threshold;
+    ap_uint<2>      count;       // Number of duplicate ACKs
+    bool            fastRetransmitted; // Session is in fast recovery
+    TxAckNum        recover;     // Highest sequence number sent when entering fast recovery
+    CcState         cc;          // State of the congestion control algorithm
     bool            finReady;
     bool            finSent;
+    RttTime         srtt;        // Smoothed round-trip time (x8)
+    RttTime         rttvar;      // Round-trip time variation (x4)
+    RttTime         rto;         // Retransmission timeout [RFC-6298]
+    TxAckNum        rttSeq;      // Sequence number which is being timed
+    ap_uint<32>     rttTick;     // Tick at which 'rttSeq' was sent
+    bool            rttPending;  // A segment is being timed
+    bool            sackValid;   // The peer reported a SACK block with its last ACK
+    TxAckNum        sackLeft;    // Left edge of the lowest block SACK'ed by the peer [RFC-2018]
+    TcpSegLen       mss;         // Maximum segment size advertised by the peer (capped to MY_MSS)
+    bool            zeroCopy;    // The data are read from the APP buffer (zero-copy)
+    TxMemPtr        zcBase;      // Address of the byte at 'zcOrg' in the APP buffer
+    TxBufPtr        zcOrg;       // Tx buffer pointer of the first zero-copy byte
+    TxBufPtr        spillCur;    // Bytes of the lap of 'ackd' held by the spill region
+    TxBufPtr        spillNext;   // Bytes of the next lap held by the spill region
     TxSarEntry() {}
 };
 
@@ -112,7 +144,9 @@ void tx_sar_table(
         stream<TXeTxSarReply>      &soTXe_TxSarRep,
         //-- TCP Application Interfaces
         stream<TAiTxSarPush>       &siTAi_AppPush,
-        stream<TStTxSarPush>       &soTAi_AckPush
+        stream<TStTxSarPush>       &soTAi_AckPush,
+        //-- Buffer Pool Interface
+        stream<BufPageRel>         &soBPl_PageRel
 );
 
 #endif
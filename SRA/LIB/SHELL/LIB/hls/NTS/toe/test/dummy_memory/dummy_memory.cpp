@@ -56,25 +56,33 @@ EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 // Set the private data elements for a Read Command
 void DummyMemory::setReadCmd(DmCmd cmd) {
-    this->readAddr = cmd.saddr(15,  0); // Start address
-    this->readId   = cmd.saddr(31, 16); // Buffer address
+    checkCmd(cmd);
+    this->readAddr = cmd.saddr(TOE_PAGE_BITS-1, 0); // Start address
+    this->readId   = cmd.saddr(31, TOE_PAGE_BITS); // Buffer address
     uint16_t tempLen = (uint16_t) cmd.btt(15, 0); // Byte to Transfer
     this->readLen    = (int) tempLen;
 }
 
 // Set the private data elements for a Write Command
 void DummyMemory::setWriteCmd(DmCmd cmd) {
-    this->writeAddr = cmd.saddr(15,  0); // Start address
-    this->writeId   = cmd.saddr(31, 16); // Buffer address
+    checkCmd(cmd);
+    this->writeAddr = cmd.saddr(TOE_PAGE_BITS-1, 0); // Start address
+    this->writeId   = cmd.saddr(31, TOE_PAGE_BITS); // Buffer address
+    this->nrWrBytes += cmd.btt.to_uint();
+}
+
+// Count the commands which do not fit in a single page (or session buffer),
+//  except those which run from a session buffer into its spill region
+void DummyMemory::checkCmd(DmCmd cmd) {
+    bool intoSpill = TOE_SPILL_CFG and (cmd.saddr[TOE_WINDOW_BITS] == 0);
+    if (!intoSpill and ((cmd.saddr(TOE_PAGE_BITS-1, 0) + cmd.btt) > TOE_PAGE_SIZE)) {
+        this->nrPageCrossings++;
+    }
 }
 
 // Read a data chunk from the memory
 void DummyMemory::readChunk(AxisApp &chunk) {
-    readStorageIt = storage.find(readId);
-    if (readStorageIt == storage.end()) {
-        readStorageIt = createBuffer(readId);
-        // check it?
-    }
+    readStorageIt = findBuffer(readId);
     int i = 0;
     chunk.setLE_TKeep(0);
     while (this->readLen > 0 and i < 8) {
@@ -83,6 +91,11 @@ void DummyMemory::readChunk(AxisApp &chunk) {
         readLen--;
         readAddr++;
         i++;
+        if (readAddr == 0) {
+            //-- The access continues into the next buffer (e.g. a spill region)
+            readId++;
+            readStorageIt = findBuffer(readId);
+        }
     }
     if (this->readLen == 0) {
         chunk.setTLast(TLAST);
@@ -94,16 +107,17 @@ void DummyMemory::readChunk(AxisApp &chunk) {
 
 // Write a data chunk into the memory
 void DummyMemory::writeChunk(AxisApp &chunk) {
-    writeStorageIt = storage.find(writeId);
-    if (writeStorageIt == storage.end()) {
-        writeStorageIt = createBuffer(writeId);
-        // check it?
-    }
+    writeStorageIt = findBuffer(writeId);
     // shuffleWord(word.data);
     for (int i = 0; i < 8; i++) {
         if (chunk.getLE_TKeep()[i]) {
             (writeStorageIt->second)[writeAddr] = chunk.getLE_TData((i*8)+7, i*8);
             writeAddr++;
+            if (writeAddr == 0) {
+                //-- The access continues into the next buffer (e.g. a spill region)
+                writeId++;
+                writeStorageIt = findBuffer(writeId);
+            }
         }
         else {
             break;
@@ -111,11 +125,20 @@ void DummyMemory::writeChunk(AxisApp &chunk) {
     }
 }
 
+// Find a buffer (and create it upon its first access)
+std::map<DumBufId, ap_uint<8>*>::iterator DummyMemory::findBuffer(DumBufId id)
+{
+    std::map<DumBufId, ap_uint<8>*>::iterator it = storage.find(id);
+    if (it == storage.end()) {
+        it = createBuffer(id);
+    }
+    return it;
+}
 
-std::map<ap_uint<16>, ap_uint<8>*>::iterator DummyMemory::createBuffer(ap_uint<16> id)
+std::map<DumBufId, ap_uint<8>*>::iterator DummyMemory::createBuffer(DumBufId id)
 {
-    ap_uint<8>* array = new ap_uint<8>[65536]; // [255] default
-    std::pair<std::map<ap_uint<16>, ap_uint<8>*>::iterator, bool> ret;
+    ap_uint<8>* array = new ap_uint<8>[TOE_PAGE_SIZE]; // [255] default
+    std::pair<std::map<DumBufId, ap_uint<8>*>::iterator, bool> ret;
 
     ret = storage.insert(std::make_pair(id, array));
     if (ret.second) {
@@ -65,6 +65,11 @@ EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <map>
 
+//-- The buffers have the size of a TOE buffer page (.i.e 2^TOE_PAGE_BITS). This
+//--  is also the size of a session buffer when the buffer pool is not used.
+typedef ap_uint<TOE_PAGE_BITS>      DumBufAdr;  // An address within a buffer
+typedef ap_uint<32-TOE_PAGE_BITS>   DumBufId;   // The identifier of a buffer
+
 /*******************************************************************************
  *
  * ENTITY - DUMMY MEMORY
@@ -73,26 +78,41 @@ EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 class DummyMemory {
 
   private: // [FIXME - Use appropriate types]
-    ap_uint<16> readAddr;   // Read Address within a read buffer (16 LSbits -->  64k bytes)
-    ap_uint<16> readId;     // Address of the read buffer in DDR (16 MSbits -->  64k buffer).
+    DumBufAdr   readAddr;   // Read Address within a read buffer (e.g. 16 LSbits -->  64k bytes)
+    DumBufId    readId;     // Address of the read buffer in DDR (e.g. 16 MSbits -->  64k buffer).
     int         readLen;
-    ap_uint<16> writeAddr;  // Write Address within a write buffer (16 LSbits -->  64k bytes)
-    ap_uint<16> writeId;    // Address of the write buffer in DDR  (16 MSbits -->  64k buffer).
+    DumBufAdr   writeAddr;  // Write Address within a write buffer (e.g. 16 LSbits -->  64k bytes)
+    DumBufId    writeId;    // Address of the write buffer in DDR  (e.g. 16 MSbits -->  64k buffer).
+
+    std::map<DumBufId, ap_uint<8>*>           storage;
+    std::map<DumBufId, ap_uint<8>*>::iterator readStorageIt;
+    std::map<DumBufId, ap_uint<8>*>::iterator writeStorageIt;
 
-    std::map<ap_uint<16>, ap_uint<8>*>           storage;
-    std::map<ap_uint<16>, ap_uint<8>*>::iterator readStorageIt;
-    std::map<ap_uint<16>, ap_uint<8>*>::iterator writeStorageIt;
+    //-- Usage statistics
+    int         nrPageCrossings;  // Number of commands which crossed a page boundary
+    uint64_t    nrWrBytes;        // Number of bytes written into the memory
 
-    std::map<ap_uint<16>, ap_uint<8>*>::iterator createBuffer(ap_uint<16> id);
+    std::map<DumBufId, ap_uint<8>*>::iterator findBuffer  (DumBufId id);
+    std::map<DumBufId, ap_uint<8>*>::iterator createBuffer(DumBufId id);
+    void  checkCmd   (DmCmd    cmd);
     void  shuffleWord(ap_uint<64> &);
     bool *getBitMask (ap_uint< 4> keep);
 
   public:
+    DummyMemory() : nrPageCrossings(0), nrWrBytes(0) {}
     void setReadCmd (DmCmd    cmd);
     void setWriteCmd(DmCmd    cmd);
     void readChunk  (AxisApp &chunk);
     void writeChunk (AxisApp &chunk);
 
+    //-- A memory access may only span two pages when it runs into a spill region
+    int      getNrPageCrossings() { return nrPageCrossings; }
+    //-- The footprint is the number of distinct pages touched so far
+    int      getNrPages()         { return storage.size(); }
+    //-- The number of times every page of the footprint was (re)written
+    float    getReuseRatio()      { return storage.size() ?
+                                    (float)nrWrBytes / ((uint64_t)storage.size() * TOE_PAGE_SIZE) : 0; }
+
 };
 
 #endif
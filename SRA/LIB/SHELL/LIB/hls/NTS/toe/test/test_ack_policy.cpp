@@ -0,0 +1,223 @@
+/*
+ * Copyright 2016 -- 2021 IBM Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*******************************************************************************
+ * @file       : test_ack_policy.cpp
+ * @brief      : Testbench of the per-port ACK policy of the TOE.
+ *
+ * System:     : cloudFPGA
+ * Component   : Shell, Network Transport Stack (NTS)
+ * Language    : Vivado HLS
+ *
+ * @details
+ *  This testbench drives the whole TOE with a client that connects to three
+ *  listening ports, one after the other. Each port selects its own ACK policy
+ *  with the 'ackPolicy' field of its listen request:
+ *   A) TOE_ACK_QUICK    : one ACK per segment.
+ *   B) TOE_ACK_DEFAULT  : the build-time policy (TOE_ACK_POLICY_CFG).
+ *   C) TOE_ACK_COALESCE : one ACK per delay.
+ *  After the three-way handshake, the client sends a burst of segments which
+ *  is shorter than the ACK delay, and counts the pure ACKs returned by the TOE
+ *  until the delay expired twice. The last ACK must acknowledge the whole
+ *  burst. The CAM and the data mover are emulated by the harness of
+ *  'test_toe_harness.hpp'.
+ *
+ *  Usage: 'make csimAckPolicy' from the 'toe' directory.
+ *
+ * \ingroup NTS_TOE
+ * \addtogroup NTS_TOE_TEST
+ * \{
+ *******************************************************************************/
+
+#include "test_tcp_packet.hpp"
+#include "test_toe_harness.hpp"
+
+using namespace hls;
+using namespace std;
+
+#define THIS_NAME "TB"
+
+//---------------------------------------------------------
+//-- TESTBENCH GLOBAL VARIABLES
+//---------------------------------------------------------
+bool            gTraceEvent   = false;
+bool            gFatalError   = false;
+unsigned int    gSimCycCnt    = 0;
+
+//---------------------------------------------------------
+//-- TESTBENCH DEFINES
+//---------------------------------------------------------
+const int       cNrScenarios = 3;
+const int       cNrSegs      = 8;           // Segments per burst
+const int       cSegLen      = 64;          // Bytes per segment
+const int       cWait        = 2*ACKD_TIMEOUT; // Cycles to count the ACKs after the burst
+const int       cMaxCycles   = 100000;
+const Ip4Addr   cToeIpAddr   = 0x0A0CC832;  // 10.12.200.50
+const TcpPort   cLsnPort     = 0x2263;      // The port of scenario (A), then +1 and +2
+const Ip4Addr   cClientIp    = 0x0A0CC801;  // 10.12.200.1
+const TcpPort   cClientPort  = 0x9000;      // The source port of scenario (A), then +1 and +2
+const TcpSeqNum cClientIsn   = 0x10000000;
+
+const TcpAckPolicy cPolicy[cNrScenarios] = { TOE_ACK_QUICK, TOE_ACK_DEFAULT, TOE_ACK_COALESCE };
+
+const char *cScenario[cNrScenarios] = {
+    "A) TOE_ACK_QUICK   ",
+    "B) TOE_ACK_DEFAULT ",
+    "C) TOE_ACK_COALESCE" };
+
+enum CliState { CLI_IDLE=0, CLI_SYN_SENT, CLI_DATA_SENT, CLI_DONE };
+
+/*******************************************************************************
+ * @brief Main function.
+ *******************************************************************************/
+int main(int argc, char* argv[]) {
+
+    const char *myName = concat3(THIS_NAME, "/", "ACK");
+
+    //-- The TOE with its emulated CAM and data mover
+    ToeHarness  tb(cToeIpAddr);
+
+    //-- Emulated client
+    ToeSegment  seg;
+    int         nrAcks[cNrScenarios] = { 0, 0, 0 };
+    CliState    cliState   = CLI_IDLE;
+    TcpPort     cliPort    = 0;
+    TcpPort     cliDstPort = 0;
+    TcpSeqNum   cliIsn     = cClientIsn;
+    TcpAckNum   lastAck    = 0;
+    unsigned    cliCyc     = 0;     // Cycle of the last segment of the burst
+    int  nrLsnReps=0, scenario=0, nrErr=0;
+    bool lsnSent=false;
+
+    printInfo(THIS_NAME, "############################################################################\n");
+    printInfo(THIS_NAME, "## TESTBENCH 'test_ack_policy' STARTS HERE                                ##\n");
+    printInfo(THIS_NAME, "############################################################################\n");
+    printInfo(THIS_NAME, "Build-time policy=%d - ACK every N=%d - ACK delay=%d cycles - Burst=%d x %d bytes.\n",
+              TOE_ACK_POLICY_CFG, TOE_ACK_EVERY_N_CFG, ACKD_TIMEOUT.to_int(), cNrSegs, cSegLen);
+
+    for (gSimCycCnt=0; gSimCycCnt<cMaxCycles; gSimCycCnt++) {
+        //-- OPEN THE LISTENING PORTS -----------------------------------------
+        if (tb.sNTS_Ready and !lsnSent) {
+            for (int s=0; s<cNrScenarios; s++) {
+                tb.ssTAIF_LsnReq.write(TcpAppLsnReq(cLsnPort + s, 0, cPolicy[s]));
+            }
+            lsnSent = true;
+        }
+
+        //-- OPEN A NEW CONNECTION --------------------------------------------
+        if ((nrLsnReps == cNrScenarios) and (cliState == CLI_IDLE)) {
+            cliPort    = cClientPort + scenario;
+            cliDstPort = cLsnPort + scenario;
+            cliIsn    += 0x00100000;
+            tb.sendPacket(buildTcpPacket(cClientIp, cToeIpAddr, cliPort, cliDstPort,
+                                         cliIsn, 0, 0x02, 0));
+            cliState = CLI_SYN_SENT;
+        }
+
+        //-- CLOSE A SCENARIO ONCE THE DELAY EXPIRED TWICE --------------------
+        if ((cliState == CLI_DATA_SENT) and tb.ipRxIdle() and (gSimCycCnt - cliCyc > cWait)) {
+            if (lastAck != cliIsn + 1 + cNrSegs*cSegLen) {
+                printError(myName, "Scenario %c: the last ACK is 0x%8.8X instead of 0x%8.8X.\n",
+                           'A'+scenario, lastAck.to_uint(), (cliIsn + 1 + cNrSegs*cSegLen).to_uint());
+                nrErr++;
+            }
+            cliState = (++scenario == cNrScenarios) ? CLI_DONE : CLI_IDLE;
+            if (cliState == CLI_DONE) {
+                break;
+            }
+        }
+
+        //-- FEED THE PACKETS OF THE CLIENT -----------------------------------
+        if (tb.feedIpRx()) {
+            cliCyc = gSimCycCnt;
+        }
+
+        //-- RUN THE TOE ------------------------------------------------------
+        tb.run();
+
+        //-- EMULATE THE CLIENT -----------------------------------------------
+        if (tb.recvSegment(seg) and (seg.dstPort == cliPort)) {
+            if ((cliState == CLI_SYN_SENT) and ((seg.flags & 0x12) == 0x12)) {
+                //-- Complete the handshake and send the burst right after
+                tb.sendPacket(buildTcpPacket(cClientIp, cToeIpAddr, cliPort, cliDstPort,
+                                             cliIsn+1, seg.seqNum+1, 0x10, 0));
+                for (int i=0; i<cNrSegs; i++) {
+                    tb.sendPacket(buildTcpPacket(cClientIp, cToeIpAddr, cliPort, cliDstPort,
+                                                 cliIsn+1+i*cSegLen, seg.seqNum+1, 0x18,
+                                                 cSegLen, i*cSegLen));
+                }
+                lastAck  = cliIsn + 1;
+                cliState = CLI_DATA_SENT;
+            }
+            else if ((cliState == CLI_DATA_SENT) and (seg.flags == 0x10) and (seg.ackNum != lastAck)) {
+                nrAcks[scenario]++;
+                lastAck = seg.ackNum;
+            }
+        }
+
+        //-- EMULATE THE APPLICATION ------------------------------------------
+        if (!tb.ssTAIF_LsnRep.empty()) {
+            if (!tb.ssTAIF_LsnRep.read()) {
+                printError(myName, "Listen request #%d was refused.\n", nrLsnReps);
+                nrErr++;
+                break;
+            }
+            nrLsnReps++;
+        }
+        if (!tb.ssTAIF_Notif.empty())       { tb.ssTAIF_Notif.read();       }
+    }
+
+    for (int s=0; s<cNrScenarios; s++) {
+        printInfo(myName, "%s: %2d ACKs for %d segments.\n", cScenario[s], nrAcks[s], cNrSegs);
+    }
+
+    if (scenario != cNrScenarios) {
+        printError(myName, "The test did not complete within %d cycles.\n", cMaxCycles);
+        nrErr++;
+    }
+    else {
+        //-- Every port must apply its own policy
+        if (nrAcks[0] != cNrSegs) {
+            printError(myName, "Scenario A returned %d ACKs instead of %d.\n", nrAcks[0], cNrSegs);
+            nrErr++;
+        }
+        if (nrAcks[2] != 1) {
+            printError(myName, "Scenario C returned %d ACKs instead of 1.\n", nrAcks[2]);
+            nrErr++;
+        }
+        int nrDflt = (TOE_ACK_POLICY_CFG == TOE_ACK_QUICK)    ? cNrSegs :
+                     (TOE_ACK_POLICY_CFG == TOE_ACK_COALESCE) ? 1 : cNrSegs/TOE_ACK_EVERY_N_CFG;
+        if (nrAcks[1] != nrDflt) {
+            printError(myName, "Scenario B returned %d ACKs instead of %d.\n", nrAcks[1], nrDflt);
+            nrErr++;
+        }
+    }
+
+    if (nrErr) {
+        printError(THIS_NAME, "###########################################################\n");
+        printError(THIS_NAME, "#### TEST BENCH FAILED : TOTAL NUMBER OF ERROR(S) = %2d ####\n", nrErr);
+        printError(THIS_NAME, "###########################################################\n");
+    }
+    else {
+        printInfo(THIS_NAME, "#############################################################\n");
+        printInfo(THIS_NAME, "####               SUCCESSFUL END OF TEST                ####\n");
+        printInfo(THIS_NAME, "#############################################################\n");
+    }
+
+    return nrErr;
+}
+
+/*! \} */
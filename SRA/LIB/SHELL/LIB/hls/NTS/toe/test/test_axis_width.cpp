@@ -0,0 +1,244 @@
+/*
+ * Copyright 2016 -- 2021 IBM Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*******************************************************************************
+ * @file       : test_axis_width.cpp
+ * @brief      : Throughput benchmark of the width-generic AxisRaw datapath.
+ *
+ * System:     : cloudFPGA
+ * Component   : Shell, Network Transport Stack (NTS)
+ * Language    : Vivado HLS
+ *
+ * @details
+ *  This testbench instantiates the byte-lane alignment logic of the TOE (i.e.
+ *  the stripping of an IPv4 header performed by [RXe/Tle]) for the datapath
+ *  widths of 10GE (64-bit), 25GE (128-bit), 40GE (256-bit) and 100GE (512-bit).
+ *  It streams a set of packets through each instance, checks the realigned
+ *  payloads and reports the number of payload bytes forwarded per cycle.
+ *  The width-generic checksum helpers of 'nts_utils' (@see csumChunk()) are
+ *  also checked against a byte-wise computation of the packet checksums.
+ *
+ *  Usage: 'make csimWidth' from the 'toe' directory.
+ *
+ * \ingroup NTS_TOE
+ * \addtogroup NTS_TOE_TEST
+ * \{
+ *******************************************************************************/
+
+#include <cstdlib>
+#include <vector>
+
+#include "../../AxisRaw.hpp"
+#include "../../nts_utils.hpp"
+
+using namespace hls;
+using namespace std;
+
+#define THIS_NAME "TB"
+
+//---------------------------------------------------------
+//-- TESTBENCH GLOBAL VARIABLES
+//---------------------------------------------------------
+bool            gTraceEvent   = false;
+bool            gFatalError   = false;
+unsigned int    gSimCycCnt    = 0;
+
+//---------------------------------------------------------
+//-- TESTBENCH DEFINES
+//---------------------------------------------------------
+const int cIp4HdrLen  = 20;  // The header which is stripped by the DUT
+const int cNrPackets  = 64;  // The number of packets per run
+
+/*******************************************************************************
+ * @brief Header Stripper (Hds) - Strips the first 'HDR' bytes of every packet
+ *  and realigns the remaining bytes onto a 'W'-bit datapath.
+ *
+ * @param[in]  siData  The incoming packets.
+ * @param[out] soData  The realigned payloads.
+ *
+ * @details
+ *  This is the width-generic form of the realignment performed by [RXe/Tle].
+ *******************************************************************************/
+template<int W, int HDR>
+void pHeaderStripper(
+        stream<AxisRawT<W> > &siData,
+        stream<AxisRawT<W> > &soData)
+{
+    //-- DIRECTIVES FOR THIS PROCESS -------------------------------------------
+    #pragma HLS PIPELINE II=1 enable_flush
+    #pragma HLS INLINE off
+
+    const int cSkip = HDR / (W/8);  // Number of chunks made of header only
+    const int cOff  = HDR % (W/8);  // Header bytes left in the next chunk
+
+    //-- STATIC CONTROL VARIABLES (with RESET) ---------------------------------
+    static ap_uint<8>   hds_chunkCount=0;
+    #pragma HLS RESET   variable=hds_chunkCount
+    static bool         hds_residue=false;
+    #pragma HLS RESET   variable=hds_residue
+
+    //-- STATIC DATAFLOW VARIABLES ---------------------------------------------
+    static AxisRawT<W>  hds_prevChunk;
+
+    if (hds_residue) {
+        soData.write(axisRawTail<cOff>(hds_prevChunk));
+        hds_residue = false;
+    }
+    else if (!siData.empty() and !soData.full()) {
+        AxisRawT<W> currChunk = siData.read();
+        if (hds_chunkCount < cSkip) {
+            hds_chunkCount++;
+        }
+        else if (hds_chunkCount == cSkip) {
+            hds_chunkCount++;
+            if (currChunk.getTLast()) {
+                if (currChunk.getLE_TKeep()[cOff] == 1) {
+                    soData.write(axisRawTail<cOff>(currChunk));
+                }
+                hds_chunkCount = 0;
+            }
+        }
+        else {
+            soData.write(axisRawJoin<cOff>(hds_prevChunk, currChunk));
+            if (currChunk.getTLast()) {
+                hds_chunkCount = 0;
+                hds_residue = (currChunk.getLE_TKeep()[cOff] == 1);
+            }
+        }
+        hds_prevChunk = currChunk;
+    }
+}
+
+/*******************************************************************************
+ * @brief Run the benchmark for a given datapath width and packet length.
+ *
+ * @param[in]  pktLen  The length of the packets (in bytes, including header).
+ *
+ * @return the number of errors.
+ *******************************************************************************/
+template<int W>
+int runBenchmark(int pktLen)
+{
+    const char *myName = concat3(THIS_NAME, "/", "Bench");
+
+    stream<AxisRawT<W> >  ssData("ssData");
+    stream<AxisRawT<W> >  ssPayload("ssPayload");
+    vector<ap_uint<8> >   expected;
+    int                   nrErr = 0;
+
+    //-- Generate the packets (and check their checksum)
+    for (int pkt=0; pkt<cNrPackets; pkt++) {
+        AxisRawT<W> chunk(0, 0, 0);
+        CsumAcc     csumAcc = 0;
+        uint32_t    refSum  = 0;
+        for (int i=0; i<pktLen; i++) {
+            ap_uint<8> byte = rand() & 0xFF;
+            int lane = i % (W/8);
+            chunk.setLE_TData(byte, 8*lane+7, 8*lane);
+            chunk.setLE_TKeep(1, lane, lane);
+            refSum += (i % 2) ? byte.to_uint() : (byte.to_uint() << 8);
+            if (i >= cIp4HdrLen) {
+                expected.push_back(byte);
+            }
+            if (i == pktLen-1) {
+                chunk.setLE_TLast(TLAST);
+            }
+            if ((lane == W/8-1) or (i == pktLen-1)) {
+                csumAcc += csumChunk(chunk);
+                ssData.write(chunk);
+                chunk = AxisRawT<W>(0, 0, 0);
+            }
+        }
+        while (refSum >> 16) {
+            refSum = (refSum & 0xFFFF) + (refSum >> 16);
+        }
+        if (csumFold(csumAcc) != refSum) {
+            printError(myName, "W=%3d - Wrong checksum 0x%4.4X instead of 0x%4.4X.\n",
+                       W, csumFold(csumAcc).to_uint(), refSum);
+            nrErr++;
+        }
+    }
+
+    //-- Run the DUT and count the cycles up to the last outgoing chunk
+    unsigned int cycle=0, lastCycle=0, idle=0;
+    size_t       byteCnt=0;
+    while (idle < 8) {
+        pHeaderStripper<W, cIp4HdrLen>(ssData, ssPayload);
+        cycle++;
+        if (ssPayload.empty()) {
+            idle++;
+            continue;
+        }
+        idle = 0;
+        lastCycle = cycle;
+        AxisRawT<W> chunk = ssPayload.read();
+        for (int lane=0; lane<W/8; lane++) {
+            if (chunk.getLE_TKeep()[lane]) {
+                ap_uint<8> byte = chunk.getLE_TData(8*lane+7, 8*lane);
+                if ((byteCnt >= expected.size()) or (byte != expected[byteCnt])) {
+                    nrErr++;
+                }
+                byteCnt++;
+            }
+        }
+    }
+    if (byteCnt != expected.size()) {
+        printError(myName, "W=%3d - Received %zu payload bytes instead of %zu.\n",
+                   W, byteCnt, expected.size());
+        nrErr++;
+    }
+
+    double bytesPerCycle = (double)byteCnt / lastCycle;
+    printInfo(myName, "W=%3d - PktLen=%4d - %6zu bytes in %5d cycles = %6.2f bytes/cycle (%5.1f%% of %d) - %d error(s).\n",
+              W, pktLen, byteCnt, lastCycle, bytesPerCycle, 100.0*bytesPerCycle/(W/8), W/8, nrErr);
+    return nrErr;
+}
+
+/*******************************************************************************
+ * @brief Main function.
+ *******************************************************************************/
+int main(int argc, char* argv[]) {
+
+    const int cPktLen[] = { 64, 256, 576, 1500 };
+    int nrErr = 0;
+
+    printInfo(THIS_NAME, "############################################################################\n");
+    printInfo(THIS_NAME, "## TESTBENCH 'test_axis_width' STARTS HERE                                ##\n");
+    printInfo(THIS_NAME, "############################################################################\n");
+
+    srand(0xCF);
+    for (int i=0; i<4; i++) {
+        nrErr += runBenchmark<AXIS_RAW_WIDTH_AT_10GE> (cPktLen[i]);
+        nrErr += runBenchmark<AXIS_RAW_WIDTH_AT_25GE> (cPktLen[i]);
+        nrErr += runBenchmark<AXIS_RAW_WIDTH_AT_40GE> (cPktLen[i]);
+        nrErr += runBenchmark<AXIS_RAW_WIDTH_AT_100GE>(cPktLen[i]);
+    }
+
+    if (nrErr) {
+        printError(THIS_NAME, "###########################################################\n");
+        printError(THIS_NAME, "#### TEST BENCH FAILED : TOTAL NUMBER OF ERROR(S) = %2d ####\n", nrErr);
+        printError(THIS_NAME, "###########################################################\n");
+    }
+    else {
+        printInfo(THIS_NAME, "#############################################################\n");
+        printInfo(THIS_NAME, "####               SUCCESSFUL END OF TEST                ####\n");
+        printInfo(THIS_NAME, "#############################################################\n");
+    }
+
+    return nrErr;
+}
+
+/*! \} */
@@ -0,0 +1,579 @@
+/*
+ * Copyright 2016 -- 2021 IBM Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*******************************************************************************
+ * @file       : test_buffer_pool.cpp
+ * @brief      : Memory footprint benchmark of the Rx/Tx buffer pool.
+ *
+ * System:     : cloudFPGA
+ * Component   : Shell, Network Transport Stack (NTS)
+ * Language    : Vivado HLS
+ *
+ * @details
+ *  This testbench instantiates the Buffer Pool (BPl) of the TOE and emulates
+ *  the engines which use the Rx and Tx session buffers, as well as the DRAM
+ *  with two 'DummyMemory' models. A few bulk sessions stream several laps of
+ *  their (virtual) buffers in both directions while the other sessions only
+ *  exchange a few short messages. The bulk consumers stall from time to time
+ *  such that the bulk windows grow and compete for the pages of the pool.
+ *  The emulated engines follow the rules of the TOE: an access never spans two
+ *  pages, the producer never writes into the page which holds the consumer
+ *  pointer, a Tx page is released once it is acknowledged and an Rx page once
+ *  it is read.
+ *  The testbench checks that:
+ *   - no physical page is ever mapped by two virtual pages,
+ *   - the data read back are the data written (incl. retransmissions),
+ *   - no memory access spans two pages (i.e. no fragmentation),
+ *   - the pages are reused (more allocations than pages in the pool),
+ *   - every page returns to the pool once the sessions are flushed, and an
+ *     unmapped page reads from the null page.
+ *  It reports the peak number of pages in use versus the static carve-out of
+ *  the same buffers.
+ *
+ *  Usage: 'make csimBufPool' from the 'toe' directory.
+ *
+ * \ingroup NTS_TOE
+ * \addtogroup NTS_TOE_TEST
+ * \{
+ *******************************************************************************/
+
+#include <cstdlib>
+#include <deque>
+#include <map>
+
+#include "../src/buffer_pool/buffer_pool.hpp"
+#include "dummy_memory/dummy_memory.hpp"
+
+#if !TOE_BUF_POOL_CFG
+  #error "This benchmark requires the buffer pool. Run it with 'make csimBufPool'."
+#endif
+
+using namespace hls;
+using namespace std;
+
+#define THIS_NAME "TB"
+
+//---------------------------------------------------------
+//-- TESTBENCH GLOBAL VARIABLES
+//---------------------------------------------------------
+bool            gTraceEvent   = false;
+bool            gFatalError   = false;
+unsigned int    gSimCycCnt    = 0;
+
+//---------------------------------------------------------
+//-- TESTBENCH DEFINES
+//---------------------------------------------------------
+const int          cNrSessions  = TOE_MAX_SESSIONS;
+const int          cNrBulk      = 2;                      // Sessions #0 and #1
+const unsigned int cBulkPayload = 3 << TOE_WINDOW_BITS;   // Three laps of a buffer
+const unsigned int cMsgLen      = 300;                    // Bytes per message of a quiet session
+const int          cNrMsgs      = 40;                     // Messages per quiet session
+const int          cMsgPeriod   = 997;                    // Cycles between two messages
+const unsigned int cSegLen      = 1460;                   // Bytes per write and per transmission
+const unsigned int cRdLen       = 8192;                   // Max bytes per read of the Rx consumer
+const int          cStallPeriod = 20000;                  // The bulk consumers stall ...
+const int          cStallLen    = 12000;                  //  ... for that many cycles per period
+const int          cAckDelay    = 300;                    // Cycles between a transmission and its ACK
+const int          cRetxEvery   = 37;                     // One ACK out of 'cRetxEvery' is preceded by a retransmission
+const int          cMaxOutCmds  = 4;                      // Max commands outstanding in the pool
+const int          cMaxCycles   = 4000000;
+const unsigned int cNrBufPages  = (1 << (TOE_WINDOW_BITS - TOE_PAGE_BITS));
+
+/*******************************************************************************
+ * @brief A session flow of one direction (i.e. the bytes of one buffer).
+ *******************************************************************************/
+struct Flow {
+    unsigned int wrIss;   // Next byte to write (issued)
+    unsigned int wrDone;  // Bytes written into memory
+    unsigned int rdIss;   // Next byte to read (Rx) or to transmit (Tx)
+    unsigned int cons;    // Consumer pointer: 'appd' (Rx) or 'ackd' (Tx)
+    unsigned int total;   // Bytes to transfer
+    int          nrAcks;  // Number of ACKs received (Tx)
+    deque<pair<int, unsigned int> > acks;  // Pending ACKs (due cycle, ACK number)
+};
+
+/*******************************************************************************
+ * @brief A memory command issued to the pool and not yet translated.
+ *******************************************************************************/
+struct OutCmd {
+    int          sessId;
+    unsigned int seq;
+    unsigned int len;
+    uint64_t     vaddr;
+};
+
+/*******************************************************************************
+ * @brief One direction of the pool with the emulated engines and DRAM.
+ *******************************************************************************/
+struct Direction {
+    const char   *name;
+    bool          isRx;
+    uint64_t      memBase;
+    Flow          flow[TOE_MAX_SESSIONS];
+    DummyMemory   dram;
+    map<unsigned int, unsigned int> vpnToPpn;
+    map<unsigned int, unsigned int> ppnToVpn;
+    deque<OutCmd> wrCmds;
+    deque<OutCmd> rdCmds;
+    deque<BufPageRel> pageRels;
+    unsigned int  nrAllocs;
+    unsigned int  peakPages;
+    unsigned int  maxWindow;  // Largest number of bytes held by a bulk session
+    //-- Streams of the DUT
+    stream<DmCmd>       ssWrCmd;
+    stream<DmCmd>       ssMemWrCmd;
+    stream<DmCmd>       ssRdCmd;
+    stream<DmCmd>       ssMemRdCmd;
+    stream<BufPageRel>  ssPageRel;
+};
+
+/*******************************************************************************
+ * @brief The payload byte with sequence number 'seq' of a session buffer.
+ *******************************************************************************/
+ap_uint<8> payloadByte(bool isRx, int sessId, unsigned int seq)
+{
+    return (sessId*31 + seq*7 + (seq >> 11) + (isRx ? 0 : 101)) & 0xFF;
+}
+
+/*******************************************************************************
+ * @brief The virtual address of the byte 'seq' in the buffer of 'sessId'.
+ *******************************************************************************/
+uint64_t virtAddr(Direction &dir, int sessId, unsigned int seq)
+{
+    return dir.memBase + ((uint64_t)sessId << TOE_WINDOW_BITS) + (seq & (TOE_BUFFER_SIZE-1));
+}
+
+/*******************************************************************************
+ * @brief The number of bytes that fit in the page of the byte 'seq'.
+ *******************************************************************************/
+unsigned int pageRoom(unsigned int seq)
+{
+    return TOE_PAGE_SIZE - (seq & (TOE_PAGE_SIZE-1));
+}
+
+/*******************************************************************************
+ * @brief Writes 'len' payload bytes at a physical address of the DRAM model.
+ *******************************************************************************/
+void dramWrite(Direction &dir, DmCmd cmd, int sessId, unsigned int seq)
+{
+    dir.dram.setWriteCmd(cmd);
+    for (unsigned int i=0; i<cmd.btt; i+=8) {
+        AxisApp chunk(0, 0, 0);
+        for (unsigned int b=0; (b<8) and (i+b<cmd.btt); b++) {
+            chunk.setLE_TData(payloadByte(dir.isRx, sessId, seq+i+b), b*8+7, b*8);
+            chunk.setLE_TKeep(chunk.getLE_TKeep() | (1 << b));
+        }
+        dir.dram.writeChunk(chunk);
+    }
+}
+
+/*******************************************************************************
+ * @brief Reads 'len' bytes at a physical address and checks them.
+ *
+ * @return the number of errors.
+ *******************************************************************************/
+int dramCheck(Direction &dir, DmCmd cmd, int sessId, unsigned int seq)
+{
+    const char *myName = dir.isRx ? "TB/Rx" : "TB/Tx";
+    dir.dram.setReadCmd(cmd);
+    for (unsigned int i=0; i<cmd.btt; i+=8) {
+        AxisApp chunk;
+        dir.dram.readChunk(chunk);
+        for (unsigned int b=0; (b<8) and (i+b<cmd.btt); b++) {
+            if (chunk.getLE_TData(b*8+7, b*8) != payloadByte(dir.isRx, sessId, seq+i+b)) {
+                printError(myName, "S%d - Byte #%d read at 0x%9.9lx is corrupted.\n",
+                           sessId, seq+i+b, cmd.saddr.to_ulong() + i + b);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+/*******************************************************************************
+ * @brief Checks the translation of a command and updates the mapping model.
+ *
+ * @return the number of errors.
+ *******************************************************************************/
+int checkMapping(Direction &dir, OutCmd &out, DmCmd cmd, bool isWrite)
+{
+    const char *myName = dir.isRx ? "TB/Rx" : "TB/Tx";
+    unsigned int vpn = (out.vaddr - dir.memBase) >> TOE_PAGE_BITS;
+    unsigned int ppn = (cmd.saddr.to_uint64() - dir.memBase) >> TOE_PAGE_BITS;
+    if (((cmd.saddr.to_uint64() ^ out.vaddr) & (TOE_PAGE_SIZE-1)) or (cmd.btt != out.len)) {
+        printError(myName, "VPN=0x%x - The offset or the length of a command was altered.\n", vpn);
+        return 1;
+    }
+    if (ppn >= TOE_BUF_POOL_PAGES) {
+        printError(myName, "VPN=0x%x - PPN=0x%x is out of the pool.\n", vpn, ppn);
+        return 1;
+    }
+    map<unsigned int, unsigned int>::iterator it = dir.vpnToPpn.find(vpn);
+    if (it != dir.vpnToPpn.end()) {
+        if (it->second != ppn) {
+            printError(myName, "VPN=0x%x - Moved from PPN=0x%x to PPN=0x%x while mapped.\n", vpn, it->second, ppn);
+            return 1;
+        }
+        return 0;
+    }
+    if (not isWrite) {
+        printError(myName, "VPN=0x%x - Read from an unmapped page.\n", vpn);
+        return 1;
+    }
+    if (dir.ppnToVpn.count(ppn)) {
+        printError(myName, "PPN=0x%x - Mapped by VPN=0x%x and VPN=0x%x.\n", ppn, dir.ppnToVpn[ppn], vpn);
+        return 1;
+    }
+    dir.vpnToPpn[vpn] = ppn;
+    dir.ppnToVpn[ppn] = vpn;
+    dir.nrAllocs++;
+    if (dir.ppnToVpn.size() > dir.peakPages) {
+        dir.peakPages = dir.ppnToVpn.size();
+    }
+    return 0;
+}
+
+/*******************************************************************************
+ * @brief Removes a range of virtual pages from the mapping model.
+ *******************************************************************************/
+void unmapPages(Direction &dir, BufPageRel pageRel)
+{
+    BufPageNum vpn = pageRel.vpn;
+    for (unsigned int i=0; i<pageRel.cnt; i++) {
+        map<unsigned int, unsigned int>::iterator it = dir.vpnToPpn.find(vpn.to_uint());
+        if (it != dir.vpnToPpn.end()) {
+            dir.ppnToVpn.erase(it->second);
+            dir.vpnToPpn.erase(it);
+        }
+        vpn(TOE_WINDOW_BITS-TOE_PAGE_BITS-1, 0) = vpn(TOE_WINDOW_BITS-TOE_PAGE_BITS-1, 0) + 1;
+    }
+}
+
+/*******************************************************************************
+ * @brief Runs the Buffer Pool (BPl) for one clock cycle.
+ *******************************************************************************/
+void stepPool(Direction &rx, Direction &tx)
+{
+    static stream<TcpAppRdDsc>  ssRdDscIn("ssRdDscIn");
+    static stream<TcpAppRdDsc>  ssRdDscOut("ssRdDscOut");
+    buffer_pool(
+        rx.ssWrCmd, rx.ssMemWrCmd, rx.ssRdCmd, rx.ssMemRdCmd,
+        ssRdDscIn, ssRdDscOut, rx.ssPageRel,
+        tx.ssWrCmd, tx.ssMemWrCmd, tx.ssRdCmd, tx.ssMemRdCmd,
+        tx.ssPageRel);
+    gSimCycCnt++;
+}
+
+/*******************************************************************************
+ * @brief Drains the translated commands of one direction.
+ *
+ * @return the number of errors.
+ *******************************************************************************/
+int drainOutputs(Direction &dir)
+{
+    int nrErr = 0;
+    while (!dir.ssMemWrCmd.empty()) {
+        DmCmd  cmd = dir.ssMemWrCmd.read();
+        OutCmd out = dir.wrCmds.front();
+        dir.wrCmds.pop_front();
+        nrErr += checkMapping(dir, out, cmd, true);
+        dramWrite(dir, cmd, out.sessId, out.seq);
+        dir.flow[out.sessId].wrDone = out.seq + out.len;
+    }
+    while (!dir.ssMemRdCmd.empty()) {
+        DmCmd  cmd = dir.ssMemRdCmd.read();
+        OutCmd out = dir.rdCmds.front();
+        dir.rdCmds.pop_front();
+        nrErr += checkMapping(dir, out, cmd, false);
+        nrErr += dramCheck(dir, cmd, out.sessId, out.seq);
+        if (dir.isRx and (((out.seq + out.len) & (TOE_PAGE_SIZE-1)) == 0)) {
+            //-- The pool released the page that was read to its end
+            unsigned int vpn = (out.vaddr - dir.memBase) >> TOE_PAGE_BITS;
+            dir.ppnToVpn.erase(dir.vpnToPpn[vpn]);
+            dir.vpnToPpn.erase(vpn);
+        }
+    }
+    return nrErr;
+}
+
+/*******************************************************************************
+ * @brief Emulates the engines of one direction for one clock cycle.
+ *******************************************************************************/
+void stepEngines(Direction &dir, int cyc)
+{
+    static int wrRr[2] = {0, 0};
+    int &rr = wrRr[dir.isRx ? 0 : 1];
+    bool stalled = (cyc % cStallPeriod) < cStallLen;
+
+    //-- Producer ([RXe] or [TAi]): one write per cycle, in round-robin
+    for (int i=0; i<cNrSessions and (int)dir.wrCmds.size() < cMaxOutCmds; i++) {
+        int   s = (rr + i) % cNrSessions;
+        Flow &f = dir.flow[s];
+        unsigned int avail = f.total - f.wrIss;
+        if (s >= cNrBulk) {
+            //-- A quiet session produces a message every 'cMsgPeriod' cycles
+            unsigned int due = min((cyc / cMsgPeriod + 1) * cMsgLen, cNrMsgs * cMsgLen);
+            avail = (f.total - cNrMsgs * cMsgLen + due) - f.wrIss;
+        }
+        // The window ends at the beginning of the page of the consumer pointer
+        unsigned int room = ((f.cons & ~(TOE_PAGE_SIZE-1)) + TOE_BUFFER_SIZE - 1) - f.wrIss;
+        unsigned int len  = min(min(avail, room), min(cSegLen, pageRoom(f.wrIss)));
+        if (len != 0) {
+            OutCmd out = { s, f.wrIss, len, virtAddr(dir, s, f.wrIss) };
+            dir.ssWrCmd.write(DmCmd(out.vaddr, len));
+            dir.wrCmds.push_back(out);
+            f.wrIss += len;
+            rr = s + 1;
+            break;
+        }
+    }
+
+    //-- Consumer ([RAi] or [TXe]): one read per cycle, in round-robin
+    for (int s=0; s<cNrSessions and (int)dir.rdCmds.size() < cMaxOutCmds; s++) {
+        Flow &f = dir.flow[(cyc + s) % cNrSessions];
+        int   sessId = (cyc + s) % cNrSessions;
+        if ((sessId < cNrBulk) and stalled) {
+            continue;
+        }
+        unsigned int len = min(f.wrDone - f.rdIss, min(dir.isRx ? cRdLen : cSegLen, pageRoom(f.rdIss)));
+        if (len != 0) {
+            OutCmd out = { sessId, f.rdIss, len, virtAddr(dir, sessId, f.rdIss) };
+            dir.ssRdCmd.write(DmCmd(out.vaddr, len));
+            dir.rdCmds.push_back(out);
+            f.rdIss += len;
+            if (dir.isRx) {
+                f.cons = f.rdIss;
+            }
+            else {
+                f.acks.push_back(make_pair(cyc + cAckDelay, f.rdIss));
+            }
+            break;
+        }
+    }
+
+    //-- Peer of the Tx direction: acknowledge and release the pages ([TSt])
+    for (int s=0; s<cNrSessions and !dir.isRx; s++) {
+        Flow &f = dir.flow[s];
+        if (f.acks.empty() or (f.acks.front().first > cyc) or ((s < cNrBulk) and stalled)) {
+            continue;
+        }
+        unsigned int ackd = f.acks.front().second;
+        unsigned int len  = min(f.rdIss - ackd, min(cSegLen, pageRoom(ackd)));
+        if (((f.nrAcks + 1) % cRetxEvery == 0) and (len != 0) and ((int)dir.rdCmds.size() < cMaxOutCmds)) {
+            //-- Retransmit the oldest bytes which remain unacknowledged
+            OutCmd out = { s, ackd, len, virtAddr(dir, s, ackd) };
+            dir.ssRdCmd.write(DmCmd(out.vaddr, len));
+            dir.rdCmds.push_back(out);
+        }
+        unsigned int nrPages = (ackd >> TOE_PAGE_BITS) - (f.cons >> TOE_PAGE_BITS);
+        if (nrPages != 0) {
+            BufPageRel pageRel(toBufPageNum(s, f.cons & (TOE_BUFFER_SIZE-1)), nrPages);
+            dir.pageRels.push_back(pageRel);
+            unmapPages(dir, pageRel);
+        }
+        f.cons = ackd;
+        f.nrAcks++;
+        f.acks.pop_front();
+    }
+
+    if (!dir.pageRels.empty() and !dir.ssPageRel.full()) {
+        dir.ssPageRel.write(dir.pageRels.front());
+        dir.pageRels.pop_front();
+    }
+
+    //-- Keep track of the largest window used by a bulk session
+    for (int s=0; s<cNrBulk; s++) {
+        unsigned int held = dir.flow[s].wrDone - dir.flow[s].cons;
+        if (held > dir.maxWindow) {
+            dir.maxWindow = held;
+        }
+    }
+}
+
+/*******************************************************************************
+ * @brief Returns true when all the bytes of a direction were consumed.
+ *******************************************************************************/
+bool isDone(Direction &dir)
+{
+    for (int s=0; s<cNrSessions; s++) {
+        if (dir.flow[s].cons != dir.flow[s].total) {
+            return false;
+        }
+    }
+    return dir.wrCmds.empty() and dir.rdCmds.empty() and dir.pageRels.empty();
+}
+
+/*******************************************************************************
+ * @brief Flushes all the sessions and checks that every page returned to the
+ *  pool of one direction.
+ *
+ * @return the number of errors.
+ *******************************************************************************/
+int checkFlush(Direction &dir, Direction &rx, Direction &tx)
+{
+    const char *myName = dir.isRx ? "TB/Rx" : "TB/Tx";
+    int nrErr = 0;
+
+    //-- Flush the pages of all the sessions (as upon their initialization)
+    for (int s=0; s<cNrSessions; s++) {
+        BufPageRel pageRel(toBufPageNum(s, 0), cNrBufPages);
+        dir.ssPageRel.write(pageRel);
+        unmapPages(dir, pageRel);
+        for (unsigned int c=0; c<cNrBufPages+2; c++) {
+            stepPool(rx, tx);
+        }
+    }
+    if (dir.vpnToPpn.size() != 0) {
+        printError(myName, "%zu pages are still mapped after the flush.\n", dir.vpnToPpn.size());
+        nrErr++;
+    }
+
+    //-- An unmapped page reads from the null page
+    dir.ssRdCmd.write(DmCmd(virtAddr(dir, 0, 0), 64));
+    stepPool(rx, tx);
+    if (dir.ssMemRdCmd.empty() or
+       (((dir.ssMemRdCmd.read().saddr.to_uint64() - dir.memBase) >> TOE_PAGE_BITS) != TOE_BUF_POOL_PAGES)) {
+        printError(myName, "The read of an unmapped page was not redirected to the null page.\n");
+        nrErr++;
+    }
+
+    //-- All the pages of the pool can be allocated again, but not one more
+    map<unsigned int, bool> ppns;
+    unsigned int nrServed = 0;
+    for (unsigned int v=0; v<=TOE_BUF_POOL_PAGES; v++) {
+        dir.ssWrCmd.write(DmCmd(dir.memBase + ((uint64_t)v << TOE_PAGE_BITS), 64));
+        for (int c=0; c<4; c++) {
+            stepPool(rx, tx);
+        }
+        while (!dir.ssMemWrCmd.empty()) {
+            ppns[(dir.ssMemWrCmd.read().saddr.to_uint64() - dir.memBase) >> TOE_PAGE_BITS] = true;
+            nrServed++;
+        }
+    }
+    for (int c=0; c<1000; c++) {
+        stepPool(rx, tx);
+    }
+    nrServed += dir.ssMemWrCmd.size();
+    if ((nrServed != TOE_BUF_POOL_PAGES) or (ppns.size() != TOE_BUF_POOL_PAGES)) {
+        printError(myName, "Allocated %d pages (%zu distinct) after the flush instead of %d.\n",
+                   nrServed, ppns.size(), TOE_BUF_POOL_PAGES);
+        nrErr++;
+    }
+
+    //-- Release the pages of that last test (the write still pending gets served)
+    for (unsigned int v=0; v<=TOE_BUF_POOL_PAGES; v+=cNrBufPages) {
+        dir.ssPageRel.write(BufPageRel(v, cNrBufPages));
+    }
+    for (unsigned int c=0; c<4*TOE_BUF_POOL_PAGES; c++) {
+        stepPool(rx, tx);
+    }
+    while (!dir.ssMemWrCmd.empty()) {
+        dir.ssMemWrCmd.read();
+        nrServed++;
+    }
+    if (nrServed != TOE_BUF_POOL_PAGES+1) {
+        printError(myName, "The write waiting for a free page was not served.\n");
+        nrErr++;
+    }
+    return nrErr;
+}
+
+/*******************************************************************************
+ * @brief Main function.
+ *******************************************************************************/
+int main(int argc, char* argv[]) {
+
+    static Direction rx, tx;
+    int nrErr = 0;
+
+    printInfo(THIS_NAME, "############################################################################\n");
+    printInfo(THIS_NAME, "## TESTBENCH 'test_buffer_pool' STARTS HERE                               ##\n");
+    printInfo(THIS_NAME, "############################################################################\n");
+
+    rx.name = "Rx"; rx.isRx = true;  rx.memBase = TOE_RX_MEMORY_BASE;
+    tx.name = "Tx"; tx.isRx = false; tx.memBase = TOE_TX_MEMORY_BASE;
+    Direction *dirs[2] = { &rx, &tx };
+    for (int d=0; d<2; d++) {
+        Direction &dir = *dirs[d];
+        dir.nrAllocs = dir.peakPages = dir.maxWindow = 0;
+        for (int s=0; s<cNrSessions; s++) {
+            //-- Start every session at a different offset of its buffer
+            unsigned int iss = s * 40009 + d * 777;
+            Flow &f = dir.flow[s];
+            f.wrIss = f.wrDone = f.rdIss = f.cons = iss;
+            f.total  = iss + ((s < cNrBulk) ? cBulkPayload : cNrMsgs * cMsgLen);
+            f.nrAcks = 0;
+        }
+    }
+
+    //-- Run the traffic
+    int cyc = 0;
+    while (not (isDone(rx) and isDone(tx)) and (cyc < cMaxCycles) and (nrErr < 10)) {
+        stepPool(rx, tx);
+        nrErr += drainOutputs(rx);
+        nrErr += drainOutputs(tx);
+        stepEngines(rx, cyc);
+        stepEngines(tx, cyc);
+        cyc++;
+    }
+    if (cyc >= cMaxCycles) {
+        printError(THIS_NAME, "The traffic did not complete within %d cycles.\n", cMaxCycles);
+        nrErr++;
+    }
+
+    //-- Report
+    unsigned int staticPages = TOE_MAX_SESSIONS * cNrBufPages;
+    for (int d=0; d<2; d++) {
+        Direction &dir = *dirs[d];
+        printInfo(THIS_NAME, "%s - Pool=%4d pages | Peak=%4d pages | Static carve-out=%4d pages | Allocations=%5d | Reuse=%5.2f | Max bulk window=%7d bytes\n",
+                  dir.name, TOE_BUF_POOL_PAGES, dir.peakPages, staticPages, dir.nrAllocs,
+                  dir.dram.getReuseRatio(), dir.maxWindow);
+        if (dir.dram.getNrPageCrossings()) {
+            printError(THIS_NAME, "%s - %d memory accesses span two pages.\n", dir.name, dir.dram.getNrPageCrossings());
+            nrErr++;
+        }
+        if (dir.nrAllocs <= TOE_BUF_POOL_PAGES) {
+            printError(THIS_NAME, "%s - The pages were not reused (%d allocations).\n", dir.name, dir.nrAllocs);
+            nrErr++;
+        }
+        if (dir.maxWindow <= TOE_PAGE_SIZE) {
+            printError(THIS_NAME, "%s - The window of the bulk sessions did not grow beyond one page.\n", dir.name);
+            nrErr++;
+        }
+    }
+    printInfo(THIS_NAME, "Completed in %d cycles.\n", cyc);
+
+    //-- Flush the sessions and check that all the pages returned to the pools
+    if (nrErr == 0) {
+        nrErr += checkFlush(rx, rx, tx);
+        nrErr += checkFlush(tx, rx, tx);
+    }
+
+    if (nrErr) {
+        printError(THIS_NAME, "###########################################################\n");
+        printError(THIS_NAME, "#### TEST BENCH FAILED : TOTAL NUMBER OF ERROR(S) = %2d ####\n", nrErr);
+        printError(THIS_NAME, "###########################################################\n");
+    }
+    else {
+        printInfo(THIS_NAME, "#############################################################\n");
+        printInfo(THIS_NAME, "####               SUCCESSFUL END OF TEST                ####\n");
+        printInfo(THIS_NAME, "#############################################################\n");
+    }
+
+    return nrErr;
+}
+
+/*! \} */
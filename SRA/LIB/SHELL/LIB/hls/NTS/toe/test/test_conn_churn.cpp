@@ -0,0 +1,283 @@
+/*
+ * Copyright 2016 -- 2021 IBM Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*******************************************************************************
+ * @file       : test_conn_churn.cpp
+ * @brief      : Connection churn benchmark of the TOE.
+ *
+ * System:     : cloudFPGA
+ * Component   : Shell, Network Transport Stack (NTS)
+ * Language    : Vivado HLS
+ *
+ * @details
+ *  This testbench drives the whole TOE with a client that opens short-lived
+ *  connections one after the other. The client sends a segment of data right
+ *  after the three-way handshake, and the application closes the session as
+ *  soon as this data is notified. The TOE therefore performs the active close
+ *  and holds the session in TIME-WAIT. A connection is complete when the TOE
+ *  acknowledges the FIN of the client. A connection which does not complete
+ *  within one second (e.g. because all the sessions are in TIME-WAIT) is
+ *  retried with a new source port. The CAM and the data mover are emulated by
+ *  the harness of 'test_toe_harness.hpp'. Three scenarios are run, each with
+ *  3*TOE_MAX_SESSIONS connections:
+ *   A) A new four-tuple per connection to a port with the default TIME-WAIT.
+ *   B) A new four-tuple per connection to a port with the short TIME-WAIT.
+ *   C) A few four-tuples re-used with an increasing ISN to the port of (A),
+ *      such that every SYN re-opens a session in TIME-WAIT [RFC-6191].
+ *  The testbench reports the sustainable connection rate of every scenario,
+ *  measured after the first TOE_MAX_SESSIONS connections. The timers of the
+ *  C simulation count one second every TIME_1s*TOE_TIMER_TICK clock cycles,
+ *  and the rates are given in this time base.
+ *
+ *  Usage: 'make csimConnChurn' from the 'toe' directory.
+ *
+ * \ingroup NTS_TOE
+ * \addtogroup NTS_TOE_TEST
+ * \{
+ *******************************************************************************/
+
+#include "test_tcp_packet.hpp"
+#include "test_toe_harness.hpp"
+
+using namespace hls;
+using namespace std;
+
+#define THIS_NAME "TB"
+
+//---------------------------------------------------------
+//-- TESTBENCH GLOBAL VARIABLES
+//---------------------------------------------------------
+bool            gTraceEvent   = false;
+bool            gFatalError   = false;
+unsigned int    gSimCycCnt    = 0;
+
+//---------------------------------------------------------
+//-- TESTBENCH DEFINES
+//---------------------------------------------------------
+const int       cNrScenarios = 3;
+const int       cNrConns     = 3*TOE_MAX_SESSIONS;    // Connections per scenario
+const int       cWarmUp      = TOE_MAX_SESSIONS;      // Connections before the rate is measured
+const int       cNrTuples    = TOE_MAX_SESSIONS/2;    // The four-tuples re-used by scenario (C)
+const int       cDataLen     = 16;                    // Bytes sent per connection
+const int       c1s          = TIME_1s*TOE_TIMER_TICK; // One second in clock cycles
+const int       cTimeout     = c1s;                   // Max. cycles from a SYN to the last ACK
+const int       cMaxCycles   = 8*TOE_TIME_WAIT_S_CFG*c1s;
+const Ip4Addr   cToeIpAddr   = 0x0A0CC832;  // 10.12.200.50
+const TcpPort   cLsnPort     = 0x2263;      // With the default TIME-WAIT
+const TcpPort   cLsnPortTws  = 0x2264;      // With the short TIME-WAIT
+const Ip4Addr   cClientIp    = 0x0A0CC801;  // 10.12.200.1
+const TcpPort   cClientPort  = 0x9000;      // The first new source port
+const TcpPort   cReusedPort  = 0x8000;      // The first source port re-used by (C)
+const TcpSeqNum cClientIsn   = 0x10000000;
+
+enum CliState { CLI_IDLE=0, CLI_SYN_SENT, CLI_DATA_SENT, CLI_FIN_SENT };
+
+const char *cScenario[cNrScenarios] = {
+    "A) New four-tuples, default TIME-WAIT ",
+    "B) New four-tuples, short TIME-WAIT   ",
+    "C) Re-used four-tuples [RFC-6191]     " };
+
+/*******************************************************************************
+ * @brief The statistics of a scenario.
+ *******************************************************************************/
+struct Stats {
+    int      nrDone;
+    int      nrRetries;
+    unsigned warmCyc;   // Completion cycle of the last warm-up connection
+    unsigned lastCyc;   // Completion cycle of the last connection
+    Stats() : nrDone(0), nrRetries(0), warmCyc(0), lastCyc(0) {}
+    double cycPerConn() const {
+        return (double)(lastCyc - warmCyc) / (nrDone - cWarmUp);
+    }
+};
+
+/*******************************************************************************
+ * @brief Main function.
+ *******************************************************************************/
+int main(int argc, char* argv[]) {
+
+    const char *myName = concat3(THIS_NAME, "/", "CHN");
+
+    //-- The TOE with its emulated CAM and data mover
+    ToeHarness  tb(cToeIpAddr);
+
+    //-- Emulated client
+    ToeSegment  seg;
+    Stats       stats[cNrScenarios];
+    CliState    cliState   = CLI_IDLE;
+    TcpPort     cliPort    = 0;
+    TcpPort     cliDstPort = 0;
+    TcpSeqNum   cliIsn     = cClientIsn;
+    TcpSeqNum   cliFinSeq  = 0;
+    unsigned    cliCyc     = 0;     // Cycle of the SYN
+    TcpPort     nextPort   = cClientPort;
+    int  nrLsnReps=0, scenario=0, nrConns=0, nrErr=0;
+    bool lsnSent=false, draining=true, retry=false;
+
+    printInfo(THIS_NAME, "############################################################################\n");
+    printInfo(THIS_NAME, "## TESTBENCH 'test_conn_churn' STARTS HERE                                ##\n");
+    printInfo(THIS_NAME, "############################################################################\n");
+    printInfo(THIS_NAME, "Sessions=%d - TIME-WAIT=%ds (short=%dms) - Connections per scenario=%d - 1s=%d cycles.\n",
+              TOE_MAX_SESSIONS, TOE_TIME_WAIT_S_CFG, TOE_TIME_WAIT_SHORT_MS_CFG, cNrConns, c1s);
+
+    for (gSimCycCnt=0; gSimCycCnt<cMaxCycles; gSimCycCnt++) {
+        //-- OPEN THE LISTENING PORTS -----------------------------------------
+        if (tb.sNTS_Ready and !lsnSent) {
+            tb.ssTAIF_LsnReq.write(cLsnPort);
+            tb.ssTAIF_LsnReq.write(TcpAppLsnReq(cLsnPortTws, 1));
+            // A port outside of the static range or an unknown keepalive profile must be refused
+            tb.ssTAIF_LsnReq.write(TcpAppLsnReq(cLsnPortTws | 0x8000));
+            tb.ssTAIF_LsnReq.write(TcpAppLsnReq(cLsnPortTws, 1, TOE_ACK_DEFAULT, TOE_KEEPALIVE_FAST+1));
+            lsnSent = true;
+        }
+
+        //-- START A SCENARIO ONCE ALL THE SESSIONS ARE RELEASED --------------
+        if (draining and (nrLsnReps == 4) and (tb.sssRegCnt(15, 0) == 0)) {
+            if (scenario == cNrScenarios) {
+                break;
+            }
+            draining = false;
+            nrConns  = 0;
+        }
+
+        //-- OPEN A NEW CONNECTION --------------------------------------------
+        if (!draining and (cliState == CLI_IDLE)) {
+            if ((scenario == 2) and !retry) {
+                cliPort = cReusedPort + (nrConns % cNrTuples);
+            }
+            else {
+                cliPort = nextPort++;
+            }
+            cliDstPort = (scenario == 1) ? cLsnPortTws : cLsnPort;
+            cliIsn    += 0x00100000;
+            tb.sendPacket(buildTcpPacket(cClientIp, cToeIpAddr, cliPort, cliDstPort,
+                                         cliIsn, 0, 0x02, 0));
+            cliState = CLI_SYN_SENT;
+            cliCyc   = gSimCycCnt;
+            retry    = false;
+        }
+
+        //-- FEED THE PACKETS OF THE CLIENT AND RUN THE TOE -------------------
+        tb.feedIpRx();
+        tb.run();
+
+        //-- EMULATE THE CLIENT -----------------------------------------------
+        if (tb.recvSegment(seg) and (seg.dstPort == cliPort)) {
+            if ((cliState == CLI_SYN_SENT) and ((seg.flags & 0x12) == 0x12)) {
+                if (seg.ackNum != cliIsn + 1) {
+                    printError(myName, "The SYN-ACK to port #%d acknowledges 0x%8.8X instead of 0x%8.8X.\n",
+                               cliPort.to_uint(), seg.ackNum.to_uint(), (cliIsn + 1).to_uint());
+                    nrErr++;
+                }
+                //-- Complete the handshake and send the data right after
+                tb.sendPacket(buildTcpPacket(cClientIp, cToeIpAddr, cliPort, cliDstPort,
+                                             cliIsn+1, seg.seqNum+1, 0x10, 0));
+                tb.sendPacket(buildTcpPacket(cClientIp, cToeIpAddr, cliPort, cliDstPort,
+                                             cliIsn+1, seg.seqNum+1, 0x18, cDataLen));
+                cliState = CLI_DATA_SENT;
+            }
+            else if ((cliState == CLI_DATA_SENT) and (seg.flags & 0x01)) {
+                //-- The TOE closes the session. Reply with our own FIN
+                cliFinSeq = cliIsn + 1 + cDataLen;
+                tb.sendPacket(buildTcpPacket(cClientIp, cToeIpAddr, cliPort, cliDstPort,
+                                             cliFinSeq, seg.seqNum+1, 0x11, 0));
+                cliState = CLI_FIN_SENT;
+            }
+            else if ((cliState == CLI_FIN_SENT) and (seg.flags & 0x10) and (seg.ackNum == cliFinSeq + 1)) {
+                //-- The connection is complete. The session is in TIME-WAIT
+                Stats &st = stats[scenario];
+                st.nrDone++;
+                st.lastCyc = gSimCycCnt;
+                if (st.nrDone == cWarmUp) {
+                    st.warmCyc = gSimCycCnt;
+                }
+                cliState = CLI_IDLE;
+                if (++nrConns == cNrConns) {
+                    scenario++;
+                    draining = true;
+                }
+            }
+        }
+        if ((cliState != CLI_IDLE) and (gSimCycCnt - cliCyc > cTimeout)) {
+            //-- Retry with a new source port
+            stats[scenario].nrRetries++;
+            cliState = CLI_IDLE;
+            retry    = true;
+        }
+
+        //-- EMULATE THE APPLICATION ------------------------------------------
+        if (!tb.ssTAIF_LsnRep.empty()) {
+            bool lsnOk = tb.ssTAIF_LsnRep.read();
+            if (lsnOk != (nrLsnReps < 2)) {
+                printError(myName, "Listen request #%d was %s.\n", nrLsnReps,
+                           lsnOk ? "granted" : "refused");
+                nrErr++;
+                break;
+            }
+            nrLsnReps++;
+        }
+        if (!tb.ssTAIF_Notif.empty()) {
+            TcpAppNotif notif = tb.ssTAIF_Notif.read();
+            if ((notif.tcpDatLen == cDataLen) and (notif.tcpSrcPort == cliPort)) {
+                //-- Close the session as soon as its data arrived
+                tb.ssTAIF_ClsReq.write(notif.sessionID);
+            }
+        }
+    }
+
+    for (int s=0; s<cNrScenarios; s++) {
+        if (stats[s].nrDone > cWarmUp) {
+            printInfo(myName, "%s: %2d connections (%d retries) - %8.1f cycles/conn - %7.2f conn/s.\n",
+                      cScenario[s], stats[s].nrDone, stats[s].nrRetries,
+                      stats[s].cycPerConn(), c1s / stats[s].cycPerConn());
+        }
+    }
+    printInfo(myName, "TIME-WAIT bound of (A) = %d sessions / %ds = %.2f conn/s.\n",
+              TOE_MAX_SESSIONS, TOE_TIME_WAIT_S_CFG, (double)TOE_MAX_SESSIONS/TOE_TIME_WAIT_S_CFG);
+
+    if (scenario != cNrScenarios) {
+        printError(myName, "The test did not complete within %d cycles.\n", cMaxCycles);
+        nrErr++;
+    }
+    else {
+        //-- Fast recycling must not lose a connection and must beat the default TIME-WAIT
+        for (int s=1; s<cNrScenarios; s++) {
+            if (stats[s].nrRetries != 0) {
+                printError(myName, "Scenario %c needed %d retries.\n", 'A'+s, stats[s].nrRetries);
+                nrErr++;
+            }
+            if (stats[s].cycPerConn() >= stats[0].cycPerConn()) {
+                printError(myName, "Scenario %c is not faster than scenario A.\n", 'A'+s);
+                nrErr++;
+            }
+        }
+    }
+
+    if (nrErr) {
+        printError(THIS_NAME, "###########################################################\n");
+        printError(THIS_NAME, "#### TEST BENCH FAILED : TOTAL NUMBER OF ERROR(S) = %2d ####\n", nrErr);
+        printError(THIS_NAME, "###########################################################\n");
+    }
+    else {
+        printInfo(THIS_NAME, "#############################################################\n");
+        printInfo(THIS_NAME, "####               SUCCESSFUL END OF TEST                ####\n");
+        printInfo(THIS_NAME, "#############################################################\n");
+    }
+
+    return nrErr;
+}
+
+/*! \} */
@@ -0,0 +1,337 @@
+/*
+ * Copyright 2016 -- 2021 IBM Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*******************************************************************************
+ * @file       : test_cut_through.cpp
+ * @brief      : Latency benchmark of the store-and-forward vs. cut-through
+ *                receive paths.
+ *
+ * System:     : cloudFPGA
+ * Component   : Shell, Network Transport Stack (NTS)
+ * Language    : Vivado HLS
+ *
+ * @details
+ *  This testbench drives the Rx engine (RXe) with the in-order segments of a
+ *  single established session, one segment at a time. Every few segments, a
+ *  copy with a corrupted payload is sent right before the valid one. The
+ *  session tables, the data mover and the application are emulated. The
+ *  testbench checks that [APP] is only notified about valid bytes, that these
+ *  bytes are in memory when the notification is received, and that the bad
+ *  segments are accounted for by the CRC drop counter. It reports the number
+ *  of cycles between the first chunk of a segment and its notification to
+ *  [APP]. The benchmark is run twice by 'make csimCutThrough': once with the
+ *  store-and-forward receive path, and once with TOE_RX_CUT_THROUGH_CFG.
+ *
+ *  Usage: 'make csimCutThrough' from the 'toe' directory.
+ *
+ * \ingroup NTS_TOE
+ * \addtogroup NTS_TOE_TEST
+ * \{
+ *******************************************************************************/
+
+#include <cstdlib>
+#include <map>
+#include <vector>
+
+#include "../src/rx_engine/src/rx_engine.hpp"
+#include "test_tcp_packet.hpp"
+
+using namespace hls;
+using namespace std;
+
+#define THIS_NAME "TB"
+
+//---------------------------------------------------------
+//-- TESTBENCH GLOBAL VARIABLES
+//---------------------------------------------------------
+bool            gTraceEvent   = false;
+bool            gFatalError   = false;
+unsigned int    gSimCycCnt    = 0;
+
+//---------------------------------------------------------
+//-- TESTBENCH DEFINES
+//---------------------------------------------------------
+const int          cNrSegs     = 40;       // Valid segments (i.e. < 64KB in total)
+const int          cBadEvery   = 4;        // A corrupted copy precedes every 4th segment
+const int          cMaxLen     = 1460;     // Max. bytes per segment (i.e. MSS)
+const int          cGapCycles  = 50;       // Idle cycles between two segments
+const int          cMaxCycles  = 200000;
+const TcpSeqNum    cIsn        = 0x00001000;  // The segments never wrap around
+
+/*******************************************************************************
+ * @brief Builds an IPv4/TCP packet carrying 'len' bytes of the byte stream from
+ *         offset 'off', and optionally corrupts one of its payload bytes after
+ *         the checksum was computed.
+ *
+ * @param[in]  off      The offset of the first payload byte in the byte stream.
+ * @param[in]  len      The length of the payload.
+ * @param[in]  corrupt  Corrupt the payload once the checksum is computed.
+ * @param[out] pkt      The AxisIp4 chunks of the packet.
+ *******************************************************************************/
+void buildPacket(int off, int len, bool corrupt, vector<AxisIp4> &pkt)
+{
+    pkt = buildTcpPacket(0x0A0CC801, 0x0A0CC832, 0xA001, 0x2263,
+                         cIsn + off, 0, 0x10, len, off);
+    if (corrupt) {
+        int bytCnt = IP4_HEADER_LEN + TCP_HEADER_LEN + len/2;
+        int bytNum = bytCnt % 8;
+        AxisIp4 &chunk = pkt[bytCnt/8];
+        chunk.setLE_TData(chunk.getLE_TData((bytNum*8)+7, (bytNum*8)+0) ^ 0x5A,
+                          (bytNum*8)+7, (bytNum*8)+0);
+    }
+}
+
+/*******************************************************************************
+ * @brief Runs the segments through the Rx engine.
+ *******************************************************************************/
+int runRx()
+{
+    const char *myName = concat3(THIS_NAME, "/", "RXe");
+
+    //-- RXe interfaces
+    stream<AxisIp4>             ssIPRX_Data("ssIPRX_Data");
+    stream<SessionLookupQuery>  ssSLc_LkpReq("ssSLc_LkpReq");
+    stream<SessionLookupReply>  ssSLc_LkpRep("ssSLc_LkpRep");
+    stream<StateQuery>          ssSTt_StateQry("ssSTt_StateQry");
+    stream<TcpState>            ssSTt_StateRep("ssSTt_StateRep");
+    stream<TcpPort>             ssPRt_PortReq("ssPRt_PortReq");
+    stream<PortStsRep>          ssPRt_PortRep("ssPRt_PortRep");
+    stream<RXeRxSarQuery>       ssRSt_RxSarQry("ssRSt_RxSarQry");
+    stream<RxSarReply>          ssRSt_RxSarRep("ssRSt_RxSarRep");
+    stream<RXeTxSarQuery>       ssTSt_TxSarQry("ssTSt_TxSarQry");
+    stream<RXeTxSarReply>       ssTSt_TxSarRep("ssTSt_TxSarRep");
+    stream<RXeReTransTimerCmd>  ssTIm_ReTxTimerCmd("ssTIm_ReTxTimerCmd");
+    stream<RXeProbeTimerCmd>    ssTIm_ProbeTimerCmd("ssTIm_ProbeTimerCmd");
+    stream<RXeCloseTimerCmd>    ssTIm_CloseTimer("ssTIm_CloseTimer");
+    stream<ExtendedEvent>       ssEVe_Event("ssEVe_Event");
+    stream<SessState>           ssTAi_SessOpnSts("ssTAi_SessOpnSts");
+    stream<TcpAppNotif>         ssRAi_RxNotif("ssRAi_RxNotif");
+    stream<DmCmd>               ssMEM_WrCmd("ssMEM_WrCmd");
+    stream<AxisApp>             ssMEM_WrData("ssMEM_WrData");
+    stream<DmSts>               ssMEM_WrSts("ssMEM_WrSts");
+    stream<StsBit>              ssMMIO_RxMemWrErr("ssMMIO_RxMemWrErr");
+    stream<ap_uint<8> >         ssMMIO_CrcDropCnt("ssMMIO_CrcDropCnt");
+    stream<ap_uint<8> >         ssMMIO_SessDropCnt("ssMMIO_SessDropCnt");
+    stream<ap_uint<8> >         ssMMIO_OooDropCnt("ssMMIO_OooDropCnt");
+    stream<RxBufPtr>            ssDBG_RxFreeSpace("ssDBG_RxFreeSpace");
+    stream<ap_uint<32> >        ssDBG_TcpIpRxByteCnt("ssDBG_TcpIpRxByteCnt");
+    stream<ap_uint<8> >         ssDBG_OooDebug("ssDBG_OooDebug");
+
+    //-- Emulated session, data mover and application
+    RxSeqNum    rcvd = cIsn;
+    RxBufPtr    appd = cIsn(TOE_WINDOW_BITS-1, 0);
+    OooBlock    noBlk[TOE_MAX_OOO_BLOCKS];
+    map<uint64_t, ap_uint<8> > dram;
+    DmCmd       cmd(0, 0);
+    ap_uint<8>  crcDropCnt = 0;
+
+    //-- Traffic
+    vector<AxisIp4> pkt;
+    int  seg=0, off=0, len=0, pktIdx=0, gap=0, nrBad=0, nrErr=0;
+    bool badCopy=false, waiting=false;
+    int  appOff=0, startCyc=0, totLatency=0, totBytes=0;
+
+    for (gSimCycCnt=0; (gSimCycCnt<cMaxCycles) and (seg<cNrSegs); gSimCycCnt++) {
+        //-- FEED ONE SEGMENT AT A TIME ---------------------------------------
+        if (!waiting and (gap == 0)) {
+            if (pktIdx == 0) {
+                if (len == 0) {
+                    // Next segment. Send a corrupted copy of it first every few segments.
+                    len = 1 + (rand() % cMaxLen);
+                    badCopy = ((seg % cBadEvery) == (cBadEvery-1));
+                }
+                buildPacket(off, len, badCopy, pkt);
+                startCyc = gSimCycCnt;
+            }
+            ssIPRX_Data.write(pkt[pktIdx++]);
+            if (pktIdx == (int)pkt.size()) {
+                pktIdx = 0;
+                if (badCopy) {
+                    badCopy = false;
+                    nrBad++;
+                    gap = cGapCycles;
+                }
+                else {
+                    waiting = true;
+                }
+            }
+        }
+        else if (gap != 0) {
+            gap--;
+        }
+
+        //-- RUN THE RX ENGINE ------------------------------------------------
+        rx_engine(ssIPRX_Data,
+                  ssSLc_LkpReq,   ssSLc_LkpRep,
+                  ssSTt_StateQry, ssSTt_StateRep,
+                  ssPRt_PortReq,  ssPRt_PortRep,
+                  ssRSt_RxSarQry, ssRSt_RxSarRep,
+                  ssTSt_TxSarQry, ssTSt_TxSarRep,
+                  ssTIm_ReTxTimerCmd, ssTIm_ProbeTimerCmd, ssTIm_CloseTimer,
+                  ssEVe_Event,    ssTAi_SessOpnSts, ssRAi_RxNotif,
+                  ssMEM_WrCmd,    ssMEM_WrData,   ssMEM_WrSts,
+                  ssMMIO_RxMemWrErr, ssMMIO_CrcDropCnt, ssMMIO_SessDropCnt, ssMMIO_OooDropCnt,
+                  ssDBG_RxFreeSpace, ssDBG_TcpIpRxByteCnt, ssDBG_OooDebug);
+
+        //-- EMULATE THE PORT TABLE AND THE SESSION LOOKUP CONTROLLER ---------
+        if (!ssPRt_PortReq.empty()) {
+            ssPRt_PortReq.read();
+            ssPRt_PortRep.write(PortStsRep(STS_OPENED));
+        }
+        if (!ssSLc_LkpReq.empty()) {
+            ssSLc_LkpReq.read();
+            ssSLc_LkpRep.write(SessionLookupReply(0, SESSION_EXISTS));
+        }
+
+        //-- EMULATE THE STATE, RX SAR AND TX SAR TABLES ----------------------
+        if (!ssSTt_StateQry.empty()) {
+            StateQuery query = ssSTt_StateQry.read();
+            if (query.write == QUERY_RD) {
+                ssSTt_StateRep.write(ESTABLISHED);
+            }
+        }
+        if (!ssRSt_RxSarQry.empty()) {
+            RXeRxSarQuery query = ssRSt_RxSarQry.read();
+            if (query.write == QUERY_RD) {
+                ssRSt_RxSarRep.write(RxSarReply(appd, rcvd, false, rcvd, 0, noBlk, 0, 0, false));
+            }
+            else {
+                rcvd = query.rcvd;
+            }
+        }
+        if (!ssTSt_TxSarQry.empty()) {
+            RXeTxSarQuery query = ssTSt_TxSarQry.read();
+            if (query.write == QUERY_RD) {
+                ssTSt_TxSarRep.write(RXeTxSarReply(0, 0, 0xFFFF, 0xFFFF, 0, false));
+            }
+        }
+
+        //-- EMULATE THE DATA MOVER -------------------------------------------
+        if ((cmd.btt == 0) and !ssMEM_WrCmd.empty()) {
+            cmd = ssMEM_WrCmd.read();
+        }
+        else if ((cmd.btt != 0) and !ssMEM_WrData.empty()) {
+            AxisApp chunk = ssMEM_WrData.read();
+            for (int lane=0; lane<ARW/8; lane++) {
+                if (chunk.getLE_TKeep()[lane]) {
+                    dram[cmd.saddr.to_uint64()] = chunk.getLE_TData(8*lane+7, 8*lane);
+                    cmd.saddr++;
+                    cmd.btt--;
+                }
+            }
+            if (cmd.btt == 0) {
+                DmSts sts;
+                sts.tag = 0; sts.interr = 0; sts.decerr = 0; sts.slverr = 0; sts.okay = 1;
+                ssMEM_WrSts.write(sts);
+            }
+        }
+
+        //-- EMULATE THE APPLICATION ------------------------------------------
+        if (!ssRAi_RxNotif.empty()) {
+            TcpAppNotif notif = ssRAi_RxNotif.read();
+            if (notif.tcpDatLen != 0) {
+                // The notified bytes must be the valid ones and must already be in memory
+                for (int i=0; i<notif.tcpDatLen; i++) {
+                    uint64_t addr = TOE_RX_MEMORY_BASE + ((cIsn + appOff + i) & ((1 << TOE_WINDOW_BITS) - 1));
+                    if (dram[addr] != tcpStreamByte(appOff+i)) {
+                        if (nrErr < 10) {
+                            printError(myName, "Byte #%d was notified to [APP] before being valid in memory.\n", appOff+i);
+                        }
+                        nrErr++;
+                    }
+                }
+                appOff += notif.tcpDatLen;
+                appd   += notif.tcpDatLen;
+                if (appOff != (off + len)) {
+                    printError(myName, "Received a notification for %d bytes instead of %d.\n",
+                               notif.tcpDatLen.to_int(), len);
+                    nrErr++;
+                    appOff = off + len;
+                }
+                totLatency += gSimCycCnt - startCyc;
+                totBytes   += len;
+                off = appOff;
+                len = 0;
+                seg++;
+                waiting = false;
+                gap = cGapCycles;
+            }
+        }
+
+        //-- DRAIN THE OTHER INTERFACES ---------------------------------------
+        if (!ssTIm_ReTxTimerCmd.empty())    { ssTIm_ReTxTimerCmd.read();    }
+        if (!ssTIm_ProbeTimerCmd.empty()) { ssTIm_ProbeTimerCmd.read(); }
+        if (!ssTIm_CloseTimer.empty())      { ssTIm_CloseTimer.read();      }
+        if (!ssEVe_Event.empty())           { ssEVe_Event.read();           }
+        if (!ssTAi_SessOpnSts.empty())      { ssTAi_SessOpnSts.read();      }
+        if (!ssMMIO_RxMemWrErr.empty())     { ssMMIO_RxMemWrErr.read();     }
+        if (!ssMMIO_CrcDropCnt.empty())     { crcDropCnt = ssMMIO_CrcDropCnt.read(); }
+        if (!ssMMIO_SessDropCnt.empty())    { ssMMIO_SessDropCnt.read();    }
+        if (!ssMMIO_OooDropCnt.empty())     { ssMMIO_OooDropCnt.read();     }
+        if (!ssDBG_RxFreeSpace.empty())     { ssDBG_RxFreeSpace.read();     }
+        if (!ssDBG_TcpIpRxByteCnt.empty())  { ssDBG_TcpIpRxByteCnt.read();  }
+        if (!ssDBG_OooDebug.empty())        { ssDBG_OooDebug.read();        }
+    }
+
+    if (seg != cNrSegs) {
+        printError(myName, "Only %d segments out of %d were notified to [APP].\n", seg, cNrSegs);
+        nrErr++;
+    }
+    if (rcvd != (cIsn + off)) {
+        printError(myName, "The 'rcvd' pointer is 0x%8.8x instead of 0x%8.8x.\n",
+                   rcvd.to_uint(), (cIsn + off).to_uint());
+        nrErr++;
+    }
+    if (crcDropCnt != nrBad) {
+        printError(myName, "The CRC drop counter is %d instead of %d.\n", crcDropCnt.to_int(), nrBad);
+        nrErr++;
+    }
+    printInfo(myName, "Segments=%d (+%d corrupted) - Bytes=%d - Latency to [APP]=%5.1f cycles per segment (%5.3f per byte).\n",
+              seg, nrBad, totBytes, (double)totLatency/(seg ? seg : 1), (double)totLatency/(totBytes ? totBytes : 1));
+    return nrErr;
+}
+
+/*******************************************************************************
+ * @brief Main function.
+ *******************************************************************************/
+int main(int argc, char* argv[]) {
+
+    int nrErr = 0;
+
+    printInfo(THIS_NAME, "############################################################################\n");
+    printInfo(THIS_NAME, "## TESTBENCH 'test_cut_through' STARTS HERE                               ##\n");
+    printInfo(THIS_NAME, "############################################################################\n");
+    printInfo(THIS_NAME, "The receive path is %s (TOE_RX_CUT_THROUGH_CFG=%d).\n",
+              TOE_RX_CUT_THROUGH_CFG ? "cut-through" : "store-and-forward", TOE_RX_CUT_THROUGH_CFG);
+
+    srand(19);
+    nrErr += runRx();
+
+    if (nrErr) {
+        printError(THIS_NAME, "###########################################################\n");
+        printError(THIS_NAME, "#### TEST BENCH FAILED : TOTAL NUMBER OF ERROR(S) = %2d ####\n", nrErr);
+        printError(THIS_NAME, "###########################################################\n");
+    }
+    else {
+        printInfo(THIS_NAME, "#############################################################\n");
+        printInfo(THIS_NAME, "####               SUCCESSFUL END OF TEST                ####\n");
+        printInfo(THIS_NAME, "#############################################################\n");
+    }
+
+    return nrErr;
+}
+
+/*! \} */
@@ -0,0 +1,297 @@
+/*
+ * Copyright 2016 -- 2021 IBM Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*******************************************************************************
+ * @file       : test_keepalive.cpp
+ * @brief      : Testbench of the keepalive timers of the TOE.
+ *
+ * System:     : cloudFPGA
+ * Component   : Shell, Network Transport Stack (NTS)
+ * Language    : Vivado HLS
+ *
+ * @details
+ *  This testbench drives the Timers (TIm) with the keepalive commands of six
+ *  sessions, as [RXe] would issue them:
+ *   - a session whose peer vanished (i.e. no segment after the handshake),
+ *   - a session whose peer only answers the keepalive probes,
+ *   - a session which keeps receiving segments,
+ *   - a session which gets closed,
+ *   - a session whose peer vanished, accepted by a port with the fast profile,
+ *   - a session whose peer vanished, accepted by a port without keepalive.
+ *  It checks that the first session is probed TOE_KEEPALIVE_PROBES_CFG times
+ *  at the expected ticks before it gets aborted, that the second one is probed
+ *  but kept alive, and that the next two ones are never probed. The fifth one
+ *  must be probed and aborted with the timings of the fast profile, and the
+ *  last one must never be probed.
+ *
+ *  Usage: 'make csimKeepAlive' from the 'toe' directory.
+ *
+ * \ingroup NTS_TOE
+ * \addtogroup NTS_TOE_TEST
+ * \{
+ *******************************************************************************/
+
+#include <cstdlib>
+#include <vector>
+
+#include "../src/timers/timers.hpp"
+
+using namespace hls;
+using namespace std;
+
+#define THIS_NAME "TB"
+
+//---------------------------------------------------------
+//-- TESTBENCH GLOBAL VARIABLES
+//---------------------------------------------------------
+bool            gTraceEvent   = false;
+bool            gFatalError   = false;
+unsigned int    gSimCycCnt    = 0;
+
+//---------------------------------------------------------
+//-- TESTBENCH DEFINES
+//---------------------------------------------------------
+enum SessRole { DEAD=0, PROBED, BUSY, CLOSING_SESS, FAST_DEAD, NO_KEEPALIVE, NR_ROLES };
+const char    *cRoleName[NR_ROLES] = { "dead", "probed", "busy", "closed", "fast", "off" };
+const int      cProfile[NR_ROLES]  = { TOE_KEEPALIVE_DEFAULT, TOE_KEEPALIVE_DEFAULT,
+                                       TOE_KEEPALIVE_DEFAULT, TOE_KEEPALIVE_DEFAULT,
+                                       TOE_KEEPALIVE_FAST,    TOE_KEEPALIVE_OFF };
+
+const uint64_t cTick       = TOE_TIMER_TICK.to_uint();
+const uint64_t cIdleCycs   = TOE_KEEPALIVE_IDLE.to_uint()  * cTick;
+const uint64_t cIntvlCycs  = TOE_KEEPALIVE_INTVL.to_uint() * cTick;
+const uint64_t cFastIdleCycs  = TOE_KEEPALIVE_FAST_IDLE.to_uint()  * cTick;
+const uint64_t cFastIntvlCycs = TOE_KEEPALIVE_FAST_INTVL.to_uint() * cTick;
+const uint64_t cStartCyc   = 100;
+const uint64_t cAnswerCycs = 200;                  // Round-trip of a probe
+const uint64_t cBusyCycs   = cIdleCycs / 4;        // Period of the segments of [BUSY]
+const uint64_t cSlackCycs  = 4 * cTick;            // Tolerance on an expiry
+const uint64_t cAbortCyc   = cStartCyc + cIdleCycs + TOE_KEEPALIVE_PROBES_CFG*cIntvlCycs;
+const uint64_t cMaxCycles  = cAbortCyc + 2*cIdleCycs;
+
+/*******************************************************************************
+ * @brief Checks that an event happened within the tolerance of its expiry.
+ *
+ * @details
+ *  The timers are armed relative to the current tick, so an expiry may come
+ *   up to one tick earlier than computed in clock cycles.
+ *******************************************************************************/
+int checkExpiry(const char *myName, const char *what, uint64_t cyc, uint64_t expCyc)
+{
+    if ((cyc + cTick < expCyc) or (cyc > expCyc + cSlackCycs)) {
+        printError(myName, "%s at cycle %llu instead of %llu.\n", what,
+                   (unsigned long long)cyc, (unsigned long long)expCyc);
+        return 1;
+    }
+    return 0;
+}
+
+/*******************************************************************************
+ * @brief Checks that a session whose peer vanished is probed at the expected
+ *         ticks, and then aborted.
+ *
+ * @param[in] myName     The name of the caller.
+ * @param[in] probes     The cycles of the probes of the session.
+ * @param[in] closes     The cycles of the releases of the session.
+ * @param[in] idleCycs   The idle time of its keepalive profile in cycles.
+ * @param[in] intvlCycs  The probe interval of its profile in cycles.
+ * @param[in] nrProbes   The number of probes of its profile.
+ *
+ * @return the number of errors.
+ *******************************************************************************/
+int checkDeadSession(const char *myName, const vector<uint64_t> &probes,
+                     const vector<uint64_t> &closes, uint64_t idleCycs,
+                     uint64_t intvlCycs, int nrProbes)
+{
+    int nrErr = 0;
+    if (probes.size() != nrProbes) {
+        printError(myName, "A dead session was probed %zu times instead of %d.\n",
+                   probes.size(), nrProbes);
+        nrErr++;
+    }
+    for (int p=0; p<probes.size(); p++) {
+        uint64_t expCyc = (p == 0) ? (cStartCyc + idleCycs) : (probes[p-1] + intvlCycs);
+        nrErr += checkExpiry(myName, "A probe of a dead session", probes[p], expCyc);
+    }
+    if (closes.size() != 1) {
+        printError(myName, "A dead session was released %zu times instead of once.\n",
+                   closes.size());
+        nrErr++;
+    }
+    else if (!probes.empty()) {
+        nrErr += checkExpiry(myName, "The abort of a dead session", closes[0],
+                             probes.back() + intvlCycs);
+    }
+    return nrErr;
+}
+
+/*******************************************************************************
+ * @brief Main function.
+ *******************************************************************************/
+int main(int argc, char* argv[]) {
+
+    const char *myName = concat3(THIS_NAME, "/", "TIm");
+
+    stream<RXeReTransTimerCmd>  ssRXeToTIm_ReTxTimerCmd  ("ssRXeToTIm_ReTxTimerCmd");
+    stream<RXeProbeTimerCmd>    ssRXeToTIm_ProbeTimerCmd ("ssRXeToTIm_ProbeTimerCmd");
+    stream<RXeCloseTimerCmd>    ssRXeToTIm_CloseTimer    ("ssRXeToTIm_CloseTimer");
+    stream<TXeReTransTimerCmd>  ssTXeToTIm_ReTxTimerCmd  ("ssTXeToTIm_ReTxTimerCmd");
+    stream<SessionId>           ssTXeToTIm_SetProbeTimer ("ssTXeToTIm_SetProbeTimer");
+    stream<SessionId>           ssTImToSTt_SessCloseCmd  ("ssTImToSTt_SessCloseCmd");
+    stream<Event>               ssTImToEVe_Event         ("ssTImToEVe_Event");
+    stream<SessState>           ssTImToTAi_Notif         ("ssTImToTAi_Notif");
+    stream<TcpAppNotif>         ssTImToRAi_Notif         ("ssTImToRAi_Notif");
+
+    vector<uint64_t> probes[NR_ROLES];
+    vector<uint64_t> closes[NR_ROLES];
+    vector<uint64_t> answers;
+    int              nrNotifs = 0;
+    int              nrErr    = 0;
+
+    printInfo(THIS_NAME, "############################################################################\n");
+    printInfo(THIS_NAME, "## TESTBENCH 'test_keepalive' STARTS HERE                                 ##\n");
+    printInfo(THIS_NAME, "############################################################################\n");
+    printInfo(THIS_NAME, "Keepalive: Idle=%d ticks - Interval=%d ticks - Probes=%d.\n",
+              TOE_KEEPALIVE_IDLE.to_uint(), TOE_KEEPALIVE_INTVL.to_uint(), TOE_KEEPALIVE_PROBES_CFG);
+    printInfo(THIS_NAME, "Fast keepalive: Idle=%d ticks - Interval=%d ticks - Probes=%d.\n",
+              TOE_KEEPALIVE_FAST_IDLE.to_uint(), TOE_KEEPALIVE_FAST_INTVL.to_uint(), TOE_KEEPALIVE_FAST_PROBES_CFG);
+
+    if (TOE_KEEPALIVE_IDLE == 0) {
+        printWarn(THIS_NAME, "The keepalive is disabled (TOE_KEEPALIVE_IDLE_S_CFG=0). Nothing to test.\n");
+        return 0;
+    }
+
+    for (uint64_t cyc=0; cyc<cMaxCycles; cyc++) {
+        //-- [RXe] - The handshakes complete, then the segments of every role
+        if (cyc == cStartCyc) {
+            for (int r=0; r<NR_ROLES; r++) {
+                ssRXeToTIm_ProbeTimerCmd.write(RXeProbeTimerCmd(r, LOAD_TIMER, cProfile[r]));
+            }
+        }
+        else if ((cyc > cStartCyc) and ((cyc - cStartCyc) % cBusyCycs) == 0) {
+            ssRXeToTIm_ProbeTimerCmd.write(RXeProbeTimerCmd(BUSY, LOAD_TIMER));
+        }
+        else if (cyc == cStartCyc + cBusyCycs/2) {
+            ssRXeToTIm_ProbeTimerCmd.write(RXeProbeTimerCmd(CLOSING_SESS, STOP_TIMER));
+        }
+        else if (!answers.empty() and (cyc >= answers.front())) {
+            ssRXeToTIm_ProbeTimerCmd.write(RXeProbeTimerCmd(PROBED, LOAD_TIMER));
+            answers.erase(answers.begin());
+        }
+
+        timers(ssRXeToTIm_ReTxTimerCmd, ssRXeToTIm_ProbeTimerCmd, ssRXeToTIm_CloseTimer,
+               ssTXeToTIm_ReTxTimerCmd, ssTXeToTIm_SetProbeTimer,
+               ssTImToSTt_SessCloseCmd, ssTImToEVe_Event,
+               ssTImToTAi_Notif, ssTImToRAi_Notif);
+
+        //-- [TXe] - The keepalive probes
+        if (!ssTImToEVe_Event.empty()) {
+            Event ev = ssTImToEVe_Event.read();
+            if ((ev.type != KEEPALIVE_EVENT) or (ev.sessionID >= NR_ROLES)) {
+                printError(myName, "Unexpected event '%s' for session #%d.\n",
+                           getEventName(ev.type), ev.sessionID.to_int());
+                nrErr++;
+            }
+            else {
+                probes[ev.sessionID].push_back(cyc);
+                if (ev.sessionID == PROBED) {
+                    answers.push_back(cyc + cAnswerCycs);
+                }
+            }
+        }
+        //-- [STt] - The released sessions
+        if (!ssTImToSTt_SessCloseCmd.empty()) {
+            SessionId sessId = ssTImToSTt_SessCloseCmd.read();
+            if (sessId < NR_ROLES) {
+                closes[sessId].push_back(cyc);
+            }
+            else {
+                printError(myName, "Unexpected release of session #%d.\n", sessId.to_int());
+                nrErr++;
+            }
+        }
+        //-- [RAi] - The aborted sessions
+        if (!ssTImToRAi_Notif.empty()) {
+            TcpAppNotif notif = ssTImToRAi_Notif.read();
+            if (((notif.sessionID != DEAD) and (notif.sessionID != FAST_DEAD)) or
+                (notif.tcpState != CLOSED)) {
+                printError(myName, "Unexpected notification to [RAi] for session #%d.\n",
+                           notif.sessionID.to_int());
+                nrErr++;
+            }
+            nrNotifs++;
+        }
+        if (!ssTImToTAi_Notif.empty()) {
+            ssTImToTAi_Notif.read();
+            printError(myName, "Unexpected notification to [TAi].\n");
+            nrErr++;
+        }
+        gSimCycCnt++;
+    }
+
+    //-- The dead sessions are probed at the ticks of their profile, then aborted
+    nrErr += checkDeadSession(myName, probes[DEAD], closes[DEAD],
+                              cIdleCycs, cIntvlCycs, TOE_KEEPALIVE_PROBES_CFG);
+    nrErr += checkDeadSession(myName, probes[FAST_DEAD], closes[FAST_DEAD],
+                              cFastIdleCycs, cFastIntvlCycs, TOE_KEEPALIVE_FAST_PROBES_CFG);
+    if (nrNotifs != 2) {
+        printError(myName, "The dead sessions were notified %d times instead of twice.\n", nrNotifs);
+        nrErr++;
+    }
+
+    //-- The probed session is kept alive by its answers, one probe per idle time
+    if ((probes[PROBED].size() < 2) or (closes[PROBED].size() != 0)) {
+        printError(myName, "The probed session was probed %zu times and released %zu times.\n",
+                   probes[PROBED].size(), closes[PROBED].size());
+        nrErr++;
+    }
+    for (int p=0; p<probes[PROBED].size(); p++) {
+        uint64_t expCyc = (p == 0) ? (cStartCyc + cIdleCycs) : (probes[PROBED][p-1] + cAnswerCycs + cIdleCycs);
+        nrErr += checkExpiry(myName, "A probe of the probed session", probes[PROBED][p], expCyc);
+    }
+
+    //-- The busy, the closed and the sessions without keepalive are never probed
+    for (int r=BUSY; r<NR_ROLES; r++) {
+        if (r == FAST_DEAD) {
+            continue;
+        }
+        if ((probes[r].size() != 0) or (closes[r].size() != 0)) {
+            printError(myName, "The %s session was probed %zu times and released %zu times.\n",
+                       cRoleName[r], probes[r].size(), closes[r].size());
+            nrErr++;
+        }
+    }
+
+    for (int r=0; r<NR_ROLES; r++) {
+        printInfo(myName, "Session #%d (%-6s) - Probes=%2zu - Released=%zu.\n",
+                  r, cRoleName[r], probes[r].size(), closes[r].size());
+    }
+
+    if (nrErr) {
+        printError(THIS_NAME, "###########################################################\n");
+        printError(THIS_NAME, "#### TEST BENCH FAILED : TOTAL NUMBER OF ERROR(S) = %2d ####\n", nrErr);
+        printError(THIS_NAME, "###########################################################\n");
+    }
+    else {
+        printInfo(THIS_NAME, "#############################################################\n");
+        printInfo(THIS_NAME, "####               SUCCESSFUL END OF TEST                ####\n");
+        printInfo(THIS_NAME, "#############################################################\n");
+    }
+
+    return nrErr;
+}
+
+/*! \} */
@@ -0,0 +1,273 @@
+/*
+ * Copyright 2016 -- 2021 IBM Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*******************************************************************************
+ * @file       : test_port_alloc.cpp
+ * @brief      : Latency benchmark of the ephemeral port allocator.
+ *
+ * System:     : cloudFPGA
+ * Component   : Shell, Network Transport Stack (NTS)
+ * Language    : Vivado HLS
+ *
+ * @details
+ *  This testbench drives the PortTable (PRt) the way the TxAppInterface (TAi)
+ *  does when it serves a 'TcpAppOpnReq' from the application. The free port
+ *  request is the first step of an active open, and the only one whose latency
+ *  depends on the number of connections. The port space is filled up to 1K,
+ *  10K and 30K ports in use. At every step, random ports are released and
+ *  re-allocated, such that the free ports get scattered across the bitmap.
+ *  The testbench checks that every assigned port was free and is reported as
+ *  used by [PRt], and that a request gets held when no port is left. It
+ *  reports the number of cycles between a request and its reply, along with
+ *  a model of the former linear search of the table (i.e. 2 cycles per port
+ *  visited from the last assigned port onward).
+ *
+ *  Usage: 'make csimPortAlloc' from the 'toe' directory.
+ *
+ * \ingroup NTS_TOE
+ * \addtogroup NTS_TOE_TEST
+ * \{
+ *******************************************************************************/
+
+#include <cstdlib>
+#include <vector>
+
+#include "../src/port_table/port_table.hpp"
+
+using namespace hls;
+using namespace std;
+
+#define THIS_NAME "TB"
+
+//---------------------------------------------------------
+//-- TESTBENCH GLOBAL VARIABLES
+//---------------------------------------------------------
+bool            gTraceEvent   = false;
+bool            gFatalError   = false;
+unsigned int    gSimCycCnt    = 0;
+
+//---------------------------------------------------------
+//-- TESTBENCH DEFINES
+//---------------------------------------------------------
+const int       cNrPorts     = 0x8000;
+const int       cNrSteps     = 3;
+const int       cInUse[cNrSteps] = { 1000, 10000, 30000 };
+const int       cNrChurns    = 1000;     // Release+allocate pairs per step
+const int       cMaxCycles   = 100;      // Per request
+
+//---------------------------------------------------------
+//-- THE STREAMS OF THE DESIGN UNDER TEST
+//---------------------------------------------------------
+StsBool              sTOE_Ready;
+stream<TcpPort>      ssRXe_GetPortStateReq ("ssRXe_GetPortStateReq");
+stream<PortStsRep>   ssRXe_GetPortStateRep ("ssRXe_GetPortStateRep");
+stream<TcpAppLsnReq> ssRAi_OpenLsnPortReq  ("ssRAi_OpenLsnPortReq");
+stream<AckBit>       ssRAi_OpenLsnPortAck  ("ssRAi_OpenLsnPortAck");
+stream<ReqBit>       ssTAi_GetFreePortReq  ("ssTAi_GetFreePortReq");
+stream<TcpPort>      ssTAi_GetFreePortRep  ("ssTAi_GetFreePortRep");
+stream<TcpPort>      ssSLc_ClosePortCmd    ("ssSLc_ClosePortCmd");
+
+/*******************************************************************************
+ * @brief Runs the PortTable for one clock cycle.
+ *******************************************************************************/
+void step()
+{
+    port_table(sTOE_Ready,
+               ssRXe_GetPortStateReq, ssRXe_GetPortStateRep,
+               ssRAi_OpenLsnPortReq,  ssRAi_OpenLsnPortAck,
+               ssTAi_GetFreePortReq,  ssTAi_GetFreePortRep,
+               ssSLc_ClosePortCmd);
+    gSimCycCnt++;
+}
+
+/*******************************************************************************
+ * @brief The allocation statistics of a step.
+ *******************************************************************************/
+struct Stats {
+    int  nrReqs;
+    long sumCycs;
+    int  maxCycs;
+    long sumLegacy;
+    int  maxLegacy;
+    Stats() : nrReqs(0), sumCycs(0), maxCycs(0), sumLegacy(0), maxLegacy(0) {}
+};
+
+/*******************************************************************************
+ * @brief A model of the latency of the former linear search.
+ *
+ * @param[in]     used    The ports in use.
+ * @param[in,out] cursor  The table entry where the search starts.
+ *
+ * @details
+ *  The former allocator visited the table entries one after the other from the
+ *   entry following the last assigned port, with 2 clock cycles per entry.
+ *******************************************************************************/
+int legacyCycles(vector<bool> &used, int &cursor)
+{
+    int cycs = 1;
+    while (used[cursor]) {
+        cursor = (cursor + 1) % cNrPorts;
+        cycs += 2;
+    }
+    cursor = (cursor + 1) % cNrPorts;
+    return cycs + 2;
+}
+
+/*******************************************************************************
+ * @brief Requests a free port and checks the reply.
+ *
+ * @return the number of errors.
+ *******************************************************************************/
+int allocate(const char *myName, vector<bool> &used, vector<int> &inUse,
+             int &cursor, Stats &stats)
+{
+    int nrErr  = 0;
+    int legacy = legacyCycles(used, cursor);
+    ssTAi_GetFreePortReq.write(1);
+    int cycs;
+    for (cycs=1; (cycs<=cMaxCycles) and ssTAi_GetFreePortRep.empty(); cycs++) {
+        step();
+    }
+    if (ssTAi_GetFreePortRep.empty()) {
+        printError(myName, "No reply to the free port request after %d cycles.\n", cMaxCycles);
+        return 1;
+    }
+    TcpPort port = ssTAi_GetFreePortRep.read();
+    int     idx  = port.to_uint() - 0x8000;
+    if ((port < 0x8000) or used[idx]) {
+        printError(myName, "Port #%d was assigned but is not free.\n", port.to_uint());
+        nrErr++;
+    }
+    else {
+        used[idx] = true;
+        inUse.push_back(idx);
+    }
+    //-- The port must now be reported as used to [RXe]
+    ssRXe_GetPortStateReq.write(port);
+    for (int i=0; (i<cMaxCycles) and ssRXe_GetPortStateRep.empty(); i++) {
+        step();
+    }
+    if (ssRXe_GetPortStateRep.empty() or (ssRXe_GetPortStateRep.read().opened != ACT_USED_PORT)) {
+        printError(myName, "Port #%d is not reported as used.\n", port.to_uint());
+        nrErr++;
+    }
+    stats.nrReqs++;
+    stats.sumCycs   += cycs;
+    stats.maxCycs    = (cycs > stats.maxCycs) ? cycs : stats.maxCycs;
+    stats.sumLegacy += legacy;
+    stats.maxLegacy  = (legacy > stats.maxLegacy) ? legacy : stats.maxLegacy;
+    return nrErr;
+}
+
+/*******************************************************************************
+ * @brief Releases a random port in use.
+ *******************************************************************************/
+void release(vector<bool> &used, vector<int> &inUse)
+{
+    int pos = rand() % inUse.size();
+    int idx = inUse[pos];
+    inUse[pos] = inUse.back();
+    inUse.pop_back();
+    used[idx] = false;
+    ssSLc_ClosePortCmd.write(0x8000 + idx);
+    for (int i=0; i<4; i++) {
+        step();
+    }
+}
+
+/*******************************************************************************
+ * @brief Main function.
+ *******************************************************************************/
+int main(int argc, char* argv[]) {
+
+    const char *myName = concat3(THIS_NAME, "/", "PRt");
+
+    vector<bool> used(cNrPorts, false);
+    vector<int>  inUse;
+    int          cursor = 0;
+    int          nrErr  = 0;
+
+    printInfo(THIS_NAME, "############################################################################\n");
+    printInfo(THIS_NAME, "## TESTBENCH 'test_port_alloc' STARTS HERE                                ##\n");
+    printInfo(THIS_NAME, "############################################################################\n");
+
+    srand(21);
+
+    //-- Wait for the port tables to be initialized
+    for (int i=0; (i<2*cNrPorts) and !sTOE_Ready; i++) {
+        step();
+    }
+    if (!sTOE_Ready) {
+        printError(myName, "The PortTable is not ready after %d cycles.\n", 2*cNrPorts);
+        return 1;
+    }
+    printInfo(myName, "The PortTable is ready after %d cycles.\n", gSimCycCnt);
+
+    for (int s=0; s<cNrSteps; s++) {
+        Stats fill, churn;
+        //-- Fill up the port space
+        while (inUse.size() < cInUse[s]) {
+            nrErr += allocate(myName, used, inUse, cursor, fill);
+        }
+        //-- Release and re-allocate random ports
+        for (int c=0; c<cNrChurns; c++) {
+            release(used, inUse);
+            nrErr += allocate(myName, used, inUse, cursor, churn);
+        }
+        printInfo(myName, "InUse=%5d - Latency of a free port request = %4.2f cycles (max=%d) - Former linear search = %7.2f cycles (max=%d).\n",
+                  cInUse[s], (double)churn.sumCycs/churn.nrReqs, churn.maxCycs,
+                  (double)churn.sumLegacy/churn.nrReqs, churn.maxLegacy);
+    }
+
+    //-- Exhaust the port space. The next request must be held until a release
+    Stats full;
+    while (inUse.size() < cNrPorts) {
+        nrErr += allocate(myName, used, inUse, cursor, full);
+    }
+    ssTAi_GetFreePortReq.write(1);
+    for (int i=0; i<cMaxCycles; i++) {
+        step();
+    }
+    if (!ssTAi_GetFreePortRep.empty()) {
+        printError(myName, "Port #%d was assigned while all ports are in use.\n",
+                   ssTAi_GetFreePortRep.read().to_uint());
+        nrErr++;
+    }
+    int idx = inUse[rand() % inUse.size()];
+    ssSLc_ClosePortCmd.write(0x8000 + idx);
+    for (int i=0; (i<cMaxCycles) and ssTAi_GetFreePortRep.empty(); i++) {
+        step();
+    }
+    if (ssTAi_GetFreePortRep.empty() or (ssTAi_GetFreePortRep.read() != (0x8000 + idx))) {
+        printError(myName, "The held request did not get the released port #%d.\n", 0x8000 + idx);
+        nrErr++;
+    }
+
+    if (nrErr) {
+        printError(THIS_NAME, "###########################################################\n");
+        printError(THIS_NAME, "#### TEST BENCH FAILED : TOTAL NUMBER OF ERROR(S) = %2d ####\n", nrErr);
+        printError(THIS_NAME, "###########################################################\n");
+    }
+    else {
+        printInfo(THIS_NAME, "#############################################################\n");
+        printInfo(THIS_NAME, "####               SUCCESSFUL END OF TEST                ####\n");
+        printInfo(THIS_NAME, "#############################################################\n");
+    }
+
+    return nrErr;
+}
+
+/*! \} */
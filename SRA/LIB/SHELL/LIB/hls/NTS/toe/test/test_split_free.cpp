@@ -0,0 +1,350 @@
+/*
+ * Copyright 2016 -- 2021 IBM Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*******************************************************************************
+ * @file       : test_split_free.cpp
+ * @brief      : Wrap-around benchmark of the Rx and Tx memory writers.
+ *
+ * System:     : cloudFPGA
+ * Component   : Shell, Network Transport Stack (NTS)
+ * Language    : Vivado HLS
+ *
+ * @details
+ *  This testbench drives the Rx memory writer of [RXe] and the Tx memory writer
+ *  of [TAi] with a wrap-heavy traffic where every other segment runs past the
+ *  end of its TCP buffer. It emulates the data mover and the DRAM, checks that
+ *  every byte lands at its location in the memory slice of the session, and
+ *  reports the number of memory write commands ('DmCmd') and the number of
+ *  cycles per byte. The benchmark is run twice by 'make csimSplitFree': once
+ *  with the spill regions of TOE_SPILL_CFG (i.e. no split access), and once
+ *  without them (i.e. the writers split every segment which wraps around).
+ *
+ *  Usage: 'make csimSplitFree' from the 'toe' directory.
+ *
+ * \ingroup NTS_TOE
+ * \addtogroup NTS_TOE_TEST
+ * \{
+ *******************************************************************************/
+
+#include <cstdlib>
+#include <map>
+
+#include "../src/rx_engine/src/rx_engine.hpp"
+#include "../src/tx_app_interface/tx_app_interface.hpp"
+
+using namespace hls;
+using namespace std;
+
+#define THIS_NAME "TB"
+
+//---------------------------------------------------------
+//-- TESTBENCH GLOBAL VARIABLES
+//---------------------------------------------------------
+bool            gTraceEvent   = false;
+bool            gFatalError   = false;
+unsigned int    gSimCycCnt    = 0;
+
+//---------------------------------------------------------
+//-- TESTBENCH DEFINES
+//---------------------------------------------------------
+const int          cNrSessions = 4;
+const int          cNrSegs     = 2000;     // Segments written per writer
+const int          cRxMaxLen   = 1460;     // Max. bytes per Rx segment (i.e. MSS)
+const int          cTxMaxLen   = 8192;     // Max. bytes per APP write
+const int          cMaxCycles  = 4000000;
+
+//---------------------------------------------------------
+//-- PROCESSES UNDER TEST (not exported by their entities)
+//---------------------------------------------------------
+void pRxMemoryWriter(
+        stream<AxisApp>     &siTsd_Data,
+        stream<DmCmd>       &siFsm_MemWrCmd,
+        stream<DmCmd>       &soMEM_WrCmd,
+        stream<AxisApp>     &soMEM_WrData,
+        stream<FlagBool>    &soRan_SplitSeg);
+
+void pTxMemoryWriter(
+        stream<TcpAppData>  &siTAIF_Data,
+        stream<AppMemMeta>  &siSml_AppMeta,
+        stream<DmCmd>       &soMEM_WrCmd,
+        stream<AxisApp>     &soMEM_WrData);
+
+/*******************************************************************************
+ * @brief A segment written into the TCP buffer of a session.
+ *******************************************************************************/
+struct Segment {
+    int       sessId;
+    TcpBufAdr addr;    // TCP buffer address of the first byte
+    int       len;
+};
+
+/*******************************************************************************
+ * @brief The payload byte found at 'offset' in segment 'segId'.
+ *******************************************************************************/
+ap_uint<8> payloadByte(int segId, int offset)
+{
+    return (segId*13 + offset*7 + (offset >> 8)) & 0xFF;
+}
+
+/*******************************************************************************
+ * @brief Builds the segment 'segId' of a wrap-heavy traffic.
+ *
+ * @details
+ *  Every other segment starts within 'maxLen' bytes of the end of the buffer
+ *   and runs past it; the others start anywhere in the buffer.
+ *******************************************************************************/
+Segment buildSegment(int segId, int maxLen)
+{
+    Segment seg;
+    seg.sessId = segId % cNrSessions;
+    seg.len    = 1 + (rand() % maxLen);
+    if ((segId % 2) == 0 and (seg.len > 1)) {
+        seg.addr = (1 << TOE_WINDOW_BITS) - 1 - (rand() % (seg.len - 1));
+    }
+    else {
+        seg.addr = rand() & ((1 << TOE_WINDOW_BITS) - 1);
+    }
+    return seg;
+}
+
+/*******************************************************************************
+ * @brief The DRAM address of byte 'i' of a segment.
+ *
+ * @details
+ *  A segment which runs past the end of the buffer continues into the spill
+ *   region with TOE_SPILL_CFG, and at the beginning of the buffer otherwise.
+ *******************************************************************************/
+uint64_t byteAddr(uint64_t memBase, Segment &seg, int i)
+{
+    uint64_t sliceAddr = memBase + ((uint64_t)seg.sessId << TOE_SLICE_BITS);
+    if (TOE_SPILL_CFG) {
+        return sliceAddr + seg.addr + i;
+    }
+    return sliceAddr + ((seg.addr + i) & ((1 << TOE_WINDOW_BITS) - 1));
+}
+
+/*******************************************************************************
+ * @brief Emulates the data mover which writes into the DRAM.
+ *
+ * @param[in]     myName   The name of the caller.
+ * @param[in]     siWrCmd  The memory write commands.
+ * @param[in]     siWrData The memory write data.
+ * @param[in,out] dram     The bytes of the emulated DRAM.
+ * @param[in,out] cmd      The command being processed (with the bytes left).
+ * @param[in,out] nrCmds   The number of commands received so far.
+ * @param[in,out] nrBytes  The number of bytes written so far.
+ *
+ * @return the number of errors.
+ *******************************************************************************/
+int emulateDataMover(const char *myName, stream<DmCmd> &siWrCmd, stream<AxisApp> &siWrData,
+                     map<uint64_t, ap_uint<8> > &dram, DmCmd &cmd, int &nrCmds, int &nrBytes)
+{
+    int nrErr = 0;
+    if ((cmd.btt == 0) and !siWrCmd.empty()) {
+        cmd = siWrCmd.read();
+        nrCmds++;
+    }
+    else if ((cmd.btt != 0) and !siWrData.empty()) {
+        AxisApp chunk = siWrData.read();
+        for (int lane=0; lane<ARW/8; lane++) {
+            if (chunk.getLE_TKeep()[lane]) {
+                dram[cmd.saddr.to_uint64()] = chunk.getLE_TData(8*lane+7, 8*lane);
+                cmd.saddr++;
+                cmd.btt--;
+                nrBytes++;
+            }
+        }
+        if (chunk.getTLast() != (cmd.btt == 0)) {
+            printError(myName, "The TLAST of a memory write does not match the length of its command.\n");
+            nrErr++;
+        }
+    }
+    return nrErr;
+}
+
+/*******************************************************************************
+ * @brief Streams the payload of a segment as a sequence of AxisApp chunks.
+ *******************************************************************************/
+void writeSegData(stream<AxisApp> &soData, int segId, int len)
+{
+    for (int i=0; i<len; i+=ARW/8) {
+        AxisApp chunk(0, 0, 0);
+        for (int lane=0; (lane<ARW/8) and (i+lane<len); lane++) {
+            chunk.setLE_TData(payloadByte(segId, i+lane), 8*lane+7, 8*lane);
+            chunk.setLE_TKeep(1, lane, lane);
+        }
+        if (i+ARW/8 >= len) {
+            chunk.setLE_TLast(TLAST);
+        }
+        soData.write(chunk);
+    }
+}
+
+/*******************************************************************************
+ * @brief Checks the bytes of the segments in the emulated DRAM.
+ *******************************************************************************/
+int checkSegments(const char *myName, uint64_t memBase, Segment *segs,
+                  map<uint64_t, ap_uint<8> > &dram)
+{
+    int nrErr = 0;
+    //-- The segments overlap: Only the last write of every byte is checked
+    map<uint64_t, ap_uint<8> > expected;
+    for (int s=0; s<cNrSegs; s++) {
+        for (int i=0; i<segs[s].len; i++) {
+            expected[byteAddr(memBase, segs[s], i)] = payloadByte(s, i);
+        }
+    }
+    for (map<uint64_t, ap_uint<8> >::iterator it=expected.begin(); it!=expected.end(); ++it) {
+        if (dram[it->first] != it->second) {
+            if (nrErr < 10) {
+                printError(myName, "Wrong byte at 0x%8.8llx.\n", (unsigned long long)it->first);
+            }
+            nrErr++;
+        }
+    }
+    if (dram.size() != expected.size()) {
+        printError(myName, "%zu bytes were written outside of the segments.\n", dram.size() - expected.size());
+        nrErr++;
+    }
+    return nrErr;
+}
+
+/*******************************************************************************
+ * @brief Runs the wrap-heavy traffic through the Rx memory writer.
+ *******************************************************************************/
+int runRx()
+{
+    const char *myName = concat3(THIS_NAME, "/", "Rx");
+
+    stream<AxisApp>   ssData("ssData");
+    stream<DmCmd>     ssWrCmd("ssWrCmd");
+    stream<DmCmd>     ssMemWrCmd("ssMemWrCmd");
+    stream<AxisApp>   ssMemWrData("ssMemWrData");
+    stream<FlagBool>  ssSplitSeg("ssSplitSeg");
+
+    map<uint64_t, ap_uint<8> > dram;
+    static Segment segs[cNrSegs];
+    int nrWraps=0, nrBytes=0, nrSplits=0, nrCmds=0, nrWrBytes=0, nrErr=0;
+    DmCmd cmd(0, 0);
+
+    for (int s=0; s<cNrSegs; s++) {
+        segs[s] = buildSegment(s, cRxMaxLen);
+        RxMemPtr memSegAddr = TOE_RX_MEMORY_BASE;
+        memSegAddr(TOE_RX_MEMORY_BITS-1, TOE_SLICE_BITS) = segs[s].sessId;
+        memSegAddr(TOE_WINDOW_BITS-1, 0) = segs[s].addr;
+        ssWrCmd.write(DmCmd(memSegAddr, segs[s].len));
+        writeSegData(ssData, s, segs[s].len);
+        nrWraps += ((segs[s].addr + segs[s].len) > (1 << TOE_WINDOW_BITS)) ? 1 : 0;
+        nrBytes += segs[s].len;
+    }
+
+    int cyc;
+    for (cyc=0; (cyc<cMaxCycles) and (nrWrBytes<nrBytes); cyc++) {
+        pRxMemoryWriter(ssData, ssWrCmd, ssMemWrCmd, ssMemWrData, ssSplitSeg);
+        nrErr += emulateDataMover(myName, ssMemWrCmd, ssMemWrData, dram, cmd, nrCmds, nrWrBytes);
+        if (!ssSplitSeg.empty() and ssSplitSeg.read()) {
+            nrSplits++;
+        }
+        gSimCycCnt++;
+    }
+    nrErr += checkSegments(myName, TOE_RX_MEMORY_BASE, segs, dram);
+    if (nrCmds != (cNrSegs + nrSplits)) {
+        printError(myName, "Received %d memory write commands instead of %d.\n", nrCmds, cNrSegs + nrSplits);
+        nrErr++;
+    }
+    if (nrSplits != (TOE_SPILL_CFG ? 0 : nrWraps)) {
+        printError(myName, "%d segments were split instead of %d.\n", nrSplits, TOE_SPILL_CFG ? 0 : nrWraps);
+        nrErr++;
+    }
+    printInfo(myName, "Segments=%d (%d wrapping) - Bytes=%d - DmCmds=%d (%4.2f per segment) - Cycles=%d (%5.3f per byte).\n",
+              cNrSegs, nrWraps, nrBytes, nrCmds, (double)nrCmds/cNrSegs, cyc, (double)cyc/nrBytes);
+    return nrErr;
+}
+
+/*******************************************************************************
+ * @brief Runs the wrap-heavy traffic through the Tx memory writer.
+ *******************************************************************************/
+int runTx()
+{
+    const char *myName = concat3(THIS_NAME, "/", "Tx");
+
+    stream<TcpAppData> ssData("ssData");
+    stream<AppMemMeta> ssAppMeta("ssAppMeta");
+    stream<DmCmd>      ssMemWrCmd("ssMemWrCmd");
+    stream<AxisApp>    ssMemWrData("ssMemWrData");
+
+    map<uint64_t, ap_uint<8> > dram;
+    static Segment segs[cNrSegs];
+    int nrWraps=0, nrBytes=0, nrCmds=0, nrWrBytes=0, nrErr=0;
+    DmCmd cmd(0, 0);
+
+    for (int s=0; s<cNrSegs; s++) {
+        segs[s] = buildSegment(s, cTxMaxLen);
+        ssAppMeta.write(AppMemMeta(segs[s].sessId, segs[s].addr, segs[s].len));
+        writeSegData(ssData, s, segs[s].len);
+        nrWraps += ((segs[s].addr + segs[s].len) > (1 << TOE_WINDOW_BITS)) ? 1 : 0;
+        nrBytes += segs[s].len;
+    }
+
+    int cyc;
+    for (cyc=0; (cyc<cMaxCycles) and (nrWrBytes<nrBytes); cyc++) {
+        pTxMemoryWriter(ssData, ssAppMeta, ssMemWrCmd, ssMemWrData);
+        nrErr += emulateDataMover(myName, ssMemWrCmd, ssMemWrData, dram, cmd, nrCmds, nrWrBytes);
+        gSimCycCnt++;
+    }
+    nrErr += checkSegments(myName, TOE_TX_MEMORY_BASE, segs, dram);
+    if (nrCmds != (cNrSegs + (TOE_SPILL_CFG ? 0 : nrWraps))) {
+        printError(myName, "Received %d memory write commands instead of %d.\n",
+                   nrCmds, cNrSegs + (TOE_SPILL_CFG ? 0 : nrWraps));
+        nrErr++;
+    }
+    printInfo(myName, "Segments=%d (%d wrapping) - Bytes=%d - DmCmds=%d (%4.2f per segment) - Cycles=%d (%5.3f per byte).\n",
+              cNrSegs, nrWraps, nrBytes, nrCmds, (double)nrCmds/cNrSegs, cyc, (double)cyc/nrBytes);
+    return nrErr;
+}
+
+/*******************************************************************************
+ * @brief Main function.
+ *******************************************************************************/
+int main(int argc, char* argv[]) {
+
+    int nrErr = 0;
+
+    printInfo(THIS_NAME, "############################################################################\n");
+    printInfo(THIS_NAME, "## TESTBENCH 'test_split_free' STARTS HERE                                ##\n");
+    printInfo(THIS_NAME, "############################################################################\n");
+    printInfo(THIS_NAME, "Spill regions are %s (TOE_SPILL_CFG=%d).\n",
+              TOE_SPILL_CFG ? "enabled" : "disabled", TOE_SPILL_CFG);
+
+    srand(17);
+    nrErr += runRx();
+    nrErr += runTx();
+
+    if (nrErr) {
+        printError(THIS_NAME, "###########################################################\n");
+        printError(THIS_NAME, "#### TEST BENCH FAILED : TOTAL NUMBER OF ERROR(S) = %2d ####\n", nrErr);
+        printError(THIS_NAME, "###########################################################\n");
+    }
+    else {
+        printInfo(THIS_NAME, "#############################################################\n");
+        printInfo(THIS_NAME, "####               SUCCESSFUL END OF TEST                ####\n");
+        printInfo(THIS_NAME, "#############################################################\n");
+    }
+
+    return nrErr;
+}
+
+/*! \} */
@@ -0,0 +1,269 @@
+/*
+ * Copyright 2016 -- 2021 IBM Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*******************************************************************************
+ * @file       : test_syn_flood.cpp
+ * @brief      : Testbench of the TOE under a SYN flood.
+ *
+ * System:     : cloudFPGA
+ * Component   : Shell, Network Transport Stack (NTS)
+ * Language    : Vivado HLS
+ *
+ * @details
+ *  This testbench drives the whole TOE with a flood of SYN segments from
+ *  spoofed sockets (i.e. that never answer the SYN-ACK), interleaved with the
+ *  connections of a few real clients to the same listening port. A real client
+ *  completes the three-way handshake with the sequence number it receives in
+ *  the SYN-ACK, and sends a segment of data right after its ACK. A connection
+ *  is successful when its data is notified to the application. The CAM and
+ *  the data mover are emulated by the harness of 'test_toe_harness.hpp'. The
+ *  emulated CAM only holds one entry per real client, such that the flood
+ *  makes it fail some of the insertions. The session IDs of these failed insertions must be released,
+ *  i.e. the number of live sessions must match the content of the CAM at the
+ *  end of the test. The testbench reports the number of successful connections
+ *  along with the peak number of sessions.
+ *  The benchmark is run twice by 'make csimSynFlood': once with the default
+ *  passive open, where every SYN allocates a session, and once with
+ *  TOE_SYN_COOKIE_CFG, where all the real connections must succeed and no
+ *  session may be allocated by the flood.
+ *
+ *  Usage: 'make csimSynFlood' from the 'toe' directory.
+ *
+ * \ingroup NTS_TOE
+ * \addtogroup NTS_TOE_TEST
+ * \{
+ *******************************************************************************/
+
+#include <cstdlib>
+#include <deque>
+#include <vector>
+
+#include "test_tcp_packet.hpp"
+#include "test_toe_harness.hpp"
+
+using namespace hls;
+using namespace std;
+
+#define THIS_NAME "TB"
+
+//---------------------------------------------------------
+//-- TESTBENCH GLOBAL VARIABLES
+//---------------------------------------------------------
+bool            gTraceEvent   = false;
+bool            gFatalError   = false;
+unsigned int    gSimCycCnt    = 0;
+
+//---------------------------------------------------------
+//-- TESTBENCH DEFINES
+//---------------------------------------------------------
+const int       cNrClients   = TOE_MAX_SESSIONS - 2;  // The real clients
+const int       cCamCapacity = cNrClients;  // Entries of the emulated CAM
+const int       cFloodRate   = 32;       // Spoofed SYNs per real connection
+const int       cDataLen     = 16;       // Bytes sent by a real client
+const int       cGapCycles   = 20;       // Idle cycles between two packets
+const int       cTimeout     = 20000;    // Max. cycles from a SYN to the data
+const int       cMaxCycles   = 400000;
+const Ip4Addr   cToeIpAddr   = 0x0A0CC832;  // 10.12.200.50
+const TcpPort   cLsnPort     = 0x2263;
+const Ip4Addr   cClientIp    = 0x0A0CC801;  // 10.12.200.1
+const TcpPort   cClientPort  = 0x9000;
+const TcpSeqNum cClientIsn   = 0x10000000;
+
+enum CliState { CLI_IDLE=0, CLI_SYN_SENT, CLI_DATA_SENT, CLI_DONE, CLI_FAILED };
+
+/*******************************************************************************
+ * @brief The state of a real client.
+ *******************************************************************************/
+struct Client {
+    Ip4Addr     ip;
+    TcpPort     port;
+    TcpSeqNum   isn;
+    CliState    state;
+    unsigned    synCyc;
+    Client() {}
+    Client(Ip4Addr ip, TcpPort port, TcpSeqNum isn) :
+        ip(ip), port(port), isn(isn), state(CLI_IDLE), synCyc(0) {}
+};
+
+/*******************************************************************************
+ * @brief Main function.
+ *******************************************************************************/
+int main(int argc, char* argv[]) {
+
+    const char *myName = concat3(THIS_NAME, "/", "SYN");
+
+    //-- The TOE with its emulated CAM and data mover
+    ToeHarness                  tb(cToeIpAddr, cCamCapacity);
+
+    //-- Emulated clients
+    vector<Client>              clients;
+    deque<vector<AxisIp4> >     txQueue;   // The packets of the real clients
+    ToeSegment                  seg;
+    bool lsnSent=false, listening=false;
+    int  nrSyns=0, nrSynAcks=0, nrDone=0, nrFailed=0, nrErr=0;
+    int  nextClient=0, gap=0;
+
+    printInfo(THIS_NAME, "############################################################################\n");
+    printInfo(THIS_NAME, "## TESTBENCH 'test_syn_flood' STARTS HERE                                 ##\n");
+    printInfo(THIS_NAME, "############################################################################\n");
+    printInfo(THIS_NAME, "SYN cookies are %s - Sessions=%d - Real clients=%d - Spoofed SYNs per real connection=%d.\n",
+              TOE_SYN_COOKIE_CFG ? "enabled" : "disabled", TOE_MAX_SESSIONS, cNrClients, cFloodRate);
+
+    srand(24);
+    for (int c=0; c<cNrClients; c++) {
+        clients.push_back(Client(cClientIp, cClientPort + c, cClientIsn + (c << 20)));
+    }
+
+    for (gSimCycCnt=0; gSimCycCnt<cMaxCycles; gSimCycCnt++) {
+        //-- OPEN THE LISTENING PORT ------------------------------------------
+        if (tb.sNTS_Ready and !lsnSent) {
+            tb.ssTAIF_LsnReq.write(cLsnPort);
+            lsnSent = true;
+        }
+
+        //-- FEED THE FLOOD AND THE REAL CLIENTS ------------------------------
+        if (listening and (gap == 0)) {
+            if (tb.ipRxIdle()) {
+                if (!txQueue.empty()) {
+                    tb.sendPacket(txQueue.front());
+                    txQueue.pop_front();
+                }
+                else if (nextClient < cNrClients) {
+                    if ((nrSyns + 1) % (cFloodRate + 1) != 0) {
+                        Ip4Addr   sa = 0x0B000000 | (rand() & 0x00FFFFFF);
+                        TcpPort   sp = 1024 + (rand() % 0x7000);
+                        tb.sendPacket(buildTcpPacket(sa, cToeIpAddr, sp, cLsnPort, rand(), 0, 0x02, 0));
+                    }
+                    else {
+                        Client &cli = clients[nextClient++];
+                        tb.sendPacket(buildTcpPacket(cli.ip, cToeIpAddr, cli.port, cLsnPort, cli.isn, 0, 0x02, 0));
+                        cli.state  = CLI_SYN_SENT;
+                        cli.synCyc = gSimCycCnt;
+                    }
+                    nrSyns++;
+                }
+            }
+            if (tb.feedIpRx() and tb.ipRxIdle()) {
+                gap = cGapCycles;
+            }
+        }
+        else if (gap != 0) {
+            gap--;
+        }
+
+        //-- RUN THE TOE ------------------------------------------------------
+        tb.run();
+
+        //-- EMULATE THE CLIENTS ----------------------------------------------
+        if (tb.recvSegment(seg)) {
+            bool synAck = ((seg.flags & 0x12) == 0x12);
+            if (synAck) {
+                nrSynAcks++;
+            }
+            for (int c=0; c<cNrClients; c++) {
+                Client &cli = clients[c];
+                if (synAck and (seg.dstAddr == cli.ip) and (seg.dstPort == cli.port) and
+                    (cli.state == CLI_SYN_SENT)) {
+                    if (seg.ackNum != cli.isn + 1) {
+                        printError(myName, "The SYN-ACK to client #%d acknowledges 0x%8.8X instead of 0x%8.8X.\n",
+                                   c, seg.ackNum.to_uint(), (cli.isn + 1).to_uint());
+                        nrErr++;
+                    }
+                    //-- Complete the handshake and send the data right after
+                    txQueue.push_back(buildTcpPacket(cli.ip, cToeIpAddr, cli.port, cLsnPort,
+                                                     cli.isn+1, seg.seqNum+1, 0x10, 0));
+                    txQueue.push_back(buildTcpPacket(cli.ip, cToeIpAddr, cli.port, cLsnPort,
+                                                     cli.isn+1, seg.seqNum+1, 0x18, cDataLen));
+                    cli.state = CLI_DATA_SENT;
+                }
+            }
+        }
+        for (int c=0; c<cNrClients; c++) {
+            Client &cli = clients[c];
+            if (((cli.state == CLI_SYN_SENT) or (cli.state == CLI_DATA_SENT)) and
+                (gSimCycCnt - cli.synCyc > cTimeout)) {
+                cli.state = CLI_FAILED;
+                nrFailed++;
+            }
+        }
+
+        //-- EMULATE THE APPLICATION ------------------------------------------
+        if (!tb.ssTAIF_LsnRep.empty()) {
+            listening = tb.ssTAIF_LsnRep.read();
+            if (!listening) {
+                printError(myName, "Cannot listen on port #%d.\n", cLsnPort.to_uint());
+                nrErr++;
+                break;
+            }
+        }
+        if (!tb.ssTAIF_Notif.empty()) {
+            TcpAppNotif notif = tb.ssTAIF_Notif.read();
+            for (int c=0; c<cNrClients; c++) {
+                Client &cli = clients[c];
+                if ((notif.tcpDatLen == cDataLen) and (notif.tcpSrcPort == cli.port) and
+                    (cli.state == CLI_DATA_SENT)) {
+                    cli.state = CLI_DONE;
+                    nrDone++;
+                }
+            }
+        }
+
+        if ((nextClient == cNrClients) and (nrDone + nrFailed == cNrClients)) {
+            break;
+        }
+    }
+
+    printInfo(myName, "Real connections established = %d/%d - Spoofed SYNs = %d - SYN-ACKs sent = %d.\n",
+              nrDone, cNrClients, nrSyns - cNrClients, nrSynAcks);
+    printInfo(myName, "Sessions: live = %d - peak = %d (out of %d) - Failed CAM insertions = %d.\n",
+              tb.sssRegCnt(15, 0).to_int(), tb.sssRegCnt(31, 16).to_int(), TOE_MAX_SESSIONS, tb.nrInsFail);
+
+    if (nrDone + nrFailed != cNrClients) {
+        printError(myName, "The test did not complete within %d cycles.\n", cMaxCycles);
+        nrErr++;
+    }
+    if (tb.sssRegCnt(15, 0) != tb.cam.size()) {
+        printError(myName, "The TOE holds %d live sessions while the CAM holds %d entries.\n",
+                   tb.sssRegCnt(15, 0).to_int(), (int)tb.cam.size());
+        nrErr++;
+    }
+    if (TOE_SYN_COOKIE_CFG) {
+        //-- The flood must neither block a real connection nor take a session
+        if (nrDone != cNrClients) {
+            printError(myName, "Only %d real connections out of %d were established.\n", nrDone, cNrClients);
+            nrErr++;
+        }
+        if (tb.sssRegCnt(31, 16) > cNrClients) {
+            printError(myName, "The flood allocated %d sessions.\n", tb.sssRegCnt(31, 16).to_int() - cNrClients);
+            nrErr++;
+        }
+    }
+
+    if (nrErr) {
+        printError(THIS_NAME, "###########################################################\n");
+        printError(THIS_NAME, "#### TEST BENCH FAILED : TOTAL NUMBER OF ERROR(S) = %2d ####\n", nrErr);
+        printError(THIS_NAME, "###########################################################\n");
+    }
+    else {
+        printInfo(THIS_NAME, "#############################################################\n");
+        printInfo(THIS_NAME, "####               SUCCESSFUL END OF TEST                ####\n");
+        printInfo(THIS_NAME, "#############################################################\n");
+    }
+
+    return nrErr;
+}
+
+/*! \} */
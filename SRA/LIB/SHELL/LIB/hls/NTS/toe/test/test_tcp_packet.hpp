@@ -0,0 +1,107 @@
+/*
+ * Copyright 2016 -- 2021 IBM Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*******************************************************************************
+ * @file       : test_tcp_packet.hpp
+ * @brief      : IPv4/TCP packet builder shared by the benchmarks of the TOE.
+ *
+ * System:     : cloudFPGA
+ * Component   : Shell, Network Transport Stack (NTS)
+ * Language    : Vivado HLS
+ *
+ * \ingroup NTS_TOE
+ * \addtogroup NTS_TOE_TEST
+ * \{
+ *******************************************************************************/
+
+#ifndef _TEST_TCP_PACKET_H_
+#define _TEST_TCP_PACKET_H_
+
+#include <vector>
+
+#include "../../../NTS/SimIp4Packet.hpp"
+
+/*******************************************************************************
+ * @brief The byte found at offset 'off' of the byte stream sent by a client.
+ *******************************************************************************/
+inline ap_uint<8> tcpStreamByte(int off)
+{
+    return (off*7 + (off >> 8) + 3) & 0xFF;
+}
+
+/*******************************************************************************
+ * @brief Builds an IPv4/TCP packet sent by a client to the TOE.
+ *
+ * @param[in]  sa      The IPv4 source address.
+ * @param[in]  da      The IPv4 destination address.
+ * @param[in]  sp      The TCP source port.
+ * @param[in]  dp      The TCP destination port.
+ * @param[in]  seqNum  The sequence number.
+ * @param[in]  ackNum  The acknowledgment number.
+ * @param[in]  flags   The TCP control bits (.i.e, [ACK|PSH|RST|SYN|FIN]).
+ * @param[in]  len     The length of the payload.
+ * @param[in]  off     The offset of the payload in the byte stream of the
+ *                      client (see tcpStreamByte()).
+ *
+ * @return the AxisIp4 chunks of the packet.
+ *
+ * @details
+ *  A SYN gets an MSS option of 1460 bytes, and the window is always 0xFFFF.
+ *   Both the IPv4 header and the TCP checksums are computed.
+ *******************************************************************************/
+inline std::vector<AxisIp4> buildTcpPacket(Ip4Addr sa, Ip4Addr da, TcpPort sp, TcpPort dp,
+                                           TcpSeqNum seqNum, TcpAckNum ackNum,
+                                           ap_uint<8> flags, int len, int off=0)
+{
+    bool syn    = (flags & 0x02);
+    int  hdrLen = TCP_HEADER_LEN + (syn ? 4 : 0);
+
+    SimIp4Packet ipPkt(IP4_HEADER_LEN + hdrLen + len);
+    ipPkt.setIpProtocol(IP4_PROT_TCP);
+    ipPkt.setIpSourceAddress(sa);
+    ipPkt.setIpDestinationAddress(da);
+    ipPkt.setTcpSourcePort(sp);
+    ipPkt.setTcpDestinationPort(dp);
+    ipPkt.setTcpSequenceNumber(seqNum);
+    ipPkt.setTcpAcknowledgeNumber(ackNum);
+    ipPkt.setTcpDataOffset(hdrLen/4);
+    ipPkt.setTcpControlFin(flags[0]);
+    ipPkt.setTcpControlSyn(flags[1]);
+    ipPkt.setTcpControlRst(flags[2]);
+    ipPkt.setTcpControlPsh(flags[3]);
+    ipPkt.setTcpControlAck(flags[4]);
+    ipPkt.setTcpWindow(0xFFFF);
+    if (syn) {
+        ipPkt.setTcpOptionKind(0x02);
+        ipPkt.setTcpOptionLen(0x04);
+        ipPkt.setTcpOptionMss(1460);
+    }
+    for (int i=0; i<len; i++) {
+        ipPkt.setTcpDataByte(i, tcpStreamByte(off+i));
+    }
+    ipPkt.reCalculateIpHeaderChecksum();
+    ipPkt.tcpRecalculateChecksum();
+
+    std::vector<AxisIp4> pkt;
+    while (ipPkt.size() != 0) {
+        pkt.push_back(ipPkt.pullChunk());
+    }
+    return pkt;
+}
+
+#endif
+
+/*! \} */
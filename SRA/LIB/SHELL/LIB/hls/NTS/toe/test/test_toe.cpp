@@ -544,6 +544,9 @@ void pEmulateTxBufMem(
  *  Examples:
  *    G PARAM SimCycles     <NUM>
  *    G PARAM LocalSocket   <ADDR> <PORT>
+ *    G PARAM LinkDelay     <NUM>
+ *    G PARAM LinkLoss      <NUM>
+ *    G PARAM LinkMark      <NUM>
  *******************************************************************************/
 bool setGlobalParameters(const char *callerName, unsigned int startupDelay, ifstream &inputFile)
 {
@@ -638,6 +641,21 @@ bool setGlobalParameters(const char *callerName, unsigned int startupDelay, ifst
                         printInfo(callerName, "Disabling the sorting of the 'soTAIF.gold' file.\n");
                     }
                 }
+                else if (stringVector[2] == "LinkDelay") {
+                    // Delay the TCP/IP packets from TOE-to-IPTX by <NUM> cycles
+                    gLinkDelay = atoi(stringVector[3].c_str());
+                    printInfo(myName, "Emulating a link delay of %d cycles on the IPTX interface.\n", gLinkDelay);
+                }
+                else if (stringVector[2] == "LinkLoss") {
+                    // Drop every <NUM>th TCP data segment from TOE-to-IPTX
+                    gLinkLoss = atoi(stringVector[3].c_str());
+                    printInfo(myName, "Emulating the loss of every %dth data segment on the IPTX interface.\n", gLinkLoss);
+                }
+                else if (stringVector[2] == "LinkMark") {
+                    // Mark every <NUM>th TCP data segment from TOE-to-IPTX with ECN-CE
+                    gLinkMark = atoi(stringVector[3].c_str());
+                    printInfo(myName, "Emulating an ECN-CE mark on every %dth data segment on the IPTX interface.\n", gLinkMark);
+                }
                 else if (stringVector[2] == "FpgaServerSocket") {  // DEPRECATED
                     printFatal(myName, "The global parameter \'FpgaServerSockett\' is not supported anymore.\n\tPLEASE UPDATE YOUR TEST VECTOR FILE ACCORDINGLY.\n");
                 }
@@ -1241,6 +1259,9 @@ void pIPRX(
  * @param[in]  sessAckList    A ref to an associative container which holds the
  *                             sessions as socket pair associations.
  * @param[out] ipRxPacketizer A ref to dequeue w/ packets for IPRX.
+ * @param[out] isInOrder      Tells if the segment is in sequence.
+ * @param[out] reassembled    A ref to the data (as hex strings) of the out-of-
+ *                             order segments which got back in sequence.
  *
  * @return true if an ACK was found [FIXME].
  *
@@ -1248,19 +1269,32 @@ void pIPRX(
  *  Looks for an ACK in the IP packet. If found, stores the 'ackNumber' from
  *  that packet into the 'seqNumber' deque of the Rx input stream and clears
  *  the deque containing the IP Tx packet.
+ *  When the link is lossy (see 'LinkLoss'), a data segment which is not in
+ *   sequence does not advance the 'ackNumber' of the session and is answered
+ *   with a duplicate ACK. Such a segment is kept aside, like a TCP receiver
+ *   would do, until the missing data arrives and fills the hole.
+ *  A segment received with an ECN-CE mark (see 'LinkMark') is answered with
+ *   an ACK which has its ECE bit set, like a DCTCP receiver would do.
  *******************************************************************************/
 bool pIPTX_Parse(
         SimIp4Packet                &ipTxPacket,
         map<SocketPair, TcpAckNum>  &sessAckList,
-        deque<SimIp4Packet>         &ipRxPacketizer)
+        deque<SimIp4Packet>         &ipRxPacketizer,
+        bool                        &isInOrder,
+        deque<string>               &reassembled)
 {
     bool        returnValue    = false;
     bool        isFinAck       = false;
     bool        isSynAck       = false;
     static int  currAckNum     = 0;
+    static map<SocketPair, map<unsigned int, SimIp4Packet> > parse_oooSegs;
+    static map<SocketPair, int>  parse_winShift;  // Window scale shift in use per session
+    static map<SocketPair, bool> parse_sackOk;    // SACK is permitted per session
 
     const char *myName = concat3(THIS_NAME, "/", "IPTX/Parse");
 
+    isInOrder = true;
+
     if (DEBUG_LEVEL & TRACE_IPTX) {
         ipTxPacket.printHdr(myName);
     }
@@ -1283,8 +1317,23 @@ bool pIPTX_Parse(
         // Set the SEQ to zero (for simplicity) and ACK to (received SEQ+1)
         synAckPacket.setTcpSequenceNumber(0);
         synAckPacket.setTcpAcknowledgeNumber(ipTxPacket.getTcpSequenceNumber() + 1);
-        // Set the ACK bit and Recalculate the Checksum
+        // Set the ACK bit
         synAckPacket.setTcpControlAck(1);
+        // Reply with our own window scale if TOE offered one (RFC-7323)
+        SocketPair sockPair(SockAddr(ipTxPacket.getIpDestinationAddress(),
+                                     ipTxPacket.getTcpDestinationPort()),
+                            SockAddr(ipTxPacket.getIpSourceAddress(),
+                                     ipTxPacket.getTcpSourcePort()));
+        if (ipTxPacket.getTcpOptionOffset(TCP_OPT_KIND_WSS) != -1) {
+            synAckPacket.setTcpOptionWss(TB_RCV_WIN_SHIFT);
+            parse_winShift[sockPair] = TB_RCV_WIN_SHIFT;
+        }
+        else {
+            parse_winShift[sockPair] = 0;
+        }
+        // The cloned options echo the SACK-Permitted option if TOE offered one (RFC-2018)
+        parse_sackOk[sockPair] = (ipTxPacket.getTcpOptionOffset(TCP_OPT_KIND_SACK) != -1);
+        // Recalculate the Checksum
         int newTcpCsum = synAckPacket.tcpRecalculateChecksum();
         synAckPacket.setTcpChecksum(newTcpCsum);
         // Add the created SYN+ACK packet to the ipRxPacketizer
@@ -1344,16 +1393,47 @@ bool pIPTX_Parse(
              // [FIXME - MUST CREATE AND INCREMENT A GLOBAL ERROR COUNTER]
         }
         else if (ip4PktLen >= 40) {
-            // Decrement by 40B (.i.e, 20B of IP Header + 20B of TCP Header
-            // [FIXME - What if we add options???]
-            // [TODO - Print the TCP options ]
-            ip4PktLen -= 40;
+            // Only keep the length of the TCP payload (.i.e, w/o the IP and TCP headers nor options)
+            ip4PktLen = ipTxPacket.sizeOfTcpData();
             nextAckNum += ip4PktLen;
         }
 
-        // Update the Session List with the new sequence number
-        sessAckList[sockPair] = nextAckNum;
-        if (ipTxPacket.isFIN()) {
+        if (gLinkLoss and !ipTxPacket.isSYN() and
+            ((ipTxPacket.sizeOfTcpData() > 0) or ipTxPacket.isFIN()) and
+            (sessAckList.find(sockPair) != sessAckList.end()) and
+            (ipTxPacket.getTcpSequenceNumber() != sessAckList[sockPair])) {
+            // Out-of-sequence segment. Keep the current ACK number.
+            isInOrder = false;
+            if (((int)(ipTxPacket.getTcpSequenceNumber() - sessAckList[sockPair]) > 0) and
+                !ipTxPacket.isFIN()) {
+                // Keep it until the hole gets filled
+                parse_oooSegs[sockPair][ipTxPacket.getTcpSequenceNumber()] = ipTxPacket;
+            }
+            nextAckNum = sessAckList[sockPair];
+            if (DEBUG_LEVEL & TRACE_IPTX) {
+                printInfo(myName, "Got an out-of-sequence segment from TOE. Replying with a duplicate ACK.\n");
+            }
+        }
+        else {
+            // Pull the out-of-order data which is now in sequence
+            //  FYI - A retransmitted segment may overlap with the kept ones.
+            if (gLinkLoss and (parse_oooSegs.find(sockPair) != parse_oooSegs.end())) {
+                map<unsigned int, SimIp4Packet> &oooSegs = parse_oooSegs[sockPair];
+                while (!oooSegs.empty() and ((int)(oooSegs.begin()->first - nextAckNum) <= 0)) {
+                    SimIp4Packet &oooPacket = oooSegs.begin()->second;
+                    int newBytes = (int)(oooSegs.begin()->first + oooPacket.sizeOfTcpData() - nextAckNum);
+                    if (newBytes > 0) {
+                        int offset = oooPacket.sizeOfTcpData() - newBytes;
+                        reassembled.push_back(oooPacket.getTcpData().substr(2*offset));
+                        nextAckNum += newBytes;
+                    }
+                    oooSegs.erase(oooSegs.begin());
+                }
+            }
+            // Update the Session List with the new sequence number
+            sessAckList[sockPair] = nextAckNum;
+        }
+        if (ipTxPacket.isFIN() and isInOrder) {
             //------------------------------------------------
             // This is an ACK+FIN segment.
             //------------------------------------------------
@@ -1379,8 +1459,34 @@ bool pIPTX_Parse(
             // ACK segment contains more data and is not a FIN+ACK.
             // Reply with an empty ACK packet.
             //--------------------------------------------------------
-            SimIp4Packet ackPacket(40);  // [FIXME - What if we generate options ???]
-            // [TODO - Add TCP Window option]
+            // Report the out-of-order segments kept by the TB with SACK blocks (RFC-2018)
+            TcpSeqNum sackLeft[TOE_MAX_OOO_BLOCKS];
+            TcpSeqNum sackRight[TOE_MAX_OOO_BLOCKS];
+            int       sackCnt = 0;
+            if (!isInOrder and parse_sackOk[sockPair] and
+                (parse_oooSegs.find(sockPair) != parse_oooSegs.end())) {
+                map<unsigned int, SimIp4Packet> &oooSegs = parse_oooSegs[sockPair];
+                for (map<unsigned int, SimIp4Packet>::iterator it=oooSegs.begin(); it!=oooSegs.end(); ++it) {
+                    TcpSeqNum left  = it->first;
+                    TcpSeqNum right = it->first + it->second.sizeOfTcpData();
+                    if ((sackCnt != 0) and ((int)(left - sackRight[sackCnt-1]) <= 0)) {
+                        // Contiguous or overlapping segment. Extend the current block.
+                        if ((int)(right - sackRight[sackCnt-1]) > 0) {
+                            sackRight[sackCnt-1] = right;
+                        }
+                    }
+                    else if (sackCnt < TOE_MAX_OOO_BLOCKS) {
+                        sackLeft[sackCnt]  = left;
+                        sackRight[sackCnt] = right;
+                        sackCnt++;
+                    }
+                }
+            }
+            SimIp4Packet ackPacket(40 + ((sackCnt != 0) ? (4 + 8*sackCnt) : 0));
+            if (sackCnt != 0) {
+                ackPacket.setTcpDataOffset(5 + 1 + 2*sackCnt);
+                ackPacket.setTcpOptionSack(sackCnt, sackLeft, sackRight);
+            }
             // Set IP protocol field to TCP
             ackPacket.setIpProtocol(IP4_PROT_TCP);
             // Swap IP_SA and IP_DA
@@ -1395,8 +1501,12 @@ bool pIPTX_Parse(
             // Set the ACK bit and un-set the FIN bit
             ackPacket.setTcpControlAck(1);
             ackPacket.setTcpControlFin(0);
-            // Set the Window size
-            ackPacket.setTcpWindow(7777);
+            // Echo the Congestion Experienced codepoint
+            if ((ipTxPacket.getIpTypeOfService() & 0x3) == 0x3) {
+                ackPacket.setTcpControlEce(1);
+            }
+            // Set the Window size (scaled down if window scaling is in use)
+            ackPacket.setTcpWindow(TB_RCV_WINDOW >> parse_winShift[sockPair]);
             // Recalculate the Checksum
             int newTcpCsum = ackPacket.tcpRecalculateChecksum();
             ackPacket.setTcpChecksum(newTcpCsum);
@@ -1409,6 +1519,120 @@ bool pIPTX_Parse(
 } // End of: pIPTX_Parse()
 
 
+/*******************************************************************************
+ * @brief Emulate the link between the TOE and the IP Tx Handler (Link).
+ *
+ * @param[i/o] linkPackets   A ref to the packets travelling on the link.
+ * @param[i/o] linkDueCycles A ref to the arrival cycles of these packets.
+ * @param[in]  ofIPTX_Data2  The output file to write.
+ * @param[in]  sessAckList   A ref to an associative container which holds
+ *                            the sessions as socket pair associations.
+ * @param[i/o] pktCounter_TOE_IPTX  A ref to the counter of packets sent from
+ *                            TOE-to-IPTX (counts all kinds and from all sessions).
+ * @param[i/o] tcpBytCntr_TOE_IPTX  A ref to the TCP byte counter on the IP Tx I/F.
+ * @param[out] ipRxPacketizer A ref to the IPv4 Rx packetizer.
+ * @param[i/o] linkStats     A ref to the statistics of the link.
+ *
+ * @details
+ *  Forwards the packets which have travelled for 'LinkDelay' cycles to the
+ *   packet parser. If 'LinkLoss' is set, every Nth new TCP data segment is
+ *   dropped instead, and the time it takes TOE to retransmit it is recorded.
+ *   If 'LinkMark' is set, every Nth data segment gets its IPv4 ECN field set
+ *   to Congestion Experienced (CE) as an overloaded switch would do.
+ *   FYI - The dropped segments are identified by their sequence number only.
+ *******************************************************************************/
+void pIPTX_Link(
+        deque<SimIp4Packet>         &linkPackets,
+        deque<unsigned int>         &linkDueCycles,
+        ofstream                    &ofIPTX_Data2,
+        map<SocketPair, TcpAckNum>  &sessAckList,
+        int                         &pktCounter_TOE_IPTX,
+        int                         &tcpBytCntr_TOE_IPTX,
+        deque<SimIp4Packet>         &ipRxPacketizer,
+        LinkStats                   &linkStats)
+{
+    const char *myName  = concat3(THIS_NAME, "/", "IPTX/Link");
+
+    //-- STATIC VARIABLES ------------------------------------------------------
+    static map<SocketPair, unsigned int>   link_sndMax;    // Highest SeqNum sent per session
+    static map<unsigned int, unsigned int> link_lostSegs;  // SeqNum -> Cycle at which it was dropped
+    static int                             link_newSegCnt = 0;
+    static int                             link_datSegCnt = 0;
+
+    while (!linkDueCycles.empty() and (linkDueCycles.front() <= gSimCycCnt)) {
+        SimIp4Packet ipTxPacket = linkPackets.front();
+        linkPackets.pop_front();
+        linkDueCycles.pop_front();
+        int          tcpPayloadSize = ipTxPacket.sizeOfTcpData();
+        unsigned int seqNum         = ipTxPacket.getTcpSequenceNumber();
+        if (gLinkLoss and tcpPayloadSize) {
+            SockAddr   srcSock = SockAddr(ipTxPacket.getIpSourceAddress(),
+                                          ipTxPacket.getTcpSourcePort());
+            SockAddr   dstSock = SockAddr(ipTxPacket.getIpDestinationAddress(),
+                                          ipTxPacket.getTcpDestinationPort());
+            SocketPair sockPair(dstSock, srcSock);
+            // Never drop a retransmitted segment
+            if ((link_sndMax.find(sockPair) == link_sndMax.end()) or
+                ((int)(seqNum - link_sndMax[sockPair]) >= 0)) {
+                link_sndMax[sockPair] = seqNum + tcpPayloadSize;
+                if ((++link_newSegCnt % gLinkLoss) == 0) {
+                    link_lostSegs[seqNum] = gSimCycCnt;
+                    linkStats.lostSegs++;
+                    if (DEBUG_LEVEL & TRACE_IPTX) {
+                        printInfo(myName, "Dropping data segment (SeqNum=0x%8.8X, Length=%d).\n",
+                                  seqNum, tcpPayloadSize);
+                    }
+                    continue;
+                }
+            }
+        }
+        if (gLinkMark and tcpPayloadSize and ((++link_datSegCnt % gLinkMark) == 0)) {
+            ipTxPacket.setIpTypeOfService(ipTxPacket.getIpTypeOfService() | 0x3);
+            ipTxPacket.reCalculateIpHeaderChecksum();
+            linkStats.markedSegs++;
+        }
+        bool                isInOrder;
+        deque<string>       reassembled;
+        if (pIPTX_Parse(ipTxPacket, sessAckList, ipRxPacketizer, isInOrder, reassembled) == true) {
+            // Found an ACK
+            pktCounter_TOE_IPTX++;
+            if (tcpPayloadSize and isInOrder) {
+                tcpBytCntr_TOE_IPTX += tcpPayloadSize;
+                if (linkStats.firstDatCycle == 0) {
+                    linkStats.firstDatCycle = gSimCycCnt;
+                }
+                linkStats.lastDatCycle = gSimCycCnt;
+                // Write to the IP Tx Gold file
+                ipTxPacket.writeTcpDataToDatFile(ofIPTX_Data2);
+                for (int i=0; i<reassembled.size(); i++) {
+                    tcpBytCntr_TOE_IPTX += reassembled[i].size()/2;
+                    ofIPTX_Data2 << reassembled[i] << endl;
+                }
+                // Check if this segment retransmits (the start of) a dropped segment
+                map<unsigned int, unsigned int>::iterator it = link_lostSegs.begin();
+                while (it != link_lostSegs.end()) {
+                    if ((unsigned int)(it->first - seqNum) < (unsigned int)tcpPayloadSize) {
+                        unsigned int recoveryTime = gSimCycCnt - it->second;
+                        linkStats.recoveredSegs++;
+                        linkStats.recoverySum += recoveryTime;
+                        if (recoveryTime > linkStats.recoveryMax) {
+                            linkStats.recoveryMax = recoveryTime;
+                        }
+                        if (DEBUG_LEVEL & TRACE_IPTX) {
+                            printInfo(myName, "Recovered data segment (SeqNum=0x%8.8X) after %d cycles.\n",
+                                      it->first, recoveryTime);
+                        }
+                        link_lostSegs.erase(it++);
+                    }
+                    else {
+                        it++;
+                    }
+                }
+            }
+        }
+    }
+} // End of: pIPTX_Link
+
 /*******************************************************************************
  * @brief Emulate the behavior of the IP Tx Handler (IPTX).
  *
@@ -1422,14 +1646,16 @@ bool pIPTX_Parse(
  *                              TOE-to-IPTX (counts all kinds and from all sessions).
  * @param[i/o] tcpBytCntr_TOE_IPTX  A ref to the TCP byte counter on the IP Tx I/F.
  * @param[out] ipRxPacketizer   A ref to the IPv4 Rx packetizer.
+ * @param[i/o] linkStats        A ref to the statistics of the emulated link.
  *
  * @details
  *  Drains the data from the IPTX interface of the TOE and stores them into
  *   an IPv4 Tx Packet (ipTxPacket). This ipTxPacket is a double-ended queue
  *   used to accumulate all the data chunks until a whole packet is received.
- *  This queue is further read by a packet parser which either forwards the
- *   packets to an output file, or which generates an ACK packet that is
- *   injected into the 'ipRxPacketizer' (see process 'pIPRX').
+ *  The packet is then put on an emulated link (see process 'pIPTX_Link') and
+ *   is further read by a packet parser which either forwards the packets to an
+ *   output file, or which generates an ACK packet that is injected into the
+ *   'ipRxPacketizer' (see process 'pIPRX').
  *******************************************************************************/
 void pIPTX(
         StsBit                      &piTOE_Ready,
@@ -1439,13 +1665,16 @@ void pIPTX(
         map<SocketPair, TcpAckNum>  &sessAckList,
         int                         &pktCounter_TOE_IPTX,
         int                         &tcpBytCntr_TOE_IPTX,
-        deque<SimIp4Packet>         &ipRxPacketizer)
+        deque<SimIp4Packet>         &ipRxPacketizer,
+        LinkStats                   &linkStats)
 {
     const char *myName  = concat3(THIS_NAME, "/", "IPTX");
 
     //-- STATIC VARIABLES ------------------------------------------------------
-    static SimIp4Packet iptx_ipPacket;
-    static int          iptx_rttSim = RTT_LINK;
+    static SimIp4Packet        iptx_ipPacket;
+    static int                 iptx_rttSim = RTT_LINK;
+    static deque<SimIp4Packet> iptx_linkPackets;    // Packets travelling on the link
+    static deque<unsigned int> iptx_linkDueCycles;  // Arrival cycles of these packets
     // [TODO] static ap_shift_reg<SimIp4Packet, RTT_LINK> rttPktBuffer; // A shift reg. holding RTT packets
 
 
@@ -1460,6 +1689,10 @@ void pIPTX(
         return;
     }
 
+    //-- Deliver the packets which arrived at the end of the link
+    pIPTX_Link(iptx_linkPackets, iptx_linkDueCycles, ofIPTX_Data2, sessAckList,
+               pktCounter_TOE_IPTX, tcpBytCntr_TOE_IPTX, ipRxPacketizer, linkStats);
+
     if (!siTOE_Data.empty()) {
         //---------------------------------
         //-- STEP-0 : Emulate the link RTT [FIXME - Move before '!siTOE_Data.empty()' check
@@ -1491,16 +1724,11 @@ void pIPTX(
                                                        gTest_SentUdpLen,    gTest_SentLy4Csum)) {
                 printFatal(myName, "IP packet #%d is malformed!\n", pktCounter_TOE_IPTX);
             }
-            if (pIPTX_Parse(iptx_ipPacket, sessAckList, ipRxPacketizer) == true) {
-                // Found an ACK
-                pktCounter_TOE_IPTX++;
-                int tcpPayloadSize = iptx_ipPacket.sizeOfTcpData();
-                if (tcpPayloadSize) {
-                    tcpBytCntr_TOE_IPTX += tcpPayloadSize;
-                    // Write to the IP Tx Gold file
-                    iptx_ipPacket.writeTcpDataToDatFile(ofIPTX_Data2);
-                }
-            }
+            // Put the packet on the link
+            iptx_linkPackets.push_back(iptx_ipPacket);
+            iptx_linkDueCycles.push_back(gSimCycCnt + gLinkDelay);
+            pIPTX_Link(iptx_linkPackets, iptx_linkDueCycles, ofIPTX_Data2, sessAckList,
+                       pktCounter_TOE_IPTX, tcpBytCntr_TOE_IPTX, ipRxPacketizer, linkStats);
             // Clear the chunk counter and the received IP packet
             ipTxChunkCounter = 0;
             iptx_ipPacket.clear();
@@ -1642,7 +1870,7 @@ bool pTcpAppConnect(
             printInfo(myName, "The FPGA client is requesting to connect to the following HOST socket: \n");
             printSockAddr(myName, hostServerSocket);
         }
-        tac_watchDogTimer = FPGA_CLIENT_CONNECT_TIMEOUT;
+        tac_watchDogTimer = FPGA_CLIENT_CONNECT_TIMEOUT + gLinkDelay;
         tac_fsmState++;
         rc = false;
         break;
@@ -1994,7 +2222,11 @@ void pTAIF_Send(
     static vector<SessionId> tas_txSessIdVector;  // A vector containing the Tx session IDs to be send from TAIF/Meta to TOE/Meta
     static map<SocketPair, SessionId> tas_openSessList; // Keeps track of the sessions opened by the TOE
     static bool         tas_clearToSend = false;
+    static bool         tas_sndReqRetry = false;  // Re-issue the send request after idling
     static SimAppData   tas_simAppData;
+    static unsigned int tas_genSegCnt   = 0;  // The number of segments left to generate
+    static unsigned int tas_genSegLen   = 0;  // The length of the generated segments
+    static unsigned int tas_genSegNum   = 0;  // The number of segments generated so far
 
     //-- DYNAMIC VARIABLES -----------------------------------------------------
     string              rxStringBuffer;
@@ -2048,6 +2280,10 @@ void pTAIF_Send(
             if (DEBUG_LEVEL & TRACE_TAs) {
                 printInfo(myName, "End of APP Tx idling phase. \n");
             }
+            if (tas_sndReqRetry) {
+                soTOE_SndReq.write(TcpAppSndReq(tas_openSessList[currSocketPair], tas_simAppData.length()));
+                tas_sndReqRetry = false;
+            }
         }
         else {
             tas_appTxIdleCycCnt++;
@@ -2085,10 +2321,15 @@ void pTAIF_Send(
                 printFatal(myName, "Attempt to write data for session %d which is not established.\n", appSndRep.sessId.to_uint());
                 nrError++;
                 break;
-            case NO_SPACE: // [FIXME-Must handle this scenario]
-                printFatal(myName, "There is not enough TxBuf memory space available for session %d.\n",
-                           appSndRep.sessId.to_uint());
-                nrError++;
+            case NO_SPACE:
+                // Idle for a while and retry once TOE has freed some TxBuf memory
+                if (DEBUG_LEVEL & TRACE_TAs) {
+                    printInfo(myName, "Not enough TxBuf memory space for session %d. Will retry later.\n",
+                              appSndRep.sessId.to_uint());
+                }
+                tas_appTxIdleCycReq = 500;
+                tas_appTxIdlingReq  = true;
+                tas_sndReqRetry     = true;
                 break;
             default:
                 printFatal(myName, "Received unknown reply error (%d) from [TOE].\n", rc);
@@ -2113,6 +2354,24 @@ void pTAIF_Send(
             }
         }
     }
+    else if ((tas_simAppData.size() == 0) and tas_genSegCnt and !tas_clearToSend) {
+        //------------------------------------------------------
+        //-- Build a new DATA stream from the segment generator
+        //------------------------------------------------------
+        int noBytes = tas_genSegLen;
+        int chunkNr = 0;
+        while (noBytes > 0) {
+            ap_uint<64> data = ((ap_uint<64>)tas_genSegNum << 32) | chunkNr++;
+            AxisApp appChunk(data, (noBytes > 8) ? 0xFF : lenToLE_tKeep(noBytes).to_int(),
+                             (noBytes > 8) ? 0 : TLAST);
+            tas_simAppData.pushChunk(appChunk);
+            apRxBytCntr += writeAxisAppToFile(appChunk, ofIPTX_Gold2);
+            noBytes -= 8;
+        }
+        tas_genSegNum++;
+        tas_genSegCnt--;
+        soTOE_SndReq.write(TcpAppSndReq(tas_openSessList[currSocketPair], tas_simAppData.length()));
+    }
     else if (tas_simAppData.size() == 0) {
         //------------------------------------------------------
         //-- Build a new DATA stream from FILE
@@ -2152,6 +2411,17 @@ void pTAIF_Send(
                         increaseSimTime(tas_appTxIdleCycReq);
                         return;
                     }
+                    if (stringVector[1] == "SEND") {
+                        // Cmd = Request to generate and send <NUM> segments of <LEN> bytes.
+                        tas_genSegCnt = strtol(stringVector[2].c_str(), &pEnd, 10);
+                        tas_genSegLen = strtol(stringVector[3].c_str(), &pEnd, 10);
+                        if (DEBUG_LEVEL & TRACE_TAs) {
+                            printInfo(myName, "Request to send %d segments of %d bytes. \n",
+                                      tas_genSegCnt, tas_genSegLen);
+                        }
+                        increaseSimTime(tas_genSegCnt*(tas_genSegLen/8));
+                        return;
+                    }
                     if (stringVector[1] == "SET") {
                         if (stringVector[2] == "HostIp4Addr") {
                             // COMMAND = Set the active host IP address.
@@ -2401,11 +2671,16 @@ void pTAIF(
  * @param[in]  siTAIF_DReq       APP data request from [TAIF].
  * @param[out] soTAIF_Data       APP data stream to [TAIF].
  * @param[out] soTAIF_Meta       APP metadata stream to [TAIF].
+ * @param[in]  siTAIF_DscReq     APP read descriptor request from [TAIF].
+ * @param[out] soTAIF_RdDsc      APP read descriptor to [TAIF].
+ * @param[in]  siTAIF_RxCrd      APP Rx buffer credit from [TAIF].
  * @param[in]  siTAIF_LsnReq     APP listen port request from [TAIF].
  * @param[out] soTAIF_LsnRep     APP listen port reply to [TAIF].
  * @param[in]  siTAIF_Data       APP data stream from [TAIF].
  * @param[in]  siTAIF_SndReq     APP request to send from [TAIF].
  * @param[out] soTAIF_SndRep     APP send reply to [TAIF].
+ * @param[in]  siTAIF_SndDsc     APP send descriptor from [TAIF].
+ * @param[out] soTAIF_SndCpl     APP send completion to [TAIF].
  * @param[in]  siTAIF_OpnReq     APP open port request from [TAIF].
  * @param[out] soTAIF_OpnRep     APP open port reply to [TAIF].
  * @param[in]  siTAIF_ClsReq     APP close connection request from [TAIF].
@@ -2427,7 +2702,7 @@ void pTAIF(
  * @param[out] soCAM_SssUpdReq   Session update request to [CAM].
  * @param[in]  siCAM_SssUpdRep   Session update reply from [CAM].
  * @param[out] soDBG_SssRelCnt   Session release count (for DEBUG).
- * @param[out] soDBG_SssRegCnt   Session register count (foe DEBUG).
+ * @param[out] soDBG_SssRegCnt   Session counts {peak(31:16), live(15:0)} (for DEBUG).
  *
  * @details
  *  This process is a wrapper for the 'toe_top' entity. It instantiates such an
@@ -2455,6 +2730,9 @@ void pTAIF(
         stream<TcpAppRdReq>                     &siTAIF_DReq,
         stream<TcpAppData>                      &soTAIF_Data,
         stream<TcpAppMeta>                      &soTAIF_Meta,
+        stream<TcpAppRdReq>                     &siTAIF_DscReq,
+        stream<TcpAppRdDsc>                     &soTAIF_RdDsc,
+        stream<TcpAppRxCrd>                     &siTAIF_RxCrd,
         //-- TAIF / Listen Interfaces
         stream<TcpAppLsnReq>                    &siTAIF_LsnReq,
         stream<TcpAppLsnRep>                    &soTAIF_LsnRep,
@@ -2462,6 +2740,8 @@ void pTAIF(
         stream<TcpAppData>                      &siTAIF_Data,
         stream<TcpAppSndReq>                    &siTAIF_SndReq,
         stream<TcpAppSndRep>                    &soTAIF_SndRep,
+        stream<TcpAppSndDsc>                    &siTAIF_SndDsc,
+        stream<TcpAppSndCpl>                    &soTAIF_SndCpl,
         //-- TAIF / Open Connection Interfaces
         stream<TcpAppOpnReq>                    &siTAIF_OpnReq,
         stream<TcpAppOpnRep>                    &soTAIF_OpnRep,
@@ -2490,7 +2770,7 @@ void pTAIF(
         //-- DEBUG / Interfaces
         //-- DEBUG / Session Statistics Interfaces
         stream<ap_uint<16> >                    &soDBG_SssRelCnt,
-        stream<ap_uint<16> >                    &soDBG_SssRegCnt,
+        stream<ap_uint<32> >                    &soDBG_SssRegCnt,
         //-- DEBUG / Internal Counters Interfaces
         stream<RxBufPtr>                        &soDBG_RxFreeSpace,
         stream<ap_uint<32> >                    &soDBG_TcpIpRxByteCnt,
@@ -2529,6 +2809,9 @@ void pTAIF(
       siTAIF_DReq,
       soTAIF_Data,
       soTAIF_Meta,
+      siTAIF_DscReq,
+      soTAIF_RdDsc,
+      siTAIF_RxCrd,
       //-- TAIF / Listen Port Interfaces
       siTAIF_LsnReq,
       soTAIF_LsnRep,
@@ -2536,6 +2819,8 @@ void pTAIF(
       siTAIF_Data,
       siTAIF_SndReq,
       soTAIF_SndRep,
+      siTAIF_SndDsc,
+      soTAIF_SndCpl,
       //-- TAIF / Open Connection Interfaces
       siTAIF_OpnReq,
       soTAIF_OpnRep,
@@ -2620,10 +2905,15 @@ int main(int argc, char *argv[]) {
     stream<TcpAppData>              ssTAIF_TOE_Data      ("ssTAIF_TOE_Data");
     stream<TcpAppSndReq>            ssTAIF_TOE_SndReq    ("ssTAIF_TOE_SndReq");
     stream<TcpAppSndRep>            ssTOE_TAIF_SndRep    ("ssTOE_TAIF_SndRep");
+    stream<TcpAppSndDsc>            ssTAIF_TOE_SndDsc    ("ssTAIF_TOE_SndDsc");
+    stream<TcpAppSndCpl>            ssTOE_TAIF_SndCpl    ("ssTOE_TAIF_SndCpl");
 
     stream<TcpAppRdReq>             ssTAIF_TOE_DReq      ("ssTAIF_TOE_DReq");
     stream<TcpAppData>              ssTOE_TAIF_Data      ("ssTOE_TAIF_Data");
     stream<TcpAppMeta>              ssTOE_TAIF_Meta      ("ssTOE_TAIF_Meta");
+    stream<TcpAppRdReq>             ssTAIF_TOE_DscReq    ("ssTAIF_TOE_DscReq");
+    stream<TcpAppRdDsc>             ssTOE_TAIF_RdDsc     ("ssTOE_TAIF_RdDsc");
+    stream<TcpAppRxCrd>             ssTAIF_TOE_RxCrd     ("ssTAIF_TOE_RxCrd");
 
     stream<TcpAppLsnReq>            ssTAIF_TOE_LsnReq    ("ssTAIF_TOE_LsnReq");
     stream<TcpAppLsnRep>            ssTOE_TAIF_LsnRep    ("ssTOE_TAIF_LsnRep");
@@ -2660,7 +2950,7 @@ int main(int argc, char *argv[]) {
     stream<ap_uint<8> >             ssTOE_MMIO_SessDropCnt  ("ssTOE_MMIO_SessDropCnt");
     stream<ap_uint<8> >             ssTOE_MMIO_OooDropCnt   ("ssTOE_MMIO_OooDropCnt");
 
-    stream<ap_uint<16> >            ssTOE_OpnSessCount   ("ssTOE_OpnSessCount");
+    stream<ap_uint<32> >            ssTOE_OpnSessCount   ("ssTOE_OpnSessCount");
     stream<ap_uint<16> >            ssTOE_ClsSessCount   ("ssTOE_ClsSessCount");
     stream<RxBufPtr>                ssTOE_RxFreeSpace    ("ssTOE_RxFreeSpace");
     stream<ap_uint<32> >            ssTOE_TcpIprxByteCnt ("ssTOE_TcpIprxByteCnt");
@@ -2682,6 +2972,7 @@ int main(int argc, char *argv[]) {
 
     ap_uint<16>     nrOpenedSessions;
     ap_uint<16>     nrClosedSessions;
+    ap_uint<16>     nrPeakSessions;
     ap_uint<32>     nrTcpIprxBytes;
 
     DummyMemory     rxMemory;
@@ -2726,6 +3017,8 @@ int main(int argc, char *argv[]) {
     int      tcpBytCnt_APP_TOE = 0;    // Counts the # TCP bytes from APP-to-TOE.
     int      tcpBytCnt_TOE_APP = 0;    // Counts the # TCP bytes  from TOE-to-APP.
 
+    LinkStats linkStats;               // Statistics of the emulated TOE-to-IPTX link.
+
     bool     testRxPath      = false; // Indicates if the Rx path is to be tested.
     bool     testTxPath      = false; // Indicates if the Tx path is to be tested.
 
@@ -2884,6 +3177,9 @@ int main(int argc, char *argv[]) {
             ssTAIF_TOE_DReq,
             ssTOE_TAIF_Data,
             ssTOE_TAIF_Meta,
+            ssTAIF_TOE_DscReq,
+            ssTOE_TAIF_RdDsc,
+            ssTAIF_TOE_RxCrd,
             //-- TAIF / Listen Port Interfaces
             ssTAIF_TOE_LsnReq,
             ssTOE_TAIF_LsnRep,
@@ -2891,6 +3187,8 @@ int main(int argc, char *argv[]) {
             ssTAIF_TOE_Data,
             ssTAIF_TOE_SndReq,
             ssTOE_TAIF_SndRep,
+            ssTAIF_TOE_SndDsc,
+            ssTOE_TAIF_SndCpl,
             //-- TAIF / Open Connection Interfaces
             ssTAIF_TOE_OpnReq,
             ssTOE_TAIF_OpnRep,
@@ -2933,7 +3231,10 @@ int main(int argc, char *argv[]) {
             nrClosedSessions = ssTOE_ClsSessCount.read();
         }
         if (!ssTOE_OpnSessCount.empty()) {
-            nrOpenedSessions = ssTOE_OpnSessCount.read();
+            // The session counts are {peak(31:16), live(15:0)}
+            ap_uint<32> sssCounts = ssTOE_OpnSessCount.read();
+            nrOpenedSessions = nrClosedSessions + sssCounts(15, 0);
+            nrPeakSessions   = sssCounts(31, 16);
         }
         if (!ssTOE_RxFreeSpace.empty()) {
             nrOpenedSessions = ssTOE_RxFreeSpace.read();
@@ -2996,7 +3297,8 @@ int main(int argc, char *argv[]) {
             sessAckList,
             pktCounter_TOE_IPTX,
             tcpBytCntr_TOE_IPTX,
-            ipRxPacketizer);
+            ipRxPacketizer,
+            linkStats);
 
         //-------------------------------------------------
         //-- STEP-4.1 : Emulate TCP Application (TAIF)
@@ -3086,6 +3388,7 @@ int main(int argc, char *argv[]) {
     //---------------------------------------------------------------
     printInfo(THIS_NAME, "Number of sessions opened by TOE       : %6d \n", nrOpenedSessions.to_uint());
     printInfo(THIS_NAME, "Number of sessions closed by TOE       : %6d \n", nrClosedSessions.to_uint());
+    printInfo(THIS_NAME, "Peak number of live sessions in TOE    : %6d \n", nrPeakSessions.to_uint());
 
     printInfo(THIS_NAME, "Number of IP  Packets from IPRX-to-TOE : %6d \n", pktCounter_IPRX_TOE);
     printInfo(THIS_NAME, "Number of IP  Packets from TOE-to-IPTX : %6d \n", pktCounter_TOE_IPTX);
@@ -3096,8 +3399,47 @@ int main(int argc, char *argv[]) {
     printInfo(THIS_NAME, "Number of TCP Bytes   from APP-to-TOE  : %6d \n", tcpBytCnt_APP_TOE);
     printInfo(THIS_NAME, "Number of TCP Bytes   from TOE-to-IPTX : %6d \n", tcpBytCntr_TOE_IPTX);
 
+    printInfo(THIS_NAME, "Number of Rx | Tx memory pages touched : %6d | %6d \n",
+              rxMemory.getNrPages(), txMemory.getNrPages());
+    printInfo(THIS_NAME, "Reuse ratio of Rx | Tx memory pages    : %6.2f | %6.2f \n",
+              rxMemory.getReuseRatio(), txMemory.getReuseRatio());
+
+    if (gLinkLoss or gLinkMark) {
+        printInfo(THIS_NAME, "Number of TCP Segments marked on IPTX  : %6d \n", linkStats.markedSegs);
+        printInfo(THIS_NAME, "Number of TCP Segments lost on IPTX    : %6d \n", linkStats.lostSegs);
+        printInfo(THIS_NAME, "Number of TCP Segments recovered by TOE: %6d \n", linkStats.recoveredSegs);
+        if (linkStats.recoveredSegs) {
+            unsigned int avgRecovery = linkStats.recoverySum / linkStats.recoveredSegs;
+            printInfo(THIS_NAME, "Average recovery time (cycles | ticks) : %6d | %6d \n",
+                      avgRecovery, avgRecovery / TOE_TIMER_TICK.to_uint());
+            printInfo(THIS_NAME, "Maximum recovery time (cycles | ticks) : %6d | %6d \n",
+                      linkStats.recoveryMax, linkStats.recoveryMax / TOE_TIMER_TICK.to_uint());
+        }
+        if (linkStats.lastDatCycle > linkStats.firstDatCycle) {
+            // FYI - A 64-bit datapath at 156.25MHz yields 1.25Gb/s per byte/cycle
+            float goodput = (float)tcpBytCntr_TOE_IPTX / (linkStats.lastDatCycle - linkStats.firstDatCycle);
+            printInfo(THIS_NAME, "Goodput from TOE-to-IPTX (B/cyc | Gb/s): %6.3f | %6.2f \n",
+                      goodput, goodput * 1.25);
+        }
+    }
+
     printf("\n");
     //---------------------------------------------------------------
+    //-- CHECK THAT ALL THE SEGMENTS LOST ON THE LINK WERE RECOVERED
+    //---------------------------------------------------------------
+    if (linkStats.recoveredSegs != linkStats.lostSegs) {
+        printError(THIS_NAME, "The number of TCP segments recovered by TOE (%d) does not match the number of segments lost on the IPTX link (%d). \n", linkStats.recoveredSegs, linkStats.lostSegs);
+        nrErr++;
+    }
+    //---------------------------------------------------------------
+    //-- CHECK THAT NO MEMORY ACCESS SPANS TWO BUFFER PAGES
+    //---------------------------------------------------------------
+    if (rxMemory.getNrPageCrossings() or txMemory.getNrPageCrossings()) {
+        printError(THIS_NAME, "The TOE issued %d Rx and %d Tx memory accesses which span two buffer pages. \n",
+                   rxMemory.getNrPageCrossings(), txMemory.getNrPageCrossings());
+        nrErr++;
+    }
+    //---------------------------------------------------------------
     //-- COMPARE TOE's EMBEDDED COUNTERS WITH TESTBENCH COUNTERS
     //---------------------------------------------------------------
     if (tcpBytCntr_IPRX_TOE != nrTcpIprxBytes.to_uint()) {
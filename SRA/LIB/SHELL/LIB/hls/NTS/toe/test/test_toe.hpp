@@ -124,6 +124,28 @@ enum TestingMode { RX_MODE='0', TX_MODE='1', BIDIR_MODE='2', ECHO_MODE='3' };
 
 #define RTT_LINK           25
 
+#define TB_RCV_WINDOW    7777  // Receive window advertised by the TB (in bytes)
+#define TB_RCV_WIN_SHIFT    2  // Window scale shift returned by the TB when TOE offers one
+
+//---------------------------------------------------------
+//-- EMULATED LINK IMPAIRMENTS
+//--  Statistics of the segments dropped or marked by the emulated
+//--  link (see 'G PARAM LinkLoss|LinkMark') and of their recovery by TOE.
+//---------------------------------------------------------
+class LinkStats {
+  public:
+    int             lostSegs;      // Nr of TCP data segments dropped by the link
+    int             markedSegs;    // Nr of TCP data segments marked with ECN-CE by the link
+    int             recoveredSegs; // Nr of dropped segments retransmitted by TOE
+    unsigned int    recoverySum;   // Sum of the recovery times (in clock cycles)
+    unsigned int    recoveryMax;   // Max of the recovery times (in clock cycles)
+    unsigned int    firstDatCycle; // Cycle of the first in-order data segment
+    unsigned int    lastDatCycle;  // Cycle of the last  in-order data segment
+    LinkStats() :
+        lostSegs(0), markedSegs(0), recoveredSegs(0), recoverySum(0), recoveryMax(0),
+        firstDatCycle(0), lastDatCycle(0) {}
+};
+
 #define FPGA_CLIENT_CONNECT_TIMEOUT    250 // In clock cycles
 
 //---------------------------------------------------------
@@ -143,6 +165,9 @@ TcpPort         gFpgaSndPort  = TOE_FIRST_EPHEMERAL_PORT_NUM; // TCP source port
 Ip4Addr         gHostIp4Addr  = DEFAULT_HOST_IP4_ADDR;  // IPv4 address (in NETWORK BYTE ORDER)
 TcpPort         gHostLsnPort  = DEFAULT_HOST_LSN_PORT;  // TCP  listen port
 bool            gSortTaifGold = false;                  // Do not sort soTAIF.gold file
+unsigned int    gLinkDelay    = 0;                      // One-way delay of the TOE-to-IPTX link (in clock cycles)
+unsigned int    gLinkLoss     = 0;                      // Drop every Nth TCP data segment on the TOE-to-IPTX link (0=never)
+unsigned int    gLinkMark     = 0;                      // Mark every Nth TCP data segment with ECN-CE on the TOE-to-IPTX link (0=never)
 
 bool            gTest_RcvdIp4Packet  = true; // Check the received IPv4 packet
 bool            gTest_RcvdIp4TotLen  = true; // Check the received IPv4-Total-Length field
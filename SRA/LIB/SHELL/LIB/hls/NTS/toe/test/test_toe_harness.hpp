@@ -0,0 +1,336 @@
+/*
+ * Copyright 2016 -- 2021 IBM Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*******************************************************************************
+ * @file       : test_toe_harness.hpp
+ * @brief      : Full-TOE harness shared by the benchmarks of the TOE.
+ *
+ * System:     : cloudFPGA
+ * Component   : Shell, Network Transport Stack (NTS)
+ * Language    : Vivado HLS
+ *
+ * @details
+ *  The harness wires every interface of 'toe_top' and emulates its CAM and
+ *   its data mover, such that a benchmark only implements its clients and its
+ *   application. Once per clock cycle, a benchmark feeds [IPRX] with
+ *   feedIpRx(), runs the TOE and its emulated blocks with run(), and collects
+ *   the segments sent by the TOE with recvSegment().
+ *
+ * \ingroup NTS_TOE
+ * \addtogroup NTS_TOE_TEST
+ * \{
+ *******************************************************************************/
+
+#ifndef _TEST_TOE_HARNESS_H_
+#define _TEST_TOE_HARNESS_H_
+
+#include <deque>
+#include <map>
+#include <vector>
+
+#include "../src/toe.hpp"
+
+/*******************************************************************************
+ * @brief The header fields of a segment sent by the TOE to a client.
+ *******************************************************************************/
+struct ToeSegment {
+    Ip4Addr     dstAddr;
+    TcpPort     srcPort;
+    TcpPort     dstPort;
+    TcpSeqNum   seqNum;
+    TcpAckNum   ackNum;
+    ap_uint<8>  flags;      // The TCP control bits (.i.e, [..|ACK|PSH|RST|SYN|FIN])
+    int         len;        // The length of the payload
+};
+
+/*******************************************************************************
+ * @brief The TOE along with its emulated CAM and data mover.
+ *
+ * @details
+ *  The emulated CAM replies within the cycle of a request. An insertion is
+ *   refused (STS_KO) if its key is already in the CAM, as the TOECAM does, or
+ *   if the CAM already holds 'camCapacity' entries. The data mover only
+ *   acknowledges the writes into the Rx buffer, since the benchmarks never
+ *   read it back.
+ *******************************************************************************/
+class ToeHarness {
+  public:
+    //-- The interfaces of the TOE
+    Ip4Addr                         toeIpAddr;
+    StsBit                          sNTS_Ready;
+    stream<StsBit>                  ssMMIO_RxMemWrErr;
+    stream<ap_uint<8> >             ssMMIO_NotifDropCnt;
+    stream<ap_uint<8> >             ssMMIO_MetaDropCnt;
+    stream<ap_uint<8> >             ssMMIO_DataDropCnt;
+    stream<ap_uint<8> >             ssMMIO_CrcDropCnt;
+    stream<ap_uint<8> >             ssMMIO_SessDropCnt;
+    stream<ap_uint<8> >             ssMMIO_OooDropCnt;
+    stream<AxisIp4>                 ssIPRX_Data;
+    stream<AxisIp4>                 ssIPTX_Data;
+    stream<TcpAppNotif>             ssTAIF_Notif;
+    stream<TcpAppRdReq>             ssTAIF_DReq;
+    stream<TcpAppData>              ssTAIF_RxData;
+    stream<TcpAppMeta>              ssTAIF_Meta;
+    stream<TcpAppRdReq>             ssTAIF_DscReq;
+    stream<TcpAppRdDsc>             ssTAIF_RdDsc;
+    stream<TcpAppRxCrd>             ssTAIF_RxCrd;
+    stream<TcpAppLsnReq>            ssTAIF_LsnReq;
+    stream<TcpAppLsnRep>            ssTAIF_LsnRep;
+    stream<TcpAppData>              ssTAIF_TxData;
+    stream<TcpAppSndReq>            ssTAIF_SndReq;
+    stream<TcpAppSndRep>            ssTAIF_SndRep;
+    stream<TcpAppSndDsc>            ssTAIF_SndDsc;
+    stream<TcpAppSndCpl>            ssTAIF_SndCpl;
+    stream<TcpAppOpnReq>            ssTAIF_OpnReq;
+    stream<TcpAppOpnRep>            ssTAIF_OpnRep;
+    stream<TcpAppClsReq>            ssTAIF_ClsReq;
+    stream<DmCmd>                   ssMEM_RxP_RdCmd;
+    stream<AxisApp>                 ssMEM_RxP_RdData;
+    stream<DmSts>                   ssMEM_RxP_WrSts;
+    stream<DmCmd>                   ssMEM_RxP_WrCmd;
+    stream<AxisApp>                 ssMEM_RxP_WrData;
+    stream<DmCmd>                   ssMEM_TxP_RdCmd;
+    stream<AxisApp>                 ssMEM_TxP_RdData;
+    stream<DmSts>                   ssMEM_TxP_WrSts;
+    stream<DmCmd>                   ssMEM_TxP_WrCmd;
+    stream<AxisApp>                 ssMEM_TxP_WrData;
+    stream<CamSessionLookupRequest> ssCAM_SssLkpReq;
+    stream<CamSessionLookupReply>   ssCAM_SssLkpRep;
+    stream<CamSessionUpdateRequest> ssCAM_SssUpdReq;
+    stream<CamSessionUpdateReply>   ssCAM_SssUpdRep;
+    stream<ap_uint<16> >            ssDBG_SssRelCnt;
+    stream<ap_uint<32> >            ssDBG_SssRegCnt;
+    stream<RxBufPtr>                ssDBG_RxFreeSpace;
+    stream<ap_uint<32> >            ssDBG_TcpIpRxByteCnt;
+    stream<ap_uint<8> >             ssDBG_OooDebug;
+
+    //-- The emulated CAM
+    std::map<FourTuple, SessionId>  cam;
+    unsigned                        camCapacity;    // 0 for an unlimited CAM
+    int                             nrInsFail;      // The refused insertions
+
+    //-- The last session counters of the TOE ([15:0]=live, [31:16]=peak)
+    ap_uint<32>                     sssRegCnt;
+
+  private:
+    DmCmd                           wrCmd;          // The pending Rx buffer write
+    std::deque<AxisIp4>             ipRxQueue;      // The chunks to feed to [IPRX]
+    std::vector<ap_uint<8> >        ipTxBytes;      // The segment sent by the TOE
+
+  public:
+    ToeHarness(Ip4Addr toeIpAddr, unsigned camCapacity=0) :
+        toeIpAddr(toeIpAddr), sNTS_Ready(0),
+        ssMMIO_RxMemWrErr   ("ssMMIO_RxMemWrErr"),
+        ssMMIO_NotifDropCnt ("ssMMIO_NotifDropCnt"),
+        ssMMIO_MetaDropCnt  ("ssMMIO_MetaDropCnt"),
+        ssMMIO_DataDropCnt  ("ssMMIO_DataDropCnt"),
+        ssMMIO_CrcDropCnt   ("ssMMIO_CrcDropCnt"),
+        ssMMIO_SessDropCnt  ("ssMMIO_SessDropCnt"),
+        ssMMIO_OooDropCnt   ("ssMMIO_OooDropCnt"),
+        ssIPRX_Data         ("ssIPRX_Data"),
+        ssIPTX_Data         ("ssIPTX_Data"),
+        ssTAIF_Notif        ("ssTAIF_Notif"),
+        ssTAIF_DReq         ("ssTAIF_DReq"),
+        ssTAIF_RxData       ("ssTAIF_RxData"),
+        ssTAIF_Meta         ("ssTAIF_Meta"),
+        ssTAIF_DscReq       ("ssTAIF_DscReq"),
+        ssTAIF_RdDsc        ("ssTAIF_RdDsc"),
+        ssTAIF_RxCrd        ("ssTAIF_RxCrd"),
+        ssTAIF_LsnReq       ("ssTAIF_LsnReq"),
+        ssTAIF_LsnRep       ("ssTAIF_LsnRep"),
+        ssTAIF_TxData       ("ssTAIF_TxData"),
+        ssTAIF_SndReq       ("ssTAIF_SndReq"),
+        ssTAIF_SndRep       ("ssTAIF_SndRep"),
+        ssTAIF_SndDsc       ("ssTAIF_SndDsc"),
+        ssTAIF_SndCpl       ("ssTAIF_SndCpl"),
+        ssTAIF_OpnReq       ("ssTAIF_OpnReq"),
+        ssTAIF_OpnRep       ("ssTAIF_OpnRep"),
+        ssTAIF_ClsReq       ("ssTAIF_ClsReq"),
+        ssMEM_RxP_RdCmd     ("ssMEM_RxP_RdCmd"),
+        ssMEM_RxP_RdData    ("ssMEM_RxP_RdData"),
+        ssMEM_RxP_WrSts     ("ssMEM_RxP_WrSts"),
+        ssMEM_RxP_WrCmd     ("ssMEM_RxP_WrCmd"),
+        ssMEM_RxP_WrData    ("ssMEM_RxP_WrData"),
+        ssMEM_TxP_RdCmd     ("ssMEM_TxP_RdCmd"),
+        ssMEM_TxP_RdData    ("ssMEM_TxP_RdData"),
+        ssMEM_TxP_WrSts     ("ssMEM_TxP_WrSts"),
+        ssMEM_TxP_WrCmd     ("ssMEM_TxP_WrCmd"),
+        ssMEM_TxP_WrData    ("ssMEM_TxP_WrData"),
+        ssCAM_SssLkpReq     ("ssCAM_SssLkpReq"),
+        ssCAM_SssLkpRep     ("ssCAM_SssLkpRep"),
+        ssCAM_SssUpdReq     ("ssCAM_SssUpdReq"),
+        ssCAM_SssUpdRep     ("ssCAM_SssUpdRep"),
+        ssDBG_SssRelCnt     ("ssDBG_SssRelCnt"),
+        ssDBG_SssRegCnt     ("ssDBG_SssRegCnt"),
+        ssDBG_RxFreeSpace   ("ssDBG_RxFreeSpace"),
+        ssDBG_TcpIpRxByteCnt("ssDBG_TcpIpRxByteCnt"),
+        ssDBG_OooDebug      ("ssDBG_OooDebug"),
+        camCapacity(camCapacity), nrInsFail(0), sssRegCnt(0), wrCmd(0, 0) {}
+
+    /***************************************************************************
+     * @brief Queues a packet for [IPRX] (see buildTcpPacket()).
+     ***************************************************************************/
+    void sendPacket(const std::vector<AxisIp4> &pkt) {
+        ipRxQueue.insert(ipRxQueue.end(), pkt.begin(), pkt.end());
+    }
+
+    /***************************************************************************
+     * @brief Returns true if all the queued packets were fed to [IPRX].
+     ***************************************************************************/
+    bool ipRxIdle() const {
+        return ipRxQueue.empty();
+    }
+
+    /***************************************************************************
+     * @brief Feeds the next queued chunk to [IPRX].
+     *
+     * @return true if a chunk was fed.
+     ***************************************************************************/
+    bool feedIpRx() {
+        if (ipRxQueue.empty()) {
+            return false;
+        }
+        ssIPRX_Data.write(ipRxQueue.front());
+        ipRxQueue.pop_front();
+        return true;
+    }
+
+    /***************************************************************************
+     * @brief Runs the TOE, its emulated CAM and data mover for one clock cycle,
+     *  and drains the MMIO and debug interfaces.
+     ***************************************************************************/
+    void run() {
+        toe_top(toeIpAddr,
+                ssMMIO_RxMemWrErr, ssMMIO_NotifDropCnt, ssMMIO_MetaDropCnt, ssMMIO_DataDropCnt,
+                ssMMIO_CrcDropCnt, ssMMIO_SessDropCnt,  ssMMIO_OooDropCnt,
+                sNTS_Ready,
+                ssIPRX_Data,       ssIPTX_Data,
+                ssTAIF_Notif,      ssTAIF_DReq,         ssTAIF_RxData,      ssTAIF_Meta,
+                ssTAIF_DscReq,     ssTAIF_RdDsc,        ssTAIF_RxCrd,
+                ssTAIF_LsnReq,     ssTAIF_LsnRep,
+                ssTAIF_TxData,     ssTAIF_SndReq,       ssTAIF_SndRep,      ssTAIF_SndDsc,
+                ssTAIF_SndCpl,
+                ssTAIF_OpnReq,     ssTAIF_OpnRep,
+                ssTAIF_ClsReq,
+                ssMEM_RxP_RdCmd,   ssMEM_RxP_RdData,    ssMEM_RxP_WrSts,    ssMEM_RxP_WrCmd,
+                ssMEM_RxP_WrData,
+                ssMEM_TxP_RdCmd,   ssMEM_TxP_RdData,    ssMEM_TxP_WrSts,    ssMEM_TxP_WrCmd,
+                ssMEM_TxP_WrData,
+                ssCAM_SssLkpReq,   ssCAM_SssLkpRep,     ssCAM_SssUpdReq,    ssCAM_SssUpdRep,
+                ssDBG_SssRelCnt,   ssDBG_SssRegCnt,
+                ssDBG_RxFreeSpace, ssDBG_TcpIpRxByteCnt, ssDBG_OooDebug);
+
+        //-- EMULATE THE CAM --------------------------------------------------
+        if (!ssCAM_SssLkpReq.empty()) {
+            CamSessionLookupRequest req = ssCAM_SssLkpReq.read();
+            std::map<FourTuple, SessionId>::const_iterator it = cam.find(req.key);
+            if (it != cam.end()) {
+                ssCAM_SssLkpRep.write(CamSessionLookupReply(true, it->second, req.source));
+            }
+            else {
+                ssCAM_SssLkpRep.write(CamSessionLookupReply(false, req.source));
+            }
+        }
+        if (!ssCAM_SssUpdReq.empty()) {
+            CamSessionUpdateRequest req = ssCAM_SssUpdReq.read();
+            StsBit                  sts = STS_OK;
+            if (req.op == INSERT) {
+                if ((cam.find(req.key) == cam.end()) and
+                    ((camCapacity == 0) or (cam.size() < camCapacity))) {
+                    cam[req.key] = req.value;
+                }
+                else {
+                    sts = STS_KO;
+                    nrInsFail++;
+                }
+            }
+            else {
+                cam.erase(req.key);
+            }
+            ssCAM_SssUpdRep.write(CamSessionUpdateReply(req.value, req.op, req.source, sts));
+        }
+
+        //-- EMULATE THE DATA MOVER -------------------------------------------
+        if ((wrCmd.btt == 0) and !ssMEM_RxP_WrCmd.empty()) {
+            wrCmd = ssMEM_RxP_WrCmd.read();
+        }
+        else if ((wrCmd.btt != 0) and !ssMEM_RxP_WrData.empty()) {
+            AxisApp chunk = ssMEM_RxP_WrData.read();
+            for (int lane=0; lane<ARW/8; lane++) {
+                if (chunk.getLE_TKeep()[lane]) {
+                    wrCmd.btt--;
+                }
+            }
+            if (wrCmd.btt == 0) {
+                DmSts sts;
+                sts.tag = 0; sts.interr = 0; sts.decerr = 0; sts.slverr = 0; sts.okay = 1;
+                ssMEM_RxP_WrSts.write(sts);
+            }
+        }
+
+        //-- DRAIN THE OTHER INTERFACES ---------------------------------------
+        if (!ssDBG_SssRegCnt.empty())       { sssRegCnt = ssDBG_SssRegCnt.read(); }
+        if (!ssDBG_SssRelCnt.empty())       { ssDBG_SssRelCnt.read();       }
+        if (!ssDBG_RxFreeSpace.empty())     { ssDBG_RxFreeSpace.read();     }
+        if (!ssDBG_TcpIpRxByteCnt.empty())  { ssDBG_TcpIpRxByteCnt.read();  }
+        if (!ssDBG_OooDebug.empty())        { ssDBG_OooDebug.read();        }
+        if (!ssMMIO_RxMemWrErr.empty())     { ssMMIO_RxMemWrErr.read();     }
+        if (!ssMMIO_NotifDropCnt.empty())   { ssMMIO_NotifDropCnt.read();   }
+        if (!ssMMIO_MetaDropCnt.empty())    { ssMMIO_MetaDropCnt.read();    }
+        if (!ssMMIO_DataDropCnt.empty())    { ssMMIO_DataDropCnt.read();    }
+        if (!ssMMIO_CrcDropCnt.empty())     { ssMMIO_CrcDropCnt.read();     }
+        if (!ssMMIO_SessDropCnt.empty())    { ssMMIO_SessDropCnt.read();    }
+        if (!ssMMIO_OooDropCnt.empty())     { ssMMIO_OooDropCnt.read();     }
+        if (!ssTAIF_Meta.empty())           { ssTAIF_Meta.read();           }
+    }
+
+    /***************************************************************************
+     * @brief Collects the next chunk sent by the TOE to [IPTX].
+     *
+     * @param[out] seg  The header fields of the segment.
+     *
+     * @return true if the chunk completed a segment.
+     ***************************************************************************/
+    bool recvSegment(ToeSegment &seg) {
+        if (ssIPTX_Data.empty()) {
+            return false;
+        }
+        AxisIp4 chunk = ssIPTX_Data.read();
+        for (int lane=0; lane<ARW/8; lane++) {
+            if (chunk.getLE_TKeep()[lane]) {
+                ipTxBytes.push_back(chunk.getLE_TData(8*lane+7, 8*lane));
+            }
+        }
+        if (!chunk.getLE_TLast()) {
+            return false;
+        }
+        std::vector<ap_uint<8> > &b = ipTxBytes;
+        int t = (b[0] & 0xF) * 4;
+        seg.dstAddr = (b[16],  b[17],  b[18],  b[19]);
+        seg.srcPort = (b[t+0], b[t+1]);
+        seg.dstPort = (b[t+2], b[t+3]);
+        seg.seqNum  = (b[t+4], b[t+5], b[t+6],  b[t+7]);
+        seg.ackNum  = (b[t+8], b[t+9], b[t+10], b[t+11]);
+        seg.flags   = b[t+13];
+        seg.len     = (int)b.size() - t - (b[t+12] >> 4).to_int() * 4;
+        ipTxBytes.clear();
+        return true;
+    }
+};
+
+#endif
+
+/*! \} */
@@ -0,0 +1,463 @@
+/*
+ * Copyright 2016 -- 2021 IBM Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*******************************************************************************
+ * @file       : test_zero_copy.cpp
+ * @brief      : DDR traffic benchmark of the streamed and zero-copy send paths.
+ *
+ * System:     : cloudFPGA
+ * Component   : Shell, Network Transport Stack (NTS)
+ * Language    : Vivado HLS
+ *
+ * @details
+ *  This testbench instantiates the Tx path of the TOE (i.e. [TAi], [TSt] and
+ *  [TXe]) and emulates the DRAM, the remaining TOE processes and a role which
+ *  holds its results in DDR. The same amount of payload is sent twice:
+ *   1) with 'TcpAppSndReq' : the role reads its results from DDR and streams
+ *      them into the TOE which writes them into the Tx buffer of the session.
+ *   2) with 'TcpAppSndDsc' : the TOE reads the results from the role buffer.
+ *  Every outgoing segment is checked and acknowledged. For each run, the
+ *  testbench reports the number of DDR bytes moved per payload byte.
+ *
+ *  Usage: 'make csimZeroCopy' from the 'toe' directory.
+ *
+ * \ingroup NTS_TOE
+ * \addtogroup NTS_TOE_TEST
+ * \{
+ *******************************************************************************/
+
+#include <cstdlib>
+#include <deque>
+#include <map>
+#include <vector>
+
+#include "../src/tx_app_interface/tx_app_interface.hpp"
+#include "../src/tx_sar_table/tx_sar_table.hpp"
+#include "../src/tx_engine/src/tx_engine.hpp"
+
+using namespace hls;
+using namespace std;
+
+#define THIS_NAME "TB"
+
+//---------------------------------------------------------
+//-- TESTBENCH GLOBAL VARIABLES
+//---------------------------------------------------------
+bool            gTraceEvent   = false;
+bool            gFatalError   = false;
+unsigned int    gSimCycCnt    = 0;
+
+//---------------------------------------------------------
+//-- TESTBENCH DEFINES
+//---------------------------------------------------------
+const int          cNrSessions = 4;
+const int          cPayload    = 256*1024;  // Bytes sent per session and per run
+const int          cReqLen     = 4000;      // Bytes per send request or descriptor
+const int          cMaxInFlight= 2*cReqLen; // Bytes requested but not yet received (all sessions)
+const int          cMaxCycles  = 4000000;
+const unsigned int cIsn        = 0x12345678;
+const TxMemPtr     cRoleBase   = 0x80000000; // APP buffers, outside the Rx/Tx buffers
+
+/*******************************************************************************
+ * @brief The payload byte found at 'offset' in the data of session 'sessId'.
+ *******************************************************************************/
+ap_uint<8> payloadByte(int sessId, unsigned int offset)
+{
+    return (sessId*31 + offset*7 + (offset >> 8)) & 0xFF;
+}
+
+/*******************************************************************************
+ * @brief The DRAM and its data movers, with a count of the bytes moved.
+ *******************************************************************************/
+class SimDram {
+  public:
+    map<uint64_t, ap_uint<8> >  bytes;
+    deque<DmCmd>                wrCmds;
+    uint64_t                    wrAddr;
+    bool                        wrBusy;
+    size_t                      wrCnt;
+    size_t                      rdCnt;
+    SimDram() : wrAddr(0), wrBusy(false), wrCnt(0), rdCnt(0) {}
+
+    void run(stream<DmCmd> &siWrCmd, stream<AxisApp> &siWrData, stream<DmSts> &soWrSts,
+             stream<DmCmd> &siRdCmd, stream<AxisApp> &soRdData) {
+        if (!siWrCmd.empty()) {
+            wrCmds.push_back(siWrCmd.read());
+        }
+        if (!wrCmds.empty() and !siWrData.empty()) {
+            if (!wrBusy) {
+                wrAddr = wrCmds.front().saddr.to_uint64();
+                wrBusy = true;
+            }
+            AxisApp chunk = siWrData.read();
+            for (int lane=0; lane<ARW/8; lane++) {
+                if (chunk.getLE_TKeep()[lane]) {
+                    bytes[wrAddr++] = chunk.getLE_TData(8*lane+7, 8*lane);
+                    wrCnt++;
+                }
+            }
+            if (chunk.getTLast()) {
+                DmSts sts;
+                sts.tag = 0; sts.interr = 0; sts.decerr = 0; sts.slverr = 0; sts.okay = 1;
+                soWrSts.write(sts);
+                wrCmds.pop_front();
+                wrBusy = false;
+            }
+        }
+        if (!siRdCmd.empty()) {
+            DmCmd    cmd  = siRdCmd.read();
+            uint64_t addr = cmd.saddr.to_uint64();
+            int      len  = cmd.btt.to_int();
+            for (int i=0; i<len; i+=ARW/8) {
+                AxisApp chunk(0, 0, 0);
+                for (int lane=0; (lane<ARW/8) and (i+lane<len); lane++) {
+                    chunk.setLE_TData(bytes[addr+i+lane], 8*lane+7, 8*lane);
+                    chunk.setLE_TKeep(1, lane, lane);
+                }
+                if (i+ARW/8 >= len) {
+                    chunk.setLE_TLast(TLAST);
+                }
+                soRdData.write(chunk);
+            }
+            rdCnt += len;
+        }
+    }
+};
+
+/*******************************************************************************
+ * @brief Run one send mode through [TAi], [TSt] and [TXe].
+ *
+ * @param[in]     zeroCopy  Use send descriptors instead of send requests.
+ * @param[in,out] dram      The emulated DRAM.
+ *
+ * @return the number of errors.
+ *******************************************************************************/
+int runMode(bool zeroCopy, SimDram &dram)
+{
+    const char *myName = concat3(THIS_NAME, "/", "Bench");
+
+    //-- Streams of the DUTs (static: the DUTs keep their state across runs)
+    static stream<TcpAppOpnReq>        ssOpnReq("ssOpnReq");
+    static stream<TcpAppOpnRep>        ssOpnRep("ssOpnRep");
+    static stream<TcpAppClsReq>        ssClsReq("ssClsReq");
+    static stream<TcpAppData>          ssAppData("ssAppData");
+    static stream<TcpAppSndReq>        ssSndReq("ssSndReq");
+    static stream<TcpAppSndRep>        ssSndRep("ssSndRep");
+    static stream<TcpAppSndDsc>        ssSndDsc("ssSndDsc");
+    static stream<TcpAppSndCpl>        ssSndCpl("ssSndCpl");
+    static stream<DmCmd>               ssMemWrCmd("ssMemWrCmd");
+    static stream<AxisApp>             ssMemWrData("ssMemWrData");
+    static stream<DmSts>               ssMemWrSts("ssMemWrSts");
+    static stream<DmCmd>               ssMemRdCmd("ssMemRdCmd");
+    static stream<AxisApp>             ssMemRdData("ssMemRdData");
+    static stream<SessionId>           ssSttReq("ssSttReq");
+    static stream<TcpState>            ssSttRep("ssSttRep");
+    static stream<StateQuery>          ssSttQry("ssSttQry");
+    static stream<TcpState>            ssSttQryRep("ssSttQryRep");
+    static stream<SocketPair>          ssSlcReq("ssSlcReq");
+    static stream<SessionLookupReply>  ssSlcRep("ssSlcRep");
+    static stream<ReqBit>              ssPrtReq("ssPrtReq");
+    static stream<TcpPort>             ssPrtRep("ssPrtRep");
+    static stream<TStTxSarPush>        ssTStToTAi_Push("ssTStToTAi_Push");
+    static stream<BufPageRel>          ssTStToBPl_Rel("ssTStToBPl_Rel");
+    static stream<TAiTxSarPush>        ssTAiToTSt_Push("ssTAiToTSt_Push");
+    static stream<SessState>           ssActSessState("ssActSessState");
+    static stream<Event>               ssTAiToEVe_Event("ssTAiToEVe_Event");
+    static stream<SessState>           ssTImNotif("ssTImNotif");
+    static stream<RXeTxSarQuery>       ssRXeToTSt_Qry("ssRXeToTSt_Qry");
+    static stream<RXeTxSarReply>       ssTStToRXe_Rep("ssTStToRXe_Rep");
+    static stream<TXeTxSarQuery>       ssTXeToTSt_Qry("ssTXeToTSt_Qry");
+    static stream<TXeTxSarReply>       ssTStToTXe_Rep("ssTStToTXe_Rep");
+    static stream<ExtendedEvent>       ssAKdToTXe_Event("ssAKdToTXe_Event");
+    static stream<SigBit>              ssTXeToEVe_RxEventSig("ssTXeToEVe_RxEventSig");
+    static stream<SessionId>           ssTXeToRSt_Req("ssTXeToRSt_Req");
+    static stream<RxSarReply>          ssRStToTXe_Rep("ssRStToTXe_Rep");
+    static stream<TXeReTransTimerCmd>  ssTXeToTIm_ReTxCmd("ssTXeToTIm_ReTxCmd");
+    static stream<ap_uint<16> >        ssTXeToTIm_Probe("ssTXeToTIm_Probe");
+    static stream<SessionId>           ssTXeToSLc_RevReq("ssTXeToSLc_RevReq");
+    static stream<fourTuple>           ssSLcToTXe_RevRep("ssSLcToTXe_RevRep");
+    static stream<AxisIp4>             ssTXeToIPTX_Data("ssTXeToIPTX_Data");
+
+    //-- Per session state of the role and of the emulated peer
+    static bool         sInitDone = false;
+    static unsigned int sSeqBase[cNrSessions];  // Offset of the first byte of this run
+    unsigned int reqOff[cNrSessions];    // Next offset to request
+    unsigned int rcvOff[cNrSessions];    // Next offset expected by the peer
+    bool         waitRep[cNrSessions];
+    int          retryCnt[cNrSessions];
+    TcpAppMemAdr cplAddr[cNrSessions];
+    bool         cplDone[cNrSessions];
+    size_t       roleRdCnt=0, payloadCnt=0;
+    size_t       memWr0 = dram.wrCnt, memRd0 = dram.rdCnt;
+    deque<SessionId> revLkpQueue;
+    vector<ap_uint<8> > pkt;
+    int          nrErr = 0;
+
+    bool synAckPending = false;
+    if (!sInitDone) {
+        //-- Initialize the Tx SAR table as a 3-way handshake would do (SYN sent)
+        for (int s=0; s<cNrSessions; s++) {
+            ssTXeToTSt_Qry.write(TXeTxSarQuery(s, cIsn+1, QUERY_WR, QUERY_INIT));
+            sSeqBase[s] = 0;
+        }
+        synAckPending = true;
+        sInitDone = true;
+    }
+    for (int s=0; s<cNrSessions; s++) {
+        reqOff[s] = 0; rcvOff[s] = 0; waitRep[s] = false; retryCnt[s] = 0;
+        cplAddr[s] = 0; cplDone[s] = false;
+        if (zeroCopy) {
+            //-- The role already holds its results in DDR
+            for (int i=0; i<cPayload; i++) {
+                dram.bytes[cRoleBase + s*0x1000000 + i] = payloadByte(s, sSeqBase[s]+i);
+            }
+        }
+    }
+
+    int cyc, done=0;
+    for (cyc=0; (cyc<cMaxCycles) and (done<cNrSessions); cyc++) {
+        //-- PEER: Acknowledge the SYN of every session
+        if (synAckPending and (cyc == 4*cNrSessions)) {
+            for (int s=0; s<cNrSessions; s++) {
+                ssRXeToTSt_Qry.write(RXeTxSarQuery(s, cIsn+1, 0xFFFF, TOE_MAX_CONGESTION_WINDOW, 0, false, 0, MY_MSS));
+            }
+            synAckPending = false;
+        }
+        //-- ROLE: One send request or descriptor in flight per session
+        else if (cyc < 8*cNrSessions) {
+            // Wait for the connections to be established
+        }
+        else for (int s=0; s<cNrSessions; s++) {
+            int inFlight = 0;
+            for (int i=0; i<cNrSessions; i++) {
+                inFlight += reqOff[i] - rcvOff[i] + (waitRep[i] ? cReqLen : 0);
+            }
+            if (retryCnt[s] > 0) {
+                retryCnt[s]--;
+            }
+            else if (!waitRep[s] and (reqOff[s] < (unsigned)cPayload) and (inFlight < cMaxInFlight)) {
+                int len = min(cReqLen, cPayload - (int)reqOff[s]);
+                if (zeroCopy) {
+                    ssSndDsc.write(TcpAppSndDsc(s, cRoleBase + s*0x1000000 + reqOff[s], len));
+                }
+                else {
+                    ssSndReq.write(TcpAppSndReq(s, len));
+                }
+                waitRep[s] = true;
+            }
+        }
+        if (!ssSndRep.empty()) {
+            TcpAppSndRep rep = ssSndRep.read();
+            int s = rep.sessId.to_int();
+            waitRep[s] = false;
+            if (rep.error == NO_ERROR) {
+                if (!zeroCopy) {
+                    //-- Read the results from DDR and stream them into the TOE
+                    AxisApp chunk(0, 0, 0);
+                    for (int i=0; i<rep.length; i++) {
+                        int lane = i % (ARW/8);
+                        chunk.setLE_TData(payloadByte(s, sSeqBase[s]+reqOff[s]+i), 8*lane+7, 8*lane);
+                        chunk.setLE_TKeep(1, lane, lane);
+                        if (i == rep.length-1) {
+                            chunk.setLE_TLast(TLAST);
+                        }
+                        if ((lane == ARW/8-1) or (i == rep.length-1)) {
+                            ssAppData.write(chunk);
+                            chunk = AxisApp(0, 0, 0);
+                        }
+                    }
+                    roleRdCnt += rep.length;
+                }
+                reqOff[s] += rep.length;
+            }
+            else {
+                retryCnt[s] = 64;
+            }
+        }
+        if (!ssSndCpl.empty()) {
+            TcpAppSndCpl cpl = ssSndCpl.read();
+            int s = cpl.sessId.to_int();
+            if (cpl.addr < cplAddr[s]) {
+                printError(myName, "S%d - The completion address went backwards (0x%x < 0x%x, done=%d).\n", s, cpl.addr.to_uint(), cplAddr[s].to_uint(), cpl.done);
+                nrErr++;
+            }
+            cplAddr[s] = cpl.addr;
+            cplDone[s] = cplDone[s] or cpl.done;
+        }
+
+        //-- DUTs
+        tx_app_interface(
+            ssOpnReq, ssOpnRep, ssClsReq,
+            ssAppData, ssSndReq, ssSndRep, ssSndDsc, ssSndCpl,
+            ssMemWrCmd, ssMemWrData, ssMemWrSts,
+            ssSttReq, ssSttRep, ssSttQry, ssSttQryRep,
+            ssSlcReq, ssSlcRep,
+            ssPrtReq, ssPrtRep,
+            ssTStToTAi_Push, ssTAiToTSt_Push,
+            ssActSessState,
+            ssTAiToEVe_Event,
+            ssTImNotif,
+            0x0A0C0001);
+        tx_sar_table(
+            ssRXeToTSt_Qry, ssTStToRXe_Rep,
+            ssTXeToTSt_Qry, ssTStToTXe_Rep,
+            ssTAiToTSt_Push, ssTStToTAi_Push, ssTStToBPl_Rel);
+        tx_engine(
+            ssAKdToTXe_Event, ssTXeToEVe_RxEventSig,
+            ssTXeToRSt_Req, ssRStToTXe_Rep,
+            ssTXeToTSt_Qry, ssTStToTXe_Rep,
+            ssMemRdCmd, ssMemRdData,
+            ssTXeToTIm_ReTxCmd, ssTXeToTIm_Probe,
+            ssTXeToSLc_RevReq, ssSLcToTXe_RevRep,
+            ssTXeToIPTX_Data);
+
+        //-- Models of [DRAM], [STt], [EVe], [RSt], [TIm] and [SLc]
+        dram.run(ssMemWrCmd, ssMemWrData, ssMemWrSts, ssMemRdCmd, ssMemRdData);
+        if (!ssSttReq.empty()) {
+            ssSttReq.read();
+            ssSttRep.write(ESTABLISHED);
+        }
+        if (!ssTAiToEVe_Event.empty()) {
+            ssAKdToTXe_Event.write(ExtendedEvent(ssTAiToEVe_Event.read()));
+        }
+        if (!ssTXeToRSt_Req.empty()) {
+            ssTXeToRSt_Req.read();
+            OooBlock noBlk[TOE_MAX_OOO_BLOCKS];
+            ssRStToTXe_Rep.write(RxSarReply(0, 0x1000, false, 0x1000, 0, noBlk, 0, 0, false));
+        }
+        if (!ssTXeToSLc_RevReq.empty()) {
+            SessionId s = ssTXeToSLc_RevReq.read();
+            revLkpQueue.push_back(s);
+            ssSLcToTXe_RevRep.write(fourTuple(0x0A0C0001, 0x0A0C0002, 0x8000+s, 80));
+        }
+        while (!ssTXeToEVe_RxEventSig.empty()) { ssTXeToEVe_RxEventSig.read(); }
+        while (!ssTXeToTIm_ReTxCmd.empty())    { ssTXeToTIm_ReTxCmd.read();    }
+        while (!ssTXeToTIm_Probe.empty())      { ssTXeToTIm_Probe.read();      }
+
+        //-- Model of the peer: check every segment and acknowledge it
+        if (!ssTXeToIPTX_Data.empty()) {
+            AxisIp4 chunk = ssTXeToIPTX_Data.read();
+            for (int lane=0; lane<ARW/8; lane++) {
+                if (chunk.getLE_TKeep()[lane]) {
+                    pkt.push_back(chunk.getLE_TData(8*lane+7, 8*lane));
+                }
+            }
+            if (chunk.getTLast()) {
+                int s = revLkpQueue.front().to_int();
+                revLkpQueue.pop_front();
+                int ihl  = (pkt[0] & 0xF) * 4;
+                int doff = (pkt[ihl+12] >> 4) * 4;
+                unsigned int seq = (pkt[ihl+4].to_uint() << 24) | (pkt[ihl+5].to_uint() << 16) |
+                                   (pkt[ihl+6].to_uint() <<  8) |  pkt[ihl+7].to_uint();
+                unsigned int off = seq - (cIsn+1) - sSeqBase[s];
+                int          len = pkt.size() - ihl - doff;
+                if (off != rcvOff[s]) {
+                    printError(myName, "S%d - Received offset %d instead of %d.\n", s, off, rcvOff[s]);
+                    nrErr++;
+                }
+                for (int i=0; i<len; i++) {
+                    if (pkt[ihl+doff+i] != payloadByte(s, sSeqBase[s]+off+i)) {
+                        nrErr++;
+                    }
+                }
+                rcvOff[s]   = off + len;
+                payloadCnt += len;
+                ssRXeToTSt_Qry.write(RXeTxSarQuery(s, seq+len, 0xFFFF, TOE_MAX_CONGESTION_WINDOW, 0, false));
+                if (rcvOff[s] == (unsigned)cPayload) {
+                    done++;
+                }
+                pkt.clear();
+            }
+        }
+        gSimCycCnt++;
+    }
+
+    //-- Let the last acknowledgments and completions drain
+    for (int i=0; i<64; i++) {
+        tx_sar_table(
+            ssRXeToTSt_Qry, ssTStToRXe_Rep,
+            ssTXeToTSt_Qry, ssTStToTXe_Rep,
+            ssTAiToTSt_Push, ssTStToTAi_Push, ssTStToBPl_Rel);
+        tx_app_interface(
+            ssOpnReq, ssOpnRep, ssClsReq,
+            ssAppData, ssSndReq, ssSndRep, ssSndDsc, ssSndCpl,
+            ssMemWrCmd, ssMemWrData, ssMemWrSts,
+            ssSttReq, ssSttRep, ssSttQry, ssSttQryRep,
+            ssSlcReq, ssSlcRep,
+            ssPrtReq, ssPrtRep,
+            ssTStToTAi_Push, ssTAiToTSt_Push,
+            ssActSessState,
+            ssTAiToEVe_Event,
+            ssTImNotif,
+            0x0A0C0001);
+        while (!ssSndCpl.empty()) {
+            TcpAppSndCpl cpl = ssSndCpl.read();
+            cplAddr[cpl.sessId] = cpl.addr;
+            cplDone[cpl.sessId] = cplDone[cpl.sessId] or cpl.done;
+        }
+    }
+
+    for (int s=0; s<cNrSessions; s++) {
+        if (rcvOff[s] != (unsigned)cPayload) {
+            printError(myName, "S%d - Received %d bytes instead of %d.\n", s, rcvOff[s], cPayload);
+            nrErr++;
+        }
+        if (zeroCopy and (!cplDone[s] or (cplAddr[s] != cRoleBase + s*0x1000000 + cPayload))) {
+            printError(myName, "S%d - The APP buffer was not entirely released (addr=0x%8.8x, done=%d).\n",
+                       s, cplAddr[s].to_uint(), cplDone[s]);
+            nrErr++;
+        }
+        sSeqBase[s] += cPayload;
+    }
+
+    size_t memWr = dram.wrCnt - memWr0;
+    size_t memRd = dram.rdCnt - memRd0;
+    printInfo(myName, "%-9s - Payload=%7zu bytes in %7d cycles - DDR: role-rd=%7zu toe-wr=%7zu toe-rd=%7zu  -->  %4.2f DDR bytes per payload byte.\n",
+              zeroCopy ? "Zero-copy" : "Streamed", payloadCnt, cyc, roleRdCnt, memWr, memRd,
+              (double)(roleRdCnt + memWr + memRd) / payloadCnt);
+    return nrErr;
+}
+
+/*******************************************************************************
+ * @brief Main function.
+ *******************************************************************************/
+int main(int argc, char* argv[]) {
+
+    SimDram dram;
+    int     nrErr = 0;
+
+    printInfo(THIS_NAME, "############################################################################\n");
+    printInfo(THIS_NAME, "## TESTBENCH 'test_zero_copy' STARTS HERE                                 ##\n");
+    printInfo(THIS_NAME, "############################################################################\n");
+
+    nrErr += runMode(false, dram);
+    nrErr += runMode(true,  dram);
+
+    if (nrErr) {
+        printError(THIS_NAME, "###########################################################\n");
+        printError(THIS_NAME, "#### TEST BENCH FAILED : TOTAL NUMBER OF ERROR(S) = %2d ####\n", nrErr);
+        printError(THIS_NAME, "###########################################################\n");
+    }
+    else {
+        printInfo(THIS_NAME, "#############################################################\n");
+        printInfo(THIS_NAME, "####               SUCCESSFUL END OF TEST                ####\n");
+        printInfo(THIS_NAME, "#############################################################\n");
+    }
+
+    return nrErr;
+}
+
+/*! \} */
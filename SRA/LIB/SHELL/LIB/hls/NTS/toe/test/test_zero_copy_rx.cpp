@@ -0,0 +1,384 @@
+/*
+ * Copyright 2016 -- 2021 IBM Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*******************************************************************************
+ * @file       : test_zero_copy_rx.cpp
+ * @brief      : DDR traffic benchmark of the streamed and zero-copy receive paths.
+ *
+ * System:     : cloudFPGA
+ * Component   : Shell, Network Transport Stack (NTS)
+ * Language    : Vivado HLS
+ *
+ * @details
+ *  This testbench instantiates the Rx application path of the TOE (i.e. [RAi]
+ *  and [RSt]) and emulates the DRAM, the [RXe] and a role which processes the
+ *  received data in DDR. The same amount of payload is received twice:
+ *   1) with 'TcpAppRdReq' : the TOE reads the data from the Rx buffer and
+ *      streams them to the role which writes them into its own DDR buffer.
+ *   2) with read descriptors : the role processes the data in the Rx buffer of
+ *      the session and returns a credit once it is done with them.
+ *  The [RXe] model only writes into the Rx buffer when the receive window
+ *  advertised by [RSt] allows it. In zero-copy mode, the data are checked when
+ *  their credit is returned, which also verifies that the window remained
+ *  closed over the bytes held by the role. The final processing read of the
+ *  role is not counted.
+ *
+ *  Usage: 'make csimZeroCopyRx' from the 'toe' directory.
+ *
+ * \ingroup NTS_TOE
+ * \addtogroup NTS_TOE_TEST
+ * \{
+ *******************************************************************************/
+
+#include <cstdlib>
+#include <deque>
+#include <map>
+#include <vector>
+
+#include "../src/rx_app_interface/rx_app_interface.hpp"
+#include "../src/rx_sar_table/rx_sar_table.hpp"
+
+using namespace hls;
+using namespace std;
+
+#define THIS_NAME "TB"
+
+//---------------------------------------------------------
+//-- TESTBENCH GLOBAL VARIABLES
+//---------------------------------------------------------
+bool            gTraceEvent   = false;
+bool            gFatalError   = false;
+unsigned int    gSimCycCnt    = 0;
+
+//---------------------------------------------------------
+//-- TESTBENCH DEFINES
+//---------------------------------------------------------
+const int          cNrSessions = 4;
+const int          cPayload    = 256*1024;  // Bytes received per session and per run
+const int          cSegLen     = 1460;      // Bytes per segment written by [RXe]
+const int          cCrdDelay   = 2000;      // Cycles spent by the role on a descriptor
+const int          cMaxCycles  = 4000000;
+const unsigned int cIrs        = 0xABCD1234;
+
+/*******************************************************************************
+ * @brief The payload byte found at 'offset' in the data of session 'sessId'.
+ *******************************************************************************/
+ap_uint<8> payloadByte(int sessId, unsigned int offset)
+{
+    return (sessId*17 + offset*5 + (offset >> 8) + (offset >> 16)*3) & 0xFF;
+}
+
+/*******************************************************************************
+ * @brief The DRAM address of the byte with sequence number 'seq' in the Rx
+ *  buffer of session 'sessId'.
+ *
+ * @details
+ *  A segment which runs past the end of the Rx buffer continues into the spill
+ *   region when TOE_SPILL_CFG is set, and at the beginning of the buffer
+ *   otherwise. 'segSeq' is the sequence number of the first byte of the
+ *   segment which holds 'seq'.
+ *******************************************************************************/
+uint64_t rxBufAddr(int sessId, unsigned int seq, unsigned int segSeq)
+{
+    uint64_t sliceAddr = TOE_RX_MEMORY_BASE + ((uint64_t)sessId << TOE_SLICE_BITS);
+    if (TOE_SPILL_CFG) {
+        return sliceAddr + (segSeq & (TOE_RX_BUFFER_SIZE-1)) + (seq - segSeq);
+    }
+    return sliceAddr + (seq & (TOE_RX_BUFFER_SIZE-1));
+}
+
+/*******************************************************************************
+ * @brief A read descriptor held by the role until its credit is returned.
+ *******************************************************************************/
+struct HeldDsc {
+    TcpAppRdDsc  dsc;
+    unsigned int offset;   // Offset of the first byte in the payload of the run
+    int          dueCyc;   // Cycle at which the credit is returned
+};
+
+/*******************************************************************************
+ * @brief Run one receive mode through [RAi] and [RSt].
+ *
+ * @param[in]     zeroCopy  Use read descriptors instead of read requests.
+ * @param[in,out] dram      The bytes of the emulated DRAM.
+ *
+ * @return the number of errors.
+ *******************************************************************************/
+int runMode(bool zeroCopy, map<uint64_t, ap_uint<8> > &dram)
+{
+    const char *myName = concat3(THIS_NAME, "/", "Bench");
+
+    //-- Streams of the DUTs (static: the DUTs keep their state across runs)
+    static stream<TcpAppNotif>    ssNotif("ssNotif");
+    static stream<TcpAppRdReq>    ssDataReq("ssDataReq");
+    static stream<TcpAppData>     ssAppData("ssAppData");
+    static stream<TcpAppMeta>     ssAppMeta("ssAppMeta");
+    static stream<TcpAppRdReq>    ssDscReq("ssDscReq");
+    static stream<TcpAppRdDsc>    ssRdDsc("ssRdDsc");
+    static stream<TcpAppRxCrd>    ssRxCrd("ssRxCrd");
+    static stream<TcpAppLsnReq>   ssLsnReq("ssLsnReq");
+    static stream<TcpAppLsnRep>   ssLsnRep("ssLsnRep");
+    static stream<TcpAppLsnReq>   ssPRtLsnReq("ssPRtLsnReq");
+    static stream<AckBit>         ssPRtLsnAck("ssPRtLsnAck");
+    static stream<TcpAppNotif>    ssRXeNotif("ssRXeNotif");
+    static stream<TcpAppNotif>    ssTImNotif("ssTImNotif");
+    static stream<RAiRxSarQuery>  ssRAiToRSt_Qry("ssRAiToRSt_Qry");
+    static stream<RAiRxSarReply>  ssRStToRAi_Rep("ssRStToRAi_Rep");
+    static stream<DmCmd>          ssMemRdCmd("ssMemRdCmd");
+    static stream<AxisApp>        ssMemRdData("ssMemRdData");
+    static stream<ap_uint<8> >    ssNotifDropCnt("ssNotifDropCnt");
+    static stream<ap_uint<8> >    ssMetaDropCnt("ssMetaDropCnt");
+    static stream<ap_uint<8> >    ssDataDropCnt("ssDataDropCnt");
+    static stream<RXeRxSarQuery>  ssRXeToRSt_Qry("ssRXeToRSt_Qry");
+    static stream<RxSarReply>     ssRStToRXe_Rep("ssRStToRXe_Rep");
+    static stream<SessionId>      ssTXeToRSt_Req("ssTXeToRSt_Req");
+    static stream<RxSarReply>     ssRStToTXe_Rep("ssRStToTXe_Rep");
+    static stream<BufPageRel>     ssRStToBPl_Rel("ssRStToBPl_Rel");
+
+    //-- Per session state of the [RXe] model and of the role
+    static bool         sInitDone = false;
+    static unsigned int sSeqBase[cNrSessions];  // Offset of the first byte of this run
+    unsigned int wrOff[cNrSessions];     // Next offset written by [RXe]
+    vector<uint64_t> byteAddr[cNrSessions]; // DRAM address of every byte of the run
+    unsigned int rdOff[cNrSessions];     // Next offset consumed by the role
+    bool         waitWin = false;        // A window query is pending
+    int          nextSess = 0;
+    deque<int>   pendReq;                // Sessions of the outstanding data requests
+    deque<TcpAppNotif> pendNotif;        // Notifications waiting for [RSt] to be updated
+    deque<HeldDsc> heldDsc;
+    size_t       memWrCnt=0, memRdCnt=0, roleWrCnt=0, payloadCnt=0;
+    int          nrErr = 0;
+
+    if (!sInitDone) {
+        //-- Initialize the Rx SAR table as a 3-way handshake would do
+        for (int s=0; s<cNrSessions; s++) {
+            ssRXeToRSt_Qry.write(RXeRxSarQuery(s, cIrs+1, QUERY_WR, QUERY_INIT));
+            sSeqBase[s] = 0;
+        }
+        sInitDone = true;
+    }
+    for (int s=0; s<cNrSessions; s++) {
+        wrOff[s] = 0; rdOff[s] = 0;
+        byteAddr[s].resize(cPayload);
+    }
+
+    int cyc, done=0;
+    for (cyc=0; (cyc<cMaxCycles) and (done<cNrSessions); cyc++) {
+        //-- RXe: Poll the window of the sessions in turn and fill it segment-wise
+        if (!waitWin and (cyc > cNrSessions) and ssRXeToRSt_Qry.empty()) {
+            ssTXeToRSt_Req.write(nextSess);
+            waitWin = true;
+        }
+        else if (!ssRStToTXe_Rep.empty()) {
+            RxSarReply rep = ssRStToTXe_Rep.read();
+            int      s    = nextSess;
+            RxBufPtr free = rep.appd - (RxBufPtr)rep.rcvd(TOE_WINDOW_BITS-1, 0) - 1;
+            int      len  = min(cSegLen, cPayload - (int)wrOff[s]);
+            if ((len > 0) and (free >= len)) {
+                unsigned int seq = cIrs + 1 + sSeqBase[s] + wrOff[s];
+                for (int i=0; i<len; i++) {
+                    byteAddr[s][wrOff[s]+i] = rxBufAddr(s, seq+i, seq);
+                    dram[byteAddr[s][wrOff[s]+i]] = payloadByte(s, sSeqBase[s]+wrOff[s]+i);
+                }
+                memWrCnt  += len;
+                wrOff[s]  += len;
+                RXeRxSarQuery rxSarQry(s, seq+len, QUERY_WR);
+                rxSarQry.spill = getSpill(seq & (TOE_RX_BUFFER_SIZE-1), len);
+                ssRXeToRSt_Qry.write(rxSarQry);
+                pendNotif.push_back(TcpAppNotif(s, len, 0x0A0C0002, 0x8000+s, 80));
+            }
+            nextSess = (nextSess + 1) % cNrSessions;
+            waitWin = false;
+        }
+        if (!pendNotif.empty() and ssRXeToRSt_Qry.empty()) {
+            //-- Like [RXe], notify the APP once the [RSt] knows about the data
+            ssRXeNotif.write(pendNotif.front());
+            pendNotif.pop_front();
+        }
+
+        //-- ROLE: Request every notified byte
+        if (!ssNotif.empty()) {
+            TcpAppNotif notif = ssNotif.read();
+            if (notif.tcpDatLen != 0) {
+                if (zeroCopy) {
+                    ssDscReq.write(TcpAppRdReq(notif.sessionID, notif.tcpDatLen));
+                }
+                else {
+                    ssDataReq.write(TcpAppRdReq(notif.sessionID, notif.tcpDatLen));
+                    pendReq.push_back(notif.sessionID.to_int());
+                }
+            }
+        }
+        if (!ssAppMeta.empty()) {
+            ssAppMeta.read();
+        }
+        if (!ssAppData.empty()) {
+            //-- Check the streamed bytes and write them into the role buffer
+            TcpAppData chunk = ssAppData.read();
+            int s = pendReq.front();
+            for (int lane=0; lane<ARW/8; lane++) {
+                if (chunk.getLE_TKeep()[lane]) {
+                    if (chunk.getLE_TData(8*lane+7, 8*lane) != payloadByte(s, sSeqBase[s]+rdOff[s])) {
+                        nrErr++;
+                    }
+                    rdOff[s]++;
+                    roleWrCnt++;
+                    payloadCnt++;
+                }
+            }
+            if (chunk.getTLast()) {
+                pendReq.pop_front();
+                if (rdOff[s] == (unsigned)cPayload) {
+                    done++;
+                }
+            }
+        }
+        if (!ssRdDsc.empty()) {
+            TcpAppRdDsc dsc = ssRdDsc.read();
+            int s = dsc.sessId.to_int();
+            if (dsc.addr != byteAddr[s][rdOff[s]]) {
+                printError(myName, "S%d - Received descriptor address 0x%8.8x instead of 0x%8.8llx.\n",
+                           s, dsc.addr.to_uint(), (unsigned long long)byteAddr[s][rdOff[s]]);
+                nrErr++;
+            }
+            uint64_t lastAddr = byteAddr[s][rdOff[s] + dsc.length.to_uint() - 1];
+            bool wrap = (lastAddr != (dsc.addr.to_uint64() + dsc.length.to_uint() - 1));
+            if (dsc.wrap != wrap) {
+                printError(myName, "S%d - The wrap flag of the descriptor is wrong.\n", s);
+                nrErr++;
+            }
+            HeldDsc held = { dsc, rdOff[s], cyc + cCrdDelay };
+            heldDsc.push_back(held);
+            rdOff[s] += dsc.length;
+        }
+        if (!heldDsc.empty() and (heldDsc.front().dueCyc <= cyc)) {
+            //-- Process the bytes in place (they must not have been overwritten) and release them
+            HeldDsc held = heldDsc.front();
+            int s = held.dsc.sessId.to_int();
+            for (int i=0; i<held.dsc.length; i++) {
+                if (dram[byteAddr[s][held.offset+i]] != payloadByte(s, sSeqBase[s]+held.offset+i)) {
+                    nrErr++;
+                }
+            }
+            ssRxCrd.write(TcpAppRxCrd(held.dsc.sessId, held.dsc.length));
+            payloadCnt += held.dsc.length;
+            if (held.offset + held.dsc.length == (unsigned)cPayload) {
+                done++;
+            }
+            heldDsc.pop_front();
+        }
+
+        //-- DUTs
+        rx_app_interface(
+            ssNotif, ssDataReq, ssAppData, ssAppMeta,
+            ssDscReq, ssRdDsc, ssRxCrd,
+            ssLsnReq, ssLsnRep,
+            ssPRtLsnReq, ssPRtLsnAck,
+            ssRXeNotif, ssTImNotif,
+            ssRAiToRSt_Qry, ssRStToRAi_Rep,
+            ssMemRdCmd, ssMemRdData,
+            ssNotifDropCnt, ssMetaDropCnt, ssDataDropCnt);
+        rx_sar_table(
+            ssRXeToRSt_Qry, ssRStToRXe_Rep,
+            ssRAiToRSt_Qry, ssRStToRAi_Rep,
+            ssTXeToRSt_Req, ssRStToTXe_Rep, ssRStToBPl_Rel);
+
+        //-- Model of the DRAM read data mover
+        if (!ssMemRdCmd.empty()) {
+            DmCmd    cmd  = ssMemRdCmd.read();
+            uint64_t addr = cmd.saddr.to_uint64();
+            int      len  = cmd.btt.to_int();
+            for (int i=0; i<len; i+=ARW/8) {
+                AxisApp chunk(0, 0, 0);
+                for (int lane=0; (lane<ARW/8) and (i+lane<len); lane++) {
+                    chunk.setLE_TData(dram[addr+i+lane], 8*lane+7, 8*lane);
+                    chunk.setLE_TKeep(1, lane, lane);
+                }
+                if (i+ARW/8 >= len) {
+                    chunk.setLE_TLast(TLAST);
+                }
+                ssMemRdData.write(chunk);
+            }
+            memRdCnt += len;
+        }
+        while (!ssRStToRXe_Rep.empty()) { ssRStToRXe_Rep.read(); }
+        while (!ssNotifDropCnt.empty()) { ssNotifDropCnt.read(); }
+        while (!ssMetaDropCnt.empty())  { ssMetaDropCnt.read();  }
+        while (!ssDataDropCnt.empty())  { ssDataDropCnt.read();  }
+        gSimCycCnt++;
+    }
+
+    //-- Let the last credits drain
+    for (int i=0; i<16; i++) {
+        rx_app_interface(
+            ssNotif, ssDataReq, ssAppData, ssAppMeta,
+            ssDscReq, ssRdDsc, ssRxCrd,
+            ssLsnReq, ssLsnRep,
+            ssPRtLsnReq, ssPRtLsnAck,
+            ssRXeNotif, ssTImNotif,
+            ssRAiToRSt_Qry, ssRStToRAi_Rep,
+            ssMemRdCmd, ssMemRdData,
+            ssNotifDropCnt, ssMetaDropCnt, ssDataDropCnt);
+        rx_sar_table(
+            ssRXeToRSt_Qry, ssRStToRXe_Rep,
+            ssRAiToRSt_Qry, ssRStToRAi_Rep,
+            ssTXeToRSt_Req, ssRStToTXe_Rep, ssRStToBPl_Rel);
+    }
+
+    for (int s=0; s<cNrSessions; s++) {
+        if (rdOff[s] != (unsigned)cPayload) {
+            printError(myName, "S%d - Consumed %d bytes instead of %d.\n", s, rdOff[s], cPayload);
+            nrErr++;
+        }
+        sSeqBase[s] += cPayload;
+    }
+
+    printInfo(myName, "%-9s - Payload=%7zu bytes in %7d cycles - DDR: toe-wr=%7zu toe-rd=%7zu role-wr=%7zu  -->  %4.2f DDR bytes per payload byte.\n",
+              zeroCopy ? "Zero-copy" : "Streamed", payloadCnt, cyc, memWrCnt, memRdCnt, roleWrCnt,
+              (double)(memWrCnt + memRdCnt + roleWrCnt) / payloadCnt);
+    return nrErr;
+}
+
+/*******************************************************************************
+ * @brief Main function.
+ *******************************************************************************/
+int main(int argc, char* argv[]) {
+
+    map<uint64_t, ap_uint<8> > dram;
+    int nrErr = 0;
+
+    printInfo(THIS_NAME, "############################################################################\n");
+    printInfo(THIS_NAME, "## TESTBENCH 'test_zero_copy_rx' STARTS HERE                              ##\n");
+    printInfo(THIS_NAME, "############################################################################\n");
+
+    nrErr += runMode(false, dram);
+    nrErr += runMode(true,  dram);
+
+    if (nrErr) {
+        printError(THIS_NAME, "###########################################################\n");
+        printError(THIS_NAME, "#### TEST BENCH FAILED : TOTAL NUMBER OF ERROR(S) = %2d ####\n", nrErr);
+        printError(THIS_NAME, "###########################################################\n");
+    }
+    else {
+        printInfo(THIS_NAME, "#############################################################\n");
+        printInfo(THIS_NAME, "####               SUCCESSFUL END OF TEST                ####\n");
+        printInfo(THIS_NAME, "#############################################################\n");
+    }
+
+    return nrErr;
+}
+
+/*! \} */
@@ -34,7 +34,7 @@ set xilPartName    "xcku060-ffva1156-2-i"
 
 set ipName         ${projectName}
 set ipDisplayName  "HLS-based CAM for TOE"
-set ipDescription  "A Content-Addressable Memory with small (8) number of entries."
+set ipDescription  "A Content-Addressable Memory implemented as a multi-way cuckoo hash table."
 set ipVendor       "IBM"
 set ipLibrary      "hls"
 set ipVersion      "1.0"
@@ -22,9 +22,10 @@
  * Component : Shell, Network Transport Stack (NTS)
  * Language  : Vivado HLS
  *
- * @note     : This is a fake implementation of a CAM that is used for debugging
- *              purposes. This CAM implements 8 entries in FF and consumes a
- *              total of 2K LUTs.
+ * @note     : This CAM is implemented as a multi-way cuckoo hash table backed
+ *              by BRAMs. It replaces the former fake implementation of 8 entries
+ *              in FF and scales with the number of sessions ('TOE_MAX_SESSIONS')
+ *              while keeping a lookup rate of one request per clock cycle.
  *
  * \ingroup NTS
  * \addtogroup NTS_TOECAM
@@ -59,156 +60,142 @@ using namespace hls;
   /************************************************
    * GLOBAL VARIABLES & DEFINES
    ************************************************/
-  #define CAM_ARRAY_SIZE  2
-  static KeyValuePair CamArray0;
-  static KeyValuePair CamArray1;
-  static KeyValuePair CamArray2;
-  static KeyValuePair CamArray3;
-  static KeyValuePair CamArray4;
-  static KeyValuePair CamArray5;
-  static KeyValuePair CamArray6;
-  static KeyValuePair CamArray7;
+  static KeyValuePair CAM_TABLE[cCamNrWays][cCamWayDepth];
+  static KeyValuePair CAM_STASH[cCamStashSize];
+
+  //-- One hash seed per way (must provide 'cCamNrWays' seeds)
+  const ap_uint<32> cCamHashSeed[cCamNrWays] = {
+      0x9E3779B9, 0x85EBCA6B, 0xC2B2AE35, 0x27D4EB2F };
 
 /*******************************************************************************
- * @brief Search the CAM array for a key.
+ * @brief Rotate a 32-bit word to the left.
+ *
+ * @param[in]  word  The word to rotate.
+ * @param[in]  k     The number of bit positions to rotate by (0 < k < 32).
+ *
+ * @return the rotated word.
+ *******************************************************************************/
+ap_uint<32> camRotl(ap_uint<32> word, int k)
+{
+    #pragma HLS INLINE
+    ap_uint<32> hi = word << k;
+    ap_uint<32> lo = word >> (32-k);
+    return (hi | lo);
+}
+
+/*******************************************************************************
+ * @brief Compute the index of a key within one of the ways of the CAM.
+ *
+ * @param[in]  key   The key to hash.
+ * @param[in]  way   The number of the way to compute the index for.
+ *
+ * @return the index of the bucket within that way.
+ *
+ * @details
+ *  This is the final mixing function of Bob Jenkins' 'lookup3' hash. It only
+ *   uses additions, XORs and rotations (i.e. wires) and therefore maps onto
+ *   a few levels of LUTs and carry chains. Each way uses its own seed.
+ *******************************************************************************/
+CamWayIdx camHash(FourTuple key, int way)
+{
+    #pragma HLS INLINE
+    ap_uint<32> a = key.theirIp + cCamHashSeed[way];
+    ap_uint<32> b = key.myIp    + cCamHashSeed[way];
+    ap_uint<32> c = (key.theirPort, key.myPort);
+    c = c + cCamHashSeed[way];
+    c ^= b; c -= camRotl(b, 14);
+    a ^= c; a -= camRotl(c, 11);
+    b ^= a; b -= camRotl(a, 25);
+    c ^= b; c -= camRotl(b, 16);
+    a ^= c; a -= camRotl(c,  4);
+    b ^= a; b -= camRotl(a, 14);
+    c ^= b; c -= camRotl(b, 24);
+    return c(cCamWayBits-1, 0);
+}
+
+/*******************************************************************************
+ * @brief Search the CAM tables and the stash for a key.
  *
  * @param[in]  key   The key to lookup.
  * @param[out] value The value corresponding to that key.
  *
- * @return true if the the key was found.
+ * @return the location of the key. The 'hit' field is set if the key was found.
  *******************************************************************************/
-bool camLookup(FourTuple key, RtlSessId &value)
+CamLocation camLookup(FourTuple key, RtlSessId &value)
 {
-    #pragma HLS pipeline II=1 enable_flush
-    if ((CamArray0.key == key) && (CamArray0.valid == true)) {
-        value = CamArray0.value;
-        return true;
-    }
-    else if ((CamArray1.key == key) && (CamArray1.valid == true)) {
-        value = CamArray1.value;
-        return true;
-    }
-    else if ((CamArray2.key == key) && (CamArray2.valid == true)) {
-        value = CamArray2.value;
-        return true;
-    }
-    else if ((CamArray3.key == key) && (CamArray3.valid == true)) {
-            value = CamArray3.value;
-            return true;
-    }
-    else if ((CamArray4.key == key) && (CamArray4.valid == true)) {
-            value = CamArray4.value;
-            return true;
-    }
-    else if ((CamArray5.key == key) && (CamArray5.valid == true)) {
-            value = CamArray5.value;
-            return true;
-    }
-    else if ((CamArray6.key == key) && (CamArray6.valid == true)) {
-            value = CamArray6.value;
-            return true;
+    #pragma HLS INLINE
+
+    CamLocation loc;
+
+    for (int w=0; w<cCamNrWays; w++) {
+        #pragma HLS UNROLL
+        CamWayIdx    idx   = camHash(key, w);
+        KeyValuePair entry = CAM_TABLE[w][idx];
+        if (entry.valid and (entry.key == key)) {
+            value       = entry.value;
+            loc.hit     = true;
+            loc.inStash = false;
+            loc.way     = w;
+            loc.idx     = idx;
+        }
     }
-    else if ((CamArray7.key == key) && (CamArray7.valid == true)) {
-            value = CamArray7.value;
-            return true;
+    for (int s=0; s<cCamStashSize; s++) {
+        #pragma HLS UNROLL
+        if (CAM_STASH[s].valid and (CAM_STASH[s].key == key)) {
+            value       = CAM_STASH[s].value;
+            loc.hit     = true;
+            loc.inStash = true;
+            loc.slot    = s;
+        }
     }
-    else
-        return false;
+    return loc;
 }
 
 /*******************************************************************************
- * @brief Insert a new key-value pair in the CAM array.
+ * @brief Search the buckets of a key for an empty entry.
  *
- * @param[in]  KeyValuePair  The key-value pair to insert.
+ * @param[in]  key   The key to insert.
+ * @param[out] loc   The location of the first empty bucket (if any).
  *
- * @return true if the the key was inserted.
+ * @return true if an empty bucket was found.
  *******************************************************************************/
-bool camInsert(KeyValuePair kVP)
+bool camFindEmpty(FourTuple key, CamLocation &loc)
 {
-    #pragma HLS pipeline II=1 enable_flush
+    #pragma HLS INLINE
 
-    if (CamArray0.valid == false) {
-        CamArray0 = kVP;
-        return true;
-    }
-    else if (CamArray1.valid == false) {
-        CamArray1 = kVP;
-        return true;
-    }
-    else if (CamArray2.valid == false) {
-         CamArray2 = kVP;
-         return true;
-     }
-    else if (CamArray3.valid == false) {
-         CamArray3 = kVP;
-         return true;
-    }
-    else if (CamArray4.valid == false) {
-        CamArray4 = kVP;
-        return true;
-    }
-    else if (CamArray5.valid == false) {
-        CamArray5 = kVP;
-        return true;
-    }
-    else if (CamArray6.valid == false) {
-         CamArray6 = kVP;
-         return true;
-     }
-    else if (CamArray7.valid == false) {
-         CamArray7 = kVP;
-         return true;
-     }
-    else {
-        return false;
+    bool found = false;
+    for (int w=cCamNrWays-1; w>=0; w--) {
+        #pragma HLS UNROLL
+        CamWayIdx idx = camHash(key, w);
+        if (not CAM_TABLE[w][idx].valid) {
+            loc.way = w;
+            loc.idx = idx;
+            found   = true;
+        }
     }
+    return found;
 }
 
 /*******************************************************************************
- * @brief Remove a key-value pair from the CAM array.
+ * @brief Search the stash for a free slot.
  *
- * @param[in]  key  The key of the entry to be removed.
+ * @param[out] slot  The index of the first free slot (if any).
  *
- * @return true if the the key was deleted.
-  ******************************************************************************/
-bool camDelete(FourTuple key)
+ * @return true if a free slot was found.
+ *******************************************************************************/
+bool camFindFreeStashSlot(CamStashIdx &slot)
 {
-    #pragma HLS pipeline II=1 enable_flush
+    #pragma HLS INLINE
 
-    if ((CamArray0.key == key) && (CamArray0.valid == true)) {
-        CamArray0.valid = false;
-        return true;
-    }
-    else if ((CamArray1.key == key) && (CamArray1.valid == true)) {
-        CamArray1.valid = false;
-        return true;
-    }
-    else if ((CamArray2.key == key) && (CamArray2.valid == true)) {
-        CamArray2.valid = false;
-        return true;
-    }
-    else if ((CamArray3.key == key) && (CamArray3.valid == true)) {
-        CamArray3.valid = false;
-        return true;
-    }
-    else if ((CamArray4.key == key) && (CamArray4.valid == true)) {
-        CamArray4.valid = false;
-        return true;
-    }
-    else if ((CamArray5.key == key) && (CamArray5.valid == true)) {
-        CamArray5.valid = false;
-        return true;
-    }
-    else if ((CamArray6.key == key) && (CamArray6.valid == true)) {
-        CamArray6.valid = false;
-        return true;
+    bool found = false;
+    for (int s=cCamStashSize-1; s>=0; s--) {
+        #pragma HLS UNROLL
+        if (not CAM_STASH[s].valid) {
+            slot  = s;
+            found = true;
+        }
     }
-    else if ((CamArray7.key == key) && (CamArray7.valid == true)) {
-         CamArray7.valid = false;
-         return true;
-     }
-    else
-        return false;
+    return found;
 }
 
 /*******************************************************************************
@@ -220,6 +207,21 @@ bool camDelete(FourTuple key)
  * @param[in]  siTOE_SssUpdReq  Session update request from TOE.
  * @param[out] soTOE_SssUpdRep  Session update reply   to   TOE.
  *
+ * @details
+ *  Lookup requests are served at a rate of one per clock cycle by reading the
+ *   bucket of the key in every way, as well as the stash, in parallel.
+ *  Insert requests are first tried into an empty bucket of one of the ways.
+ *   If all the buckets of the key are occupied, a victim is kicked out of a
+ *   random way and re-inserted into one of its alternate buckets, and so forth
+ *   for at most 'cCamMaxKicks' iterations before the homeless entry is parked
+ *   into the stash. A kick chain is only started if the stash has a free slot,
+ *   such that an insertion never evicts a previously inserted entry. An insert
+ *   request is replied with STS_KO if its key is already in the CAM (the entry
+ *   in place is kept) or if the CAM is full. Whenever the CAM is idle, the
+ *   entries of the stash are moved back into the ways.
+ *  Upon reset, the ways are cleared one index per clock cycle and the ready
+ *   signal is only asserted once the entire CAM has been initialized.
+ *
  * @warning
  *  About data structure packing: The bit alignment of a packed wide-word
  *    is inferred from the declaration order of the struct fields. The first
@@ -251,104 +253,169 @@ void toecam(
     const char *myName  = concat3(THIS_NAME, "/", "CAM");
 
     //-- STATIC ARRAYS ---------------------------------------------------------
-    #pragma HLS RESET      variable=CamArray0
-    #pragma HLS RESET      variable=CamArray1
-    #pragma HLS RESET      variable=CamArray2
-    #pragma HLS RESET      variable=CamArray3
-    #pragma HLS RESET      variable=CamArray4
-    #pragma HLS RESET      variable=CamArray5
-    #pragma HLS RESET      variable=CamArray6
-    #pragma HLS RESET      variable=CamArray7
+    #pragma HLS ARRAY_PARTITION variable=CAM_TABLE complete dim=1
+    #pragma HLS RESOURCE        variable=CAM_TABLE core=RAM_T2P_BRAM
+    #pragma HLS ARRAY_PARTITION variable=CAM_STASH complete dim=1
+    #pragma HLS RESET           variable=CAM_STASH
 
     //-- STATIC CONTROL VARIABLES (with RESET) ---------------------------------
-    static enum FsmStates { CAM_WAIT_4_REQ=0, CAM_LOOKUP_REP, CAM_UPDATE_REP } \
-                               cam_fsmState=CAM_WAIT_4_REQ;
+    static enum FsmStates { CAM_INIT=0, CAM_WAIT_4_REQ, CAM_INSERT_KICK } \
+                               cam_fsmState=CAM_INIT;
     #pragma HLS RESET variable=cam_fsmState
-    static int                 cam_startupDelay = 100;
-    #pragma HLS RESET variable=cam_startupDelay
+    static CamWayIdx           cam_initIdx=0;
+    #pragma HLS RESET variable=cam_initIdx
+    static CamStashIdx         cam_drainSlot=0;
+    #pragma HLS RESET variable=cam_drainSlot
+    static ap_uint<16>         cam_lfsr=0xACE1;
+    #pragma HLS RESET variable=cam_lfsr
+    static ap_uint<16>         cam_insFailCnt=0;
+    #pragma HLS RESET variable=cam_insFailCnt
 
     //-- STATIC DATAFLOW VARIABLES --------------------------------------------
-    static CamSessionLookupRequest cam_request;
     static CamSessionUpdateRequest cam_update;
-    static int                     cam_idleCnt = 0;
-
-    //-----------------------------------------------------
-    //-- EMULATE STARTUP OF CAM
-    //-----------------------------------------------------
-    if (cam_startupDelay) {
-        *poMMIO_CamReady = 0;
-        cam_startupDelay--;
-        return;
-    }
-    else {
-        *poMMIO_CamReady = 1;
-    }
+    static KeyValuePair            cam_homeless;
+    static CamWayNum               cam_prevWay;
+    static ap_uint<log2Ceil<cCamMaxKicks>::val+1> \
+                                   cam_kickCnt;
+
+    //-- DYNAMIC VARIABLES -----------------------------------------------------
+    CamSessionLookupRequest  request;
+    RtlSessId                rtlValue;
+    CamLocation              loc;
+    CamLocation              empty;
+    CamStashIdx              slot;
+    CamWayNum                way;
+    CamWayIdx                idx;
+
+    //-- Advance the pseudo-random generator used to select the victims
+    if (cam_lfsr[0])
+        cam_lfsr = (cam_lfsr >> 1) ^ 0xB400;
+    else
+        cam_lfsr = (cam_lfsr >> 1);
 
     //-----------------------------------------------------
     //-- CONTENT ADDRESSABLE MEMORY PROCESS
     //-----------------------------------------------------
     switch (cam_fsmState) {
-    case CAM_WAIT_4_REQ:
-        if (!siTOE_SssLkpReq.empty()) {
-            siTOE_SssLkpReq.read(cam_request);
-            cam_idleCnt = MAX_CAM_LATENCY;
-            cam_fsmState = CAM_LOOKUP_REP;
+    case CAM_INIT:
+        //-- Clear one index of every way per clock cycle
+        *poMMIO_CamReady = 0;
+        for (int w=0; w<cCamNrWays; w++) {
+            #pragma HLS UNROLL
+            CAM_TABLE[w][cam_initIdx].valid = false;
         }
-        else if (!siTOE_SssUpdReq.empty()) {
-            siTOE_SssUpdReq.read(cam_update);
-            cam_idleCnt = MAX_CAM_LATENCY;
-            cam_fsmState = CAM_UPDATE_REP;
+        if (cam_initIdx == cCamWayDepth-1) {
+            cam_fsmState = CAM_WAIT_4_REQ;
         }
+        cam_initIdx++;
         break;
-    case CAM_LOOKUP_REP:
-        //-- Wait some cycles to match the co-simulation --
-        if (cam_idleCnt > 0) {
-            cam_idleCnt--;
-        }
-        else {
-            RtlSessId  rtlValue;
-            bool hit = camLookup(cam_request.key, rtlValue);
-            if (hit)
-                soTOE_SssLkpRep.write(CamSessionLookupReply(true, rtlValue, cam_request.source));
+    case CAM_WAIT_4_REQ:
+        *poMMIO_CamReady = 1;
+        if (!siTOE_SssLkpReq.empty()) {
+            siTOE_SssLkpReq.read(request);
+            loc = camLookup(request.key, rtlValue);
+            if (loc.hit)
+                soTOE_SssLkpRep.write(CamSessionLookupReply(true, rtlValue, request.source));
             else
-                soTOE_SssLkpRep.write(CamSessionLookupReply(false, cam_request.source));
+                soTOE_SssLkpRep.write(CamSessionLookupReply(false, request.source));
             if (DEBUG_LEVEL & TRACE_CAM) {
                 printInfo(myName, "Received a session lookup request from %d for socket pair: \n",
-                          cam_request.source.to_int());
-                LE_SocketPair leSocketPair(LE_SockAddr(cam_request.key.theirIp, cam_request.key.theirPort),
-                LE_SockAddr(cam_request.key.myIp,    cam_request.key.myPort));
+                          request.source.to_int());
+                LE_SocketPair leSocketPair(LE_SockAddr(request.key.theirIp, request.key.theirPort),
+                LE_SockAddr(request.key.myIp,    request.key.myPort));
                 printSockPair(myName, leSocketPair);
             }
-            cam_fsmState = CAM_WAIT_4_REQ;
-        }
-        break;
-    case CAM_UPDATE_REP:
-        //-- Wait some cycles to match the co-simulation --
-        if (cam_idleCnt > 0) {
-            cam_idleCnt--;
         }
-        else {
-            // [TODO - What if element does not exist]
+        else if (!siTOE_SssUpdReq.empty()) {
+            siTOE_SssUpdReq.read(cam_update);
+            KeyValuePair kVP(cam_update.key, cam_update.value, true);
+            loc = camLookup(cam_update.key, rtlValue);
             if (cam_update.op == INSERT) {
-                //Is there a check if it already exists?
-                camInsert(KeyValuePair(cam_update.key, cam_update.value, true));
-                soTOE_SssUpdRep.write(CamSessionUpdateReply(cam_update.value, INSERT, cam_update.source));
+                if (loc.hit) {
+                    //-- The key already exists --> Keep it and let [SLc] release the new session ID
+                    cam_insFailCnt++;
+                    printWarn(myName, "Failed to insert session #%d (key already held by session #%d). Total failures = %d.\n",
+                              cam_update.value.to_int(), rtlValue.to_int(), cam_insFailCnt.to_int());
+                    soTOE_SssUpdRep.write(CamSessionUpdateReply(cam_update.value, INSERT, cam_update.source, STS_KO));
+                }
+                else if (camFindEmpty(cam_update.key, empty)) {
+                    CAM_TABLE[empty.way][empty.idx] = kVP;
+                    soTOE_SssUpdRep.write(CamSessionUpdateReply(cam_update.value, INSERT, cam_update.source));
+                }
+                else if (camFindFreeStashSlot(slot)) {
+                    //-- All the buckets are occupied --> Kick a victim out
+                    way = cam_lfsr % cCamNrWays;
+                    idx = camHash(cam_update.key, way);
+                    cam_homeless = CAM_TABLE[way][idx];
+                    CAM_TABLE[way][idx] = kVP;
+                    cam_prevWay  = way;
+                    cam_kickCnt  = 1;
+                    cam_fsmState = CAM_INSERT_KICK;
+                }
+                else {
+                    //-- The CAM is full --> Let [SLc] release the session ID
+                    cam_insFailCnt++;
+                    printWarn(myName, "Failed to insert session #%d (CAM is full). Total failures = %d.\n",
+                              cam_update.value.to_int(), cam_insFailCnt.to_int());
+                    soTOE_SssUpdRep.write(CamSessionUpdateReply(cam_update.value, INSERT, cam_update.source, STS_KO));
+                }
             }
             else {  // DELETE
-                camDelete(cam_update.key);
+                if (loc.hit) {
+                    if (loc.inStash)
+                        CAM_STASH[loc.slot].valid = false;
+                    else
+                        CAM_TABLE[loc.way][loc.idx].valid = false;
+                }
                 soTOE_SssUpdRep.write(CamSessionUpdateReply(cam_update.value, DELETE, cam_update.source));
             }
             if (DEBUG_LEVEL & TRACE_CAM) {
-                printInfo(myName, "Received a session cam_update request (%d) from %d for socket pair: \n",
+                printInfo(myName, "Received a session update request (%d) from %d for socket pair: \n",
                           cam_update.op, cam_update.source.to_int());
-                LE_SocketPair leSocketPair(LE_SockAddr(cam_request.key.theirIp, cam_request.key.theirPort),
-                LE_SockAddr(cam_request.key.myIp,    cam_request.key.myPort));
+                LE_SocketPair leSocketPair(LE_SockAddr(cam_update.key.theirIp, cam_update.key.theirPort),
+                LE_SockAddr(cam_update.key.myIp,    cam_update.key.myPort));
                 printSockPair(myName, leSocketPair);
             }
+        }
+        else {
+            //-- Idle --> Try to move an entry of the stash back into a way
+            if (CAM_STASH[cam_drainSlot].valid) {
+                if (camFindEmpty(CAM_STASH[cam_drainSlot].key, empty)) {
+                    CAM_TABLE[empty.way][empty.idx] = CAM_STASH[cam_drainSlot];
+                    CAM_STASH[cam_drainSlot].valid  = false;
+                }
+            }
+            cam_drainSlot = (cam_drainSlot == cCamStashSize-1) ? 0 : cam_drainSlot.to_int()+1;
+        }
+        break;
+    case CAM_INSERT_KICK:
+        *poMMIO_CamReady = 1;
+        if (camFindEmpty(cam_homeless.key, empty)) {
+            CAM_TABLE[empty.way][empty.idx] = cam_homeless;
+            soTOE_SssUpdRep.write(CamSessionUpdateReply(cam_update.value, INSERT, cam_update.source));
+            cam_fsmState = CAM_WAIT_4_REQ;
+        }
+        else if (cam_kickCnt == cCamMaxKicks) {
+            //-- Give up kicking --> Park the homeless entry into the stash
+            camFindFreeStashSlot(slot);
+            CAM_STASH[slot] = cam_homeless;
+            soTOE_SssUpdRep.write(CamSessionUpdateReply(cam_update.value, INSERT, cam_update.source));
             cam_fsmState = CAM_WAIT_4_REQ;
         }
+        else {
+            //-- Swap the homeless entry with a victim of another way
+            way = cam_lfsr % cCamNrWays;
+            if (way == cam_prevWay) {
+                way = (way == cCamNrWays-1) ? 0 : way.to_int()+1;
+            }
+            idx = camHash(cam_homeless.key, way);
+            KeyValuePair victim = CAM_TABLE[way][idx];
+            CAM_TABLE[way][idx] = cam_homeless;
+            cam_homeless = victim;
+            cam_prevWay  = way;
+            cam_kickCnt++;
+        }
         break;
-
     } // End-of: switch()
 
 }
@@ -35,6 +35,26 @@
 #include "../../../NTS/SimNtsUtils.hpp"
 
 
+/*******************************************************************************
+ * CONFIGURATION OF THIS CAM
+ *******************************************************************************
+ * The CAM is implemented as a multi-way cuckoo hash table. Each way is a
+ *  separate BRAM which is indexed by its own hash of the four-tuple. A lookup
+ *  reads all the ways (and the stash) in parallel and completes in a single
+ *  cycle. An insertion may displace (i.e. kick) an existing entry into one of
+ *  its alternate ways. After 'cCamMaxKicks' displacements, the last homeless
+ *  entry is parked into a small stash implemented with flip-flops.
+ *******************************************************************************/
+const int cCamNrWays     = 4;
+const int cCamWayBits    = (log2Ceil<TOE_MAX_SESSIONS>::val > 10) ? log2Ceil<TOE_MAX_SESSIONS>::val-1 : 9; // Load <= 50%
+const int cCamWayDepth   = (1 << cCamWayBits);
+const int cCamStashSize  = 4;
+const int cCamMaxKicks   = 32;
+
+typedef ap_uint<cCamWayBits>                       CamWayIdx;
+typedef ap_uint<log2Ceil<cCamNrWays>::val>         CamWayNum;
+typedef ap_uint<log2Ceil<cCamStashSize>::val>      CamStashIdx;
+
 /*******************************************************************************
  * INTERNAL TYPES and CLASSES USED BY THIS CAM
  *******************************************************************************/
@@ -52,6 +72,22 @@ class KeyValuePair {
         key(key), value(value), valid(valid) {}
 };
 
+//=========================================================
+//== CAM ENTRY LOCATION
+//==  Tells where a key was found (i.e. in which way and at
+//==  which index, or in which stash slot).
+//=========================================================
+class CamLocation {
+  public:
+    HitBool      hit;
+    HitBool      inStash;
+    CamWayNum    way;
+    CamWayIdx    idx;
+    CamStashIdx  slot;
+    CamLocation() :
+        hit(false), inStash(false), way(0), idx(0), slot(0) {}
+};
+
 
 /*******************************************************************************
  *
@@ -240,6 +240,341 @@ void pTOE(
 }
 
 
+/*******************************************************************************
+ * @brief Run the DUT for one clock cycle.
+ *
+ * @param[out] sMMIO_CamReady  The CAM ready signal.
+ * @param[in]  ssLkpReq        Session lookup request to CAM.
+ * @param[out] ssLkpRep        Session lookup reply from CAM.
+ * @param[in]  ssUpdReq        Session update request to CAM.
+ * @param[out] ssUpdRep        Session update reply from CAM.
+ *******************************************************************************/
+void stepCam(
+        StsBit                              &sMMIO_CamReady,
+        stream<CamSessionLookupRequest>     &ssLkpReq,
+        stream<CamSessionLookupReply>       &ssLkpRep,
+        stream<CamSessionUpdateRequest>     &ssUpdReq,
+        stream<CamSessionUpdateReply>       &ssUpdRep)
+{
+    toecam_top(&sMMIO_CamReady, ssLkpReq, ssLkpRep, ssUpdReq, ssUpdRep);
+    stepSim();
+}
+
+/*******************************************************************************
+ * @brief Send an update request to the CAM and wait for its reply.
+ *
+ * @param[in]  key         The key to insert or delete.
+ * @param[in]  value       The session ID associated with the key.
+ * @param[in]  op          The update operation (INSERT or DELETE).
+ * @param[out] nrCycles    The number of cycles it took to get the reply.
+ * @param[out] status      The status of the reply (STS_KO if the key is
+ *                          already in the CAM or if the CAM is full).
+ * @param[...] The interfaces of the DUT.
+ *
+ * @return true if a valid reply was received.
+ *******************************************************************************/
+bool camUpdate(
+        FourTuple                            key,
+        RtlSessId                            value,
+        LkpOpBit                             op,
+        int                                 &nrCycles,
+        StsBit                              &status,
+        StsBit                              &sMMIO_CamReady,
+        stream<CamSessionLookupRequest>     &ssLkpReq,
+        stream<CamSessionLookupReply>       &ssLkpRep,
+        stream<CamSessionUpdateRequest>     &ssUpdReq,
+        stream<CamSessionUpdateReply>       &ssUpdRep)
+{
+    ssUpdReq.write(CamSessionUpdateRequest(key, value, op, FROM_TAi));
+    nrCycles = 0;
+    while (ssUpdRep.empty()) {
+        stepCam(sMMIO_CamReady, ssLkpReq, ssLkpRep, ssUpdReq, ssUpdRep);
+        if (++nrCycles > TB_STRESS_TIMEOUT) {
+            return false;
+        }
+    }
+    CamSessionUpdateReply updReply = ssUpdRep.read();
+    status = updReply.status;
+    return ((updReply.sessionID == value) and (updReply.op == op));
+}
+
+/*******************************************************************************
+ * @brief Send a lookup request to the CAM and wait for its reply.
+ *
+ * @param[in]  key         The key to lookup.
+ * @param[out] value       The session ID returned by the CAM.
+ * @param[...] The interfaces of the DUT.
+ *
+ * @return true if the key was found in the CAM.
+ *******************************************************************************/
+bool camLookup(
+        FourTuple                            key,
+        RtlSessId                           &value,
+        StsBit                              &sMMIO_CamReady,
+        stream<CamSessionLookupRequest>     &ssLkpReq,
+        stream<CamSessionLookupReply>       &ssLkpRep,
+        stream<CamSessionUpdateRequest>     &ssUpdReq,
+        stream<CamSessionUpdateReply>       &ssUpdRep)
+{
+    ssLkpReq.write(CamSessionLookupRequest(key, FROM_RXe));
+    int nrCycles = 0;
+    while (ssLkpRep.empty()) {
+        stepCam(sMMIO_CamReady, ssLkpReq, ssLkpRep, ssUpdReq, ssUpdRep);
+        if (++nrCycles > TB_STRESS_TIMEOUT) {
+            return false;
+        }
+    }
+    CamSessionLookupReply lkpReply = ssLkpRep.read();
+    value = lkpReply.sessionID;
+    return lkpReply.hit;
+}
+
+/*******************************************************************************
+ * @brief Generate a random four-tuple which is not yet part of a given map.
+ *
+ * @param[in]  keys  The map of keys already in use.
+ *
+ * @return a new random key.
+ *******************************************************************************/
+FourTuple randomKey(map<FourTuple, RtlSessId> &keys) {
+    FourTuple key;
+    do {
+        key = FourTuple(DEFAULT_FPGA_IP4_ADDR,
+                        (rand() << 16) ^ rand(),
+                        DEFAULT_FPGA_TCP_PORT,
+                        rand() & 0xFFFF);
+    } while (keys.find(key) != keys.end());
+    return key;
+}
+
+/*******************************************************************************
+ * @brief Stress test of the CAM.
+ *
+ * @param[in]  nrErr  A ref to the error counter of main.
+ * @param[...] The interfaces of the DUT.
+ *
+ * @details
+ *  1) Perform thousands of random insert and delete operations and verify
+ *     the content of the CAM against a reference map.
+ *  2) Fill the CAM with random keys until the first insertion failure and
+ *     report the occupancy at that time.
+ *  3) Issue back-to-back lookups for all the entries and report the lookup
+ *     latency and throughput.
+ *  4) Delete all the entries and verify that they are all gone.
+ *  5) Insert keys which are looked up on the very next cycle, then insert
+ *     them a second time with another value and verify that this duplicate
+ *     is refused while the first value is kept.
+ *******************************************************************************/
+void stressCam(
+        int                                 &nrErr,
+        StsBit                              &sMMIO_CamReady,
+        stream<CamSessionLookupRequest>     &ssLkpReq,
+        stream<CamSessionLookupReply>       &ssLkpRep,
+        stream<CamSessionUpdateRequest>     &ssUpdReq,
+        stream<CamSessionUpdateReply>       &ssUpdRep)
+{
+    const char *myName = concat3(THIS_NAME, "/", "STRESS");
+
+    const int capacity = cCamNrWays*cCamWayDepth + cCamStashSize;
+    map<FourTuple, RtlSessId>           refMap;
+    map<FourTuple, RtlSessId>::iterator it;
+    RtlSessId   value;
+    StsBit      status;
+    int         nrCycles;
+    int         maxUpdCycles = 0;
+
+    srand(0x5EED);
+
+    //------------------------------------------------------
+    //-- STEP-1: RANDOM CHURN OF INSERTIONS AND DELETIONS
+    //------------------------------------------------------
+    printInfo(myName, "STEP-1: Running %d random insert/delete operations.\n", TB_STRESS_CHURN_OPS);
+    for (int op=0; op<TB_STRESS_CHURN_OPS; op++) {
+        bool doInsert = (refMap.size() < TB_STRESS_CHURN_LIVE/4) or
+                        ((refMap.size() < TB_STRESS_CHURN_LIVE) and (rand() & 1));
+        if (doInsert) {
+            FourTuple key = randomKey(refMap);
+            RtlSessId sessId = op % (1 << 14);
+            if (not camUpdate(key, sessId, INSERT, nrCycles, status, sMMIO_CamReady,
+                              ssLkpReq, ssLkpRep, ssUpdReq, ssUpdRep)) {
+                printError(myName, "Insert operation #%d did not complete.\n", op);
+                nrErr++;
+                return;
+            }
+            if (status != STS_OK) {
+                printError(myName, "Insert operation #%d failed.\n", op);
+                nrErr++;
+            }
+            refMap[key] = sessId;
+        }
+        else {
+            it = refMap.begin();
+            advance(it, rand() % refMap.size());
+            if (not camUpdate(it->first, it->second, DELETE, nrCycles, status, sMMIO_CamReady,
+                              ssLkpReq, ssLkpRep, ssUpdReq, ssUpdRep)) {
+                printError(myName, "Delete operation #%d did not complete.\n", op);
+                nrErr++;
+                return;
+            }
+            FourTuple oldKey = it->first;
+            refMap.erase(it);
+            if (camLookup(oldKey, value, sMMIO_CamReady, ssLkpReq, ssLkpRep, ssUpdReq, ssUpdRep)) {
+                printError(myName, "Deleted key is still found in [CAM] (op #%d).\n", op);
+                nrErr++;
+            }
+        }
+        if (nrCycles > maxUpdCycles) {
+            maxUpdCycles = nrCycles;
+        }
+    }
+    for (it=refMap.begin(); it!=refMap.end(); ++it) {
+        if (not camLookup(it->first, value, sMMIO_CamReady, ssLkpReq, ssLkpRep, ssUpdReq, ssUpdRep) or
+            (value != it->second)) {
+            printError(myName, "Lookup of session #%d failed after churn.\n", it->second.to_int());
+            nrErr++;
+        }
+    }
+    printInfo(myName, "\tDone with %d live entries. Max. update latency = %d cycles.\n",
+              (int)refMap.size(), maxUpdCycles);
+
+    //------------------------------------------------------
+    //-- STEP-2: FILL UNTIL THE FIRST INSERTION FAILURE
+    //------------------------------------------------------
+    printInfo(myName, "STEP-2: Filling the CAM until the first insertion failure.\n");
+    int nrInserted = refMap.size();
+    while (nrInserted < capacity) {
+        FourTuple key = randomKey(refMap);
+        RtlSessId sessId = nrInserted % (1 << 14);
+        camUpdate(key, sessId, INSERT, nrCycles, status, sMMIO_CamReady, ssLkpReq, ssLkpRep, ssUpdReq, ssUpdRep);
+        bool found = camLookup(key, value, sMMIO_CamReady, ssLkpReq, ssLkpRep, ssUpdReq, ssUpdRep);
+        if (found != (status == STS_OK)) {
+            printError(myName, "The insert reply returned status=%d but the key was %sfound in [CAM].\n",
+                       status.to_int(), found ? "" : "not ");
+            nrErr++;
+        }
+        if (not found) {
+            break;
+        }
+        refMap[key] = sessId;
+        nrInserted++;
+        if (nrCycles > maxUpdCycles) {
+            maxUpdCycles = nrCycles;
+        }
+    }
+    int load = (100 * nrInserted) / capacity;
+    printInfo(myName, "\tFirst insertion failure after %d entries (occupancy = %d%% of %d).\n",
+              nrInserted, load, capacity);
+    printInfo(myName, "\tMax. update latency = %d cycles.\n", maxUpdCycles);
+    if (nrInserted < TOE_MAX_SESSIONS) {
+        printError(myName, "The CAM cannot hold 'TOE_MAX_SESSIONS' (%d) entries.\n", TOE_MAX_SESSIONS);
+        nrErr++;
+    }
+    if (load < TB_STRESS_MIN_LOAD) {
+        printError(myName, "Occupancy at first failure is below %d%%.\n", TB_STRESS_MIN_LOAD);
+        nrErr++;
+    }
+
+    //------------------------------------------------------
+    //-- STEP-3: BACK-TO-BACK LOOKUPS
+    //------------------------------------------------------
+    printInfo(myName, "STEP-3: Issuing %d back-to-back lookups.\n", (int)refMap.size());
+    for (it=refMap.begin(); it!=refMap.end(); ++it) {
+        ssLkpReq.write(CamSessionLookupRequest(it->first, FROM_RXe));
+    }
+    int startCyc = gSimCycCnt;
+    int firstRepCyc = -1;
+    it = refMap.begin();
+    while (it != refMap.end()) {
+        stepCam(sMMIO_CamReady, ssLkpReq, ssLkpRep, ssUpdReq, ssUpdRep);
+        while (!ssLkpRep.empty()) {
+            CamSessionLookupReply lkpReply = ssLkpRep.read();
+            if (firstRepCyc < 0) {
+                firstRepCyc = gSimCycCnt;
+            }
+            if (not lkpReply.hit or (lkpReply.sessionID != it->second)) {
+                printError(myName, "Lookup of session #%d failed.\n", it->second.to_int());
+                nrErr++;
+            }
+            ++it;
+        }
+        if (gSimCycCnt - startCyc > (int)refMap.size() * TB_STRESS_TIMEOUT) {
+            printError(myName, "Timeout while waiting for the lookup replies.\n");
+            nrErr++;
+            break;
+        }
+    }
+    int nrCyc = gSimCycCnt - startCyc;
+    printInfo(myName, "\tLookup latency = %d cycle(s). Throughput = %d lookups in %d cycles.\n",
+              firstRepCyc - startCyc, (int)refMap.size(), nrCyc);
+    if (nrCyc > (int)refMap.size()) {
+        printError(myName, "The CAM does not sustain one lookup per cycle.\n");
+        nrErr++;
+    }
+
+    //------------------------------------------------------
+    //-- STEP-4: DELETE ALL THE ENTRIES
+    //------------------------------------------------------
+    printInfo(myName, "STEP-4: Deleting all the entries.\n");
+    for (it=refMap.begin(); it!=refMap.end(); ++it) {
+        camUpdate(it->first, it->second, DELETE, nrCycles, status, sMMIO_CamReady, ssLkpReq, ssLkpRep, ssUpdReq, ssUpdRep);
+    }
+    for (it=refMap.begin(); it!=refMap.end(); ++it) {
+        if (camLookup(it->first, value, sMMIO_CamReady, ssLkpReq, ssLkpRep, ssUpdReq, ssUpdRep)) {
+            printError(myName, "Session #%d is still found after deletion.\n", it->second.to_int());
+            nrErr++;
+        }
+    }
+    refMap.clear();
+
+    //------------------------------------------------------
+    //-- STEP-5: LOOKUP AFTER INSERT AND DUPLICATE INSERTIONS
+    //------------------------------------------------------
+    printInfo(myName, "STEP-5: Inserting %d keys twice.\n", TB_STRESS_DUP_KEYS);
+    for (int k=0; k<TB_STRESS_DUP_KEYS; k++) {
+        FourTuple key = randomKey(refMap);
+        RtlSessId sessId = k;
+        //-- Let the [CAM] read the insert request, then lookup the key right away
+        ssUpdReq.write(CamSessionUpdateRequest(key, sessId, INSERT, FROM_TAi));
+        stepCam(sMMIO_CamReady, ssLkpReq, ssLkpRep, ssUpdReq, ssUpdRep);
+        if (not camLookup(key, value, sMMIO_CamReady, ssLkpReq, ssLkpRep, ssUpdReq, ssUpdRep) or
+            (value != sessId)) {
+            printError(myName, "Session #%d is not found on the cycle after its insertion.\n", sessId.to_int());
+            nrErr++;
+        }
+        while (ssUpdRep.empty()) {
+            stepCam(sMMIO_CamReady, ssLkpReq, ssLkpRep, ssUpdReq, ssUpdRep);
+        }
+        if (ssUpdRep.read().status != STS_OK) {
+            printError(myName, "The insertion of session #%d failed.\n", sessId.to_int());
+            nrErr++;
+        }
+        refMap[key] = sessId;
+        //-- Insert the same key with another value
+        RtlSessId dupId = sessId + TB_STRESS_DUP_KEYS;
+        if (not camUpdate(key, dupId, INSERT, nrCycles, status, sMMIO_CamReady,
+                          ssLkpReq, ssLkpRep, ssUpdReq, ssUpdRep)) {
+            printError(myName, "The duplicate insertion of session #%d did not complete.\n", dupId.to_int());
+            nrErr++;
+            return;
+        }
+        if (status != STS_KO) {
+            printError(myName, "The duplicate insertion of session #%d was not refused.\n", dupId.to_int());
+            nrErr++;
+        }
+        if (not camLookup(key, value, sMMIO_CamReady, ssLkpReq, ssLkpRep, ssUpdReq, ssUpdRep) or
+            (value != sessId)) {
+            printError(myName, "The duplicate insertion of session #%d overwrote session #%d.\n",
+                       dupId.to_int(), sessId.to_int());
+            nrErr++;
+        }
+    }
+    for (it=refMap.begin(); it!=refMap.end(); ++it) {
+        camUpdate(it->first, it->second, DELETE, nrCycles, status, sMMIO_CamReady, ssLkpReq, ssLkpRep, ssUpdReq, ssUpdRep);
+    }
+    refMap.clear();
+}
+
+
 /*******************************************************************************
  * @brief Main function.
  *
@@ -318,6 +653,20 @@ int main(int argc, char* argv[]) {
         tbRun--;
     } // End of: while()
 
+    //-----------------------------------------------------
+    //-- STRESS TEST
+    //-----------------------------------------------------
+    if (nrErr == 0) {
+        stressCam(
+            nrErr,
+            sMMIO_CamReady,
+            ssTOE_CAM_SssLkpReq,
+            ssCAM_TOE_SssLkpRep,
+            ssTOE_CAM_SssUpdReq,
+            ssCAM_TOE_SssUpdRep
+        );
+    }
+
     printInfo(THIS_NAME, "############################################################################\n");
     printInfo(THIS_NAME, "## TESTBENCH 'test_toecam' ENDS HERE                                      ##\n");
     printInfo(THIS_NAME, "############################################################################\n");
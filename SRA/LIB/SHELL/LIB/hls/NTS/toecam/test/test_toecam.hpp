@@ -31,6 +31,7 @@
 #define _TEST_TOECAM_H_
 
 #include <hls_stream.h>
+#include <cstdlib>
 #include <map>
 #include <stdio.h>
 #include <string>
@@ -48,7 +49,7 @@
 //    'TB_STARTUP_DELAY' is used to delay the start of the [TB] functions.
 //    'TB_GRACE_TIME'    adds some cycles to drain the DUT at the end before.
 //---------------------------------------------------------
-#define TB_MAX_SIM_CYCLES     250
+#define TB_MAX_SIM_CYCLES     (250 + cCamWayDepth)  // Includes the init of the CAM
 #define TB_STARTUP_DELAY        0
 #define TB_GRACE_TIME         500
 
@@ -82,6 +83,20 @@ unsigned int    gMaxSimCycles;
 
 #define CAM_SIZE                 2          // Number of CAM entries.
 
+//---------------------------------------------------------
+//-- STRESS TEST PARAMETERS
+//--  'TB_STRESS_CHURN_OPS'  is the number of random insert/delete operations.
+//--  'TB_STRESS_CHURN_LIVE' is the max. number of live entries during churn.
+//--  'TB_STRESS_MIN_LOAD'   is the min. load factor (in %) expected at the
+//--                          first insertion failure.
+//--  'TB_STRESS_DUP_KEYS'   is the number of keys inserted twice.
+//---------------------------------------------------------
+#define TB_STRESS_CHURN_OPS  20000
+#define TB_STRESS_CHURN_LIVE (cCamNrWays*cCamWayDepth/2)
+#define TB_STRESS_MIN_LOAD      80
+#define TB_STRESS_DUP_KEYS      64
+#define TB_STRESS_TIMEOUT      100          // Max. cycles to wait for a reply
+
 #endif
 
 /*! \} */
@@ -856,6 +856,8 @@ void pRxPacketHandler(
  * @details
  *  The UDP Port Table (Upt) keeps track of the opened ports. A port is opened
  *  if its state is 'true' and closed otherwise.
+ *  The table is a 'FastClrTable' of 2048 words of 32 ports. It is cleared in a
+ *  single cycle upon reset, such that the UOE is ready right away.
  *
  * @note: We are using a stream to signal that UOE is ready because the C/RTL
  *  co-simulation only only supports the following 'ap_ctrl_none' designs:
@@ -877,8 +879,7 @@ void pUdpPortTable(
     const char *myName = concat3(THIS_NAME, "/RXe/", "Upt");
 
     //-- STATIC ARRAYS --------------------------------------------------------
-    static ValBool                  PORT_TABLE[0x10000];
-    #pragma HLS RESOURCE   variable=PORT_TABLE core=RAM_T2P_BRAM
+    static FastClrTable<ap_uint<32>, 0x800> PORT_TABLE;
     #pragma HLS DEPENDENCE variable=PORT_TABLE inter false
 
     //-- STATIC CONTROL VARIABLES (with RESET) --------------------------------
@@ -887,29 +888,25 @@ void pUdpPortTable(
     #pragma HLS RESET            variable=upt_fsmState
     static bool                           upt_isInit=false;
     #pragma HLS reset            variable=upt_isInit
-    static  UdpPort                       upt_initPtr=(0x10000-1);
-    #pragma HLS reset            variable=upt_initPtr
 
     //-- STATIC DATAFLOW VARIABLES --------------------------------------------
     static UdpPort upt_portNum;
 
-    // The PORT_TABLE must be initialized upon reset
+    //-- DYNAMIC VARIABLES ----------------------------------------------------
+    ap_uint<32>    portWord;
+
+    // The PORT_TABLE must be cleared upon reset (i.e. all ports are closed)
     if (!upt_isInit) {
-        PORT_TABLE[upt_initPtr] = STS_CLOSED;
-        if (upt_initPtr == 0) {
-            if (!soMMIO_Ready.full()) {
-                soMMIO_Ready.write(true);
-                upt_isInit = true;
-                if (DEBUG_LEVEL & TRACE_UPT) {
-                    printInfo(myName, "Done with initialization of the PORT_TABLE.\n");
-                }
-            }
-            else {
-                printWarn(myName, "Cannot signal INIT_DONE because HLS stream is not empty.\n");
+        if (!soMMIO_Ready.full()) {
+            PORT_TABLE.clear(0);
+            soMMIO_Ready.write(true);
+            upt_isInit = true;
+            if (DEBUG_LEVEL & TRACE_UPT) {
+                printInfo(myName, "Done with initialization of the PORT_TABLE.\n");
             }
-         }
+        }
         else {
-            upt_initPtr = upt_initPtr - 1;
+            printWarn(myName, "Cannot signal INIT_DONE because HLS stream is not empty.\n");
         }
         return;
     }
@@ -934,20 +931,25 @@ void pUdpPortTable(
         break;
     case UPT_RPH_LKP: // Lookup Reply
         if (!soRph_PortStateRep.full()) {
-            soRph_PortStateRep.write(PORT_TABLE[upt_portNum]);
+            portWord = PORT_TABLE.read(upt_portNum(15, 5));
+            soRph_PortStateRep.write(portWord[upt_portNum(4, 0)]);
             upt_fsmState = UPT_WAIT4REQ;
         }
         break;
     case UPT_LSN_REP: // Listen Reply
         if (!soUAIF_LsnRep.full()) {
-            PORT_TABLE[upt_portNum] = STS_OPENED;
+            portWord = PORT_TABLE.read(upt_portNum(15, 5));
+            portWord[upt_portNum(4, 0)] = STS_OPENED;
+            PORT_TABLE.write(upt_portNum(15, 5), portWord);
             soUAIF_LsnRep.write(STS_OPENED);
             upt_fsmState = UPT_WAIT4REQ;
         }
         break;
     case UPT_CLS_REP: // Close Reply
         if (!soUAIF_ClsRep.full()) {
-            PORT_TABLE[upt_portNum] = STS_CLOSED;
+            portWord = PORT_TABLE.read(upt_portNum(15, 5));
+            portWord[upt_portNum(4, 0)] = STS_CLOSED;
+            PORT_TABLE.write(upt_portNum(15, 5), portWord);
             soUAIF_ClsRep.write(STS_CLOSED);
             upt_fsmState = UPT_WAIT4REQ;
         }
@@ -1412,6 +1414,17 @@ void pTxDatagramHandler(
     }
 }
 
+/*******************************************************************************
+ * UDP Checksum Accumulator (Uca)
+ *
+ * @param[in]  siTdh_Data  UDP pseudo-packet stream from TxDatagramHandler (Tdh).
+ * @param[out] soUha_Csum  The UDP checksum to UdpHeaderAdder (Uha).
+ *
+ * @details
+ *  Accumulates the checksum of the incoming pseudo-packet on the fly with the
+ *   carry-save helpers of 'nts_utils', and forwards the final checksum to [Uha]
+ *   in the cycle following the end-of-packet.
+ *******************************************************************************/
 void pUdpChecksumAccumulator(
         stream<AxisPsd4>    &siTdh_Data,
         stream<UdpCsum>     &soUha_Csum)
@@ -1423,77 +1436,36 @@ void pUdpChecksumAccumulator(
     const char *myName  = concat3(THIS_NAME, "/TXe/", "Uca");
 
     //-- STATIC CONTROL VARIABLES (with RESET) ---------------------------------
-    static enum FsmStates { FSM_UCA_ACCUMULATE=0, FSM_UCA_LAST, FSM_UCA_DONE } \
+    static enum FsmStates { FSM_UCA_ACCUMULATE=0, FSM_UCA_DONE } \
                     uca_fsmState=FSM_UCA_ACCUMULATE;
     #pragma HLS RESET   variable=uca_fsmState
-    static ap_uint<17>           uca_csum0;
-    #pragma HLS RESET   variable=uca_csum0
-    static ap_uint<17>           uca_csum1;
-    #pragma HLS RESET   variable=uca_csum1
-    static ap_uint<17>           uca_csum2;
-    #pragma HLS RESET   variable=uca_csum2
-    static ap_uint<17>           uca_csum3;
-    #pragma HLS RESET   variable=uca_csum3
-    static AxisPsd4              uca_lastChunk;
-    #pragma HLS RESET   variable=uca_lastChunk
+    static CsumAcc               uca_csumAcc=0;
+    #pragma HLS RESET   variable=uca_csumAcc
 
     switch (uca_fsmState) {
     case FSM_UCA_ACCUMULATE:
         if (!siTdh_Data.empty()) {
             AxisPsd4 currChunk = siTdh_Data.read();
+            uca_csumAcc += csumChunk(currChunk);
             if (currChunk.getTLast()) {
-                uca_lastChunk = currChunk;
-                uca_lastChunk.clearUnusedBytes();
-                uca_fsmState = FSM_UCA_LAST;
-            }
-            else {
-                uca_csum0 += byteSwap16(currChunk.getLE_TData().range(63, 48));
-                uca_csum0  = (uca_csum0 & 0xFFFF) + (uca_csum0 >> 16);
-                uca_csum1 += byteSwap16(currChunk.getLE_TData().range(47, 32));
-                uca_csum1  = (uca_csum1 & 0xFFFF) + (uca_csum1 >> 16);
-                uca_csum2 += byteSwap16(currChunk.getLE_TData().range(31, 16));
-                uca_csum2  = (uca_csum2 & 0xFFFF) + (uca_csum2 >> 16);
-                uca_csum3 += byteSwap16(currChunk.getLE_TData().range(15,  0));
-                uca_csum3  = (uca_csum3 & 0xFFFF) + (uca_csum3 >> 16);
+                uca_fsmState = FSM_UCA_DONE;
             }
             if (DEBUG_LEVEL & TRACE_UCA) {
                 printAxisRaw(myName, "Received a new pseudo-header chunk: ", currChunk);
             }
         }
         break;
-    case FSM_UCA_LAST:
-        uca_csum0 += byteSwap16(uca_lastChunk.getLE_TData().range(63, 48));
-        uca_csum0  = (uca_csum0 & 0xFFFF) + (uca_csum0 >> 16);
-        uca_csum1 += byteSwap16(uca_lastChunk.getLE_TData().range(47, 32));
-        uca_csum1  = (uca_csum1 & 0xFFFF) + (uca_csum1 >> 16);
-        uca_csum2 += byteSwap16(uca_lastChunk.getLE_TData().range(31, 16));
-        uca_csum2  = (uca_csum2 & 0xFFFF) + (uca_csum2 >> 16);
-        uca_csum3 += byteSwap16(uca_lastChunk.getLE_TData().range(15,  0));
-        uca_csum3  = (uca_csum3 & 0xFFFF) + (uca_csum3 >> 16);
-        uca_fsmState = FSM_UCA_DONE;
-        break;
     case FSM_UCA_DONE:
         if (!soUha_Csum.full()) {
-            ap_uint<17> csum01, csum23, csum0123;
-            csum01 = uca_csum0 + uca_csum1;
-            csum01 = (csum01 & 0xFFFF) + (csum01 >> 16);
-            csum23 = uca_csum2 + uca_csum3;
-            csum23 = (csum23 & 0xFFFF) + (csum23 >> 16);
-            csum0123 = csum01 + csum23;
-            csum0123 = (csum0123 & 0xFFFF) + (csum0123 >> 16);
-            csum0123 = ~csum0123;
-            soUha_Csum.write(csum0123.range(15, 0));
-            //-- Clear the csum accumulators
-            uca_csum0 = 0;
-            uca_csum1 = 0;
-            uca_csum2 = 0;
-            uca_csum3 = 0;
+            soUha_Csum.write(~csumFold(uca_csumAcc));
+            //-- Clear the csum accumulator
+            uca_csumAcc = 0;
             if (DEBUG_LEVEL & TRACE_UCA) {
                 printInfo(myName, "End of pseudo-header packet.\n");
             }
             uca_fsmState = FSM_UCA_ACCUMULATE;
-            break;
         }
+        break;
     }
 }
 
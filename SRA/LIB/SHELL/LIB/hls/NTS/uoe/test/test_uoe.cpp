@@ -873,7 +873,7 @@ int main(int argc, char *argv[]) {
     printf("\n\n");
 
     if (tbMode == OPEN_MODE) {
-        // Wait until UOE is ready (~2^16 cycles)
+        // Wait until UOE is ready
         bool isReady = false;
         do {
             #if HLS_VERSION == 2017
@@ -1246,7 +1246,7 @@ int main(int argc, char *argv[]) {
             nrErr++;
         }
 
-        // Wait until UOE is ready (~2^16 cycles)
+        // Wait until UOE is ready
         bool isReady = false;
         do {
             #if HLS_VERSION == 2017
@@ -561,6 +561,12 @@ module Shell_Themisto # (
   wire  [ 55:0] ssNTS0_TARS_Tcp_SndRep_tdata ;
   wire          ssNTS0_TARS_Tcp_SndRep_tvalid;
   wire          ssNTS0_TARS_Tcp_SndRep_tready;
+  wire  [ 63:0] ssTARS_NTS0_Tcp_SndDsc_tdata ;
+  wire          ssTARS_NTS0_Tcp_SndDsc_tvalid;
+  wire          ssTARS_NTS0_Tcp_SndDsc_tready;
+  wire  [ 55:0] ssNTS0_TARS_Tcp_SndCpl_tdata ;
+  wire          ssNTS0_TARS_Tcp_SndCpl_tvalid;
+  wire          ssNTS0_TARS_Tcp_SndCpl_tready;
   wire  [ 63:0] ssNTS0_TARS_Tcp_Data_tdata  ;
   wire  [  7:0] ssNTS0_TARS_Tcp_Data_tkeep  ;
   wire          ssNTS0_TARS_Tcp_Data_tlast  ;
@@ -575,6 +581,15 @@ module Shell_Themisto # (
   wire  [ 31:0] ssTARS_NTS0_Tcp_DReq_tdata  ;
   wire          ssTARS_NTS0_Tcp_DReq_tvalid ;
   wire          ssTARS_NTS0_Tcp_DReq_tready ;
+  wire  [ 31:0] ssTARS_NTS0_Tcp_DscReq_tdata ;
+  wire          ssTARS_NTS0_Tcp_DscReq_tvalid;
+  wire          ssTARS_NTS0_Tcp_DscReq_tready;
+  wire  [ 71:0] ssNTS0_TARS_Tcp_RdDsc_tdata ;
+  wire          ssNTS0_TARS_Tcp_RdDsc_tvalid;
+  wire          ssNTS0_TARS_Tcp_RdDsc_tready;
+  wire  [ 31:0] ssTARS_NTS0_Tcp_RxCrd_tdata ;
+  wire          ssTARS_NTS0_Tcp_RxCrd_tvalid;
+  wire          ssTARS_NTS0_Tcp_RxCrd_tready;
   wire  [ 47:0] ssTARS_NTS0_Tcp_OpnReq_tdata ;
   wire          ssTARS_NTS0_Tcp_OpnReq_tvalid;
   wire          ssTARS_NTS0_Tcp_OpnReq_tready;
@@ -584,7 +599,7 @@ module Shell_Themisto # (
   wire  [ 15:0] ssTARS_NTS0_Tcp_ClsReq_tdata ;
   wire          ssTARS_NTS0_Tcp_ClsReq_tvalid;
   wire          ssTARS_NTS0_Tcp_ClsReq_tready;
-  wire  [ 15:0] ssTARS_NTS0_Tcp_LsnReq_tdata ;   
+  wire  [ 23:0] ssTARS_NTS0_Tcp_LsnReq_tdata ;   
   wire          ssTARS_NTS0_Tcp_LsnReq_tvalid;
   wire          ssTARS_NTS0_Tcp_LsnReq_tready;
   wire  [  7:0] ssNTS0_TARS_Tcp_LsnRep_tdata ;
@@ -663,7 +678,7 @@ module Shell_Themisto # (
   wire          ssNRC_TOE_Tcp_ClsReq_tvalid;
   wire          ssNRC_TOE_Tcp_ClsReq_tready;
   //---- Stream TCP Listen Request -----------
-  wire [ 15:0]  ssNRC_TOE_Tcp_LsnReq_tdata;
+  wire [ 23:0]  ssNRC_TOE_Tcp_LsnReq_tdata;
   wire          ssNRC_TOE_Tcp_LsnReq_tvalid;
   wire          ssNRC_TOE_Tcp_LsnReq_tready;
   //---- Stream TCP Data Status --------------
@@ -1296,6 +1311,14 @@ module Shell_Themisto # (
     .soAPP_Tcp_SndRep_tdata             (ssNTS0_TARS_Tcp_SndRep_tdata),
     .soAPP_Tcp_SndRep_tvalid            (ssNTS0_TARS_Tcp_SndRep_tvalid),
     .soAPP_Tcp_SndRep_tready            (ssNTS0_TARS_Tcp_SndRep_tready),
+    //---- Stream TCP APP Send Descriptor (zero-copy)
+    .siAPP_Tcp_SndDsc_tdata             (ssTARS_NTS0_Tcp_SndDsc_tdata),
+    .siAPP_Tcp_SndDsc_tvalid            (ssTARS_NTS0_Tcp_SndDsc_tvalid),
+    .siAPP_Tcp_SndDsc_tready            (ssTARS_NTS0_Tcp_SndDsc_tready),
+    //---- Stream TCP APP Send Completion (zero-copy)
+    .soAPP_Tcp_SndCpl_tdata             (ssNTS0_TARS_Tcp_SndCpl_tdata),
+    .soAPP_Tcp_SndCpl_tvalid            (ssNTS0_TARS_Tcp_SndCpl_tvalid),
+    .soAPP_Tcp_SndCpl_tready            (ssNTS0_TARS_Tcp_SndCpl_tready),
 
     //---------------------------------------------------
     //-- ROLE / Tcp / RxP Data Flow Interfaces    
@@ -1319,6 +1342,18 @@ module Shell_Themisto # (
     .siAPP_Tcp_DReq_tdata             (ssTARS_NTS0_Tcp_DReq_tdata),
     .siAPP_Tcp_DReq_tvalid            (ssTARS_NTS0_Tcp_DReq_tvalid),
     .siAPP_Tcp_DReq_tready            (ssTARS_NTS0_Tcp_DReq_tready),
+    //---- Stream TCP APP Read Descriptor Request (zero-copy)
+    .siAPP_Tcp_DscReq_tdata             (ssTARS_NTS0_Tcp_DscReq_tdata),
+    .siAPP_Tcp_DscReq_tvalid            (ssTARS_NTS0_Tcp_DscReq_tvalid),
+    .siAPP_Tcp_DscReq_tready            (ssTARS_NTS0_Tcp_DscReq_tready),
+    //---- Stream TCP APP Read Descriptor (zero-copy)
+    .soAPP_Tcp_RdDsc_tdata              (ssNTS0_TARS_Tcp_RdDsc_tdata),
+    .soAPP_Tcp_RdDsc_tvalid             (ssNTS0_TARS_Tcp_RdDsc_tvalid),
+    .soAPP_Tcp_RdDsc_tready             (ssNTS0_TARS_Tcp_RdDsc_tready),
+    //---- Stream TCP APP Rx Buffer Credit (zero-copy)
+    .siAPP_Tcp_RxCrd_tdata              (ssTARS_NTS0_Tcp_RxCrd_tdata),
+    .siAPP_Tcp_RxCrd_tvalid             (ssTARS_NTS0_Tcp_RxCrd_tvalid),
+    .siAPP_Tcp_RxCrd_tready             (ssTARS_NTS0_Tcp_RxCrd_tready),
     
     //------------------------------------------------------
     //-- ROLE / Tcp / TxP Ctlr Flow Interfaces
@@ -1394,6 +1429,13 @@ module Shell_Themisto # (
     .soAPP_Tcp_SndRep_tdata     (ssTOE_NRC_Tcp_SndRep_tdata ),
     .soAPP_Tcp_SndRep_tvalid    (ssTOE_NRC_Tcp_SndRep_tvalid),
     .soAPP_Tcp_SndRep_tready    (ssTOE_NRC_Tcp_SndRep_tready),
+    //-- [INFO] The NRC does not use the zero-copy send interfaces
+    .siAPP_Tcp_SndDsc_tdata     (64'b0),
+    .siAPP_Tcp_SndDsc_tvalid    (1'b0),
+    .siAPP_Tcp_SndDsc_tready    (),
+    .soAPP_Tcp_SndCpl_tdata     (),
+    .soAPP_Tcp_SndCpl_tvalid    (),
+    .soAPP_Tcp_SndCpl_tready    (1'b1),
     //-- APP / Tcp / Rx Data Interfaces (.i.e THIS<-->NRC)
     .soAPP_Tcp_Data_tdata       (ssTOE_NRC_Tcp_Data_tdata ),
     .soAPP_Tcp_Data_tkeep       (ssTOE_NRC_Tcp_Data_tkeep ),
@@ -1409,6 +1451,16 @@ module Shell_Themisto # (
     .siAPP_Tcp_DReq_tdata       (ssNRC_TOE_Tcp_DReq_tdata ),
     .siAPP_Tcp_DReq_tvalid      (ssNRC_TOE_Tcp_DReq_tvalid),
     .siAPP_Tcp_DReq_tready      (ssNRC_TOE_Tcp_DReq_tready),
+    //-- [INFO] The NRC does not use the zero-copy receive interfaces
+    .siAPP_Tcp_DscReq_tdata     (32'b0),
+    .siAPP_Tcp_DscReq_tvalid    (1'b0),
+    .siAPP_Tcp_DscReq_tready    (),
+    .soAPP_Tcp_RdDsc_tdata      (),
+    .soAPP_Tcp_RdDsc_tvalid     (),
+    .soAPP_Tcp_RdDsc_tready     (1'b1),
+    .siAPP_Tcp_RxCrd_tdata      (32'b0),
+    .siAPP_Tcp_RxCrd_tvalid     (1'b0),
+    .siAPP_Tcp_RxCrd_tready     (),
     //-- APP / Tcp / Tx Ctlr Interfaces (.i.e THIS<-->NRC)
     .siAPP_Tcp_OpnReq_tdata     (ssNRC_TOE_Tcp_OpnReq_tdata ),
     .siAPP_Tcp_OpnReq_tvalid    (ssNRC_TOE_Tcp_OpnReq_tvalid),
@@ -1439,6 +1491,12 @@ module Shell_Themisto # (
     .siNTS_Tcp_SndRep_tdata     (ssNTS0_TARS_Tcp_SndRep_tdata  ),
     .siNTS_Tcp_SndRep_tvalid    (ssNTS0_TARS_Tcp_SndRep_tvalid ),
     .siNTS_Tcp_SndRep_tready    (ssNTS0_TARS_Tcp_SndRep_tready ),
+    .soNTS_Tcp_SndDsc_tdata     (ssTARS_NTS0_Tcp_SndDsc_tdata ),
+    .soNTS_Tcp_SndDsc_tvalid    (ssTARS_NTS0_Tcp_SndDsc_tvalid),
+    .soNTS_Tcp_SndDsc_tready    (ssTARS_NTS0_Tcp_SndDsc_tready),
+    .siNTS_Tcp_SndCpl_tdata     (ssNTS0_TARS_Tcp_SndCpl_tdata  ),
+    .siNTS_Tcp_SndCpl_tvalid    (ssNTS0_TARS_Tcp_SndCpl_tvalid ),
+    .siNTS_Tcp_SndCpl_tready    (ssNTS0_TARS_Tcp_SndCpl_tready ),
     //-- NTS / Tcp / Rx Data Interfaces (.i.e NTS<-->THIS)
     .siNTS_Tcp_Data_tdata       (ssNTS0_TARS_Tcp_Data_tdata ),
     .siNTS_Tcp_Data_tkeep       (ssNTS0_TARS_Tcp_Data_tkeep ),
@@ -1454,6 +1512,15 @@ module Shell_Themisto # (
     .soNTS_Tcp_DReq_tdata       (ssTARS_NTS0_Tcp_DReq_tdata ),
     .soNTS_Tcp_DReq_tvalid      (ssTARS_NTS0_Tcp_DReq_tvalid),
     .soNTS_Tcp_DReq_tready      (ssTARS_NTS0_Tcp_DReq_tready),
+    .soNTS_Tcp_DscReq_tdata     (ssTARS_NTS0_Tcp_DscReq_tdata),
+    .soNTS_Tcp_DscReq_tvalid    (ssTARS_NTS0_Tcp_DscReq_tvalid),
+    .soNTS_Tcp_DscReq_tready    (ssTARS_NTS0_Tcp_DscReq_tready),
+    .siNTS_Tcp_RdDsc_tdata      (ssNTS0_TARS_Tcp_RdDsc_tdata),
+    .siNTS_Tcp_RdDsc_tvalid     (ssNTS0_TARS_Tcp_RdDsc_tvalid),
+    .siNTS_Tcp_RdDsc_tready     (ssNTS0_TARS_Tcp_RdDsc_tready),
+    .soNTS_Tcp_RxCrd_tdata      (ssTARS_NTS0_Tcp_RxCrd_tdata),
+    .soNTS_Tcp_RxCrd_tvalid     (ssTARS_NTS0_Tcp_RxCrd_tvalid),
+    .soNTS_Tcp_RxCrd_tready     (ssTARS_NTS0_Tcp_RxCrd_tready),
     //-- NTS / Tcp / Tx Ctlr Interfaces (.i.e NTS<-->THIS)
     .soNTS_Tcp_OpnReq_tdata     (ssTARS_NTS0_Tcp_OpnReq_tdata ),
     .soNTS_Tcp_OpnReq_tvalid    (ssTARS_NTS0_Tcp_OpnReq_tvalid),
@@ -2147,9 +2214,9 @@ module Shell_Themisto # (
     .siTOE_SessId_V_V_TDATA         (ssTOE_NRC_Tcp_Meta_tdata),
     .siTOE_SessId_V_V_TVALID        (ssTOE_NRC_Tcp_Meta_tvalid),
     .siTOE_SessId_V_V_TREADY        (ssTOE_NRC_Tcp_Meta_tready),
-    .soTOE_LsnReq_V_V_TDATA         (ssNRC_TOE_Tcp_LsnReq_tdata),
-    .soTOE_LsnReq_V_V_TVALID        (ssNRC_TOE_Tcp_LsnReq_tvalid),
-    .soTOE_LsnReq_V_V_TREADY        (ssNRC_TOE_Tcp_LsnReq_tready),
+    .soTOE_LsnReq_V_TDATA           (ssNRC_TOE_Tcp_LsnReq_tdata),
+    .soTOE_LsnReq_V_TVALID          (ssNRC_TOE_Tcp_LsnReq_tvalid),
+    .soTOE_LsnReq_V_TREADY          (ssNRC_TOE_Tcp_LsnReq_tready),
     .siTOE_LsnRep_V_TDATA           (ssTOE_NRC_Tcp_LsnRep_tdata),
     .siTOE_LsnRep_V_TVALID          (ssTOE_NRC_Tcp_LsnRep_tvalid),
     .siTOE_LsnRep_V_TREADY          (ssTOE_NRC_Tcp_LsnRep_tready),
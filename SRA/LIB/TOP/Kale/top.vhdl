@@ -268,6 +268,14 @@ architecture structural of topFMKU60 is
   signal ssSHL_ROL_Nts_Tcp_SndRep_tdata     : std_ulogic_vector( 55 downto 0);
   signal ssSHL_ROL_Nts_Tcp_SndRep_tvalid    : std_ulogic;
   signal ssSHL_ROL_Nts_Tcp_SndRep_tready    : std_ulogic;
+  ---- Axi4-Stream TCP Send Descriptor (zero-copy)
+  signal ssROL_SHL_Nts_Tcp_SndDsc_tdata     : std_ulogic_vector( 63 downto 0);
+  signal ssROL_SHL_Nts_Tcp_SndDsc_tvalid    : std_ulogic;
+  signal ssROL_SHL_Nts_Tcp_SndDsc_tready    : std_ulogic;
+  ---- Axi4-Stream TCP Send Completion (zero-copy)
+  signal ssSHL_ROL_Nts_Tcp_SndCpl_tdata     : std_ulogic_vector( 55 downto 0);
+  signal ssSHL_ROL_Nts_Tcp_SndCpl_tvalid    : std_ulogic;
+  signal ssSHL_ROL_Nts_Tcp_SndCpl_tready    : std_ulogic;
   
   -- SHELL-->ROLE / Nts / Tcp / Rx Data Interfaces
   ---- Axi4-Stream TCP Data -----------------
@@ -288,6 +296,18 @@ architecture structural of topFMKU60 is
   signal ssROL_SHL_Nts_Tcp_DReq_tdata       : std_ulogic_vector( 31 downto 0);
   signal ssROL_SHL_Nts_Tcp_DReq_tvalid      : std_ulogic;
   signal ssROL_SHL_Nts_Tcp_DReq_tready      : std_ulogic;
+  ---- Axi4-Stream TCP Read Descriptor Request (zero-copy)
+  signal ssROL_SHL_Nts_Tcp_DscReq_tdata     : std_ulogic_vector( 31 downto 0);
+  signal ssROL_SHL_Nts_Tcp_DscReq_tvalid    : std_ulogic;
+  signal ssROL_SHL_Nts_Tcp_DscReq_tready    : std_ulogic;
+  ---- Axi4-Stream TCP Read Descriptor (zero-copy)
+  signal ssSHL_ROL_Nts_Tcp_RdDsc_tdata      : std_ulogic_vector( 71 downto 0);
+  signal ssSHL_ROL_Nts_Tcp_RdDsc_tvalid     : std_ulogic;
+  signal ssSHL_ROL_Nts_Tcp_RdDsc_tready     : std_ulogic;
+  ---- Axi4-Stream TCP Rx Buffer Credit (zero-copy)
+  signal ssROL_SHL_Nts_Tcp_RxCrd_tdata      : std_ulogic_vector( 31 downto 0);
+  signal ssROL_SHL_Nts_Tcp_RxCrd_tvalid     : std_ulogic;
+  signal ssROL_SHL_Nts_Tcp_RxCrd_tready     : std_ulogic;
   
   -- ROLE-->SHELL / Nts / Tcp / TxP Ctlr Interfaces
   ---- Axi4-Stream TCP Open Session Request
@@ -305,7 +325,7 @@ architecture structural of topFMKU60 is
   
   -- SHELL-->ROLE / Nts / Tcp / Rx Ctlr Interfaces
   ----  Axi4-Stream TCP Listen Request ----
-  signal ssROL_SHL_Nts_Tcp_LsnReq_tdata     : std_ulogic_vector( 15 downto 0);   
+  signal ssROL_SHL_Nts_Tcp_LsnReq_tdata     : std_ulogic_vector( 23 downto 0);   
   signal ssROL_SHL_Nts_Tcp_LsnReq_tvalid    : std_ulogic;
   signal ssROL_SHL_Nts_Tcp_LsnReq_tready    : std_ulogic;
   ----  Axi4-Stream TCP Listen Rep --------
@@ -560,6 +580,14 @@ architecture structural of topFMKU60 is
       soROL_Nts_Tcp_SndRep_tdata        : out   std_ulogic_vector( 55 downto 0);
       soROL_Nts_Tcp_SndRep_tvalid       : out   std_ulogic;
       soROL_Nts_Tcp_SndRep_tready       : in    std_ulogic;
+      ---- Axi4-Stream TCP Send Descriptor (zero-copy)
+      siROL_Nts_Tcp_SndDsc_tdata        : in    std_ulogic_vector( 63 downto 0);
+      siROL_Nts_Tcp_SndDsc_tvalid       : in    std_ulogic;
+      siROL_Nts_Tcp_SndDsc_tready       : out   std_ulogic;
+      ---- Axi4-Stream TCP Send Completion (zero-copy)
+      soROL_Nts_Tcp_SndCpl_tdata        : out   std_ulogic_vector( 55 downto 0);
+      soROL_Nts_Tcp_SndCpl_tvalid       : out   std_ulogic;
+      soROL_Nts_Tcp_SndCpl_tready       : in    std_ulogic;
       ------------------------------------------------------
       -- ROLE / Nts / Tcp / Rx Data Interfaces  (.i.e SHELL-->ROLE)
       ------------------------------------------------------
@@ -581,6 +609,18 @@ architecture structural of topFMKU60 is
       siROL_Nts_Tcp_DReq_tdata          : in    std_ulogic_vector( 31 downto 0);
       siROL_Nts_Tcp_DReq_tvalid         : in    std_ulogic;
       siROL_Nts_Tcp_DReq_tready         : out   std_ulogic;
+      ---- Axi4-Stream TCP Read Descriptor Request (zero-copy)
+      siROL_Nts_Tcp_DscReq_tdata        : in    std_ulogic_vector( 31 downto 0);
+      siROL_Nts_Tcp_DscReq_tvalid       : in    std_ulogic;
+      siROL_Nts_Tcp_DscReq_tready       : out   std_ulogic;
+      ---- Axi4-Stream TCP Read Descriptor (zero-copy)
+      soROL_Nts_Tcp_RdDsc_tdata         : out   std_ulogic_vector( 71 downto 0);
+      soROL_Nts_Tcp_RdDsc_tvalid        : out   std_ulogic;
+      soROL_Nts_Tcp_RdDsc_tready        : in    std_ulogic;
+      ---- Axi4-Stream TCP Rx Buffer Credit (zero-copy)
+      siROL_Nts_Tcp_RxCrd_tdata         : in    std_ulogic_vector( 31 downto 0);
+      siROL_Nts_Tcp_RxCrd_tvalid        : in    std_ulogic;
+      siROL_Nts_Tcp_RxCrd_tready        : out   std_ulogic;
       ------------------------------------------------------
       -- ROLE / Nts / Tcp / TxP Ctlr Interfaces (.i.e ROLE-->SHELL)
       ------------------------------------------------------
@@ -600,7 +640,7 @@ architecture structural of topFMKU60 is
       -- ROLE / Nts / Tcp / Rx Ctlr Interfaces (.i.e SHELL-->ROLE)
       ------------------------------------------------------
       ----  Axi4-Stream TCP Listen Request ----
-      siROL_Nts_Tcp_LsnReq_tdata        : in  std_ulogic_vector( 15 downto 0);   
+      siROL_Nts_Tcp_LsnReq_tdata        : in  std_ulogic_vector( 23 downto 0);   
       siROL_Nts_Tcp_LsnReq_tvalid       : in  std_ulogic;
       siROL_Nts_Tcp_LsnReq_tready       : out std_ulogic;
       ----  Axi4-Stream TCP Listen Rep --------
@@ -772,6 +812,14 @@ architecture structural of topFMKU60 is
       siSHL_Nts_Tcp_SndRep_tdata          : in    std_ulogic_vector( 55 downto 0);
       siSHL_Nts_Tcp_SndRep_tvalid         : in    std_ulogic;
       siSHL_Nts_Tcp_SndRep_tready         : out   std_ulogic;
+      ---- Axi4-Stream TCP Send Descriptor (zero-copy)
+      soSHL_Nts_Tcp_SndDsc_tdata          : out   std_ulogic_vector( 63 downto 0);
+      soSHL_Nts_Tcp_SndDsc_tvalid         : out   std_ulogic;
+      soSHL_Nts_Tcp_SndDsc_tready         : in    std_ulogic;
+      ---- Axi4-Stream TCP Send Completion (zero-copy)
+      siSHL_Nts_Tcp_SndCpl_tdata          : in    std_ulogic_vector( 55 downto 0);
+      siSHL_Nts_Tcp_SndCpl_tvalid         : in    std_ulogic;
+      siSHL_Nts_Tcp_SndCpl_tready         : out   std_ulogic;
       --------------------------------------------------------
       -- SHELL / Nts / Tcp / Rx Data Interfaces  (.i.e SHELL-->ROLE)
       --------------------------------------------------------
@@ -793,6 +841,18 @@ architecture structural of topFMKU60 is
       soSHL_Nts_Tcp_DReq_tdata            : out   std_ulogic_vector( 31 downto 0); 
       soSHL_Nts_Tcp_DReq_tvalid           : out   std_ulogic;       
       soSHL_Nts_Tcp_DReq_tready           : in    std_ulogic;
+      ---- Axi4-Stream TCP Read Descriptor Request (zero-copy)
+      soSHL_Nts_Tcp_DscReq_tdata          : out   std_ulogic_vector( 31 downto 0);
+      soSHL_Nts_Tcp_DscReq_tvalid         : out   std_ulogic;
+      soSHL_Nts_Tcp_DscReq_tready         : in    std_ulogic;
+      ---- Axi4-Stream TCP Read Descriptor (zero-copy)
+      siSHL_Nts_Tcp_RdDsc_tdata           : in    std_ulogic_vector( 71 downto 0);
+      siSHL_Nts_Tcp_RdDsc_tvalid          : in    std_ulogic;
+      siSHL_Nts_Tcp_RdDsc_tready          : out   std_ulogic;
+      ---- Axi4-Stream TCP Rx Buffer Credit (zero-copy)
+      soSHL_Nts_Tcp_RxCrd_tdata           : out   std_ulogic_vector( 31 downto 0);
+      soSHL_Nts_Tcp_RxCrd_tvalid          : out   std_ulogic;
+      soSHL_Nts_Tcp_RxCrd_tready          : in    std_ulogic;
       ------------------------------------------------------
       -- SHELL / Nts / Tcp / TxP Ctlr Interfaces (.i.e ROLE<-->SHELL)
       ------------------------------------------------------
@@ -812,7 +872,7 @@ architecture structural of topFMKU60 is
       -- SHELL / Nts / Tcp / Rx Ctlr Interfaces (.i.e SHELL-->ROLE)
       ------------------------------------------------------
       ---- Axi4-Stream TCP Listen Request ----
-      soSHL_Nts_Tcp_LsnReq_tdata          : out    std_ulogic_vector( 15 downto 0);  
+      soSHL_Nts_Tcp_LsnReq_tdata          : out    std_ulogic_vector( 23 downto 0);  
       soSHL_Nts_Tcp_LsnReq_tvalid         : out    std_ulogic;
       soSHL_Nts_Tcp_LsnReq_tready         : in     std_ulogic;
       ---- Stream TCP Listen Status ----
@@ -1127,6 +1187,14 @@ begin
       soROL_Nts_Tcp_SndRep_tdata    => ssSHL_ROL_Nts_Tcp_SndRep_tdata,
       soROL_Nts_Tcp_SndRep_tvalid   => ssSHL_ROL_Nts_Tcp_SndRep_tvalid, 
       soROL_Nts_Tcp_SndRep_tready   => ssSHL_ROL_Nts_Tcp_SndRep_tready,
+      ---- Axi4-Stream TCP Send Descriptor (zero-copy)
+      siROL_Nts_Tcp_SndDsc_tdata    => ssROL_SHL_Nts_Tcp_SndDsc_tdata,
+      siROL_Nts_Tcp_SndDsc_tvalid   => ssROL_SHL_Nts_Tcp_SndDsc_tvalid,
+      siROL_Nts_Tcp_SndDsc_tready   => ssROL_SHL_Nts_Tcp_SndDsc_tready,
+      ---- Axi4-Stream TCP Send Completion (zero-copy)
+      soROL_Nts_Tcp_SndCpl_tdata    => ssSHL_ROL_Nts_Tcp_SndCpl_tdata,
+      soROL_Nts_Tcp_SndCpl_tvalid   => ssSHL_ROL_Nts_Tcp_SndCpl_tvalid,
+      soROL_Nts_Tcp_SndCpl_tready   => ssSHL_ROL_Nts_Tcp_SndCpl_tready,
       ------------------------------------------------------
       -- ROLE / Nts / Tcp / Rx Data Interfaces  (.i.e SHELL-->ROLE)
       ------------------------------------------------------
@@ -1148,6 +1216,18 @@ begin
       siROL_Nts_Tcp_DReq_tdata      => ssROL_SHL_Nts_Tcp_DReq_tdata,
       siROL_Nts_Tcp_DReq_tvalid     => ssROL_SHL_Nts_Tcp_DReq_tvalid,
       siROL_Nts_Tcp_DReq_tready     => ssROL_SHL_Nts_Tcp_DReq_tready,
+      ---- Axi4-Stream TCP Read Descriptor Request (zero-copy)
+      siROL_Nts_Tcp_DscReq_tdata    => ssROL_SHL_Nts_Tcp_DscReq_tdata,
+      siROL_Nts_Tcp_DscReq_tvalid   => ssROL_SHL_Nts_Tcp_DscReq_tvalid,
+      siROL_Nts_Tcp_DscReq_tready   => ssROL_SHL_Nts_Tcp_DscReq_tready,
+      ---- Axi4-Stream TCP Read Descriptor (zero-copy)
+      soROL_Nts_Tcp_RdDsc_tdata     => ssSHL_ROL_Nts_Tcp_RdDsc_tdata,
+      soROL_Nts_Tcp_RdDsc_tvalid    => ssSHL_ROL_Nts_Tcp_RdDsc_tvalid,
+      soROL_Nts_Tcp_RdDsc_tready    => ssSHL_ROL_Nts_Tcp_RdDsc_tready,
+      ---- Axi4-Stream TCP Rx Buffer Credit (zero-copy)
+      siROL_Nts_Tcp_RxCrd_tdata     => ssROL_SHL_Nts_Tcp_RxCrd_tdata,
+      siROL_Nts_Tcp_RxCrd_tvalid    => ssROL_SHL_Nts_Tcp_RxCrd_tvalid,
+      siROL_Nts_Tcp_RxCrd_tready    => ssROL_SHL_Nts_Tcp_RxCrd_tready,
       ------------------------------------------------------
       -- ROLE / Nts / Tcp / TxP Ctlr Interfaces (.i.e ROLE-->SHELL)
       ------------------------------------------------------
@@ -1338,6 +1418,14 @@ begin
       siSHL_Nts_Tcp_SndRep_tdata        => ssSHL_ROL_Nts_Tcp_SndRep_tdata ,
       siSHL_Nts_Tcp_SndRep_tvalid       => ssSHL_ROL_Nts_Tcp_SndRep_tvalid,
       siSHL_Nts_Tcp_SndRep_tready       => ssSHL_ROL_Nts_Tcp_SndRep_tready,
+      ---- Axi4-Stream TCP Send Descriptor (zero-copy)
+      soSHL_Nts_Tcp_SndDsc_tdata        => ssROL_SHL_Nts_Tcp_SndDsc_tdata ,
+      soSHL_Nts_Tcp_SndDsc_tvalid       => ssROL_SHL_Nts_Tcp_SndDsc_tvalid,
+      soSHL_Nts_Tcp_SndDsc_tready       => ssROL_SHL_Nts_Tcp_SndDsc_tready,
+      ---- Axi4-Stream TCP Send Completion (zero-copy)
+      siSHL_Nts_Tcp_SndCpl_tdata        => ssSHL_ROL_Nts_Tcp_SndCpl_tdata ,
+      siSHL_Nts_Tcp_SndCpl_tvalid       => ssSHL_ROL_Nts_Tcp_SndCpl_tvalid,
+      siSHL_Nts_Tcp_SndCpl_tready       => ssSHL_ROL_Nts_Tcp_SndCpl_tready,
       --------------------------------------------------------
       -- SHELL / Nts / Tcp / Rx Data Interfaces  (.i.e SHELL-->ROLE)
       --------------------------------------------------------
@@ -1359,6 +1447,18 @@ begin
       soSHL_Nts_Tcp_DReq_tdata          => ssROL_SHL_Nts_Tcp_DReq_tdata,
       soSHL_Nts_Tcp_DReq_tvalid         => ssROL_SHL_Nts_Tcp_DReq_tvalid,  
       soSHL_Nts_Tcp_DReq_tready         => ssROL_SHL_Nts_Tcp_DReq_tready,
+      ---- Axi4-Stream TCP Read Descriptor Request (zero-copy)
+      soSHL_Nts_Tcp_DscReq_tdata        => ssROL_SHL_Nts_Tcp_DscReq_tdata,
+      soSHL_Nts_Tcp_DscReq_tvalid       => ssROL_SHL_Nts_Tcp_DscReq_tvalid,
+      soSHL_Nts_Tcp_DscReq_tready       => ssROL_SHL_Nts_Tcp_DscReq_tready,
+      ---- Axi4-Stream TCP Read Descriptor (zero-copy)
+      siSHL_Nts_Tcp_RdDsc_tdata         => ssSHL_ROL_Nts_Tcp_RdDsc_tdata,
+      siSHL_Nts_Tcp_RdDsc_tvalid        => ssSHL_ROL_Nts_Tcp_RdDsc_tvalid,
+      siSHL_Nts_Tcp_RdDsc_tready        => ssSHL_ROL_Nts_Tcp_RdDsc_tready,
+      ---- Axi4-Stream TCP Rx Buffer Credit (zero-copy)
+      soSHL_Nts_Tcp_RxCrd_tdata         => ssROL_SHL_Nts_Tcp_RxCrd_tdata,
+      soSHL_Nts_Tcp_RxCrd_tvalid        => ssROL_SHL_Nts_Tcp_RxCrd_tvalid,
+      soSHL_Nts_Tcp_RxCrd_tready        => ssROL_SHL_Nts_Tcp_RxCrd_tready,
       ------------------------------------------------------
       -- SHELL / Nts / Tcp / TxP Ctlr Interfaces (.i.e ROLE-->SHELL)
       ------------------------------------------------------